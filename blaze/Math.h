@@ -44,8 +44,10 @@
 #include <blaze/math/Aliases.h>
 #include <blaze/math/AlignmentFlag.h>
 #include <blaze/math/Band.h>
+#include <blaze/math/BatchedMatrix.h>
 #include <blaze/math/BLAS.h>
 #include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/CompressedMatrixView.h>
 #include <blaze/math/CompressedVector.h>
 #include <blaze/math/Constraints.h>
 #include <blaze/math/CustomMatrix.h>
@@ -55,6 +57,7 @@
 #include <blaze/math/DynamicVector.h>
 #include <blaze/math/Epsilon.h>
 #include <blaze/math/Functors.h>
+#include <blaze/math/Fusion.h>
 #include <blaze/math/IdentityMatrix.h>
 #include <blaze/math/Infinity.h>
 #include <blaze/math/InitializerMatrix.h>
@@ -65,11 +68,14 @@
 #include <blaze/math/HybridVector.h>
 #include <blaze/math/LAPACK.h>
 #include <blaze/math/LowerMatrix.h>
+#include <blaze/math/MappedMatrix.h>
 #include <blaze/math/PaddingFlag.h>
 #include <blaze/math/ReductionFlag.h>
 #include <blaze/math/RelaxationFlag.h>
 #include <blaze/math/Serialization.h>
 #include <blaze/math/Shims.h>
+#include <blaze/math/SlicedEllpackMatrix.h>
+#include <blaze/math/SplitCompressedVector.h>
 #include <blaze/math/SMP.h>
 #include <blaze/math/StaticMatrix.h>
 #include <blaze/math/StaticVector.h>
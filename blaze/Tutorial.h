@@ -249,6 +249,8 @@
 // values \b Blaze requires <a href="https://en.wikipedia.org/wiki/LAPACK">LAPACK</a>. When either
 // of these features is used it is necessary to link the LAPACK library to the final executable.
 // If no LAPACK library is available the use of these features will result in a linker error.
+// The LU and Cholesky decompositions, the dense matrix inversion and the dense linear system
+// solvers can alternatively be handled by native \b Blaze kernels (see \ref lapack_mode).
 //
 // Furthermore, it is possible to use Boost threads to run numeric operations in parallel. In this
 // case the Boost library is required to be installed on your system. It is recommended to use the
@@ -13138,8 +13140,16 @@
 // When any of the shared memory parallelization techniques is activated, all arithmetic
 // operations on dense vectors and matrices (including additions, subtractions, multiplications,
 // divisions, and all componentwise arithmetic operations) and most operations on sparse vectors
-// and matrices are automatically run in parallel. However, in addition, \b Blaze provides means
-// to enforce the serial execution of specific operations:
+// and matrices are automatically run in parallel. Assignments to a compressed matrix (as for
+// instance the result of a sparse matrix multiplication, addition, subtraction, or Schur product,
+// or the conversion of a dense matrix into a compressed matrix) are parallelized by means of a
+// two-pass algorithm: In the first pass blocks of rows (or columns) of the result are evaluated
+// in parallel, which also determines the number of non-zero elements of each row (or column).
+// Based on these counts the storage of the compressed matrix is allocated at once and in the
+// second pass all blocks are copied into the compressed matrix in parallel.
+//
+// However, in addition, \b Blaze provides means to enforce the serial execution of specific
+// operations:
 //
 //  - \ref serial_execution
 //
@@ -13278,6 +13288,29 @@
 // threads.
 //
 //
+// \n \section cpp_threads_work_stealing Work-Stealing Scheduler
+// <hr>
+//
+// By default, every parallel operation is split into one chunk per thread and all chunks are
+// handed out via a single, mutex-protected task queue. Thus the duration of an operation is
+// determined by the slowest thread. For uneven workloads (for instance sparse matrices with a
+// nonuniform number of non-zero elements per row or triangular matrices) or in case some cores
+// are slower than others (for instance due to NUMA effects or other processes on the system)
+// it is possible to activate a work-stealing scheduler via the \c BLAZE_USE_WORK_STEALING
+// command line argument:
+
+   \code
+   ... -std=c++11 -DBLAZE_USE_CPP_THREADS -DBLAZE_USE_WORK_STEALING ...
+   \endcode
+
+// In this mode every thread owns a lock-free task deque and every operation is split into
+// \c BLAZE_WORK_STEALING_GRANULARITY chunks per thread (see the <tt><blaze/config/SMP.h></tt>
+// configuration file). As soon as a thread has finished its own chunks, it steals half of the
+// remaining chunks of another thread. The work-stealing scheduler can be used in combination
+// with both the C++11 and the Boost thread-based parallelization. When using CMake, it can be
+// activated via the \c BLAZE_SMP_WORK_STEALING option.
+//
+//
 // \n \section cpp_threads_configuration C++11 Thread Configuration
 // <hr>
 //
@@ -14065,6 +14098,25 @@
 // functionality, but performance may be limited.
 //
 //
+// \n \section lapack_mode LAPACK Mode
+// <hr>
+//
+// By default, the LU decomposition, the Cholesky decomposition, the dense matrix inversion and
+// the dense linear system solvers are handled by the according LAPACK functions. Via the following
+// compilation switch in the configuration file <tt>./blaze/config/LAPACK.h</tt> these operations
+// can be handed to the native, blocked \b Blaze kernels instead:
+
+   \code
+   #define BLAZE_LAPACK_MODE 0
+   \endcode
+
+// In this case it is not necessary to link a LAPACK library for these operations. The native
+// kernels build on the \b Blaze dense matrix multiplication and are therefore vectorized and
+// parallelized. Symmetric and Hermitian indefinite matrices are handled by an LU decomposition.
+// All other LAPACK based functionality (as for instance the QR decomposition, the singular value
+// decomposition, or the computation of eigenvalues) still requires LAPACK.
+//
+//
 // \n \section cache_size Cache Size
 // <hr>
 //
@@ -14112,6 +14164,19 @@
 // the operations. Note that deactivating the vectorization may pose a severe performance
 // limitation for a large number of operations!
 //
+// Without the Intel SVML, the \c exp(), \c log(), \c sin(), \c cos(), and \c tanh() functions
+// are not vectorized by default. Built-in SIMD implementations of these functions can be
+// activated via the \c BLAZE_USE_BUILTIN_SIMD_MATH switch:
+
+   \code
+   #define BLAZE_USE_BUILTIN_SIMD_MATH 1
+   #include <blaze/Blaze.h>
+   \endcode
+
+// Note that the results of the built-in implementations may differ from the results of the
+// scalar functions of the standard library in the last bits (see
+// <tt>./blaze/config/Vectorization.h</tt> for the maximum errors).
+//
 //
 // \n \section thresholds Thresholds
 // <hr>
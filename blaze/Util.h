@@ -46,9 +46,11 @@
 #include <blaze/util/Algorithms.h>
 #include <blaze/util/AsConst.h>
 #include <blaze/util/Assert.h>
+#include <blaze/util/CacheInfo.h>
 #include <blaze/util/CheckedDelete.h>
 #include <blaze/util/ColorMacros.h>
 #include <blaze/util/Complex.h>
+#include <blaze/util/Compression.h>
 #include <blaze/util/Constraints.h>
 #include <blaze/util/DimensionOf.h>
 #include <blaze/util/EmptyType.h>
@@ -59,13 +61,16 @@
 #include <blaze/util/InitializerList.h>
 #include <blaze/util/IntegralConstant.h>
 #include <blaze/util/InvalidType.h>
+#include <blaze/util/KernelTrace.h>
 #include <blaze/util/Limits.h>
 #include <blaze/util/Memory.h>
+#include <blaze/util/MemoryMap.h>
 #include <blaze/util/MemoryPool.h>
 #include <blaze/util/MPL.h>
 #include <blaze/util/NonCopyable.h>
 #include <blaze/util/NonCreatable.h>
 #include <blaze/util/NullType.h>
+#include <blaze/util/NUMA.h>
 #include <blaze/util/NumericCast.h>
 #include <blaze/util/PointerCast.h>
 #include <blaze/util/Policies.h>
@@ -79,10 +84,12 @@
 #include <blaze/util/ThreadPool.h>
 #include <blaze/util/Time.h>
 #include <blaze/util/Timing.h>
+#include <blaze/util/Topology.h>
 #include <blaze/util/TypeList.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/TypeTraits.h>
 #include <blaze/util/UnsignedValue.h>
 #include <blaze/util/ValueTraits.h>
+#include <blaze/util/WorkStealingPool.h>
 
 #endif
@@ -55,3 +55,32 @@
 #define BLAZE_CACHE_SIZE 3145728UL
 #endif
 //*************************************************************************************************
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the runtime detection of the cache sizes.
+// \ingroup config
+//
+// This compilation switch enables the detection of the cache sizes of the executing CPU at
+// program startup. In case the switch is set to 1 (the default), the size of the last-level
+// cache is determined via the operating system or the \c cpuid instruction and replaces the
+// value of \c BLAZE_CACHE_SIZE, which then merely serves as fallback in case the detection
+// fails. Additionally, the block sizes of the blocked transposition and of the dense matrix
+// multiplication kernels are adapted to the detected L1, L2, and L3 cache sizes. In case the
+// switch is set to 0, all cache sizes and block sizes are compile time constants.
+//
+// Possible settings for the cache detection switch:
+//  - Deactivated: \b 0
+//  - Activated  : \b 1 (default)
+//
+// \note It is possible to (de-)activate the cache detection via command line or by defining
+// this symbol manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_USE_CACHE_DETECTION 1
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_USE_CACHE_DETECTION
+#define BLAZE_USE_CACHE_DETECTION 1
+#endif
+//*************************************************************************************************
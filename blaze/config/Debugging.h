@@ -85,3 +85,31 @@
 #define BLAZE_USE_FUNCTION_TRACES 0
 #endif
 //*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compilation switch for kernel traces.
+// \ingroup config
+//
+// This compilation switch triggers the use of kernel traces. In case the switch is set to 1,
+// the execution of the computational kernels (e.g. the dense matrix/dense matrix multiplication
+// kernels and the SMP assignment kernels) is recorded via the BLAZE_KERNEL_TRACE macro. The
+// recorded events can be written in the Chrome trace event format via writeKernelTraces(). In
+// contrast to function traces, kernel traces are cheap enough for production runs.
+//
+// Possible settings for the kernel trace switch:
+//  - Deactivated: \b 0 (default)
+//  - Activated  : \b 1
+//
+// \note It is possible to (de-)activate kernel traces via command line or by defining this
+// symbol manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_USE_KERNEL_TRACES 1
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_USE_KERNEL_TRACES
+#define BLAZE_USE_KERNEL_TRACES 0
+#endif
+//*************************************************************************************************
@@ -58,3 +58,122 @@
 #define BLAZE_USE_SHARED_MEMORY_PARALLELIZATION 1
 #endif
 //*************************************************************************************************
+
+//*************************************************************************************************
+/*!\brief Number of chunks per thread for the work-stealing scheduler.
+// \ingroup config
+//
+// In case the work-stealing scheduler of the C++11 and Boost thread-based parallelization is
+// activated (see the \c BLAZE_USE_WORK_STEALING command line argument), every parallel (compound)
+// assignment is split into \c BLAZE_WORK_STEALING_GRANULARITY chunks per thread. Finer chunks
+// allow a better balancing of uneven workloads between the threads, coarser chunks reduce the
+// scheduling overhead. The value must be at least 1. The default value is 4.
+//
+// \note It is possible to specify the granularity via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_WORK_STEALING_GRANULARITY 8
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_WORK_STEALING_GRANULARITY
+#define BLAZE_WORK_STEALING_GRANULARITY 4
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compilation switch for bitwise reproducible reductions.
+// \ingroup config
+//
+// This compilation switch enables/disables the reproducible evaluation of dense reductions
+// (\c sum(), \c prod(), \c min(), \c max(), \c reduce()), inner products (\c dot()), norms and
+// dense matrix/dense vector multiplications. By default, the shape of the reduction tree of a
+// parallel reduction depends on the number of threads, i.e. the result of a floating point
+// reduction might change in the last bits if the number of threads is changed. In case the
+// switch is set to 1, every reduction is split into blocks of a fixed size (see the
+// \c BLAZE_REPRODUCIBLE_REDUCTION_BLOCK_SIZE setting), which only depends on the size of the
+// operands, and the partial results of all blocks are combined in ascending order. Additionally,
+// the kernel of a dense matrix/dense vector multiplication no longer depends on the size of the
+// matrix. Therefore the result of an operation is bit-identical for any number of threads and
+// for all parallelization backends, including a serial execution.
+//
+// The reproducibility is guaranteed for a fixed executable on a fixed instruction set. In order
+// to also guarantee bit-identical results across different machines, the runtime dispatch of
+// the SIMD kernels (see \c BLAZE_USE_CPU_DISPATCH) has to be deactivated. Also, the code must
+// not be compiled with flags that allow a reassociation or contraction of floating point
+// operations (as for instance \c -ffast-math or \c -ffp-contract=fast).
+//
+// The reproducible mode comes at a small cost: reductions are always evaluated blockwise, and
+// dense matrix/dense vector multiplications do not use the kernel for large matrices and are
+// not computed by means of BLAS functions.
+//
+// Possible settings for the reproducible reductions:
+//  - Deactivated: \b 0 (default)
+//  - Activated  : \b 1
+//
+// \note It is possible to (de-)activate the reproducible reductions via command line or by
+// defining this symbol manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_USE_REPRODUCIBLE_REDUCTIONS 1
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_USE_REPRODUCIBLE_REDUCTIONS
+#define BLAZE_USE_REPRODUCIBLE_REDUCTIONS 0
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Number of elements per block of a reproducible reduction.
+// \ingroup config
+//
+// In case the reproducible reductions are activated (see \c BLAZE_USE_REPRODUCIBLE_REDUCTIONS),
+// every dense vector reduction is split into blocks of \c BLAZE_REPRODUCIBLE_REDUCTION_BLOCK_SIZE
+// elements. Dense matrix reductions are split into blocks of complete rows (row-major matrices)
+// or columns (column-major matrices) of approximately the same number of elements. The block
+// size must be a positive multiple of 64. The default value is 8192.
+//
+// \note It is possible to specify the block size via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_REPRODUCIBLE_REDUCTION_BLOCK_SIZE 16384
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_REPRODUCIBLE_REDUCTION_BLOCK_SIZE
+#define BLAZE_REPRODUCIBLE_REDUCTION_BLOCK_SIZE 8192
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the compensated summation of partial results.
+// \ingroup config
+//
+// This compilation switch enables/disables the compensated (Kahan-Babuska/Neumaier) summation
+// of the partial results of blockwise or parallel evaluated sums, inner products and norms of
+// built-in floating point type. This reduces the rounding error introduced by the combination
+// of the partial results at the cost of three additional floating point operations per block.
+// The summation within a single block is not affected.
+//
+// Possible settings for the compensated summation:
+//  - Deactivated: \b 0 (default)
+//  - Activated  : \b 1
+//
+// \note It is possible to (de-)activate the compensated summation via command line or by
+// defining this symbol manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_USE_COMPENSATED_SUMMATION 1
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_USE_COMPENSATED_SUMMATION
+#define BLAZE_USE_COMPENSATED_SUMMATION 0
+#endif
+//*************************************************************************************************
@@ -1968,6 +1968,39 @@
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief SMP sparse matrix assignment threshold.
+// \ingroup config
+//
+// This threshold specifies when an assignment with a simple sparse matrix can be executed in
+// parallel. In case the number of non-zero elements of the sparse matrix is larger or equal to
+// this threshold, the operation is executed in parallel. If the number of non-zero elements is
+// below this threshold the operation is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs. Also note that the provided default has been
+// determined using the C++11 thread parallelization and requires individual adaption for the
+// OpenMP parallelization or the HPX-based parallelization.
+//
+// The default setting for this threshold is 40000. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_SMP_SMATASSIGN_THRESHOLD 40000UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_SMATASSIGN_THRESHOLD
+#define BLAZE_SMP_SMATASSIGN_THRESHOLD 40000UL
+#endif
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief SMP dense matrix reduction threshold.
 // \ingroup config
@@ -2032,3 +2065,178 @@
 #define BLAZE_SMP_SMATREDUCE_THRESHOLD 180UL
 #endif
 //*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP dense vector/dense vector inner product threshold.
+// \ingroup config
+//
+// This threshold specifies when the inner product of two dense vectors can be executed in parallel. In case
+// the number of elements of the vectors is larger or equal to this threshold, the operation is executed in
+// parallel. If the number of elements is below this threshold the operation is executed
+// single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs. Also note that the provided default has been
+// determined using the OpenMP parallelization and requires individual adaption for the C++11
+// and Boost thread parallelization or the HPX-based parallelization.
+//
+// The default setting for this threshold is 38000. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_SMP_DVECDVECINNER_THRESHOLD 38000UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_DVECDVECINNER_THRESHOLD
+#define BLAZE_SMP_DVECDVECINNER_THRESHOLD 38000UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP dense vector reduction threshold.
+// \ingroup config
+//
+// This threshold specifies when a total reduction or a norm of a dense vector can be executed in parallel. In case
+// the number of elements of the vector is larger or equal to this threshold, the operation is executed in
+// parallel. If the number of elements is below this threshold the operation is executed
+// single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs. Also note that the provided default has been
+// determined using the OpenMP parallelization and requires individual adaption for the C++11
+// and Boost thread parallelization or the HPX-based parallelization.
+//
+// The default setting for this threshold is 38000. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_SMP_DVECREDUCE_THRESHOLD 38000UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_DVECREDUCE_THRESHOLD
+#define BLAZE_SMP_DVECREDUCE_THRESHOLD 38000UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP dense matrix total reduction threshold.
+// \ingroup config
+//
+// This threshold specifies when a total reduction or a norm of a dense matrix can be executed in parallel. In case
+// the number of elements of the matrix is larger or equal to this threshold, the operation is executed in
+// parallel. If the number of elements is below this threshold the operation is executed
+// single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs. Also note that the provided default has been
+// determined using the OpenMP parallelization and requires individual adaption for the C++11
+// and Boost thread parallelization or the HPX-based parallelization.
+//
+// The default setting for this threshold is 38000. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_SMP_DMATTOTALREDUCE_THRESHOLD 38000UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_DMATTOTALREDUCE_THRESHOLD
+#define BLAZE_SMP_DMATTOTALREDUCE_THRESHOLD 38000UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP batched matrix operation threshold.
+// \ingroup config
+//
+// This threshold specifies when a batched operation on a BatchedMatrix (i.e. a batched matrix
+// multiplication, LU decomposition, substitution, inversion or solver) can be executed in
+// parallel. In case the number of matrices of the batch is larger or equal to this threshold,
+// the operation is executed in parallel. If the number of matrices is below this threshold the
+// operation is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs. Also note that the provided default has been
+// determined using the OpenMP parallelization and requires individual adaption for the C++11
+// and Boost thread parallelization or the HPX-based parallelization.
+//
+// The default setting for this threshold is 1024. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_SMP_BATCHEDMATRIX_THRESHOLD 1024UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_BATCHEDMATRIX_THRESHOLD
+#define BLAZE_SMP_BATCHEDMATRIX_THRESHOLD 1024UL
+#endif
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  RUNTIME THRESHOLDS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Compilation switch for runtime-tunable thresholds.
+// \ingroup config
+//
+// This compilation switch enables the runtime tuning of all BLAS, kernel and SMP thresholds.
+// In case the switch is set to 0 (the default), all thresholds are compile time constants and
+// can only be adapted via the settings in this file. In case the switch is set to 1, the values
+// specified in this file merely serve as defaults for a tuning table, which can be modified at
+// runtime via the setThreshold() and loadThresholds() functions. Additionally, if the
+// \c BLAZE_THRESHOLDS environment variable names a tuning table file, this file is loaded at
+// program startup. Tuning tables can for instance be generated by the \c autotune executable
+// of the Blazemark, which measures the crossovers on the host system.
+//
+// Possible settings for the runtime threshold switch:
+//  - Deactivated: \b 0 (default)
+//  - Activated  : \b 1
+//
+// \note Runtime-tunable thresholds prevent the compiler from folding the threshold checks and
+// therefore cause a small runtime overhead for every operation.
+//
+// \note It is possible to (de-)activate runtime-tunable thresholds via command line or by
+// defining this symbol manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_USE_RUNTIME_THRESHOLDS 1
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_USE_RUNTIME_THRESHOLDS
+#define BLAZE_USE_RUNTIME_THRESHOLDS 0
+#endif
+//*************************************************************************************************
@@ -62,3 +62,67 @@
 #define BLAZE_USE_VECTORIZATION 1
 #endif
 //*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the runtime dispatch of the performance critical kernels.
+// \ingroup config
+//
+// This compilation switch enables/disables the runtime CPU dispatch of several performance
+// critical kernels (the dense matrix/dense matrix multiplication, the dense matrix/dense vector
+// multiplication, the dense vector inner product, and the dense vector summation). In case the
+// switch is set to 1, these kernels are additionally compiled for AVX, AVX2/FMA, and AVX-512
+// and the best variant supported by the executing CPU is selected at runtime. This allows to
+// build a single executable for a baseline instruction set (as for instance SSE2 or AVX2) that
+// nevertheless exploits the full SIMD width of newer processors. In case the switch is set to
+// 0, only the instruction set selected at compile time is used. Note that the runtime dispatch
+// is only available for the GNU and Clang compilers on x86 platforms.
+//
+// Possible settings for the CPU dispatch switch:
+//  - Deactivated: \b 0 (default)
+//  - Activated  : \b 1
+//
+// \note It is possible to (de-)activate the CPU dispatch via command line or by defining this
+// symbol manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_USE_CPU_DISPATCH 1
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_USE_CPU_DISPATCH
+#define BLAZE_USE_CPU_DISPATCH 0
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the built-in SIMD implementations of transcendental functions.
+// \ingroup config
+//
+// This compilation switch enables/disables the built-in SIMD implementations of the \c exp(),
+// \c log(), \c sin(), \c cos(), and \c tanh() functions, which are used for SSE2, AVX, and
+// AVX-512 in case the SVML is not available. In case the switch is set to 1, the according
+// operations on dense vectors and matrices are vectorized. In case the switch is set to 0, these
+// operations are only vectorized via the SVML. Note that the built-in implementations are not
+// bitwise identical to the scalar functions of the standard library: The results of \c exp(),
+// \c log(), \c sin(), and \c cos() differ by up to 1 ULP (double precision: 2 ULP), the results
+// of \c tanh() by up to 2 ULP. Therefore activating the switch may change the results of existing
+// computations in the last bits.
+//
+// Possible settings for the built-in SIMD math switch:
+//  - Deactivated: \b 0 (default)
+//  - Activated  : \b 1
+//
+// \note It is possible to (de-)activate the built-in SIMD math via command line or by defining
+// this symbol manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_USE_BUILTIN_SIMD_MATH 1
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_USE_BUILTIN_SIMD_MATH
+#define BLAZE_USE_BUILTIN_SIMD_MATH 0
+#endif
+//*************************************************************************************************
@@ -40,6 +40,7 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/math/dense/CustomVector.h>
 #include <blaze/math/dense/DynamicVector.h>
 #include <blaze/math/dense/StaticVector.h>
 #include <blaze/math/DenseVector.h>
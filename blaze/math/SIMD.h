@@ -43,6 +43,7 @@
 #include <blaze/math/simd/BasicTypes.h>
 #include <blaze/math/simd/DerivedTypes.h>
 #include <blaze/math/simd/Functions.h>
+#include <blaze/math/simd/SIMDLevel.h>
 #include <blaze/math/simd/SIMDTrait.h>
 
 #endif
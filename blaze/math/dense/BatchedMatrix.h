@@ -0,0 +1,1729 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/BatchedMatrix.h
+//  \brief Header file for the implementation of a batch of fixed-size matrices
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_BATCHEDMATRIX_H_
+#define _BLAZE_MATH_DENSE_BATCHEDMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/dense/StaticMatrix.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/functors/Add.h>
+#include <blaze/math/shims/Abs.h>
+#include <blaze/math/shims/Invert.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/smp/Reduction.h>
+#include <blaze/math/typetraits/HasSIMDAdd.h>
+#include <blaze/math/typetraits/HasSIMDMult.h>
+#include <blaze/math/typetraits/HasSIMDSub.h>
+#include <blaze/system/StorageOrder.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/AlignedAllocator.h>
+#include <blaze/util/AlignedArray.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/NumericCast.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsVectorizable.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary variable template for the selection of the vectorized batched kernels.
+// \ingroup batched_matrix
+//
+// This variable template evaluates to \a true in case the batched kernels for the given data
+// type can be vectorized, i.e. in case the data type is vectorizable and SIMD additions,
+// subtractions and multiplications are available for it.
+*/
+template< typename Type >  // Data type of the matrices
+constexpr bool useBatchedVectorization_v =
+   ( IsVectorizable_v<Type> &&
+     HasSIMDAdd_v<Type,Type> && HasSIMDSub_v<Type,Type> && HasSIMDMult_v<Type,Type> );
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\defgroup batched_matrix BatchedMatrix
+// \ingroup dense_matrix
+*/
+/*!\brief Efficient implementation of a batch of fixed-size \f$ M \times N \f$ matrices.
+// \ingroup batched_matrix
+//
+// The BatchedMatrix class template represents an arbitrarily large batch of small, fixed-size
+// matrices, which are all processed by the same operation. The type of the elements and the
+// number of rows and columns of the matrices are specified via the three template parameters:
+
+   \code
+   template< typename Type, size_t M, size_t N >
+   class BatchedMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. BatchedMatrix can be used with any
+//          non-cv-qualified, non-reference, non-pointer element type.
+//  - M   : specifies the number of rows of each matrix of the batch.
+//  - N   : specifies the number of columns of each matrix of the batch.
+//
+// In contrast to an array of StaticMatrix instances, the BatchedMatrix interleaves the matrices
+// of the batch across the lanes of a SIMD vector: The batch is split into groups of \a SIMDSIZE
+// consecutive matrices, where \a SIMDSIZE is the number of elements in a SIMD vector of the
+// element type, and within a group the same element of all matrices is stored contiguously.
+// Therefore element \f$ (i,j) \f$ of the matrix \a b is located at position
+
+         \f[ (b / SIMDSIZE) \cdot M \cdot N \cdot SIMDSIZE + (i \cdot N + j) \cdot SIMDSIZE + b \% SIMDSIZE \f]
+
+// of the underlying array. This layout enables the batched operations (see gemm(), getrf(),
+// getrs(), invert() and solve()) to process \a SIMDSIZE matrices at once in the SIMD lanes, which
+// is considerably more efficient than processing a single \f$ 3 \times 3 \f$ or \f$ 16 \times 16
+// \f$ matrix at a time. Additionally, in case the batch contains at least
+// \c BLAZE_SMP_BATCHEDMATRIX_THRESHOLD matrices, the groups are distributed among the threads of
+// the active shared memory parallelization. In case the size of the batch is not a multiple of
+// \a SIMDSIZE, the last group is padded with zero matrices, which are never accessible by means
+// of the public interface.
+//
+// The matrices of the batch can be accessed individually either element by element or as a
+// whole by means of a StaticMatrix:
+
+   \code
+   using blaze::BatchedMatrix;
+   using blaze::StaticMatrix;
+
+   BatchedMatrix<double,3UL,3UL> A( 100000UL ), B( 100000UL ), C;
+
+   // Initialization of the matrices of the batch
+   for( size_t b=0UL; b<A.size(); ++b ) {
+      A(b,0,0) = 2.0;                                     // Access to a single element
+      B.set( b, StaticMatrix<double,3UL,3UL>{ ... } );   // Setting a complete matrix
+   }
+
+   gemm( C, A, B );  // Batched matrix multiplication C[b] = A[b] * B[b]
+   invert( A );      // Batched in-place inversion of all matrices of A
+
+   const StaticMatrix<double,3UL,3UL> C1( C.get( 1UL ) );  // Extracting a single matrix
+   \endcode
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+class BatchedMatrix
+{
+ public:
+   //**Type definitions****************************************************************************
+   using This           = BatchedMatrix<Type,M,N>;              //!< Type of this BatchedMatrix instance.
+   using MatrixType     = StaticMatrix<Type,M,N,rowMajor>;      //!< Type of a single matrix of the batch.
+   using ElementType    = Type;                                 //!< Type of the matrix elements.
+   using SIMDType       = SIMDTrait_t<ElementType>;             //!< SIMD type of the matrix elements.
+   using Reference      = Type&;                                //!< Reference to a non-constant matrix element.
+   using ConstReference = const Type&;                          //!< Reference to a constant matrix element.
+   using Pointer        = Type*;                                //!< Pointer to a non-constant matrix element.
+   using ConstPointer   = const Type*;                          //!< Pointer to a constant matrix element.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! The number of matrices per group.
+   /*! The group size corresponds to the number of elements in a SIMD vector of the element type.
+       In case the element type cannot be vectorized, each group consists of a single matrix. */
+   static constexpr size_t SIMDSIZE = SIMDTrait<Type>::size;
+
+   //! The number of elements per group.
+   static constexpr size_t GROUPSIZE = M * N * SIMDSIZE;
+
+   //! Compilation flag for SIMD optimization.
+   /*! The \a simdEnabled compilation flag indicates whether the batched operations on the matrix
+       are vectorized. In case the flag is \a false, the matrices of a group are processed one
+       after another. */
+   static constexpr bool simdEnabled = useBatchedVectorization_v<Type>;
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline BatchedMatrix() noexcept;
+   explicit inline BatchedMatrix( size_t n );
+   inline BatchedMatrix( size_t n, const Type& init );
+
+   BatchedMatrix( const BatchedMatrix& ) = default;
+   BatchedMatrix( BatchedMatrix&& ) = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   ~BatchedMatrix() = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference      operator()( size_t b, size_t i, size_t j ) noexcept;
+   inline ConstReference operator()( size_t b, size_t i, size_t j ) const noexcept;
+   inline Reference      at( size_t b, size_t i, size_t j );
+   inline ConstReference at( size_t b, size_t i, size_t j ) const;
+   inline Pointer        data  () noexcept;
+   inline ConstPointer   data  () const noexcept;
+   inline Pointer        data  ( size_t g ) noexcept;
+   inline ConstPointer   data  ( size_t g ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   BatchedMatrix& operator=( const BatchedMatrix& ) = default;
+   BatchedMatrix& operator=( BatchedMatrix&& ) = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline constexpr size_t rows() noexcept;
+   static inline constexpr size_t columns() noexcept;
+
+   inline size_t     size() const noexcept;
+   inline size_t     groups() const noexcept;
+   inline MatrixType get( size_t b ) const;
+   inline void       reset();
+   inline void       clear();
+   inline void       resize( size_t n );
+   inline void       swap( BatchedMatrix& m ) noexcept;
+
+   template< typename MT, bool SO >
+   inline void set( size_t b, const DenseMatrix<MT,SO>& m );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   using Values = std::vector< Type, AlignedAllocator<Type> >;  //!< Type of the value array.
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t size_;  //!< The current number of matrices of the batch.
+   Values v_;     //!< The interleaved elements of all matrices of the batch.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for BatchedMatrix.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline BatchedMatrix<Type,M,N>::BatchedMatrix() noexcept
+   : size_( 0UL )  // The current number of matrices of the batch
+   , v_   ()       // The interleaved elements of all matrices of the batch
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a batch of \a n matrices.
+//
+// \param n The number of matrices of the batch.
+//
+// All elements of all matrices are default initialized.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline BatchedMatrix<Type,M,N>::BatchedMatrix( size_t n )
+   : size_( n )                                             // The current number of matrices of the batch
+   , v_   ( ( ( n + SIMDSIZE - 1UL ) / SIMDSIZE ) * GROUPSIZE )  // The interleaved elements of all matrices of the batch
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a homogeneous initialization of all elements of \a n matrices.
+//
+// \param n The number of matrices of the batch.
+// \param init The initial value of all elements of all matrices.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline BatchedMatrix<Type,M,N>::BatchedMatrix( size_t n, const Type& init )
+   : BatchedMatrix( n )
+{
+   for( size_t b=0UL; b<size_; ++b )
+      for( size_t i=0UL; i<M; ++i )
+         for( size_t j=0UL; j<N; ++j )
+            (*this)(b,i,j) = init;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 3D-access to the matrix elements.
+//
+// \param b Access index for the matrix. The index has to be in the range \f$[0..size-1]\f$.
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access indices.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline typename BatchedMatrix<Type,M,N>::Reference
+   BatchedMatrix<Type,M,N>::operator()( size_t b, size_t i, size_t j ) noexcept
+{
+   BLAZE_USER_ASSERT( b<size_, "Invalid batch access index"  );
+   BLAZE_USER_ASSERT( i<M    , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j<N    , "Invalid column access index" );
+   return v_[( b / SIMDSIZE )*GROUPSIZE + ( i*N + j )*SIMDSIZE + b % SIMDSIZE];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief 3D-access to the matrix elements.
+//
+// \param b Access index for the matrix. The index has to be in the range \f$[0..size-1]\f$.
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference-to-const to the accessed value.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access indices.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline typename BatchedMatrix<Type,M,N>::ConstReference
+   BatchedMatrix<Type,M,N>::operator()( size_t b, size_t i, size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( b<size_, "Invalid batch access index"  );
+   BLAZE_USER_ASSERT( i<M    , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j<N    , "Invalid column access index" );
+   return v_[( b / SIMDSIZE )*GROUPSIZE + ( i*N + j )*SIMDSIZE + b % SIMDSIZE];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the matrix elements.
+//
+// \param b Access index for the matrix. The index has to be in the range \f$[0..size-1]\f$.
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid matrix access index.
+//
+// In contrast to the function call operator this function always performs a check of the given
+// access indices.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline typename BatchedMatrix<Type,M,N>::Reference
+   BatchedMatrix<Type,M,N>::at( size_t b, size_t i, size_t j )
+{
+   if( b >= size_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid batch access index" );
+   }
+   if( i >= M ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= N ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(b,i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the matrix elements.
+//
+// \param b Access index for the matrix. The index has to be in the range \f$[0..size-1]\f$.
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference-to-const to the accessed value.
+// \exception std::out_of_range Invalid matrix access index.
+//
+// In contrast to the function call operator this function always performs a check of the given
+// access indices.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline typename BatchedMatrix<Type,M,N>::ConstReference
+   BatchedMatrix<Type,M,N>::at( size_t b, size_t i, size_t j ) const
+{
+   if( b >= size_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid batch access index" );
+   }
+   if( i >= M ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= N ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(b,i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the matrix elements.
+//
+// \return Pointer to the internal element storage.
+//
+// This function returns a pointer to the internal storage of the batch. The elements of the
+// matrices are interleaved in groups of \a SIMDSIZE matrices (see the class description).
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline typename BatchedMatrix<Type,M,N>::Pointer
+   BatchedMatrix<Type,M,N>::data() noexcept
+{
+   return v_.data();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the matrix elements.
+//
+// \return Pointer to the internal element storage.
+//
+// This function returns a pointer to the internal storage of the batch. The elements of the
+// matrices are interleaved in groups of \a SIMDSIZE matrices (see the class description).
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline typename BatchedMatrix<Type,M,N>::ConstPointer
+   BatchedMatrix<Type,M,N>::data() const noexcept
+{
+   return v_.data();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the elements of a specific group of matrices.
+//
+// \param g The group index.
+// \return Pointer to the internal element storage of the group.
+//
+// This function returns a pointer to the \a GROUPSIZE elements of the given group of matrices.
+// The pointer is aligned according to the requirements of the SIMD type of the element type.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline typename BatchedMatrix<Type,M,N>::Pointer
+   BatchedMatrix<Type,M,N>::data( size_t g ) noexcept
+{
+   BLAZE_USER_ASSERT( g < groups(), "Invalid group access index" );
+   return v_.data() + g*GROUPSIZE;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the elements of a specific group of matrices.
+//
+// \param g The group index.
+// \return Pointer to the internal element storage of the group.
+//
+// This function returns a pointer to the \a GROUPSIZE elements of the given group of matrices.
+// The pointer is aligned according to the requirements of the SIMD type of the element type.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline typename BatchedMatrix<Type,M,N>::ConstPointer
+   BatchedMatrix<Type,M,N>::data( size_t g ) const noexcept
+{
+   BLAZE_USER_ASSERT( g < groups(), "Invalid group access index" );
+   return v_.data() + g*GROUPSIZE;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows of each matrix of the batch.
+//
+// \return The number of rows of each matrix.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline constexpr size_t BatchedMatrix<Type,M,N>::rows() noexcept
+{
+   return M;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of columns of each matrix of the batch.
+//
+// \return The number of columns of each matrix.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline constexpr size_t BatchedMatrix<Type,M,N>::columns() noexcept
+{
+   return N;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of matrices of the batch.
+//
+// \return The number of matrices of the batch.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline size_t BatchedMatrix<Type,M,N>::size() const noexcept
+{
+   return size_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of groups of matrices.
+//
+// \return The number of groups of \a SIMDSIZE matrices.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline size_t BatchedMatrix<Type,M,N>::groups() const noexcept
+{
+   return v_.size() / GROUPSIZE;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns a copy of the given matrix of the batch.
+//
+// \param b Index of the matrix. The index has to be in the range \f$[0..size-1]\f$.
+// \return A copy of the matrix.
+// \exception std::out_of_range Invalid batch access index.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline typename BatchedMatrix<Type,M,N>::MatrixType
+   BatchedMatrix<Type,M,N>::get( size_t b ) const
+{
+   if( b >= size_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid batch access index" );
+   }
+
+   MatrixType m;
+
+   for( size_t i=0UL; i<M; ++i )
+      for( size_t j=0UL; j<N; ++j )
+         m(i,j) = (*this)(b,i,j);
+
+   return m;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Sets the given matrix of the batch.
+//
+// \param b Index of the matrix. The index has to be in the range \f$[0..size-1]\f$.
+// \param m The new value of the matrix.
+// \return void
+// \exception std::out_of_range Invalid batch access index.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This function sets the matrix \a b of the batch to the given dense matrix, which can for
+// instance be a StaticMatrix, a HybridMatrix or a DynamicMatrix of size \f$ M \times N \f$.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+template< typename MT    // Type of the dense matrix
+        , bool SO >      // Storage order of the dense matrix
+inline void BatchedMatrix<Type,M,N>::set( size_t b, const DenseMatrix<MT,SO>& m )
+{
+   if( b >= size_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid batch access index" );
+   }
+
+   if( (~m).rows() != M || (~m).columns() != N ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   CompositeType_t<MT> tmp( ~m );
+
+   for( size_t i=0UL; i<M; ++i )
+      for( size_t j=0UL; j<N; ++j )
+         (*this)(b,i,j) = tmp(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+//
+// This function resets all elements of all matrices to their default initial values. The
+// size of the batch is not changed.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline void BatchedMatrix<Type,M,N>::reset()
+{
+   std::fill( v_.begin(), v_.end(), Type() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the batch.
+//
+// \return void
+//
+// After the clear() function, the size of the batch is 0.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline void BatchedMatrix<Type,M,N>::clear()
+{
+   size_ = 0UL;
+   v_.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changing the number of matrices of the batch.
+//
+// \param n The new number of matrices of the batch.
+// \return void
+//
+// This function changes the number of matrices of the batch. The values of the first
+// \f$ min(n,size) \f$ matrices are preserved, all new matrices are default initialized.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline void BatchedMatrix<Type,M,N>::resize( size_t n )
+{
+   if( n < size_ ) {
+      for( size_t b=n; b<size_ && b % SIMDSIZE != 0UL; ++b )
+         for( size_t i=0UL; i<M; ++i )
+            for( size_t j=0UL; j<N; ++j )
+               (*this)(b,i,j) = Type();
+   }
+
+   v_.resize( ( ( n + SIMDSIZE - 1UL ) / SIMDSIZE ) * GROUPSIZE );
+   size_ = n;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two batches.
+//
+// \param m The batch to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline void BatchedMatrix<Type,M,N>::swap( BatchedMatrix& m ) noexcept
+{
+   using std::swap;
+
+   swap( size_, m.size_ );
+   swap( v_, m.v_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BATCHED KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the index of the pivot row for the given column of a single matrix of a group.
+// \ingroup batched_matrix
+//
+// \param A Pointer to the first element of a group of \f$ N \times N \f$ matrices.
+// \param k The index of the column.
+// \param l The index of the matrix within the group.
+// \return The index of the element with the largest absolute value in the rows \f$[k..N-1]\f$.
+*/
+template< size_t N         // Number of rows and columns
+        , typename Type >  // Data type of the matrices
+inline size_t batchedPivot( const Type* A, size_t k, size_t l )
+{
+   constexpr size_t SIMDSIZE( SIMDTrait<Type>::size );
+
+   size_t p( k );
+   auto max( abs( A[(k*N+k)*SIMDSIZE+l] ) );
+
+   for( size_t i=k+1UL; i<N; ++i ) {
+      const auto tmp( abs( A[(i*N+k)*SIMDSIZE+l] ) );
+      if( tmp > max ) {
+         p   = i;
+         max = tmp;
+      }
+   }
+
+   return p;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Swaps two rows of a single matrix of a group.
+// \ingroup batched_matrix
+//
+// \param A Pointer to the first element of a group of matrices with \a N columns.
+// \param i The index of the first row.
+// \param p The index of the second row.
+// \param l The index of the matrix within the group.
+// \return void
+*/
+template< size_t N         // Number of columns
+        , typename Type >  // Data type of the matrices
+inline void batchedSwapRows( Type* A, size_t i, size_t p, size_t l )
+{
+   using std::swap;
+
+   constexpr size_t SIMDSIZE( SIMDTrait<Type>::size );
+
+   if( i == p ) return;
+
+   for( size_t j=0UL; j<N; ++j ) {
+      swap( A[(i*N+j)*SIMDSIZE+l], A[(p*N+j)*SIMDSIZE+l] );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default kernel for the multiplication of a group of matrices.
+// \ingroup batched_matrix
+//
+// \param C Pointer to the first element of the group of \f$ M \times N \f$ target matrices.
+// \param A Pointer to the first element of the group of \f$ M \times K \f$ left-hand side matrices.
+// \param B Pointer to the first element of the group of \f$ K \times N \f$ right-hand side matrices.
+// \param alpha The scaling factor for the products.
+// \param beta The scaling factor for the target matrices.
+// \return void
+//
+// This function computes \f$ C[l] = \alpha A[l] B[l] + \beta C[l] \f$ for all matrices of a
+// group one after another. In case \a beta is 0, the target matrices are not read.
+*/
+template< size_t M         // Number of rows of the target matrices
+        , size_t N         // Number of columns of the target matrices
+        , size_t K         // Number of columns of the left-hand side matrices
+        , typename Type >  // Data type of the matrices
+inline DisableIf_t< useBatchedVectorization_v<Type> >
+   batchedGemm( Type* C, const Type* A, const Type* B, const Type& alpha, const Type& beta )
+{
+   constexpr size_t SIMDSIZE( SIMDTrait<Type>::size );
+
+   const bool overwrite( isDefault( beta ) );
+
+   for( size_t l=0UL; l<SIMDSIZE; ++l ) {
+      for( size_t i=0UL; i<M; ++i ) {
+         for( size_t j=0UL; j<N; ++j )
+         {
+            Type tmp{};
+
+            for( size_t k=0UL; k<K; ++k ) {
+               tmp += A[(i*K+k)*SIMDSIZE+l] * B[(k*N+j)*SIMDSIZE+l];
+            }
+
+            Type& c( C[(i*N+j)*SIMDSIZE+l] );
+            c = ( overwrite )?( alpha * tmp ):( alpha * tmp + beta * c );
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized kernel for the multiplication of a group of matrices.
+// \ingroup batched_matrix
+//
+// \param C Pointer to the first element of the group of \f$ M \times N \f$ target matrices.
+// \param A Pointer to the first element of the group of \f$ M \times K \f$ left-hand side matrices.
+// \param B Pointer to the first element of the group of \f$ K \times N \f$ right-hand side matrices.
+// \param alpha The scaling factor for the products.
+// \param beta The scaling factor for the target matrices.
+// \return void
+//
+// This function computes \f$ C[l] = \alpha A[l] B[l] + \beta C[l] \f$ for all matrices of a
+// group at once, where each SIMD lane corresponds to a single matrix of the group. In case
+// \a beta is 0, the target matrices are not read.
+*/
+template< size_t M         // Number of rows of the target matrices
+        , size_t N         // Number of columns of the target matrices
+        , size_t K         // Number of columns of the left-hand side matrices
+        , typename Type >  // Data type of the matrices
+inline EnableIf_t< useBatchedVectorization_v<Type> >
+   batchedGemm( Type* C, const Type* A, const Type* B, const Type& alpha, const Type& beta )
+{
+   using SIMDType = SIMDTrait_t<Type>;
+
+   constexpr size_t SIMDSIZE( SIMDTrait<Type>::size );
+
+   const bool overwrite( isDefault( beta ) );
+   const SIMDType factor1( set( alpha ) );
+   const SIMDType factor2( set( beta ) );
+
+   const auto store = [&]( Type* c, const SIMDType& xmm ) {
+      if( overwrite )
+         storea( c, xmm * factor1 );
+      else
+         storea( c, xmm * factor1 + loada( c ) * factor2 );
+   };
+
+   size_t i( 0UL );
+
+   for( ; (i+2UL) <= M; i+=2UL )
+   {
+      size_t j( 0UL );
+
+      for( ; (j+4UL) <= N; j+=4UL )
+      {
+         SIMDType xmm1, xmm2, xmm3, xmm4, xmm5, xmm6, xmm7, xmm8;
+
+         for( size_t k=0UL; k<K; ++k ) {
+            const SIMDType a1( loada( A+( i     *K+k)*SIMDSIZE ) );
+            const SIMDType a2( loada( A+((i+1UL)*K+k)*SIMDSIZE ) );
+            const Type* const b( B+(k*N+j)*SIMDSIZE );
+            const SIMDType b1( loada( b              ) );
+            const SIMDType b2( loada( b+SIMDSIZE     ) );
+            const SIMDType b3( loada( b+SIMDSIZE*2UL ) );
+            const SIMDType b4( loada( b+SIMDSIZE*3UL ) );
+            xmm1 += a1 * b1;
+            xmm2 += a1 * b2;
+            xmm3 += a1 * b3;
+            xmm4 += a1 * b4;
+            xmm5 += a2 * b1;
+            xmm6 += a2 * b2;
+            xmm7 += a2 * b3;
+            xmm8 += a2 * b4;
+         }
+
+         Type* const c1( C+( i     *N+j)*SIMDSIZE );
+         Type* const c2( C+((i+1UL)*N+j)*SIMDSIZE );
+         store( c1             , xmm1 );
+         store( c1+SIMDSIZE    , xmm2 );
+         store( c1+SIMDSIZE*2UL, xmm3 );
+         store( c1+SIMDSIZE*3UL, xmm4 );
+         store( c2             , xmm5 );
+         store( c2+SIMDSIZE    , xmm6 );
+         store( c2+SIMDSIZE*2UL, xmm7 );
+         store( c2+SIMDSIZE*3UL, xmm8 );
+      }
+
+      for( ; j<N; ++j )
+      {
+         SIMDType xmm1, xmm2;
+
+         for( size_t k=0UL; k<K; ++k ) {
+            const SIMDType b1( loada( B+(k*N+j)*SIMDSIZE ) );
+            xmm1 += loada( A+( i     *K+k)*SIMDSIZE ) * b1;
+            xmm2 += loada( A+((i+1UL)*K+k)*SIMDSIZE ) * b1;
+         }
+
+         store( C+( i     *N+j)*SIMDSIZE, xmm1 );
+         store( C+((i+1UL)*N+j)*SIMDSIZE, xmm2 );
+      }
+   }
+
+   for( ; i<M; ++i )
+   {
+      size_t j( 0UL );
+
+      for( ; (j+4UL) <= N; j+=4UL )
+      {
+         SIMDType xmm1, xmm2, xmm3, xmm4;
+
+         for( size_t k=0UL; k<K; ++k ) {
+            const SIMDType a1( loada( A+(i*K+k)*SIMDSIZE ) );
+            const Type* const b( B+(k*N+j)*SIMDSIZE );
+            xmm1 += a1 * loada( b              );
+            xmm2 += a1 * loada( b+SIMDSIZE     );
+            xmm3 += a1 * loada( b+SIMDSIZE*2UL );
+            xmm4 += a1 * loada( b+SIMDSIZE*3UL );
+         }
+
+         Type* const c( C+(i*N+j)*SIMDSIZE );
+         store( c             , xmm1 );
+         store( c+SIMDSIZE    , xmm2 );
+         store( c+SIMDSIZE*2UL, xmm3 );
+         store( c+SIMDSIZE*3UL, xmm4 );
+      }
+
+      for( ; j<N; ++j )
+      {
+         SIMDType xmm1;
+
+         for( size_t k=0UL; k<K; ++k ) {
+            xmm1 += loada( A+(i*K+k)*SIMDSIZE ) * loada( B+(k*N+j)*SIMDSIZE );
+         }
+
+         store( C+(i*N+j)*SIMDSIZE, xmm1 );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default kernel for the LU decomposition of a group of matrices.
+// \ingroup batched_matrix
+//
+// \param A Pointer to the first element of the group of \f$ N \times N \f$ matrices.
+// \param ipiv Pointer to the pivot indices of the first matrix of the group.
+// \param lanes The number of valid matrices in the group.
+// \return The number of valid matrices of the group that are singular.
+//
+// This function decomposes all matrices of a group one after another (see getrf()). The
+// pivot indices of the matrix \a l are stored in \f$ ipiv[l \cdot N..l \cdot N+N-1] \f$.
+*/
+template< size_t N         // Number of rows and columns
+        , typename Type >  // Data type of the matrices
+DisableIf_t< useBatchedVectorization_v<Type>, size_t >
+   batchedGetrf( Type* A, int* ipiv, size_t lanes )
+{
+   constexpr size_t SIMDSIZE( SIMDTrait<Type>::size );
+
+   size_t singular( 0UL );
+
+   for( size_t l=0UL; l<SIMDSIZE; ++l )
+   {
+      bool failed( false );
+
+      for( size_t k=0UL; k<N; ++k )
+      {
+         const size_t p( batchedPivot<N>( A, k, l ) );
+         batchedSwapRows<N>( A, k, p, l );
+
+         if( l < lanes ) {
+            ipiv[l*N+k] = numeric_cast<int>( p+1UL );
+         }
+
+         const Type& pivot( A[(k*N+k)*SIMDSIZE+l] );
+
+         if( isDefault( pivot ) ) {
+            failed = true;
+            continue;
+         }
+
+         const Type scale( inv( pivot ) );
+
+         for( size_t i=k+1UL; i<N; ++i )
+         {
+            Type& factor( A[(i*N+k)*SIMDSIZE+l] );
+            factor *= scale;
+
+            for( size_t j=k+1UL; j<N; ++j ) {
+               A[(i*N+j)*SIMDSIZE+l] -= factor * A[(k*N+j)*SIMDSIZE+l];
+            }
+         }
+      }
+
+      if( failed && l < lanes ) {
+         ++singular;
+      }
+   }
+
+   return singular;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized kernel for the LU decomposition of a group of matrices.
+// \ingroup batched_matrix
+//
+// \param A Pointer to the first element of the group of \f$ N \times N \f$ matrices.
+// \param ipiv Pointer to the pivot indices of the first matrix of the group.
+// \param lanes The number of valid matrices in the group.
+// \return The number of valid matrices of the group that are singular.
+//
+// This function decomposes all matrices of a group at once (see getrf()). The search for the
+// pivot elements and the row interchanges are performed separately for each matrix, whereas
+// the elimination steps process all matrices of the group in the SIMD lanes. The pivot indices
+// of the matrix \a l are stored in \f$ ipiv[l \cdot N..l \cdot N+N-1] \f$.
+*/
+template< size_t N         // Number of rows and columns
+        , typename Type >  // Data type of the matrices
+EnableIf_t< useBatchedVectorization_v<Type>, size_t >
+   batchedGetrf( Type* A, int* ipiv, size_t lanes )
+{
+   using SIMDType = SIMDTrait_t<Type>;
+
+   constexpr size_t SIMDSIZE( SIMDTrait<Type>::size );
+
+   AlignedArray<Type,SIMDSIZE> scale;
+   bool failed[SIMDSIZE] = {};
+
+   for( size_t k=0UL; k<N; ++k )
+   {
+      for( size_t l=0UL; l<SIMDSIZE; ++l )
+      {
+         const size_t p( batchedPivot<N>( A, k, l ) );
+         batchedSwapRows<N>( A, k, p, l );
+
+         if( l < lanes ) {
+            ipiv[l*N+k] = numeric_cast<int>( p+1UL );
+         }
+
+         const Type& pivot( A[(k*N+k)*SIMDSIZE+l] );
+
+         if( isDefault( pivot ) ) {
+            failed[l] = true;
+            scale[l]  = Type();
+         }
+         else {
+            scale[l] = inv( pivot );
+         }
+      }
+
+      const SIMDType factor( loada( scale.data() ) );
+
+      for( size_t i=k+1UL; i<N; ++i )
+      {
+         Type* const a( A+(i*N+k)*SIMDSIZE );
+         const SIMDType xmm1( loada( a ) * factor );
+         storea( a, xmm1 );
+
+         for( size_t j=k+1UL; j<N; ++j ) {
+            Type* const c( A+(i*N+j)*SIMDSIZE );
+            storea( c, loada( c ) - xmm1 * loada( A+(k*N+j)*SIMDSIZE ) );
+         }
+      }
+   }
+
+   size_t singular( 0UL );
+
+   for( size_t l=0UL; l<lanes; ++l ) {
+      if( failed[l] ) ++singular;
+   }
+
+   return singular;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default kernel for the substitution step of a group of LU decomposed systems.
+// \ingroup batched_matrix
+//
+// \param A Pointer to the first element of the group of decomposed \f$ N \times N \f$ matrices.
+// \param B Pointer to the first element of the group of \f$ N \times R \f$ right-hand sides.
+// \param ipiv Pointer to the pivot indices of the first matrix of the group.
+// \param lanes The number of valid matrices in the group.
+// \return void
+*/
+template< size_t N         // Number of rows and columns of the system matrices
+        , size_t R         // Number of right-hand sides
+        , typename Type >  // Data type of the matrices
+DisableIf_t< useBatchedVectorization_v<Type> >
+   batchedGetrs( const Type* A, Type* B, const int* ipiv, size_t lanes )
+{
+   constexpr size_t SIMDSIZE( SIMDTrait<Type>::size );
+
+   for( size_t l=0UL; l<lanes; ++l )
+   {
+      for( size_t k=0UL; k<N; ++k ) {
+         batchedSwapRows<R>( B, k, numeric_cast<size_t>( ipiv[l*N+k]-1 ), l );
+      }
+
+      for( size_t k=0UL; k<N; ++k ) {
+         for( size_t i=k+1UL; i<N; ++i ) {
+            const Type factor( A[(i*N+k)*SIMDSIZE+l] );
+            for( size_t j=0UL; j<R; ++j ) {
+               B[(i*R+j)*SIMDSIZE+l] -= factor * B[(k*R+j)*SIMDSIZE+l];
+            }
+         }
+      }
+
+      for( size_t k=N; k-- > 0UL; )
+      {
+         const Type& pivot( A[(k*N+k)*SIMDSIZE+l] );
+         const Type scale( isDefault( pivot ) ? Type() : inv( pivot ) );
+
+         for( size_t j=0UL; j<R; ++j ) {
+            B[(k*R+j)*SIMDSIZE+l] *= scale;
+         }
+
+         for( size_t i=0UL; i<k; ++i ) {
+            const Type factor( A[(i*N+k)*SIMDSIZE+l] );
+            for( size_t j=0UL; j<R; ++j ) {
+               B[(i*R+j)*SIMDSIZE+l] -= factor * B[(k*R+j)*SIMDSIZE+l];
+            }
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized kernel for the substitution step of a group of LU decomposed systems.
+// \ingroup batched_matrix
+//
+// \param A Pointer to the first element of the group of decomposed \f$ N \times N \f$ matrices.
+// \param B Pointer to the first element of the group of \f$ N \times R \f$ right-hand sides.
+// \param ipiv Pointer to the pivot indices of the first matrix of the group.
+// \param lanes The number of valid matrices in the group.
+// \return void
+*/
+template< size_t N         // Number of rows and columns of the system matrices
+        , size_t R         // Number of right-hand sides
+        , typename Type >  // Data type of the matrices
+EnableIf_t< useBatchedVectorization_v<Type> >
+   batchedGetrs( const Type* A, Type* B, const int* ipiv, size_t lanes )
+{
+   using SIMDType = SIMDTrait_t<Type>;
+
+   constexpr size_t SIMDSIZE( SIMDTrait<Type>::size );
+
+   AlignedArray<Type,SIMDSIZE> scale;
+
+   for( size_t l=0UL; l<lanes; ++l ) {
+      for( size_t k=0UL; k<N; ++k ) {
+         batchedSwapRows<R>( B, k, numeric_cast<size_t>( ipiv[l*N+k]-1 ), l );
+      }
+   }
+
+   for( size_t k=0UL; k<N; ++k ) {
+      for( size_t i=k+1UL; i<N; ++i ) {
+         const SIMDType factor( loada( A+(i*N+k)*SIMDSIZE ) );
+         for( size_t j=0UL; j<R; ++j ) {
+            Type* const b( B+(i*R+j)*SIMDSIZE );
+            storea( b, loada( b ) - factor * loada( B+(k*R+j)*SIMDSIZE ) );
+         }
+      }
+   }
+
+   for( size_t k=N; k-- > 0UL; )
+   {
+      for( size_t l=0UL; l<SIMDSIZE; ++l ) {
+         const Type& pivot( A[(k*N+k)*SIMDSIZE+l] );
+         scale[l] = ( l < lanes && !isDefault( pivot ) )?( inv( pivot ) ):( Type() );
+      }
+
+      const SIMDType xmm1( loada( scale.data() ) );
+
+      for( size_t j=0UL; j<R; ++j ) {
+         Type* const b( B+(k*R+j)*SIMDSIZE );
+         storea( b, loada( b ) * xmm1 );
+      }
+
+      for( size_t i=0UL; i<k; ++i ) {
+         const SIMDType factor( loada( A+(i*N+k)*SIMDSIZE ) );
+         for( size_t j=0UL; j<R; ++j ) {
+            Type* const b( B+(i*R+j)*SIMDSIZE );
+            storea( b, loada( b ) - factor * loada( B+(k*R+j)*SIMDSIZE ) );
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default kernel for the in-place inversion of a group of matrices.
+// \ingroup batched_matrix
+//
+// \param A Pointer to the first element of the group of \f$ N \times N \f$ matrices.
+// \param lanes The number of valid matrices in the group.
+// \return The number of valid matrices of the group that are singular.
+//
+// This function inverts all matrices of a group one after another by means of a Gauss-Jordan
+// elimination with partial pivoting.
+*/
+template< size_t N         // Number of rows and columns
+        , typename Type >  // Data type of the matrices
+DisableIf_t< useBatchedVectorization_v<Type>, size_t >
+   batchedInvert( Type* A, size_t lanes )
+{
+   using std::swap;
+
+   constexpr size_t SIMDSIZE( SIMDTrait<Type>::size );
+
+   size_t singular( 0UL );
+   size_t piv[N];
+
+   for( size_t l=0UL; l<SIMDSIZE; ++l )
+   {
+      bool failed( false );
+
+      for( size_t k=0UL; k<N; ++k )
+      {
+         piv[k] = batchedPivot<N>( A, k, l );
+         batchedSwapRows<N>( A, k, piv[k], l );
+
+         Type& pivot( A[(k*N+k)*SIMDSIZE+l] );
+         const Type scale( isDefault( pivot ) ? Type() : inv( pivot ) );
+
+         failed = failed || isDefault( pivot );
+         pivot  = Type(1);
+
+         for( size_t j=0UL; j<N; ++j ) {
+            A[(k*N+j)*SIMDSIZE+l] *= scale;
+         }
+
+         for( size_t i=0UL; i<N; ++i )
+         {
+            if( i == k ) continue;
+
+            const Type factor( A[(i*N+k)*SIMDSIZE+l] );
+            A[(i*N+k)*SIMDSIZE+l] = Type();
+
+            for( size_t j=0UL; j<N; ++j ) {
+               A[(i*N+j)*SIMDSIZE+l] -= factor * A[(k*N+j)*SIMDSIZE+l];
+            }
+         }
+      }
+
+      for( size_t k=N; k-- > 0UL; ) {
+         if( piv[k] == k ) continue;
+         for( size_t i=0UL; i<N; ++i ) {
+            swap( A[(i*N+k)*SIMDSIZE+l], A[(i*N+piv[k])*SIMDSIZE+l] );
+         }
+      }
+
+      if( failed && l < lanes ) {
+         ++singular;
+      }
+   }
+
+   return singular;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized kernel for the in-place inversion of a group of matrices.
+// \ingroup batched_matrix
+//
+// \param A Pointer to the first element of the group of \f$ N \times N \f$ matrices.
+// \param lanes The number of valid matrices in the group.
+// \return The number of valid matrices of the group that are singular.
+//
+// This function inverts all matrices of a group at once by means of a Gauss-Jordan elimination
+// with partial pivoting. The search for the pivot elements and the row and column interchanges
+// are performed separately for each matrix, whereas the elimination steps process all matrices
+// of the group in the SIMD lanes.
+*/
+template< size_t N         // Number of rows and columns
+        , typename Type >  // Data type of the matrices
+EnableIf_t< useBatchedVectorization_v<Type>, size_t >
+   batchedInvert( Type* A, size_t lanes )
+{
+   using std::swap;
+   using SIMDType = SIMDTrait_t<Type>;
+
+   constexpr size_t SIMDSIZE( SIMDTrait<Type>::size );
+
+   AlignedArray<Type,SIMDSIZE> scale;
+   bool failed[SIMDSIZE] = {};
+   size_t piv[N*SIMDSIZE];
+
+   for( size_t k=0UL; k<N; ++k )
+   {
+      for( size_t l=0UL; l<SIMDSIZE; ++l )
+      {
+         const size_t p( batchedPivot<N>( A, k, l ) );
+         batchedSwapRows<N>( A, k, p, l );
+         piv[k*SIMDSIZE+l] = p;
+
+         Type& pivot( A[(k*N+k)*SIMDSIZE+l] );
+
+         if( isDefault( pivot ) ) {
+            failed[l] = true;
+            scale[l]  = Type();
+         }
+         else {
+            scale[l] = inv( pivot );
+         }
+
+         pivot = Type(1);
+      }
+
+      const SIMDType xmm1( loada( scale.data() ) );
+
+      for( size_t j=0UL; j<N; ++j ) {
+         Type* const a( A+(k*N+j)*SIMDSIZE );
+         storea( a, loada( a ) * xmm1 );
+      }
+
+      for( size_t i=0UL; i<N; ++i )
+      {
+         if( i == k ) continue;
+
+         Type* const a( A+(i*N+k)*SIMDSIZE );
+         const SIMDType factor( loada( a ) );
+         storea( a, SIMDType() );
+
+         for( size_t j=0UL; j<N; ++j ) {
+            Type* const c( A+(i*N+j)*SIMDSIZE );
+            storea( c, loada( c ) - factor * loada( A+(k*N+j)*SIMDSIZE ) );
+         }
+      }
+   }
+
+   for( size_t k=N; k-- > 0UL; ) {
+      for( size_t l=0UL; l<SIMDSIZE; ++l ) {
+         const size_t p( piv[k*SIMDSIZE+l] );
+         if( p == k ) continue;
+         for( size_t i=0UL; i<N; ++i ) {
+            swap( A[(i*N+k)*SIMDSIZE+l], A[(i*N+p)*SIMDSIZE+l] );
+         }
+      }
+   }
+
+   size_t singular( 0UL );
+
+   for( size_t l=0UL; l<lanes; ++l ) {
+      if( failed[l] ) ++singular;
+   }
+
+   return singular;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Applies the given kernel to all groups of a batch of the given size.
+// \ingroup batched_matrix
+//
+// \param size The number of matrices of the batch.
+// \param simdsize The number of matrices per group.
+// \param kernel The kernel, called with the index of a group and the number of valid matrices.
+// \return The sum of the results of all kernel calls.
+//
+// In case the batch contains at least \c BLAZE_SMP_BATCHEDMATRIX_THRESHOLD matrices, the
+// groups are distributed among the threads of the active shared memory parallelization.
+*/
+template< typename OP >  // Type of the kernel
+size_t batchedApply( size_t size, size_t simdsize, OP kernel )
+{
+   const size_t groups( ( size + simdsize - 1UL ) / simdsize );
+
+   if( groups == 0UL ) return 0UL;
+
+   return smpReduce<size_t>( groups, 1UL, canSMPReduce( size, SMP_BATCHEDMATRIX_THRESHOLD ),
+      [&]( size_t index, size_t n ) {
+         size_t result( 0UL );
+         for( size_t g=index; g<index+n; ++g ) {
+            result += kernel( g, min( simdsize, size - g*simdsize ) );
+         }
+         return result;
+      },
+      Add() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name BatchedMatrix operators */
+//@{
+template< typename Type, size_t M, size_t N >
+void swap( BatchedMatrix<Type,M,N>& a, BatchedMatrix<Type,M,N>& b ) noexcept;
+
+template< typename Type, size_t M, size_t N, size_t K >
+void gemm( BatchedMatrix<Type,M,N>& C, const BatchedMatrix<Type,M,K>& A,
+           const BatchedMatrix<Type,K,N>& B, const Type& alpha = Type(1), const Type& beta = Type() );
+
+template< typename Type, size_t N >
+void getrf( BatchedMatrix<Type,N,N>& A, int* ipiv );
+
+template< typename Type, size_t N, size_t R >
+void getrs( const BatchedMatrix<Type,N,N>& A, BatchedMatrix<Type,N,R>& B, const int* ipiv );
+
+template< typename Type, size_t N >
+void invert( BatchedMatrix<Type,N,N>& A );
+
+template< typename Type, size_t N, size_t R >
+void solve( const BatchedMatrix<Type,N,N>& A, BatchedMatrix<Type,N,R>& X,
+            const BatchedMatrix<Type,N,R>& B );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two batches.
+// \ingroup batched_matrix
+//
+// \param a The first batch to be swapped.
+// \param b The second batch to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline void swap( BatchedMatrix<Type,M,N>& a, BatchedMatrix<Type,M,N>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Batched multiplication of fixed-size matrices (\f$ C[b]=\alpha A[b] B[b]+\beta C[b] \f$).
+// \ingroup batched_matrix
+//
+// \param C The batch of target matrices.
+// \param A The batch of left-hand side matrices.
+// \param B The batch of right-hand side matrices.
+// \param alpha The scaling factor for the products (default: 1).
+// \param beta The scaling factor for the target matrices (default: 0).
+// \return void
+// \exception std::invalid_argument Batch sizes do not match.
+//
+// This function multiplies every matrix of \a A with the corresponding matrix of \a B. In case
+// \a beta is 0, \a C is resized to the size of \a A and its previous values are not used.
+// Otherwise \a C must have the same size as \a A and \a B. The target batch is allowed to be
+// identical to one of the operands.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows of the target matrices
+        , size_t N       // Number of columns of the target matrices
+        , size_t K >     // Number of columns of the left-hand side matrices
+void gemm( BatchedMatrix<Type,M,N>& C, const BatchedMatrix<Type,M,K>& A,
+           const BatchedMatrix<Type,K,N>& B, const Type& alpha, const Type& beta )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( A.size() != B.size() || ( !isDefault( beta ) && C.size() != A.size() ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Batch sizes do not match" );
+   }
+
+   if( static_cast<const void*>( &C ) == static_cast<const void*>( &A ) ||
+       static_cast<const void*>( &C ) == static_cast<const void*>( &B ) ) {
+      BatchedMatrix<Type,M,N> tmp( isDefault( beta ) ? BatchedMatrix<Type,M,N>() : C );
+      gemm( tmp, A, B, alpha, beta );
+      C.swap( tmp );
+      return;
+   }
+
+   C.resize( A.size() );
+
+   batchedApply( A.size(), BatchedMatrix<Type,M,N>::SIMDSIZE,
+      [&]( size_t g, size_t ) {
+         batchedGemm<M,N,K>( C.data(g), A.data(g), B.data(g), alpha, beta );
+         return 0UL;
+      } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Batched LU decomposition of fixed-size square matrices.
+// \ingroup batched_matrix
+//
+// \param A The batch of matrices to be decomposed.
+// \param ipiv Auxiliary array for the pivot indices; size >= \f$ A.size() \cdot N \f$.
+// \return void
+//
+// This function computes the LU decomposition \f$ P A[b] = L U \f$ of every matrix of the batch
+// by means of Gaussian elimination with partial row pivoting, where \a L is a lower unitriangular
+// and \a U an upper triangular matrix. On exit, the strictly lower part of \a A[b] contains the
+// factor \a L (the unit diagonal elements are not stored) and the upper part contains the factor
+// \a U. The 1-based pivot indices of matrix \a b are stored in \f$ ipiv[b \cdot N..b \cdot N+N-1]
+// \f$: Row \a k of the matrix was interchanged with row \f$ ipiv[b \cdot N+k]-1 \f$. In case a
+// matrix is singular, the decomposition is completed nonetheless, but the factor \a U has a zero
+// diagonal element and must not be used to solve a system of equations.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t N >     // Number of rows and columns
+void getrf( BatchedMatrix<Type,N,N>& A, int* ipiv )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( Type );
+
+   constexpr size_t SIMDSIZE( BatchedMatrix<Type,N,N>::SIMDSIZE );
+
+   batchedApply( A.size(), SIMDSIZE,
+      [&]( size_t g, size_t lanes ) {
+         return batchedGetrf<N>( A.data(g), ipiv+g*SIMDSIZE*N, lanes );
+      } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Batched substitution step for LU decomposed systems of equations.
+// \ingroup batched_matrix
+//
+// \param A The batch of system matrices that have already been decomposed by getrf().
+// \param B The batch of right-hand sides, which are overwritten by the solutions.
+// \param ipiv The pivot indices as computed by getrf().
+// \return void
+// \exception std::invalid_argument Batch sizes do not match.
+//
+// This function solves the systems of equations \f$ A[b] X[b] = B[b] \f$ by means of the LU
+// decompositions computed by getrf(). On exit, \a B contains the solutions.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t N       // Number of rows and columns of the system matrices
+        , size_t R >     // Number of right-hand sides
+void getrs( const BatchedMatrix<Type,N,N>& A, BatchedMatrix<Type,N,R>& B, const int* ipiv )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( Type );
+
+   if( A.size() != B.size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Batch sizes do not match" );
+   }
+
+   constexpr size_t SIMDSIZE( BatchedMatrix<Type,N,N>::SIMDSIZE );
+
+   batchedApply( A.size(), SIMDSIZE,
+      [&]( size_t g, size_t lanes ) {
+         batchedGetrs<N,R>( A.data(g), B.data(g), ipiv+g*SIMDSIZE*N, lanes );
+         return 0UL;
+      } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place inversion of all matrices of the given batch.
+// \ingroup batched_matrix
+//
+// \param A The batch of matrices to be inverted.
+// \return void
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function inverts every matrix of the batch by means of a Gauss-Jordan elimination with
+// partial pivoting. In case at least one of the matrices is singular, a \a std::runtime_error
+// exception is thrown. In this case all non-singular matrices have been inverted nonetheless,
+// whereas the singular matrices contain unspecified values.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t N >     // Number of rows and columns
+void invert( BatchedMatrix<Type,N,N>& A )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( Type );
+
+   const size_t singular = batchedApply( A.size(), BatchedMatrix<Type,N,N>::SIMDSIZE,
+      [&]( size_t g, size_t lanes ) {
+         return batchedInvert<N>( A.data(g), lanes );
+      } );
+
+   if( singular > 0UL ) {
+      BLAZE_THROW_DIVISION_BY_ZERO( "Inversion of singular matrix failed" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Batched solution of systems of linear equations (\f$ A[b] X[b] = B[b] \f$).
+// \ingroup batched_matrix
+//
+// \param A The batch of system matrices.
+// \param X The batch of solutions.
+// \param B The batch of right-hand sides.
+// \return void
+// \exception std::invalid_argument Batch sizes do not match.
+// \exception std::runtime_error Solving LSE with singular system matrix failed.
+//
+// This function solves every system of equations of the batch by means of an LU decomposition
+// with partial pivoting. In contrast to getrf() and getrs() the system matrices are not modified.
+// The batch of solutions is resized to the size of the batch of right-hand sides and is allowed
+// to be identical to it. In case at least one of the system matrices is singular, a
+// \a std::runtime_error exception is thrown. In this case the solutions of all non-singular
+// systems have been computed nonetheless.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t N       // Number of rows and columns of the system matrices
+        , size_t R >     // Number of right-hand sides
+void solve( const BatchedMatrix<Type,N,N>& A, BatchedMatrix<Type,N,R>& X,
+            const BatchedMatrix<Type,N,R>& B )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( Type );
+
+   if( A.size() != B.size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Batch sizes do not match" );
+   }
+
+   if( &X != &B ) {
+      X = B;
+   }
+
+   using BT = BatchedMatrix<Type,N,N>;
+
+   const size_t singular = batchedApply( A.size(), BT::SIMDSIZE,
+      [&]( size_t g, size_t lanes ) {
+         AlignedArray<Type,BT::GROUPSIZE> lu;
+         int ipiv[N*BT::SIMDSIZE];
+         std::copy( A.data(g), A.data(g)+BT::GROUPSIZE, lu.data() );
+         const size_t failed( batchedGetrf<N>( lu.data(), ipiv, lanes ) );
+         batchedGetrs<N,R>( lu.data(), X.data(g), ipiv, lanes );
+         return failed;
+      } );
+
+   if( singular > 0UL ) {
+      BLAZE_THROW_DIVISION_BY_ZERO( "Solving LSE with singular system matrix failed" );
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
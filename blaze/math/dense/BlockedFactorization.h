@@ -0,0 +1,1141 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/BlockedFactorization.h
+//  \brief Header file for the blocked dense matrix factorization kernels
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_BLOCKEDFACTORIZATION_H_
+#define _BLAZE_MATH_DENSE_BLOCKEDFACTORIZATION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <utility>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/Adaptor.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/constraints/Computation.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/shims/Abs.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/Invert.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/shims/Sqrt.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/math/views/Column.h>
+#include <blaze/math/views/Row.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/math/views/Subvector.h>
+#include <blaze/system/Blocking.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/NumericCast.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  TRIANGULAR SOLVERS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Unblocked kernel for the solution of a triangular system with multiple right-hand sides.
+// \ingroup dense_matrix
+//
+// \param A The triangular system matrix.
+// \param B The right-hand side matrix, which is overwritten by the solution.
+// \param side \c 'L' to solve \f$ A*X=B \f$, \c 'R' to solve \f$ X*A=B \f$.
+// \param uplo \c 'L' in case \a A is lower triangular, \c 'U' in case \a A is upper triangular.
+// \param diag \c 'U' in case \a A is unitriangular, \c 'N' otherwise.
+// \return void
+//
+// This function implements the unblocked triangular solve for the diagonal blocks of the
+// blocked triangular solver blockedTrsm(). The updates are formulated in terms of complete
+// rows (\a side = \c 'L') or columns (\a side = \c 'R') of \a B and are therefore vectorized.
+// Only the triangular part of \a A selected by \a uplo (excluding the diagonal in case of a
+// unitriangular matrix) is accessed.
+*/
+template< typename MT1  // Type of the system matrix
+        , bool SO1      // Storage order of the system matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+void trsmKernel( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& B,
+                 char side, char uplo, char diag )
+{
+   const size_t n( (~A).rows() );
+
+   if( side == 'L' && uplo == 'L' ) {
+      for( size_t i=0UL; i<n; ++i ) {
+         if( diag == 'N' )
+            row( ~B, i, unchecked ) *= inv( (~A)(i,i) );
+         for( size_t l=i+1UL; l<n; ++l )
+            row( ~B, l, unchecked ) -= (~A)(l,i) * row( ~B, i, unchecked );
+      }
+   }
+   else if( side == 'L' ) {
+      for( size_t i=n; i-- > 0UL; ) {
+         if( diag == 'N' )
+            row( ~B, i, unchecked ) *= inv( (~A)(i,i) );
+         for( size_t l=0UL; l<i; ++l )
+            row( ~B, l, unchecked ) -= (~A)(l,i) * row( ~B, i, unchecked );
+      }
+   }
+   else if( uplo == 'U' ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         if( diag == 'N' )
+            column( ~B, j, unchecked ) *= inv( (~A)(j,j) );
+         for( size_t l=j+1UL; l<n; ++l )
+            column( ~B, l, unchecked ) -= (~A)(j,l) * column( ~B, j, unchecked );
+      }
+   }
+   else {
+      for( size_t j=n; j-- > 0UL; ) {
+         if( diag == 'N' )
+            column( ~B, j, unchecked ) *= inv( (~A)(j,j) );
+         for( size_t l=0UL; l<j; ++l )
+            column( ~B, l, unchecked ) -= (~A)(j,l) * column( ~B, j, unchecked );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Unblocked kernel for the solution of a triangular system with a single right-hand side.
+// \ingroup dense_matrix
+//
+// \param A The triangular system matrix.
+// \param b The right-hand side vector, which is overwritten by the solution.
+// \param uplo \c 'L' in case \a A is lower triangular, \c 'U' in case \a A is upper triangular.
+// \param diag \c 'U' in case \a A is unitriangular, \c 'N' otherwise.
+// \return void
+*/
+template< typename MT  // Type of the system matrix
+        , bool SO      // Storage order of the system matrix
+        , typename VT  // Type of the right-hand side vector
+        , bool TF >    // Transpose flag of the right-hand side vector
+void trsvKernel( const DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& b, char uplo, char diag )
+{
+   using ET = ElementType_t<VT>;
+
+   const size_t n( (~A).rows() );
+
+   if( uplo == 'L' ) {
+      for( size_t i=0UL; i<n; ++i ) {
+         if( diag == 'N' )
+            (~b)[i] *= inv( (~A)(i,i) );
+         const ET bi( (~b)[i] );
+         for( size_t l=i+1UL; l<n; ++l )
+            (~b)[l] -= (~A)(l,i) * bi;
+      }
+   }
+   else {
+      for( size_t i=n; i-- > 0UL; ) {
+         if( diag == 'N' )
+            (~b)[i] *= inv( (~A)(i,i) );
+         const ET bi( (~b)[i] );
+         for( size_t l=0UL; l<i; ++l )
+            (~b)[l] -= (~A)(l,i) * bi;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Update of the remaining part of a right-hand side column vector (\f$ y-=A*x \f$).
+// \ingroup dense_matrix
+*/
+template< typename VT1    // Type of the left-hand side target vector
+        , typename MT     // Type of the matrix operand
+        , typename VT2 >  // Type of the vector operand
+inline void trsvUpdate( DenseVector<VT1,columnVector>& y, const MT& A,
+                        const DenseVector<VT2,columnVector>& x )
+{
+   ~y -= A * ~x;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Update of the remaining part of a right-hand side row vector (\f$ y^T-=A*x^T \f$).
+// \ingroup dense_matrix
+*/
+template< typename VT1    // Type of the left-hand side target vector
+        , typename MT     // Type of the matrix operand
+        , typename VT2 >  // Type of the vector operand
+inline void trsvUpdate( DenseVector<VT1,rowVector>& y, const MT& A,
+                        const DenseVector<VT2,rowVector>& x )
+{
+   ~y -= ~x * trans( A );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Blocked solution of a triangular system with multiple right-hand sides.
+// \ingroup dense_matrix
+//
+// \param A The triangular system matrix.
+// \param B The right-hand side matrix, which is overwritten by the solution.
+// \param side \c 'L' to solve \f$ A*X=B \f$, \c 'R' to solve \f$ X*A=B \f$.
+// \param uplo \c 'L' in case \a A is lower triangular, \c 'U' in case \a A is upper triangular.
+// \param diag \c 'U' in case \a A is unitriangular, \c 'N' otherwise.
+// \return void
+//
+// This function is the native counterpart of the BLAS trsm() function. The system matrix is
+// split into blocks of \c FACTORIZATION_BLOCK_SIZE rows/columns. The diagonal blocks are solved
+// by the unblocked trsmKernel() and the remaining part of \a B is updated by means of a dense
+// matrix multiplication, which is vectorized, blocked and parallelized by the according Blaze
+// kernels. The system matrix may be any dense matrix or transpose expression (as for instance
+// \c trans(A) or \c ctrans(A)). Only the triangular part selected by \a uplo is accessed.
+*/
+template< typename MT1  // Type of the system matrix
+        , bool SO1      // Storage order of the system matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+void blockedTrsm( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& B,
+                  char side, char uplo, char diag )
+{
+   BLAZE_INTERNAL_ASSERT( isSquare( ~A ), "Non-square triangular matrix detected" );
+   BLAZE_INTERNAL_ASSERT( side == 'L' || side == 'R', "Invalid side argument detected" );
+   BLAZE_INTERNAL_ASSERT( uplo == 'L' || uplo == 'U', "Invalid uplo argument detected" );
+   BLAZE_INTERNAL_ASSERT( diag == 'U' || diag == 'N', "Invalid diag argument detected" );
+   BLAZE_INTERNAL_ASSERT( ( side == 'L' ? (~B).rows() : (~B).columns() ) == (~A).rows(), "Invalid matrix sizes detected" );
+
+   const size_t n( (~A).rows() );
+   const size_t m( side == 'L' ? (~B).columns() : (~B).rows() );
+
+   if( side == 'L' && uplo == 'L' ) {
+      for( size_t k=0UL; k<n; k+=FACTORIZATION_BLOCK_SIZE ) {
+         const size_t kb( min( FACTORIZATION_BLOCK_SIZE, n-k ) );
+         auto B1( submatrix( ~B, k, 0UL, kb, m, unchecked ) );
+         trsmKernel( submatrix( ~A, k, k, kb, kb, unchecked ), B1, side, uplo, diag );
+         if( k+kb < n ) {
+            auto B2( submatrix( ~B, k+kb, 0UL, n-k-kb, m, unchecked ) );
+            B2 -= submatrix( ~A, k+kb, k, n-k-kb, kb, unchecked ) * B1;
+         }
+      }
+   }
+   else if( side == 'L' ) {
+      for( size_t k=n; k>0UL; ) {
+         const size_t kb( min( FACTORIZATION_BLOCK_SIZE, k ) );
+         k -= kb;
+         auto B1( submatrix( ~B, k, 0UL, kb, m, unchecked ) );
+         trsmKernel( submatrix( ~A, k, k, kb, kb, unchecked ), B1, side, uplo, diag );
+         if( k > 0UL ) {
+            auto B2( submatrix( ~B, 0UL, 0UL, k, m, unchecked ) );
+            B2 -= submatrix( ~A, 0UL, k, k, kb, unchecked ) * B1;
+         }
+      }
+   }
+   else if( uplo == 'U' ) {
+      for( size_t k=0UL; k<n; k+=FACTORIZATION_BLOCK_SIZE ) {
+         const size_t kb( min( FACTORIZATION_BLOCK_SIZE, n-k ) );
+         auto B1( submatrix( ~B, 0UL, k, m, kb, unchecked ) );
+         trsmKernel( submatrix( ~A, k, k, kb, kb, unchecked ), B1, side, uplo, diag );
+         if( k+kb < n ) {
+            auto B2( submatrix( ~B, 0UL, k+kb, m, n-k-kb, unchecked ) );
+            B2 -= B1 * submatrix( ~A, k, k+kb, kb, n-k-kb, unchecked );
+         }
+      }
+   }
+   else {
+      for( size_t k=n; k>0UL; ) {
+         const size_t kb( min( FACTORIZATION_BLOCK_SIZE, k ) );
+         k -= kb;
+         auto B1( submatrix( ~B, 0UL, k, m, kb, unchecked ) );
+         trsmKernel( submatrix( ~A, k, k, kb, kb, unchecked ), B1, side, uplo, diag );
+         if( k > 0UL ) {
+            auto B2( submatrix( ~B, 0UL, 0UL, m, k, unchecked ) );
+            B2 -= B1 * submatrix( ~A, k, 0UL, kb, k, unchecked );
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Blocked solution of a triangular system with a single right-hand side (\f$ A*x=b \f$).
+// \ingroup dense_matrix
+//
+// \param A The triangular system matrix.
+// \param b The right-hand side vector, which is overwritten by the solution.
+// \param uplo \c 'L' in case \a A is lower triangular, \c 'U' in case \a A is upper triangular.
+// \param diag \c 'U' in case \a A is unitriangular, \c 'N' otherwise.
+// \return void
+//
+// This function is the native counterpart of the BLAS trsv() function. The diagonal blocks
+// are solved by the unblocked trsvKernel(), the remaining part of \a b is updated by means of
+// a dense matrix/dense vector multiplication.
+*/
+template< typename MT  // Type of the system matrix
+        , bool SO      // Storage order of the system matrix
+        , typename VT  // Type of the right-hand side vector
+        , bool TF >    // Transpose flag of the right-hand side vector
+void blockedTrsm( const DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& b, char uplo, char diag )
+{
+   BLAZE_INTERNAL_ASSERT( isSquare( ~A ), "Non-square triangular matrix detected" );
+   BLAZE_INTERNAL_ASSERT( (~A).rows() == (~b).size(), "Invalid matrix and vector sizes detected" );
+
+   const size_t n( (~A).rows() );
+
+   if( uplo == 'L' ) {
+      for( size_t k=0UL; k<n; k+=FACTORIZATION_BLOCK_SIZE ) {
+         const size_t kb( min( FACTORIZATION_BLOCK_SIZE, n-k ) );
+         auto b1( subvector( ~b, k, kb, unchecked ) );
+         trsvKernel( submatrix( ~A, k, k, kb, kb, unchecked ), b1, uplo, diag );
+         if( k+kb < n ) {
+            auto b2( subvector( ~b, k+kb, n-k-kb, unchecked ) );
+            trsvUpdate( b2, submatrix( ~A, k+kb, k, n-k-kb, kb, unchecked ), b1 );
+         }
+      }
+   }
+   else {
+      for( size_t k=n; k>0UL; ) {
+         const size_t kb( min( FACTORIZATION_BLOCK_SIZE, k ) );
+         k -= kb;
+         auto b1( subvector( ~b, k, kb, unchecked ) );
+         trsvKernel( submatrix( ~A, k, k, kb, kb, unchecked ), b1, uplo, diag );
+         if( k > 0UL ) {
+            auto b2( subvector( ~b, 0UL, k, unchecked ) );
+            trsvUpdate( b2, submatrix( ~A, 0UL, k, k, kb, unchecked ), b1 );
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LU DECOMPOSITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns a part of a logical column of the LU factorization of a column-major matrix.
+// \ingroup dense_matrix
+//
+// \param A The matrix to be factorized.
+// \param j The index of the logical column.
+// \param i The index of the first element of the part.
+// \param n The number of elements of the part.
+// \return View on the specified part of the logical column.
+//
+// The LU factorization of a column-major matrix operates on the matrix itself, i.e. a logical
+// column is a column of the given matrix.
+*/
+template< typename MT >  // Type of the matrix
+inline decltype(auto) luColumn( DenseMatrix<MT,columnMajor>& A, size_t j, size_t i, size_t n )
+{
+   return subvector( column( ~A, j, unchecked ), i, n, unchecked );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns a part of a logical column of the LU factorization of a row-major matrix.
+// \ingroup dense_matrix
+//
+// \param A The matrix to be factorized.
+// \param j The index of the logical column.
+// \param i The index of the first element of the part.
+// \param n The number of elements of the part.
+// \return View on the specified part of the logical column.
+//
+// In accordance with the LAPACK getrf() functions the LU factorization of a row-major matrix
+// operates on the transpose of the matrix, i.e. a logical column is a row of the given matrix.
+*/
+template< typename MT >  // Type of the matrix
+inline decltype(auto) luColumn( DenseMatrix<MT,rowMajor>& A, size_t j, size_t i, size_t n )
+{
+   return subvector( row( ~A, j, unchecked ), i, n, unchecked );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns a logical block of the LU factorization of the given matrix.
+// \ingroup dense_matrix
+//
+// \param A The matrix to be factorized.
+// \param i The index of the first logical row of the block.
+// \param j The index of the first logical column of the block.
+// \param m The number of logical rows of the block.
+// \param n The number of logical columns of the block.
+// \return View on the physical storage of the specified logical block.
+//
+// For column-major matrices the logical block is a submatrix of \a A, for row-major matrices
+// it is the transpose of a submatrix of \a A.
+*/
+template< typename MT  // Type of the matrix
+        , bool SO >    // Storage order of the matrix
+inline decltype(auto) luBlock( DenseMatrix<MT,SO>& A, size_t i, size_t j, size_t m, size_t n )
+{
+   return submatrix( ~A, ( SO ? i : j ), ( SO ? j : i ), ( SO ? m : n ), ( SO ? n : m ), unchecked );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Unblocked LU factorization of a panel of the given matrix.
+// \ingroup dense_matrix
+//
+// \param A The matrix to be factorized.
+// \param k The index of the first logical column of the panel.
+// \param kb The number of logical columns of the panel.
+// \param ipiv The pivot indices of the factorization.
+// \return void
+//
+// This function factorizes the logical columns \f$ [k..k+kb) \f$ by means of partial pivoting
+// and row interchanges. The row interchanges are applied to all logical columns, the elements
+// of all logical columns right of the panel are not updated otherwise. The pivot indices are
+// stored 1-based in \a ipiv in accordance with the LAPACK getrf() functions.
+*/
+template< typename MT  // Type of the matrix
+        , bool SO >    // Storage order of the matrix
+void getrfPanel( DenseMatrix<MT,SO>& A, size_t k, size_t kb, int* ipiv )
+{
+   using std::swap;
+
+   using ET = ElementType_t<MT>;
+
+   const size_t m( SO ? (~A).rows() : (~A).columns() );
+   const size_t n( SO ? (~A).columns() : (~A).rows() );
+
+   auto element = [&A]( size_t i, size_t j ) -> ET& {
+      return ( SO ? (~A)(i,j) : (~A)(j,i) );
+   };
+
+   for( size_t j=k; j<k+kb; ++j )
+   {
+      size_t p( j );
+      auto pmax( abs( element( j, j ) ) );
+
+      for( size_t i=j+1UL; i<m; ++i ) {
+         if( abs( element( i, j ) ) > pmax ) {
+            pmax = abs( element( i, j ) );
+            p = i;
+         }
+      }
+
+      ipiv[j] = numeric_cast<int>( p+1UL );
+
+      if( p != j ) {
+         for( size_t l=0UL; l<n; ++l ) {
+            swap( element( j, l ), element( p, l ) );
+         }
+      }
+
+      if( j+1UL == m ) continue;
+
+      if( !isDefault( element( j, j ) ) ) {
+         luColumn( ~A, j, j+1UL, m-j-1UL ) *= inv( element( j, j ) );
+      }
+
+      for( size_t l=j+1UL; l<k+kb; ++l ) {
+         luColumn( ~A, l, j+1UL, m-j-1UL ) -= element( j, l ) * luColumn( ~A, j, j+1UL, m-j-1UL );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Blocked LU decomposition of the given dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The matrix to be decomposed.
+// \param ipiv Auxiliary array for the pivot indices; size >= min( \a m, \a n ).
+// \return void
+//
+// This function is the native counterpart of the LAPACK getrf() functions and produces the
+// identical factorization, i.e. for column-major matrices it computes \f$ A = P \cdot L \cdot U
+// \f$ (with \c L being lower unitriangular) and for row-major matrices \f$ A = L \cdot U \cdot
+// P \f$ (with \c U being upper unitriangular). The pivot indices are stored 1-based in \a ipiv.
+// The function implements a right-looking blocked algorithm: Each panel of
+// \c FACTORIZATION_BLOCK_SIZE columns is factorized by getrfPanel(), the according block row
+// of \c U is computed by blockedTrsm() and the trailing submatrix is updated by means of a dense
+// matrix multiplication, which is vectorized, blocked and parallelized by the Blaze kernels.
+// In case the matrix is exactly singular the factorization is completed nevertheless.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+void blockedGetrf( DenseMatrix<MT,SO>& A, int* ipiv )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<MT> );
+
+   const size_t m( SO ? (~A).rows() : (~A).columns() );
+   const size_t n( SO ? (~A).columns() : (~A).rows() );
+   const size_t mindim( min( m, n ) );
+
+   for( size_t k=0UL; k<mindim; k+=FACTORIZATION_BLOCK_SIZE )
+   {
+      const size_t kb( min( FACTORIZATION_BLOCK_SIZE, mindim-k ) );
+
+      getrfPanel( ~A, k, kb, ipiv );
+
+      if( k+kb == n ) break;
+
+      auto A11( luBlock( ~A, k   , k   , kb    , kb     ) );
+      auto A12( luBlock( ~A, k   , k+kb, kb    , n-k-kb ) );
+      auto A21( luBlock( ~A, k+kb, k   , m-k-kb, kb     ) );
+      auto A22( luBlock( ~A, k+kb, k+kb, m-k-kb, n-k-kb ) );
+
+      if( SO ) {
+         blockedTrsm( A11, A12, 'L', 'L', 'U' );
+         if( k+kb < m ) A22 -= A21 * A12;
+      }
+      else {
+         blockedTrsm( A11, A12, 'R', 'U', 'U' );
+         if( k+kb < m ) A22 -= A12 * A21;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Solution of a linear system based on the LU decomposition of the system matrix.
+// \ingroup dense_matrix
+//
+// \param A The LU decomposed system matrix.
+// \param b The right-hand side vector, which is overwritten by the solution.
+// \param ipiv The pivot indices of the LU decomposition.
+// \return void
+//
+// This function is the native counterpart of the LAPACK getrs() functions. It solves the system
+// \f$ A*x=b \f$ in case \a A is column-major and \f$ A^T*x=b \f$ in case \a A is row-major, based
+// on the LU decomposition computed by blockedGetrf().
+*/
+template< typename MT  // Type of the system matrix
+        , bool SO      // Storage order of the system matrix
+        , typename VT  // Type of the right-hand side vector
+        , bool TF >    // Transpose flag of the right-hand side vector
+void blockedGetrs( const DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& b, const int* ipiv )
+{
+   using std::swap;
+
+   const size_t n( (~A).rows() );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      const size_t p( ipiv[i] - 1 );
+      if( p != i ) swap( (~b)[i], (~b)[p] );
+   }
+
+   if( SO ) {
+      blockedTrsm( ~A, ~b, 'L', 'U' );
+      blockedTrsm( ~A, ~b, 'U', 'N' );
+   }
+   else {
+      blockedTrsm( trans( ~A ), ~b, 'L', 'U' );
+      blockedTrsm( trans( ~A ), ~b, 'U', 'N' );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Solution of a linear system based on the LU decomposition of the system matrix.
+// \ingroup dense_matrix
+//
+// \param A The LU decomposed system matrix.
+// \param B The right-hand side matrix, which is overwritten by the solution.
+// \param ipiv The pivot indices of the LU decomposition.
+// \return void
+//
+// This function is the native counterpart of the LAPACK getrs() functions. It solves the system
+// \f$ A*X=B \f$ in case \a A is column-major and \f$ A^T*X=B \f$ in case \a A is row-major, based
+// on the LU decomposition computed by blockedGetrf(). Independent of the storage order of \a B
+// the right-hand sides are the columns of \a B.
+*/
+template< typename MT1  // Type of the system matrix
+        , bool SO1      // Storage order of the system matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+void blockedGetrs( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& B, const int* ipiv )
+{
+   using std::swap;
+
+   const size_t n( (~A).rows() );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      const size_t p( ipiv[i] - 1 );
+      if( p != i ) {
+         for( size_t j=0UL; j<(~B).columns(); ++j ) {
+            swap( (~B)(i,j), (~B)(p,j) );
+         }
+      }
+   }
+
+   if( SO1 ) {
+      blockedTrsm( ~A, ~B, 'L', 'L', 'U' );
+      blockedTrsm( ~A, ~B, 'L', 'U', 'N' );
+   }
+   else {
+      blockedTrsm( trans( ~A ), ~B, 'L', 'L', 'U' );
+      blockedTrsm( trans( ~A ), ~B, 'L', 'U', 'N' );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Checks the diagonal of the given triangular factor for exact zeros.
+// \ingroup dense_matrix
+//
+// \param A The triangular factor.
+// \return void
+// \exception std::runtime_error Inversion of singular matrix failed.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+void checkNonSingular( const DenseMatrix<MT,SO>& A )
+{
+   const size_t n( min( (~A).rows(), (~A).columns() ) );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      if( isDefault( (~A)(i,i) ) ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Inversion of singular matrix failed" );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Blocked solution of a general linear system of equations (\f$ A*x=b \f$).
+// \ingroup dense_matrix
+//
+// \param A The system matrix, which is overwritten by its LU decomposition.
+// \param b The right-hand side vector, which is overwritten by the solution.
+// \param ipiv Auxiliary array of size \a n for the pivot indices.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid right-hand side vector provided.
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function is the native counterpart of the LAPACK gesv() functions. It solves the system
+// \f$ A*x=b \f$ in case \a A is column-major and \f$ A^T*x=b \f$ in case \a A is row-major.
+*/
+template< typename MT  // Type of the system matrix
+        , bool SO      // Storage order of the system matrix
+        , typename VT  // Type of the right-hand side vector
+        , bool TF >    // Transpose flag of the right-hand side vector
+void blockedGesv( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& b, int* ipiv )
+{
+   if( !isSquare( ~A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( (~b).size() != (~A).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side vector provided" );
+   }
+
+   blockedGetrf( ~A, ipiv );
+   checkNonSingular( ~A );
+   blockedGetrs( ~A, ~b, ipiv );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Blocked solution of a general linear system of equations (\f$ A*X=B \f$).
+// \ingroup dense_matrix
+//
+// \param A The system matrix, which is overwritten by its LU decomposition.
+// \param B The right-hand side matrix, which is overwritten by the solution.
+// \param ipiv Auxiliary array of size \a n for the pivot indices.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid right-hand side matrix provided.
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function is the native counterpart of the LAPACK gesv() functions. It solves the system
+// \f$ A*X=B \f$ in case \a A is column-major and \f$ A^T*X=B \f$ in case \a A is row-major.
+// Independent of the storage order of \a B the right-hand sides are the columns of \a B.
+*/
+template< typename MT1  // Type of the system matrix
+        , bool SO1      // Storage order of the system matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+void blockedGesv( DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& B, int* ipiv )
+{
+   if( !isSquare( ~A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( (~B).rows() != (~A).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side matrix provided" );
+   }
+
+   blockedGetrf( ~A, ipiv );
+   checkNonSingular( ~A );
+   blockedGetrs( ~A, ~B, ipiv );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Blocked inversion of the given LU decomposed dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The LU decomposed matrix to be inverted.
+// \param ipiv The pivot indices of the LU decomposition.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function is the native counterpart of the LAPACK getri() functions. It inverts the given
+// matrix, which has already been decomposed by blockedGetrf(), by solving the system with the
+// identity matrix as right-hand side. The temporary right-hand side is of the result type of
+// \a A, i.e. in case of a StaticMatrix no dynamic memory is required.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+void blockedGetri( DenseMatrix<MT,SO>& A, const int* ipiv )
+{
+   using RT = ResultType_t<MT>;
+   using OT = OppositeType_t<MT>;
+
+   if( !isSquare( ~A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   checkNonSingular( ~A );
+
+   const size_t n( (~A).rows() );
+
+   If_t<SO,OT,RT> X( ~A );
+
+   reset( X );
+   for( size_t i=0UL; i<n; ++i ) {
+      X(i,i) = ElementType_t<MT>( 1 );
+   }
+
+   blockedGetrs( ~A, X, ipiv );
+
+   if( SO ) ~A = X;
+   else     ~A = trans( X );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CHOLESKY DECOMPOSITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Unblocked Cholesky decomposition of a diagonal block (\f$ A = L L^{H} \f$).
+// \ingroup dense_matrix
+//
+// \param A The diagonal block to be decomposed.
+// \return void
+// \exception std::runtime_error Decomposition of non-positive-definite matrix failed.
+//
+// Only the lower part of \a A is accessed.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+void potrfKernel( DenseMatrix<MT,SO>& A )
+{
+   using ET = ElementType_t<MT>;
+   using BT = UnderlyingBuiltin_t<ET>;
+
+   const size_t n( (~A).rows() );
+
+   for( size_t j=0UL; j<n; ++j )
+   {
+      const BT ajj( real( (~A)(j,j) ) );
+
+      if( !( ajj > BT(0) ) ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Decomposition of non-positive-definite matrix failed" );
+      }
+
+      const BT ljj( sqrt( ajj ) );
+      const BT scale( BT(1) / ljj );
+
+      (~A)(j,j) = ljj;
+
+      for( size_t i=j+1UL; i<n; ++i ) {
+         (~A)(i,j) *= scale;
+      }
+
+      for( size_t l=j+1UL; l<n; ++l ) {
+         const ET tmp( conj( (~A)(l,j) ) );
+         for( size_t i=l; i<n; ++i ) {
+            (~A)(i,l) -= (~A)(i,j) * tmp;
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place conjugate transposition of the given square dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The square matrix to be transposed.
+// \return void
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+void conjugateTranspose( DenseMatrix<MT,SO>& A )
+{
+   using std::swap;
+
+   const size_t n( (~A).rows() );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      for( size_t j=0UL; j<i; ++j ) {
+         swap( (~A)(i,j), (~A)(j,i) );
+         conjugate( (~A)(i,j) );
+         conjugate( (~A)(j,i) );
+      }
+      conjugate( (~A)(i,i) );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Blocked Cholesky decomposition of the given dense positive definite matrix.
+// \ingroup dense_matrix
+//
+// \param A The matrix to be decomposed.
+// \param uplo \c 'L' to use the lower part of the matrix, \c 'U' to use the upper part.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid uplo argument provided.
+// \exception std::runtime_error Decomposition of non-positive-definite matrix failed.
+//
+// This function is the native counterpart of the LAPACK potrf() functions. It computes either
+// \f$ A = L L^{H} \f$ (\a uplo = \c 'L') or \f$ A = U^{H} U \f$ (\a uplo = \c 'U') independent
+// of the storage order of \a A. Only the selected part of \a A is accessed. The function
+// implements a right-looking blocked algorithm: The diagonal blocks are decomposed by
+// potrfKernel(), the block columns below them are computed by blockedTrsm() and the lower part
+// of the trailing submatrix is updated block column by block column. The products for the
+// diagonal blocks are computed into a separate workspace and only their lower parts are
+// subtracted, such that the strictly upper part of \a A is never accessed. The remaining blocks
+// are updated by means of a parallel dense matrix multiplication.
+//
+// \note This function does only provide the basic exception safety guarantee, i.e. in case of an
+// exception \a A may already have been modified.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+void blockedPotrf( DenseMatrix<MT,SO>& A, char uplo )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<MT> );
+
+   using ET = ElementType_t<MT>;
+
+   if( !isSquare( ~A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( uplo != 'L' && uplo != 'U' ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid uplo argument provided" );
+   }
+
+   if( uplo == 'U' ) {
+      conjugateTranspose( ~A );
+      blockedPotrf( ~A, 'L' );
+      conjugateTranspose( ~A );
+      return;
+   }
+
+   const size_t n( (~A).rows() );
+
+   for( size_t k=0UL; k<n; k+=FACTORIZATION_BLOCK_SIZE )
+   {
+      const size_t kb( min( FACTORIZATION_BLOCK_SIZE, n-k ) );
+
+      auto A11( submatrix( ~A, k, k, kb, kb, unchecked ) );
+      potrfKernel( A11 );
+
+      if( k+kb == n ) break;
+
+      const size_t r( n-k-kb );
+
+      auto A21( submatrix( ~A, k+kb, k, r, kb, unchecked ) );
+      blockedTrsm( ctrans( A11 ), A21, 'R', 'U', 'N' );
+
+      const DynamicMatrix<ET,SO> W( ctrans( A21 ) );
+      DynamicMatrix<ET,SO> D;
+
+      for( size_t j=0UL; j<r; j+=FACTORIZATION_BLOCK_SIZE )
+      {
+         const size_t jb( min( FACTORIZATION_BLOCK_SIZE, r-j ) );
+         const size_t jj( k+kb+j );
+
+         auto C11( submatrix( ~A, jj, jj, jb, jb, unchecked ) );
+         const auto W1( submatrix( W, 0UL, j, kb, jb, unchecked ) );
+
+         D = submatrix( A21, j, 0UL, jb, kb, unchecked ) * W1;
+
+         for( size_t i=0UL; i<jb; ++i ) {
+            for( size_t l=0UL; l<=i; ++l ) {
+               C11(i,l) -= D(i,l);
+            }
+         }
+
+         if( j+jb < r ) {
+            auto C21( submatrix( ~A, jj+jb, jj, r-j-jb, jb, unchecked ) );
+            C21 -= submatrix( A21, j+jb, 0UL, r-j-jb, kb, unchecked ) * W1;
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Blocked inversion of the given dense triangular matrix.
+// \ingroup dense_matrix
+//
+// \param A The triangular matrix to be inverted.
+// \param uplo \c 'L' in case of a lower matrix, \c 'U' in case of an upper matrix.
+// \param diag \c 'U' in case of a unitriangular matrix, \c 'N' otherwise.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid uplo argument provided.
+// \exception std::invalid_argument Invalid diag argument provided.
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function is the native counterpart of the LAPACK trtri() functions. The inverse is
+// computed block column by block column by means of blockedTrsm(), where each block column only
+// involves the non-zero part of the inverse. Only the triangular part of \a A selected by
+// \a uplo is accessed and overwritten.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+void blockedTrtri( DenseMatrix<MT,SO>& A, char uplo, char diag )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<MT> );
+
+   using RT = ResultType_t<MT>;
+   using OT = OppositeType_t<MT>;
+
+   if( !isSquare( ~A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( uplo != 'L' && uplo != 'U' ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid uplo argument provided" );
+   }
+
+   if( diag != 'U' && diag != 'N' ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid diag argument provided" );
+   }
+
+   if( diag == 'N' ) {
+      checkNonSingular( ~A );
+   }
+
+   const size_t n( (~A).rows() );
+
+   If_t<SO,OT,RT> X( ~A );
+
+   reset( X );
+   for( size_t i=0UL; i<n; ++i ) {
+      X(i,i) = ElementType_t<MT>( 1 );
+   }
+
+   for( size_t j=0UL; j<n; j+=FACTORIZATION_BLOCK_SIZE )
+   {
+      const size_t jb( min( FACTORIZATION_BLOCK_SIZE, n-j ) );
+
+      if( uplo == 'L' ) {
+         auto Xj( submatrix( X, j, j, n-j, jb, unchecked ) );
+         blockedTrsm( submatrix( ~A, j, j, n-j, n-j, unchecked ), Xj, 'L', 'L', diag );
+      }
+      else {
+         auto Xj( submatrix( X, 0UL, j, j+jb, jb, unchecked ) );
+         blockedTrsm( submatrix( ~A, 0UL, 0UL, j+jb, j+jb, unchecked ), Xj, 'L', 'U', diag );
+      }
+   }
+
+   const size_t offset( diag == 'U' ? 1UL : 0UL );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      if( uplo == 'L' ) {
+         for( size_t j=0UL; j+offset<=i; ++j )
+            (~A)(i,j) = X(i,j);
+      }
+      else {
+         for( size_t j=i+offset; j<n; ++j )
+            (~A)(i,j) = X(i,j);
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Blocked inversion of the given Cholesky decomposed dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The Cholesky decomposed matrix to be inverted.
+// \param uplo \c 'L' to use the lower part of the matrix, \c 'U' to use the upper part.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid uplo argument provided.
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function is the native counterpart of the LAPACK potri() functions for matrices that
+// have already been decomposed by blockedPotrf(). The triangular factor is inverted by
+// blockedTrtri() and the inverse \f$ A^{-1} = L^{-H} L^{-1} \f$ (\a uplo = \c 'L') or
+// \f$ A^{-1} = U^{-1} U^{-H} \f$ (\a uplo = \c 'U') is computed by a triangular dense matrix
+// multiplication. The resulting Hermitian inverse is stored in the selected part of \a A.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+void blockedPotri( DenseMatrix<MT,SO>& A, char uplo )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<MT> );
+
+   using RT = ResultType_t<MT>;
+
+   if( !isSquare( ~A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( uplo != 'L' && uplo != 'U' ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid uplo argument provided" );
+   }
+
+   const size_t n( (~A).rows() );
+
+   RT T( ~A );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      if( uplo == 'L' ) {
+         for( size_t j=i+1UL; j<n; ++j )
+            reset( T(i,j) );
+      }
+      else {
+         for( size_t j=0UL; j<i; ++j )
+            reset( T(i,j) );
+      }
+   }
+
+   blockedTrtri( T, uplo, 'N' );
+
+   if( uplo == 'L' ) {
+      const RT X( declupp( ctrans( T ) ) * decllow( T ) );
+      for( size_t i=0UL; i<n; ++i )
+         for( size_t j=0UL; j<=i; ++j )
+            (~A)(i,j) = X(i,j);
+   }
+   else {
+      const RT X( declupp( T ) * decllow( ctrans( T ) ) );
+      for( size_t i=0UL; i<n; ++i )
+         for( size_t j=i; j<n; ++j )
+            (~A)(i,j) = X(i,j);
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
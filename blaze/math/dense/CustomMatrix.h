@@ -2534,7 +2534,7 @@ inline void CustomMatrix<Type,AF,PF,SO,RT>::assign( const DenseMatrix<MT,!SO>& r
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
 
-   constexpr size_t block( BLOCK_SIZE );
+   const size_t block( BLOCK_SIZE );
 
    for( size_t ii=0UL; ii<m_; ii+=block ) {
       const size_t iend( min( m_, ii+block ) );
@@ -2751,7 +2751,7 @@ inline void CustomMatrix<Type,AF,PF,SO,RT>::addAssign( const DenseMatrix<MT,!SO>
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
 
-   constexpr size_t block( BLOCK_SIZE );
+   const size_t block( BLOCK_SIZE );
 
    for( size_t ii=0UL; ii<m_; ii+=block ) {
       const size_t iend( min( m_, ii+block ) );
@@ -2980,7 +2980,7 @@ inline void CustomMatrix<Type,AF,PF,SO,RT>::subAssign( const DenseMatrix<MT,!SO>
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
 
-   constexpr size_t block( BLOCK_SIZE );
+   const size_t block( BLOCK_SIZE );
 
    for( size_t ii=0UL; ii<m_; ii+=block ) {
       const size_t iend( min( m_, ii+block ) );
@@ -3185,7 +3185,7 @@ inline void CustomMatrix<Type,AF,PF,SO,RT>::schurAssign( const DenseMatrix<MT,!S
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
 
-   constexpr size_t block( BLOCK_SIZE );
+   const size_t block( BLOCK_SIZE );
 
    for( size_t ii=0UL; ii<m_; ii+=block ) {
       const size_t iend( min( m_, ii+block ) );
@@ -5423,7 +5423,7 @@ inline void CustomMatrix<Type,AF,PF,true,RT>::assign( const DenseMatrix<MT,false
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
 
-   constexpr size_t block( BLOCK_SIZE );
+   const size_t block( BLOCK_SIZE );
 
    for( size_t jj=0UL; jj<n_; jj+=block ) {
       const size_t jend( min( n_, jj+block ) );
@@ -5645,7 +5645,7 @@ inline void CustomMatrix<Type,AF,PF,true,RT>::addAssign( const DenseMatrix<MT,fa
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
 
-   constexpr size_t block( BLOCK_SIZE );
+   const size_t block( BLOCK_SIZE );
 
    for( size_t jj=0UL; jj<n_; jj+=block ) {
       const size_t jend( min( n_, jj+block ) );
@@ -5880,7 +5880,7 @@ inline void CustomMatrix<Type,AF,PF,true,RT>::subAssign( const DenseMatrix<MT,fa
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
 
-   constexpr size_t block( BLOCK_SIZE );
+   const size_t block( BLOCK_SIZE );
 
    for( size_t jj=0UL; jj<n_; jj+=block ) {
       const size_t jend( min( n_, jj+block ) );
@@ -6091,7 +6091,7 @@ inline void CustomMatrix<Type,AF,PF,true,RT>::schurAssign( const DenseMatrix<MT,
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
 
-   constexpr size_t block( BLOCK_SIZE );
+   const size_t block( BLOCK_SIZE );
 
    for( size_t jj=0UL; jj<n_; jj+=block ) {
       const size_t jend( min( n_, jj+block ) );
@@ -0,0 +1,1057 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/DispatchedKernels.h
+//  \brief Header file for the runtime dispatched dense kernels
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_DISPATCHEDKERNELS_H_
+#define _BLAZE_MATH_DENSE_DISPATCHEDKERNELS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstring>
+#include <memory>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/simd/SIMDLevel.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/HasMutableDataAccess.h>
+#include <blaze/math/typetraits/IsContiguous.h>
+#include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/math/typetraits/IsUpper.h>
+#include <blaze/system/Blocking.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/mpl/Bools.h>
+#include <blaze/util/policies/Deallocate.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsDouble.h>
+#include <blaze/util/typetraits/IsFloat.h>
+#include <blaze/util/typetraits/IsSame.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  DISPATCH TRAITS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary variable template for the runtime dispatched dense kernels.
+// \ingroup dense_matrix
+//
+// This variable template evaluates to \a true in case the CPU dispatch mode is enabled and the
+// given dense vector or matrix type \a T provides direct access to its contiguously stored
+// \c float or \c double elements. Lower and upper triangular matrices are excluded, since the
+// compile time kernels exploit their structure.
+*/
+template< typename T >  // Type of the dense vector or matrix
+constexpr bool IsDispatchable_v =
+   ( BLAZE_CPU_DISPATCH_MODE &&
+     IsContiguous_v<T> && HasConstDataAccess_v<T> &&
+     !IsLower_v<T> && !IsUpper_v<T> &&
+     ( IsFloat_v< ElementType_t<T> > || IsDouble_v< ElementType_t<T> > ) );
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary variable template for the runtime dispatched dense kernels.
+// \ingroup dense_matrix
+//
+// This variable template evaluates to \a true in case all given types are dispatchable (see
+// IsDispatchable_v) and have the same element type.
+*/
+template< typename T1       // Type of the first dense vector or matrix
+        , typename... Ts >  // Types of the further dense vectors and matrices
+constexpr bool AreDispatchable_v =
+   ( IsDispatchable_v<T1> &&
+     IsSame_v< Bools< true, ( IsDispatchable_v<Ts> && IsSame_v< ElementType_t<T1>, ElementType_t<Ts> > )... >
+             , Bools< ( IsDispatchable_v<Ts> && IsSame_v< ElementType_t<T1>, ElementType_t<Ts> > )..., true > > );
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+#if BLAZE_CPU_DISPATCH_MODE
+//=================================================================================================
+//
+//  TARGET SPECIFIC VECTOR TYPES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Generic SIMD vector type of the runtime dispatched kernels.
+// \ingroup dense_matrix
+//
+// The dispatched kernels are formulated in terms of the generic vector types of the GNU and
+// Clang compilers. The same kernel is instantiated for different vector widths within functions
+// that are compiled for the according instruction set (see the BLAZE_DISPATCH_TARGET_* macros),
+// which results in native AVX, AVX2/FMA, and AVX-512 instructions independent of the compile
+// time settings.
+*/
+template< typename T       // Element type
+        , size_t Bytes >  // Width of the vector in bytes
+struct DispatchVector
+{
+   typedef T Type          __attribute__(( vector_size( Bytes ) ));
+   typedef T UnalignedType __attribute__(( vector_size( Bytes ), aligned( sizeof(T) ), may_alias ));
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+#define BLAZE_DISPATCH_TARGET_AVX    __attribute__(( target( "avx" ) ))
+#define BLAZE_DISPATCH_TARGET_AVX2   __attribute__(( target( "avx2,fma" ) ))
+#define BLAZE_DISPATCH_TARGET_AVX512 __attribute__(( target( "avx512f,avx2,fma" ) ))
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Unaligned access to a generic SIMD vector.
+// \ingroup dense_matrix
+//
+// This function returns a reference instead of a vector value, since returning a vector by
+// value from a function that is not compiled for the according instruction set would change
+// the ABI.
+*/
+template< typename U    // Unaligned vector type
+        , typename T >  // Element type
+BLAZE_ALWAYS_INLINE U& dispatchAccess( T* address ) noexcept
+{
+   return *reinterpret_cast<U*>( address );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Horizontal sum of a generic SIMD vector.
+// \ingroup dense_matrix
+*/
+template< typename T, typename V >
+BLAZE_ALWAYS_INLINE T dispatchReduce( const V& v ) noexcept
+{
+   T s( v[0] );
+   for( size_t i=1UL; i<sizeof(V)/sizeof(T); ++i ) {
+      s += v[i];
+   }
+   return s;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GENERIC KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Generic packed-panel kernel for the dense matrix/dense matrix multiplication
+//        (\f$ C+=\alpha*A*B \f$).
+// \ingroup dense_matrix
+//
+// \param M The number of rows of \a A and \a C.
+// \param N The number of columns of \a B and \a C.
+// \param K The number of columns of \a A and rows of \a B.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param A Pointer to the first element of \a A.
+// \param ars The distance between two consecutive rows of \a A.
+// \param acs The distance between two consecutive columns of \a A.
+// \param B Pointer to the first element of \a B.
+// \param brs The distance between two consecutive rows of \a B.
+// \param bcs The distance between two consecutive columns of \a B.
+// \param C Pointer to the first element of the row-major matrix \a C.
+// \param ldc The distance between two consecutive rows of \a C.
+// \return void
+//
+// This kernel follows the scheme of the default packed-panel engine (see mmmPacked()) with the
+// same blocking parameters and register tile, but with a vector width of \a Bytes bytes.
+*/
+template< typename T       // Element type
+        , size_t Bytes >  // Width of the SIMD vectors in bytes
+BLAZE_ALWAYS_INLINE void dispatchedGemmKernel( size_t M, size_t N, size_t K, T alpha,
+                                               const T* A, size_t ars, size_t acs,
+                                               const T* B, size_t brs, size_t bcs,
+                                               T* C, size_t ldc )
+{
+   using V = typename DispatchVector<T,Bytes>::Type;
+   using U = typename DispatchVector<T,Bytes>::UnalignedType;
+
+   constexpr size_t SIMDSIZE( Bytes / sizeof(T) );
+   constexpr size_t MR ( MMM_MICROKERNEL_ROWS );
+   constexpr size_t NRV( MMM_MICROKERNEL_SIMD_COLUMNS );
+   constexpr size_t NR ( NRV * SIMDSIZE );
+
+   const MMMBlocking blocking( getMMMBlocking( sizeof(T), MR, NR ) );
+
+   const size_t MC( blocking.mc );
+   const size_t KC( blocking.kc );
+   const size_t NC( blocking.nc );
+
+   if( M == 0UL || N == 0UL || K == 0UL )
+      return;
+
+   const size_t kcmax( min( KC, K ) );
+   const size_t mcmax( min( MC, M + ( MR - M % MR ) % MR ) );
+   const size_t ncmax( min( NC, N + ( NR - N % NR ) % NR ) );
+
+   const std::unique_ptr<T[],Deallocate> abuffer(
+      reinterpret_cast<T*>( allocate_backend( mcmax*kcmax*sizeof(T), Bytes ) ) );
+   const std::unique_ptr<T[],Deallocate> bbuffer(
+      reinterpret_cast<T*>( allocate_backend( kcmax*ncmax*sizeof(T), Bytes ) ) );
+
+   for( size_t jj=0UL; jj<N; jj+=NC )
+   {
+      const size_t nc( min( NC, N-jj ) );
+
+      for( size_t kk=0UL; kk<K; kk+=KC )
+      {
+         const size_t kc( min( KC, K-kk ) );
+
+         // Packing of the kc x nc block of B into micro-panels of NR columns
+         T* bp( bbuffer.get() );
+         for( size_t v=0UL; v<nc; v+=NR, bp+=NR*kc ) {
+            const size_t nr( min( NR, nc-v ) );
+            for( size_t k=0UL; k<kc; ++k ) {
+               const T* b( B + (kk+k)*brs + (jj+v)*bcs );
+               for( size_t l=0UL; l<nr; ++l )
+                  bp[k*NR+l] = b[l*bcs];
+               for( size_t l=nr; l<NR; ++l )
+                  bp[k*NR+l] = T();
+            }
+         }
+
+         for( size_t ii=0UL; ii<M; ii+=MC )
+         {
+            const size_t mc( min( MC, M-ii ) );
+
+            // Packing of the mc x kc block of A into micro-panels of MR rows
+            T* ap( abuffer.get() );
+            for( size_t w=0UL; w<mc; w+=MR, ap+=MR*kc ) {
+               const size_t mr( min( MR, mc-w ) );
+               for( size_t r=0UL; r<mr; ++r ) {
+                  const T* a( A + (ii+w+r)*ars + kk*acs );
+                  for( size_t k=0UL; k<kc; ++k )
+                     ap[k*MR+r] = a[k*acs] * alpha;
+               }
+               for( size_t r=mr; r<MR; ++r ) {
+                  for( size_t k=0UL; k<kc; ++k )
+                     ap[k*MR+r] = T();
+               }
+            }
+
+            for( size_t v=0UL; v<nc; v+=NR )
+            {
+               const size_t nr( min( NR, nc-v ) );
+
+               for( size_t w=0UL; w<mc; w+=MR )
+               {
+                  const size_t mr( min( MR, mc-w ) );
+                  const T* xp( abuffer.get() + w*kc );
+                  const T* yp( bbuffer.get() + v*kc );
+
+                  V xmm[MR][NRV] = {};
+
+                  for( size_t k=0UL; k<kc; ++k, xp+=MR, yp+=NR )
+                  {
+                     V b[NRV];
+#pragma GCC unroll 16
+                     for( size_t c=0UL; c<NRV; ++c ) {
+                        b[c] = dispatchAccess<const U>( yp+c*SIMDSIZE );
+                     }
+#pragma GCC unroll 16
+                     for( size_t r=0UL; r<MR; ++r ) {
+                        const V a( xp[r] - V{} );
+#pragma GCC unroll 16
+                        for( size_t c=0UL; c<NRV; ++c ) {
+                           xmm[r][c] += a * b[c];
+                        }
+                     }
+                  }
+
+                  T* c( C + (ii+w)*ldc + jj+v );
+
+                  if( mr == MR && nr == NR ) {
+                     for( size_t r=0UL; r<MR; ++r ) {
+                        for( size_t l=0UL; l<NRV; ++l ) {
+                           dispatchAccess<U>( c+r*ldc+l*SIMDSIZE ) += xmm[r][l];
+                        }
+                     }
+                  }
+                  else {
+                     for( size_t r=0UL; r<mr; ++r ) {
+                        T tmp[NR];
+                        for( size_t l=0UL; l<NRV; ++l ) {
+                           dispatchAccess<U>( tmp+l*SIMDSIZE ) = xmm[r][l];
+                        }
+                        for( size_t l=0UL; l<nr; ++l ) {
+                           c[r*ldc+l] += tmp[l];
+                        }
+                     }
+                  }
+               }
+            }
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Generic kernel for the row-major dense matrix/dense vector multiplication
+//        (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup dense_matrix
+//
+// \param M The number of rows of \a A.
+// \param N The number of columns of \a A.
+// \param A Pointer to the first element of the row-major matrix \a A.
+// \param lda The distance between two consecutive rows of \a A.
+// \param x Pointer to the first element of \a x.
+// \param y Pointer to the first element of \a y.
+// \return void
+*/
+template< typename T       // Element type
+        , size_t Bytes >  // Width of the SIMD vectors in bytes
+BLAZE_ALWAYS_INLINE void dispatchedGemvRowKernel( size_t M, size_t N, const T* A, size_t lda,
+                                                  const T* x, T* y )
+{
+   using V = typename DispatchVector<T,Bytes>::Type;
+   using U = typename DispatchVector<T,Bytes>::UnalignedType;
+
+   constexpr size_t SIMDSIZE( Bytes / sizeof(T) );
+
+   const size_t jpos( N - N % SIMDSIZE );
+   size_t i( 0UL );
+
+   for( ; (i+4UL) <= M; i+=4UL )
+   {
+      const T* a( A + i*lda );
+      V xmm1{}, xmm2{}, xmm3{}, xmm4{}, xmm5{}, xmm6{}, xmm7{}, xmm8{};
+      size_t j( 0UL );
+
+      for( ; (j+SIMDSIZE) < jpos; j+=SIMDSIZE*2UL ) {
+         const V x1( dispatchAccess<const U>( x+j          ) );
+         const V x2( dispatchAccess<const U>( x+j+SIMDSIZE ) );
+         xmm1 += dispatchAccess<const U>( a      +j          ) * x1;
+         xmm2 += dispatchAccess<const U>( a+lda  +j          ) * x1;
+         xmm3 += dispatchAccess<const U>( a+lda*2+j          ) * x1;
+         xmm4 += dispatchAccess<const U>( a+lda*3+j          ) * x1;
+         xmm5 += dispatchAccess<const U>( a      +j+SIMDSIZE ) * x2;
+         xmm6 += dispatchAccess<const U>( a+lda  +j+SIMDSIZE ) * x2;
+         xmm7 += dispatchAccess<const U>( a+lda*2+j+SIMDSIZE ) * x2;
+         xmm8 += dispatchAccess<const U>( a+lda*3+j+SIMDSIZE ) * x2;
+      }
+      for( ; j<jpos; j+=SIMDSIZE ) {
+         const V x1( dispatchAccess<const U>( x+j ) );
+         xmm1 += dispatchAccess<const U>( a      +j ) * x1;
+         xmm2 += dispatchAccess<const U>( a+lda  +j ) * x1;
+         xmm3 += dispatchAccess<const U>( a+lda*2+j ) * x1;
+         xmm4 += dispatchAccess<const U>( a+lda*3+j ) * x1;
+      }
+
+      T y1( dispatchReduce<T>( xmm1 + xmm5 ) );
+      T y2( dispatchReduce<T>( xmm2 + xmm6 ) );
+      T y3( dispatchReduce<T>( xmm3 + xmm7 ) );
+      T y4( dispatchReduce<T>( xmm4 + xmm8 ) );
+
+      for( ; j<N; ++j ) {
+         y1 += a[      j] * x[j];
+         y2 += a[lda  +j] * x[j];
+         y3 += a[lda*2+j] * x[j];
+         y4 += a[lda*3+j] * x[j];
+      }
+
+      y[i    ] = y1;
+      y[i+1UL] = y2;
+      y[i+2UL] = y3;
+      y[i+3UL] = y4;
+   }
+
+   for( ; i<M; ++i )
+   {
+      const T* a( A + i*lda );
+      V xmm1{};
+      size_t j( 0UL );
+
+      for( ; j<jpos; j+=SIMDSIZE ) {
+         xmm1 += dispatchAccess<const U>( a+j ) * dispatchAccess<const U>( x+j );
+      }
+
+      T y1( dispatchReduce<T>( xmm1 ) );
+
+      for( ; j<N; ++j ) {
+         y1 += a[j] * x[j];
+      }
+
+      y[i] = y1;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Generic kernel for the column-major dense matrix/dense vector multiplication
+//        (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup dense_matrix
+//
+// \param M The number of rows of \a A.
+// \param N The number of columns of \a A.
+// \param A Pointer to the first element of the column-major matrix \a A.
+// \param lda The distance between two consecutive columns of \a A.
+// \param x Pointer to the first element of \a x.
+// \param y Pointer to the first element of \a y.
+// \return void
+*/
+template< typename T       // Element type
+        , size_t Bytes >  // Width of the SIMD vectors in bytes
+BLAZE_ALWAYS_INLINE void dispatchedGemvColumnKernel( size_t M, size_t N, const T* A, size_t lda,
+                                                     const T* x, T* y )
+{
+   using V = typename DispatchVector<T,Bytes>::Type;
+   using U = typename DispatchVector<T,Bytes>::UnalignedType;
+
+   constexpr size_t SIMDSIZE( Bytes / sizeof(T) );
+
+   const size_t ipos( M - M % SIMDSIZE );
+   size_t i( 0UL );
+
+   for( ; (i+SIMDSIZE*3UL) < ipos; i+=SIMDSIZE*4UL )
+   {
+      V xmm1{}, xmm2{}, xmm3{}, xmm4{};
+
+      for( size_t j=0UL; j<N; ++j ) {
+         const T* a( A + j*lda + i );
+         const V x1( x[j] - V{} );
+         xmm1 += dispatchAccess<const U>( a              ) * x1;
+         xmm2 += dispatchAccess<const U>( a+SIMDSIZE     ) * x1;
+         xmm3 += dispatchAccess<const U>( a+SIMDSIZE*2UL ) * x1;
+         xmm4 += dispatchAccess<const U>( a+SIMDSIZE*3UL ) * x1;
+      }
+
+      dispatchAccess<U>( y+i             ) = xmm1;
+      dispatchAccess<U>( y+i+SIMDSIZE     ) = xmm2;
+      dispatchAccess<U>( y+i+SIMDSIZE*2UL ) = xmm3;
+      dispatchAccess<U>( y+i+SIMDSIZE*3UL ) = xmm4;
+   }
+
+   for( ; i<ipos; i+=SIMDSIZE )
+   {
+      V xmm1{};
+
+      for( size_t j=0UL; j<N; ++j ) {
+         xmm1 += dispatchAccess<const U>( A + j*lda + i ) * ( x[j] - V{} );
+      }
+
+      dispatchAccess<U>( y+i ) = xmm1;
+   }
+
+   for( ; i<M; ++i )
+   {
+      T y1{};
+
+      for( size_t j=0UL; j<N; ++j ) {
+         y1 += A[j*lda+i] * x[j];
+      }
+
+      y[i] = y1;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Generic kernel for the dense vector inner product (\f$ s=\vec{a}*\vec{b} \f$).
+// \ingroup dense_matrix
+//
+// \param N The size of the two vectors.
+// \param a Pointer to the first element of \a a.
+// \param b Pointer to the first element of \a b.
+// \return The inner product of the two vectors.
+*/
+template< typename T       // Element type
+        , size_t Bytes >  // Width of the SIMD vectors in bytes
+BLAZE_ALWAYS_INLINE T dispatchedDotKernel( size_t N, const T* a, const T* b )
+{
+   using V = typename DispatchVector<T,Bytes>::Type;
+   using U = typename DispatchVector<T,Bytes>::UnalignedType;
+
+   constexpr size_t SIMDSIZE( Bytes / sizeof(T) );
+
+   const size_t ipos( N - N % SIMDSIZE );
+
+   V xmm1{}, xmm2{}, xmm3{}, xmm4{};
+   size_t i( 0UL );
+
+   for( ; (i+SIMDSIZE*3UL) < ipos; i+=SIMDSIZE*4UL ) {
+      xmm1 += dispatchAccess<const U>( a+i              ) * dispatchAccess<const U>( b+i              );
+      xmm2 += dispatchAccess<const U>( a+i+SIMDSIZE     ) * dispatchAccess<const U>( b+i+SIMDSIZE     );
+      xmm3 += dispatchAccess<const U>( a+i+SIMDSIZE*2UL ) * dispatchAccess<const U>( b+i+SIMDSIZE*2UL );
+      xmm4 += dispatchAccess<const U>( a+i+SIMDSIZE*3UL ) * dispatchAccess<const U>( b+i+SIMDSIZE*3UL );
+   }
+   for( ; i<ipos; i+=SIMDSIZE ) {
+      xmm1 += dispatchAccess<const U>( a+i ) * dispatchAccess<const U>( b+i );
+   }
+
+   T sp( dispatchReduce<T>( ( xmm1 + xmm2 ) + ( xmm3 + xmm4 ) ) );
+
+   for( ; i<N; ++i ) {
+      sp += a[i] * b[i];
+   }
+
+   return sp;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Generic kernel for the dense vector summation.
+// \ingroup dense_matrix
+//
+// \param N The size of the vector.
+// \param a Pointer to the first element of \a a.
+// \return The sum of all vector elements.
+*/
+template< typename T       // Element type
+        , size_t Bytes >  // Width of the SIMD vectors in bytes
+BLAZE_ALWAYS_INLINE T dispatchedSumKernel( size_t N, const T* a )
+{
+   using V = typename DispatchVector<T,Bytes>::Type;
+   using U = typename DispatchVector<T,Bytes>::UnalignedType;
+
+   constexpr size_t SIMDSIZE( Bytes / sizeof(T) );
+
+   const size_t ipos( N - N % SIMDSIZE );
+
+   V xmm1{}, xmm2{}, xmm3{}, xmm4{};
+   size_t i( 0UL );
+
+   for( ; (i+SIMDSIZE*3UL) < ipos; i+=SIMDSIZE*4UL ) {
+      xmm1 += dispatchAccess<const U>( a+i              );
+      xmm2 += dispatchAccess<const U>( a+i+SIMDSIZE     );
+      xmm3 += dispatchAccess<const U>( a+i+SIMDSIZE*2UL );
+      xmm4 += dispatchAccess<const U>( a+i+SIMDSIZE*3UL );
+   }
+   for( ; i<ipos; i+=SIMDSIZE ) {
+      xmm1 += dispatchAccess<const U>( a+i );
+   }
+
+   T s( dispatchReduce<T>( ( xmm1 + xmm2 ) + ( xmm3 + xmm4 ) ) );
+
+   for( ; i<N; ++i ) {
+      s += a[i];
+   }
+
+   return s;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TARGET SPECIFIC KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Instantiation of the generic kernels for a specific instruction set.
+// \ingroup dense_matrix
+//
+// The DispatchedKernels class template instantiates the generic kernels for the instruction set
+// represented by the given SIMD level. All member functions are compiled for the according
+// instruction set and must only be called in case the executing CPU supports it.
+*/
+template< SIMDLevel L >  // SIMD level
+struct DispatchedKernels;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the DispatchedKernels class template for AVX.
+// \ingroup dense_matrix
+*/
+template<>
+struct DispatchedKernels<simdAVX>
+{
+   template< typename T >
+   BLAZE_DISPATCH_TARGET_AVX static void gemm( size_t M, size_t N, size_t K, T alpha,
+                                               const T* A, size_t ars, size_t acs,
+                                               const T* B, size_t brs, size_t bcs, T* C, size_t ldc )
+   {
+      dispatchedGemmKernel<T,32UL>( M, N, K, alpha, A, ars, acs, B, brs, bcs, C, ldc );
+   }
+
+   template< typename T >
+   BLAZE_DISPATCH_TARGET_AVX static void gemvRow( size_t M, size_t N, const T* A, size_t lda, const T* x, T* y )
+   {
+      dispatchedGemvRowKernel<T,32UL>( M, N, A, lda, x, y );
+   }
+
+   template< typename T >
+   BLAZE_DISPATCH_TARGET_AVX static void gemvColumn( size_t M, size_t N, const T* A, size_t lda, const T* x, T* y )
+   {
+      dispatchedGemvColumnKernel<T,32UL>( M, N, A, lda, x, y );
+   }
+
+   template< typename T >
+   BLAZE_DISPATCH_TARGET_AVX static T dot( size_t N, const T* a, const T* b )
+   {
+      return dispatchedDotKernel<T,32UL>( N, a, b );
+   }
+
+   template< typename T >
+   BLAZE_DISPATCH_TARGET_AVX static T sum( size_t N, const T* a )
+   {
+      return dispatchedSumKernel<T,32UL>( N, a );
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the DispatchedKernels class template for AVX2 and FMA.
+// \ingroup dense_matrix
+*/
+template<>
+struct DispatchedKernels<simdAVX2>
+{
+   template< typename T >
+   BLAZE_DISPATCH_TARGET_AVX2 static void gemm( size_t M, size_t N, size_t K, T alpha,
+                                                const T* A, size_t ars, size_t acs,
+                                                const T* B, size_t brs, size_t bcs, T* C, size_t ldc )
+   {
+      dispatchedGemmKernel<T,32UL>( M, N, K, alpha, A, ars, acs, B, brs, bcs, C, ldc );
+   }
+
+   template< typename T >
+   BLAZE_DISPATCH_TARGET_AVX2 static void gemvRow( size_t M, size_t N, const T* A, size_t lda, const T* x, T* y )
+   {
+      dispatchedGemvRowKernel<T,32UL>( M, N, A, lda, x, y );
+   }
+
+   template< typename T >
+   BLAZE_DISPATCH_TARGET_AVX2 static void gemvColumn( size_t M, size_t N, const T* A, size_t lda, const T* x, T* y )
+   {
+      dispatchedGemvColumnKernel<T,32UL>( M, N, A, lda, x, y );
+   }
+
+   template< typename T >
+   BLAZE_DISPATCH_TARGET_AVX2 static T dot( size_t N, const T* a, const T* b )
+   {
+      return dispatchedDotKernel<T,32UL>( N, a, b );
+   }
+
+   template< typename T >
+   BLAZE_DISPATCH_TARGET_AVX2 static T sum( size_t N, const T* a )
+   {
+      return dispatchedSumKernel<T,32UL>( N, a );
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the DispatchedKernels class template for AVX-512.
+// \ingroup dense_matrix
+*/
+template<>
+struct DispatchedKernels<simdAVX512>
+{
+   template< typename T >
+   BLAZE_DISPATCH_TARGET_AVX512 static void gemm( size_t M, size_t N, size_t K, T alpha,
+                                                  const T* A, size_t ars, size_t acs,
+                                                  const T* B, size_t brs, size_t bcs, T* C, size_t ldc )
+   {
+      dispatchedGemmKernel<T,64UL>( M, N, K, alpha, A, ars, acs, B, brs, bcs, C, ldc );
+   }
+
+   template< typename T >
+   BLAZE_DISPATCH_TARGET_AVX512 static void gemvRow( size_t M, size_t N, const T* A, size_t lda, const T* x, T* y )
+   {
+      dispatchedGemvRowKernel<T,64UL>( M, N, A, lda, x, y );
+   }
+
+   template< typename T >
+   BLAZE_DISPATCH_TARGET_AVX512 static void gemvColumn( size_t M, size_t N, const T* A, size_t lda, const T* x, T* y )
+   {
+      dispatchedGemvColumnKernel<T,64UL>( M, N, A, lda, x, y );
+   }
+
+   template< typename T >
+   BLAZE_DISPATCH_TARGET_AVX512 static T dot( size_t N, const T* a, const T* b )
+   {
+      return dispatchedDotKernel<T,64UL>( N, a, b );
+   }
+
+   template< typename T >
+   BLAZE_DISPATCH_TARGET_AVX512 static T sum( size_t N, const T* a )
+   {
+      return dispatchedSumKernel<T,64UL>( N, a );
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+#endif
+
+
+
+
+//=================================================================================================
+//
+//  DISPATCH FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default dispatch of a dense matrix/dense matrix multiplication (\f$ C+=\alpha*A*B \f$).
+// \ingroup dense_matrix
+//
+// \param C The target dense matrix.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \return \a false, i.e. the multiplication has to be performed by the compile time kernels.
+*/
+template< typename MT1    // Type of the target matrix
+        , typename MT2    // Type of the left-hand side matrix operand
+        , typename MT3    // Type of the right-hand side matrix operand
+        , typename ST >   // Type of the scalar value
+inline auto dispatchedMmm( MT1& C, const MT2& A, const MT3& B, ST alpha )
+   -> DisableIf_t< AreDispatchable_v<MT1,MT2,MT3> && HasMutableDataAccess_v<MT1>, bool >
+{
+   MAYBE_UNUSED( C, A, B, alpha );
+
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default dispatch of a dense matrix/dense vector multiplication (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup dense_matrix
+//
+// \param y The target dense vector.
+// \param A The dense matrix operand.
+// \param x The dense vector operand.
+// \return \a false, i.e. the multiplication has to be performed by the compile time kernels.
+*/
+template< typename VT1    // Type of the target vector
+        , typename MT     // Type of the matrix operand
+        , typename VT2 >  // Type of the vector operand
+inline auto dispatchedGemv( VT1& y, const MT& A, const VT2& x )
+   -> DisableIf_t< AreDispatchable_v<VT1,MT,VT2> && HasMutableDataAccess_v<VT1>, bool >
+{
+   MAYBE_UNUSED( y, A, x );
+
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default dispatch of a dense vector inner product (\f$ s=\vec{a}*\vec{b} \f$).
+// \ingroup dense_vector
+//
+// \param a The left-hand side dense vector.
+// \param b The right-hand side dense vector.
+// \param result Reference to the result.
+// \return \a false, i.e. the inner product has to be computed by the compile time kernels.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename VT2    // Type of the right-hand side dense vector
+        , typename T >    // Type of the result
+inline auto dispatchedDot( const VT1& a, const VT2& b, T& result )
+   -> DisableIf_t< AreDispatchable_v<VT1,VT2> && IsSame_v< T, ElementType_t<VT1> >, bool >
+{
+   MAYBE_UNUSED( a, b, result );
+
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default dispatch of a dense vector summation.
+// \ingroup dense_vector
+//
+// \param a The dense vector.
+// \param result Reference to the result.
+// \return \a false, i.e. the summation has to be computed by the compile time kernels.
+*/
+template< typename VT  // Type of the dense vector
+        , typename T >  // Type of the result
+inline auto dispatchedSum( const VT& a, T& result )
+   -> DisableIf_t< IsDispatchable_v<VT> && IsSame_v< T, ElementType_t<VT> >, bool >
+{
+   MAYBE_UNUSED( a, result );
+
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+#if BLAZE_CPU_DISPATCH_MODE
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Runtime dispatch of a dense matrix/dense matrix multiplication (\f$ C+=\alpha*A*B \f$).
+// \ingroup dense_matrix
+//
+// \param C The target dense matrix.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \return \a true in case the multiplication has been performed, \a false if not.
+//
+// This function performs the multiplication by means of the kernel for the currently active
+// SIMD level (see getSIMDLevel()) in case this level exceeds the SIMD level selected at compile
+// time. Otherwise it returns \a false and the multiplication has to be performed by the compile
+// time kernels. All storage order combinations of the three matrices are supported.
+*/
+template< typename MT1    // Type of the target matrix
+        , typename MT2    // Type of the left-hand side matrix operand
+        , typename MT3    // Type of the right-hand side matrix operand
+        , typename ST >   // Type of the scalar value
+inline auto dispatchedMmm( MT1& C, const MT2& A, const MT3& B, ST alpha )
+   -> EnableIf_t< AreDispatchable_v<MT1,MT2,MT3> && HasMutableDataAccess_v<MT1>, bool >
+{
+   using ET = ElementType_t<MT1>;
+
+   const SIMDLevel level( getSIMDLevel() );
+
+   if( level <= compiledSIMDLevel )
+      return false;
+
+   // Row and column distances of A and B
+   const size_t ars( IsRowMajorMatrix_v<MT2> ? A.spacing() : 1UL );
+   const size_t acs( IsRowMajorMatrix_v<MT2> ? 1UL : A.spacing() );
+   const size_t brs( IsRowMajorMatrix_v<MT3> ? B.spacing() : 1UL );
+   const size_t bcs( IsRowMajorMatrix_v<MT3> ? 1UL : B.spacing() );
+
+   // Column-major targets are computed as C^T += alpha * B^T * A^T
+   const bool rm( IsRowMajorMatrix_v<MT1> );
+
+   const size_t M( rm ? C.rows() : C.columns() );
+   const size_t N( rm ? C.columns() : C.rows() );
+   const size_t K( A.columns() );
+
+   const ET* const X( rm ? A.data() : B.data() );
+   const ET* const Y( rm ? B.data() : A.data() );
+
+   const size_t xrs( rm ? ars : bcs );
+   const size_t xcs( rm ? acs : brs );
+   const size_t yrs( rm ? brs : acs );
+   const size_t ycs( rm ? bcs : ars );
+
+   switch( level ) {
+      case simdAVX512:
+         DispatchedKernels<simdAVX512>::gemm<ET>( M, N, K, ET( alpha ), X, xrs, xcs, Y, yrs, ycs, C.data(), C.spacing() );
+         return true;
+      case simdAVX2:
+         DispatchedKernels<simdAVX2>::gemm<ET>( M, N, K, ET( alpha ), X, xrs, xcs, Y, yrs, ycs, C.data(), C.spacing() );
+         return true;
+      case simdAVX:
+         DispatchedKernels<simdAVX>::gemm<ET>( M, N, K, ET( alpha ), X, xrs, xcs, Y, yrs, ycs, C.data(), C.spacing() );
+         return true;
+      default:
+         return false;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Runtime dispatch of a dense matrix/dense vector multiplication (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup dense_matrix
+//
+// \param y The target dense vector.
+// \param A The dense matrix operand.
+// \param x The dense vector operand.
+// \return \a true in case the multiplication has been performed, \a false if not.
+//
+// This function performs the multiplication by means of the kernel for the currently active
+// SIMD level (see getSIMDLevel()) in case this level exceeds the SIMD level selected at compile
+// time. Otherwise it returns \a false and the multiplication has to be performed by the compile
+// time kernels.
+*/
+template< typename VT1    // Type of the target vector
+        , typename MT     // Type of the matrix operand
+        , typename VT2 >  // Type of the vector operand
+inline auto dispatchedGemv( VT1& y, const MT& A, const VT2& x )
+   -> EnableIf_t< AreDispatchable_v<VT1,MT,VT2> && HasMutableDataAccess_v<VT1>, bool >
+{
+   using ET = ElementType_t<VT1>;
+
+   const SIMDLevel level( getSIMDLevel() );
+
+   if( level <= compiledSIMDLevel )
+      return false;
+
+   const size_t M( A.rows() );
+   const size_t N( A.columns() );
+
+   if( IsRowMajorMatrix_v<MT> ) {
+      switch( level ) {
+         case simdAVX512: DispatchedKernels<simdAVX512>::gemvRow<ET>( M, N, A.data(), A.spacing(), x.data(), y.data() ); return true;
+         case simdAVX2  : DispatchedKernels<simdAVX2  >::gemvRow<ET>( M, N, A.data(), A.spacing(), x.data(), y.data() ); return true;
+         case simdAVX   : DispatchedKernels<simdAVX   >::gemvRow<ET>( M, N, A.data(), A.spacing(), x.data(), y.data() ); return true;
+         default        : return false;
+      }
+   }
+   else {
+      switch( level ) {
+         case simdAVX512: DispatchedKernels<simdAVX512>::gemvColumn<ET>( M, N, A.data(), A.spacing(), x.data(), y.data() ); return true;
+         case simdAVX2  : DispatchedKernels<simdAVX2  >::gemvColumn<ET>( M, N, A.data(), A.spacing(), x.data(), y.data() ); return true;
+         case simdAVX   : DispatchedKernels<simdAVX   >::gemvColumn<ET>( M, N, A.data(), A.spacing(), x.data(), y.data() ); return true;
+         default        : return false;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Runtime dispatch of a dense vector inner product (\f$ s=\vec{a}*\vec{b} \f$).
+// \ingroup dense_vector
+//
+// \param a The left-hand side dense vector.
+// \param b The right-hand side dense vector.
+// \param result Reference to the result.
+// \return \a true in case the inner product has been computed, \a false if not.
+//
+// This function computes the inner product by means of the kernel for the currently active
+// SIMD level (see getSIMDLevel()) in case this level exceeds the SIMD level selected at compile
+// time. Otherwise it returns \a false and the inner product has to be computed by the compile
+// time kernels.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename VT2    // Type of the right-hand side dense vector
+        , typename T >    // Type of the result
+inline auto dispatchedDot( const VT1& a, const VT2& b, T& result )
+   -> EnableIf_t< AreDispatchable_v<VT1,VT2> && IsSame_v< T, ElementType_t<VT1> >, bool >
+{
+   switch( getSIMDLevel() > compiledSIMDLevel ? getSIMDLevel() : noSIMD ) {
+      case simdAVX512: result = DispatchedKernels<simdAVX512>::dot<T>( a.size(), a.data(), b.data() ); return true;
+      case simdAVX2  : result = DispatchedKernels<simdAVX2  >::dot<T>( a.size(), a.data(), b.data() ); return true;
+      case simdAVX   : result = DispatchedKernels<simdAVX   >::dot<T>( a.size(), a.data(), b.data() ); return true;
+      default        : return false;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Runtime dispatch of a dense vector summation.
+// \ingroup dense_vector
+//
+// \param a The dense vector.
+// \param result Reference to the result.
+// \return \a true in case the sum has been computed, \a false if not.
+//
+// This function computes the sum of all elements of the given dense vector by means of the
+// kernel for the currently active SIMD level (see getSIMDLevel()) in case this level exceeds
+// the SIMD level selected at compile time. Otherwise it returns \a false and the sum has to
+// be computed by the compile time kernels.
+*/
+template< typename VT  // Type of the dense vector
+        , typename T >  // Type of the result
+inline auto dispatchedSum( const VT& a, T& result )
+   -> EnableIf_t< IsDispatchable_v<VT> && IsSame_v< T, ElementType_t<VT> >, bool >
+{
+   switch( getSIMDLevel() > compiledSIMDLevel ? getSIMDLevel() : noSIMD ) {
+      case simdAVX512: result = DispatchedKernels<simdAVX512>::sum<T>( a.size(), a.data() ); return true;
+      case simdAVX2  : result = DispatchedKernels<simdAVX2  >::sum<T>( a.size(), a.data() ); return true;
+      case simdAVX   : result = DispatchedKernels<simdAVX   >::sum<T>( a.size(), a.data() ); return true;
+      default        : return false;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+#endif
+
+} // namespace blaze
+
+#endif
@@ -58,6 +58,7 @@
 #include <blaze/math/shims/NextMultiple.h>
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/SIMD.h>
+#include <blaze/math/smp/FirstTouch.h>
 #include <blaze/math/traits/AddTrait.h>
 #include <blaze/math/traits/ColumnsTrait.h>
 #include <blaze/math/traits/DivTrait.h>
@@ -577,6 +578,8 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix( size_t m, size_t n )
    , capacity_( m_*nn_ )                       // The maximum capacity of the matrix
    , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
 {
+   smpFirstTouch<SO>( v_, m_, nn_ );
+
    if( IsVectorizable_v<Type> ) {
       for( size_t i=0UL; i<m_; ++i ) {
          for( size_t j=n_; j<nn_; ++j ) {
@@ -1695,6 +1698,7 @@ void DynamicMatrix<Type,SO>::resize( size_t m, size_t n, bool preserve )
    if( preserve )
    {
       Type* BLAZE_RESTRICT v = allocate<Type>( m*nn );
+      smpFirstTouch<SO>( v, m, nn );
       const size_t min_m( min( m, m_ ) );
       const size_t min_n( min( n, n_ ) );
 
@@ -1708,6 +1712,7 @@ void DynamicMatrix<Type,SO>::resize( size_t m, size_t n, bool preserve )
    }
    else if( m*nn > capacity_ ) {
       Type* BLAZE_RESTRICT v = allocate<Type>( m*nn );
+      smpFirstTouch<SO>( v, m, nn );
       swap( v_, v );
       deallocate( v );
       capacity_ = m*nn;
@@ -1768,6 +1773,7 @@ inline void DynamicMatrix<Type,SO>::reserve( size_t elements )
    {
       // Allocating a new array
       Type* BLAZE_RESTRICT tmp = allocate<Type>( elements );
+      smpFirstTouch( tmp, elements );
 
       // Initializing the new array
       transfer( v_, v_+capacity_, tmp );
@@ -1867,7 +1873,7 @@ inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::transpose()
 {
    using std::swap;
 
-   constexpr size_t block( BLOCK_SIZE );
+   const size_t block( BLOCK_SIZE );
 
    if( m_ == n_ )
    {
@@ -1903,7 +1909,7 @@ template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
 inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::ctranspose()
 {
-   constexpr size_t block( BLOCK_SIZE );
+   const size_t block( BLOCK_SIZE );
 
    if( m_ == n_ )
    {
@@ -2449,7 +2455,7 @@ inline void DynamicMatrix<Type,SO>::assign( const DenseMatrix<MT,!SO>& rhs )
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
 
-   constexpr size_t block( BLOCK_SIZE );
+   const size_t block( BLOCK_SIZE );
 
    for( size_t ii=0UL; ii<m_; ii+=block ) {
       const size_t iend( min( m_, ii+block ) );
@@ -2651,7 +2657,7 @@ inline void DynamicMatrix<Type,SO>::addAssign( const DenseMatrix<MT,!SO>& rhs )
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
 
-   constexpr size_t block( BLOCK_SIZE );
+   const size_t block( BLOCK_SIZE );
 
    for( size_t ii=0UL; ii<m_; ii+=block ) {
       const size_t iend( min( m_, ii+block ) );
@@ -2865,7 +2871,7 @@ inline void DynamicMatrix<Type,SO>::subAssign( const DenseMatrix<MT,!SO>& rhs )
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
 
-   constexpr size_t block( BLOCK_SIZE );
+   const size_t block( BLOCK_SIZE );
 
    for( size_t ii=0UL; ii<m_; ii+=block ) {
       const size_t iend( min( m_, ii+block ) );
@@ -3055,7 +3061,7 @@ inline void DynamicMatrix<Type,SO>::schurAssign( const DenseMatrix<MT,!SO>& rhs
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
 
-   constexpr size_t block( BLOCK_SIZE );
+   const size_t block( BLOCK_SIZE );
 
    for( size_t ii=0UL; ii<m_; ii+=block ) {
       const size_t iend( min( m_, ii+block ) );
@@ -3518,6 +3524,8 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n )
    , capacity_( mm_*n_ )                       // The maximum capacity of the matrix
    , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
 {
+   smpFirstTouch<true>( v_, mm_, n_ );
+
    if( IsVectorizable_v<Type> ) {
       for( size_t j=0UL; j<n_; ++j ) {
          for( size_t i=m_; i<mm_; ++i ) {
@@ -4647,6 +4655,7 @@ void DynamicMatrix<Type,true>::resize( size_t m, size_t n, bool preserve )
    if( preserve )
    {
       Type* BLAZE_RESTRICT v = allocate<Type>( mm*n );
+      smpFirstTouch<true>( v, mm, n );
       const size_t min_m( min( m, m_ ) );
       const size_t min_n( min( n, n_ ) );
 
@@ -4660,6 +4669,7 @@ void DynamicMatrix<Type,true>::resize( size_t m, size_t n, bool preserve )
    }
    else if( mm*n > capacity_ ) {
       Type* BLAZE_RESTRICT v = allocate<Type>( mm*n );
+      smpFirstTouch<true>( v, mm, n );
       swap( v_, v );
       deallocate( v );
       capacity_ = mm*n;
@@ -4722,6 +4732,7 @@ inline void DynamicMatrix<Type,true>::reserve( size_t elements )
    {
       // Allocating a new array
       Type* BLAZE_RESTRICT tmp = allocate<Type>( elements );
+      smpFirstTouch( tmp, elements );
 
       // Initializing the new array
       transfer( v_, v_+capacity_, tmp );
@@ -4825,7 +4836,7 @@ inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::transpose()
 {
    using std::swap;
 
-   constexpr size_t block( BLOCK_SIZE );
+   const size_t block( BLOCK_SIZE );
 
    if( m_ == n_ )
    {
@@ -4862,7 +4873,7 @@ inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::transpose()
 template< typename Type >  // Data type of the matrix
 inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::ctranspose()
 {
-   constexpr size_t block( BLOCK_SIZE );
+   const size_t block( BLOCK_SIZE );
 
    if( m_ == n_ )
    {
@@ -5417,7 +5428,7 @@ inline void DynamicMatrix<Type,true>::assign( const DenseMatrix<MT,false>& rhs )
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
 
-   constexpr size_t block( BLOCK_SIZE );
+   const size_t block( BLOCK_SIZE );
 
    for( size_t jj=0UL; jj<n_; jj+=block ) {
       const size_t jend( min( n_, jj+block ) );
@@ -5624,7 +5635,7 @@ inline void DynamicMatrix<Type,true>::addAssign( const DenseMatrix<MT,false>& rh
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
 
-   constexpr size_t block( BLOCK_SIZE );
+   const size_t block( BLOCK_SIZE );
 
    for( size_t jj=0UL; jj<n_; jj+=block ) {
       const size_t jend( min( n_, jj+block ) );
@@ -5843,7 +5854,7 @@ inline void DynamicMatrix<Type,true>::subAssign( const DenseMatrix<MT,false>& rh
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
 
-   constexpr size_t block( BLOCK_SIZE );
+   const size_t block( BLOCK_SIZE );
 
    for( size_t jj=0UL; jj<n_; jj+=block ) {
       const size_t jend( min( n_, jj+block ) );
@@ -6038,7 +6049,7 @@ inline void DynamicMatrix<Type,true>::schurAssign( const DenseMatrix<MT,false>&
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
 
-   constexpr size_t block( BLOCK_SIZE );
+   const size_t block( BLOCK_SIZE );
 
    for( size_t jj=0UL; jj<n_; jj+=block ) {
       const size_t jend( min( n_, jj+block ) );
@@ -58,6 +58,7 @@
 #include <blaze/math/shims/NextMultiple.h>
 #include <blaze/math/shims/Serial.h>
 #include <blaze/math/SIMD.h>
+#include <blaze/math/smp/FirstTouch.h>
 #include <blaze/math/traits/AddTrait.h>
 #include <blaze/math/traits/BandTrait.h>
 #include <blaze/math/traits/ColumnTrait.h>
@@ -542,6 +543,8 @@ inline DynamicVector<Type,TF>::DynamicVector( size_t n )
    , capacity_( addPadding( n ) )              // The maximum capacity of the vector
    , v_       ( allocate<Type>( capacity_ ) )  // The vector elements
 {
+   smpFirstTouch( v_, capacity_ );
+
    if( IsVectorizable_v<Type> ) {
       for( size_t i=size_; i<capacity_; ++i )
          v_[i] = Type();
@@ -1457,6 +1460,7 @@ inline void DynamicVector<Type,TF>::resize( size_t n, bool preserve )
       // Allocating a new array
       const size_t newCapacity( addPadding( n ) );
       Type* BLAZE_RESTRICT tmp = allocate<Type>( newCapacity );
+      smpFirstTouch( tmp, newCapacity );
 
       // Initializing the new array
       if( preserve ) {
@@ -1525,6 +1529,7 @@ inline void DynamicVector<Type,TF>::reserve( size_t n )
       // Allocating a new array
       const size_t newCapacity( addPadding( n ) );
       Type* BLAZE_RESTRICT tmp = allocate<Type>( newCapacity );
+      smpFirstTouch( tmp, newCapacity );
 
       // Initializing the new array
       transfer( v_, v_+size_, tmp );
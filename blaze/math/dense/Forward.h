@@ -51,12 +51,14 @@ namespace blaze {
 //
 //=================================================================================================
 
+template< typename, size_t, size_t > class BatchedMatrix;
 template< typename, bool, bool, bool, typename > class CustomMatrix;
 template< typename, bool, bool, bool, typename > class CustomVector;
 template< typename, bool > class DynamicVector;
 template< typename, bool > class DynamicMatrix;
 template< typename, size_t, size_t, bool > class HybridMatrix;
 template< typename, size_t, bool > class HybridVector;
+template< typename > class MappedMatrix;
 template< typename, size_t, size_t, bool > class StaticMatrix;
 template< typename, size_t, bool > class StaticVector;
 template< typename, bool > class UniformMatrix;
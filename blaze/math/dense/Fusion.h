@@ -0,0 +1,766 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/Fusion.h
+//  \brief Header file for the fused evaluation of dense vector and matrix assignments
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_DENSE_FUSION_H_
+#define _BLAZE_MATH_DENSE_FUSION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <utility>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/expressions/Vector.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/typetraits/IsDenseMatrix.h>
+#include <blaze/math/typetraits/IsDenseVector.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/typetraits/RequiresEvaluation.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/math/views/Subvector.h>
+#include <blaze/system/CacheSize.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsConst.h>
+#include <blaze/util/typetraits/RemoveCVRef.h>
+#include <blaze/util/typetraits/RemoveReference.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  AUXILIARY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the block of a vector that is processed in a single step of a fused evaluation.
+// \ingroup math
+//
+// \param vector The given vector.
+// \param begin The index of the first element of the block.
+// \param size The number of elements of the block.
+// \return View on the specified block of the vector.
+*/
+template< typename VT  // Type of the vector
+        , bool TF >    // Transpose flag
+inline decltype(auto) fusedBlock( Vector<VT,TF>& vector, size_t begin, size_t size, bool )
+{
+   return subvector( ~vector, begin, size, unchecked );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the block of a vector that is processed in a single step of a fused evaluation.
+// \ingroup math
+//
+// \param vector The given vector.
+// \param begin The index of the first element of the block.
+// \param size The number of elements of the block.
+// \return View on the specified block of the vector.
+*/
+template< typename VT  // Type of the vector
+        , bool TF >    // Transpose flag
+inline decltype(auto) fusedBlock( const Vector<VT,TF>& vector, size_t begin, size_t size, bool )
+{
+   return subvector( ~vector, begin, size, unchecked );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the block of a matrix that is processed in a single step of a fused evaluation.
+// \ingroup math
+//
+// \param matrix The given matrix.
+// \param begin The index of the first row/column of the block.
+// \param size The number of rows/columns of the block.
+// \param rowwise \a true in case the matrix is partitioned into row blocks, \a false if not.
+// \return View on the specified block of the matrix.
+*/
+template< typename MT  // Type of the matrix
+        , bool SO >    // Storage order
+inline decltype(auto) fusedBlock( Matrix<MT,SO>& matrix, size_t begin, size_t size, bool rowwise )
+{
+   if( rowwise )
+      return submatrix( ~matrix, begin, 0UL, size, (~matrix).columns(), unchecked );
+   else
+      return submatrix( ~matrix, 0UL, begin, (~matrix).rows(), size, unchecked );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the block of a matrix that is processed in a single step of a fused evaluation.
+// \ingroup math
+//
+// \param matrix The given matrix.
+// \param begin The index of the first row/column of the block.
+// \param size The number of rows/columns of the block.
+// \param rowwise \a true in case the matrix is partitioned into row blocks, \a false if not.
+// \return View on the specified block of the matrix.
+*/
+template< typename MT  // Type of the matrix
+        , bool SO >    // Storage order
+inline decltype(auto) fusedBlock( const Matrix<MT,SO>& matrix, size_t begin, size_t size, bool rowwise )
+{
+   if( rowwise )
+      return submatrix( ~matrix, begin, 0UL, size, (~matrix).columns(), unchecked );
+   else
+      return submatrix( ~matrix, 0UL, begin, (~matrix).rows(), size, unchecked );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the extent of a vector along the partitioned dimension of a fused evaluation.
+// \ingroup math
+//
+// \param vector The given vector.
+// \return The size of the vector.
+*/
+template< typename VT  // Type of the vector
+        , bool TF >    // Transpose flag
+inline size_t fusedExtent( const Vector<VT,TF>& vector, bool ) noexcept
+{
+   return (~vector).size();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the extent of a matrix along the partitioned dimension of a fused evaluation.
+// \ingroup math
+//
+// \param matrix The given matrix.
+// \param rowwise \a true in case the matrix is partitioned into row blocks, \a false if not.
+// \return The number of rows or columns of the matrix.
+*/
+template< typename MT  // Type of the matrix
+        , bool SO >    // Storage order
+inline size_t fusedExtent( const Matrix<MT,SO>& matrix, bool rowwise ) noexcept
+{
+   return ( rowwise ? (~matrix).rows() : (~matrix).columns() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of elements per row/column of a fused evaluation of a vector.
+// \ingroup math
+//
+// \return 1.
+*/
+template< typename VT  // Type of the vector
+        , bool TF >    // Transpose flag
+inline size_t fusedStride( const Vector<VT,TF>&, bool ) noexcept
+{
+   return 1UL;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of elements per row/column of a fused evaluation of a matrix.
+// \ingroup math
+//
+// \param matrix The given matrix.
+// \param rowwise \a true in case the matrix is partitioned into row blocks, \a false if not.
+// \return The number of columns or rows of the matrix.
+*/
+template< typename MT  // Type of the matrix
+        , bool SO >    // Storage order
+inline size_t fusedStride( const Matrix<MT,SO>& matrix, bool rowwise ) noexcept
+{
+   return ( rowwise ? (~matrix).columns() : (~matrix).rows() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether a fused evaluation of vectors is partitioned into row blocks.
+// \ingroup math
+//
+// \return \a true.
+*/
+template< typename VT  // Type of the vector
+        , bool TF >    // Transpose flag
+constexpr bool isFusedRowwise( const Vector<VT,TF>& ) noexcept
+{
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether a fused evaluation of matrices is partitioned into row blocks.
+// \ingroup math
+//
+// \return \a true for row-major matrices, \a false for column-major matrices.
+*/
+template< typename MT  // Type of the matrix
+        , bool SO >    // Storage order
+constexpr bool isFusedRowwise( const Matrix<MT,SO>& ) noexcept
+{
+   return ( SO == rowMajor );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Checks whether two vectors of a fused evaluation have the same size.
+// \ingroup math
+//
+// \param a The first vector.
+// \param b The second vector.
+// \return \a true if the sizes of the vectors match, \a false if not.
+*/
+template< typename VT1  // Type of the first vector
+        , bool TF1      // Transpose flag of the first vector
+        , typename VT2  // Type of the second vector
+        , bool TF2 >    // Transpose flag of the second vector
+inline bool isFusedShapeEqual( const Vector<VT1,TF1>& a, const Vector<VT2,TF2>& b ) noexcept
+{
+   return (~a).size() == (~b).size();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Checks whether two matrices of a fused evaluation have the same dimensions.
+// \ingroup math
+//
+// \param a The first matrix.
+// \param b The second matrix.
+// \return \a true if the dimensions of the matrices match, \a false if not.
+*/
+template< typename MT1  // Type of the first matrix
+        , bool SO1      // Storage order of the first matrix
+        , typename MT2  // Type of the second matrix
+        , bool SO2 >    // Storage order of the second matrix
+inline bool isFusedShapeEqual( const Matrix<MT1,SO1>& a, const Matrix<MT2,SO2>& b ) noexcept
+{
+   return (~a).rows() == (~b).rows() && (~a).columns() == (~b).columns();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Assignment operation of a fused statement.
+// \ingroup math
+*/
+struct FusedAssign
+{
+   template< typename T1, typename T2 >
+   static inline void apply( T1& lhs, const T2& rhs ) { lhs = rhs; }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Addition assignment operation of a fused statement.
+// \ingroup math
+*/
+struct FusedAddAssign
+{
+   template< typename T1, typename T2 >
+   static inline void apply( T1& lhs, const T2& rhs ) { lhs += rhs; }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Subtraction assignment operation of a fused statement.
+// \ingroup math
+*/
+struct FusedSubAssign
+{
+   template< typename T1, typename T2 >
+   static inline void apply( T1& lhs, const T2& rhs ) { lhs -= rhs; }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS TEMPLATE FUSEDSTATEMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Deferred (compound) assignment to a dense vector or dense matrix.
+// \ingroup math
+//
+// The FusedStatement class represents a single (compound) assignment of a vector or matrix
+// expression to a dense vector or dense matrix whose evaluation is deferred until it is passed
+// to the fuse() function. Instances of this class are created via the lazy() function and are
+// not meant to be used directly.
+*/
+template< typename LT    // Type of the target (reference or view)
+        , typename RT    // Type of the right-hand side operand
+        , typename OP >  // Type of the assignment operation
+class FusedStatement
+{
+ private:
+   //**Type definitions****************************************************************************
+   //! Composite type of the right-hand side operand.
+   using Operand = If_t< IsExpression_v<RT>, const RT, const RT& >;
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   using TargetType = RemoveReference_t<LT>;  //!< Type of the assigned dense vector/matrix.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for the evaluation of the right-hand side operand.
+   /*! In case the right-hand side operand requires an intermediate evaluation (as for instance
+       a matrix/vector multiplication), it cannot be evaluated block by block if it reads any
+       of the targets of the fused evaluation. */
+   static constexpr bool requiresEvaluation = RequiresEvaluation_v<RT>;
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the FusedStatement class.
+   //
+   // \param target The target dense vector or dense matrix.
+   // \param rhs The right-hand side operand.
+   */
+   inline FusedStatement( LT target, const RT& rhs )
+      : target_( std::forward<LT>( target ) )  // The target dense vector/matrix
+      , rhs_   ( rhs )                         // The right-hand side operand
+   {}
+   //**********************************************************************************************
+
+   //**Target function*****************************************************************************
+   /*!\brief Returns the target of the statement.
+   //
+   // \return The target dense vector or dense matrix.
+   */
+   inline const TargetType& target() const noexcept {
+      return target_;
+   }
+   //**********************************************************************************************
+
+   //**IsValid function****************************************************************************
+   /*!\brief Returns whether the sizes of the target and the right-hand side operand match.
+   //
+   // \return \a true in case the sizes match, \a false if not.
+   */
+   inline bool isValid() const noexcept {
+      return isFusedShapeEqual( target_, rhs_ );
+   }
+   //**********************************************************************************************
+
+   //**IsAliased function**************************************************************************
+   /*!\brief Returns whether the right-hand side operand is aliased with the given address.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case an alias effect is detected, \a false otherwise.
+   */
+   template< typename T >
+   inline bool isAliased( const T* alias ) const noexcept {
+      return rhs_.isAliased( alias );
+   }
+   //**********************************************************************************************
+
+   //**Apply function******************************************************************************
+   /*!\brief Evaluates the statement for a single block.
+   //
+   // \param begin The index of the first element/row/column of the block.
+   // \param size The number of elements/rows/columns of the block.
+   // \param rowwise \a true in case matrices are partitioned into row blocks, \a false if not.
+   // \return void
+   */
+   inline void apply( size_t begin, size_t size, bool rowwise ) {
+      auto       lhs( fusedBlock( target_, begin, size, rowwise ) );
+      const auto rhs( fusedBlock( rhs_   , begin, size, rowwise ) );
+      OP::apply( lhs, rhs );
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   LT      target_;  //!< The target dense vector/matrix.
+   Operand rhs_;     //!< The right-hand side operand.
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS TEMPLATE LAZYTARGET
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Wrapper for the target of a deferred (compound) assignment.
+// \ingroup math
+//
+// The LazyTarget class wraps a dense vector or dense matrix such that (compound) assignments
+// to it are not evaluated immediately, but result in a FusedStatement. Instances of this class
+// are created via the lazy() function and are not meant to be used directly.
+*/
+template< typename T >  // Type of the target (reference or view)
+class LazyTarget
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the LazyTarget class.
+   //
+   // \param target The target dense vector or dense matrix.
+   */
+   explicit inline LazyTarget( T target )
+      : target_( std::forward<T>( target ) )  // The target dense vector/matrix
+   {}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   template< typename VT, bool TF >
+   inline FusedStatement<T,VT,FusedAssign> operator=( const Vector<VT,TF>& rhs ) const {
+      return FusedStatement<T,VT,FusedAssign>( target_, ~rhs );
+   }
+
+   template< typename VT, bool TF >
+   inline FusedStatement<T,VT,FusedAddAssign> operator+=( const Vector<VT,TF>& rhs ) const {
+      return FusedStatement<T,VT,FusedAddAssign>( target_, ~rhs );
+   }
+
+   template< typename VT, bool TF >
+   inline FusedStatement<T,VT,FusedSubAssign> operator-=( const Vector<VT,TF>& rhs ) const {
+      return FusedStatement<T,VT,FusedSubAssign>( target_, ~rhs );
+   }
+
+   template< typename MT, bool SO >
+   inline FusedStatement<T,MT,FusedAssign> operator=( const Matrix<MT,SO>& rhs ) const {
+      return FusedStatement<T,MT,FusedAssign>( target_, ~rhs );
+   }
+
+   template< typename MT, bool SO >
+   inline FusedStatement<T,MT,FusedAddAssign> operator+=( const Matrix<MT,SO>& rhs ) const {
+      return FusedStatement<T,MT,FusedAddAssign>( target_, ~rhs );
+   }
+
+   template< typename MT, bool SO >
+   inline FusedStatement<T,MT,FusedSubAssign> operator-=( const Matrix<MT,SO>& rhs ) const {
+      return FusedStatement<T,MT,FusedSubAssign>( target_, ~rhs );
+   }
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   T target_;  //!< The target dense vector/matrix.
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  FUSION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Fusion functions */
+//@{
+template< typename T >
+auto lazy( T&& target )
+   -> EnableIf_t< ( IsDenseVector_v< RemoveCVRef_t<T> > || IsDenseMatrix_v< RemoveCVRef_t<T> > ) &&
+                  !IsConst_v< RemoveReference_t<T> >
+                , LazyTarget<T> >;
+
+template< typename ST, typename... STs >
+void fuse( ST&& statement, STs&&... statements );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Defers the (compound) assignment to the given dense vector or dense matrix.
+// \ingroup math
+//
+// \param target The target dense vector or dense matrix.
+// \return Wrapper for the deferred (compound) assignment to the target.
+//
+// This function wraps the given dense vector or dense matrix such that a subsequent assignment,
+// addition assignment, or subtraction assignment is not evaluated immediately. Instead, the
+// assignment results in a statement that can be passed to the fuse() function. In case the
+// target is an lvalue it is referenced, in case it is an rvalue (as for instance a view) it is
+// stored by value. See the fuse() function for an example.
+*/
+template< typename T >  // Type of the target
+inline auto lazy( T&& target )
+   -> EnableIf_t< ( IsDenseVector_v< RemoveCVRef_t<T> > || IsDenseMatrix_v< RemoveCVRef_t<T> > ) &&
+                  !IsConst_v< RemoveReference_t<T> >
+                , LazyTarget<T> >
+{
+   return LazyTarget<T>( std::forward<T>( target ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Checks whether a fused statement reads any of the given targets non-elementwise.
+// \ingroup math
+//
+// \param statement The fused statement to be checked.
+// \param targets The fused statements whose targets are checked.
+// \return \a true in case the statement cannot be evaluated block by block, \a false if it can.
+*/
+template< typename ST      // Type of the checked statement
+        , typename... STs >  // Types of the statements providing the targets
+inline bool isFusionAliased( const ST& statement, const STs&... targets ) noexcept
+{
+   if( !RemoveCVRef_t<ST>::requiresEvaluation )
+      return false;
+
+   const bool aliased[] = { false, statement.isAliased( &targets.target() )... };
+
+   for( bool a : aliased ) {
+      if( a ) return true;
+   }
+
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the size of the blocks of a fused evaluation.
+// \ingroup math
+//
+// \param statement The first statement of the fused evaluation.
+// \param count The total number of statements.
+// \param rowwise \a true in case matrices are partitioned into row blocks, \a false if not.
+// \return The number of elements/rows/columns per block.
+//
+// The block size is chosen such that the blocks of the targets and the (on average two)
+// operands of all statements fit into half of the cache (see the BLAZE_CACHE_SIZE setting).
+*/
+template< typename ST >  // Type of the first statement
+inline size_t fusedBlockSize( const ST& statement, size_t count, bool rowwise ) noexcept
+{
+   using ET = ElementType_t< typename RemoveCVRef_t<ST>::TargetType >;
+
+   const size_t elements( max( 64UL, ( cacheSize / ( 6UL * sizeof(ET) * count ) ) & ~63UL ) );
+   const size_t stride  ( max( 1UL, fusedStride( statement.target(), rowwise ) ) );
+
+   return max( 1UL, elements / stride );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Evaluates the given fused statements for a single block.
+// \ingroup math
+//
+// \param begin The index of the first element/row/column of the block.
+// \param size The number of elements/rows/columns of the block.
+// \param rowwise \a true in case matrices are partitioned into row blocks, \a false if not.
+// \param statements The fused statements.
+// \return void
+*/
+template< typename... STs >  // Types of the statements
+inline void applyFused( size_t begin, size_t size, bool rowwise, STs&... statements )
+{
+   const int dummy[] = { 0, ( statements.apply( begin, size, rowwise ), 0 )... };
+   MAYBE_UNUSED( dummy );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Evaluates several dense vector or dense matrix assignments in a single fused loop.
+// \ingroup math
+//
+// \param statement The first deferred assignment.
+// \param statements The remaining deferred assignments.
+// \return void
+// \exception std::invalid_argument Non-matching sizes of fused statements.
+// \exception std::invalid_argument Invalid aliasing of fused statements.
+//
+// Every assignment of a Blaze expression materializes its result. A sequence of assignments
+// therefore performs one full pass over memory per statement:
+
+   \code
+   blaze::DynamicMatrix<double> A;
+   blaze::DynamicVector<double> x, b, y, z, w;
+   // ... Resizing and initialization
+
+   y = A * x;
+   z = y + b;
+   w = tanh( z );
+   \endcode
+
+// The fuse() function evaluates the given statements block by block. All statements are
+// evaluated for the first block before the next block is processed, which keeps the
+// intermediate results in cache and turns the separate passes into a single one:
+
+   \code
+   blaze::fuse( blaze::lazy( y ) = A * x,
+                blaze::lazy( z ) = y + b,
+                blaze::lazy( w ) = tanh( z ) );
+   \endcode
+
+// The statements are evaluated in order and the result is identical to the sequence of
+// individual assignments. Intermediate results that are never read again do not have to be
+// stored at all. In the following example the result of the matrix/vector multiplication is
+// only computed block by block and never held in a full-size temporary:
+
+   \code
+   blaze::fuse( blaze::lazy( w ) = tanh( A * x + b ) );
+   \endcode
+
+// Vectors are partitioned into consecutive ranges of elements, matrices into blocks of rows
+// (in case the first target is a row-major matrix) or blocks of columns (in case the first
+// target is a column-major matrix). The block size is adapted to the cache size (see the
+// BLAZE_CACHE_SIZE setting) and the number of statements. In addition to assignments the
+// addition assignment and the subtraction assignment can be deferred. All targets must be
+// dense vectors or all targets must be dense matrices. In case the sizes of the targets and
+// the right-hand side operands don't match, a \a std::invalid_argument exception is thrown.
+//
+// Since every block is evaluated independently, a statement is only allowed to access the
+// targets of the fused evaluation element-wise, i.e. the i-th element of a statement may only
+// depend on the i-th element of the targets. In case an operand requiring an intermediate
+// evaluation (as for instance a matrix/vector multiplication) is detected to read any of the
+// targets, a \a std::invalid_argument exception is thrown. Note however that element-wise
+// accesses with an offset (as for instance via subvectors of a target) cannot be detected
+// and result in undefined behavior.
+*/
+template< typename ST       // Type of the first statement
+        , typename... STs >  // Types of the remaining statements
+void fuse( ST&& statement, STs&&... statements )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   const bool valid[] = { statement.isValid(),
+                          ( statements.isValid() &&
+                            isFusedShapeEqual( statement.target(), statements.target() ) )... };
+
+   for( bool v : valid ) {
+      if( !v ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Non-matching sizes of fused statements" );
+      }
+   }
+
+   const bool aliased[] = { isFusionAliased( statement , statement, statements... ),
+                            isFusionAliased( statements, statement, statements... )... };
+
+   for( bool a : aliased ) {
+      if( a ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid aliasing of fused statements" );
+      }
+   }
+
+   const bool   rowwise( isFusedRowwise( statement.target() ) );
+   const size_t extent ( fusedExtent( statement.target(), rowwise ) );
+   const size_t block  ( fusedBlockSize( statement, 1UL + sizeof...( STs ), rowwise ) );
+
+   for( size_t i=0UL; i<extent; i+=block )
+   {
+      const size_t size( min( block, extent - i ) );
+      applyFused( i, size, rowwise, statement, statements... );
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
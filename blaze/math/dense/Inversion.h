@@ -46,6 +46,7 @@
 #include <blaze/math/constraints/BLASCompatible.h>
 #include <blaze/math/constraints/StrictlyTriangular.h>
 #include <blaze/math/constraints/Uniform.h>
+#include <blaze/math/dense/BlockedFactorization.h>
 #include <blaze/math/dense/StaticMatrix.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseMatrix.h>
@@ -70,6 +71,7 @@
 #include <blaze/math/typetraits/IsUniLower.h>
 #include <blaze/math/typetraits/IsUniUpper.h>
 #include <blaze/math/typetraits/IsUpper.h>
+#include <blaze/system/LAPACK.h>
 #include <blaze/util/algorithms/Min.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
@@ -3342,8 +3344,13 @@ inline void invertByLU( DenseMatrix<MT,SO>& dm )
    const size_t n( min( (~dm).rows(), (~dm).columns() ) );
    const std::unique_ptr<int[]> ipiv( new int[n] );
 
+#if BLAZE_LAPACK_MODE
    getrf( ~dm, ipiv.get() );
    getri( ~dm, ipiv.get() );
+#else
+   blockedGetrf( ~dm, ipiv.get() );
+   blockedGetri( ~dm, ipiv.get() );
+#endif
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -3386,11 +3393,17 @@ inline void invertByLDLT( DenseMatrix<MT,SO>& dm )
 
    BLAZE_USER_ASSERT( isSymmetric( ~dm ), "Invalid non-symmetric matrix detected" );
 
-   const char uplo( ( SO )?( 'L' ):( 'U' ) );
    const std::unique_ptr<int[]> ipiv( new int[(~dm).rows()] );
 
+#if BLAZE_LAPACK_MODE
+   const char uplo( ( SO )?( 'L' ):( 'U' ) );
+
    sytrf( ~dm, uplo, ipiv.get() );
    sytri( ~dm, uplo, ipiv.get() );
+#else
+   blockedGetrf( ~dm, ipiv.get() );
+   blockedGetri( ~dm, ipiv.get() );
+#endif
 
    if( SO ) {
       for( size_t i=1UL; i<(~dm).rows(); ++i ) {
@@ -3488,11 +3501,17 @@ inline auto invertByLDLH( DenseMatrix<MT,SO>& dm )
 
    BLAZE_USER_ASSERT( isHermitian( ~dm ), "Invalid non-Hermitian matrix detected" );
 
-   const char uplo( ( SO )?( 'L' ):( 'U' ) );
    const std::unique_ptr<int[]> ipiv( new int[(~dm).rows()] );
 
+#if BLAZE_LAPACK_MODE
+   const char uplo( ( SO )?( 'L' ):( 'U' ) );
+
    hetrf( ~dm, uplo, ipiv.get() );
    hetri( ~dm, uplo, ipiv.get() );
+#else
+   blockedGetrf( ~dm, ipiv.get() );
+   blockedGetri( ~dm, ipiv.get() );
+#endif
 
    if( SO ) {
       for( size_t i=1UL; i<(~dm).rows(); ++i ) {
@@ -3552,8 +3571,13 @@ inline void invertByLLH( DenseMatrix<MT,SO>& dm )
 
    const char uplo( ( SO )?( 'L' ):( 'U' ) );
 
+#if BLAZE_LAPACK_MODE
    potrf( ~dm, uplo );
    potri( ~dm, uplo );
+#else
+   blockedPotrf( ~dm, uplo );
+   blockedPotri( ~dm, uplo );
+#endif
 
    if( SO ) {
       for( size_t i=1UL; i<(~dm).rows(); ++i ) {
@@ -3609,7 +3633,11 @@ inline void invertLowerNxN( DenseMatrix<MT,SO>& dm )
    BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
    BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<MT> );
 
+#if BLAZE_LAPACK_MODE
    trtri( ~dm, 'L', 'N' );
+#else
+   blockedTrtri( ~dm, 'L', 'N' );
+#endif
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -3650,7 +3678,11 @@ inline void invertUniLowerNxN( DenseMatrix<MT,SO>& dm )
    BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
    BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<MT> );
 
+#if BLAZE_LAPACK_MODE
    trtri( ~dm, 'L', 'U' );
+#else
+   blockedTrtri( ~dm, 'L', 'U' );
+#endif
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -3691,7 +3723,11 @@ inline void invertUpperNxN( DenseMatrix<MT,SO>& dm )
    BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
    BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<MT> );
 
+#if BLAZE_LAPACK_MODE
    trtri( ~dm, 'U', 'N' );
+#else
+   blockedTrtri( ~dm, 'U', 'N' );
+#endif
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -3732,7 +3768,11 @@ inline void invertUniUpperNxN( DenseMatrix<MT,SO>& dm )
    BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
    BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<MT> );
 
+#if BLAZE_LAPACK_MODE
    trtri( ~dm, 'U', 'U' );
+#else
+   blockedTrtri( ~dm, 'U', 'U' );
+#endif
 }
 /*! \endcond */
 //*************************************************************************************************
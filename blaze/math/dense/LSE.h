@@ -46,6 +46,7 @@
 #include <blaze/math/constraints/ColumnMajorMatrix.h>
 #include <blaze/math/constraints/StrictlyTriangular.h>
 #include <blaze/math/constraints/Uniform.h>
+#include <blaze/math/dense/BlockedFactorization.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/DenseVector.h>
@@ -64,6 +65,7 @@
 #include <blaze/math/typetraits/IsUniUpper.h>
 #include <blaze/math/typetraits/IsUpper.h>
 #include <blaze/math/typetraits/RemoveAdaptor.h>
+#include <blaze/system/LAPACK.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/constraints/SameType.h>
 #include <blaze/util/EnableIf.h>
@@ -5252,7 +5254,11 @@ void solveNxN( const DenseMatrix<MT,SO>& A, DenseVector<VT1,TF1>& x, const Dense
 
    const std::unique_ptr<int[]> ipiv( new int[N] );
 
+#if BLAZE_LAPACK_MODE
    gesv( Atmp, ~x, ipiv.get() );
+#else
+   blockedGesv( Atmp, ~x, ipiv.get() );
+#endif
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -5313,7 +5319,11 @@ void solveNxN( const DenseMatrix<MT,SO>& A, DenseVector<VT1,TF1>& x, const Dense
 
    const std::unique_ptr<int[]> ipiv( new int[N] );
 
+#if BLAZE_LAPACK_MODE
    sysv( Atmp, ~x, 'L', ipiv.get() );
+#else
+   blockedGesv( Atmp, ~x, ipiv.get() );
+#endif
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -5374,7 +5384,11 @@ void solveNxN( const DenseMatrix<MT,SO>& A, DenseVector<VT1,TF1>& x, const Dense
 
    const std::unique_ptr<int[]> ipiv( new int[N] );
 
+#if BLAZE_LAPACK_MODE
    hesv( Atmp, ~x, 'L', ipiv.get() );
+#else
+   blockedGesv( Atmp, ~x, ipiv.get() );
+#endif
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -5767,7 +5781,11 @@ void solveNxN( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& X, const Den
 
    const std::unique_ptr<int[]> ipiv( new int[N] );
 
+#if BLAZE_LAPACK_MODE
    gesv( Atmp, Xtmp, ipiv.get() );
+#else
+   blockedGesv( Atmp, Xtmp, ipiv.get() );
+#endif
 
    resize( ~X, Xtmp.rows(), Xtmp.columns() );
    smpAssign( ~X, Xtmp );
@@ -5834,7 +5852,11 @@ void solveNxN( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& X, const Den
 
    const std::unique_ptr<int[]> ipiv( new int[N] );
 
+#if BLAZE_LAPACK_MODE
    sysv( Atmp, Xtmp, 'L', ipiv.get() );
+#else
+   blockedGesv( Atmp, Xtmp, ipiv.get() );
+#endif
 
    resize( ~X, Xtmp.rows(), Xtmp.columns() );
    smpAssign( ~X, Xtmp );
@@ -5901,7 +5923,11 @@ void solveNxN( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& X, const Den
 
    const std::unique_ptr<int[]> ipiv( new int[N] );
 
+#if BLAZE_LAPACK_MODE
    hesv( Atmp, Xtmp, 'L', ipiv.get() );
+#else
+   blockedGesv( Atmp, Xtmp, ipiv.get() );
+#endif
 
    resize( ~X, Xtmp.rows(), Xtmp.columns() );
    smpAssign( ~X, Xtmp );
@@ -40,6 +40,7 @@
 // Includes
 //*************************************************************************************************
 
+#include <memory>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/Adaptor.h>
 #include <blaze/math/constraints/ColumnMajorMatrix.h>
@@ -55,20 +56,29 @@
 #include <blaze/math/constraints/UniUpper.h>
 #include <blaze/math/constraints/Lower.h>
 #include <blaze/math/constraints/Upper.h>
+#include <blaze/math/dense/DispatchedKernels.h>
 #include <blaze/math/dense/DynamicMatrix.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/IsOne.h>
 #include <blaze/math/shims/Serial.h>
 #include <blaze/math/SIMD.h>
+#include <blaze/math/typetraits/IsColumnMajorMatrix.h>
 #include <blaze/math/typetraits/IsLower.h>
 #include <blaze/math/typetraits/IsPadded.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
 #include <blaze/math/typetraits/IsUpper.h>
 #include <blaze/math/views/Check.h>
 #include <blaze/math/views/Submatrix.h>
 #include <blaze/system/Blocking.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Restrict.h>
+#include <blaze/util/algorithms/Max.h>
 #include <blaze/util/algorithms/Min.h>
+#include <blaze/util/AlignedArray.h>
 #include <blaze/util/Assert.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/policies/Deallocate.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/IsFloatingPoint.h>
@@ -76,6 +86,316 @@
 
 namespace blaze {
 
+//=================================================================================================
+//
+//  PACKED-PANEL DENSE MATRIX MULTIPLICATION ENGINE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Packing of a block of the broadcast operand of the packed-panel multiplication engine.
+// \ingroup dense_matrix
+//
+// \param dst Pointer to the first element of the packing buffer.
+// \param X The broadcast operand (\a A for row-major targets, \a B for column-major targets).
+// \param ww The index of the first row/column of the block.
+// \param wc The number of rows/columns of the block.
+// \param kk The index of the first element in the reduction dimension.
+// \param kc The size of the block in the reduction dimension.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \return void
+//
+// This function copies the given block of the broadcast operand into consecutive micro-panels
+// of MMM_MICROKERNEL_ROWS rows (or columns in case \a SO is set to \a true). Within a micro-panel
+// the elements are stored in reduction order, i.e. the microkernel can traverse the panel in a
+// single sequential sweep. Incomplete micro-panels are padded with zeros. The scaling factor
+// \a alpha is applied during packing.
+*/
+template< bool SO         // Storage order of the target matrix
+        , typename ET     // Element type of the packing buffer
+        , typename MT     // Type of the broadcast operand
+        , typename ST >   // Type of the scalar value
+void mmmPackBroadcastBlock( ET* dst, const MT& X, size_t ww, size_t wc,
+                            size_t kk, size_t kc, ST alpha )
+{
+   constexpr size_t MR( MMM_MICROKERNEL_ROWS );
+
+   constexpr bool contiguous( SO ? IsColumnMajorMatrix_v<MT> : IsRowMajorMatrix_v<MT> );
+
+   for( size_t w=0UL; w<wc; w+=MR, dst+=MR*kc )
+   {
+      const size_t mr( min( MR, wc-w ) );
+
+      if( contiguous ) {
+         for( size_t r=0UL; r<mr; ++r ) {
+            for( size_t k=0UL; k<kc; ++k ) {
+               dst[k*MR+r] = ( SO ? X(kk+k,ww+w+r) : X(ww+w+r,kk+k) ) * alpha;
+            }
+         }
+      }
+      else {
+         for( size_t k=0UL; k<kc; ++k ) {
+            for( size_t r=0UL; r<mr; ++r ) {
+               dst[k*MR+r] = ( SO ? X(kk+k,ww+w+r) : X(ww+w+r,kk+k) ) * alpha;
+            }
+         }
+      }
+
+      for( size_t k=0UL; mr<MR && k<kc; ++k ) {
+         for( size_t r=mr; r<MR; ++r ) {
+            dst[k*MR+r] = ET();
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Packing of a block of the vector operand of the packed-panel multiplication engine.
+// \ingroup dense_matrix
+//
+// \param dst Pointer to the first element of the (aligned) packing buffer.
+// \param Y The vector operand (\a B for row-major targets, \a A for column-major targets).
+// \param kk The index of the first element in the reduction dimension.
+// \param kc The size of the block in the reduction dimension.
+// \param vv The index of the first column/row of the block.
+// \param vc The number of columns/rows of the block.
+// \return void
+//
+// This function copies the given block of the vector operand into consecutive micro-panels of
+// MMM_MICROKERNEL_SIMD_COLUMNS SIMD vectors. Every SIMD vector of a micro-panel is aligned and
+// incomplete micro-panels are padded with zeros.
+*/
+template< bool SO         // Storage order of the target matrix
+        , typename ET     // Element type of the packing buffer
+        , typename MT >   // Type of the vector operand
+void mmmPackVectorBlock( ET* dst, const MT& Y, size_t kk, size_t kc, size_t vv, size_t vc )
+{
+   constexpr size_t NR( MMM_MICROKERNEL_SIMD_COLUMNS * SIMDTrait<ET>::size );
+
+   constexpr bool contiguous( SO ? IsColumnMajorMatrix_v<MT> : IsRowMajorMatrix_v<MT> );
+
+   for( size_t v=0UL; v<vc; v+=NR, dst+=NR*kc )
+   {
+      const size_t nr( min( NR, vc-v ) );
+
+      if( contiguous ) {
+         for( size_t k=0UL; k<kc; ++k ) {
+            for( size_t l=0UL; l<nr; ++l ) {
+               dst[k*NR+l] = ( SO ? Y(vv+v+l,kk+k) : Y(kk+k,vv+v+l) );
+            }
+         }
+      }
+      else {
+         for( size_t l=0UL; l<nr; ++l ) {
+            for( size_t k=0UL; k<kc; ++k ) {
+               dst[k*NR+l] = ( SO ? Y(vv+v+l,kk+k) : Y(kk+k,vv+v+l) );
+            }
+         }
+      }
+
+      for( size_t k=0UL; nr<NR && k<kc; ++k ) {
+         for( size_t l=nr; l<NR; ++l ) {
+            dst[k*NR+l] = ET();
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Register-blocked microkernel of the packed-panel multiplication engine.
+// \ingroup dense_matrix
+//
+// \param C The target dense matrix.
+// \param xp Pointer to the packed micro-panel of the broadcast operand.
+// \param yp Pointer to the packed micro-panel of the vector operand.
+// \param kc The size of the micro-panels in the reduction dimension.
+// \param w The row (or column in case \a SO is set to \a true) index of the register tile.
+// \param v The column (or row in case \a SO is set to \a true) index of the register tile.
+// \param mr The number of valid rows/columns of the register tile.
+// \param nr The number of valid columns/rows of the register tile.
+// \return void
+//
+// This function updates an \a mr \f$ \times \f$ \a nr tile of the target matrix with the outer
+// products of the two given micro-panels. The accumulators of the full MMM_MICROKERNEL_ROWS
+// \f$ \times \f$ MMM_MICROKERNEL_SIMD_COLUMNS tile are kept in SIMD registers, which results
+// in fused multiply-add instructions in case FMA is available. Incomplete tiles at the border
+// of the target matrix are written via a temporary buffer.
+*/
+template< bool SO         // Storage order of the target matrix
+        , typename MT     // Type of the target matrix
+        , typename ET2    // Element type of the broadcast operand
+        , typename ET3 >  // Element type of the vector operand
+BLAZE_ALWAYS_INLINE void mmmMicroKernel( MT& C, const ET2* BLAZE_RESTRICT xp, const ET3* BLAZE_RESTRICT yp,
+                                         size_t kc, size_t w, size_t v, size_t mr, size_t nr )
+{
+   using ET1 = ElementType_t<MT>;
+   using SIMDType = SIMDTrait_t<ET1>;
+
+   constexpr size_t SIMDSIZE( SIMDTrait<ET1>::size );
+   constexpr size_t MR ( MMM_MICROKERNEL_ROWS );
+   constexpr size_t NRV( MMM_MICROKERNEL_SIMD_COLUMNS );
+   constexpr size_t NR ( NRV * SIMDSIZE );
+
+   SIMDType xmm[MR][NRV];
+
+   for( size_t k=0UL; k<kc; ++k )
+   {
+      SIMDTrait_t<ET3> b[NRV];
+
+      for( size_t c=0UL; c<NRV; ++c ) {
+         b[c] = loada( yp+c*SIMDSIZE );
+      }
+
+      for( size_t r=0UL; r<MR; ++r ) {
+         const SIMDTrait_t<ET2> a( set( xp[r] ) );
+         for( size_t c=0UL; c<NRV; ++c ) {
+            xmm[r][c] += a * b[c];
+         }
+      }
+
+      xp += MR;
+      yp += NR;
+   }
+
+   if( mr == MR && nr == NR )
+   {
+      for( size_t r=0UL; r<MR; ++r ) {
+         for( size_t c=0UL; c<NRV; ++c ) {
+            if( SO ) C.storeu( v+c*SIMDSIZE, w+r, C.loadu( v+c*SIMDSIZE, w+r ) + xmm[r][c] );
+            else     C.storeu( w+r, v+c*SIMDSIZE, C.loadu( w+r, v+c*SIMDSIZE ) + xmm[r][c] );
+         }
+      }
+   }
+   else
+   {
+      AlignedArray<ET1,MR*NR> tmp;
+
+      for( size_t r=0UL; r<mr; ++r ) {
+         for( size_t c=0UL; c<NRV; ++c ) {
+            storea( tmp.data()+r*NR+c*SIMDSIZE, xmm[r][c] );
+         }
+         for( size_t l=0UL; l<nr; ++l ) {
+            if( SO ) C(v+l,w+r) += tmp[r*NR+l];
+            else     C(w+r,v+l) += tmp[r*NR+l];
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Packed-panel compute engine for a general dense matrix/dense matrix multiplication
+//        (\f$ C+=\alpha*A*B \f$).
+// \ingroup dense_matrix
+//
+// \param C The target dense matrix.
+// \param X The broadcast operand (\a A for row-major targets, \a B for column-major targets).
+// \param Y The vector operand (\a B for row-major targets, \a A for column-major targets).
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \return void
+//
+// This function implements a GotoBLAS-style multiplication engine: The vector operand is packed
+// in blocks of KC \f$ \times \f$ NC elements, the broadcast operand in blocks of MC \f$ \times \f$
+// KC elements (with block sizes adapted to the cache sizes, see getMMMBlocking()), and the
+// multiplication of the packed blocks is performed by a register-blocked SIMD microkernel (see
+// mmmMicroKernel()).
+// For row-major targets (\a SO set to \a false) the microkernel vectorizes along the rows of
+// \a C, for column-major targets (\a SO set to \a true) it vectorizes along the columns of \a C.
+// Blocks of lower or upper triangular operands that are known to be zero are skipped.
+*/
+template< bool SO         // Storage order of the target matrix
+        , typename MT1    // Type of the target matrix
+        , typename MT2    // Type of the broadcast operand
+        , typename MT3    // Type of the vector operand
+        , typename ST >   // Type of the scalar value
+void mmmPacked( MT1& C, const MT2& X, const MT3& Y, ST alpha )
+{
+   using ET2 = ElementType_t<MT2>;
+   using ET3 = ElementType_t<MT3>;
+
+   constexpr size_t SIMDSIZE( SIMDTrait<ElementType_t<MT1>>::size );
+   constexpr size_t MR( MMM_MICROKERNEL_ROWS );
+   constexpr size_t NR( MMM_MICROKERNEL_SIMD_COLUMNS * SIMDSIZE );
+
+   const MMMBlocking blocking( getMMMBlocking( sizeof( ElementType_t<MT1> ), MR, NR ) );
+
+   const size_t MC( blocking.mc );
+   const size_t KC( blocking.kc );
+   const size_t NC( blocking.nc );
+
+   // Row-major targets: X(w,k) and Y(k,v), column-major targets: X(k,w) and Y(v,k)
+   constexpr bool wbeginAtK( SO ? IsUpper_v<MT2> : IsLower_v<MT2> );
+   constexpr bool wendAtK  ( SO ? IsLower_v<MT2> : IsUpper_v<MT2> );
+   constexpr bool vbeginAtK( SO ? IsLower_v<MT3> : IsUpper_v<MT3> );
+   constexpr bool vendAtK  ( SO ? IsUpper_v<MT3> : IsLower_v<MT3> );
+
+   const size_t W( SO ? X.columns() : X.rows()    );
+   const size_t V( SO ? Y.rows()    : Y.columns() );
+   const size_t K( SO ? X.rows()    : X.columns() );
+
+   if( W == 0UL || V == 0UL || K == 0UL )
+      return;
+
+   const size_t kcmax( min( KC, K ) );
+   const size_t mcmax( min( MC, W + ( MR - W % MR ) % MR ) );
+   const size_t ncmax( min( NC, V + ( NR - V % NR ) % NR ) );
+
+   const std::unique_ptr<ET2[],Deallocate> xbuffer( allocate<ET2>( mcmax*kcmax ) );
+   const std::unique_ptr<ET3[],Deallocate> ybuffer( allocate<ET3>( kcmax*ncmax ) );
+
+   for( size_t jj=0UL; jj<V; jj+=NC )
+   {
+      const size_t jjend( min( jj+NC, V ) );
+
+      for( size_t kk=0UL; kk<K; kk+=KC )
+      {
+         const size_t kc( min( KC, K-kk ) );
+
+         const size_t vbegin( vbeginAtK ? max( jj, kk ) : jj );
+         const size_t vend  ( vendAtK ? min( jjend, kk+kc ) : jjend );
+
+         if( vbegin >= vend )
+            continue;
+
+         const size_t wbegin( wbeginAtK ? kk : 0UL );
+         const size_t wend  ( wendAtK ? min( W, kk+kc ) : W );
+
+         mmmPackVectorBlock<SO>( ybuffer.get(), Y, kk, kc, vbegin, vend-vbegin );
+
+         for( size_t ii=wbegin; ii<wend; ii+=MC )
+         {
+            const size_t mc( min( MC, wend-ii ) );
+
+            mmmPackBroadcastBlock<SO>( xbuffer.get(), X, ii, mc, kk, kc, alpha );
+
+            for( size_t v=vbegin; v<vend; v+=NR )
+            {
+               const size_t nr( min( NR, vend-v ) );
+               const ET3* const yp( ybuffer.get() + (v-vbegin)*kc );
+
+               for( size_t w=0UL; w<mc; w+=MR ) {
+                  const size_t mr( min( MR, mc-w ) );
+                  mmmMicroKernel<SO>( C, xbuffer.get()+w*kc, yp, kc, ii+w, v, mr, nr );
+               }
+            }
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
 //=================================================================================================
 //
 //  GENERAL DENSE MATRIX MULTIPLICATION KERNELS
@@ -99,7 +419,9 @@ namespace blaze {
 // multiplication of the form \f$ C=\alpha*A*B+\beta*C \f$. Both \a A and \a B must
 // be non-expression dense matrix types, \a C must be a non-expression, non-adaptor,
 // row-major dense matrix type. The element types of all three matrices must be SIMD
-// combinable, i.e. must provide a common SIMD interface.
+// combinable, i.e. must provide a common SIMD interface. In case the CPU
+// dispatch mode is enabled, the multiplication is performed by the kernel for the SIMD level
+// of the executing CPU (see dispatchedMmm()).
 */
 template< typename MT1, typename MT2, typename MT3, typename ST >
 void mmm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST beta )
@@ -107,7 +429,6 @@ void mmm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST be
    using ET1 = ElementType_t<MT1>;
    using ET2 = ElementType_t<MT2>;
    using ET3 = ElementType_t<MT3>;
-   using SIMDType = SIMDTrait_t<ET1>;
 
    BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE    ( MT1 );
    BLAZE_CONSTRAINT_MUST_BE_ROW_MAJOR_MATRIX_TYPE( MT1 );
@@ -123,25 +444,8 @@ void mmm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST be
    BLAZE_CONSTRAINT_MUST_BE_SIMD_COMBINABLE_TYPES( ET1, ET2 );
    BLAZE_CONSTRAINT_MUST_BE_SIMD_COMBINABLE_TYPES( ET1, ET3 );
 
-   constexpr size_t SIMDSIZE( SIMDTrait<ET1>::size );
-
-   constexpr bool remainder( !IsPadded_v<MT2> || !IsPadded_v<MT3> );
-
-   constexpr size_t KBLOCK( MMM_OUTER_BLOCK_SIZE * ( 16UL/sizeof(ET1) ) );
-   constexpr size_t JBLOCK( MMM_INNER_BLOCK_SIZE );
-
-   BLAZE_STATIC_ASSERT( KBLOCK >= SIMDSIZE && KBLOCK % SIMDSIZE == 0UL );
-   BLAZE_STATIC_ASSERT( JBLOCK >= SIMDSIZE && JBLOCK % SIMDSIZE == 0UL );
-
-   const size_t M( A.rows()    );
-   const size_t N( B.columns() );
-   const size_t K( A.columns() );
-
    BLAZE_INTERNAL_ASSERT( A.columns() == B.rows(), "Invalid matrix sizes detected" );
 
-   DynamicMatrix<ET2,false> A2( M, KBLOCK );
-   DynamicMatrix<ET3,true>  B2( KBLOCK, JBLOCK );
-
    if( isDefault( beta ) ) {
       reset( ~C );
    }
@@ -149,918 +453,70 @@ void mmm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST be
       (~C) *= beta;
    }
 
-   size_t kk( 0UL );
-   size_t kblock( 0UL );
-
-   while( kk + ( remainder ? SIMDSIZE-1UL : 0UL ) < K )
-   {
-      if( remainder ) {
-         kblock = ( ( kk+KBLOCK <= K )?( KBLOCK ):( ( K - kk ) & size_t(-SIMDSIZE) ) );
-      }
-      else {
-         kblock = ( ( kk+KBLOCK <= K )?( KBLOCK ):( K - kk ) );
-      }
-
-      const size_t ibegin( IsLower_v<MT2> ? kk : 0UL );
-      const size_t iend  ( IsUpper_v<MT2> ? kk+kblock : M );
-      const size_t isize ( iend - ibegin );
+   if( dispatchedMmm( ~C, A, B, alpha ) )
+      return;
 
-      A2 = serial( submatrix< remainder ? unaligned : aligned >( A, ibegin, kk, isize, kblock, unchecked ) );
+   mmmPacked<false>( ~C, A, B, alpha );
+}
+/*! \endcond */
+//*************************************************************************************************
 
-      size_t jj( 0UL );
-      size_t jblock( 0UL );
 
-      while( jj < N )
-      {
-         jblock = ( ( jj+JBLOCK <= N )?( JBLOCK ):( N - jj ) );
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Compute kernel for a general dense matrix/dense matrix multiplication
+//        (\f$ C=\alpha*A*B+\beta*C \f$).
+// \ingroup dense_matrix
+//
+// \param C The target left-hand side column-major dense matrix.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param beta The scaling factor for \f$ C \f$.
+// \return void
+//
+// This function implements the compute kernel for a general dense matrix/dense matrix
+// multiplication of the form \f$ C=\alpha*A*B+\beta*C \f$. Both \a A and \a B must
+// be non-expression dense matrix types, \a C must be a non-expression, non-adaptor,
+// column-major dense matrix type. The element types of all three matrices must be SIMD
+// combinable, i.e. must provide a common SIMD interface. In case the CPU
+// dispatch mode is enabled, the multiplication is performed by the kernel for the SIMD level
+// of the executing CPU (see dispatchedMmm()).
+*/
+template< typename MT1, typename MT2, typename MT3, typename ST >
+void mmm( DenseMatrix<MT1,true>& C, const MT2& A, const MT3& B, ST alpha, ST beta )
+{
+   using ET1 = ElementType_t<MT1>;
+   using ET2 = ElementType_t<MT2>;
+   using ET3 = ElementType_t<MT3>;
 
-         if( ( IsLower_v<MT3> && kk+kblock <= jj ) ||
-             ( IsUpper_v<MT3> && jj+jblock <= kk ) ) {
-            jj += jblock;
-            continue;
-         }
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE       ( MT1 );
+   BLAZE_CONSTRAINT_MUST_BE_COLUMN_MAJOR_MATRIX_TYPE( MT1 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE        ( MT1 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE    ( MT1 );
 
-         B2 = serial( submatrix< remainder ? unaligned : aligned >( B, kk, jj, kblock, jblock, unchecked ) );
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE   ( MT2 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT2 );
 
-         size_t i( 0UL );
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE   ( MT3 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT3 );
 
-         if( IsFloatingPoint_v<ET1> )
-         {
-            for( ; (i+5UL) <= isize; i+=5UL )
-            {
-               size_t j( 0UL );
+   BLAZE_CONSTRAINT_MUST_BE_SIMD_COMBINABLE_TYPES( ET1, ET2 );
+   BLAZE_CONSTRAINT_MUST_BE_SIMD_COMBINABLE_TYPES( ET1, ET3 );
 
-               for( ; (j+2UL) <= jblock; j+=2UL )
-               {
-                  SIMDType xmm1, xmm2, xmm3, xmm4, xmm5, xmm6, xmm7, xmm8, xmm9, xmm10;
+   BLAZE_INTERNAL_ASSERT( A.columns() == B.rows(), "Invalid matrix sizes detected" );
 
-                  for( size_t k=0UL; k<kblock; k+=SIMDSIZE )
-                  {
-                     const SIMDType a1( A2.load(i    ,k) );
-                     const SIMDType a2( A2.load(i+1UL,k) );
-                     const SIMDType a3( A2.load(i+2UL,k) );
-                     const SIMDType a4( A2.load(i+3UL,k) );
-                     const SIMDType a5( A2.load(i+4UL,k) );
+   if( isDefault( beta ) ) {
+      reset( ~C );
+   }
+   else if( !isOne( beta ) ) {
+      (~C) *= beta;
+   }
 
-                     const SIMDType b1( B2.load(k,j    ) );
-                     const SIMDType b2( B2.load(k,j+1UL) );
+   if( dispatchedMmm( ~C, A, B, alpha ) )
+      return;
 
-                     xmm1  += a1 * b1;
-                     xmm2  += a1 * b2;
-                     xmm3  += a2 * b1;
-                     xmm4  += a2 * b2;
-                     xmm5  += a3 * b1;
-                     xmm6  += a3 * b2;
-                     xmm7  += a4 * b1;
-                     xmm8  += a4 * b2;
-                     xmm9  += a5 * b1;
-                     xmm10 += a5 * b2;
-                  }
-
-                  (~C)(ibegin+i    ,jj+j    ) += sum( xmm1  ) * alpha;
-                  (~C)(ibegin+i    ,jj+j+1UL) += sum( xmm2  ) * alpha;
-                  (~C)(ibegin+i+1UL,jj+j    ) += sum( xmm3  ) * alpha;
-                  (~C)(ibegin+i+1UL,jj+j+1UL) += sum( xmm4  ) * alpha;
-                  (~C)(ibegin+i+2UL,jj+j    ) += sum( xmm5  ) * alpha;
-                  (~C)(ibegin+i+2UL,jj+j+1UL) += sum( xmm6  ) * alpha;
-                  (~C)(ibegin+i+3UL,jj+j    ) += sum( xmm7  ) * alpha;
-                  (~C)(ibegin+i+3UL,jj+j+1UL) += sum( xmm8  ) * alpha;
-                  (~C)(ibegin+i+4UL,jj+j    ) += sum( xmm9  ) * alpha;
-                  (~C)(ibegin+i+4UL,jj+j+1UL) += sum( xmm10 ) * alpha;
-               }
-
-               if( j<jblock )
-               {
-                  SIMDType xmm1, xmm2, xmm3, xmm4, xmm5;
-
-                  for( size_t k=0UL; k<kblock; k+=SIMDSIZE )
-                  {
-                     const SIMDType a1( A2.load(i    ,k) );
-                     const SIMDType a2( A2.load(i+1UL,k) );
-                     const SIMDType a3( A2.load(i+2UL,k) );
-                     const SIMDType a4( A2.load(i+3UL,k) );
-                     const SIMDType a5( A2.load(i+4UL,k) );
-
-                     const SIMDType b1( B2.load(k,j) );
-
-                     xmm1 += a1 * b1;
-                     xmm2 += a2 * b1;
-                     xmm3 += a3 * b1;
-                     xmm4 += a4 * b1;
-                     xmm5 += a5 * b1;
-                  }
-
-                  (~C)(ibegin+i    ,jj+j) += sum( xmm1 ) * alpha;
-                  (~C)(ibegin+i+1UL,jj+j) += sum( xmm2 ) * alpha;
-                  (~C)(ibegin+i+2UL,jj+j) += sum( xmm3 ) * alpha;
-                  (~C)(ibegin+i+3UL,jj+j) += sum( xmm4 ) * alpha;
-                  (~C)(ibegin+i+4UL,jj+j) += sum( xmm5 ) * alpha;
-               }
-            }
-         }
-         else
-         {
-            for( ; (i+4UL) <= isize; i+=4UL )
-            {
-               size_t j( 0UL );
-
-               for( ; (j+2UL) <= jblock; j+=2UL )
-               {
-                  SIMDType xmm1, xmm2, xmm3, xmm4, xmm5, xmm6, xmm7, xmm8;
-
-                  for( size_t k=0UL; k<kblock; k+=SIMDSIZE )
-                  {
-                     const SIMDType a1( A2.load(i    ,k) );
-                     const SIMDType a2( A2.load(i+1UL,k) );
-                     const SIMDType a3( A2.load(i+2UL,k) );
-                     const SIMDType a4( A2.load(i+3UL,k) );
-
-                     const SIMDType b1( B2.load(k,j    ) );
-                     const SIMDType b2( B2.load(k,j+1UL) );
-
-                     xmm1 += a1 * b1;
-                     xmm2 += a1 * b2;
-                     xmm3 += a2 * b1;
-                     xmm4 += a2 * b2;
-                     xmm5 += a3 * b1;
-                     xmm6 += a3 * b2;
-                     xmm7 += a4 * b1;
-                     xmm8 += a4 * b2;
-                  }
-
-                  (~C)(ibegin+i    ,jj+j    ) += sum( xmm1 ) * alpha;
-                  (~C)(ibegin+i    ,jj+j+1UL) += sum( xmm2 ) * alpha;
-                  (~C)(ibegin+i+1UL,jj+j    ) += sum( xmm3 ) * alpha;
-                  (~C)(ibegin+i+1UL,jj+j+1UL) += sum( xmm4 ) * alpha;
-                  (~C)(ibegin+i+2UL,jj+j    ) += sum( xmm5 ) * alpha;
-                  (~C)(ibegin+i+2UL,jj+j+1UL) += sum( xmm6 ) * alpha;
-                  (~C)(ibegin+i+3UL,jj+j    ) += sum( xmm7 ) * alpha;
-                  (~C)(ibegin+i+3UL,jj+j+1UL) += sum( xmm8 ) * alpha;
-               }
-
-               if( j<jblock )
-               {
-                  SIMDType xmm1, xmm2, xmm3, xmm4;
-
-                  for( size_t k=0UL; k<kblock; k+=SIMDSIZE )
-                  {
-                     const SIMDType a1( A2.load(i    ,k) );
-                     const SIMDType a2( A2.load(i+1UL,k) );
-                     const SIMDType a3( A2.load(i+2UL,k) );
-                     const SIMDType a4( A2.load(i+3UL,k) );
-
-                     const SIMDType b1( B2.load(k,j) );
-
-                     xmm1 += a1 * b1;
-                     xmm2 += a2 * b1;
-                     xmm3 += a3 * b1;
-                     xmm4 += a4 * b1;
-                  }
-
-                  (~C)(ibegin+i    ,jj+j) += sum( xmm1 ) * alpha;
-                  (~C)(ibegin+i+1UL,jj+j) += sum( xmm2 ) * alpha;
-                  (~C)(ibegin+i+2UL,jj+j) += sum( xmm3 ) * alpha;
-                  (~C)(ibegin+i+3UL,jj+j) += sum( xmm4 ) * alpha;
-               }
-            }
-         }
-
-         for( ; (i+2UL) <= isize; i+=2UL )
-         {
-            size_t j( 0UL );
-
-            for( ; (j+4UL) <= jblock; j+=4UL )
-            {
-               SIMDType xmm1, xmm2, xmm3, xmm4, xmm5, xmm6, xmm7, xmm8;
-
-               for( size_t k=0UL; k<kblock; k+=SIMDSIZE )
-               {
-                  const SIMDType a1( A2.load(i    ,k) );
-                  const SIMDType a2( A2.load(i+1UL,k) );
-
-                  const SIMDType b1( B2.load(k,j    ) );
-                  const SIMDType b2( B2.load(k,j+1UL) );
-                  const SIMDType b3( B2.load(k,j+2UL) );
-                  const SIMDType b4( B2.load(k,j+3UL) );
-
-                  xmm1 += a1 * b1;
-                  xmm2 += a1 * b2;
-                  xmm3 += a1 * b3;
-                  xmm4 += a1 * b4;
-                  xmm5 += a2 * b1;
-                  xmm6 += a2 * b2;
-                  xmm7 += a2 * b3;
-                  xmm8 += a2 * b4;
-               }
-
-               (~C)(ibegin+i    ,jj+j    ) += sum( xmm1 ) * alpha;
-               (~C)(ibegin+i    ,jj+j+1UL) += sum( xmm2 ) * alpha;
-               (~C)(ibegin+i    ,jj+j+2UL) += sum( xmm3 ) * alpha;
-               (~C)(ibegin+i    ,jj+j+3UL) += sum( xmm4 ) * alpha;
-               (~C)(ibegin+i+1UL,jj+j    ) += sum( xmm5 ) * alpha;
-               (~C)(ibegin+i+1UL,jj+j+1UL) += sum( xmm6 ) * alpha;
-               (~C)(ibegin+i+1UL,jj+j+2UL) += sum( xmm7 ) * alpha;
-               (~C)(ibegin+i+1UL,jj+j+3UL) += sum( xmm8 ) * alpha;
-            }
-
-            for( ; (j+2UL) <= jblock; j+=2UL )
-            {
-               SIMDType xmm1, xmm2, xmm3, xmm4;
-
-               for( size_t k=0UL; k<kblock; k+=SIMDSIZE )
-               {
-                  const SIMDType a1( A2.load(i    ,k) );
-                  const SIMDType a2( A2.load(i+1UL,k) );
-
-                  const SIMDType b1( B2.load(k,j    ) );
-                  const SIMDType b2( B2.load(k,j+1UL) );
-
-                  xmm1 += a1 * b1;
-                  xmm2 += a1 * b2;
-                  xmm3 += a2 * b1;
-                  xmm4 += a2 * b2;
-               }
-
-               (~C)(ibegin+i    ,jj+j    ) += sum( xmm1 ) * alpha;
-               (~C)(ibegin+i    ,jj+j+1UL) += sum( xmm2 ) * alpha;
-               (~C)(ibegin+i+1UL,jj+j    ) += sum( xmm3 ) * alpha;
-               (~C)(ibegin+i+1UL,jj+j+1UL) += sum( xmm4 ) * alpha;
-            }
-
-            if( j<jblock )
-            {
-               SIMDType xmm1, xmm2;
-
-               for( size_t k=0UL; k<kblock; k+=SIMDSIZE )
-               {
-                  const SIMDType a1( A2.load(i    ,k) );
-                  const SIMDType a2( A2.load(i+1UL,k) );
-
-                  const SIMDType b1( B2.load(k,j) );
-
-                  xmm1 += a1 * b1;
-                  xmm2 += a2 * b1;
-               }
-
-               (~C)(ibegin+i    ,jj+j) += sum( xmm1 ) * alpha;
-               (~C)(ibegin+i+1UL,jj+j) += sum( xmm2 ) * alpha;
-            }
-         }
-
-         if( i<isize )
-         {
-            size_t j( 0UL );
-
-            for( ; (j+2UL) <= jblock; j+=2UL )
-            {
-               SIMDType xmm1, xmm2;
-
-               for( size_t k=0UL; k<kblock; k+=SIMDSIZE )
-               {
-                  const SIMDType a1( A2.load(i,k) );
-
-                  xmm1 += a1 * B2.load(k,j    );
-                  xmm2 += a1 * B2.load(k,j+1UL);
-               }
-
-               (~C)(ibegin+i,jj+j    ) += sum( xmm1 ) * alpha;
-               (~C)(ibegin+i,jj+j+1UL) += sum( xmm2 ) * alpha;
-            }
-
-            if( j<jblock )
-            {
-               SIMDType xmm1;
-
-               for( size_t k=0UL; k<kblock; k+=SIMDSIZE )
-               {
-                  const SIMDType a1( A2.load(i,k) );
-
-                  xmm1 += a1 * B2.load(k,j);
-               }
-
-               (~C)(ibegin+i,jj+j) += sum( xmm1 ) * alpha;
-            }
-         }
-
-         jj += jblock;
-      }
-
-      kk += kblock;
-   }
-
-   if( remainder && kk < K )
-   {
-      const size_t ksize( K - kk );
-
-      const size_t ibegin( IsLower_v<MT2> ? kk : 0UL );
-      const size_t isize ( M - ibegin );
-
-      A2 = serial( submatrix( A, ibegin, kk, isize, ksize, unchecked ) );
-
-      size_t jj( 0UL );
-      size_t jblock( 0UL );
-
-      while( jj < N )
-      {
-         jblock = ( ( jj+JBLOCK <= N )?( JBLOCK ):( N - jj ) );
-
-         if( IsUpper_v<MT3> && jj+jblock <= kk ) {
-            jj += jblock;
-            continue;
-         }
-
-         B2 = serial( submatrix( B, kk, jj, ksize, jblock, unchecked ) );
-
-         size_t i( 0UL );
-
-         if( IsFloatingPoint_v<ET1> )
-         {
-            for( ; (i+5UL) <= isize; i+=5UL )
-            {
-               size_t j( 0UL );
-
-               for( ; (j+2UL) <= jblock; j+=2UL ) {
-                  for( size_t k=0UL; k<ksize; ++k ) {
-                     (~C)(ibegin+i    ,jj+j    ) += A2(i    ,k) * B2(k,j    ) * alpha;
-                     (~C)(ibegin+i    ,jj+j+1UL) += A2(i    ,k) * B2(k,j+1UL) * alpha;
-                     (~C)(ibegin+i+1UL,jj+j    ) += A2(i+1UL,k) * B2(k,j    ) * alpha;
-                     (~C)(ibegin+i+1UL,jj+j+1UL) += A2(i+1UL,k) * B2(k,j+1UL) * alpha;
-                     (~C)(ibegin+i+2UL,jj+j    ) += A2(i+2UL,k) * B2(k,j    ) * alpha;
-                     (~C)(ibegin+i+2UL,jj+j+1UL) += A2(i+2UL,k) * B2(k,j+1UL) * alpha;
-                     (~C)(ibegin+i+3UL,jj+j    ) += A2(i+3UL,k) * B2(k,j    ) * alpha;
-                     (~C)(ibegin+i+3UL,jj+j+1UL) += A2(i+3UL,k) * B2(k,j+1UL) * alpha;
-                     (~C)(ibegin+i+4UL,jj+j    ) += A2(i+4UL,k) * B2(k,j    ) * alpha;
-                     (~C)(ibegin+i+4UL,jj+j+1UL) += A2(i+4UL,k) * B2(k,j+1UL) * alpha;
-                  }
-               }
-
-               if( j<jblock ) {
-                  for( size_t k=0UL; k<ksize; ++k ) {
-                     (~C)(ibegin+i    ,jj+j) += A2(i    ,k) * B2(k,j) * alpha;
-                     (~C)(ibegin+i+1UL,jj+j) += A2(i+1UL,k) * B2(k,j) * alpha;
-                     (~C)(ibegin+i+2UL,jj+j) += A2(i+2UL,k) * B2(k,j) * alpha;
-                     (~C)(ibegin+i+3UL,jj+j) += A2(i+3UL,k) * B2(k,j) * alpha;
-                     (~C)(ibegin+i+4UL,jj+j) += A2(i+4UL,k) * B2(k,j) * alpha;
-                  }
-               }
-            }
-         }
-         else
-         {
-            for( ; (i+4UL) <= isize; i+=4UL )
-            {
-               size_t j( 0UL );
-
-               for( ; (j+2UL) <= jblock; j+=2UL ) {
-                  for( size_t k=0UL; k<ksize; ++k ) {
-                     (~C)(ibegin+i    ,jj+j    ) += A2(i    ,k) * B2(k,j    ) * alpha;
-                     (~C)(ibegin+i    ,jj+j+1UL) += A2(i    ,k) * B2(k,j+1UL) * alpha;
-                     (~C)(ibegin+i+1UL,jj+j    ) += A2(i+1UL,k) * B2(k,j    ) * alpha;
-                     (~C)(ibegin+i+1UL,jj+j+1UL) += A2(i+1UL,k) * B2(k,j+1UL) * alpha;
-                     (~C)(ibegin+i+2UL,jj+j    ) += A2(i+2UL,k) * B2(k,j    ) * alpha;
-                     (~C)(ibegin+i+2UL,jj+j+1UL) += A2(i+2UL,k) * B2(k,j+1UL) * alpha;
-                     (~C)(ibegin+i+3UL,jj+j    ) += A2(i+3UL,k) * B2(k,j    ) * alpha;
-                     (~C)(ibegin+i+3UL,jj+j+1UL) += A2(i+3UL,k) * B2(k,j+1UL) * alpha;
-                  }
-               }
-
-               if( j<jblock ) {
-                  for( size_t k=0UL; k<ksize; ++k ) {
-                     (~C)(ibegin+i    ,jj+j) += A2(i    ,k) * B2(k,j) * alpha;
-                     (~C)(ibegin+i+1UL,jj+j) += A2(i+1UL,k) * B2(k,j) * alpha;
-                     (~C)(ibegin+i+2UL,jj+j) += A2(i+2UL,k) * B2(k,j) * alpha;
-                     (~C)(ibegin+i+3UL,jj+j) += A2(i+3UL,k) * B2(k,j) * alpha;
-                  }
-               }
-            }
-         }
-
-         for( ; (i+2UL) <= isize; i+=2UL )
-         {
-            size_t j( 0UL );
-
-            for( ; (j+2UL) <= jblock; j+=2UL ) {
-               for( size_t k=0UL; k<ksize; ++k ) {
-                  (~C)(ibegin+i    ,jj+j    ) += A2(i    ,k) * B2(k,j    ) * alpha;
-                  (~C)(ibegin+i    ,jj+j+1UL) += A2(i    ,k) * B2(k,j+1UL) * alpha;
-                  (~C)(ibegin+i+1UL,jj+j    ) += A2(i+1UL,k) * B2(k,j    ) * alpha;
-                  (~C)(ibegin+i+1UL,jj+j+1UL) += A2(i+1UL,k) * B2(k,j+1UL) * alpha;
-               }
-            }
-
-            if( j<jblock ) {
-               for( size_t k=0UL; k<ksize; ++k ) {
-                  (~C)(ibegin+i    ,jj+j) += A2(i    ,k) * B2(k,j) * alpha;
-                  (~C)(ibegin+i+1UL,jj+j) += A2(i+1UL,k) * B2(k,j) * alpha;
-               }
-            }
-         }
-
-         if( i<isize )
-         {
-            size_t j( 0UL );
-
-            for( ; (j+2UL) <= jblock; j+=2UL ) {
-               for( size_t k=0UL; k<ksize; ++k ) {
-                  (~C)(ibegin+i,jj+j    ) += A2(i,k) * B2(k,j    ) * alpha;
-                  (~C)(ibegin+i,jj+j+1UL) += A2(i,k) * B2(k,j+1UL) * alpha;
-               }
-            }
-
-            if( j<jblock ) {
-               for( size_t k=0UL; k<ksize; ++k ) {
-                  (~C)(ibegin+i,jj+j) += A2(i,k) * B2(k,j) * alpha;
-               }
-            }
-         }
-
-         jj += jblock;
-      }
-   }
-}
-/*! \endcond */
-//*************************************************************************************************
-
-
-//*************************************************************************************************
-/*! \cond BLAZE_INTERNAL */
-/*!\brief Compute kernel for a general dense matrix/dense matrix multiplication
-//        (\f$ C=\alpha*A*B+\beta*C \f$).
-// \ingroup dense_matrix
-//
-// \param C The target left-hand side column-major dense matrix.
-// \param A The left-hand side multiplication operand.
-// \param B The right-hand side multiplication operand.
-// \param alpha The scaling factor for \f$ A*B \f$.
-// \param beta The scaling factor for \f$ C \f$.
-// \return void
-//
-// This function implements the compute kernel for a general dense matrix/dense matrix
-// multiplication of the form \f$ C=\alpha*A*B+\beta*C \f$. Both \a A and \a B must
-// be non-expression dense matrix types, \a C must be a non-expression, non-adaptor,
-// column-major dense matrix type. The element types of all three matrices must be SIMD
-// combinable, i.e. must provide a common SIMD interface.
-*/
-template< typename MT1, typename MT2, typename MT3, typename ST >
-void mmm( DenseMatrix<MT1,true>& C, const MT2& A, const MT3& B, ST alpha, ST beta )
-{
-   using ET1 = ElementType_t<MT1>;
-   using ET2 = ElementType_t<MT2>;
-   using ET3 = ElementType_t<MT3>;
-   using SIMDType = SIMDTrait_t<ET1>;
-
-   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE       ( MT1 );
-   BLAZE_CONSTRAINT_MUST_BE_COLUMN_MAJOR_MATRIX_TYPE( MT1 );
-   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE        ( MT1 );
-   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE    ( MT1 );
-
-   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE   ( MT2 );
-   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT2 );
-
-   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE   ( MT3 );
-   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT3 );
-
-   BLAZE_CONSTRAINT_MUST_BE_SIMD_COMBINABLE_TYPES( ET1, ET2 );
-   BLAZE_CONSTRAINT_MUST_BE_SIMD_COMBINABLE_TYPES( ET1, ET3 );
-
-   constexpr size_t SIMDSIZE( SIMDTrait<ET1>::size );
-
-   constexpr bool remainder( !IsPadded_v<MT2> || !IsPadded_v<MT3> );
-
-   constexpr size_t KBLOCK( MMM_OUTER_BLOCK_SIZE * ( 16UL/sizeof(ET1) ) );
-   constexpr size_t IBLOCK( MMM_INNER_BLOCK_SIZE );
-
-   BLAZE_STATIC_ASSERT( KBLOCK >= SIMDSIZE && KBLOCK % SIMDSIZE == 0UL );
-   BLAZE_STATIC_ASSERT( IBLOCK >= SIMDSIZE && IBLOCK % SIMDSIZE == 0UL );
-
-   const size_t M( A.rows()    );
-   const size_t N( B.columns() );
-   const size_t K( A.columns() );
-
-   BLAZE_INTERNAL_ASSERT( A.columns() == B.rows(), "Invalid matrix sizes detected" );
-
-   DynamicMatrix<ET2,false> A2( IBLOCK, KBLOCK );
-   DynamicMatrix<ET3,true>  B2( KBLOCK, N );
-
-   if( isDefault( beta ) ) {
-      reset( ~C );
-   }
-   else if( !isOne( beta ) ) {
-      (~C) *= beta;
-   }
-
-   size_t kk( 0UL );
-   size_t kblock( 0UL );
-
-   while( kk + ( remainder ? SIMDSIZE-1UL : 0UL ) < K )
-   {
-      if( remainder ) {
-         kblock = ( ( kk+KBLOCK <= K )?( KBLOCK ):( ( K - kk ) & size_t(-SIMDSIZE) ) );
-      }
-      else {
-         kblock = ( ( kk+KBLOCK <= K )?( KBLOCK ):( K - kk ) );
-      }
-
-      const size_t jbegin( IsUpper_v<MT3> ? kk : 0UL );
-      const size_t jend  ( IsLower_v<MT3> ? kk+kblock : N );
-      const size_t jsize ( jend - jbegin );
-
-      B2 = serial( submatrix< remainder ? unaligned : aligned >( B, kk, jbegin, kblock, jsize, unchecked ) );
-
-      size_t ii( 0UL );
-      size_t iblock( 0UL );
-
-      while( ii < M )
-      {
-         iblock = ( ( ii+IBLOCK <= M )?( IBLOCK ):( M - ii ) );
-
-         if( ( IsLower_v<MT2> && ii+iblock <= kk ) ||
-             ( IsUpper_v<MT2> && kk+kblock <= ii ) ) {
-            ii += iblock;
-            continue;
-         }
-
-         A2 = serial( submatrix< remainder ? unaligned : aligned >( A, ii, kk, iblock, kblock, unchecked ) );
-
-         size_t j( 0UL );
-
-         if( IsFloatingPoint_v<ET3> )
-         {
-            for( ; (j+5UL) <= jsize; j+=5UL )
-            {
-               size_t i( 0UL );
-
-               for( ; (i+2UL) <= iblock; i+=2UL )
-               {
-                  SIMDType xmm1, xmm2, xmm3, xmm4, xmm5, xmm6, xmm7, xmm8, xmm9, xmm10;
-
-                  for( size_t k=0UL; k<kblock; k+=SIMDSIZE )
-                  {
-                     const SIMDType a1( A2.load(i    ,k) );
-                     const SIMDType a2( A2.load(i+1UL,k) );
-
-                     const SIMDType b1( B2.load(k,j    ) );
-                     const SIMDType b2( B2.load(k,j+1UL) );
-                     const SIMDType b3( B2.load(k,j+2UL) );
-                     const SIMDType b4( B2.load(k,j+3UL) );
-                     const SIMDType b5( B2.load(k,j+4UL) );
-
-                     xmm1  += a1 * b1;
-                     xmm2  += a1 * b2;
-                     xmm3  += a1 * b3;
-                     xmm4  += a1 * b4;
-                     xmm5  += a1 * b5;
-                     xmm6  += a2 * b1;
-                     xmm7  += a2 * b2;
-                     xmm8  += a2 * b3;
-                     xmm9  += a2 * b4;
-                     xmm10 += a2 * b5;
-                  }
-
-                  (~C)(ii+i    ,jbegin+j    ) += sum( xmm1  ) * alpha;
-                  (~C)(ii+i    ,jbegin+j+1UL) += sum( xmm2  ) * alpha;
-                  (~C)(ii+i    ,jbegin+j+2UL) += sum( xmm3  ) * alpha;
-                  (~C)(ii+i    ,jbegin+j+3UL) += sum( xmm4  ) * alpha;
-                  (~C)(ii+i    ,jbegin+j+4UL) += sum( xmm5  ) * alpha;
-                  (~C)(ii+i+1UL,jbegin+j    ) += sum( xmm6  ) * alpha;
-                  (~C)(ii+i+1UL,jbegin+j+1UL) += sum( xmm7  ) * alpha;
-                  (~C)(ii+i+1UL,jbegin+j+2UL) += sum( xmm8  ) * alpha;
-                  (~C)(ii+i+1UL,jbegin+j+3UL) += sum( xmm9  ) * alpha;
-                  (~C)(ii+i+1UL,jbegin+j+4UL) += sum( xmm10 ) * alpha;
-               }
-
-               if( i<iblock )
-               {
-                  SIMDType xmm1, xmm2, xmm3, xmm4, xmm5;
-
-                  for( size_t k=0UL; k<kblock; k+=SIMDSIZE )
-                  {
-                     const SIMDType a1( A2.load(i,k) );
-
-                     xmm1 += a1 * B2.load(k,j    );
-                     xmm2 += a1 * B2.load(k,j+1UL);
-                     xmm3 += a1 * B2.load(k,j+2UL);
-                     xmm4 += a1 * B2.load(k,j+3UL);
-                     xmm5 += a1 * B2.load(k,j+4UL);
-                  }
-
-                  (~C)(ii+i,jbegin+j    ) += sum( xmm1 ) * alpha;
-                  (~C)(ii+i,jbegin+j+1UL) += sum( xmm2 ) * alpha;
-                  (~C)(ii+i,jbegin+j+2UL) += sum( xmm3 ) * alpha;
-                  (~C)(ii+i,jbegin+j+3UL) += sum( xmm4 ) * alpha;
-                  (~C)(ii+i,jbegin+j+4UL) += sum( xmm5 ) * alpha;
-               }
-            }
-         }
-         else
-         {
-            for( ; (j+4UL) <= jsize; j+=4UL )
-            {
-               size_t i( 0UL );
-
-               for( ; (i+2UL) <= iblock; i+=2UL )
-               {
-                  SIMDType xmm1, xmm2, xmm3, xmm4, xmm5, xmm6, xmm7, xmm8;
-
-                  for( size_t k=0UL; k<kblock; k+=SIMDSIZE )
-                  {
-                     const SIMDType a1( A2.load(i    ,k) );
-                     const SIMDType a2( A2.load(i+1UL,k) );
-
-                     const SIMDType b1( B2.load(k,j    ) );
-                     const SIMDType b2( B2.load(k,j+1UL) );
-                     const SIMDType b3( B2.load(k,j+2UL) );
-                     const SIMDType b4( B2.load(k,j+3UL) );
-
-                     xmm1 += a1 * b1;
-                     xmm2 += a1 * b2;
-                     xmm3 += a1 * b3;
-                     xmm4 += a1 * b4;
-                     xmm5 += a2 * b1;
-                     xmm6 += a2 * b2;
-                     xmm7 += a2 * b3;
-                     xmm8 += a2 * b4;
-                  }
-
-                  (~C)(ii+i    ,jbegin+j    ) += sum( xmm1 ) * alpha;
-                  (~C)(ii+i    ,jbegin+j+1UL) += sum( xmm2 ) * alpha;
-                  (~C)(ii+i    ,jbegin+j+2UL) += sum( xmm3 ) * alpha;
-                  (~C)(ii+i    ,jbegin+j+3UL) += sum( xmm4 ) * alpha;
-                  (~C)(ii+i+1UL,jbegin+j    ) += sum( xmm5 ) * alpha;
-                  (~C)(ii+i+1UL,jbegin+j+1UL) += sum( xmm6 ) * alpha;
-                  (~C)(ii+i+1UL,jbegin+j+2UL) += sum( xmm7 ) * alpha;
-                  (~C)(ii+i+1UL,jbegin+j+3UL) += sum( xmm8 ) * alpha;
-               }
-
-               if( i<iblock )
-               {
-                  SIMDType xmm1, xmm2, xmm3, xmm4;
-
-                  for( size_t k=0UL; k<kblock; k+=SIMDSIZE )
-                  {
-                     const SIMDType a1( A2.load(i,k) );
-
-                     xmm1 += a1 * B2.load(k,j    );
-                     xmm2 += a1 * B2.load(k,j+1UL);
-                     xmm3 += a1 * B2.load(k,j+2UL);
-                     xmm4 += a1 * B2.load(k,j+3UL);
-                  }
-
-                  (~C)(ii+i,jbegin+j    ) += sum( xmm1 ) * alpha;
-                  (~C)(ii+i,jbegin+j+1UL) += sum( xmm2 ) * alpha;
-                  (~C)(ii+i,jbegin+j+2UL) += sum( xmm3 ) * alpha;
-                  (~C)(ii+i,jbegin+j+3UL) += sum( xmm4 ) * alpha;
-               }
-            }
-         }
-
-         for( ; (j+2UL) <= jsize; j+=2UL )
-         {
-            size_t i( 0UL );
-
-            for( ; (i+4UL) <= iblock; i+=4UL )
-            {
-               SIMDType xmm1, xmm2, xmm3, xmm4, xmm5, xmm6, xmm7, xmm8;
-
-               for( size_t k=0UL; k<kblock; k+=SIMDSIZE )
-               {
-                  const SIMDType a1( A2.load(i    ,k) );
-                  const SIMDType a2( A2.load(i+1UL,k) );
-                  const SIMDType a3( A2.load(i+2UL,k) );
-                  const SIMDType a4( A2.load(i+3UL,k) );
-
-                  const SIMDType b1( B2.load(k,j    ) );
-                  const SIMDType b2( B2.load(k,j+1UL) );
-
-                  xmm1 += a1 * b1;
-                  xmm2 += a1 * b2;
-                  xmm3 += a2 * b1;
-                  xmm4 += a2 * b2;
-                  xmm5 += a3 * b1;
-                  xmm6 += a3 * b2;
-                  xmm7 += a4 * b1;
-                  xmm8 += a4 * b2;
-               }
-
-               (~C)(ii+i    ,jbegin+j    ) += sum( xmm1 ) * alpha;
-               (~C)(ii+i    ,jbegin+j+1UL) += sum( xmm2 ) * alpha;
-               (~C)(ii+i+1UL,jbegin+j    ) += sum( xmm3 ) * alpha;
-               (~C)(ii+i+1UL,jbegin+j+1UL) += sum( xmm4 ) * alpha;
-               (~C)(ii+i+2UL,jbegin+j    ) += sum( xmm5 ) * alpha;
-               (~C)(ii+i+2UL,jbegin+j+1UL) += sum( xmm6 ) * alpha;
-               (~C)(ii+i+3UL,jbegin+j    ) += sum( xmm7 ) * alpha;
-               (~C)(ii+i+3UL,jbegin+j+1UL) += sum( xmm8 ) * alpha;
-            }
-
-            for( ; (i+2UL) <= iblock; i+=2UL )
-            {
-               SIMDType xmm1, xmm2, xmm3, xmm4;
-
-               for( size_t k=0UL; k<kblock; k+=SIMDSIZE )
-               {
-                  const SIMDType a1( A2.load(i    ,k) );
-                  const SIMDType a2( A2.load(i+1UL,k) );
-
-                  const SIMDType b1( B2.load(k,j    ) );
-                  const SIMDType b2( B2.load(k,j+1UL) );
-
-                  xmm1 += a1 * b1;
-                  xmm2 += a1 * b2;
-                  xmm3 += a2 * b1;
-                  xmm4 += a2 * b2;
-               }
-
-               (~C)(ii+i    ,jbegin+j    ) += sum( xmm1 ) * alpha;
-               (~C)(ii+i    ,jbegin+j+1UL) += sum( xmm2 ) * alpha;
-               (~C)(ii+i+1UL,jbegin+j    ) += sum( xmm3 ) * alpha;
-               (~C)(ii+i+1UL,jbegin+j+1UL) += sum( xmm4 ) * alpha;
-            }
-
-            if( i<iblock )
-            {
-               SIMDType xmm1, xmm2;
-
-               for( size_t k=0UL; k<kblock; k+=SIMDSIZE )
-               {
-                  const SIMDType a1( A2.load(i,k) );
-
-                  xmm1 += a1 * B2.load(k,j    );
-                  xmm2 += a1 * B2.load(k,j+1UL);
-               }
-
-               (~C)(ii+i,jbegin+j    ) += sum( xmm1 ) * alpha;
-               (~C)(ii+i,jbegin+j+1UL) += sum( xmm2 ) * alpha;
-            }
-         }
-
-         if( j<jsize )
-         {
-            size_t i( 0UL );
-
-            for( ; (i+2UL) <= iblock; i+=2UL )
-            {
-               SIMDType xmm1, xmm2;
-
-               for( size_t k=0UL; k<kblock; k+=SIMDSIZE )
-               {
-                  const SIMDType b1( B2.load(k,j) );
-
-                  xmm1 += A2.load(i    ,k) * b1;
-                  xmm2 += A2.load(i+1UL,k) * b1;
-               }
-
-               (~C)(ii+i    ,jbegin+j) += sum( xmm1 ) * alpha;
-               (~C)(ii+i+1UL,jbegin+j) += sum( xmm2 ) * alpha;
-            }
-
-            if( i<iblock )
-            {
-               SIMDType xmm1;
-
-               for( size_t k=0UL; k<kblock; k+=SIMDSIZE )
-               {
-                  xmm1 += A2.load(i,k) * B2.load(k,j);
-               }
-
-               (~C)(ii+i,jbegin+j) += sum( xmm1 ) * alpha;
-            }
-         }
-
-         ii += iblock;
-      }
-
-      kk += kblock;
-   }
-
-   if( remainder && kk < K )
-   {
-      const size_t ksize( K - kk );
-
-      const size_t jbegin( IsUpper_v<MT3> ? kk : 0UL );
-      const size_t jsize ( N - jbegin );
-
-      B2 = serial( submatrix( B, kk, jbegin, ksize, jsize, unchecked ) );
-
-      size_t ii( 0UL );
-      size_t iblock( 0UL );
-
-      while( ii < M )
-      {
-         iblock = ( ( ii+IBLOCK <= M )?( IBLOCK ):( M - ii ) );
-
-         if( IsLower_v<MT2> && ii+iblock <= kk ) {
-            ii += iblock;
-            continue;
-         }
-
-         A2 = serial( submatrix( A, ii, kk, iblock, ksize, unchecked ) );
-
-         size_t j( 0UL );
-
-         if( IsFloatingPoint_v<ET1> )
-         {
-            for( ; (j+5UL) <= jsize; j+=5UL )
-            {
-               size_t i( 0UL );
-
-               for( ; (i+2UL) <= iblock; i+=2UL ) {
-                  for( size_t k=0UL; k<ksize; ++k ) {
-                     (~C)(ii+i    ,jbegin+j    ) += A2(i    ,k) * B2(k,j    ) * alpha;
-                     (~C)(ii+i    ,jbegin+j+1UL) += A2(i    ,k) * B2(k,j+1UL) * alpha;
-                     (~C)(ii+i    ,jbegin+j+2UL) += A2(i    ,k) * B2(k,j+2UL) * alpha;
-                     (~C)(ii+i    ,jbegin+j+3UL) += A2(i    ,k) * B2(k,j+3UL) * alpha;
-                     (~C)(ii+i    ,jbegin+j+4UL) += A2(i    ,k) * B2(k,j+4UL) * alpha;
-                     (~C)(ii+i+1UL,jbegin+j    ) += A2(i+1UL,k) * B2(k,j    ) * alpha;
-                     (~C)(ii+i+1UL,jbegin+j+1UL) += A2(i+1UL,k) * B2(k,j+1UL) * alpha;
-                     (~C)(ii+i+1UL,jbegin+j+2UL) += A2(i+1UL,k) * B2(k,j+2UL) * alpha;
-                     (~C)(ii+i+1UL,jbegin+j+3UL) += A2(i+1UL,k) * B2(k,j+3UL) * alpha;
-                     (~C)(ii+i+1UL,jbegin+j+4UL) += A2(i+1UL,k) * B2(k,j+4UL) * alpha;
-                  }
-               }
-
-               if( i<iblock ) {
-                  for( size_t k=0UL; k<ksize; ++k ) {
-                     (~C)(ii+i,jbegin+j    ) += A2(i,k) * B2(k,j    ) * alpha;
-                     (~C)(ii+i,jbegin+j+1UL) += A2(i,k) * B2(k,j+1UL) * alpha;
-                     (~C)(ii+i,jbegin+j+2UL) += A2(i,k) * B2(k,j+2UL) * alpha;
-                     (~C)(ii+i,jbegin+j+3UL) += A2(i,k) * B2(k,j+3UL) * alpha;
-                     (~C)(ii+i,jbegin+j+4UL) += A2(i,k) * B2(k,j+4UL) * alpha;
-                  }
-               }
-            }
-         }
-         else
-         {
-            for( ; (j+4UL) <= jsize; j+=4UL )
-            {
-               size_t i( 0UL );
-
-               for( ; (i+2UL) <= iblock; i+=2UL ) {
-                  for( size_t k=0UL; k<ksize; ++k ) {
-                     (~C)(ii+i    ,jbegin+j    ) += A2(i    ,k) * B2(k,j    ) * alpha;
-                     (~C)(ii+i    ,jbegin+j+1UL) += A2(i    ,k) * B2(k,j+1UL) * alpha;
-                     (~C)(ii+i    ,jbegin+j+2UL) += A2(i    ,k) * B2(k,j+2UL) * alpha;
-                     (~C)(ii+i    ,jbegin+j+3UL) += A2(i    ,k) * B2(k,j+3UL) * alpha;
-                     (~C)(ii+i+1UL,jbegin+j    ) += A2(i+1UL,k) * B2(k,j    ) * alpha;
-                     (~C)(ii+i+1UL,jbegin+j+1UL) += A2(i+1UL,k) * B2(k,j+1UL) * alpha;
-                     (~C)(ii+i+1UL,jbegin+j+2UL) += A2(i+1UL,k) * B2(k,j+2UL) * alpha;
-                     (~C)(ii+i+1UL,jbegin+j+3UL) += A2(i+1UL,k) * B2(k,j+3UL) * alpha;
-                  }
-               }
-
-               if( i<iblock ) {
-                  for( size_t k=0UL; k<ksize; ++k ) {
-                     (~C)(ii+i,jbegin+j    ) += A2(i,k) * B2(k,j    ) * alpha;
-                     (~C)(ii+i,jbegin+j+1UL) += A2(i,k) * B2(k,j+1UL) * alpha;
-                     (~C)(ii+i,jbegin+j+2UL) += A2(i,k) * B2(k,j+2UL) * alpha;
-                     (~C)(ii+i,jbegin+j+3UL) += A2(i,k) * B2(k,j+3UL) * alpha;
-                  }
-               }
-            }
-         }
-
-         for( ; (j+2UL) <= jsize; j+=2UL )
-         {
-            size_t i( 0UL );
-
-            for( ; (i+2UL) <= iblock; i+=2UL ) {
-               for( size_t k=0UL; k<ksize; ++k ) {
-                  (~C)(ii+i    ,jbegin+j    ) += A2(i    ,k) * B2(k,j    ) * alpha;
-                  (~C)(ii+i    ,jbegin+j+1UL) += A2(i    ,k) * B2(k,j+1UL) * alpha;
-                  (~C)(ii+i+1UL,jbegin+j    ) += A2(i+1UL,k) * B2(k,j    ) * alpha;
-                  (~C)(ii+i+1UL,jbegin+j+1UL) += A2(i+1UL,k) * B2(k,j+1UL) * alpha;
-               }
-            }
-
-            if( i<iblock ) {
-               for( size_t k=0UL; k<ksize; ++k ) {
-                  (~C)(ii+i,jbegin+j    ) += A2(i,k) * B2(k,j    ) * alpha;
-                  (~C)(ii+i,jbegin+j+1UL) += A2(i,k) * B2(k,j+1UL) * alpha;
-               }
-            }
-         }
-
-         if( j<jsize )
-         {
-            size_t i( 0UL );
-
-            for( ; (i+2UL) <= iblock; i+=2UL ) {
-               for( size_t k=0UL; k<ksize; ++k ) {
-                  (~C)(ii+i    ,jbegin+j) += A2(i    ,k) * B2(k,j) * alpha;
-                  (~C)(ii+i+1UL,jbegin+j) += A2(i+1UL,k) * B2(k,j) * alpha;
-               }
-            }
-
-            if( i<iblock ) {
-               for( size_t k=0UL; k<ksize; ++k ) {
-                  (~C)(ii+i,jbegin+j) += A2(i,k) * B2(k,j) * alpha;
-               }
-            }
-         }
-
-         ii += iblock;
-      }
-   }
+   mmmPacked<true>( ~C, B, A, alpha );
 }
 /*! \endcond */
 //*************************************************************************************************
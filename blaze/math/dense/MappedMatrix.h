@@ -0,0 +1,1320 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/MappedMatrix.h
+//  \brief Header file for the implementation of a memory-mapped, out-of-core dense matrix
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_MAPPEDMATRIX_H_
+#define _BLAZE_MATH_DENSE_MAPPEDMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstring>
+#include <string>
+#include <utility>
+#include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/CustomMatrix.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Vector.h>
+#include <blaze/math/PaddingFlag.h>
+#include <blaze/math/serialization/TypeValueMapping.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/IsOne.h>
+#include <blaze/math/shims/NextMultiple.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/math/views/Subvector.h>
+#include <blaze/system/Blocking.h>
+#include <blaze/system/StorageOrder.h>
+#include <blaze/system/TransposeFlag.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/Exception.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/MemoryMap.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup mapped_matrix MappedMatrix
+// \ingroup dense_matrix
+*/
+/*!\brief Efficient implementation of an out-of-core dense matrix backed by a memory-mapped file.
+// \ingroup mapped_matrix
+//
+// The MappedMatrix class template represents a dense \f$ M \times N \f$ matrix, whose elements
+// are not stored in main memory, but in a file that is mapped into the address space of the
+// process. Therefore the size of a MappedMatrix is only limited by the available disk space and
+// the virtual address space, but not by the available main memory. The type of the elements is
+// specified via the only template parameter:
+
+   \code
+   template< typename Type >
+   class MappedMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. MappedMatrix can be used with any numeric
+//          element type (i.e. integral and floating point types and complex numbers).
+//
+// The matrix is stored in square tiles of \a T rows and columns, which are stored one after
+// another in row-major order. Within a tile, the elements are stored in row-major order with a
+// spacing of \a T elements. Tiles at the bottom and right edge of the matrix are padded with
+// zeros. The file starts with a header of 4096 bytes that stores the element type and the size
+// and tile size of the matrix. The tile size \a T is specified when creating a new matrix
+// (default: 512) and is rounded up to a multiple of the number of elements in a SIMD vector of
+// the element type, such that every row of every tile is properly aligned for vectorization:
+
+   \code
+   using blaze::MappedMatrix;
+
+   // Creating a new 200000x200000 matrix in the file "cov.bin" (~298 GiB)
+   MappedMatrix<double> A( "cov.bin", 200000UL, 200000UL );
+
+   // Opening the existing matrix in the file "input.bin" for reading only
+   const MappedMatrix<double> B( "input.bin" );
+   \endcode
+
+// The elements of the matrix can be accessed directly via the function call operator. However,
+// due to the size of the matrix this should be the exception. Instead, all computations should
+// operate on complete tiles. For that purpose the tile() function provides access to the tile
+// \f$ (ti,tj) \f$ in the form of an aligned CustomMatrix, which can be used in any
+// dense matrix operation:
+
+   \code
+   auto T = A.tile( 2UL, 3UL );  // CustomMatrix referencing the tile (2,3)
+   T *= 2.0;                     // Scaling all elements of the tile
+   \endcode
+
+// Additionally, the following functions stream through the tiles of complete matrices (in
+// case the matrix is used in conjunction with shared memory parallelization, the operations
+// on the single tiles are executed in parallel):
+
+   \code
+   assign( A, X );                    // Assignment of an in-memory dense matrix X (or expression)
+   assign( A, B, blaze::Sqrt() );     // Element-wise A = sqrt( B )
+   assign( A, A, B, blaze::Add() );   // Element-wise A = A + B
+   gemv( y, A, x );                   // Matrix/vector multiplication y = A * x
+   gemm( C, A, B );                   // Matrix/matrix multiplication C = A * B
+   \endcode
+
+// These functions announce the tiles they will access next (see setReadAhead()) to the operating
+// system, such that the reading of the file overlaps with the computation, and remove every
+// tile from the working set of the process as soon as it is no longer needed. Therefore the
+// amount of main memory required by these operations is bounded by a few tiles (plus one row
+// of tiles of the left-hand side operand in case of gemm()).
+//
+// Note that a MappedMatrix is not copyable, but movable. All modifications are written back to
+// the file by the operating system at the latest when the matrix is destroyed. In order to wait
+// until all modifications have been written, the flush() function can be used.
+*/
+template< typename Type >  // Data type of the matrix
+class MappedMatrix
+   : private NonCopyable
+{
+ public:
+   //**Type definitions****************************************************************************
+   using This           = MappedMatrix<Type>;  //!< Type of this MappedMatrix instance.
+   using ElementType    = Type;                //!< Type of the matrix elements.
+   using Reference      = Type&;               //!< Reference to a non-constant matrix element.
+   using ConstReference = const Type&;         //!< Reference to a constant matrix element.
+   using Pointer        = Type*;               //!< Pointer to a non-constant matrix element.
+   using ConstPointer   = const Type*;         //!< Pointer to a constant matrix element.
+
+   //! Type of a non-constant tile of the matrix.
+   using TileType = CustomMatrix<Type,aligned,unpadded,rowMajor>;
+
+   //! Type of a constant tile of the matrix.
+   using ConstTileType = CustomMatrix<const Type,aligned,unpadded,rowMajor>;
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! The number of elements in a SIMD vector of the element type.
+   static constexpr size_t SIMDSIZE = SIMDTrait<Type>::size;
+
+   //! The size of the file header in bytes.
+   static constexpr size_t HEADERSIZE = 4096UL;
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline MappedMatrix() noexcept;
+   explicit inline MappedMatrix( const std::string& file, bool writable = false );
+   inline MappedMatrix( const std::string& file, size_t m, size_t n,
+                        size_t tileSize = MAPPEDMATRIX_TILE_SIZE );
+   inline MappedMatrix( MappedMatrix&& m ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   ~MappedMatrix() = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference      operator()( size_t i, size_t j ) noexcept;
+   inline ConstReference operator()( size_t i, size_t j ) const noexcept;
+   inline Reference      at( size_t i, size_t j );
+   inline ConstReference at( size_t i, size_t j ) const;
+   inline Pointer        data( size_t ti, size_t tj ) noexcept;
+   inline ConstPointer   data( size_t ti, size_t tj ) const noexcept;
+   inline TileType       tile( size_t ti, size_t tj );
+   inline ConstTileType  tile( size_t ti, size_t tj ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline MappedMatrix& operator=( MappedMatrix&& rhs ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows() const noexcept;
+   inline size_t columns() const noexcept;
+   inline size_t tileSize() const noexcept;
+   inline size_t tileRows() const noexcept;
+   inline size_t tileColumns() const noexcept;
+   inline bool   isWritable() const noexcept;
+   inline size_t readAhead() const noexcept;
+   inline void   setReadAhead( size_t tiles ) noexcept;
+   inline void   prefetch( size_t ti, size_t tj ) const noexcept;
+   inline void   release( size_t ti, size_t tj ) const noexcept;
+   inline void   flush();
+   inline void   swap( MappedMatrix& m ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! The layout of the file header.
+   struct Header {
+      char     magic[8];  //!< The identification of the file format.
+      uint64_t version;   //!< The version of the file format.
+      uint64_t type;      //!< The type ID of the element type (see TypeValueMapping).
+      uint64_t size;      //!< The size of the element type in bytes.
+      uint64_t rows;      //!< The number of rows of the matrix.
+      uint64_t columns;   //!< The number of columns of the matrix.
+      uint64_t tileSize;  //!< The number of rows and columns of a tile.
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline void   setup( size_t m, size_t n, size_t tileSize ) noexcept;
+   inline size_t tileOffset( size_t ti, size_t tj ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   MemoryMap map_;        //!< The memory map of the underlying file.
+   size_t    m_;          //!< The current number of rows of the matrix.
+   size_t    n_;          //!< The current number of columns of the matrix.
+   size_t    tile_;       //!< The number of rows and columns of a tile.
+   size_t    tm_;         //!< The number of rows of tiles.
+   size_t    tn_;         //!< The number of columns of tiles.
+   size_t    readAhead_;  //!< The number of tiles to read ahead.
+   Type*     v_;          //!< The first element of the first tile.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST   ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE( Type );
+   BLAZE_STATIC_ASSERT( sizeof( Header ) <= HEADERSIZE );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for MappedMatrix.
+//
+// The default constructor creates an empty matrix that is not associated with any file.
+*/
+template< typename Type >  // Data type of the matrix
+inline MappedMatrix<Type>::MappedMatrix() noexcept
+   : map_      ()          // The memory map of the underlying file
+   , m_        ( 0UL )     // The current number of rows of the matrix
+   , n_        ( 0UL )     // The current number of columns of the matrix
+   , tile_     ( 0UL )     // The number of rows and columns of a tile
+   , tm_       ( 0UL )     // The number of rows of tiles
+   , tn_       ( 0UL )     // The number of columns of tiles
+   , readAhead_( 2UL )     // The number of tiles to read ahead
+   , v_        ( nullptr ) // The first element of the first tile
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Opening an existing matrix file.
+//
+// \param file The name of the matrix file.
+// \param writable \a true to open the matrix for reading and writing, \a false for reading only.
+// \exception std::runtime_error File could not be opened.
+// \exception std::runtime_error File could not be mapped.
+// \exception std::runtime_error Invalid matrix file.
+// \exception std::runtime_error Incompatible element type.
+//
+// This constructor maps the matrix stored in the given file, which must have been created by
+// a MappedMatrix with the same element type. In case the matrix is opened for reading only,
+// the matrix must not be modified.
+*/
+template< typename Type >  // Data type of the matrix
+inline MappedMatrix<Type>::MappedMatrix( const std::string& file, bool writable )
+   : MappedMatrix()
+{
+   map_ = MemoryMap( file, writable );
+
+   Header header;
+
+   if( map_.size() < HEADERSIZE ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid matrix file" );
+   }
+
+   std::memcpy( &header, map_.data(), sizeof( Header ) );
+
+   if( std::memcmp( header.magic, "BLAZEMM", 8UL ) != 0 || header.version != 1U ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid matrix file" );
+   }
+
+   if( header.type != uint64_t( TypeValueMapping<Type>::value ) ||
+       header.size != uint64_t( sizeof( Type ) ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Incompatible element type" );
+   }
+
+   if( header.tileSize == 0U || header.tileSize % SIMDSIZE != 0U ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Incompatible tile size" );
+   }
+
+   setup( header.rows, header.columns, header.tileSize );
+
+   if( map_.size() != HEADERSIZE + tm_*tn_*tile_*tile_*sizeof(Type) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid matrix file" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creating a new matrix file.
+//
+// \param file The name of the matrix file.
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param tileSize The number of rows and columns of a tile (default: 512).
+// \exception std::invalid_argument Invalid tile size.
+// \exception std::runtime_error File could not be opened.
+// \exception std::runtime_error File could not be resized.
+// \exception std::runtime_error File could not be mapped.
+//
+// This constructor creates a new \f$ m \times n \f$ matrix in the given file (an existing file
+// is overwritten) and opens it for reading and writing. All elements are initialized to 0. The
+// given tile size is rounded up to a multiple of the number of elements in a SIMD vector of the
+// element type.
+*/
+template< typename Type >  // Data type of the matrix
+inline MappedMatrix<Type>::MappedMatrix( const std::string& file, size_t m, size_t n, size_t tileSize )
+   : MappedMatrix()
+{
+   if( tileSize == 0UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid tile size" );
+   }
+
+   setup( m, n, nextMultiple( tileSize, SIMDSIZE ) );
+
+   map_ = MemoryMap( file, HEADERSIZE + tm_*tn_*tile_*tile_*sizeof(Type) );
+   v_   = reinterpret_cast<Type*>( map_.data() + HEADERSIZE );
+
+   Header header;
+   std::memcpy( header.magic, "BLAZEMM", 8UL );
+   header.version  = 1U;
+   header.type     = TypeValueMapping<Type>::value;
+   header.size     = sizeof( Type );
+   header.rows     = m_;
+   header.columns  = n_;
+   header.tileSize = tile_;
+
+   std::memcpy( map_.data(), &header, sizeof( Header ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The move constructor for MappedMatrix.
+//
+// \param m The matrix to be moved into this instance.
+*/
+template< typename Type >  // Data type of the matrix
+inline MappedMatrix<Type>::MappedMatrix( MappedMatrix&& m ) noexcept
+   : MappedMatrix()
+{
+   swap( m );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access indices.
+*/
+template< typename Type >  // Data type of the matrix
+inline typename MappedMatrix<Type>::Reference
+   MappedMatrix<Type>::operator()( size_t i, size_t j ) noexcept
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < n_, "Invalid column access index" );
+   BLAZE_USER_ASSERT( map_.isWritable(), "Invalid access to read-only matrix" );
+
+   return v_[ tileOffset( i/tile_, j/tile_ ) + (i%tile_)*tile_ + j%tile_ ];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief 2D-access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access indices.
+*/
+template< typename Type >  // Data type of the matrix
+inline typename MappedMatrix<Type>::ConstReference
+   MappedMatrix<Type>::operator()( size_t i, size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < n_, "Invalid column access index" );
+
+   return v_[ tileOffset( i/tile_, j/tile_ ) + (i%tile_)*tile_ + j%tile_ ];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid matrix access index.
+// \exception std::logic_error Invalid access to read-only matrix.
+//
+// In contrast to the function call operator this function always performs a check of the
+// given access indices.
+*/
+template< typename Type >  // Data type of the matrix
+inline typename MappedMatrix<Type>::Reference
+   MappedMatrix<Type>::at( size_t i, size_t j )
+{
+   if( i >= m_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   if( !map_.isWritable() ) {
+      BLAZE_THROW_LOGIC_ERROR( "Invalid access to read-only matrix" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid matrix access index.
+//
+// In contrast to the function call operator this function always performs a check of the
+// given access indices.
+*/
+template< typename Type >  // Data type of the matrix
+inline typename MappedMatrix<Type>::ConstReference
+   MappedMatrix<Type>::at( size_t i, size_t j ) const
+{
+   if( i >= m_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the elements of a single tile.
+//
+// \param ti The row index of the tile. The index has to be in the range \f$[0..tileRows()-1]\f$.
+// \param tj The column index of the tile. The index has to be in the range \f$[0..tileColumns()-1]\f$.
+// \return Pointer to the first element of the tile.
+//
+// The tile consists of \f$ T \times T \f$ elements in row-major order, where \a T is the tile
+// size. Elements of the tiles at the bottom and right edge of the matrix that lie outside of the
+// matrix are zero padding elements.
+*/
+template< typename Type >  // Data type of the matrix
+inline typename MappedMatrix<Type>::Pointer
+   MappedMatrix<Type>::data( size_t ti, size_t tj ) noexcept
+{
+   BLAZE_USER_ASSERT( ti < tm_, "Invalid tile row access index"    );
+   BLAZE_USER_ASSERT( tj < tn_, "Invalid tile column access index" );
+   BLAZE_USER_ASSERT( map_.isWritable(), "Invalid access to read-only matrix" );
+
+   return v_ + tileOffset( ti, tj );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the elements of a single tile.
+//
+// \param ti The row index of the tile. The index has to be in the range \f$[0..tileRows()-1]\f$.
+// \param tj The column index of the tile. The index has to be in the range \f$[0..tileColumns()-1]\f$.
+// \return Pointer to the first element of the tile.
+//
+// The tile consists of \f$ T \times T \f$ elements in row-major order, where \a T is the tile
+// size. Elements of the tiles at the bottom and right edge of the matrix that lie outside of the
+// matrix are zero padding elements.
+*/
+template< typename Type >  // Data type of the matrix
+inline typename MappedMatrix<Type>::ConstPointer
+   MappedMatrix<Type>::data( size_t ti, size_t tj ) const noexcept
+{
+   BLAZE_USER_ASSERT( ti < tm_, "Invalid tile row access index"    );
+   BLAZE_USER_ASSERT( tj < tn_, "Invalid tile column access index" );
+
+   return v_ + tileOffset( ti, tj );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Access to a single tile of the matrix.
+//
+// \param ti The row index of the tile. The index has to be in the range \f$[0..tileRows()-1]\f$.
+// \param tj The column index of the tile. The index has to be in the range \f$[0..tileColumns()-1]\f$.
+// \return Custom matrix referencing the elements of the tile.
+//
+// This function returns an aligned CustomMatrix referencing the elements of the tile
+// \f$ (ti,tj) \f$, i.e. the elements in the rows \f$ [ti \cdot T..ti \cdot T+T-1] \f$ and the
+// columns \f$ [tj \cdot T..tj \cdot T+T-1] \f$ of the matrix. The tiles at the bottom and right
+// edge of the matrix are correspondingly smaller. This function only performs an index check in
+// case BLAZE_USER_ASSERT() is active.
+*/
+template< typename Type >  // Data type of the matrix
+inline typename MappedMatrix<Type>::TileType
+   MappedMatrix<Type>::tile( size_t ti, size_t tj )
+{
+   BLAZE_USER_ASSERT( ti < tm_, "Invalid tile row access index"    );
+   BLAZE_USER_ASSERT( tj < tn_, "Invalid tile column access index" );
+   BLAZE_USER_ASSERT( map_.isWritable(), "Invalid access to read-only matrix" );
+
+   return TileType( v_ + tileOffset( ti, tj ),
+                    min( tile_, m_ - ti*tile_ ), min( tile_, n_ - tj*tile_ ), tile_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Access to a single tile of the matrix.
+//
+// \param ti The row index of the tile. The index has to be in the range \f$[0..tileRows()-1]\f$.
+// \param tj The column index of the tile. The index has to be in the range \f$[0..tileColumns()-1]\f$.
+// \return Custom matrix referencing the elements of the tile.
+//
+// This function returns an aligned CustomMatrix referencing the elements of the tile
+// \f$ (ti,tj) \f$, i.e. the elements in the rows \f$ [ti \cdot T..ti \cdot T+T-1] \f$ and the
+// columns \f$ [tj \cdot T..tj \cdot T+T-1] \f$ of the matrix. The tiles at the bottom and right
+// edge of the matrix are correspondingly smaller. This function only performs an index check in
+// case BLAZE_USER_ASSERT() is active.
+*/
+template< typename Type >  // Data type of the matrix
+inline typename MappedMatrix<Type>::ConstTileType
+   MappedMatrix<Type>::tile( size_t ti, size_t tj ) const
+{
+   BLAZE_USER_ASSERT( ti < tm_, "Invalid tile row access index"    );
+   BLAZE_USER_ASSERT( tj < tn_, "Invalid tile column access index" );
+
+   return ConstTileType( v_ + tileOffset( ti, tj ),
+                         min( tile_, m_ - ti*tile_ ), min( tile_, n_ - tj*tile_ ), tile_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Move assignment operator for MappedMatrix.
+//
+// \param rhs The matrix to be moved into this instance.
+// \return Reference to the assigned matrix.
+*/
+template< typename Type >  // Data type of the matrix
+inline MappedMatrix<Type>& MappedMatrix<Type>::operator=( MappedMatrix&& rhs ) noexcept
+{
+   MappedMatrix tmp( std::move( rhs ) );
+   swap( tmp );
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the matrix.
+//
+// \return The number of rows of the matrix.
+*/
+template< typename Type >  // Data type of the matrix
+inline size_t MappedMatrix<Type>::rows() const noexcept
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the matrix.
+//
+// \return The number of columns of the matrix.
+*/
+template< typename Type >  // Data type of the matrix
+inline size_t MappedMatrix<Type>::columns() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows and columns of a tile.
+//
+// \return The number of rows and columns of a tile.
+*/
+template< typename Type >  // Data type of the matrix
+inline size_t MappedMatrix<Type>::tileSize() const noexcept
+{
+   return tile_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows of tiles.
+//
+// \return The number of rows of tiles.
+*/
+template< typename Type >  // Data type of the matrix
+inline size_t MappedMatrix<Type>::tileRows() const noexcept
+{
+   return tm_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of columns of tiles.
+//
+// \return The number of columns of tiles.
+*/
+template< typename Type >  // Data type of the matrix
+inline size_t MappedMatrix<Type>::tileColumns() const noexcept
+{
+   return tn_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can be modified.
+//
+// \return \a true in case the matrix is opened for reading and writing, \a false if not.
+*/
+template< typename Type >  // Data type of the matrix
+inline bool MappedMatrix<Type>::isWritable() const noexcept
+{
+   return map_.isWritable();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of tiles that are read ahead by the streaming operations.
+//
+// \return The number of tiles to read ahead.
+*/
+template< typename Type >  // Data type of the matrix
+inline size_t MappedMatrix<Type>::readAhead() const noexcept
+{
+   return readAhead_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the number of tiles that are read ahead by the streaming operations.
+//
+// \param tiles The number of tiles to read ahead (default: 2).
+// \return void
+//
+// This function sets the number of tiles the streaming operations (assign(), gemv() and gemm())
+// announce to the operating system before they are accessed. A larger number hides the latency
+// of the storage device more reliably, but increases the amount of main memory in use. In case
+// \a tiles is 0, no tiles are read ahead.
+*/
+template< typename Type >  // Data type of the matrix
+inline void MappedMatrix<Type>::setReadAhead( size_t tiles ) noexcept
+{
+   readAhead_ = tiles;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Announces that the given tile will be accessed soon.
+//
+// \param ti The row index of the tile.
+// \param tj The column index of the tile.
+// \return void
+//
+// This function triggers an asynchronous read of the given tile from the file. In case the
+// given tile does not exist, the function has no effect.
+*/
+template< typename Type >  // Data type of the matrix
+inline void MappedMatrix<Type>::prefetch( size_t ti, size_t tj ) const noexcept
+{
+   if( ti < tm_ && tj < tn_ ) {
+      map_.willNeed( HEADERSIZE + tileOffset( ti, tj )*sizeof(Type), tile_*tile_*sizeof(Type) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removes the given tile from the working set of the process.
+//
+// \param ti The row index of the tile.
+// \param tj The column index of the tile.
+// \return void
+//
+// This function initiates the write back of all modifications of the given tile and releases
+// the main memory occupied by the tile. The content of the tile is not affected. In case the
+// given tile does not exist, the function has no effect.
+*/
+template< typename Type >  // Data type of the matrix
+inline void MappedMatrix<Type>::release( size_t ti, size_t tj ) const noexcept
+{
+   if( ti < tm_ && tj < tn_ ) {
+      map_.release( HEADERSIZE + tileOffset( ti, tj )*sizeof(Type), tile_*tile_*sizeof(Type) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes all modifications of the matrix back to the file.
+//
+// \return void
+// \exception std::runtime_error File could not be written.
+*/
+template< typename Type >  // Data type of the matrix
+inline void MappedMatrix<Type>::flush()
+{
+   map_.flush();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two matrices.
+//
+// \param m The matrix to be swapped.
+// \return void
+*/
+template< typename Type >  // Data type of the matrix
+inline void MappedMatrix<Type>::swap( MappedMatrix& m ) noexcept
+{
+   using std::swap;
+
+   swap( map_      , m.map_       );
+   swap( m_        , m.m_         );
+   swap( n_        , m.n_         );
+   swap( tile_     , m.tile_      );
+   swap( tm_       , m.tm_        );
+   swap( tn_       , m.tn_        );
+   swap( readAhead_, m.readAhead_ );
+   swap( v_        , m.v_         );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the size and tile size of the matrix.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param tileSize The number of rows and columns of a tile.
+// \return void
+*/
+template< typename Type >  // Data type of the matrix
+inline void MappedMatrix<Type>::setup( size_t m, size_t n, size_t tileSize ) noexcept
+{
+   m_    = m;
+   n_    = n;
+   tile_ = tileSize;
+   tm_   = ( m + tileSize - 1UL ) / tileSize;
+   tn_   = ( n + tileSize - 1UL ) / tileSize;
+   v_    = reinterpret_cast<Type*>( map_.data() + HEADERSIZE );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the offset of the first element of the given tile.
+//
+// \param ti The row index of the tile.
+// \param tj The column index of the tile.
+// \return The offset of the tile in elements.
+*/
+template< typename Type >  // Data type of the matrix
+inline size_t MappedMatrix<Type>::tileOffset( size_t ti, size_t tj ) const noexcept
+{
+   return ( ti*tn_ + tj ) * tile_ * tile_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name MappedMatrix operators */
+//@{
+template< typename Type >
+void swap( MappedMatrix<Type>& a, MappedMatrix<Type>& b ) noexcept;
+
+template< typename Type, typename MT, bool SO >
+void assign( MappedMatrix<Type>& C, const DenseMatrix<MT,SO>& A );
+
+template< typename Type1, typename Type2, typename OP >
+void assign( MappedMatrix<Type1>& C, const MappedMatrix<Type2>& A, OP op );
+
+template< typename Type1, typename Type2, typename Type3, typename OP >
+void assign( MappedMatrix<Type1>& C, const MappedMatrix<Type2>& A,
+             const MappedMatrix<Type3>& B, OP op );
+
+template< typename VT1, typename Type, typename VT2, typename ST = ElementType_t<VT1> >
+void gemv( DenseVector<VT1,columnVector>& y, const MappedMatrix<Type>& A,
+           const DenseVector<VT2,columnVector>& x, const ST& alpha = ST(1), const ST& beta = ST() );
+
+template< typename Type >
+void gemm( MappedMatrix<Type>& C, const MappedMatrix<Type>& A, const MappedMatrix<Type>& B,
+           const Type& alpha = Type(1), const Type& beta = Type() );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two matrices.
+// \ingroup mapped_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+*/
+template< typename Type >  // Data type of the matrix
+inline void swap( MappedMatrix<Type>& a, MappedMatrix<Type>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Read-only access to a single tile of a mapped matrix operand.
+// \ingroup mapped_matrix
+//
+// \param A The mapped matrix.
+// \param ti The row index of the tile.
+// \param tj The column index of the tile.
+// \return Constant custom matrix referencing the elements of the tile.
+//
+// In contrast to MappedMatrix::tile() this function returns a constant CustomMatrix with
+// non-const element type, since several of the optimized dense matrix kernels are not available
+// for const-qualified element types.
+*/
+template< typename Type >  // Data type of the matrix
+inline const CustomMatrix<Type,aligned,unpadded,rowMajor>
+   operandTile( const MappedMatrix<Type>& A, size_t ti, size_t tj )
+{
+   const size_t T( A.tileSize() );
+
+   return CustomMatrix<Type,aligned,unpadded,rowMajor>(
+      const_cast<Type*>( A.data( ti, tj ) ),
+      min( T, A.rows() - ti*T ), min( T, A.columns() - tj*T ), T );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Streaming of a tile-wise operation through the tiles of a mapped matrix.
+// \ingroup mapped_matrix
+//
+// \param C The target matrix.
+// \param next Function announcing the given tile of all operands (prefetch or release).
+// \param kernel Function computing the given tile of the target matrix.
+// \return void
+// \exception std::invalid_argument Invalid access to read-only matrix.
+//
+// This auxiliary function traverses all tiles of the target matrix in row-major order. Before
+// computing a tile, the tile the given number of steps ahead is prefetched, after computing it
+// the tile is released from the working set.
+*/
+template< typename Type      // Data type of the target matrix
+        , typename Prefetch  // Type of the prefetch function
+        , typename Release   // Type of the release function
+        , typename Kernel >  // Type of the tile kernel
+void streamTiles( MappedMatrix<Type>& C, Prefetch prefetch, Release release, Kernel kernel )
+{
+   if( !C.isWritable() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid access to read-only matrix" );
+   }
+
+   const size_t tn   ( C.tileColumns() );
+   const size_t tiles( C.tileRows() * tn );
+
+   for( size_t l=0UL; l<C.readAhead() && l<tiles; ++l ) {
+      prefetch( l/tn, l%tn );
+   }
+
+   for( size_t l=0UL; l<tiles; ++l )
+   {
+      if( l+C.readAhead() < tiles ) {
+         prefetch( (l+C.readAhead())/tn, (l+C.readAhead())%tn );
+      }
+
+      kernel( l/tn, l%tn );
+      release( l/tn, l%tn );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment of a dense matrix to a mapped matrix (\f$ C=A \f$).
+// \ingroup mapped_matrix
+//
+// \param C The target matrix.
+// \param A The dense matrix (or dense matrix expression) to be assigned.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Invalid access to read-only matrix.
+//
+// This function assigns the given in-memory dense matrix or dense matrix expression tile by
+// tile to the mapped matrix \a C. In case \a A is an expression, only the part of the expression
+// corresponding to a single tile is evaluated at a time.
+*/
+template< typename Type  // Data type of the target matrix
+        , typename MT    // Type of the dense matrix
+        , bool SO >      // Storage order of the dense matrix
+void assign( MappedMatrix<Type>& C, const DenseMatrix<MT,SO>& A )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( C.rows() != (~A).rows() || C.columns() != (~A).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   const size_t T( C.tileSize() );
+
+   streamTiles( C,
+      [&]( size_t ti, size_t tj ) { C.prefetch( ti, tj ); },
+      [&]( size_t ti, size_t tj ) { C.release( ti, tj ); },
+      [&]( size_t ti, size_t tj ) {
+         auto Ct = C.tile( ti, tj );
+         Ct = submatrix( ~A, ti*T, tj*T, Ct.rows(), Ct.columns(), unchecked );
+      } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Element-wise assignment of a unary operation on a mapped matrix (\f$ C=op(A) \f$).
+// \ingroup mapped_matrix
+//
+// \param C The target matrix.
+// \param A The operand matrix.
+// \param op The custom operation (see the map() function).
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Tile sizes do not match.
+// \exception std::invalid_argument Invalid access to read-only matrix.
+//
+// This function streams through the tiles of \a A and assigns the result of the given unary
+// operation to the according tiles of \a C. Both matrices must have the same size and tile
+// size. The target matrix is allowed to be identical to the operand.
+*/
+template< typename Type1  // Data type of the target matrix
+        , typename Type2  // Data type of the operand matrix
+        , typename OP >   // Type of the custom operation
+void assign( MappedMatrix<Type1>& C, const MappedMatrix<Type2>& A, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( C.rows() != A.rows() || C.columns() != A.columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   if( C.tileSize() != A.tileSize() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Tile sizes do not match" );
+   }
+
+   streamTiles( C,
+      [&]( size_t ti, size_t tj ) { A.prefetch( ti, tj ); C.prefetch( ti, tj ); },
+      [&]( size_t ti, size_t tj ) { A.release( ti, tj ); C.release( ti, tj ); },
+      [&]( size_t ti, size_t tj ) {
+         C.tile( ti, tj ) = map( operandTile( A, ti, tj ), op );
+      } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Element-wise assignment of a binary operation on two mapped matrices (\f$ C=op(A,B) \f$).
+// \ingroup mapped_matrix
+//
+// \param C The target matrix.
+// \param A The left-hand side operand matrix.
+// \param B The right-hand side operand matrix.
+// \param op The custom operation (see the map() function).
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Tile sizes do not match.
+// \exception std::invalid_argument Invalid access to read-only matrix.
+//
+// This function streams through the tiles of \a A and \a B and assigns the result of the given
+// binary operation to the according tiles of \a C. All three matrices must have the same size
+// and tile size. The target matrix is allowed to be identical to one or both operands.
+*/
+template< typename Type1  // Data type of the target matrix
+        , typename Type2  // Data type of the left-hand side operand matrix
+        , typename Type3  // Data type of the right-hand side operand matrix
+        , typename OP >   // Type of the custom operation
+void assign( MappedMatrix<Type1>& C, const MappedMatrix<Type2>& A,
+             const MappedMatrix<Type3>& B, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( C.rows() != A.rows() || C.columns() != A.columns() ||
+       C.rows() != B.rows() || C.columns() != B.columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   if( C.tileSize() != A.tileSize() || C.tileSize() != B.tileSize() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Tile sizes do not match" );
+   }
+
+   streamTiles( C,
+      [&]( size_t ti, size_t tj ) { A.prefetch( ti, tj ); B.prefetch( ti, tj ); C.prefetch( ti, tj ); },
+      [&]( size_t ti, size_t tj ) { A.release( ti, tj ); B.release( ti, tj ); C.release( ti, tj ); },
+      [&]( size_t ti, size_t tj ) {
+         C.tile( ti, tj ) = map( operandTile( A, ti, tj ), operandTile( B, ti, tj ), op );
+      } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication of a mapped matrix and a dense vector (\f$ y=\alpha A x+\beta y \f$).
+// \ingroup mapped_matrix
+//
+// \param y The target dense column vector.
+// \param A The mapped matrix.
+// \param x The right-hand side dense column vector.
+// \param alpha The scaling factor for the product (default: 1).
+// \param beta The scaling factor for the target vector (default: 0).
+// \return void
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function streams through the tiles of \a A in row-major order and multiplies them with
+// the according parts of the in-memory vector \a x. In case \a beta is 0, \a y is resized to the
+// number of rows of \a A and its previous values are not used. Otherwise \a y must have as many
+// elements as \a A has rows. The target vector is allowed to be identical to \a x.
+*/
+template< typename VT1   // Type of the target vector
+        , typename Type  // Data type of the matrix
+        , typename VT2   // Type of the right-hand side vector
+        , typename ST >  // Type of the scaling factors
+void gemv( DenseVector<VT1,columnVector>& y, const MappedMatrix<Type>& A,
+           const DenseVector<VT2,columnVector>& x, const ST& alpha, const ST& beta )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( A.columns() != (~x).size() || ( !isDefault( beta ) && A.rows() != (~y).size() ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   if( isSame( ~y, ~x ) ) {
+      const ResultType_t<VT2> tmp( ~x );
+      gemv( ~y, A, tmp, alpha, beta );
+      return;
+   }
+
+   if( isDefault( beta ) ) {
+      resize( ~y, A.rows(), false );
+   }
+
+   const size_t T ( A.tileSize() );
+   const size_t tn( A.tileColumns() );
+   const size_t tiles( A.tileRows() * tn );
+
+   DynamicVector< ElementType_t<VT1>, columnVector > tmp;
+
+   for( size_t l=0UL; l<A.readAhead() && l<tiles; ++l ) {
+      A.prefetch( l/tn, l%tn );
+   }
+
+   for( size_t ti=0UL; ti<A.tileRows(); ++ti )
+   {
+      const size_t mt( min( T, A.rows() - ti*T ) );
+
+      tmp.resize( mt, false );
+      reset( tmp );
+
+      for( size_t tj=0UL; tj<tn; ++tj )
+      {
+         const size_t l( ti*tn + tj + A.readAhead() );
+         if( l < tiles ) {
+            A.prefetch( l/tn, l%tn );
+         }
+
+         const auto At( operandTile( A, ti, tj ) );
+         tmp += At * subvector( ~x, tj*T, At.columns(), unchecked );
+
+         A.release( ti, tj );
+      }
+
+      auto yt = subvector( ~y, ti*T, mt, unchecked );
+
+      if( isDefault( beta ) ) {
+         if( isOne( alpha ) ) yt = tmp;
+         else yt = alpha * tmp;
+      }
+      else {
+         yt = alpha * tmp + beta * yt;
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication of two mapped matrices (\f$ C=\alpha A B+\beta C \f$).
+// \ingroup mapped_matrix
+//
+// \param C The target matrix.
+// \param A The left-hand side matrix.
+// \param B The right-hand side matrix.
+// \param alpha The scaling factor for the product (default: 1).
+// \param beta The scaling factor for the target matrix (default: 0).
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Tile sizes do not match.
+// \exception std::invalid_argument Invalid access to read-only matrix.
+// \exception std::invalid_argument Invalid aliasing of target and operand matrix.
+//
+// This function computes the matrix product tile by tile. The tiles of \a C are computed in
+// row-major order, where every tile is accumulated in main memory from the according row of
+// tiles of \a A and column of tiles of \a B. Whereas every tile of \a B and \a C is released
+// immediately after its use, each row of tiles of \a A is kept until all tiles of the according
+// row of \a C have been computed. Therefore the main memory required by this function amounts to
+// \f$ T \cdot K \f$ elements of \a A plus a few tiles, where \a T is the tile size and \a K is
+// the number of columns of \a A. All matrices must have the same tile size and \a C must
+// already have the size of the product. Since the target matrix is computed in-place, it must
+// not be identical to one of the operands (i.e. neither the same object nor the same file).
+*/
+template< typename Type >  // Data type of the matrices
+void gemm( MappedMatrix<Type>& C, const MappedMatrix<Type>& A, const MappedMatrix<Type>& B,
+           const Type& alpha, const Type& beta )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( A.columns() != B.rows() || C.rows() != A.rows() || C.columns() != B.columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   if( C.tileSize() != A.tileSize() || C.tileSize() != B.tileSize() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Tile sizes do not match" );
+   }
+
+   if( &C == &A || &C == &B ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid aliasing of target and operand matrix" );
+   }
+
+   const size_t tk   ( A.tileColumns() );
+   const size_t steps( C.tileColumns() * tk );
+
+   DynamicMatrix<Type,rowMajor> tmp;
+
+   streamTiles( C,
+      [&]( size_t ti, size_t tj ) { if( !isDefault( beta ) ) C.prefetch( ti, tj ); },
+      [&]( size_t ti, size_t tj ) {
+         C.release( ti, tj );
+         if( tj+1UL == C.tileColumns() ) {
+            for( size_t k=0UL; k<tk; ++k ) A.release( ti, k );
+         }
+      },
+      [&]( size_t ti, size_t tj ) {
+         auto Ct = C.tile( ti, tj );
+
+         tmp.resize( Ct.rows(), Ct.columns(), false );
+         reset( tmp );
+
+         for( size_t k=0UL; k<tk; ++k )
+         {
+            // Read-ahead within the column of tiles of B (continuing with the next column of
+            // tiles) and, during the first column of tiles, within the row of tiles of A
+            const size_t l( ( tj*tk + k + B.readAhead() ) % steps );
+            B.prefetch( l%tk, l/tk );
+            if( tj == 0UL ) {
+               A.prefetch( ti, k+A.readAhead() );
+            }
+
+            tmp += operandTile( A, ti, k ) * operandTile( B, k, tj );
+
+            B.release( k, tj );
+         }
+
+         // The temporary never aliases the tile, which makes the alias check (and the according
+         // copy) of the assignment operator superfluous
+         if( isDefault( beta ) ) {
+            if( isOne( alpha ) ) smpAssign( Ct, tmp );
+            else Ct = alpha * tmp;
+         }
+         else {
+            Ct = alpha * tmp + beta * Ct;
+         }
+      } );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -114,6 +114,7 @@
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
 #include <blaze/util/IntegralConstant.h>
+#include <blaze/util/KernelTrace.h>
 #include <blaze/util/mpl/If.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/IsBuiltin.h>
@@ -561,10 +562,16 @@ class DMatDMatMultExpr
    {
       if( ( IsDiagonal_v<MT5> ) ||
           ( !BLAZE_DEBUG_MODE && B.columns() <= SIMDSIZE*10UL ) ||
-          ( C.rows() * C.columns() < DMATDMATMULT_THRESHOLD ) )
+          ( C.rows() * C.columns() < DMATDMATMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_TRACE( "DMatDMatMultExpr::assign", "small", A.rows(), B.columns(), A.columns() );
          selectSmallAssignKernel( C, A, B );
-      else
+      }
+      else {
+         BLAZE_KERNEL_TRACE( "DMatDMatMultExpr::assign",
+                             ( UseBlasKernel_v<MT3,MT4,MT5> )?( "blas" ):( UseVectorizedDefaultKernel_v<MT3,MT4,MT5> )?( "large" ):( "default" ),
+                             A.rows(), B.columns(), A.columns() );
          selectBlasAssignKernel( C, A, B );
+      }
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -1921,10 +1928,16 @@ class DMatDMatMultExpr
    {
       if( ( IsDiagonal_v<MT5> ) ||
           ( !BLAZE_DEBUG_MODE && B.columns() <= SIMDSIZE*10UL ) ||
-          ( C.rows() * C.columns() < DMATDMATMULT_THRESHOLD ) )
+          ( C.rows() * C.columns() < DMATDMATMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_TRACE( "DMatDMatMultExpr::addAssign", "small", A.rows(), B.columns(), A.columns() );
          selectSmallAddAssignKernel( C, A, B );
-      else
+      }
+      else {
+         BLAZE_KERNEL_TRACE( "DMatDMatMultExpr::addAssign",
+                             ( UseBlasKernel_v<MT3,MT4,MT5> )?( "blas" ):( UseVectorizedDefaultKernel_v<MT3,MT4,MT5> )?( "large" ):( "default" ),
+                             A.rows(), B.columns(), A.columns() );
          selectBlasAddAssignKernel( C, A, B );
+      }
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -3137,10 +3150,16 @@ class DMatDMatMultExpr
    {
       if( ( IsDiagonal_v<MT5> ) ||
           ( !BLAZE_DEBUG_MODE && B.columns() <= SIMDSIZE*10UL ) ||
-          ( C.rows() * C.columns() < DMATDMATMULT_THRESHOLD ) )
+          ( C.rows() * C.columns() < DMATDMATMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_TRACE( "DMatDMatMultExpr::subAssign", "small", A.rows(), B.columns(), A.columns() );
          selectSmallSubAssignKernel( C, A, B );
-      else
+      }
+      else {
+         BLAZE_KERNEL_TRACE( "DMatDMatMultExpr::subAssign",
+                             ( UseBlasKernel_v<MT3,MT4,MT5> )?( "blas" ):( UseVectorizedDefaultKernel_v<MT3,MT4,MT5> )?( "large" ):( "default" ),
+                             A.rows(), B.columns(), A.columns() );
          selectBlasSubAssignKernel( C, A, B );
+      }
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -5095,10 +5114,16 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
    {
       if( ( IsDiagonal_v<MT5> ) ||
           ( !BLAZE_DEBUG_MODE && B.columns() <= SIMDSIZE*10UL ) ||
-          ( C.rows() * C.columns() < DMATDMATMULT_THRESHOLD ) )
+          ( C.rows() * C.columns() < DMATDMATMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_TRACE( "DMatScalarMultExpr<DMatDMatMultExpr>::assign", "small", A.rows(), B.columns(), A.columns() );
          selectSmallAssignKernel( C, A, B, scalar );
-      else
+      }
+      else {
+         BLAZE_KERNEL_TRACE( "DMatScalarMultExpr<DMatDMatMultExpr>::assign",
+                             ( UseBlasKernel_v<MT3,MT4,MT5,ST2> )?( "blas" ):( UseVectorizedDefaultKernel_v<MT3,MT4,MT5,ST2> )?( "large" ):( "default" ),
+                             A.rows(), B.columns(), A.columns() );
          selectBlasAssignKernel( C, A, B, scalar );
+      }
    }
    //**********************************************************************************************
 
@@ -6478,10 +6503,16 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
    {
       if( ( IsDiagonal_v<MT5> ) ||
           ( !BLAZE_DEBUG_MODE && B.columns() <= SIMDSIZE*10UL ) ||
-          ( C.rows() * C.columns() < DMATDMATMULT_THRESHOLD ) )
+          ( C.rows() * C.columns() < DMATDMATMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_TRACE( "DMatScalarMultExpr<DMatDMatMultExpr>::addAssign", "small", A.rows(), B.columns(), A.columns() );
          selectSmallAddAssignKernel( C, A, B, scalar );
-      else
+      }
+      else {
+         BLAZE_KERNEL_TRACE( "DMatScalarMultExpr<DMatDMatMultExpr>::addAssign",
+                             ( UseBlasKernel_v<MT3,MT4,MT5,ST2> )?( "blas" ):( UseVectorizedDefaultKernel_v<MT3,MT4,MT5,ST2> )?( "large" ):( "default" ),
+                             A.rows(), B.columns(), A.columns() );
          selectBlasAddAssignKernel( C, A, B, scalar );
+      }
    }
    //**********************************************************************************************
 
@@ -7591,10 +7622,16 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
    {
       if( ( IsDiagonal_v<MT5> ) ||
           ( !BLAZE_DEBUG_MODE && B.columns() <= SIMDSIZE*10UL ) ||
-          ( C.rows() * C.columns() < DMATDMATMULT_THRESHOLD ) )
+          ( C.rows() * C.columns() < DMATDMATMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_TRACE( "DMatScalarMultExpr<DMatDMatMultExpr>::subAssign", "small", A.rows(), B.columns(), A.columns() );
          selectSmallSubAssignKernel( C, A, B, scalar );
-      else
+      }
+      else {
+         BLAZE_KERNEL_TRACE( "DMatScalarMultExpr<DMatDMatMultExpr>::subAssign",
+                             ( UseBlasKernel_v<MT3,MT4,MT5,ST2> )?( "blas" ):( UseVectorizedDefaultKernel_v<MT3,MT4,MT5,ST2> )?( "large" ):( "default" ),
+                             A.rows(), B.columns(), A.columns() );
          selectBlasSubAssignKernel( C, A, B, scalar );
+      }
    }
    //**********************************************************************************************
 
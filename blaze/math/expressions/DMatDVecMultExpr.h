@@ -50,6 +50,7 @@
 #include <blaze/math/constraints/MatVecMultExpr.h>
 #include <blaze/math/constraints/RequiresEvaluation.h>
 #include <blaze/math/constraints/RowMajorMatrix.h>
+#include <blaze/math/dense/DispatchedKernels.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/Computation.h>
 #include <blaze/math/expressions/DenseVector.h>
@@ -82,6 +83,7 @@
 #include <blaze/math/views/Check.h>
 #include <blaze/system/BLAS.h>
 #include <blaze/system/Optimizations.h>
+#include <blaze/system/SMP.h>
 #include <blaze/system/Thresholds.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/Complex.h>
@@ -368,7 +370,8 @@ class DMatDVecMultExpr
    // \return \a true in case the expression can be used in SMP assignments, \a false if not.
    */
    inline bool canSMPAssign() const noexcept {
-      return ( !BLAZE_BLAS_MODE ||
+      return ( BLAZE_REPRODUCIBLE_REDUCTION_MODE ||
+               !BLAZE_BLAS_MODE ||
                !BLAZE_USE_BLAS_MATRIX_VECTOR_MULTIPLICATION ||
                !BLAZE_BLAS_IS_PARALLEL ||
                ( IsComputation_v<MT> && !evaluateMatrix ) ||
@@ -440,7 +443,8 @@ class DMatDVecMultExpr
            , typename VT2 >  // Type of the right-hand side vector operand
    static inline void selectAssignKernel( VT1& y, const MT1& A, const VT2& x )
    {
-      if( ( IsDiagonal_v<MT1> ) ||
+      if( ( BLAZE_REPRODUCIBLE_REDUCTION_MODE ) ||
+          ( IsDiagonal_v<MT1> ) ||
           ( IsComputation_v<MT> && !evaluateMatrix ) ||
           ( A.rows() * A.columns() < DMATDVECMULT_THRESHOLD ) )
          selectSmallAssignKernel( y, A, x );
@@ -519,7 +523,7 @@ class DMatDVecMultExpr
    static inline auto selectSmallAssignKernel( VT1& y, const MT1& A, const VT2& x )
       -> EnableIf_t< UseVectorizedDefaultKernel_v<VT1,MT1,VT2> >
    {
-      constexpr bool remainder( !IsPadded_v<MT1> || !IsPadded_v<VT2> );
+      constexpr bool remainder( BLAZE_REPRODUCIBLE_REDUCTION_MODE || !IsPadded_v<MT1> || !IsPadded_v<VT2> );
 
       const size_t M( A.rows()    );
       const size_t N( A.columns() );
@@ -752,6 +756,9 @@ class DMatDVecMultExpr
    static inline auto selectLargeAssignKernel( VT1& y, const MT1& A, const VT2& x )
       -> EnableIf_t< UseVectorizedDefaultKernel_v<VT1,MT1,VT2> >
    {
+      if( dispatchedGemv( y, A, x ) )
+         return;
+
       constexpr bool remainder( !IsPadded_v<MT1> || !IsPadded_v<VT2> );
 
       const size_t M( A.rows()    );
@@ -1123,7 +1130,8 @@ class DMatDVecMultExpr
            , typename VT2 >  // Type of the right-hand side vector operand
    static inline void selectAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
    {
-      if( ( IsDiagonal_v<MT1> ) ||
+      if( ( BLAZE_REPRODUCIBLE_REDUCTION_MODE ) ||
+          ( IsDiagonal_v<MT1> ) ||
           ( IsComputation_v<MT> && !evaluateMatrix ) ||
           ( A.rows() * A.columns() < DMATDVECMULT_THRESHOLD ) )
          selectSmallAddAssignKernel( y, A, x );
@@ -1202,7 +1210,7 @@ class DMatDVecMultExpr
    static inline auto selectSmallAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
       -> EnableIf_t< UseVectorizedDefaultKernel_v<VT1,MT1,VT2> >
    {
-      constexpr bool remainder( !IsPadded_v<MT1> || !IsPadded_v<VT2> );
+      constexpr bool remainder( BLAZE_REPRODUCIBLE_REDUCTION_MODE || !IsPadded_v<MT1> || !IsPadded_v<VT2> );
 
       const size_t M( A.rows()    );
       const size_t N( A.columns() );
@@ -1779,7 +1787,8 @@ class DMatDVecMultExpr
            , typename VT2 >  // Type of the right-hand side vector operand
    static inline void selectSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
    {
-      if( ( IsDiagonal_v<MT1> ) ||
+      if( ( BLAZE_REPRODUCIBLE_REDUCTION_MODE ) ||
+          ( IsDiagonal_v<MT1> ) ||
           ( IsComputation_v<MT> && !evaluateMatrix ) ||
           ( A.rows() * A.columns() < DMATDVECMULT_THRESHOLD ) )
          selectSmallSubAssignKernel( y, A, x );
@@ -1858,7 +1867,7 @@ class DMatDVecMultExpr
    static inline auto selectSmallSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
       -> EnableIf_t< UseVectorizedDefaultKernel_v<VT1,MT1,VT2> >
    {
-      constexpr bool remainder( !IsPadded_v<MT1> || !IsPadded_v<VT2> );
+      constexpr bool remainder( BLAZE_REPRODUCIBLE_REDUCTION_MODE || !IsPadded_v<MT1> || !IsPadded_v<VT2> );
 
       const size_t M( A.rows()    );
       const size_t N( A.columns() );
@@ -2949,7 +2958,8 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
    */
    inline bool canSMPAssign() const noexcept {
       LeftOperand_t<MVM> A( vector_.leftOperand() );
-      return ( !BLAZE_BLAS_MODE ||
+      return ( BLAZE_REPRODUCIBLE_REDUCTION_MODE ||
+               !BLAZE_BLAS_MODE ||
                !BLAZE_USE_BLAS_MATRIX_VECTOR_MULTIPLICATION ||
                !BLAZE_BLAS_IS_PARALLEL ||
                ( IsComputation_v<MT> && !evaluateMatrix ) ||
@@ -3023,7 +3033,8 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
            , typename ST2 >  // Type of the scalar value
    static inline void selectAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
    {
-      if( ( IsDiagonal_v<MT1> ) ||
+      if( ( BLAZE_REPRODUCIBLE_REDUCTION_MODE ) ||
+          ( IsDiagonal_v<MT1> ) ||
           ( IsComputation_v<MT> && !evaluateMatrix ) ||
           ( A.rows() * A.columns() < DMATDVECMULT_THRESHOLD ) )
          selectSmallAssignKernel( y, A, x, scalar );
@@ -3103,7 +3114,7 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
    static inline auto selectSmallAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
       -> EnableIf_t< UseVectorizedDefaultKernel_v<VT1,MT1,VT2,ST2> >
    {
-      constexpr bool remainder( !IsPadded_v<MT1> || !IsPadded_v<VT2> );
+      constexpr bool remainder( BLAZE_REPRODUCIBLE_REDUCTION_MODE || !IsPadded_v<MT1> || !IsPadded_v<VT2> );
 
       const size_t M( A.rows()    );
       const size_t N( A.columns() );
@@ -3725,7 +3736,8 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
            , typename ST2 >  // Type of the scalar value
    static inline void selectAddAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
    {
-      if( ( IsDiagonal_v<MT1> ) ||
+      if( ( BLAZE_REPRODUCIBLE_REDUCTION_MODE ) ||
+          ( IsDiagonal_v<MT1> ) ||
           ( IsComputation_v<MT> && !evaluateMatrix ) ||
           ( A.rows() * A.columns() < DMATDVECMULT_THRESHOLD ) )
          selectSmallAddAssignKernel( y, A, x, scalar );
@@ -3804,7 +3816,7 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
    static inline auto selectSmallAddAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
       -> EnableIf_t< UseVectorizedDefaultKernel_v<VT1,MT1,VT2,ST2> >
    {
-      constexpr bool remainder( !IsPadded_v<MT1> || !IsPadded_v<VT2> );
+      constexpr bool remainder( BLAZE_REPRODUCIBLE_REDUCTION_MODE || !IsPadded_v<MT1> || !IsPadded_v<VT2> );
 
       const size_t M( A.rows()    );
       const size_t N( A.columns() );
@@ -4382,7 +4394,8 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
            , typename ST2 >  // Type of the scalar value
    static inline void selectSubAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
    {
-      if( ( IsDiagonal_v<MT1> ) ||
+      if( ( BLAZE_REPRODUCIBLE_REDUCTION_MODE ) ||
+          ( IsDiagonal_v<MT1> ) ||
           ( IsComputation_v<MT> && !evaluateMatrix ) ||
           ( A.rows() * A.columns() < DMATDVECMULT_THRESHOLD ) )
          selectSmallSubAssignKernel( y, A, x, scalar );
@@ -4461,7 +4474,7 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
    static inline auto selectSmallSubAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
       -> EnableIf_t< UseVectorizedDefaultKernel_v<VT1,MT1,VT2,ST2> >
    {
-      constexpr bool remainder( !IsPadded_v<MT1> || !IsPadded_v<VT2> );
+      constexpr bool remainder( BLAZE_REPRODUCIBLE_REDUCTION_MODE || !IsPadded_v<MT1> || !IsPadded_v<VT2> );
 
       const size_t M( A.rows()    );
       const size_t N( A.columns() );
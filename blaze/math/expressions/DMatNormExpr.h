@@ -44,6 +44,7 @@
 #include <blaze/math/Aliases.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/functors/Abs.h>
+#include <blaze/math/functors/Add.h>
 #include <blaze/math/functors/Bind2nd.h>
 #include <blaze/math/functors/Cbrt.h>
 #include <blaze/math/functors/L1Norm.h>
@@ -62,13 +63,18 @@
 #include <blaze/math/shims/Invert.h>
 #include <blaze/math/shims/IsZero.h>
 #include <blaze/math/SIMD.h>
+#include <blaze/math/smp/Reduction.h>
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/math/typetraits/HasLoad.h>
 #include <blaze/math/typetraits/HasSIMDAdd.h>
 #include <blaze/math/typetraits/IsPadded.h>
 #include <blaze/math/typetraits/IsSIMDEnabled.h>
 #include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/math/views/Check.h>
+#include <blaze/math/views/Forward.h>
 #include <blaze/system/Optimizations.h>
+#include <blaze/system/SMP.h>
+#include <blaze/system/Thresholds.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/FunctionTrace.h>
 #include <blaze/util/IntegralConstant.h>
@@ -78,6 +84,7 @@
 #include <blaze/util/TypeList.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/HasMember.h>
+#include <blaze/util/typetraits/RemoveCV.h>
 #include <blaze/util/typetraits/RemoveReference.h>
 
 
@@ -415,6 +422,53 @@ inline decltype(auto) norm_backend( const DenseMatrix<MT,true>& dm, Abs abs, Pow
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SMP backend implementation of the norm of a dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix for the norm computation.
+// \param abs The functor for the abs operation.
+// \param power The functor for the power operation.
+// \param root The functor for the root operation.
+// \return The norm of the given matrix.
+//
+// This function implements the shared memory parallel norm of a dense matrix. The matrix is
+// split into blocks of rows (row-major matrices) or columns (column-major matrices) (see
+// reductionGranularity()), the sums of the powers of the blocks are computed in parallel and
+// added in ascending order of the blocks before the root operation is applied.
+*/
+template< typename MT      // Type of the dense matrix
+        , bool SO          // Storage order
+        , typename Abs     // Type of the abs operation
+        , typename Power   // Type of the power operation
+        , typename Root >  // Type of the root operation
+inline decltype(auto) smpnorm_backend( const DenseMatrix<MT,SO>& dm, Abs abs, Power power, Root root )
+{
+   using CT = CompositeType_t<MT>;
+   using ET = ElementType_t<MT>;
+
+   CT tmp( ~dm );
+
+   const size_t M( tmp.rows()    );
+   const size_t N( tmp.columns() );
+
+   const ET norm( smpReduce<ET>( ( SO ? N : M ), reductionGranularity( 1UL, ( SO ? M : N ) ),
+                                 canSMPReduce( M*N, SMP_DMATTOTALREDUCE_THRESHOLD ),
+      [&]( size_t index, size_t size ) {
+         const auto sm( SO ? submatrix<unaligned>( tmp, 0UL, index, M, size, unchecked )
+                           : submatrix<unaligned>( tmp, index, 0UL, size, N, unchecked ) );
+         using SMT = RemoveCV_t< decltype( sm ) >;
+         return norm_backend( sm, abs, power, Noop(), Bool_t< DMatNormHelper<SMT,Abs,Power>::value >() );
+      },
+      Add() ) );
+
+   return evaluate( root( norm ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Computes a custom norm for the given dense matrix.
@@ -443,6 +497,10 @@ template< typename MT      // Type of the dense matrix
         , typename Root >  // Type of the root operation
 decltype(auto) norm_backend( const DenseMatrix<MT,SO>& dm, Abs abs, Power power, Root root )
 {
+   if( BLAZE_REPRODUCIBLE_REDUCTION_MODE ||
+       canSMPReduce( (~dm).rows() * (~dm).columns(), SMP_DMATTOTALREDUCE_THRESHOLD ) )
+      return smpnorm_backend( ~dm, abs, power, root );
+
    return norm_backend( ~dm, abs, power, root, Bool_t< DMatNormHelper<MT,Abs,Power>::value >() );
 }
 /*! \endcond */
@@ -62,6 +62,7 @@
 #include <blaze/math/ReductionFlag.h>
 #include <blaze/math/shims/Serial.h>
 #include <blaze/math/SIMD.h>
+#include <blaze/math/smp/Reduction.h>
 #include <blaze/math/traits/ReduceTrait.h>
 #include <blaze/math/typetraits/HasLoad.h>
 #include <blaze/math/typetraits/IsExpression.h>
@@ -70,7 +71,9 @@
 #include <blaze/math/typetraits/IsUniform.h>
 #include <blaze/math/typetraits/RequiresEvaluation.h>
 #include <blaze/math/views/Check.h>
+#include <blaze/math/views/Forward.h>
 #include <blaze/system/HostDevice.h>
+#include <blaze/system/SMP.h>
 #include <blaze/system/Thresholds.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
@@ -1981,6 +1984,45 @@ inline ElementType_t<MT> dmatreduce( const DenseMatrix<MT,true>& dm, OP op )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SMP backend implementation of a reduction operation on a dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix for the reduction computation.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function implements the shared memory parallel total reduction of a dense matrix. The
+// matrix is split into blocks of rows (row-major matrices) or columns (column-major matrices)
+// (see reductionGranularity()), the blocks are reduced in parallel and the partial results are
+// finally combined in ascending order of the blocks.
+*/
+template< typename MT    // Type of the dense matrix
+        , bool SO        // Storage order
+        , typename OP >  // Type of the reduction operation
+inline ElementType_t<MT> smpdmatreduce( const DenseMatrix<MT,SO>& dm, OP op )
+{
+   using CT = CompositeType_t<MT>;
+   using ET = ElementType_t<MT>;
+
+   CT tmp( ~dm );
+
+   const size_t M( tmp.rows()    );
+   const size_t N( tmp.columns() );
+
+   return smpReduce<ET>( ( SO ? N : M ), reductionGranularity( 1UL, ( SO ? M : N ) ),
+                         canSMPReduce( M*N, SMP_DMATTOTALREDUCE_THRESHOLD ),
+      [&]( size_t index, size_t size ) {
+         return ( SO ? dmatreduce( submatrix<unaligned>( tmp, 0UL, index, M, size, unchecked ), op )
+                     : dmatreduce( submatrix<unaligned>( tmp, index, 0UL, size, N, unchecked ), op ) );
+      },
+      op );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Performs a custom reduction operation on the given dense matrix.
 // \ingroup dense_matrix
@@ -2008,7 +2050,11 @@ inline ElementType_t<MT> dmatreduce( const DenseMatrix<MT,true>& dm, OP op )
 //
 // Please note that the evaluation order of the reduction operation is unspecified. Thus the
 // behavior is non-deterministic if \a op is not associative or not commutative. Also, the
-// operation is undefined if the given reduction operation modifies the values.
+// operation is undefined if the given reduction operation modifies the values. For large
+// matrices (see the BLAZE_SMP_DMATTOTALREDUCE_THRESHOLD setting) the reduction is performed
+// in parallel in case the shared memory parallelization is active. In case the reproducible
+// reductions are activated (see the BLAZE_USE_REPRODUCIBLE_REDUCTIONS setting) the result is
+// bit-identical for any number of threads.
 */
 template< typename MT    // Type of the dense matrix
         , bool SO        // Storage order
@@ -2017,6 +2063,11 @@ inline decltype(auto) reduce( const DenseMatrix<MT,SO>& dm, OP op )
 {
    BLAZE_FUNCTION_TRACE;
 
+   if( !IsUniform_v<MT> &&
+       ( BLAZE_REPRODUCIBLE_REDUCTION_MODE ||
+         canSMPReduce( (~dm).rows() * (~dm).columns(), SMP_DMATTOTALREDUCE_THRESHOLD ) ) )
+      return smpdmatreduce( ~dm, op );
+
    return dmatreduce( ~dm, op );
 }
 //*************************************************************************************************
@@ -348,7 +348,7 @@ class DMatTDMatMapExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      constexpr size_t block( BLOCK_SIZE );
+      const size_t block( BLOCK_SIZE );
 
       const size_t m( rhs.rows() );
       const size_t n( rhs.columns() );
@@ -470,7 +470,7 @@ class DMatTDMatMapExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      constexpr size_t block( BLOCK_SIZE );
+      const size_t block( BLOCK_SIZE );
 
       const size_t m( rhs.rows() );
       const size_t n( rhs.columns() );
@@ -557,7 +557,7 @@ class DMatTDMatMapExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      constexpr size_t block( BLOCK_SIZE );
+      const size_t block( BLOCK_SIZE );
 
       const size_t m( rhs.rows() );
       const size_t n( rhs.columns() );
@@ -644,7 +644,7 @@ class DMatTDMatMapExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      constexpr size_t block( BLOCK_SIZE );
+      const size_t block( BLOCK_SIZE );
 
       const size_t m( rhs.rows() );
       const size_t n( rhs.columns() );
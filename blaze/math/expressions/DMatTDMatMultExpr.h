@@ -107,6 +107,7 @@
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
 #include <blaze/util/IntegralConstant.h>
+#include <blaze/util/KernelTrace.h>
 #include <blaze/util/mpl/If.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/IsBuiltin.h>
@@ -537,10 +538,16 @@ class DMatTDMatMultExpr
    static inline void selectAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
       if( ( IsDiagonal_v<MT4> || IsDiagonal_v<MT5> ) ||
-          ( C.rows() * C.columns() < DMATTDMATMULT_THRESHOLD ) )
+          ( C.rows() * C.columns() < DMATTDMATMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_TRACE( "DMatTDMatMultExpr::assign", "small", A.rows(), B.columns(), A.columns() );
          selectSmallAssignKernel( C, A, B );
-      else
+      }
+      else {
+         BLAZE_KERNEL_TRACE( "DMatTDMatMultExpr::assign",
+                             ( UseBlasKernel_v<MT3,MT4,MT5> )?( "blas" ):( UseVectorizedDefaultKernel_v<MT3,MT4,MT5> )?( "large" ):( "default" ),
+                             A.rows(), B.columns(), A.columns() );
          selectBlasAssignKernel( C, A, B );
+      }
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -844,7 +851,7 @@ class DMatTDMatMultExpr
    static inline auto selectDefaultAssignKernel( MT3& C, const MT4& A, const MT5& B )
       -> EnableIf_t< IsColumnMajorMatrix_v<MT3> && !IsDiagonal_v<MT4> && IsDiagonal_v<MT5> >
    {
-      constexpr size_t block( BLOCK_SIZE );
+      const size_t block( BLOCK_SIZE );
 
       const size_t M( A.rows()    );
       const size_t N( B.columns() );
@@ -902,7 +909,7 @@ class DMatTDMatMultExpr
    static inline auto selectDefaultAssignKernel( MT3& C, const MT4& A, const MT5& B )
       -> EnableIf_t< IsRowMajorMatrix_v<MT3> && IsDiagonal_v<MT4> && !IsDiagonal_v<MT5> >
    {
-      constexpr size_t block( BLOCK_SIZE );
+      const size_t block( BLOCK_SIZE );
 
       const size_t M( A.rows()    );
       const size_t N( B.columns() );
@@ -1884,10 +1891,16 @@ class DMatTDMatMultExpr
    static inline void selectAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
       if( ( IsDiagonal_v<MT4> || IsDiagonal_v<MT5> ) ||
-          ( C.rows() * C.columns() < DMATTDMATMULT_THRESHOLD ) )
+          ( C.rows() * C.columns() < DMATTDMATMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_TRACE( "DMatTDMatMultExpr::addAssign", "small", A.rows(), B.columns(), A.columns() );
          selectSmallAddAssignKernel( C, A, B );
-      else
+      }
+      else {
+         BLAZE_KERNEL_TRACE( "DMatTDMatMultExpr::addAssign",
+                             ( UseBlasKernel_v<MT3,MT4,MT5> )?( "blas" ):( UseVectorizedDefaultKernel_v<MT3,MT4,MT5> )?( "large" ):( "default" ),
+                             A.rows(), B.columns(), A.columns() );
          selectBlasAddAssignKernel( C, A, B );
+      }
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -2140,7 +2153,7 @@ class DMatTDMatMultExpr
    static inline auto selectDefaultAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
       -> EnableIf_t< IsColumnMajorMatrix_v<MT3> && !IsDiagonal_v<MT4> && IsDiagonal_v<MT5> >
    {
-      constexpr size_t block( BLOCK_SIZE );
+      const size_t block( BLOCK_SIZE );
 
       const size_t M( A.rows()    );
       const size_t N( B.columns() );
@@ -2188,7 +2201,7 @@ class DMatTDMatMultExpr
    static inline auto selectDefaultAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
       -> EnableIf_t< IsRowMajorMatrix_v<MT3> && IsDiagonal_v<MT4> && !IsDiagonal_v<MT5> >
    {
-      constexpr size_t block( BLOCK_SIZE );
+      const size_t block( BLOCK_SIZE );
 
       const size_t M( A.rows()    );
       const size_t N( B.columns() );
@@ -3007,10 +3020,16 @@ class DMatTDMatMultExpr
    static inline void selectSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
       if( ( IsDiagonal_v<MT4> || IsDiagonal_v<MT5> ) ||
-          ( C.rows() * C.columns() < DMATTDMATMULT_THRESHOLD ) )
+          ( C.rows() * C.columns() < DMATTDMATMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_TRACE( "DMatTDMatMultExpr::subAssign", "small", A.rows(), B.columns(), A.columns() );
          selectSmallSubAssignKernel( C, A, B );
-      else
+      }
+      else {
+         BLAZE_KERNEL_TRACE( "DMatTDMatMultExpr::subAssign",
+                             ( UseBlasKernel_v<MT3,MT4,MT5> )?( "blas" ):( UseVectorizedDefaultKernel_v<MT3,MT4,MT5> )?( "large" ):( "default" ),
+                             A.rows(), B.columns(), A.columns() );
          selectBlasSubAssignKernel( C, A, B );
+      }
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -3263,7 +3282,7 @@ class DMatTDMatMultExpr
    static inline auto selectDefaultSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
       -> EnableIf_t< IsColumnMajorMatrix_v<MT3> && !IsDiagonal_v<MT4> && IsDiagonal_v<MT5> >
    {
-      constexpr size_t block( BLOCK_SIZE );
+      const size_t block( BLOCK_SIZE );
 
       const size_t M( A.rows()    );
       const size_t N( B.columns() );
@@ -3311,7 +3330,7 @@ class DMatTDMatMultExpr
    static inline auto selectDefaultSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
       -> EnableIf_t< IsRowMajorMatrix_v<MT3> && IsDiagonal_v<MT4> && !IsDiagonal_v<MT5> >
    {
-      constexpr size_t block( BLOCK_SIZE );
+      const size_t block( BLOCK_SIZE );
 
       const size_t M( A.rows()    );
       const size_t N( B.columns() );
@@ -4746,10 +4765,16 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
    static inline void selectAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
    {
       if( ( IsDiagonal_v<MT4> || IsDiagonal_v<MT5> ) ||
-          ( C.rows() * C.columns() < DMATTDMATMULT_THRESHOLD ) )
+          ( C.rows() * C.columns() < DMATTDMATMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_TRACE( "DMatScalarMultExpr<DMatTDMatMultExpr>::assign", "small", A.rows(), B.columns(), A.columns() );
          selectSmallAssignKernel( C, A, B, scalar );
-      else
+      }
+      else {
+         BLAZE_KERNEL_TRACE( "DMatScalarMultExpr<DMatTDMatMultExpr>::assign",
+                             ( UseBlasKernel_v<MT3,MT4,MT5,ST2> )?( "blas" ):( UseVectorizedDefaultKernel_v<MT3,MT4,MT5,ST2> )?( "large" ):( "default" ),
+                             A.rows(), B.columns(), A.columns() );
          selectBlasAssignKernel( C, A, B, scalar );
+      }
    }
    //**********************************************************************************************
 
@@ -5055,7 +5080,7 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
    static inline auto selectDefaultAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
       -> EnableIf_t< IsColumnMajorMatrix_v<MT3> && !IsDiagonal_v<MT4> && IsDiagonal_v<MT5> >
    {
-      constexpr size_t block( BLOCK_SIZE );
+      const size_t block( BLOCK_SIZE );
 
       const size_t M( A.rows()    );
       const size_t N( B.columns() );
@@ -5113,7 +5138,7 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
    static inline auto selectDefaultAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
       -> EnableIf_t< IsRowMajorMatrix_v<MT3> && IsDiagonal_v<MT4> && !IsDiagonal_v<MT5> >
    {
-      constexpr size_t block( BLOCK_SIZE );
+      const size_t block( BLOCK_SIZE );
 
       const size_t M( A.rows()    );
       const size_t N( B.columns() );
@@ -6094,10 +6119,16 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
    static inline void selectAddAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
    {
       if( ( IsDiagonal_v<MT4> || IsDiagonal_v<MT5> ) ||
-          ( C.rows() * C.columns() < DMATTDMATMULT_THRESHOLD ) )
+          ( C.rows() * C.columns() < DMATTDMATMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_TRACE( "DMatScalarMultExpr<DMatTDMatMultExpr>::addAssign", "small", A.rows(), B.columns(), A.columns() );
          selectSmallAddAssignKernel( C, A, B, scalar );
-      else
+      }
+      else {
+         BLAZE_KERNEL_TRACE( "DMatScalarMultExpr<DMatTDMatMultExpr>::addAssign",
+                             ( UseBlasKernel_v<MT3,MT4,MT5,ST2> )?( "blas" ):( UseVectorizedDefaultKernel_v<MT3,MT4,MT5,ST2> )?( "large" ):( "default" ),
+                             A.rows(), B.columns(), A.columns() );
          selectBlasAddAssignKernel( C, A, B, scalar );
+      }
    }
    //**********************************************************************************************
 
@@ -6196,7 +6227,7 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
    static inline auto selectDefaultAddAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
       -> EnableIf_t< IsColumnMajorMatrix_v<MT3> && !IsDiagonal_v<MT4> && IsDiagonal_v<MT5> >
    {
-      constexpr size_t block( BLOCK_SIZE );
+      const size_t block( BLOCK_SIZE );
 
       const size_t M( A.rows()    );
       const size_t N( B.columns() );
@@ -6244,7 +6275,7 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
    static inline auto selectDefaultAddAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
       -> EnableIf_t< IsRowMajorMatrix_v<MT3> && IsDiagonal_v<MT4> && !IsDiagonal_v<MT5> >
    {
-      constexpr size_t block( BLOCK_SIZE );
+      const size_t block( BLOCK_SIZE );
 
       const size_t M( A.rows()    );
       const size_t N( B.columns() );
@@ -7064,10 +7095,16 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
    static inline void selectSubAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
    {
       if( ( IsDiagonal_v<MT4> || IsDiagonal_v<MT5> ) ||
-          ( C.rows() * C.columns() < DMATTDMATMULT_THRESHOLD ) )
+          ( C.rows() * C.columns() < DMATTDMATMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_TRACE( "DMatScalarMultExpr<DMatTDMatMultExpr>::subAssign", "small", A.rows(), B.columns(), A.columns() );
          selectSmallSubAssignKernel( C, A, B, scalar );
-      else
+      }
+      else {
+         BLAZE_KERNEL_TRACE( "DMatScalarMultExpr<DMatTDMatMultExpr>::subAssign",
+                             ( UseBlasKernel_v<MT3,MT4,MT5,ST2> )?( "blas" ):( UseVectorizedDefaultKernel_v<MT3,MT4,MT5,ST2> )?( "large" ):( "default" ),
+                             A.rows(), B.columns(), A.columns() );
          selectBlasSubAssignKernel( C, A, B, scalar );
+      }
    }
    //**********************************************************************************************
 
@@ -7166,7 +7203,7 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
    static inline auto selectDefaultSubAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
       -> EnableIf_t< IsColumnMajorMatrix_v<MT3> && !IsDiagonal_v<MT4> && IsDiagonal_v<MT5> >
    {
-      constexpr size_t block( BLOCK_SIZE );
+      const size_t block( BLOCK_SIZE );
 
       const size_t M( A.rows()    );
       const size_t N( B.columns() );
@@ -7215,7 +7252,7 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
    static inline auto selectDefaultSubAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
       -> EnableIf_t< IsRowMajorMatrix_v<MT3> && IsDiagonal_v<MT4> && !IsDiagonal_v<MT5> >
    {
-      constexpr size_t block( BLOCK_SIZE );
+      const size_t block( BLOCK_SIZE );
 
       const size_t M( A.rows()    );
       const size_t N( B.columns() );
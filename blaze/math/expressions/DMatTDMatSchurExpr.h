@@ -352,7 +352,7 @@ class DMatTDMatSchurExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      constexpr size_t block( BLOCK_SIZE );
+      const size_t block( BLOCK_SIZE );
 
       const size_t m( rhs.rows() );
       const size_t n( rhs.columns() );
@@ -513,7 +513,7 @@ class DMatTDMatSchurExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      constexpr size_t block( BLOCK_SIZE );
+      const size_t block( BLOCK_SIZE );
 
       const size_t m( rhs.rows() );
       const size_t n( rhs.columns() );
@@ -597,7 +597,7 @@ class DMatTDMatSchurExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      constexpr size_t block( BLOCK_SIZE );
+      const size_t block( BLOCK_SIZE );
 
       const size_t m( rhs.rows() );
       const size_t n( rhs.columns() );
@@ -681,7 +681,7 @@ class DMatTDMatSchurExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      constexpr size_t block( BLOCK_SIZE );
+      const size_t block( BLOCK_SIZE );
 
       const size_t m( rhs.rows() );
       const size_t n( rhs.columns() );
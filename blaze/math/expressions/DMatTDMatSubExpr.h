@@ -341,7 +341,7 @@ class DMatTDMatSubExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      constexpr size_t block( BLOCK_SIZE );
+      const size_t block( BLOCK_SIZE );
 
       const size_t m( rhs.rows() );
       const size_t n( rhs.columns() );
@@ -462,7 +462,7 @@ class DMatTDMatSubExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      constexpr size_t block( BLOCK_SIZE );
+      const size_t block( BLOCK_SIZE );
 
       const size_t m( rhs.rows() );
       const size_t n( rhs.columns() );
@@ -548,7 +548,7 @@ class DMatTDMatSubExpr
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      constexpr size_t block( BLOCK_SIZE );
+      const size_t block( BLOCK_SIZE );
 
       const size_t m( rhs.rows() );
       const size_t n( rhs.columns() );
@@ -41,15 +41,22 @@
 //*************************************************************************************************
 
 #include <blaze/math/Aliases.h>
+#include <blaze/math/dense/DispatchedKernels.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/functors/Add.h>
 #include <blaze/math/SIMD.h>
+#include <blaze/math/smp/Reduction.h>
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/math/typetraits/HasSIMDAdd.h>
 #include <blaze/math/typetraits/HasSIMDMult.h>
 #include <blaze/math/typetraits/IsPadded.h>
 #include <blaze/math/typetraits/IsSIMDCombinable.h>
+#include <blaze/math/views/Check.h>
+#include <blaze/math/views/Forward.h>
 #include <blaze/system/Optimizations.h>
+#include <blaze/system/SMP.h>
+#include <blaze/system/Thresholds.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
@@ -195,6 +202,11 @@ inline auto dvecdvecinner( const DenseVector<VT1,true>& lhs, const DenseVector<V
    CT1 left ( ~lhs );
    CT2 right( ~rhs );
 
+   MultType sp{};
+
+   if( dispatchedDot( left, right, sp ) )
+      return sp;
+
    constexpr size_t SIMDSIZE = SIMDTrait<MultType>::size;
    constexpr bool remainder( !usePadding || !IsPadded_v<XT1> || !IsPadded_v<XT2> );
 
@@ -220,7 +232,7 @@ inline auto dvecdvecinner( const DenseVector<VT1,true>& lhs, const DenseVector<V
       xmm1 = xmm1 + ( left.load(i) * right.load(i) );
    }
 
-   MultType sp( sum( xmm1 + xmm2 + xmm3 + xmm4 ) );
+   sp = sum( xmm1 + xmm2 + xmm3 + xmm4 );
 
    for( ; remainder && i<N; ++i ) {
       sp += left[i] * right[i];
@@ -232,6 +244,50 @@ inline auto dvecdvecinner( const DenseVector<VT1,true>& lhs, const DenseVector<V
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SMP backend implementation of the scalar product (inner product) of two dense vectors
+//        (\f$ s=\vec{a}*\vec{b} \f$).
+// \ingroup dense_vector
+//
+// \param lhs The left-hand side dense vector for the inner product.
+// \param rhs The right-hand side dense vector for the inner product.
+// \return The scalar product.
+//
+// This function implements the shared memory parallel scalar product of two dense vectors.
+// Both vectors are split into chunks (see reductionGranularity()), the partial scalar products
+// of the chunks are computed in parallel and finally added in ascending order of the chunks.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename VT2 >  // Type of the right-hand side dense vector
+inline auto smpdvecdvecinner( const DenseVector<VT1,true>& lhs, const DenseVector<VT2,false>& rhs )
+   -> const MultTrait_t< ElementType_t<VT1>, ElementType_t<VT2> >
+{
+   using CT1      = CompositeType_t<VT1>;
+   using CT2      = CompositeType_t<VT2>;
+   using ET1      = ElementType_t<VT1>;
+   using ET2      = ElementType_t<VT2>;
+   using MultType = MultTrait_t<ET1,ET2>;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
+
+   CT1 left ( ~lhs );
+   CT2 right( ~rhs );
+
+   const size_t N( left.size() );
+
+   return smpReduce<MultType>( N, reductionGranularity( SIMDTrait<MultType>::size ),
+                               canSMPReduce( N, SMP_DVECDVECINNER_THRESHOLD ),
+      [&]( size_t index, size_t size ) {
+         return dvecdvecinner( subvector<unaligned>( left , index, size, unchecked ),
+                               subvector<unaligned>( right, index, size, unchecked ) );
+      },
+      Add() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Multiplication operator for the scalar product (inner product) of two dense vectors
 //        (\f$ s=\vec{a}*\vec{b} \f$).
@@ -256,7 +312,10 @@ inline auto dvecdvecinner( const DenseVector<VT1,true>& lhs, const DenseVector<V
 // and \a VT2 as well as the two element types \a VT1::ElementType and \a VT2::ElementType
 // have to be supported by the MultTrait class template.\n
 // In case the current sizes of the two given vectors don't match, a \a std::invalid_argument
-// is thrown.
+// is thrown. For large vectors (see the BLAZE_SMP_DVECDVECINNER_THRESHOLD setting) the scalar
+// product is computed in parallel in case the shared memory parallelization is active. In case
+// the reproducible reductions are activated (see the BLAZE_USE_REPRODUCIBLE_REDUCTIONS setting)
+// the result is bit-identical for any number of threads.
 */
 template< typename VT1    // Type of the left-hand side dense vector
         , typename VT2 >  // Type of the right-hand side dense vector
@@ -269,6 +328,10 @@ inline decltype(auto)
       BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
    }
 
+   if( BLAZE_REPRODUCIBLE_REDUCTION_MODE ||
+       canSMPReduce( (~lhs).size(), SMP_DVECDVECINNER_THRESHOLD ) )
+      return smpdvecdvecinner( ~lhs, ~rhs );
+
    return dvecdvecinner( ~lhs, ~rhs );
 }
 //*************************************************************************************************
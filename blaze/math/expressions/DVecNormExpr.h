@@ -44,6 +44,7 @@
 #include <blaze/math/Aliases.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/functors/Abs.h>
+#include <blaze/math/functors/Add.h>
 #include <blaze/math/functors/Bind2nd.h>
 #include <blaze/math/functors/Cbrt.h>
 #include <blaze/math/functors/L1Norm.h>
@@ -62,13 +63,18 @@
 #include <blaze/math/shims/Invert.h>
 #include <blaze/math/shims/IsZero.h>
 #include <blaze/math/SIMD.h>
+#include <blaze/math/smp/Reduction.h>
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/math/typetraits/HasLoad.h>
 #include <blaze/math/typetraits/HasSIMDAdd.h>
 #include <blaze/math/typetraits/IsPadded.h>
 #include <blaze/math/typetraits/IsSIMDEnabled.h>
 #include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/math/views/Check.h>
+#include <blaze/math/views/Forward.h>
 #include <blaze/system/Optimizations.h>
+#include <blaze/system/SMP.h>
+#include <blaze/system/Thresholds.h>
 #include <blaze/util/algorithms/Min.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/FunctionTrace.h>
@@ -78,6 +84,7 @@
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/TypeList.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/typetraits/RemoveCV.h>
 #include <blaze/util/typetraits/HasMember.h>
 #include <blaze/util/typetraits/RemoveReference.h>
 
@@ -250,6 +257,51 @@ inline decltype(auto) norm_backend( const DenseVector<VT,TF>& dv, Abs abs, Power
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SMP backend implementation of the norm of a dense vector.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector for the norm computation.
+// \param abs The functor for the abs operation.
+// \param power The functor for the power operation.
+// \param root The functor for the root operation.
+// \return The norm of the given vector.
+//
+// This function implements the shared memory parallel norm of a dense vector. The vector is
+// split into chunks (see reductionGranularity()), the sums of the powers of the chunks are
+// computed in parallel and added in ascending order of the chunks before the root operation
+// is applied.
+*/
+template< typename VT      // Type of the dense vector
+        , bool TF          // Transpose flag
+        , typename Abs     // Type of the abs operation
+        , typename Power   // Type of the power operation
+        , typename Root >  // Type of the root operation
+inline decltype(auto) smpnorm_backend( const DenseVector<VT,TF>& dv, Abs abs, Power power, Root root )
+{
+   using CT = CompositeType_t<VT>;
+   using ET = ElementType_t<VT>;
+
+   CT tmp( ~dv );
+
+   const size_t N( tmp.size() );
+
+   const ET norm( smpReduce<ET>( N, reductionGranularity( SIMDTrait<ET>::size ),
+                                 canSMPReduce( N, SMP_DVECREDUCE_THRESHOLD ),
+      [&]( size_t index, size_t size ) {
+         const auto sv( subvector<unaligned>( tmp, index, size, unchecked ) );
+         using SVT = RemoveCV_t< decltype( sv ) >;
+         return norm_backend( sv, abs, power, Noop(), Bool_t< DVecNormHelper<SVT,Abs,Power>::value >() );
+      },
+      Add() ) );
+
+   return evaluate( root( norm ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Computes a custom norm for the given dense vector.
@@ -278,6 +330,10 @@ template< typename VT      // Type of the dense vector
         , typename Root >  // Type of the root operation
 inline decltype(auto) norm_backend( const DenseVector<VT,TF>& dv, Abs abs, Power power, Root root )
 {
+   if( BLAZE_REPRODUCIBLE_REDUCTION_MODE ||
+       canSMPReduce( (~dv).size(), SMP_DVECREDUCE_THRESHOLD ) )
+      return smpnorm_backend( ~dv, abs, power, root );
+
    return norm_backend( ~dv, abs, power, root, Bool_t< DVecNormHelper<VT,Abs,Power>::value >() );
 }
 /*! \endcond */
@@ -41,17 +41,23 @@
 //*************************************************************************************************
 
 #include <blaze/math/Aliases.h>
+#include <blaze/math/dense/DispatchedKernels.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/functors/Add.h>
 #include <blaze/math/functors/Max.h>
 #include <blaze/math/functors/Min.h>
 #include <blaze/math/functors/Mult.h>
 #include <blaze/math/SIMD.h>
+#include <blaze/math/smp/Reduction.h>
 #include <blaze/math/typetraits/HasLoad.h>
 #include <blaze/math/typetraits/IsPadded.h>
 #include <blaze/math/typetraits/IsSIMDEnabled.h>
 #include <blaze/math/typetraits/IsUniform.h>
+#include <blaze/math/views/Check.h>
+#include <blaze/math/views/Forward.h>
 #include <blaze/system/Compiler.h>
+#include <blaze/system/SMP.h>
+#include <blaze/system/Thresholds.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
@@ -265,6 +271,9 @@ inline auto dvecreduce( const DenseVector<VT,TF>& dv, Add /*op*/ )
 
    ET redux{};
 
+   if( dispatchedSum( tmp, redux ) )
+      return redux;
+
    if( !BLAZE_CLANG_COMPILER && !remainder )
    {
       SIMDTrait_t<ET> xmm1, xmm2;
@@ -366,6 +375,42 @@ inline auto dvecreduce( const DenseVector<VT,TF>& dv, Max /*op*/ )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SMP backend implementation of a reduction operation on a dense vector.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector for the reduction computation.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function implements the shared memory parallel reduction of a dense vector. The vector
+// is split into chunks (see reductionGranularity()), the chunks are reduced in parallel and the
+// partial results are finally combined in ascending order of the chunks.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag
+        , typename OP >  // Type of the reduction operation
+inline ElementType_t<VT> smpdvecreduce( const DenseVector<VT,TF>& dv, OP op )
+{
+   using CT = CompositeType_t<VT>;
+   using ET = ElementType_t<VT>;
+
+   CT tmp( ~dv );
+
+   const size_t N( tmp.size() );
+
+   return smpReduce<ET>( N, reductionGranularity( SIMDTrait<ET>::size ),
+                         canSMPReduce( N, SMP_DVECREDUCE_THRESHOLD ),
+      [&]( size_t index, size_t size ) {
+         return dvecreduce( subvector<unaligned>( tmp, index, size, unchecked ), op );
+      },
+      op );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Performs a custom reduction operation on the given dense vector.
 // \ingroup dense_vector
@@ -393,7 +438,11 @@ inline auto dvecreduce( const DenseVector<VT,TF>& dv, Max /*op*/ )
 //
 // Please note that the evaluation order of the reduction operation is unspecified. Thus the
 // behavior is non-deterministic if \a op is not associative or not commutative. Also, the
-// operation is undefined if the given reduction operation modifies the values.
+// operation is undefined if the given reduction operation modifies the values. For large
+// vectors (see the BLAZE_SMP_DVECREDUCE_THRESHOLD setting) the reduction is performed in
+// parallel in case the shared memory parallelization is active. In case the reproducible
+// reductions are activated (see the BLAZE_USE_REPRODUCIBLE_REDUCTIONS setting) the result is
+// bit-identical for any number of threads.
 */
 template< typename VT    // Type of the dense vector
         , bool TF        // Transpose flag
@@ -402,6 +451,10 @@ inline decltype(auto) reduce( const DenseVector<VT,TF>& dv, OP op )
 {
    BLAZE_FUNCTION_TRACE;
 
+   if( !IsUniform_v<VT> &&
+       ( BLAZE_REPRODUCIBLE_REDUCTION_MODE || canSMPReduce( (~dv).size(), SMP_DVECREDUCE_THRESHOLD ) ) )
+      return smpdvecreduce( ~dv, op );
+
    return dvecreduce( ~dv, op );
 }
 //*************************************************************************************************
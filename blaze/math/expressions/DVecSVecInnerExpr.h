@@ -48,20 +48,188 @@
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/expressions/SparseVector.h>
+#include <blaze/math/SIMD.h>
 #include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/IsContiguous.h>
+#include <blaze/math/typetraits/IsSplitCompressed.h>
+#include <blaze/system/Optimizations.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsSame.h>
 #include <blaze/util/typetraits/RemoveReference.h>
 
 
 namespace blaze {
 
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the dense vector/sparse vector scalar multiplication.
+// \ingroup sparse_vector
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename VT2 >  // Type of the right-hand side sparse vector
+struct DVecSVecInnerExprHelper
+{
+   //**Type definitions****************************************************************************
+   //! Composite type of the dense vector expression.
+   using DCT = RemoveReference_t< CompositeType_t<VT1> >;
+
+   //! Composite type of the sparse vector expression.
+   using SCT = RemoveReference_t< CompositeType_t<VT2> >;
+
+   //! Element type of the sparse vector expression.
+   using ET = ElementType_t<SCT>;
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   static constexpr bool value =
+      ( useOptimizedKernels &&
+        IsSplitCompressed_v<SCT> &&
+        IsContiguous_v<DCT> && HasConstDataAccess_v<DCT> &&
+        IsSame_v< ET, ElementType_t<DCT> > &&
+        ( IsSame_v< ET, float > || IsSame_v< ET, double > ) &&
+        ( SIMDTrait<ET>::size > 1UL ) );
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  GLOBAL BINARY ARITHMETIC OPERATORS
 //
 //=================================================================================================
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default backend implementation of the scalar product (inner product) of a dense and a
+//        sparse vector (\f$ s=\vec{a}*\vec{b} \f$).
+// \ingroup sparse_vector
+//
+// \param lhs The left-hand side dense vector for the inner product.
+// \param rhs The right-hand side sparse vector for the inner product.
+// \return The scalar product.
+//
+// This function implements the default scalar product of a dense and a sparse vector. Due to the
+// explicit application of the SFINAE principle, this function can only be selected by the
+// compiler in case the vectorized kernel for split compressed vectors cannot be applied.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename VT2 >  // Type of the right-hand side sparse vector
+inline auto dvecsvecinner( const DenseVector<VT1,true>& lhs, const SparseVector<VT2,false>& rhs )
+   -> DisableIf_t< DVecSVecInnerExprHelper<VT1,VT2>::value
+                 , const MultTrait_t< ElementType_t<VT1>, ElementType_t<VT2> > >
+{
+   using CT1      = CompositeType_t<VT1>;    // Composite type of the left-hand side dense vector expression
+   using CT2      = CompositeType_t<VT2>;    // Composite type of the right-hand side sparse vector expression
+   using XT1      = RemoveReference_t<CT1>;  // Auxiliary type for the left-hand side composite type
+   using XT2      = RemoveReference_t<CT2>;  // Auxiliary type for the right-hand side composite type
+   using ET1      = ElementType_t<XT1>;      // Element type of the left-hand side dense vector expression
+   using ET2      = ElementType_t<XT2>;      // Element type of the right-hand side sparse vector expression
+   using MultType = MultTrait_t<ET1,ET2>;    // Multiplication result type
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
+
+   CT1 left ( ~lhs );
+   CT2 right( ~rhs );
+
+   auto element( right.begin() );
+   auto end    ( right.end()   );
+
+   MultType sp{};
+
+   if( element != end ) {
+      sp = left[ element->index() ] * element->value();
+      ++element;
+      for( ; element!=end; ++element )
+         sp += left[ element->index() ] * element->value();
+   }
+
+   return sp;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized backend implementation of the scalar product (inner product) of a dense
+//        and a sparse vector (\f$ s=\vec{a}*\vec{b} \f$).
+// \ingroup sparse_vector
+//
+// \param lhs The left-hand side dense vector for the inner product.
+// \param rhs The right-hand side sparse vector for the inner product.
+// \return The scalar product.
+//
+// This function implements the vectorized scalar product of a contiguous dense vector and a
+// sparse vector that stores its values and indices in separate arrays (see SplitCompressedVector).
+// The values of the sparse vector are loaded directly from the value array and the according
+// elements of the dense vector are gathered by means of the index array. Due to the explicit
+// application of the SFINAE principle, this function can only be selected by the compiler in
+// case both vectors have the same single or double precision floating point element type.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename VT2 >  // Type of the right-hand side sparse vector
+inline auto dvecsvecinner( const DenseVector<VT1,true>& lhs, const SparseVector<VT2,false>& rhs )
+   -> EnableIf_t< DVecSVecInnerExprHelper<VT1,VT2>::value
+                , const MultTrait_t< ElementType_t<VT1>, ElementType_t<VT2> > >
+{
+   using CT1 = CompositeType_t<VT1>;
+   using CT2 = CompositeType_t<VT2>;
+   using ET  = ElementType_t<VT2>;
+
+   constexpr size_t SIMDSIZE( SIMDTrait<ET>::size );
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
+
+   CT1 left ( ~lhs );
+   CT2 right( ~rhs );
+
+   const auto begin( right.begin() );
+   const size_t nonzeros( right.end() - begin );
+
+   const ET*   values ( begin.valueBase() );
+   const auto* indices( begin.indexBase() );
+   const ET*   data   ( left.data() );
+
+   const size_t kpos( nonzeros & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( nonzeros - ( nonzeros % SIMDSIZE ) ) == kpos, "Invalid end calculation" );
+
+   SIMDTrait_t<ET> xmm1, xmm2;
+   size_t k( 0UL );
+
+   for( ; (k+SIMDSIZE) < kpos; k+=SIMDSIZE*2UL ) {
+      xmm1 += gather( data, indices+k ) * loada( values+k );
+      xmm2 += gather( data, indices+k+SIMDSIZE ) * loada( values+k+SIMDSIZE );
+   }
+   for( ; k<kpos; k+=SIMDSIZE ) {
+      xmm1 += gather( data, indices+k ) * loada( values+k );
+   }
+
+   ET sp( sum( xmm1 + xmm2 ) );
+
+   for( ; k<nonzeros; ++k ) {
+      sp += data[indices[k]] * values[k];
+   }
+
+   return sp;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Multiplication operator for the scalar product (inner product) of a dense and a
 //        sparse vector (\f$ s=\vec{a}*\vec{b} \f$).
@@ -100,14 +268,6 @@ inline decltype(auto)
 {
    BLAZE_FUNCTION_TRACE;
 
-   using CT1      = CompositeType_t<VT1>;    // Composite type of the left-hand side dense vector expression
-   using CT2      = CompositeType_t<VT2>;    // Composite type of the right-hand side sparse vector expression
-   using XT1      = RemoveReference_t<CT1>;  // Auxiliary type for the left-hand side composite type
-   using XT2      = RemoveReference_t<CT2>;  // Auxiliary type for the right-hand side composite type
-   using ET1      = ElementType_t<XT1>;      // Element type of the left-hand side dense vector expression
-   using ET2      = ElementType_t<XT2>;      // Element type of the right-hand side sparse vector expression
-   using MultType = MultTrait_t<ET1,ET2>;    // Multiplication result type
-
    BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE ( VT1 );
    BLAZE_CONSTRAINT_MUST_BE_SPARSE_VECTOR_TYPE( VT2 );
    BLAZE_CONSTRAINT_MUST_BE_ROW_VECTOR_TYPE   ( VT1 );
@@ -117,22 +277,7 @@ inline decltype(auto)
       BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
    }
 
-   CT1 left ( ~lhs );
-   CT2 right( ~rhs );
-
-   auto element( right.begin() );
-   auto end    ( right.end()   );
-
-   MultType sp{};
-
-   if( element != end ) {
-      sp = left[ element->index() ] * element->value();
-      ++element;
-      for( ; element!=end; ++element )
-         sp += left[ element->index() ] * element->value();
-   }
-
-   return sp;
+   return dvecsvecinner( ~lhs, ~rhs );
 }
 //*************************************************************************************************
 
@@ -55,6 +55,7 @@
 #include <blaze/math/typetraits/HasConstDataAccess.h>
 #include <blaze/math/typetraits/IsAligned.h>
 #include <blaze/math/typetraits/IsComputation.h>
+#include <blaze/math/typetraits/IsContiguous.h>
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsPadded.h>
 #include <blaze/math/typetraits/RequiresEvaluation.h>
@@ -835,6 +836,23 @@ struct IsPadded< DVecTransExpr<VT,TF> >
 /*! \endcond */
 //*************************************************************************************************
 
+
+
+//=================================================================================================
+//
+//  ISCONTIGUOUS SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename VT, bool TF >
+struct IsContiguous< DVecTransExpr<VT,TF> >
+   : public IsContiguous<VT>
+{};
+/*! \endcond */
+//*************************************************************************************************
+
 } // namespace blaze
 
 #endif
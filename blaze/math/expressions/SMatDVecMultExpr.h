@@ -56,20 +56,26 @@
 #include <blaze/math/expressions/MatVecMultExpr.h>
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/shims/Serial.h>
+#include <blaze/math/SIMD.h>
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/math/typetraits/IsAligned.h>
 #include <blaze/math/typetraits/IsComputation.h>
+#include <blaze/math/typetraits/IsContiguous.h>
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsIdentity.h>
+#include <blaze/math/typetraits/IsSlicedEllpack.h>
 #include <blaze/math/typetraits/IsZero.h>
 #include <blaze/math/typetraits/RequiresEvaluation.h>
 #include <blaze/math/views/Check.h>
+#include <blaze/system/Optimizations.h>
 #include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Min.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
 #include <blaze/util/MaybeUnused.h>
 #include <blaze/util/mpl/If.h>
+#include <blaze/util/typetraits/IsSame.h>
 #include <blaze/util/Types.h>
 
 
@@ -118,9 +124,11 @@ class SMatDVecMultExpr
        the evaluation strategy of the multiplication expression. In case either the matrix or
        the vector operand requires an intermediate evaluation or the dense vector expression
        is a compound expression, \a useAssign will be set to \a true and the multiplication
-       expression will be evaluated via the \a assign function family. Otherwise \a useAssign
-       will be set to \a false and the expression will be evaluated via the subscript operator. */
-   static constexpr bool useAssign = ( evaluateMatrix || evaluateVector );
+       expression will be evaluated via the \a assign function family. The same holds in case
+       the matrix operand is a sliced ELLPACK matrix, which provides specialized kernels.
+       Otherwise \a useAssign will be set to \a false and the expression will be evaluated via
+       the subscript operator. */
+   static constexpr bool useAssign = ( evaluateMatrix || evaluateVector || IsSlicedEllpack_v<MT> );
    //**********************************************************************************************
 
    //**********************************************************************************************
@@ -138,7 +146,23 @@ class SMatDVecMultExpr
        In case either the matrix or the vector operand requires an intermediate evaluation, the
        variable will be set to 1, otherwise it will be 0. */
    template< typename T1 >
-   static constexpr bool UseSMPAssign_v = useAssign;
+   static constexpr bool UseSMPAssign_v = ( evaluateMatrix || evaluateVector );
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   /*! In case the matrix operand is a sliced ELLPACK matrix and all element types are identical
+       single or double precision floating point types, the variable will be set to 1 and the
+       vectorized sliced ELLPACK kernels will be used. Otherwise the variable will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   static constexpr bool UseVectorizedSlicedEllpackKernel_v =
+      ( useOptimizedKernels &&
+        IsSlicedEllpack_v<T2> && IsContiguous_v<T3> &&
+        IsSame_v< ElementType_t<T2>, ElementType_t<T3> > &&
+        ( IsSame_v< ElementType_t<T2>, float > || IsSame_v< ElementType_t<T2>, double > ) &&
+        ( SIMDTrait< ElementType_t<T2> >::size > 1UL ) );
    /*! \endcond */
    //**********************************************************************************************
 
@@ -334,7 +358,57 @@ class SMatDVecMultExpr
       BLAZE_INTERNAL_ASSERT( x.size()    == rhs.vec_.size()   , "Invalid vector size"       );
       BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size()     , "Invalid vector size"       );
 
-      assign( ~lhs, A * x );
+      SMatDVecMultExpr::selectAssignKernel( ~lhs, A, x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Assignment to dense vectors (kernel selection)**********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Selection of the kernel for an assignment of a sparse matrix-dense vector
+   //        multiplication to a dense vector (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function relays the assignment to the multiplication of the evaluated operands.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline auto selectAssignKernel( VT1& y, const MT1& A, const VT2& x )
+      -> DisableIf_t< IsSlicedEllpack_v<MT1> >
+   {
+      assign( y, A * x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Assignment to dense vectors (sliced ELLPACK)************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a sliced ELLPACK matrix-dense vector multiplication to a dense vector
+   //        (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sliced ELLPACK matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function implements the assignment of a sliced ELLPACK matrix-dense vector
+   // multiplication to a dense vector by means of the addition assignment kernels.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline auto selectAssignKernel( VT1& y, const MT1& A, const VT2& x )
+      -> EnableIf_t< IsSlicedEllpack_v<MT1> >
+   {
+      reset( y );
+      SMatDVecMultExpr::selectAddAssignKernel( y, A, x );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -409,7 +483,134 @@ class SMatDVecMultExpr
       BLAZE_INTERNAL_ASSERT( x.size()    == rhs.vec_.size()   , "Invalid vector size"       );
       BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size()     , "Invalid vector size"       );
 
-      addAssign( ~lhs, A * x );
+      SMatDVecMultExpr::selectAddAssignKernel( ~lhs, A, x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to dense vectors (kernel selection)*************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Selection of the kernel for an addition assignment of a sparse matrix-dense vector
+   //        multiplication to a dense vector (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function relays the addition assignment to the multiplication of the evaluated
+   // operands.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline auto selectAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
+      -> DisableIf_t< IsSlicedEllpack_v<MT1> >
+   {
+      addAssign( y, A * x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Default addition assignment to dense vectors (sliced ELLPACK)*******************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default addition assignment of a sliced ELLPACK matrix-dense vector multiplication
+   //        (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sliced ELLPACK matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function implements the default addition assignment kernel for a sliced ELLPACK
+   // matrix-dense vector multiplication, which traverses the matrix row by row.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline auto selectAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
+      -> EnableIf_t< IsSlicedEllpack_v<MT1> &&
+                     !UseVectorizedSlicedEllpackKernel_v<VT1,MT1,VT2> >
+   {
+      for( size_t i=0UL; i<A.rows(); ++i )
+      {
+         const auto end( A.end(i) );
+         for( auto element=A.begin(i); element!=end; ++element ) {
+            y[i] += element->value() * x[element->index()];
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Vectorized addition assignment to dense vectors (sliced ELLPACK)****************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Vectorized addition assignment of a sliced ELLPACK matrix-dense vector multiplication
+   //        (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sliced ELLPACK matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function implements the vectorized addition assignment kernel for a sliced ELLPACK
+   // matrix-dense vector multiplication. All rows of a slice are processed simultaneously up to
+   // the length of the shortest row of the slice by gathering the according elements of \a x.
+   // The remaining elements of the longer rows are processed individually, which guarantees
+   // that the padding elements are never accessed.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline auto selectAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
+      -> EnableIf_t< UseVectorizedSlicedEllpackKernel_v<VT1,MT1,VT2> >
+   {
+      using ET = ElementType_t<MT1>;
+
+      constexpr size_t SIMDSIZE( SIMDTrait<ET>::size );
+
+      using IT = typename MT1::IndexType;
+
+      const ET* values ( A.values()  );
+      const IT* indices( A.indices() );
+      const ET* data   ( x.data()    );
+
+      for( size_t s=0UL; s<A.slices(); ++s )
+      {
+         const size_t offset( A.sliceOffset(s) );
+
+         size_t kmin( A.rowLength( s, 0UL ) );
+         for( size_t r=1UL; r<SIMDSIZE; ++r ) {
+            kmin = min( kmin, A.rowLength( s, r ) );
+         }
+
+         SIMDTrait_t<ET> xmm;
+         size_t pos( offset );
+
+         for( size_t k=0UL; k<kmin; ++k, pos+=SIMDSIZE ) {
+            xmm += loada( values+pos ) * gather( data, indices+pos );
+         }
+
+         for( size_t r=0UL; r<SIMDSIZE; ++r )
+         {
+            const size_t i( A.rowIndex( s, r ) );
+
+            if( i >= A.rows() ) break;
+
+            ET sum( xmm[r] );
+            const size_t kmax( A.rowLength( s, r ) );
+
+            for( size_t k=kmin; k<kmax; ++k ) {
+               const size_t j( offset + k*SIMDSIZE + r );
+               sum += values[j] * data[indices[j]];
+            }
+
+            y[i] += sum;
+         }
+      }
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -454,7 +655,134 @@ class SMatDVecMultExpr
       BLAZE_INTERNAL_ASSERT( x.size()    == rhs.vec_.size()   , "Invalid vector size"       );
       BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size()     , "Invalid vector size"       );
 
-      subAssign( ~lhs, A * x );
+      SMatDVecMultExpr::selectSubAssignKernel( ~lhs, A, x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Subtraction assignment to dense vectors (kernel selection)**********************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Selection of the kernel for a subtraction assignment of a sparse matrix-dense vector
+   //        multiplication to a dense vector (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function relays the subtraction assignment to the multiplication of the evaluated
+   // operands.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline auto selectSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
+      -> DisableIf_t< IsSlicedEllpack_v<MT1> >
+   {
+      subAssign( y, A * x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Default subtraction assignment to dense vectors (sliced ELLPACK)****************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default subtraction assignment of a sliced ELLPACK matrix-dense vector multiplication
+   //        (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sliced ELLPACK matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function implements the default subtraction assignment kernel for a sliced ELLPACK
+   // matrix-dense vector multiplication, which traverses the matrix row by row.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline auto selectSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
+      -> EnableIf_t< IsSlicedEllpack_v<MT1> &&
+                     !UseVectorizedSlicedEllpackKernel_v<VT1,MT1,VT2> >
+   {
+      for( size_t i=0UL; i<A.rows(); ++i )
+      {
+         const auto end( A.end(i) );
+         for( auto element=A.begin(i); element!=end; ++element ) {
+            y[i] -= element->value() * x[element->index()];
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Vectorized subtraction assignment to dense vectors (sliced ELLPACK)*************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Vectorized subtraction assignment of a sliced ELLPACK matrix-dense vector multiplication
+   //        (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sliced ELLPACK matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function implements the vectorized subtraction assignment kernel for a sliced ELLPACK
+   // matrix-dense vector multiplication. All rows of a slice are processed simultaneously up to
+   // the length of the shortest row of the slice by gathering the according elements of \a x.
+   // The remaining elements of the longer rows are processed individually, which guarantees
+   // that the padding elements are never accessed.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline auto selectSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
+      -> EnableIf_t< UseVectorizedSlicedEllpackKernel_v<VT1,MT1,VT2> >
+   {
+      using ET = ElementType_t<MT1>;
+
+      constexpr size_t SIMDSIZE( SIMDTrait<ET>::size );
+
+      using IT = typename MT1::IndexType;
+
+      const ET* values ( A.values()  );
+      const IT* indices( A.indices() );
+      const ET* data   ( x.data()    );
+
+      for( size_t s=0UL; s<A.slices(); ++s )
+      {
+         const size_t offset( A.sliceOffset(s) );
+
+         size_t kmin( A.rowLength( s, 0UL ) );
+         for( size_t r=1UL; r<SIMDSIZE; ++r ) {
+            kmin = min( kmin, A.rowLength( s, r ) );
+         }
+
+         SIMDTrait_t<ET> xmm;
+         size_t pos( offset );
+
+         for( size_t k=0UL; k<kmin; ++k, pos+=SIMDSIZE ) {
+            xmm += loada( values+pos ) * gather( data, indices+pos );
+         }
+
+         for( size_t r=0UL; r<SIMDSIZE; ++r )
+         {
+            const size_t i( A.rowIndex( s, r ) );
+
+            if( i >= A.rows() ) break;
+
+            ET sum( xmm[r] );
+            const size_t kmax( A.rowLength( s, r ) );
+
+            for( size_t k=kmin; k<kmax; ++k ) {
+               const size_t j( offset + k*SIMDSIZE + r );
+               sum += values[j] * data[indices[j]];
+            }
+
+            y[i] -= sum;
+         }
+      }
    }
    /*! \endcond */
    //**********************************************************************************************
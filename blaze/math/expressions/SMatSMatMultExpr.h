@@ -41,6 +41,7 @@
 //*************************************************************************************************
 
 #include <algorithm>
+#include <vector>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/Identity.h>
 #include <blaze/math/constraints/MatMatMultExpr.h>
@@ -54,7 +55,6 @@
 #include <blaze/math/expressions/Forward.h>
 #include <blaze/math/expressions/MatMatMultExpr.h>
 #include <blaze/math/expressions/SparseMatrix.h>
-#include <blaze/math/Infinity.h>
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/shims/Serial.h>
@@ -82,7 +82,6 @@
 #include <blaze/util/IntegralConstant.h>
 #include <blaze/util/MaybeUnused.h>
 #include <blaze/util/mpl/If.h>
-#include <blaze/util/SmallArray.h>
 #include <blaze/util/Types.h>
 
 
@@ -150,6 +149,25 @@ class SMatSMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Maximum number of non-zero elements in a row of the left-hand side operand for a heap merge.
+   /*! In case a row of the left-hand side sparse matrix operand contains at most \a heapThreshold
+       non-zero elements, the according rows of the right-hand side operand are merged via a
+       heap. This avoids both the workspace and the sorting of the other accumulators. */
+   static constexpr size_t heapThreshold = 2UL;
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Inverse of the minimum row density for the dense accumulator.
+   /*! In case at least every \a denseRatio-th column of a row of the result may be non-zero,
+       the row is accumulated in a dense array, otherwise it is accumulated in a hash table. */
+   static constexpr size_t denseRatio = 32UL;
+   /*! \endcond */
+   //**********************************************************************************************
+
  public:
    //**Type definitions****************************************************************************
    using This          = SMatSMatMultExpr<MT1,MT2>;    //!< Type of this SMatSMatMultExpr instance.
@@ -357,6 +375,45 @@ class SMatSMatMultExpr
    RightOperand rhs_;  //!< Right-hand side sparse matrix of the multiplication expression.
    //**********************************************************************************************
 
+   //**Workspace***********************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Workspace of the dense and the hash accumulator of the sparse assignment kernel.
+   //
+   // The workspace is sized lazily: The dense accumulator only allocates memory proportional to
+   // the number of columns of the result in case a sufficiently dense row is encountered. Every
+   // thread owns a single workspace (see getWorkspace()) that is reused by all kernel calls. In
+   // order to avoid clearing the markers of the dense accumulator, every processed row is marked
+   // by a new value of the generation counter.
+   */
+   struct Workspace
+   {
+      size_t                   generation{ 0UL };  //!< Generation counter of the dense accumulator.
+      std::vector<size_t>      markers;            //!< Row markers of the dense accumulator.
+      std::vector<ElementType> values;             //!< Values of the dense accumulator.
+      std::vector<size_t>      keys;               //!< Column indices of the hash accumulator.
+      std::vector<ElementType> entries;            //!< Values of the hash accumulator.
+      std::vector<size_t>      indices;            //!< Column indices of the current row.
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Get workspace function**********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Returns the workspace of the sparse assignment kernel of the calling thread.
+   //
+   // \return Reference to the workspace of the calling thread.
+   //
+   // The workspace is allocated once per thread and reused by all subsequent kernel calls of
+   // the thread, e.g. by all blocks of rows a thread processes during a parallel assignment.
+   */
+   static Workspace& getWorkspace()
+   {
+      thread_local Workspace workspace;
+      return workspace;
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Assignment to dense matrices****************************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Assignment of a sparse matrix-sparse matrix multiplication to a dense matrix
@@ -444,7 +501,13 @@ class SMatSMatMultExpr
    // \return void
    //
    // This function implements the performance optimized assignment of a sparse matrix-sparse
-   // matrix multiplication expression to a row-major sparse matrix.
+   // matrix multiplication expression to a row-major sparse matrix. The multiplication is
+   // performed in two phases: The symbolic phase determines the exact number of non-zero
+   // elements of every row of the result, the numeric phase computes the elements and appends
+   // them to the reserved storage. In both phases the accumulator for a row is selected based
+   // on the structure of the row: The rows of \a B are merged via a heap in case the according
+   // row of \a A contains only few elements, dense rows are accumulated in a dense array and
+   // all remaining rows are accumulated in a hash table.
    */
    template< typename MT >  // Type of the target sparse matrix
    friend inline void assign( SparseMatrix<MT,false>& lhs, const SMatSMatMultExpr& rhs )
@@ -464,95 +527,448 @@ class SMatSMatMultExpr
       BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).rows()     , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( B.columns() == (~lhs).columns()  , "Invalid number of columns" );
 
-      // (Over-)Estimating the number of non-zero entries in the resulting matrix
-      size_t nonzeros( 0UL );
+      SMatSMatMultExpr::selectSparseAssignKernel( ~lhs, A, B );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Sparse assignment kernel********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment kernel of a sparse matrix-sparse matrix multiplication to a row-major
+   //        sparse matrix (\f$ C=A*B \f$).
+   // \ingroup sparse_matrix
+   //
+   // \param C The target left-hand side sparse matrix.
+   // \param A The left-hand side sparse matrix operand.
+   // \param B The right-hand side sparse matrix operand.
+   // \return void
+   //
+   // This function implements the two-phase (symbolic/numeric) assignment kernel for the sparse
+   // matrix-sparse matrix multiplication. The kernel works strictly row by row and only requires
+   // a workspace proportional to the number of columns of \a C in case dense rows are encountered.
+   // In case of a parallel assignment every thread executes the kernel on its own block of rows.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline void selectSparseAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      //! Heap entry representing a scaled row of the right-hand side sparse matrix operand.
+      struct HeapEntry {
+         ConstIterator_t<MT5> pos;    //!< Iterator to the current element of the row.
+         ConstIterator_t<MT5> end;    //!< Iterator one past the last element of the row.
+         ElementType_t<MT4>   scale;  //!< Element of the left-hand side operand scaling the row.
+      };
+
+      const size_t M( A.rows() );
+
+      std::vector<HeapEntry> heap;
+      Workspace& workspace( getWorkspace() );
+
+      heap.reserve( heapThreshold );
+
+      // Symbolic phase: Computing the exact number of non-zero elements of each row
+      std::vector<size_t> nonzeros( M, 0UL );
+      size_t total( 0UL );
+
+      for( size_t i=0UL; i<M; ++i ) {
+         nonzeros[i] = countRow( A, B, i, heap, workspace );
+         total += nonzeros[i];
+      }
+
+      BLAZE_INTERNAL_ASSERT( total <= C.rows() * C.columns(), "Invalid number of non-zero elements" );
+
+      C.reserve( total );
+
+      // Numeric phase: Computing and appending the non-zero elements of each row
+      for( size_t i=0UL; i<M; ++i ) {
+         computeRow( C, A, B, i, nonzeros[i], heap, workspace );
+         C.finalize( i );
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Symbolic row kernel*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Computes the exact number of non-zero elements of a single row of \f$ A*B \f$.
+   // \ingroup sparse_matrix
+   //
+   // \param A The left-hand side sparse matrix operand.
+   // \param B The right-hand side sparse matrix operand.
+   // \param i The index of the row.
+   // \param heap The heap for the merge of the rows of \a B.
+   // \param workspace The workspace of the dense and the hash accumulator.
+   // \return The number of non-zero elements of row \a i.
+   */
+   template< typename MT4     // Type of the left-hand side matrix operand
+           , typename MT5     // Type of the right-hand side matrix operand
+           , typename Heap >  // Type of the heap
+   static size_t countRow( const MT4& A, const MT5& B, size_t i, Heap& heap, Workspace& workspace )
+   {
+      const size_t N( B.columns() );
+
+      size_t elements( 0UL );
+      const size_t bound( rowBound( A, B, i, elements ) );
+
+      if( bound == 0UL ) {
+         return 0UL;
+      }
+
+      size_t count( 0UL );
+
+      // Merging the rows of B via a heap
+      if( elements <= heapThreshold ) {
+         mergeRows( A, B, i, heap, [&count]( size_t, const ElementType& ) { ++count; } );
+      }
+
+      // Counting the elements via the dense accumulator
+      else if( bound * denseRatio >= N ) {
+         std::vector<size_t>& markers( workspace.markers );
+         const size_t stamp( ++workspace.generation );
+
+         if( markers.size() < N ) {
+            markers.resize( N, 0UL );
+         }
 
-      for( size_t i=0UL; i<(~lhs).rows(); ++i ) {
          const auto lend( A.end(i) );
          for( auto lelem=A.begin(i); lelem!=lend; ++lelem ) {
-            nonzeros += B.nonZeros( lelem->index() );
+            const auto rend( B.end( lelem->index() ) );
+            for( auto relem=B.begin( lelem->index() ); relem!=rend; ++relem ) {
+               if( markers[relem->index()] != stamp ) {
+                  markers[relem->index()] = stamp;
+                  ++count;
+               }
+            }
          }
       }
 
-      if( nonzeros > (~lhs).rows() * (~lhs).columns() ) {
-         nonzeros = (~lhs).rows() * (~lhs).columns();
+      // Counting the elements via the hash accumulator
+      else {
+         std::vector<size_t>& keys( workspace.keys );
+         const size_t bits( tableBits( bound ) );
+         const size_t mask( ( 1UL << bits ) - 1UL );
+
+         if( keys.size() <= mask ) {
+            keys.resize( mask+1UL );
+         }
+         std::fill_n( keys.begin(), mask+1UL, N );
+
+         const auto lend( A.end(i) );
+         for( auto lelem=A.begin(i); lelem!=lend; ++lelem ) {
+            const auto rend( B.end( lelem->index() ) );
+            for( auto relem=B.begin( lelem->index() ); relem!=rend; ++relem )
+            {
+               size_t pos( hash( relem->index(), bits ) );
+               while( keys[pos] != relem->index() ) {
+                  if( keys[pos] == N ) {
+                     keys[pos] = relem->index();
+                     ++count;
+                     break;
+                  }
+                  pos = ( pos + 1UL ) & mask;
+               }
+            }
+         }
+      }
+
+      BLAZE_INTERNAL_ASSERT( count <= min( bound, N ), "Invalid number of non-zero elements" );
+
+      return count;
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Numeric row kernel**************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Computes and appends the non-zero elements of a single row of \f$ A*B \f$.
+   // \ingroup sparse_matrix
+   //
+   // \param C The target left-hand side sparse matrix.
+   // \param A The left-hand side sparse matrix operand.
+   // \param B The right-hand side sparse matrix operand.
+   // \param i The index of the row.
+   // \param nonzeros The number of non-zero elements of row \a i determined by countRow().
+   // \param heap The heap for the merge of the rows of \a B.
+   // \param workspace The workspace of the dense and the hash accumulator.
+   // \return void
+   */
+   template< typename MT3     // Type of the left-hand side target matrix
+           , typename MT4     // Type of the left-hand side matrix operand
+           , typename MT5     // Type of the right-hand side matrix operand
+           , typename Heap >  // Type of the heap
+   static void computeRow( MT3& C, const MT4& A, const MT5& B, size_t i, size_t nonzeros,
+                           Heap& heap, Workspace& workspace )
+   {
+      if( nonzeros == 0UL ) {
+         return;
       }
 
-      (~lhs).reserve( nonzeros );
-      nonzeros = 0UL;
+      const size_t N( B.columns() );
+
+      size_t elements( 0UL );
+      const size_t bound( rowBound( A, B, i, elements ) );
 
-      // Performing the matrix-matrix multiplication
-      SmallArray<ElementType,128UL> values ( (~lhs).columns(), ElementType() );
-      SmallArray<bool,128UL>        valid  ( (~lhs).columns(), false );
-      SmallArray<size_t,128UL>      indices( (~lhs).columns(), 0UL );
-      size_t minIndex( inf ), maxIndex( 0UL );
+      std::vector<size_t>& indices( workspace.indices );
+      indices.clear();
 
-      for( size_t i=0UL; i<(~lhs).rows(); ++i )
+      // Merging the rows of B via a heap
+      if( elements <= heapThreshold )
       {
+         mergeRows( A, B, i, heap, [&C,i]( size_t j, const ElementType& value ) {
+            if( !isDefault( value ) ) {
+               C.append( i, j, value );
+            }
+         } );
+      }
+
+      // Accumulating the elements via the dense accumulator
+      else if( bound * denseRatio >= N )
+      {
+         std::vector<size_t>& markers( workspace.markers );
+         std::vector<ElementType>& values( workspace.values );
+         const size_t stamp( ++workspace.generation );
+         size_t minIndex( N ), maxIndex( 0UL );
+
+         if( values.size() < N ) {
+            values.resize( N );
+         }
+
          const auto lend( A.end(i) );
-         for( auto lelem=A.begin(i); lelem!=lend; ++lelem )
-         {
+         for( auto lelem=A.begin(i); lelem!=lend; ++lelem ) {
             const auto rend( B.end( lelem->index() ) );
             for( auto relem=B.begin( lelem->index() ); relem!=rend; ++relem )
             {
-               if( !valid[relem->index()] ) {
-                  values[relem->index()] = lelem->value() * relem->value();
-                  valid [relem->index()] = true;
-                  indices[nonzeros] = relem->index();
-                  ++nonzeros;
-                  if( relem->index() < minIndex ) minIndex = relem->index();
-                  if( relem->index() > maxIndex ) maxIndex = relem->index();
+               const size_t j( relem->index() );
+
+               if( markers[j] != stamp ) {
+                  markers[j] = stamp;
+                  values[j] = lelem->value() * relem->value();
+                  indices.push_back( j );
+                  if( j < minIndex ) minIndex = j;
+                  if( j > maxIndex ) maxIndex = j;
                }
                else {
-                  values[relem->index()] += lelem->value() * relem->value();
+                  values[j] += lelem->value() * relem->value();
                }
             }
          }
 
-         BLAZE_INTERNAL_ASSERT( nonzeros <= (~lhs).columns(), "Invalid number of non-zero elements" );
+         BLAZE_INTERNAL_ASSERT( indices.size() == nonzeros, "Invalid number of non-zero elements" );
+         BLAZE_INTERNAL_ASSERT( minIndex <= maxIndex, "Invalid index detected" );
 
-         if( nonzeros > 0UL )
-         {
-            BLAZE_INTERNAL_ASSERT( minIndex <= maxIndex, "Invalid index detected" );
+         if( ( nonzeros + nonzeros ) < ( maxIndex - minIndex ) ) {
+            std::sort( indices.begin(), indices.end() );
+            for( size_t j : indices ) {
+               if( !isDefault( values[j] ) ) {
+                  C.append( i, j, values[j] );
+               }
+            }
+         }
+         else {
+            for( size_t j=minIndex; j<=maxIndex; ++j ) {
+               if( markers[j] == stamp && !isDefault( values[j] ) ) {
+                  C.append( i, j, values[j] );
+               }
+            }
+         }
+      }
+
+      // Accumulating the elements via the hash accumulator
+      else
+      {
+         std::vector<size_t>& keys( workspace.keys );
+         std::vector<ElementType>& values( workspace.entries );
+         const size_t bits( tableBits( nonzeros ) );
+         const size_t mask( ( 1UL << bits ) - 1UL );
 
-            if( ( nonzeros + nonzeros ) < ( maxIndex - minIndex ) )
+         if( keys.size() <= mask ) {
+            keys.resize( mask+1UL );
+         }
+         if( values.size() <= mask ) {
+            values.resize( mask+1UL );
+         }
+         std::fill_n( keys.begin(), mask+1UL, N );
+
+         const auto lend( A.end(i) );
+         for( auto lelem=A.begin(i); lelem!=lend; ++lelem ) {
+            const auto rend( B.end( lelem->index() ) );
+            for( auto relem=B.begin( lelem->index() ); relem!=rend; ++relem )
             {
-               std::sort( indices.begin(), indices.begin() + nonzeros );
-
-               for( size_t j=0UL; j<nonzeros; ++j )
-               {
-                  const size_t index( indices[j] );
-                  if( !isDefault( values[index] ) ) {
-                     (~lhs).append( i, index, values[index] );
-                     reset( values[index] );
-                  }
+               size_t pos( hash( relem->index(), bits ) );
+               while( keys[pos] != relem->index() && keys[pos] != N ) {
+                  pos = ( pos + 1UL ) & mask;
+               }
 
-                  reset( valid[index] );
+               if( keys[pos] == N ) {
+                  keys[pos] = relem->index();
+                  values[pos] = lelem->value() * relem->value();
+                  indices.push_back( relem->index() );
+               }
+               else {
+                  values[pos] += lelem->value() * relem->value();
                }
             }
-            else {
-               for( size_t j=minIndex; j<=maxIndex; ++j )
-               {
-                  if( !isDefault( values[j] ) ) {
-                     (~lhs).append( i, j, values[j] );
-                     reset( values[j] );
-                  }
+         }
 
-                  reset( valid[j] );
-               }
+         BLAZE_INTERNAL_ASSERT( indices.size() == nonzeros, "Invalid number of non-zero elements" );
+
+         std::sort( indices.begin(), indices.end() );
+
+         for( size_t j : indices )
+         {
+            size_t pos( hash( j, bits ) );
+            while( keys[pos] != j ) {
+               pos = ( pos + 1UL ) & mask;
+            }
+
+            if( !isDefault( values[pos] ) ) {
+               C.append( i, j, values[pos] );
+            }
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Heap-based row merge************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Merges the scaled rows of \a B selected by row \a i of \a A via a heap.
+   // \ingroup sparse_matrix
+   //
+   // \param A The left-hand side sparse matrix operand.
+   // \param B The right-hand side sparse matrix operand.
+   // \param i The index of the row.
+   // \param heap The heap for the merge of the rows of \a B.
+   // \param f The function to be called for every element of the resulting row.
+   // \return void
+   //
+   // This function calls \a f once per column index of the resulting row in ascending order of
+   // the column indices. In contrast to the dense and the hash accumulator no sorting is required.
+   */
+   template< typename MT4     // Type of the left-hand side matrix operand
+           , typename MT5     // Type of the right-hand side matrix operand
+           , typename Heap    // Type of the heap
+           , typename Func >  // Type of the function
+   static void mergeRows( const MT4& A, const MT5& B, size_t i, Heap& heap, Func f )
+   {
+      const auto greater = []( const auto& a, const auto& b ) {
+         return a.pos->index() > b.pos->index();
+      };
+
+      heap.clear();
+
+      const auto lend( A.end(i) );
+      for( auto lelem=A.begin(i); lelem!=lend; ++lelem ) {
+         if( B.begin( lelem->index() ) != B.end( lelem->index() ) ) {
+            heap.push_back( { B.begin( lelem->index() ), B.end( lelem->index() ), lelem->value() } );
+         }
+      }
+
+      std::make_heap( heap.begin(), heap.end(), greater );
+
+      ElementType value{};
+      size_t index( B.columns() );
+
+      while( !heap.empty() )
+      {
+         std::pop_heap( heap.begin(), heap.end(), greater );
+         auto& entry( heap.back() );
+
+         if( entry.pos->index() == index ) {
+            value += entry.scale * entry.pos->value();
+         }
+         else {
+            if( index != B.columns() ) {
+               f( index, value );
             }
+            index = entry.pos->index();
+            value = entry.scale * entry.pos->value();
+         }
 
-            nonzeros = 0UL;
-            minIndex = inf;
-            maxIndex = 0UL;
+         if( ++entry.pos != entry.end ) {
+            std::push_heap( heap.begin(), heap.end(), greater );
+         }
+         else {
+            heap.pop_back();
          }
+      }
 
-         (~lhs).finalize( i );
+      if( index != B.columns() ) {
+         f( index, value );
       }
    }
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Row bound computation***********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Computes the number of products contributing to a single row of \f$ A*B \f$.
+   // \ingroup sparse_matrix
+   //
+   // \param A The left-hand side sparse matrix operand.
+   // \param B The right-hand side sparse matrix operand.
+   // \param i The index of the row.
+   // \param elements Output parameter for the number of non-zero elements in row \a i of \a A.
+   // \return The number of products contributing to row \a i.
+   */
+   template< typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline size_t rowBound( const MT4& A, const MT5& B, size_t i, size_t& elements )
+   {
+      size_t bound( 0UL );
+
+      const auto lend( A.end(i) );
+      for( auto lelem=A.begin(i); lelem!=lend; ++lelem ) {
+         bound += B.nonZeros( lelem->index() );
+         ++elements;
+      }
+
+      return bound;
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Hash table size computation*****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Computes the size of the hash table for the given number of elements.
+   // \ingroup sparse_matrix
+   //
+   // \param n The maximum number of elements to be stored in the hash table.
+   // \return The binary logarithm of the smallest power of two greater than or equal to \f$ 2n \f$.
+   */
+   static inline size_t tableBits( size_t n ) noexcept
+   {
+      size_t bits( 1UL );
+      while( ( 1UL << bits ) < n + n ) {
+         ++bits;
+      }
+      return bits;
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Hash function*******************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Hash function of the hash accumulator.
+   // \ingroup sparse_matrix
+   //
+   // \param index The column index to be hashed.
+   // \param bits The binary logarithm of the size of the hash table.
+   // \return The hash value of the given column index in the range \f$ [0..2^{bits}) \f$.
+   //
+   // This function implements a multiplicative (Fibonacci) hash, which takes the high bits of
+   // the product of the index and \f$ 2^{64}/\phi \f$. In contrast to the low bits, the high
+   // bits depend on all bits of the index and therefore also spread column indices with a
+   // power-of-two stride evenly across the table.
+   */
+   static inline size_t hash( size_t index, size_t bits ) noexcept
+   {
+      return static_cast<size_t>( ( uint64_t( index ) * 11400714819323198485ULL ) >> ( 64UL - bits ) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Assignment to column-major sparse matrices**************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Assignment of a sparse matrix-sparse matrix multiplication to a column-major sparse
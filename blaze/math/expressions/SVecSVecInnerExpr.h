@@ -48,13 +48,56 @@
 #include <blaze/math/expressions/SparseVector.h>
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/math/typetraits/IsOpposedView.h>
+#include <blaze/math/typetraits/IsSplitCompressed.h>
+#include <blaze/system/Optimizations.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsNumeric.h>
 #include <blaze/util/typetraits/RemoveReference.h>
 
 
 namespace blaze {
 
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the sparse vector/sparse vector scalar multiplication.
+// \ingroup sparse_vector
+*/
+template< typename VT1    // Type of the left-hand side sparse vector
+        , typename VT2 >  // Type of the right-hand side sparse vector
+struct SVecSVecInnerExprHelper
+{
+   //**Type definitions****************************************************************************
+   //! Composite type of the left-hand side sparse vector expression.
+   using CT1 = RemoveReference_t< CompositeType_t<VT1> >;
+
+   //! Composite type of the right-hand side sparse vector expression.
+   using CT2 = RemoveReference_t< CompositeType_t<VT2> >;
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   static constexpr bool value =
+      ( useOptimizedKernels &&
+        IsSplitCompressed_v<CT1> &&
+        IsSplitCompressed_v<CT2> &&
+        IsNumeric_v< ElementType_t<CT1> > &&
+        IsNumeric_v< ElementType_t<CT2> > );
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  GLOBAL BINARY ARITHMETIC OPERATORS
@@ -62,56 +105,34 @@ namespace blaze {
 //=================================================================================================
 
 //*************************************************************************************************
-/*!\brief Multiplication operator for the scalar product (inner product) of two sparse vectors
-//        (\f$ s=\vec{a}*\vec{b} \f$).
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default backend implementation of the scalar product (inner product) of two sparse
+//        vectors (\f$ s=\vec{a}*\vec{b} \f$).
 // \ingroup sparse_vector
 //
 // \param lhs The left-hand side sparse vector for the inner product.
 // \param rhs The right-hand side sparse vector for the inner product.
 // \return The scalar product.
-// \exception std::invalid_argument Vector sizes do not match.
 //
-// This operator represents the scalar product (inner product) of two sparse vectors:
-
-   \code
-   using blaze::columnVector;
-
-   blaze::CompressedVector<double,columnVector> a, b;
-   blaze::real res;
-   // ... Resizing and initialization
-   res = trans(a) * b;
-   \endcode
-
-// The operator returns a scalar value of the higher-order element type of the two involved
-// vector element types \a VT1::ElementType and \a VT2::ElementType. Both vector types \a VT1
-// and \a VT2 as well as the two element types \a VT1::ElementType and \a VT2::ElementType
-// have to be supported by the MultTrait class template.\n
-// In case the current sizes of the two given vectors don't match, a \a std::invalid_argument
-// is thrown.
+// This function implements the default scalar product of two sparse vectors. Due to the explicit
+// application of the SFINAE principle, this function can only be selected by the compiler in
+// case the optimized kernel for split compressed vectors cannot be applied.
 */
 template< typename VT1    // Type of the left-hand side sparse vector
         , typename VT2 >  // Type of the right-hand side sparse vector
-inline decltype(auto)
-   operator*( const SparseVector<VT1,true>& lhs, const SparseVector<VT2,false>& rhs )
+inline auto svecsvecinner( const SparseVector<VT1,true>& lhs, const SparseVector<VT2,false>& rhs )
+   -> DisableIf_t< SVecSVecInnerExprHelper<VT1,VT2>::value
+                 , const MultTrait_t< ElementType_t<VT1>, ElementType_t<VT2> > >
 {
-   BLAZE_FUNCTION_TRACE;
-
    using CT1      = CompositeType_t<VT1>;    // Composite type of the left-hand side sparse vector expression
    using CT2      = CompositeType_t<VT2>;    // Composite type of the right-hand side sparse vector expression
    using XT1      = RemoveReference_t<CT1>;  // Auxiliary type for the left-hand side composite type
    using XT2      = RemoveReference_t<CT2>;  // Auxiliary type for the right-hand side composite type
    using ET1      = ElementType_t<XT1>;      // Element type of the left-hand side sparse vector expression
    using ET2      = ElementType_t<XT2>;      // Element type of the right-hand side sparse vector expression
-   using MultType = MultTrait_t<ET1,ET2>;    // Multiplication result typen
-
-   BLAZE_CONSTRAINT_MUST_BE_SPARSE_VECTOR_TYPE( VT1 );
-   BLAZE_CONSTRAINT_MUST_BE_SPARSE_VECTOR_TYPE( VT2 );
-   BLAZE_CONSTRAINT_MUST_BE_ROW_VECTOR_TYPE   ( VT1 );
-   BLAZE_CONSTRAINT_MUST_BE_COLUMN_VECTOR_TYPE( VT2 );
+   using MultType = MultTrait_t<ET1,ET2>;    // Multiplication result type
 
-   if( (~lhs).size() != (~rhs).size() ) {
-      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
-   }
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
 
    CT1 left ( ~lhs );  // Evaluation of the left-hand side sparse vector operand
    CT2 right( ~rhs );  // Evaluation of the right-hand side sparse vector operand
@@ -206,6 +227,123 @@ inline decltype(auto)
 
    return sp;
 }
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Optimized backend implementation of the scalar product (inner product) of two split
+//        compressed vectors (\f$ s=\vec{a}*\vec{b} \f$).
+// \ingroup sparse_vector
+//
+// \param lhs The left-hand side sparse vector for the inner product.
+// \param rhs The right-hand side sparse vector for the inner product.
+// \return The scalar product.
+//
+// This function implements the performance optimized scalar product of two sparse vectors that
+// store their values and indices in separate arrays (see SplitCompressedVector). The non-zero
+// patterns are intersected by a merge on the two index arrays, which advances both positions
+// without branches, and the values are only loaded for matching indices. Due to the explicit application of the SFINAE principle,
+// this function can only be selected by the compiler in case both operands are split
+// compressed vectors.
+*/
+template< typename VT1    // Type of the left-hand side sparse vector
+        , typename VT2 >  // Type of the right-hand side sparse vector
+inline auto svecsvecinner( const SparseVector<VT1,true>& lhs, const SparseVector<VT2,false>& rhs )
+   -> EnableIf_t< SVecSVecInnerExprHelper<VT1,VT2>::value
+                , const MultTrait_t< ElementType_t<VT1>, ElementType_t<VT2> > >
+{
+   using CT1      = CompositeType_t<VT1>;
+   using CT2      = CompositeType_t<VT2>;
+   using ET1      = ElementType_t<VT1>;
+   using ET2      = ElementType_t<VT2>;
+   using MultType = MultTrait_t<ET1,ET2>;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
+
+   CT1 left ( ~lhs );
+   CT2 right( ~rhs );
+
+   const auto lbegin( left.begin()  );
+   const auto rbegin( right.begin() );
+
+   const size_t lnonzeros( left.end()  - lbegin );
+   const size_t rnonzeros( right.end() - rbegin );
+
+   const auto* lvalues ( lbegin.valueBase() );
+   const auto* lindices( lbegin.indexBase() );
+   const auto* rvalues ( rbegin.valueBase() );
+   const auto* rindices( rbegin.indexBase() );
+
+   MultType sp{};
+   size_t i( 0UL ), j( 0UL );
+
+   while( i < lnonzeros && j < rnonzeros )
+   {
+      const size_t lindex( lindices[i] );
+      const size_t rindex( rindices[j] );
+
+      if( lindex == rindex ) {
+         sp += lvalues[i] * rvalues[j];
+      }
+
+      i += ( lindex <= rindex );
+      j += ( rindex <= lindex );
+   }
+
+   return sp;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the scalar product (inner product) of two sparse vectors
+//        (\f$ s=\vec{a}*\vec{b} \f$).
+// \ingroup sparse_vector
+//
+// \param lhs The left-hand side sparse vector for the inner product.
+// \param rhs The right-hand side sparse vector for the inner product.
+// \return The scalar product.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This operator represents the scalar product (inner product) of two sparse vectors:
+
+   \code
+   using blaze::columnVector;
+
+   blaze::CompressedVector<double,columnVector> a, b;
+   blaze::real res;
+   // ... Resizing and initialization
+   res = trans(a) * b;
+   \endcode
+
+// The operator returns a scalar value of the higher-order element type of the two involved
+// vector element types \a VT1::ElementType and \a VT2::ElementType. Both vector types \a VT1
+// and \a VT2 as well as the two element types \a VT1::ElementType and \a VT2::ElementType
+// have to be supported by the MultTrait class template.\n
+// In case the current sizes of the two given vectors don't match, a \a std::invalid_argument
+// is thrown.
+*/
+template< typename VT1    // Type of the left-hand side sparse vector
+        , typename VT2 >  // Type of the right-hand side sparse vector
+inline decltype(auto)
+   operator*( const SparseVector<VT1,true>& lhs, const SparseVector<VT2,false>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_BE_SPARSE_VECTOR_TYPE( VT1 );
+   BLAZE_CONSTRAINT_MUST_BE_SPARSE_VECTOR_TYPE( VT2 );
+   BLAZE_CONSTRAINT_MUST_BE_ROW_VECTOR_TYPE   ( VT1 );
+   BLAZE_CONSTRAINT_MUST_BE_COLUMN_VECTOR_TYPE( VT2 );
+
+   if( (~lhs).size() != (~rhs).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   return svecsvecinner( ~lhs, ~rhs );
+}
 //*************************************************************************************************
 
 } // namespace blaze
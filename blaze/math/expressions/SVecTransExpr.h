@@ -52,6 +52,7 @@
 #include <blaze/math/expressions/Transformation.h>
 #include <blaze/math/expressions/VecTransExpr.h>
 #include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/typetraits/IsSplitCompressed.h>
 #include <blaze/math/typetraits/RequiresEvaluation.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
@@ -716,6 +717,23 @@ inline decltype(auto) transTo( const SparseVector<VT,TF>& sv )
 }
 //*************************************************************************************************
 
+
+
+//=================================================================================================
+//
+//  ISSPLITCOMPRESSED SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename VT, bool TF >
+struct IsSplitCompressed< SVecTransExpr<VT,TF> >
+   : public IsSplitCompressed<VT>
+{};
+/*! \endcond */
+//*************************************************************************************************
+
 } // namespace blaze
 
 #endif
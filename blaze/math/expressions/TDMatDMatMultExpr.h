@@ -109,6 +109,7 @@
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
 #include <blaze/util/IntegralConstant.h>
+#include <blaze/util/KernelTrace.h>
 #include <blaze/util/mpl/If.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/IsBuiltin.h>
@@ -541,10 +542,16 @@ class TDMatDMatMultExpr
       if( ( IsDiagonal_v<MT4> && IsDiagonal_v<MT5> ) ||
           ( !BLAZE_DEBUG_MODE && IsRowMajorMatrix_v<MT3> && B.columns() <= SIMDSIZE*10UL ) ||
           ( !BLAZE_DEBUG_MODE && IsColumnMajorMatrix_v<MT3> && A.rows() <= SIMDSIZE*10UL ) ||
-          ( C.rows() * C.columns() < TDMATDMATMULT_THRESHOLD ) )
+          ( C.rows() * C.columns() < TDMATDMATMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_TRACE( "TDMatDMatMultExpr::assign", "small", A.rows(), B.columns(), A.columns() );
          selectSmallAssignKernel( C, A, B );
-      else
+      }
+      else {
+         BLAZE_KERNEL_TRACE( "TDMatDMatMultExpr::assign",
+                             ( UseBlasKernel_v<MT3,MT4,MT5> )?( "blas" ):( UseVectorizedDefaultKernel_v<MT3,MT4,MT5> )?( "large" ):( "default" ),
+                             A.rows(), B.columns(), A.columns() );
          selectBlasAssignKernel( C, A, B );
+      }
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -793,7 +800,7 @@ class TDMatDMatMultExpr
    static inline auto selectDefaultAssignKernel( MT3& C, const MT4& A, const MT5& B )
       -> EnableIf_t< IsRowMajorMatrix_v<MT3> && !IsDiagonal_v<MT4> && IsDiagonal_v<MT5> >
    {
-      constexpr size_t block( BLOCK_SIZE );
+      const size_t block( BLOCK_SIZE );
 
       const size_t M( A.rows()    );
       const size_t N( B.columns() );
@@ -953,7 +960,7 @@ class TDMatDMatMultExpr
    static inline auto selectDefaultAssignKernel( MT3& C, const MT4& A, const MT5& B )
       -> EnableIf_t< IsColumnMajorMatrix_v<MT3> && IsDiagonal_v<MT4> && !IsDiagonal_v<MT5> >
    {
-      constexpr size_t block( BLOCK_SIZE );
+      const size_t block( BLOCK_SIZE );
 
       const size_t M( A.rows()    );
       const size_t N( B.columns() );
@@ -2814,10 +2821,16 @@ class TDMatDMatMultExpr
       if( ( IsDiagonal_v<MT4> && IsDiagonal_v<MT5> ) ||
           ( !BLAZE_DEBUG_MODE && IsRowMajorMatrix_v<MT3> && B.columns() <= SIMDSIZE*10UL ) ||
           ( !BLAZE_DEBUG_MODE && IsColumnMajorMatrix_v<MT3> && A.rows() <= SIMDSIZE*10UL ) ||
-          ( C.rows() * C.columns() < TDMATDMATMULT_THRESHOLD ) )
+          ( C.rows() * C.columns() < TDMATDMATMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_TRACE( "TDMatDMatMultExpr::addAssign", "small", A.rows(), B.columns(), A.columns() );
          selectSmallAddAssignKernel( C, A, B );
-      else
+      }
+      else {
+         BLAZE_KERNEL_TRACE( "TDMatDMatMultExpr::addAssign",
+                             ( UseBlasKernel_v<MT3,MT4,MT5> )?( "blas" ):( UseVectorizedDefaultKernel_v<MT3,MT4,MT5> )?( "large" ):( "default" ),
+                             A.rows(), B.columns(), A.columns() );
          selectBlasAddAssignKernel( C, A, B );
+      }
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -2978,7 +2991,7 @@ class TDMatDMatMultExpr
    static inline auto selectDefaultAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
       -> EnableIf_t< IsRowMajorMatrix_v<MT3> && !IsDiagonal_v<MT4> && IsDiagonal_v<MT5> >
    {
-      constexpr size_t block( BLOCK_SIZE );
+      const size_t block( BLOCK_SIZE );
 
       const size_t M( A.rows()    );
       const size_t N( B.columns() );
@@ -3122,7 +3135,7 @@ class TDMatDMatMultExpr
    static inline auto selectDefaultAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
       -> EnableIf_t< IsColumnMajorMatrix_v<MT3> && IsDiagonal_v<MT4> && !IsDiagonal_v<MT5> >
    {
-      constexpr size_t block( BLOCK_SIZE );
+      const size_t block( BLOCK_SIZE );
 
       const size_t M( A.rows()    );
       const size_t N( B.columns() );
@@ -4816,10 +4829,16 @@ class TDMatDMatMultExpr
       if( ( IsDiagonal_v<MT4> && IsDiagonal_v<MT5> ) ||
           ( !BLAZE_DEBUG_MODE && IsRowMajorMatrix_v<MT3> && B.columns() <= SIMDSIZE*10UL ) ||
           ( !BLAZE_DEBUG_MODE && IsColumnMajorMatrix_v<MT3> && A.rows() <= SIMDSIZE*10UL ) ||
-          ( C.rows() * C.columns() < TDMATDMATMULT_THRESHOLD ) )
+          ( C.rows() * C.columns() < TDMATDMATMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_TRACE( "TDMatDMatMultExpr::subAssign", "small", A.rows(), B.columns(), A.columns() );
          selectSmallSubAssignKernel( C, A, B );
-      else
+      }
+      else {
+         BLAZE_KERNEL_TRACE( "TDMatDMatMultExpr::subAssign",
+                             ( UseBlasKernel_v<MT3,MT4,MT5> )?( "blas" ):( UseVectorizedDefaultKernel_v<MT3,MT4,MT5> )?( "large" ):( "default" ),
+                             A.rows(), B.columns(), A.columns() );
          selectBlasSubAssignKernel( C, A, B );
+      }
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -4980,7 +4999,7 @@ class TDMatDMatMultExpr
    static inline auto selectDefaultSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
       -> EnableIf_t< IsRowMajorMatrix_v<MT3> && !IsDiagonal_v<MT4> && IsDiagonal_v<MT5> >
    {
-      constexpr size_t block( BLOCK_SIZE );
+      const size_t block( BLOCK_SIZE );
 
       const size_t M( A.rows()    );
       const size_t N( B.columns() );
@@ -5124,7 +5143,7 @@ class TDMatDMatMultExpr
    static inline auto selectDefaultSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
       -> EnableIf_t< IsColumnMajorMatrix_v<MT3> && IsDiagonal_v<MT4> && !IsDiagonal_v<MT5> >
    {
-      constexpr size_t block( BLOCK_SIZE );
+      const size_t block( BLOCK_SIZE );
 
       const size_t M( A.rows()    );
       const size_t N( B.columns() );
@@ -7438,10 +7457,16 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, true >
       if( ( IsDiagonal_v<MT4> && IsDiagonal_v<MT5> ) ||
           ( !BLAZE_DEBUG_MODE && IsRowMajorMatrix_v<MT3> && B.columns() <= SIMDSIZE*10UL ) ||
           ( !BLAZE_DEBUG_MODE && IsColumnMajorMatrix_v<MT3> && A.rows() <= SIMDSIZE*10UL ) ||
-          ( C.rows() * C.columns() < TDMATDMATMULT_THRESHOLD ) )
+          ( C.rows() * C.columns() < TDMATDMATMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_TRACE( "DMatScalarMultExpr<TDMatDMatMultExpr>::assign", "small", A.rows(), B.columns(), A.columns() );
          selectSmallAssignKernel( C, A, B, scalar );
-      else
+      }
+      else {
+         BLAZE_KERNEL_TRACE( "DMatScalarMultExpr<TDMatDMatMultExpr>::assign",
+                             ( UseBlasKernel_v<MT3,MT4,MT5,ST2> )?( "blas" ):( UseVectorizedDefaultKernel_v<MT3,MT4,MT5,ST2> )?( "large" ):( "default" ),
+                             A.rows(), B.columns(), A.columns() );
          selectBlasAssignKernel( C, A, B, scalar );
+      }
    }
    //**********************************************************************************************
 
@@ -7722,7 +7747,7 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, true >
    static inline auto selectDefaultAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
       -> EnableIf_t< IsRowMajorMatrix_v<MT3> && !IsDiagonal_v<MT4> && IsDiagonal_v<MT5> >
    {
-      constexpr size_t block( BLOCK_SIZE );
+      const size_t block( BLOCK_SIZE );
 
       const size_t M( A.rows()    );
       const size_t N( B.columns() );
@@ -7882,7 +7907,7 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, true >
    static inline auto selectDefaultAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
       -> EnableIf_t< IsColumnMajorMatrix_v<MT3> && IsDiagonal_v<MT4> && !IsDiagonal_v<MT5> >
    {
-      constexpr size_t block( BLOCK_SIZE );
+      const size_t block( BLOCK_SIZE );
 
       const size_t M( A.rows()    );
       const size_t N( B.columns() );
@@ -9746,10 +9771,16 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, true >
       if( ( IsDiagonal_v<MT4> && IsDiagonal_v<MT5> ) ||
           ( !BLAZE_DEBUG_MODE && IsRowMajorMatrix_v<MT3> && B.columns() <= SIMDSIZE*10UL ) ||
           ( !BLAZE_DEBUG_MODE && IsColumnMajorMatrix_v<MT3> && A.rows() <= SIMDSIZE*10UL ) ||
-          ( C.rows() * C.columns() < TDMATDMATMULT_THRESHOLD ) )
+          ( C.rows() * C.columns() < TDMATDMATMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_TRACE( "DMatScalarMultExpr<TDMatDMatMultExpr>::addAssign", "small", A.rows(), B.columns(), A.columns() );
          selectSmallAddAssignKernel( C, A, B, scalar );
-      else
+      }
+      else {
+         BLAZE_KERNEL_TRACE( "DMatScalarMultExpr<TDMatDMatMultExpr>::addAssign",
+                             ( UseBlasKernel_v<MT3,MT4,MT5,ST2> )?( "blas" ):( UseVectorizedDefaultKernel_v<MT3,MT4,MT5,ST2> )?( "large" ):( "default" ),
+                             A.rows(), B.columns(), A.columns() );
          selectBlasAddAssignKernel( C, A, B, scalar );
+      }
    }
    //**********************************************************************************************
 
@@ -9800,7 +9831,7 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, true >
    static inline auto selectDefaultAddAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
       -> EnableIf_t< IsRowMajorMatrix_v<MT3> && !IsDiagonal_v<MT4> && IsDiagonal_v<MT5> >
    {
-      constexpr size_t block( BLOCK_SIZE );
+      const size_t block( BLOCK_SIZE );
 
       const size_t M( A.rows()    );
       const size_t N( B.columns() );
@@ -9944,7 +9975,7 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, true >
    static inline auto selectDefaultAddAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
       -> EnableIf_t< IsColumnMajorMatrix_v<MT3> && IsDiagonal_v<MT4> && !IsDiagonal_v<MT5> >
    {
-      constexpr size_t block( BLOCK_SIZE );
+      const size_t block( BLOCK_SIZE );
 
       const size_t M( A.rows()    );
       const size_t N( B.columns() );
@@ -11513,10 +11544,16 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, true >
       if( ( IsDiagonal_v<MT4> && IsDiagonal_v<MT5> ) ||
           ( !BLAZE_DEBUG_MODE && IsRowMajorMatrix_v<MT3> && B.columns() <= SIMDSIZE*10UL ) ||
           ( !BLAZE_DEBUG_MODE && IsColumnMajorMatrix_v<MT3> && A.rows() <= SIMDSIZE*10UL ) ||
-          ( C.rows() * C.columns() < TDMATDMATMULT_THRESHOLD ) )
+          ( C.rows() * C.columns() < TDMATDMATMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_TRACE( "DMatScalarMultExpr<TDMatDMatMultExpr>::subAssign", "small", A.rows(), B.columns(), A.columns() );
          selectSmallSubAssignKernel( C, A, B, scalar );
-      else
+      }
+      else {
+         BLAZE_KERNEL_TRACE( "DMatScalarMultExpr<TDMatDMatMultExpr>::subAssign",
+                             ( UseBlasKernel_v<MT3,MT4,MT5,ST2> )?( "blas" ):( UseVectorizedDefaultKernel_v<MT3,MT4,MT5,ST2> )?( "large" ):( "default" ),
+                             A.rows(), B.columns(), A.columns() );
          selectBlasSubAssignKernel( C, A, B, scalar );
+      }
    }
    //**********************************************************************************************
 
@@ -11567,7 +11604,7 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, true >
    static inline auto selectDefaultSubAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
       -> EnableIf_t< IsRowMajorMatrix_v<MT3> && !IsDiagonal_v<MT4> && IsDiagonal_v<MT5> >
    {
-      constexpr size_t block( BLOCK_SIZE );
+      const size_t block( BLOCK_SIZE );
 
       const size_t M( A.rows()    );
       const size_t N( B.columns() );
@@ -11711,7 +11748,7 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, true >
    static inline auto selectDefaultSubAssignKernel( MT3& C, const MT4& A, const MT5& B, ST2 scalar )
       -> EnableIf_t< IsColumnMajorMatrix_v<MT3> && IsDiagonal_v<MT4> && !IsDiagonal_v<MT5> >
    {
-      constexpr size_t block( BLOCK_SIZE );
+      const size_t block( BLOCK_SIZE );
 
       const size_t M( A.rows()    );
       const size_t N( B.columns() );
@@ -50,6 +50,7 @@
 #include <blaze/math/constraints/MatMatMultExpr.h>
 #include <blaze/math/constraints/MatVecMultExpr.h>
 #include <blaze/math/constraints/RequiresEvaluation.h>
+#include <blaze/math/dense/DispatchedKernels.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/Computation.h>
 #include <blaze/math/expressions/DenseVector.h>
@@ -81,6 +82,7 @@
 #include <blaze/math/views/Check.h>
 #include <blaze/system/BLAS.h>
 #include <blaze/system/Optimizations.h>
+#include <blaze/system/SMP.h>
 #include <blaze/system/Thresholds.h>
 #include <blaze/util/algorithms/Max.h>
 #include <blaze/util/algorithms/Min.h>
@@ -369,7 +371,8 @@ class TDMatDVecMultExpr
    // \return \a true in case the expression can be used in SMP assignments, \a false if not.
    */
    inline bool canSMPAssign() const noexcept {
-      return ( !BLAZE_BLAS_MODE ||
+      return ( BLAZE_REPRODUCIBLE_REDUCTION_MODE ||
+               !BLAZE_BLAS_MODE ||
                !BLAZE_USE_BLAS_MATRIX_VECTOR_MULTIPLICATION ||
                !BLAZE_BLAS_IS_PARALLEL ||
                ( IsComputation_v<MT> && !evaluateMatrix ) ||
@@ -441,7 +444,8 @@ class TDMatDVecMultExpr
            , typename VT2 >  // Type of the right-hand side vector operand
    static inline void selectAssignKernel( VT1& y, const MT1& A, const VT2& x )
    {
-      if( ( IsDiagonal_v<MT1> ) ||
+      if( ( BLAZE_REPRODUCIBLE_REDUCTION_MODE ) ||
+          ( IsDiagonal_v<MT1> ) ||
           ( IsComputation_v<MT> && !evaluateMatrix ) ||
           ( A.rows() * A.columns() < TDMATDVECMULT_THRESHOLD ) )
          selectSmallAssignKernel( y, A, x );
@@ -770,6 +774,9 @@ class TDMatDVecMultExpr
    static inline auto selectLargeAssignKernel( VT1& y, const MT1& A, const VT2& x )
       -> EnableIf_t< UseVectorizedDefaultKernel_v<VT1,MT1,VT2> >
    {
+      if( dispatchedGemv( y, A, x ) )
+         return;
+
       constexpr bool remainder( !IsPadded_v<MT1> || !IsPadded_v<VT1> );
 
       const size_t M( A.rows()    );
@@ -1042,7 +1049,8 @@ class TDMatDVecMultExpr
            , typename VT2 >  // Type of the right-hand side vector operand
    static inline void selectAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
    {
-      if( ( IsDiagonal_v<MT1> ) ||
+      if( ( BLAZE_REPRODUCIBLE_REDUCTION_MODE ) ||
+          ( IsDiagonal_v<MT1> ) ||
           ( IsComputation_v<MT> && !evaluateMatrix ) ||
           ( A.rows() * A.columns() < TDMATDVECMULT_THRESHOLD ) )
          selectSmallAddAssignKernel( y, A, x );
@@ -1611,7 +1619,8 @@ class TDMatDVecMultExpr
            , typename VT2 >  // Type of the right-hand side vector operand
    static inline void selectSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
    {
-      if( ( IsDiagonal_v<MT1> ) ||
+      if( ( BLAZE_REPRODUCIBLE_REDUCTION_MODE ) ||
+          ( IsDiagonal_v<MT1> ) ||
           ( IsComputation_v<MT> && !evaluateMatrix ) ||
           ( A.rows() * A.columns() < TDMATDVECMULT_THRESHOLD ) )
          selectSmallSubAssignKernel( y, A, x );
@@ -2697,7 +2706,8 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
    */
    inline bool canSMPAssign() const noexcept {
       LeftOperand_t<MVM> A( vector_.leftOperand() );
-      return ( !BLAZE_BLAS_MODE ||
+      return ( BLAZE_REPRODUCIBLE_REDUCTION_MODE ||
+               !BLAZE_BLAS_MODE ||
                !BLAZE_USE_BLAS_MATRIX_VECTOR_MULTIPLICATION ||
                !BLAZE_BLAS_IS_PARALLEL ||
                ( IsComputation_v<MT> && !evaluateMatrix ) ||
@@ -2771,7 +2781,8 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
            , typename ST2 >  // Type of the scalar value
    static inline void selectAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
    {
-      if( ( IsDiagonal_v<MT1> ) ||
+      if( ( BLAZE_REPRODUCIBLE_REDUCTION_MODE ) ||
+          ( IsDiagonal_v<MT1> ) ||
           ( IsComputation_v<MT> && !evaluateMatrix ) ||
           ( A.rows() * A.columns() < TDMATDVECMULT_THRESHOLD ) )
          selectSmallAssignKernel( y, A, x, scalar );
@@ -3384,7 +3395,8 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
            , typename ST2 >  // Type of the scalar value
    static inline void selectAddAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
    {
-      if( ( IsDiagonal_v<MT1> ) ||
+      if( ( BLAZE_REPRODUCIBLE_REDUCTION_MODE ) ||
+          ( IsDiagonal_v<MT1> ) ||
           ( IsComputation_v<MT> && !evaluateMatrix ) ||
           ( A.rows() * A.columns() < TDMATDVECMULT_THRESHOLD ) )
          selectSmallAddAssignKernel( y, A, x, scalar );
@@ -3917,7 +3929,8 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
            , typename ST2 >  // Type of the scalar value
    static inline void selectSubAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
    {
-      if( ( IsDiagonal_v<MT1> ) ||
+      if( ( BLAZE_REPRODUCIBLE_REDUCTION_MODE ) ||
+          ( IsDiagonal_v<MT1> ) ||
           ( IsComputation_v<MT> && !evaluateMatrix ) ||
           ( A.rows() * A.columns() < TDMATDVECMULT_THRESHOLD ) )
          selectSmallSubAssignKernel( y, A, x, scalar );
@@ -112,6 +112,7 @@
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
 #include <blaze/util/IntegralConstant.h>
+#include <blaze/util/KernelTrace.h>
 #include <blaze/util/mpl/If.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/IsBuiltin.h>
@@ -559,10 +560,16 @@ class TDMatTDMatMultExpr
    {
       if( ( IsDiagonal_v<MT4> ) ||
           ( !BLAZE_DEBUG_MODE && A.rows() <= SIMDSIZE*10UL ) ||
-          ( C.rows() * C.columns() < TDMATTDMATMULT_THRESHOLD ) )
+          ( C.rows() * C.columns() < TDMATTDMATMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_TRACE( "TDMatTDMatMultExpr::assign", "small", A.rows(), B.columns(), A.columns() );
          selectSmallAssignKernel( C, A, B );
-      else
+      }
+      else {
+         BLAZE_KERNEL_TRACE( "TDMatTDMatMultExpr::assign",
+                             ( UseBlasKernel_v<MT3,MT4,MT5> )?( "blas" ):( UseVectorizedDefaultKernel_v<MT3,MT4,MT5> )?( "large" ):( "default" ),
+                             A.rows(), B.columns(), A.columns() );
          selectBlasAssignKernel( C, A, B );
+      }
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -1924,10 +1931,16 @@ class TDMatTDMatMultExpr
    {
       if( ( IsDiagonal_v<MT4> ) ||
           ( !BLAZE_DEBUG_MODE && A.rows() <= SIMDSIZE*10UL ) ||
-          ( C.rows() * C.columns() < TDMATTDMATMULT_THRESHOLD ) )
+          ( C.rows() * C.columns() < TDMATTDMATMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_TRACE( "TDMatTDMatMultExpr::addAssign", "small", A.rows(), B.columns(), A.columns() );
          selectSmallAddAssignKernel( C, A, B );
-      else
+      }
+      else {
+         BLAZE_KERNEL_TRACE( "TDMatTDMatMultExpr::addAssign",
+                             ( UseBlasKernel_v<MT3,MT4,MT5> )?( "blas" ):( UseVectorizedDefaultKernel_v<MT3,MT4,MT5> )?( "large" ):( "default" ),
+                             A.rows(), B.columns(), A.columns() );
          selectBlasAddAssignKernel( C, A, B );
+      }
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -3140,10 +3153,16 @@ class TDMatTDMatMultExpr
    {
       if( ( IsDiagonal_v<MT4> ) ||
           ( !BLAZE_DEBUG_MODE && A.rows() <= SIMDSIZE*10UL ) ||
-          ( C.rows() * C.columns() < TDMATTDMATMULT_THRESHOLD ) )
+          ( C.rows() * C.columns() < TDMATTDMATMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_TRACE( "TDMatTDMatMultExpr::subAssign", "small", A.rows(), B.columns(), A.columns() );
          selectSmallSubAssignKernel( C, A, B );
-      else
+      }
+      else {
+         BLAZE_KERNEL_TRACE( "TDMatTDMatMultExpr::subAssign",
+                             ( UseBlasKernel_v<MT3,MT4,MT5> )?( "blas" ):( UseVectorizedDefaultKernel_v<MT3,MT4,MT5> )?( "large" ):( "default" ),
+                             A.rows(), B.columns(), A.columns() );
          selectBlasSubAssignKernel( C, A, B );
+      }
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -5100,10 +5119,16 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, true >
    {
       if( ( IsDiagonal_v<MT4> ) ||
           ( !BLAZE_DEBUG_MODE && A.rows() <= SIMDSIZE*10UL ) ||
-          ( C.rows() * C.columns() < TDMATTDMATMULT_THRESHOLD ) )
+          ( C.rows() * C.columns() < TDMATTDMATMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_TRACE( "DMatScalarMultExpr<TDMatTDMatMultExpr>::assign", "small", A.rows(), B.columns(), A.columns() );
          selectSmallAssignKernel( C, A, B, scalar );
-      else
+      }
+      else {
+         BLAZE_KERNEL_TRACE( "DMatScalarMultExpr<TDMatTDMatMultExpr>::assign",
+                             ( UseBlasKernel_v<MT3,MT4,MT5,ST2> )?( "blas" ):( UseVectorizedDefaultKernel_v<MT3,MT4,MT5,ST2> )?( "large" ):( "default" ),
+                             A.rows(), B.columns(), A.columns() );
          selectBlasAssignKernel( C, A, B, scalar );
+      }
    }
    //**********************************************************************************************
 
@@ -6483,10 +6508,16 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, true >
    {
       if( ( IsDiagonal_v<MT4> ) ||
           ( !BLAZE_DEBUG_MODE && A.rows() <= SIMDSIZE*10UL ) ||
-          ( C.rows() * C.columns() < TDMATTDMATMULT_THRESHOLD ) )
+          ( C.rows() * C.columns() < TDMATTDMATMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_TRACE( "DMatScalarMultExpr<TDMatTDMatMultExpr>::addAssign", "small", A.rows(), B.columns(), A.columns() );
          selectSmallAddAssignKernel( C, A, B, scalar );
-      else
+      }
+      else {
+         BLAZE_KERNEL_TRACE( "DMatScalarMultExpr<TDMatTDMatMultExpr>::addAssign",
+                             ( UseBlasKernel_v<MT3,MT4,MT5,ST2> )?( "blas" ):( UseVectorizedDefaultKernel_v<MT3,MT4,MT5,ST2> )?( "large" ):( "default" ),
+                             A.rows(), B.columns(), A.columns() );
          selectBlasAddAssignKernel( C, A, B, scalar );
+      }
    }
    //**********************************************************************************************
 
@@ -7598,10 +7629,16 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, true >
    {
       if( ( IsDiagonal_v<MT4> ) ||
           ( !BLAZE_DEBUG_MODE && A.rows() <= SIMDSIZE*10UL ) ||
-          ( C.rows() * C.columns() < TDMATTDMATMULT_THRESHOLD ) )
+          ( C.rows() * C.columns() < TDMATTDMATMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_TRACE( "DMatScalarMultExpr<TDMatTDMatMultExpr>::subAssign", "small", A.rows(), B.columns(), A.columns() );
          selectSmallSubAssignKernel( C, A, B, scalar );
-      else
+      }
+      else {
+         BLAZE_KERNEL_TRACE( "DMatScalarMultExpr<TDMatTDMatMultExpr>::subAssign",
+                             ( UseBlasKernel_v<MT3,MT4,MT5,ST2> )?( "blas" ):( UseVectorizedDefaultKernel_v<MT3,MT4,MT5,ST2> )?( "large" ):( "default" ),
+                             A.rows(), B.columns(), A.columns() );
          selectBlasSubAssignKernel( C, A, B, scalar );
+      }
    }
    //**********************************************************************************************
 
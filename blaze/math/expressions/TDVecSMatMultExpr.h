@@ -58,6 +58,7 @@
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/shims/Serial.h>
+#include <blaze/math/SIMD.h>
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/math/typetraits/IsAligned.h>
 #include <blaze/math/typetraits/IsComputation.h>
@@ -66,6 +67,7 @@
 #include <blaze/math/typetraits/IsIdentity.h>
 #include <blaze/math/typetraits/IsLower.h>
 #include <blaze/math/typetraits/IsResizable.h>
+#include <blaze/math/typetraits/IsSlicedEllpack.h>
 #include <blaze/math/typetraits/IsStrictlyLower.h>
 #include <blaze/math/typetraits/IsStrictlyUpper.h>
 #include <blaze/math/typetraits/IsSymmetric.h>
@@ -73,12 +75,16 @@
 #include <blaze/math/typetraits/IsZero.h>
 #include <blaze/math/typetraits/RequiresEvaluation.h>
 #include <blaze/math/views/Check.h>
+#include <blaze/system/Optimizations.h>
 #include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Min.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
 #include <blaze/util/MaybeUnused.h>
 #include <blaze/util/mpl/If.h>
+#include <blaze/util/typetraits/AlignmentOf.h>
+#include <blaze/util/typetraits/IsSame.h>
 #include <blaze/util/Types.h>
 
 
@@ -132,6 +138,22 @@ class TDVecSMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   /*! In case the matrix operand is a sliced ELLPACK matrix and all element types are identical
+       single or double precision floating point types, the variable will be set to 1 and the
+       vectorized sliced ELLPACK kernels will be used. Otherwise the variable will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   static constexpr bool UseVectorizedSlicedEllpackKernel_v =
+      ( useOptimizedKernels &&
+        IsSlicedEllpack_v<T3> &&
+        IsSame_v< ElementType_t<T2>, ElementType_t<T3> > &&
+        ( IsSame_v< ElementType_t<T3>, float > || IsSame_v< ElementType_t<T3>, double > ) &&
+        ( SIMDTrait< ElementType_t<T3> >::size > 1UL ) );
+   /*! \endcond */
+   //**********************************************************************************************
+
  public:
    //**Type definitions****************************************************************************
    using This          = TDVecSMatMultExpr<VT,MT>;     //!< Type of this TDVecSMatMultExpr instance.
@@ -355,7 +377,8 @@ class TDVecSMatMultExpr
    template< typename VT1    // Type of the left-hand side target vector
            , typename VT2    // Type of the left-hand side vector operand
            , typename MT1 >  // Type of the right-hand side matrix operand
-   static inline void selectAssignKernel( VT1& y, const VT2& x, const MT1& A )
+   static inline auto selectAssignKernel( VT1& y, const VT2& x, const MT1& A )
+      -> DisableIf_t< UseVectorizedSlicedEllpackKernel_v<VT1,VT2,MT1> >
    {
       for( size_t i=0UL; i<x.size(); ++i )
       {
@@ -374,6 +397,32 @@ class TDVecSMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Vectorized assignment to dense vectors (sliced ELLPACK)*************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Vectorized assignment of a transpose dense vector-sliced ELLPACK matrix
+   //        multiplication (\f$ \vec{y}^T=\vec{x}^T*A \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param x The left-hand side dense vector operand.
+   // \param A The right-hand side sliced ELLPACK matrix operand.
+   // \return void
+   //
+   // This function implements the vectorized assignment kernel for the transpose dense vector-
+   // sliced ELLPACK matrix multiplication. Since the target vector has already been reset, the
+   // assignment is performed by means of the addition assignment kernel.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename VT2    // Type of the left-hand side vector operand
+           , typename MT1 >  // Type of the right-hand side matrix operand
+   static inline auto selectAssignKernel( VT1& y, const VT2& x, const MT1& A )
+      -> EnableIf_t< UseVectorizedSlicedEllpackKernel_v<VT1,VT2,MT1> >
+   {
+      TDVecSMatMultExpr::selectAddAssignKernel( y, x, A );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Assignment to sparse vectors****************************************************************
    /*!\brief Assignment of a transpose dense vector-sparse matrix multiplication to a sparse
    //        vector (\f$ \vec{y}^T=\vec{x}^T*A \f$).
@@ -454,7 +503,8 @@ class TDVecSMatMultExpr
    template< typename VT1    // Type of the left-hand side target vector
            , typename VT2    // Type of the left-hand side vector operand
            , typename MT1 >  // Type of the right-hand side matrix operand
-   static inline void selectAddAssignKernel( VT1& y, const VT2& x, const MT1& A )
+   static inline auto selectAddAssignKernel( VT1& y, const VT2& x, const MT1& A )
+      -> DisableIf_t< UseVectorizedSlicedEllpackKernel_v<VT1,VT2,MT1> >
    {
       for( size_t i=0UL; i<x.size(); ++i )
       {
@@ -469,6 +519,74 @@ class TDVecSMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Vectorized addition assignment to dense vectors (sliced ELLPACK)****************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Vectorized addition assignment of a transpose dense vector-sliced ELLPACK matrix
+   //        multiplication (\f$ \vec{y}^T+=\vec{x}^T*A \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param x The left-hand side dense vector operand.
+   // \param A The right-hand side sliced ELLPACK matrix operand.
+   // \return void
+   //
+   // This function implements the vectorized addition assignment kernel for the transpose dense
+   // vector-sliced ELLPACK matrix multiplication. The elements of \a x corresponding to the rows
+   // of a slice are packed into a single SIMD vector, which is multiplied with the elements of
+   // the slice column by column. The resulting products are scattered to the target vector,
+   // skipping the padding elements of the shorter rows.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename VT2    // Type of the left-hand side vector operand
+           , typename MT1 >  // Type of the right-hand side matrix operand
+   static inline auto selectAddAssignKernel( VT1& y, const VT2& x, const MT1& A )
+      -> EnableIf_t< UseVectorizedSlicedEllpackKernel_v<VT1,VT2,MT1> >
+   {
+      using ET = ElementType_t<MT1>;
+
+      constexpr size_t SIMDSIZE( SIMDTrait<ET>::size );
+
+      using IT = typename MT1::IndexType;
+
+      const ET* values ( A.values()  );
+      const IT* indices( A.indices() );
+
+      alignas( AlignmentOf_v<ET> ) ET tmp[SIMDSIZE];
+
+      for( size_t s=0UL; s<A.slices(); ++s )
+      {
+         size_t kmin( A.rowLength( s, 0UL ) );
+
+         for( size_t r=0UL; r<SIMDSIZE; ++r ) {
+            const size_t i( A.rowIndex( s, r ) );
+            tmp[r] = ( i < A.rows() ? ET( x[i] ) : ET() );
+            kmin = min( kmin, A.rowLength( s, r ) );
+         }
+
+         const SIMDTrait_t<ET> xmm( loada( tmp ) );
+         const size_t kmax( A.sliceWidth( s ) );
+         size_t pos( A.sliceOffset( s ) );
+         size_t k( 0UL );
+
+         for( ; k<kmin; ++k, pos+=SIMDSIZE ) {
+            const SIMDTrait_t<ET> ymm( loada( values+pos ) * xmm );
+            for( size_t r=0UL; r<SIMDSIZE; ++r ) {
+               y[indices[pos+r]] += ymm[r];
+            }
+         }
+
+         for( ; k<kmax; ++k, pos+=SIMDSIZE ) {
+            const SIMDTrait_t<ET> ymm( loada( values+pos ) * xmm );
+            for( size_t r=0UL; r<SIMDSIZE; ++r ) {
+               if( k < A.rowLength( s, r ) )
+                  y[indices[pos+r]] += ymm[r];
+            }
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Addition assignment to sparse vectors*******************************************************
    // No special implementation for the addition assignment to sparse vectors.
    //**********************************************************************************************
@@ -525,7 +643,8 @@ class TDVecSMatMultExpr
    template< typename VT1    // Type of the left-hand side target vector
            , typename VT2    // Type of the left-hand side vector operand
            , typename MT1 >  // Type of the right-hand side matrix operand
-   static inline void selectSubAssignKernel( VT1& y, const VT2& x, const MT1& A )
+   static inline auto selectSubAssignKernel( VT1& y, const VT2& x, const MT1& A )
+      -> DisableIf_t< UseVectorizedSlicedEllpackKernel_v<VT1,VT2,MT1> >
    {
       for( size_t i=0UL; i<x.size(); ++i )
       {
@@ -540,6 +659,74 @@ class TDVecSMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Vectorized subtraction assignment to dense vectors (sliced ELLPACK)*************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Vectorized subtraction assignment of a transpose dense vector-sliced ELLPACK matrix
+   //        multiplication (\f$ \vec{y}^T-=\vec{x}^T*A \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param x The left-hand side dense vector operand.
+   // \param A The right-hand side sliced ELLPACK matrix operand.
+   // \return void
+   //
+   // This function implements the vectorized subtraction assignment kernel for the transpose dense
+   // vector-sliced ELLPACK matrix multiplication. The elements of \a x corresponding to the rows
+   // of a slice are packed into a single SIMD vector, which is multiplied with the elements of
+   // the slice column by column. The resulting products are scattered to the target vector,
+   // skipping the padding elements of the shorter rows.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename VT2    // Type of the left-hand side vector operand
+           , typename MT1 >  // Type of the right-hand side matrix operand
+   static inline auto selectSubAssignKernel( VT1& y, const VT2& x, const MT1& A )
+      -> EnableIf_t< UseVectorizedSlicedEllpackKernel_v<VT1,VT2,MT1> >
+   {
+      using ET = ElementType_t<MT1>;
+
+      constexpr size_t SIMDSIZE( SIMDTrait<ET>::size );
+
+      using IT = typename MT1::IndexType;
+
+      const ET* values ( A.values()  );
+      const IT* indices( A.indices() );
+
+      alignas( AlignmentOf_v<ET> ) ET tmp[SIMDSIZE];
+
+      for( size_t s=0UL; s<A.slices(); ++s )
+      {
+         size_t kmin( A.rowLength( s, 0UL ) );
+
+         for( size_t r=0UL; r<SIMDSIZE; ++r ) {
+            const size_t i( A.rowIndex( s, r ) );
+            tmp[r] = ( i < A.rows() ? ET( x[i] ) : ET() );
+            kmin = min( kmin, A.rowLength( s, r ) );
+         }
+
+         const SIMDTrait_t<ET> xmm( loada( tmp ) );
+         const size_t kmax( A.sliceWidth( s ) );
+         size_t pos( A.sliceOffset( s ) );
+         size_t k( 0UL );
+
+         for( ; k<kmin; ++k, pos+=SIMDSIZE ) {
+            const SIMDTrait_t<ET> ymm( loada( values+pos ) * xmm );
+            for( size_t r=0UL; r<SIMDSIZE; ++r ) {
+               y[indices[pos+r]] -= ymm[r];
+            }
+         }
+
+         for( ; k<kmax; ++k, pos+=SIMDSIZE ) {
+            const SIMDTrait_t<ET> ymm( loada( values+pos ) * xmm );
+            for( size_t r=0UL; r<SIMDSIZE; ++r ) {
+               if( k < A.rowLength( s, r ) )
+                  y[indices[pos+r]] -= ymm[r];
+            }
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Subtraction assignment to sparse vectors****************************************************
    // No special implementation for the subtraction assignment to sparse vectors.
    //**********************************************************************************************
@@ -0,0 +1,649 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/serialization/BinarySerialization.h
+//  \brief Header file for the zero-copy binary serialization of vectors and matrices
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SERIALIZATION_BINARYSERIALIZATION_H_
+#define _BLAZE_MATH_SERIALIZATION_BINARYSERIALIZATION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstring>
+#include <new>
+#include <string>
+#include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/CustomMatrix.h>
+#include <blaze/math/dense/CustomVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/PaddingFlag.h>
+#include <blaze/math/serialization/TypeValueMapping.h>
+#include <blaze/math/shims/NextMultiple.h>
+#include <blaze/math/sparse/CompressedMatrixView.h>
+#include <blaze/math/sparse/ValueIndexPair.h>
+#include <blaze/system/StorageOrder.h>
+#include <blaze/system/TransposeFlag.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/MemoryMap.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/RemoveCV.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  BINARY FILE FORMAT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The layout of the header of a binary vector or matrix file.
+// \ingroup math_serialization
+//
+// A binary file starts with this header, padded to \a BINARY_HEADER_SIZE bytes, followed by the
+// data of the vector or matrix in exactly the layout of the according in-memory data structure:
+//
+//  - Dense vectors: the \a rows elements of the vector.
+//  - Dense matrices: \a rows (row-major) or \a columns (column-major) rows/columns of
+//    \a spacing elements each. The spacing is a multiple of \a BINARY_ALIGNMENT bytes
+//    (if possible), which guarantees that each row/column is suitably aligned for SIMD
+//    operations.
+//  - Sparse matrices: \a rows+1 (row-major) or \a columns+1 (column-major) 64-bit offsets
+//    of the first element of each row/column, followed by the \a nonZeros value-index-pairs
+//    (see ValueIndexPair) of all rows/columns, starting at the next multiple of
+//    \a BINARY_ALIGNMENT bytes.
+//
+// All values are stored in the native byte order of the writing machine. The \a endian field
+// is used to reject files that have been written on a machine with a different byte order.
+*/
+struct BinaryHeader
+{
+   char     magic[8];   //!< The identification of the file format.
+   uint64_t version;    //!< The version of the file format.
+   uint64_t endian;     //!< Byte order marker (BINARY_ENDIAN_MARKER).
+   uint64_t kind;       //!< The kind of the stored data (1: dense vector, 2: dense matrix, 3: sparse matrix).
+   uint64_t type;       //!< The type ID of the element type (see TypeValueMapping).
+   uint64_t size;       //!< The size of the element type in bytes.
+   uint64_t indexSize;  //!< The size of the index type in bytes (sparse matrices only).
+   uint64_t order;      //!< The storage order or transpose flag.
+   uint64_t rows;       //!< The number of rows of the matrix or the size of the vector.
+   uint64_t columns;    //!< The number of columns of the matrix (1 for vectors).
+   uint64_t spacing;    //!< The number of elements between two rows/columns (dense matrices only).
+   uint64_t nonZeros;   //!< The number of non-zero elements (sparse matrices only).
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+//! The size of the header of a binary file in bytes.
+constexpr size_t BINARY_HEADER_SIZE = 128UL;
+
+//! The alignment of the rows/columns of dense matrices and of the elements of sparse matrices.
+constexpr size_t BINARY_ALIGNMENT = 64UL;
+
+//! The byte order marker of a binary file.
+constexpr uint64_t BINARY_ENDIAN_MARKER = 0x0102030405060708UL;
+
+BLAZE_STATIC_ASSERT( sizeof( BinaryHeader ) <= BINARY_HEADER_SIZE );
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  AUXILIARY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the spacing between two rows/columns of a dense matrix in a binary file.
+// \ingroup math_serialization
+//
+// \param n The number of elements per row/column.
+// \return The number of elements between the beginning of two rows/columns.
+*/
+template< typename Type >  // Data type of the elements
+constexpr size_t binarySpacing( size_t n ) noexcept
+{
+   return ( BINARY_ALIGNMENT % sizeof( Type ) == 0UL )
+          ?( nextMultiple( n, BINARY_ALIGNMENT / sizeof( Type ) ) )
+          :( n );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the offset of the element array of a sparse matrix in a binary file.
+// \ingroup math_serialization
+//
+// \param n The number of rows (row-major) or columns (column-major) of the sparse matrix.
+// \return The offset of the element array in bytes.
+*/
+inline size_t binaryElementOffset( size_t n ) noexcept
+{
+   return nextMultiple( BINARY_HEADER_SIZE + ( n+1UL )*sizeof( uint64_t ), BINARY_ALIGNMENT );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creates the header of a binary file for the given element type.
+// \ingroup math_serialization
+//
+// \param kind The kind of the stored data.
+// \param order The storage order or transpose flag.
+// \param m The number of rows of the matrix or the size of the vector.
+// \param n The number of columns of the matrix.
+// \return The initialized header.
+*/
+template< typename Type >  // Data type of the elements
+BinaryHeader binaryHeader( uint64_t kind, bool order, size_t m, size_t n ) noexcept
+{
+   BinaryHeader header{};
+
+   std::memcpy( header.magic, "BLAZEBIN", 8UL );
+   header.version   = 1U;
+   header.endian    = BINARY_ENDIAN_MARKER;
+   header.kind      = kind;
+   header.type      = TypeValueMapping<Type>::value;
+   header.size      = sizeof( Type );
+   header.indexSize = 0U;
+   header.order     = order;
+   header.rows      = m;
+   header.columns   = n;
+   header.spacing   = 0U;
+   header.nonZeros  = 0U;
+
+   return header;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reads and validates the header of a mapped binary file.
+// \ingroup math_serialization
+//
+// \param map The memory map of the binary file.
+// \param kind The expected kind of the stored data.
+// \param order The expected storage order or transpose flag.
+// \return The header of the binary file.
+// \exception std::runtime_error Invalid binary file.
+// \exception std::runtime_error Incompatible byte order.
+// \exception std::runtime_error Incompatible element type.
+// \exception std::runtime_error Incompatible storage order.
+*/
+template< typename Type >  // Data type of the elements
+BinaryHeader readBinaryHeader( const MemoryMap& map, uint64_t kind, bool order )
+{
+   BinaryHeader header;
+
+   if( map.size() < BINARY_HEADER_SIZE ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid binary file" );
+   }
+
+   std::memcpy( &header, map.data(), sizeof( BinaryHeader ) );
+
+   if( std::memcmp( header.magic, "BLAZEBIN", 8UL ) != 0 || header.version != 1U ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid binary file" );
+   }
+
+   if( header.endian != BINARY_ENDIAN_MARKER ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Incompatible byte order" );
+   }
+
+   if( header.kind != kind ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid binary file" );
+   }
+
+   if( header.type != uint64_t( TypeValueMapping<Type>::value ) ||
+       header.size != uint64_t( sizeof( Type ) ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Incompatible element type" );
+   }
+
+   if( header.order != uint64_t( order ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Incompatible storage order" );
+   }
+
+   return header;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BINARY SERIALIZATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Binary serialization functions */
+//@{
+template< typename VT, bool TF >
+void writeBinary( const std::string& file, const DenseVector<VT,TF>& vec );
+
+template< typename MT, bool SO >
+void writeBinary( const std::string& file, const DenseMatrix<MT,SO>& mat );
+
+template< typename MT, bool SO >
+void writeBinary( const std::string& file, const SparseMatrix<MT,SO>& mat );
+
+template< typename Type, bool TF = defaultTransposeFlag >
+CustomVector<Type,aligned,unpadded,TF> mapDenseVector( const std::string& file, MemoryMap& map );
+
+template< typename Type, bool SO = defaultStorageOrder >
+CustomMatrix<Type,aligned,unpadded,SO> mapDenseMatrix( const std::string& file, MemoryMap& map );
+
+template< typename Type, bool SO = defaultStorageOrder, typename IT = size_t >
+CompressedMatrixView<Type,SO,IT> mapSparseMatrix( const std::string& file, MemoryMap& map );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes the given dense vector into a binary file.
+// \ingroup math_serialization
+//
+// \param file The name of the binary file.
+// \param vec The dense vector to be written.
+// \return void
+// \exception std::runtime_error File could not be opened.
+// \exception std::runtime_error File could not be resized.
+// \exception std::runtime_error File could not be mapped.
+// \exception std::runtime_error File could not be written.
+//
+// This function writes the given dense vector into the given file (an existing file is
+// overwritten) such that it can be mapped back into memory without copy by the mapDenseVector()
+// function. In contrast to the portable Archive serialization, the binary file stores the
+// elements in the native representation of the writing machine.
+
+   \code
+   blaze::DynamicVector<double> x( 1000000UL );
+   // ... Initialization
+
+   blaze::writeBinary( "x.bin", x );
+   \endcode
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+void writeBinary( const std::string& file, const DenseVector<VT,TF>& vec )
+{
+   using Type = RemoveCV_t< ElementType_t<VT> >;
+
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( Type );
+
+   const size_t n( (~vec).size() );
+
+   MemoryMap map( file, BINARY_HEADER_SIZE + n*sizeof(Type) );
+
+   const BinaryHeader header( binaryHeader<Type>( 1U, TF, n, 1UL ) );
+   std::memcpy( map.data(), &header, sizeof( BinaryHeader ) );
+
+   CustomVector<Type,aligned,unpadded,TF> v(
+      reinterpret_cast<Type*>( map.data() + BINARY_HEADER_SIZE ), n );
+   v = ~vec;
+
+   map.flush();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes the given dense matrix into a binary file.
+// \ingroup math_serialization
+//
+// \param file The name of the binary file.
+// \param mat The dense matrix to be written.
+// \return void
+// \exception std::runtime_error File could not be opened.
+// \exception std::runtime_error File could not be resized.
+// \exception std::runtime_error File could not be mapped.
+// \exception std::runtime_error File could not be written.
+//
+// This function writes the given dense matrix into the given file (an existing file is
+// overwritten) such that it can be mapped back into memory without copy by the mapDenseMatrix()
+// function. The matrix is stored in its own storage order, each row (row-major) or column
+// (column-major) padded to a multiple of 64 bytes.
+
+   \code
+   blaze::DynamicMatrix<double,blaze::rowMajor> A( 1000UL, 1000UL );
+   // ... Initialization
+
+   blaze::writeBinary( "A.bin", A );
+   \endcode
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+void writeBinary( const std::string& file, const DenseMatrix<MT,SO>& mat )
+{
+   using Type = RemoveCV_t< ElementType_t<MT> >;
+
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( Type );
+
+   const size_t m( (~mat).rows() );
+   const size_t n( (~mat).columns() );
+   const size_t spacing( binarySpacing<Type>( SO ? m : n ) );
+
+   MemoryMap map( file, BINARY_HEADER_SIZE + ( SO ? n : m )*spacing*sizeof(Type) );
+
+   BinaryHeader header( binaryHeader<Type>( 2U, SO, m, n ) );
+   header.spacing = spacing;
+   std::memcpy( map.data(), &header, sizeof( BinaryHeader ) );
+
+   CustomMatrix<Type,aligned,unpadded,SO> A(
+      reinterpret_cast<Type*>( map.data() + BINARY_HEADER_SIZE ), m, n, spacing );
+   A = ~mat;
+
+   map.flush();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes the given sparse matrix into a binary file.
+// \ingroup math_serialization
+//
+// \param file The name of the binary file.
+// \param mat The sparse matrix to be written.
+// \return void
+// \exception std::runtime_error File could not be opened.
+// \exception std::runtime_error File could not be resized.
+// \exception std::runtime_error File could not be mapped.
+// \exception std::runtime_error File could not be written.
+//
+// This function writes the given sparse matrix into the given file (an existing file is
+// overwritten) such that it can be mapped back into memory without copy by the mapSparseMatrix()
+// function. The matrix is stored in its own storage order in compressed row (row-major) or
+// compressed column (column-major) format, using \a size_t indices.
+
+   \code
+   blaze::CompressedMatrix<double,blaze::rowMajor> S( 100000UL, 100000UL );
+   // ... Initialization
+
+   blaze::writeBinary( "S.bin", S );
+   \endcode
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order
+void writeBinary( const std::string& file, const SparseMatrix<MT,SO>& mat )
+{
+   using Type    = RemoveCV_t< ElementType_t<MT> >;
+   using Element = ValueIndexPair<Type,size_t>;
+
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( Type );
+
+   CompositeType_t<MT> A( ~mat );  // Evaluation of the sparse matrix operand
+
+   const size_t m( A.rows() );
+   const size_t n( A.columns() );
+   const size_t N( SO ? n : m );
+
+   size_t nonzeros( 0UL );
+   for( size_t i=0UL; i<N; ++i ) {
+      for( auto element=A.begin(i); element!=A.end(i); ++element ) {
+         ++nonzeros;
+      }
+   }
+
+   const size_t offset( binaryElementOffset( N ) );
+
+   MemoryMap map( file, offset + nonzeros*sizeof(Element) );
+
+   BinaryHeader header( binaryHeader<Type>( 3U, SO, m, n ) );
+   header.indexSize = sizeof( size_t );
+   header.nonZeros  = nonzeros;
+   std::memcpy( map.data(), &header, sizeof( BinaryHeader ) );
+
+   uint64_t* offsets( reinterpret_cast<uint64_t*>( map.data() + BINARY_HEADER_SIZE ) );
+   Element*  elements( reinterpret_cast<Element*>( map.data() + offset ) );
+
+   size_t k( 0UL );
+   for( size_t i=0UL; i<N; ++i ) {
+      offsets[i] = k;
+      for( auto element=A.begin(i); element!=A.end(i); ++element, ++k ) {
+         ::new ( elements+k ) Element( element->value(), element->index() );
+      }
+   }
+   offsets[N] = k;
+
+   map.flush();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Maps a dense vector from a binary file into memory.
+// \ingroup math_serialization
+//
+// \param file The name of the binary file.
+// \param map The memory map holding the mapped file.
+// \return A custom vector representing the mapped dense vector.
+// \exception std::runtime_error File could not be opened.
+// \exception std::runtime_error File could not be mapped.
+// \exception std::runtime_error Invalid binary file.
+// \exception std::runtime_error Incompatible byte order.
+// \exception std::runtime_error Incompatible element type.
+// \exception std::runtime_error Incompatible storage order.
+//
+// This function maps the dense vector stored in the given binary file (see writeBinary())
+// into memory and returns a custom vector referring to the mapped elements. No element is
+// copied or read during the call; the elements are loaded from the file on first access. The
+// file is mapped copy-on-write: The returned vector can be modified, but all modifications
+// only affect the memory of the process and are never written back into the file. The given
+// memory map takes responsibility for the mapped file, which must outlive the returned vector.
+
+   \code
+   blaze::MemoryMap map;
+   blaze::CustomVector<double,blaze::aligned,blaze::unpadded> x(
+      blaze::mapDenseVector<double>( "x.bin", map ) );
+   \endcode
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+CustomVector<Type,aligned,unpadded,TF> mapDenseVector( const std::string& file, MemoryMap& map )
+{
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST   ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE( Type );
+
+   MemoryMap tmp( file, true, false );
+
+   const BinaryHeader header( readBinaryHeader<Type>( tmp, 1U, TF ) );
+
+   if( tmp.size() != BINARY_HEADER_SIZE + header.rows*sizeof(Type) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid binary file" );
+   }
+
+   map = std::move( tmp );
+
+   return CustomVector<Type,aligned,unpadded,TF>(
+      reinterpret_cast<Type*>( map.data() + BINARY_HEADER_SIZE ), header.rows );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Maps a dense matrix from a binary file into memory.
+// \ingroup math_serialization
+//
+// \param file The name of the binary file.
+// \param map The memory map holding the mapped file.
+// \return A custom matrix representing the mapped dense matrix.
+// \exception std::runtime_error File could not be opened.
+// \exception std::runtime_error File could not be mapped.
+// \exception std::runtime_error Invalid binary file.
+// \exception std::runtime_error Incompatible byte order.
+// \exception std::runtime_error Incompatible element type.
+// \exception std::runtime_error Incompatible storage order.
+// \exception std::invalid_argument Invalid alignment detected.
+//
+// This function maps the dense matrix stored in the given binary file (see writeBinary())
+// into memory and returns a custom matrix referring to the mapped elements. No element is
+// copied or read during the call; the elements are loaded from the file on first access. The
+// file is mapped copy-on-write: The returned matrix can be modified, but all modifications
+// only affect the memory of the process and are never written back into the file. The given
+// memory map takes responsibility for the mapped file, which must outlive the returned matrix.
+
+   \code
+   blaze::MemoryMap map;
+   blaze::CustomMatrix<double,blaze::aligned,blaze::unpadded,blaze::rowMajor> A(
+      blaze::mapDenseMatrix<double,blaze::rowMajor>( "A.bin", map ) );
+   \endcode
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+CustomMatrix<Type,aligned,unpadded,SO> mapDenseMatrix( const std::string& file, MemoryMap& map )
+{
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST   ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE( Type );
+
+   MemoryMap tmp( file, true, false );
+
+   const BinaryHeader header( readBinaryHeader<Type>( tmp, 2U, SO ) );
+
+   if( header.spacing < ( SO ? header.rows : header.columns ) ||
+       tmp.size() != BINARY_HEADER_SIZE + ( SO ? header.columns : header.rows )*header.spacing*sizeof(Type) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid binary file" );
+   }
+
+   CustomMatrix<Type,aligned,unpadded,SO> A(
+      reinterpret_cast<Type*>( tmp.data() + BINARY_HEADER_SIZE ),
+      header.rows, header.columns, header.spacing );
+
+   map = std::move( tmp );
+
+   return A;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Maps a sparse matrix from a binary file into memory.
+// \ingroup math_serialization
+//
+// \param file The name of the binary file.
+// \param map The memory map holding the mapped file.
+// \return A read-only view on the mapped sparse matrix.
+// \exception std::runtime_error File could not be opened.
+// \exception std::runtime_error File could not be mapped.
+// \exception std::runtime_error Invalid binary file.
+// \exception std::runtime_error Incompatible byte order.
+// \exception std::runtime_error Incompatible element type.
+// \exception std::runtime_error Incompatible storage order.
+//
+// This function maps the sparse matrix stored in the given binary file (see writeBinary())
+// into memory and returns a read-only CompressedMatrixView on the mapped elements. No element
+// is copied during the call and only the row/column offsets are validated. The given memory
+// map takes responsibility for the mapped file, which must outlive the returned view.
+
+   \code
+   blaze::MemoryMap map;
+   const blaze::CompressedMatrixView<double,blaze::rowMajor> S(
+      blaze::mapSparseMatrix<double,blaze::rowMajor>( "S.bin", map ) );
+
+   blaze::DynamicVector<double> y( S * x );
+   \endcode
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+CompressedMatrixView<Type,SO,IT> mapSparseMatrix( const std::string& file, MemoryMap& map )
+{
+   using Element = ValueIndexPair<Type,IT>;
+
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST   ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE( Type );
+
+   MemoryMap tmp( file, false );
+
+   const BinaryHeader header( readBinaryHeader<Type>( tmp, 3U, SO ) );
+
+   if( header.indexSize != sizeof( IT ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Incompatible index type" );
+   }
+
+   const size_t N( SO ? header.columns : header.rows );
+   const size_t offset( binaryElementOffset( N ) );
+
+   if( tmp.size() != offset + header.nonZeros*sizeof(Element) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid binary file" );
+   }
+
+   const uint64_t* offsets( reinterpret_cast<const uint64_t*>( tmp.data() + BINARY_HEADER_SIZE ) );
+
+   if( offsets[0] != 0U || offsets[N] != header.nonZeros ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid binary file" );
+   }
+
+   for( size_t i=0UL; i<N; ++i ) {
+      if( offsets[i] > offsets[i+1UL] ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Invalid binary file" );
+      }
+   }
+
+   map = std::move( tmp );
+
+   return CompressedMatrixView<Type,SO,IT>(
+      reinterpret_cast<const Element*>( map.data() + offset ),
+      offsets, header.rows, header.columns );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,745 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/serialization/CompressedStream.h
+//  \brief Header file for the compressed input and output streams
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SERIALIZATION_COMPRESSEDSTREAM_H_
+#define _BLAZE_MATH_SERIALIZATION_COMPRESSEDSTREAM_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstring>
+#include <fstream>
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <streambuf>
+#include <string>
+#include <blaze/math/smp/Reduction.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Compression.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  COMPRESSED STREAM FORMAT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The layout of the header of a compressed stream.
+// \ingroup math_serialization
+//
+// A compressed stream starts with this header, followed by a sequence of chunks. Each chunk
+// starts with two 32-bit values specifying the uncompressed and the stored size of the chunk.
+// In case both sizes are equal, the chunk is stored uncompressed. The stream is terminated by
+// a chunk of size 0.
+*/
+struct CompressedStreamHeader
+{
+   char     magic[8];   //!< The identification of the stream format.
+   uint32_t version;    //!< The version of the stream format.
+   uint32_t typeSize;   //!< The element size for the byte shuffle filter (0 if unfiltered).
+   uint32_t chunkSize;  //!< The maximum uncompressed size of a chunk.
+   uint32_t reserved;   //!< Reserved for future use.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+//! The maximum uncompressed size of a single chunk of a compressed stream.
+constexpr size_t COMPRESSION_CHUNK_SIZE = 262144UL;
+
+//! The number of chunks of a compressed stream that are (de-)compressed in parallel.
+constexpr size_t COMPRESSION_BATCH_SIZE = 16UL;
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS COMPRESSEDOSTREAMBUFFER
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Stream buffer for the compression of an output stream.
+// \ingroup math_serialization
+//
+// The CompressedOStreamBuffer collects the written data in a batch of chunks. As soon as the
+// batch is full, all chunks are filtered and compressed in parallel (if shared memory
+// parallelization is active) and written to the underlying output stream.
+*/
+class CompressedOStreamBuffer
+   : public std::streambuf
+   , private NonCopyable
+{
+ public:
+   //**Constructor*********************************************************************************
+   explicit inline CompressedOStreamBuffer( std::ostream& sink, size_t typeSize );
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   inline bool finish();
+   //**********************************************************************************************
+
+ protected:
+   //**Stream buffer functions*********************************************************************
+   virtual inline int_type overflow( int_type c );
+   virtual inline int      sync();
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   inline bool   compress();
+   inline size_t compressChunk( size_t k, size_t size ) noexcept;
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   std::ostream&             sink_;      //!< The underlying output stream.
+   size_t                    typeSize_;  //!< The element size for the byte shuffle filter.
+   bool                      finished_;  //!< Flag for a terminated stream.
+   std::unique_ptr<char[]>   input_;     //!< The uncompressed data of the current batch.
+   std::unique_ptr<char[]>   scratch_;   //!< The filtered data of the current batch.
+   std::unique_ptr<char[]>   output_;    //!< The compressed data of the current batch.
+   std::unique_ptr<size_t[]> sizes_;     //!< The stored sizes of the chunks of the current batch.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creating a compression buffer for the given output stream.
+//
+// \param sink The underlying output stream.
+// \param typeSize The element size for the byte shuffle filter (0 to disable the filters).
+*/
+inline CompressedOStreamBuffer::CompressedOStreamBuffer( std::ostream& sink, size_t typeSize )
+   : sink_    ( sink )                                                         // The underlying output stream
+   , typeSize_( typeSize )                                                     // The element size for the byte shuffle filter
+   , finished_( false )                                                        // Flag for a terminated stream
+   , input_   ( new char[COMPRESSION_BATCH_SIZE*COMPRESSION_CHUNK_SIZE] )    // The uncompressed data of the current batch
+   , scratch_ ( new char[COMPRESSION_BATCH_SIZE*COMPRESSION_CHUNK_SIZE] )    // The filtered data of the current batch
+   , output_  ( new char[COMPRESSION_BATCH_SIZE*COMPRESSION_CHUNK_SIZE] )    // The compressed data of the current batch
+   , sizes_   ( new size_t[COMPRESSION_BATCH_SIZE] )                           // The stored sizes of the chunks
+{
+   CompressedStreamHeader header{};
+   std::memcpy( header.magic, "BLAZECZ", 8UL );
+   header.version   = 1U;
+   header.typeSize  = static_cast<uint32_t>( typeSize );
+   header.chunkSize = static_cast<uint32_t>( COMPRESSION_CHUNK_SIZE );
+
+   sink_.write( reinterpret_cast<const char*>( &header ), sizeof( CompressedStreamHeader ) );
+
+   setp( input_.get(), input_.get() + COMPRESSION_BATCH_SIZE*COMPRESSION_CHUNK_SIZE );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compresses all pending data and terminates the compressed stream.
+//
+// \return \a true in case the stream was successfully terminated, \a false if not.
+//
+// After this call no further data can be written to the stream.
+*/
+inline bool CompressedOStreamBuffer::finish()
+{
+   if( finished_ ) return static_cast<bool>( sink_ );
+
+   finished_ = true;
+
+   const bool success( compress() );
+
+   const uint32_t end[2] = { 0U, 0U };
+   sink_.write( reinterpret_cast<const char*>( end ), sizeof( end ) );
+   sink_.flush();
+
+   setp( nullptr, nullptr );
+
+   return success && sink_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compresses the current batch in case it is full.
+//
+// \param c The character that did not fit into the batch.
+// \return The given character in case of success, \a traits_type::eof() otherwise.
+*/
+inline CompressedOStreamBuffer::int_type CompressedOStreamBuffer::overflow( int_type c )
+{
+   if( finished_ || !compress() ) {
+      return traits_type::eof();
+   }
+
+   if( !traits_type::eq_int_type( c, traits_type::eof() ) ) {
+      *pptr() = traits_type::to_char_type( c );
+      pbump( 1 );
+   }
+
+   return traits_type::not_eof( c );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compresses all pending data and flushes the underlying output stream.
+//
+// \return 0 in case of success, -1 otherwise.
+*/
+inline int CompressedOStreamBuffer::sync()
+{
+   if( finished_ ) return 0;
+
+   const bool success( compress() );
+   sink_.flush();
+
+   return ( success && sink_ )?( 0 ):( -1 );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compresses and writes all data of the current batch.
+//
+// \return \a true in case the data was successfully written, \a false if not.
+*/
+inline bool CompressedOStreamBuffer::compress()
+{
+   const size_t size( static_cast<size_t>( pptr() - pbase() ) );
+
+   if( size == 0UL ) return static_cast<bool>( sink_ );
+
+   const size_t chunks( ( size + COMPRESSION_CHUNK_SIZE - 1UL ) / COMPRESSION_CHUNK_SIZE );
+
+   smpReduce<size_t>( chunks, 1UL, canSMPReduce( chunks, 2UL ),
+      [this,size]( size_t first, size_t count ) {
+         for( size_t k=first; k<first+count; ++k ) {
+            sizes_[k] = compressChunk( k, min( COMPRESSION_CHUNK_SIZE, size - k*COMPRESSION_CHUNK_SIZE ) );
+         }
+         return size_t( 0UL );
+      },
+      []( size_t a, size_t b ) { return a + b; } );
+
+   for( size_t k=0UL; k<chunks; ++k )
+   {
+      const size_t   offset( k*COMPRESSION_CHUNK_SIZE );
+      const uint32_t sizes[2] = { static_cast<uint32_t>( min( COMPRESSION_CHUNK_SIZE, size - offset ) ),
+                                  static_cast<uint32_t>( sizes_[k] ) };
+
+      sink_.write( reinterpret_cast<const char*>( sizes ), sizeof( sizes ) );
+
+      if( sizes[0] == sizes[1] )
+         sink_.write( input_.get() + offset, sizes[1] );
+      else
+         sink_.write( output_.get() + offset, sizes[1] );
+   }
+
+   setp( input_.get(), input_.get() + COMPRESSION_BATCH_SIZE*COMPRESSION_CHUNK_SIZE );
+
+   return static_cast<bool>( sink_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Filters and compresses a single chunk of the current batch.
+//
+// \param k The index of the chunk.
+// \param size The uncompressed size of the chunk.
+// \return The stored size of the chunk (equal to \a size in case the chunk is stored uncompressed).
+*/
+inline size_t CompressedOStreamBuffer::compressChunk( size_t k, size_t size ) noexcept
+{
+   const size_t offset( k*COMPRESSION_CHUNK_SIZE );
+   const char* src( input_.get() + offset );
+
+   if( typeSize_ > 0UL ) {
+      byteShuffle( src, scratch_.get() + offset, size, typeSize_ );
+      byteDeltaEncode( scratch_.get() + offset, size );
+      src = scratch_.get() + offset;
+   }
+
+   const size_t compressed( lzCompress( src, size, output_.get() + offset, size-1UL ) );
+
+   return ( compressed > 0UL )?( compressed ):( size );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS COMPRESSEDISTREAMBUFFER
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Stream buffer for the decompression of an input stream.
+// \ingroup math_serialization
+//
+// The CompressedIStreamBuffer reads a batch of chunks from the underlying input stream and
+// decompresses all chunks in parallel (if shared memory parallelization is active).
+*/
+class CompressedIStreamBuffer
+   : public std::streambuf
+   , private NonCopyable
+{
+ public:
+   //**Constructor*********************************************************************************
+   explicit inline CompressedIStreamBuffer( std::istream& source );
+   //**********************************************************************************************
+
+ protected:
+   //**Stream buffer functions*********************************************************************
+   virtual inline int_type underflow();
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   inline bool decompressChunk( size_t k ) noexcept;
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   std::istream&             source_;    //!< The underlying input stream.
+   size_t                    typeSize_;  //!< The element size for the byte shuffle filter.
+   bool                      finished_;  //!< Flag for a completely read or corrupt stream.
+   std::unique_ptr<char[]>   input_;     //!< The stored data of the current batch.
+   std::unique_ptr<char[]>   scratch_;   //!< The unfiltered data of the current batch.
+   std::unique_ptr<char[]>   output_;    //!< The decompressed data of the current batch.
+   std::unique_ptr<size_t[]> sizes_;     //!< The uncompressed and stored sizes of the chunks.
+   std::unique_ptr<size_t[]> offsets_;   //!< The offsets of the decompressed chunks.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creating a decompression buffer for the given input stream.
+//
+// \param source The underlying input stream.
+//
+// In case the input stream does not start with a valid header, the buffer does not provide
+// any data.
+*/
+inline CompressedIStreamBuffer::CompressedIStreamBuffer( std::istream& source )
+   : source_  ( source )                                                      // The underlying input stream
+   , typeSize_( 0UL )                                                         // The element size for the byte shuffle filter
+   , finished_( false )                                                       // Flag for a completely read or corrupt stream
+   , input_   ( new char[COMPRESSION_BATCH_SIZE*COMPRESSION_CHUNK_SIZE] )   // The stored data of the current batch
+   , scratch_ ( new char[COMPRESSION_BATCH_SIZE*COMPRESSION_CHUNK_SIZE] )   // The unfiltered data of the current batch
+   , output_  ( new char[COMPRESSION_BATCH_SIZE*COMPRESSION_CHUNK_SIZE] )   // The decompressed data of the current batch
+   , sizes_   ( new size_t[2UL*COMPRESSION_BATCH_SIZE] )                      // The uncompressed and stored sizes of the chunks
+   , offsets_ ( new size_t[COMPRESSION_BATCH_SIZE] )                          // The offsets of the decompressed chunks
+{
+   CompressedStreamHeader header;
+
+   if( !source_.read( reinterpret_cast<char*>( &header ), sizeof( CompressedStreamHeader ) ) ||
+       std::memcmp( header.magic, "BLAZECZ", 8UL ) != 0 || header.version != 1U ||
+       header.chunkSize != COMPRESSION_CHUNK_SIZE ) {
+      finished_ = true;
+   }
+   else {
+      typeSize_ = header.typeSize;
+   }
+
+   setg( output_.get(), output_.get(), output_.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reads and decompresses the next batch of chunks.
+//
+// \return The next character in case of success, \a traits_type::eof() otherwise.
+*/
+inline CompressedIStreamBuffer::int_type CompressedIStreamBuffer::underflow()
+{
+   if( gptr() < egptr() ) {
+      return traits_type::to_int_type( *gptr() );
+   }
+
+   if( finished_ ) {
+      return traits_type::eof();
+   }
+
+   size_t chunks( 0UL );
+   size_t size  ( 0UL );
+
+   while( chunks < COMPRESSION_BATCH_SIZE )
+   {
+      uint32_t sizes[2];
+
+      if( !source_.read( reinterpret_cast<char*>( sizes ), sizeof( sizes ) ) ||
+          sizes[0] > COMPRESSION_CHUNK_SIZE || sizes[1] > sizes[0] ) {
+         finished_ = true;
+         return traits_type::eof();
+      }
+
+      if( sizes[0] == 0U ) {
+         finished_ = true;
+         break;
+      }
+
+      if( !source_.read( input_.get() + chunks*COMPRESSION_CHUNK_SIZE, sizes[1] ) ) {
+         finished_ = true;
+         return traits_type::eof();
+      }
+
+      sizes_[2UL*chunks    ] = sizes[0];
+      sizes_[2UL*chunks+1UL] = sizes[1];
+      offsets_[chunks] = size;
+      size += sizes[0];
+      ++chunks;
+   }
+
+   const size_t failed = smpReduce<size_t>( chunks, 1UL, canSMPReduce( chunks, 2UL ),
+      [this]( size_t first, size_t count ) {
+         size_t failed( 0UL );
+         for( size_t k=first; k<first+count; ++k ) {
+            if( !decompressChunk( k ) ) ++failed;
+         }
+         return failed;
+      },
+      []( size_t a, size_t b ) { return a + b; } );
+
+   if( failed > 0UL ) {
+      finished_ = true;
+      return traits_type::eof();
+   }
+
+   setg( output_.get(), output_.get(), output_.get() + size );
+
+   return ( size > 0UL )?( traits_type::to_int_type( *gptr() ) ):( traits_type::eof() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Decompresses and unfilters a single chunk of the current batch.
+//
+// \param k The index of the chunk.
+// \return \a true in case the chunk was successfully decompressed, \a false if it is corrupt.
+*/
+inline bool CompressedIStreamBuffer::decompressChunk( size_t k ) noexcept
+{
+   const size_t size  ( sizes_[2UL*k    ] );
+   const size_t stored( sizes_[2UL*k+1UL] );
+   const char*  src   ( input_.get() + k*COMPRESSION_CHUNK_SIZE );
+   char*        dst   ( output_.get() + offsets_[k] );
+
+   if( stored == size ) {
+      std::memcpy( dst, src, size );
+      return true;
+   }
+
+   char* tmp( ( typeSize_ > 0UL )?( scratch_.get() + k*COMPRESSION_CHUNK_SIZE ):( dst ) );
+
+   if( lzDecompress( src, stored, tmp, size ) != size ) {
+      return false;
+   }
+
+   if( typeSize_ > 0UL ) {
+      byteDeltaDecode( tmp, size );
+      byteUnshuffle( tmp, dst, size, typeSize_ );
+   }
+
+   return true;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS COMPRESSEDOSTREAM
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Output stream with transparent, parallel compression.
+// \ingroup math_serialization
+//
+// The CompressedOStream class compresses all written data and writes the compressed data to
+// a file or to another output stream. It can be bound to an Archive to write compressed
+// checkpoints of vectors and matrices:
+
+   \code
+   blaze::DynamicMatrix<double> A;
+   // ... Resizing and initialization
+
+   {
+      blaze::Archive<blaze::CompressedOStream> archive( "matrix.blaze.cz" );
+      archive << A;
+   }
+
+   {
+      blaze::Archive<blaze::CompressedIStream> archive( "matrix.blaze.cz" );
+      archive >> A;
+   }
+   \endcode
+
+// The data is split into chunks of 256 KiB. Before compression, the bytes of each chunk are
+// shuffled according to the given element size (see byteShuffle(); by default the size of a
+// \c double) and delta encoded (see byteDeltaEncode()). This groups bytes of the same
+// significance together, which considerably improves the compression of slowly varying
+// floating point data. The filtered chunks are compressed by the LZ codec (see lzCompress());
+// chunks that cannot be compressed are stored uncompressed. In case shared memory
+// parallelization is active, batches of 16 chunks are compressed in parallel.
+//
+// The achievable compression ratio depends on the data. Integer valued or low precision data
+// usually shrinks by one or two orders of magnitude. Slowly varying floating point data at full
+// precision, however, only shrinks by about 20 percent (e.g. 1.25x for a smooth \c double field),
+// since the low bytes of the mantissas are essentially random and cannot be compressed by any
+// lossless codec. Random data is stored uncompressed, i.e. it grows only by the 8-byte headers
+// of the chunks.
+//
+// The compressed stream is terminated by the destructor or by an explicit call to close().
+// Note that a CompressedOStream that writes to another output stream must be closed or
+// destroyed before the other stream is closed.
+*/
+class CompressedOStream
+   : public std::ostream
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline CompressedOStream( const std::string& file, size_t typeSize = sizeof(double) );
+   explicit inline CompressedOStream( std::ostream& sink, size_t typeSize = sizeof(double) );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~CompressedOStream();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline void close();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::unique_ptr<std::ofstream> file_;    //!< The optional output file.
+   CompressedOStreamBuffer        buffer_;  //!< The compression buffer.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creating a compressed output stream that writes to the given file.
+//
+// \param file The name of the output file.
+// \param typeSize The element size for the byte shuffle filter (0 to disable the filters).
+//
+// An existing file is overwritten. In case the file cannot be opened, the stream is in a
+// failed state.
+*/
+inline CompressedOStream::CompressedOStream( const std::string& file, size_t typeSize )
+   : std::ostream( nullptr )                                                 // Initialization of the base class
+   , file_  ( new std::ofstream( file, std::ios::binary | std::ios::trunc ) )  // The optional output file
+   , buffer_( *file_, typeSize )                                             // The compression buffer
+{
+   init( &buffer_ );
+
+   if( !*file_ ) {
+      setstate( std::ios::failbit );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creating a compressed output stream that writes to the given output stream.
+//
+// \param sink The underlying output stream.
+// \param typeSize The element size for the byte shuffle filter (0 to disable the filters).
+*/
+inline CompressedOStream::CompressedOStream( std::ostream& sink, size_t typeSize )
+   : std::ostream( nullptr )    // Initialization of the base class
+   , file_  ()                  // The optional output file
+   , buffer_( sink, typeSize )  // The compression buffer
+{
+   init( &buffer_ );
+
+   if( !sink ) {
+      setstate( std::ios::failbit );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The destructor of the CompressedOStream class.
+//
+// The destructor compresses all pending data and terminates the compressed stream.
+*/
+inline CompressedOStream::~CompressedOStream()
+{
+   buffer_.finish();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compresses all pending data and terminates the compressed stream.
+//
+// \return void
+//
+// After this call no further data can be written to the stream. In case an error occurs, the
+// stream is set to a failed state.
+*/
+inline void CompressedOStream::close()
+{
+   if( !buffer_.finish() ) {
+      setstate( std::ios::badbit );
+   }
+
+   if( file_ ) {
+      file_->close();
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS COMPRESSEDISTREAM
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Input stream with transparent, parallel decompression.
+// \ingroup math_serialization
+//
+// The CompressedIStream class reads and decompresses data written by a CompressedOStream from
+// a file or from another input stream (see CompressedOStream for an example). In case the data
+// is not a valid compressed stream or is corrupt, reading from the stream fails.
+*/
+class CompressedIStream
+   : public std::istream
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline CompressedIStream( const std::string& file );
+   explicit inline CompressedIStream( std::istream& source );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::unique_ptr<std::ifstream> file_;    //!< The optional input file.
+   CompressedIStreamBuffer        buffer_;  //!< The decompression buffer.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creating a compressed input stream that reads from the given file.
+//
+// \param file The name of the input file.
+//
+// In case the file cannot be opened, the stream is in a failed state.
+*/
+inline CompressedIStream::CompressedIStream( const std::string& file )
+   : std::istream( nullptr )                                    // Initialization of the base class
+   , file_  ( new std::ifstream( file, std::ios::binary ) )  // The optional input file
+   , buffer_( *file_ )                                        // The decompression buffer
+{
+   init( &buffer_ );
+
+   if( !*file_ ) {
+      setstate( std::ios::failbit );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creating a compressed input stream that reads from the given input stream.
+//
+// \param source The underlying input stream.
+*/
+inline CompressedIStream::CompressedIStream( std::istream& source )
+   : std::istream( nullptr )  // Initialization of the base class
+   , file_  ()                // The optional input file
+   , buffer_( source )        // The decompression buffer
+{
+   init( &buffer_ );
+
+   if( !source ) {
+      setstate( std::ios::failbit );
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
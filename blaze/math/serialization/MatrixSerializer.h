@@ -49,11 +49,13 @@
 #include <blaze/math/expressions/Matrix.h>
 #include <blaze/math/serialization/TypeValueMapping.h>
 #include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/typetraits/IsContiguous.h>
 #include <blaze/math/typetraits/IsDenseMatrix.h>
 #include <blaze/math/typetraits/IsResizable.h>
 #include <blaze/math/typetraits/IsRowMajorMatrix.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
+#include <blaze/util/serialization/ArchiveBuffer.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/IsNumeric.h>
 
@@ -193,6 +195,22 @@ class MatrixSerializer
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Private class SparseIndexType***************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Index type of the temporary used for a storage order conversion.
+   //
+   // This class template determines the index type of the temporary CompressedMatrix that is used
+   // to deserialize a sparse matrix with opposite storage order. For a CompressedMatrix the index
+   // type of the target matrix is used, for all other sparse matrix types it defaults to \c size_t.
+   */
+   template< typename T >
+   struct SparseIndexType
+   {
+      using Type = size_t;
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
  public:
    //**Constructors********************************************************************************
    /*!\name Constructors */
@@ -225,7 +243,12 @@ class MatrixSerializer
    void serializeHeader( Archive& archive, const MT& mat );
 
    template< typename Archive, typename MT, bool SO >
-   void serializeMatrix( Archive& archive, const DenseMatrix<MT,SO>& mat );
+   EnableIf_t< IsContiguous_v<MT> && IsNumeric_v< ElementType_t<MT> > >
+      serializeMatrix( Archive& archive, const DenseMatrix<MT,SO>& mat );
+
+   template< typename Archive, typename MT, bool SO >
+   DisableIf_t< IsContiguous_v<MT> && IsNumeric_v< ElementType_t<MT> > >
+      serializeMatrix( Archive& archive, const DenseMatrix<MT,SO>& mat );
 
    template< typename Archive, typename MT, bool SO >
    void serializeMatrix( Archive& archive, const SparseMatrix<MT,SO>& mat );
@@ -399,6 +422,45 @@ void MatrixSerializer::serializeHeader( Archive& archive, const MT& mat )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Serializes the elements of a dense matrix with contiguous storage.
+//
+// \param archive The archive to be written.
+// \param mat The matrix to be serialized.
+// \return void
+// \exception std::runtime_error Dense matrix could not be serialized.
+//
+// This function writes the elements of each row (row-major) or column (column-major) of the
+// given dense matrix with a single bulk write. In case the matrix is not padded, all elements
+// are written at once.
+*/
+template< typename Archive  // Type of the archive
+        , typename MT       // Type of the matrix
+        , bool SO >         // Storage order
+EnableIf_t< IsContiguous_v<MT> && IsNumeric_v< ElementType_t<MT> > >
+   MatrixSerializer::serializeMatrix( Archive& archive, const DenseMatrix<MT,SO>& mat )
+{
+   const size_t M( SO ? (~mat).columns() : (~mat).rows()    );
+   const size_t N( SO ? (~mat).rows()    : (~mat).columns() );
+
+   if( M == 0UL || N == 0UL ) return;
+
+   if( (~mat).spacing() == N ) {
+      archive.write( (~mat).data(), M*N );
+   }
+   else {
+      for( size_t i=0UL; i<M; ++i ) {
+         archive.write( (~mat).data(i), N );
+      }
+   }
+
+   if( !archive ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Dense matrix could not be serialized" );
+   }
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Serializes the elements of a dense matrix.
 //
@@ -410,23 +472,28 @@ void MatrixSerializer::serializeHeader( Archive& archive, const MT& mat )
 template< typename Archive  // Type of the archive
         , typename MT       // Type of the matrix
         , bool SO >         // Storage order
-void MatrixSerializer::serializeMatrix( Archive& archive, const DenseMatrix<MT,SO>& mat )
+DisableIf_t< IsContiguous_v<MT> && IsNumeric_v< ElementType_t<MT> > >
+   MatrixSerializer::serializeMatrix( Archive& archive, const DenseMatrix<MT,SO>& mat )
 {
+   ArchiveBuffer<Archive> buffer( archive );
+
    if( IsRowMajorMatrix_v<MT> ) {
       for( size_t i=0UL; i<(~mat).rows(); ++i ) {
          for( size_t j=0UL; j<(~mat).columns(); ++j ) {
-            archive << (~mat)(i,j);
+            buffer << (~mat)(i,j);
          }
       }
    }
    else {
       for( size_t j=0UL; j<(~mat).columns(); ++j ) {
          for( size_t i=0UL; i<(~mat).rows(); ++i ) {
-            archive << (~mat)(i,j);
+            buffer << (~mat)(i,j);
          }
       }
    }
 
+   buffer.flush();
+
    if( !archive ) {
       BLAZE_THROW_RUNTIME_ERROR( "Dense matrix could not be serialized" );
    }
@@ -447,23 +514,27 @@ template< typename Archive  // Type of the archive
         , bool SO >         // Storage order
 void MatrixSerializer::serializeMatrix( Archive& archive, const SparseMatrix<MT,SO>& mat )
 {
+   ArchiveBuffer<Archive> buffer( archive );
+
    if( IsRowMajorMatrix_v<MT> ) {
       for( size_t i=0UL; i<(~mat).rows(); ++i ) {
-         archive << uint64_t( (~mat).nonZeros( i ) );
+         buffer << uint64_t( (~mat).nonZeros( i ) );
          for( auto element=(~mat).begin(i); element!=(~mat).end(i); ++element ) {
-            archive << element->index() << element->value();
+            buffer << element->index() << element->value();
          }
       }
    }
    else {
       for( size_t j=0UL; j<(~mat).columns(); ++j ) {
-         archive << uint64_t( (~mat).nonZeros( j ) );
+         buffer << uint64_t( (~mat).nonZeros( j ) );
          for( auto element=(~mat).begin(j); element!=(~mat).end(j); ++element ) {
-            archive << element->index() << element->value();
+            buffer << element->index() << element->value();
          }
       }
    }
 
+   buffer.flush();
+
    if( !archive ) {
       BLAZE_THROW_RUNTIME_ERROR( "Sparse matrix could not be serialized" );
    }
@@ -672,11 +743,16 @@ void MatrixSerializer::deserializeDenseRowMatrix( Archive& archive, DenseMatrix<
 {
    using ET = ElementType_t<MT>;
 
+   ArchiveBuffer<Archive> buffer( archive );
    ET value{};
 
+   if( IsNumeric_v<ET> ) {
+      buffer.prefetch( rows_*columns_*sizeof(ET) );
+   }
+
    for( size_t i=0UL; i<rows_; ++i ) {
       size_t j( 0UL );
-      while( ( j != columns_ ) && ( archive >> value ) ) {
+      while( ( j != columns_ ) && ( buffer >> value ) ) {
          (~mat)(i,j) = value;
          ++j;
       }
@@ -811,11 +887,16 @@ void MatrixSerializer::deserializeDenseColumnMatrix( Archive& archive, DenseMatr
 {
    using ET = ElementType_t<MT>;
 
+   ArchiveBuffer<Archive> buffer( archive );
    ET value{};
 
+   if( IsNumeric_v<ET> ) {
+      buffer.prefetch( rows_*columns_*sizeof(ET) );
+   }
+
    for( size_t j=0UL; j<columns_; ++j ) {
       size_t i( 0UL );
-      while( ( i != rows_ ) && ( archive >> value ) ) {
+      while( ( i != rows_ ) && ( buffer >> value ) ) {
          (~mat)(i,j) = value;
          ++i;
       }
@@ -920,14 +1001,18 @@ void MatrixSerializer::deserializeSparseRowMatrix( Archive& archive, DenseMatrix
 {
    using ET = ElementType_t<MT>;
 
+   ArchiveBuffer<Archive> buffer( archive );
    uint64_t number( 0UL );
    size_t   index ( 0UL );
    ET       value {};
 
    for( size_t i=0UL; i<rows_; ++i ) {
-      archive >> number;
+      buffer >> number;
+      if( IsNumeric_v<ET> ) {
+         buffer.prefetch( number*( sizeof(size_t) + sizeof(ET) ) );
+      }
       size_t j( 0UL );
-      while( ( j != number ) && ( archive >> index >> value ) ) {
+      while( ( j != number ) && ( buffer >> index >> value ) ) {
          (~mat)(i,index) = value;
          ++j;
       }
@@ -958,16 +1043,20 @@ void MatrixSerializer::deserializeSparseRowMatrix( Archive& archive, SparseMatri
 {
    using ET = ElementType_t<MT>;
 
+   ArchiveBuffer<Archive> buffer( archive );
    uint64_t number( 0UL );
    size_t   index ( 0UL );
    ET       value {};
 
    for( size_t i=0UL; i<rows_; ++i )
    {
-      archive >> number;
+      buffer >> number;
+      if( IsNumeric_v<ET> ) {
+         buffer.prefetch( number*( sizeof(size_t) + sizeof(ET) ) );
+      }
 
       size_t j( 0UL );
-      while( ( j != number ) && ( archive >> index >> value ) ) {
+      while( ( j != number ) && ( buffer >> index >> value ) ) {
          (~mat).append( i, index, value, false );
          ++j;
       }
@@ -998,7 +1087,9 @@ template< typename Archive  // Type of the archive
         , typename MT >     // Type of the matrix
 void MatrixSerializer::deserializeSparseRowMatrix( Archive& archive, SparseMatrix<MT,columnMajor>& mat )
 {
-   CompressedMatrix< ElementType_t<MT>, rowMajor > tmp( rows_, columns_, number_ );
+   using IT = typename SparseIndexType<MT>::Type;
+
+   CompressedMatrix< ElementType_t<MT>, rowMajor, IT > tmp( rows_, columns_, number_ );
    deserializeSparseRowMatrix( archive, tmp );
    (~mat) = tmp;
 
@@ -1028,14 +1119,18 @@ void MatrixSerializer::deserializeSparseColumnMatrix( Archive& archive, DenseMat
 {
    using ET = ElementType_t<MT>;
 
+   ArchiveBuffer<Archive> buffer( archive );
    uint64_t number( 0UL );
    size_t   index ( 0UL );
    ET       value {};
 
    for( size_t j=0UL; j<columns_; ++j ) {
-      archive >> number;
+      buffer >> number;
+      if( IsNumeric_v<ET> ) {
+         buffer.prefetch( number*( sizeof(size_t) + sizeof(ET) ) );
+      }
       size_t i( 0UL );
-      while( ( i != number ) && ( archive >> index >> value ) ) {
+      while( ( i != number ) && ( buffer >> index >> value ) ) {
          (~mat)(index,j) = value;
          ++i;
       }
@@ -1064,7 +1159,9 @@ template< typename Archive  // Type of the archive
         , typename MT >     // Type of the matrix
 void MatrixSerializer::deserializeSparseColumnMatrix( Archive& archive, SparseMatrix<MT,rowMajor>& mat )
 {
-   CompressedMatrix< ElementType_t<MT>, columnMajor > tmp( rows_, columns_, number_ );
+   using IT = typename SparseIndexType<MT>::Type;
+
+   CompressedMatrix< ElementType_t<MT>, columnMajor, IT > tmp( rows_, columns_, number_ );
    deserializeSparseColumnMatrix( archive, tmp );
    (~mat) = tmp;
 
@@ -1093,16 +1190,20 @@ void MatrixSerializer::deserializeSparseColumnMatrix( Archive& archive, SparseMa
 {
    using ET = ElementType_t<MT>;
 
+   ArchiveBuffer<Archive> buffer( archive );
    uint64_t number( 0UL );
    size_t   index ( 0UL );
    ET       value {};
 
    for( size_t j=0UL; j<columns_; ++j )
    {
-      archive >> number;
+      buffer >> number;
+      if( IsNumeric_v<ET> ) {
+         buffer.prefetch( number*( sizeof(size_t) + sizeof(ET) ) );
+      }
 
       size_t i( 0UL );
-      while( ( i != number ) && ( archive >> index >> value ) ) {
+      while( ( i != number ) && ( buffer >> index >> value ) ) {
          (~mat).append( index, j, value, false );
          ++i;
       }
@@ -1119,6 +1220,29 @@ void MatrixSerializer::deserializeSparseColumnMatrix( Archive& archive, SparseMa
 
 
 
+//=================================================================================================
+//
+//  SPARSEINDEXTYPE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the SparseIndexType class template for compressed matrices.
+*/
+template< typename ET    // Element type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+struct MatrixSerializer::SparseIndexType< CompressedMatrix<ET,SO,IT> >
+{
+   using Type = IT;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  MATRIXVALUEMAPPINGHELPER SPECIALIZATIONS
@@ -47,11 +47,14 @@
 #include <blaze/math/expressions/SparseVector.h>
 #include <blaze/math/expressions/Vector.h>
 #include <blaze/math/serialization/TypeValueMapping.h>
+#include <blaze/math/typetraits/IsContiguous.h>
 #include <blaze/math/typetraits/IsDenseVector.h>
 #include <blaze/math/typetraits/IsResizable.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
+#include <blaze/util/serialization/ArchiveBuffer.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsNumeric.h>
 
 
 namespace blaze {
@@ -220,7 +223,12 @@ class VectorSerializer
    void serializeHeader( Archive& archive, const VT& vec );
 
    template< typename Archive, typename VT, bool TF >
-   void serializeVector( Archive& archive, const DenseVector<VT,TF>& vec );
+   EnableIf_t< IsContiguous_v<VT> && IsNumeric_v< ElementType_t<VT> > >
+      serializeVector( Archive& archive, const DenseVector<VT,TF>& vec );
+
+   template< typename Archive, typename VT, bool TF >
+   DisableIf_t< IsContiguous_v<VT> && IsNumeric_v< ElementType_t<VT> > >
+      serializeVector( Archive& archive, const DenseVector<VT,TF>& vec );
 
    template< typename Archive, typename VT, bool TF >
    void serializeVector( Archive& archive, const SparseVector<VT,TF>& vec );
@@ -363,6 +371,32 @@ void VectorSerializer::serializeHeader( Archive& archive, const VT& vec )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Serializes the elements of a dense vector with contiguous storage.
+//
+// \param archive The archive to be written.
+// \param vec The vector to be serialized.
+// \return void
+// \exception std::runtime_error Dense vector could not be serialized.
+//
+// This function writes all elements of the given dense vector with a single bulk write.
+*/
+template< typename Archive  // Type of the archive
+        , typename VT       // Type of the vector
+        , bool TF >         // Transpose flag
+EnableIf_t< IsContiguous_v<VT> && IsNumeric_v< ElementType_t<VT> > >
+   VectorSerializer::serializeVector( Archive& archive, const DenseVector<VT,TF>& vec )
+{
+   if( (~vec).size() == 0UL ) return;
+   archive.write( (~vec).data(), (~vec).size() );
+
+   if( !archive ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Dense vector could not be serialized" );
+   }
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Serializes the elements of a dense vector.
 //
@@ -374,13 +408,18 @@ void VectorSerializer::serializeHeader( Archive& archive, const VT& vec )
 template< typename Archive  // Type of the archive
         , typename VT       // Type of the vector
         , bool TF >         // Transpose flag
-void VectorSerializer::serializeVector( Archive& archive, const DenseVector<VT,TF>& vec )
+DisableIf_t< IsContiguous_v<VT> && IsNumeric_v< ElementType_t<VT> > >
+   VectorSerializer::serializeVector( Archive& archive, const DenseVector<VT,TF>& vec )
 {
+   ArchiveBuffer<Archive> buffer( archive );
+
    size_t i( 0UL );
-   while( ( i < (~vec).size() ) && ( archive << (~vec)[i] ) ) {
+   while( ( i < (~vec).size() ) && ( buffer << (~vec)[i] ) ) {
       ++i;
    }
 
+   buffer.flush();
+
    if( !archive ) {
       BLAZE_THROW_RUNTIME_ERROR( "Dense vector could not be serialized" );
    }
@@ -403,12 +442,16 @@ void VectorSerializer::serializeVector( Archive& archive, const SparseVector<VT,
 {
    using ConstIterator = ConstIterator_t<VT>;
 
+   ArchiveBuffer<Archive> buffer( archive );
+
    ConstIterator element( (~vec).begin() );
    while( ( element != (~vec).end() ) &&
-          ( archive << element->index() << element->value() ) ) {
+          ( buffer << element->index() << element->value() ) ) {
       ++element;
    }
 
+   buffer.flush();
+
    if( !archive ) {
       BLAZE_THROW_RUNTIME_ERROR( "Sparse vector could not be serialized" );
    }
@@ -587,10 +630,15 @@ DisableIf_t< VT::simdEnabled >
 {
    using ET = ElementType_t<VT>;
 
+   ArchiveBuffer<Archive> buffer( archive );
    size_t i( 0UL );
    ET value{};
 
-   while( ( i != size_ ) && ( archive >> value ) ) {
+   if( IsNumeric_v<ET> ) {
+      buffer.prefetch( size_*sizeof(ET) );
+   }
+
+   while( ( i != size_ ) && ( buffer >> value ) ) {
       (~vec)[i] = value;
       ++i;
    }
@@ -649,10 +697,15 @@ void VectorSerializer::deserializeDenseVector( Archive& archive, SparseVector<VT
 {
    using ET = ElementType_t<VT>;
 
+   ArchiveBuffer<Archive> buffer( archive );
    size_t i( 0UL );
    ET value{};
 
-   while( ( i != size_ ) && ( archive >> value ) ) {
+   if( IsNumeric_v<ET> ) {
+      buffer.prefetch( size_*sizeof(ET) );
+   }
+
+   while( ( i != size_ ) && ( buffer >> value ) ) {
       (~vec)[i] = value;
       ++i;
    }
@@ -683,11 +736,16 @@ void VectorSerializer::deserializeSparseVector( Archive& archive, DenseVector<VT
 {
    using ET = ElementType_t<VT>;
 
+   ArchiveBuffer<Archive> buffer( archive );
    size_t i    ( 0UL );
    size_t index( 0UL );
    ET     value{};
 
-   while( ( i != number_ ) && ( archive >> index >> value ) ) {
+   if( IsNumeric_v<ET> ) {
+      buffer.prefetch( number_*( sizeof(size_t) + sizeof(ET) ) );
+   }
+
+   while( ( i != number_ ) && ( buffer >> index >> value ) ) {
       (~vec)[index] = value;
       ++i;
    }
@@ -718,11 +776,16 @@ void VectorSerializer::deserializeSparseVector( Archive& archive, SparseVector<V
 {
    using ET = ElementType_t<VT>;
 
+   ArchiveBuffer<Archive> buffer( archive );
    size_t i    ( 0UL );
    size_t index( 0UL );
    ET     value{};
 
-   while( ( i != number_ ) && ( archive >> index >> value ) ) {
+   if( IsNumeric_v<ET> ) {
+      buffer.prefetch( number_*( sizeof(size_t) + sizeof(ET) ) );
+   }
+
+   while( ( i != number_ ) && ( buffer >> index >> value ) ) {
       (~vec).append( index, value, false );
       ++i;
    }
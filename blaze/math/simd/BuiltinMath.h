@@ -0,0 +1,1115 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/simd/BuiltinMath.h
+//  \brief Header file for the built-in SIMD implementations of transcendental functions
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SIMD_BUILTINMATH_H_
+#define _BLAZE_MATH_SIMD_BUILTINMATH_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <limits>
+#include <utility>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsDouble.h>
+#include <blaze/util/typetraits/IsFloat.h>
+
+
+namespace blaze {
+
+#if BLAZE_BUILTIN_SIMD_MATH_MODE
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Low-level SIMD operations for the built-in transcendental functions.
+// \ingroup simd
+//
+// The BuiltinMathOps class template provides a uniform interface to the basic operations on
+// the intrinsic floating point types (\c __m128, \c __m128d, \c __m256, \c __m256d, \c __m512,
+// and \c __m512d) that are required by the built-in implementations of the transcendental
+// functions. Comparisons return a mask, which can be used in combination with \c select().
+// The \c pow2(), \c exponent(), \c mantissa(), and \c copySign() functions work on the IEEE 754
+// bit pattern:
+
+//  - pow2( k )       : \f$ 2^k \f$ for integral values \a k within the range of normal numbers
+//  - exponent( a )   : the biased exponent of the positive, normal values \a a
+//  - mantissa( a )   : the values \a a with the exponent replaced such that they lie in [0.5,1)
+//  - copySign( a, b ): the magnitudes of \a a with the signs of \a b
+
+// The single precision specializations additionally provide the conversion of the lower and
+// upper half of a vector to double precision (\c widenLow() and \c widenHigh()) and the
+// conversion of two double precision vectors back to a single precision vector (\c narrow()).
+*/
+template< typename T  // Element type of the intrinsic operand
+        , size_t N >  // Number of elements of the intrinsic operand
+struct BuiltinMathOps;
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SSE2 SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the BuiltinMathOps class template for \c __m128.
+// \ingroup simd
+*/
+template<>
+struct BuiltinMathOps<float,4UL>
+{
+   using ValueType = float;
+   using MaskType  = __m128;
+
+   static constexpr size_t size = 4UL;
+
+   static BLAZE_ALWAYS_INLINE __m128 set( float v ) noexcept { return _mm_set1_ps( v ); }
+   static BLAZE_ALWAYS_INLINE __m128 loadu( const float* p ) noexcept { return _mm_loadu_ps( p ); }
+   static BLAZE_ALWAYS_INLINE void storeu( float* p, __m128 a ) noexcept { _mm_storeu_ps( p, a ); }
+
+   static BLAZE_ALWAYS_INLINE __m128 add( __m128 a, __m128 b ) noexcept { return _mm_add_ps( a, b ); }
+   static BLAZE_ALWAYS_INLINE __m128 sub( __m128 a, __m128 b ) noexcept { return _mm_sub_ps( a, b ); }
+   static BLAZE_ALWAYS_INLINE __m128 mul( __m128 a, __m128 b ) noexcept { return _mm_mul_ps( a, b ); }
+   static BLAZE_ALWAYS_INLINE __m128 div( __m128 a, __m128 b ) noexcept { return _mm_div_ps( a, b ); }
+   static BLAZE_ALWAYS_INLINE __m128 min( __m128 a, __m128 b ) noexcept { return _mm_min_ps( a, b ); }
+   static BLAZE_ALWAYS_INLINE __m128 max( __m128 a, __m128 b ) noexcept { return _mm_max_ps( a, b ); }
+   static BLAZE_ALWAYS_INLINE __m128 abs( __m128 a ) noexcept { return _mm_andnot_ps( _mm_set1_ps( -0.0F ), a ); }
+
+#if BLAZE_FMA_MODE
+   static BLAZE_ALWAYS_INLINE __m128 fmadd( __m128 a, __m128 b, __m128 c ) noexcept { return _mm_fmadd_ps( a, b, c ); }
+#else
+   static BLAZE_ALWAYS_INLINE __m128 fmadd( __m128 a, __m128 b, __m128 c ) noexcept { return _mm_add_ps( _mm_mul_ps( a, b ), c ); }
+#endif
+
+   static BLAZE_ALWAYS_INLINE MaskType equal   ( __m128 a, __m128 b ) noexcept { return _mm_cmpeq_ps ( a, b ); }
+   static BLAZE_ALWAYS_INLINE MaskType notEqual( __m128 a, __m128 b ) noexcept { return _mm_cmpneq_ps( a, b ); }
+   static BLAZE_ALWAYS_INLINE MaskType less    ( __m128 a, __m128 b ) noexcept { return _mm_cmplt_ps ( a, b ); }
+   static BLAZE_ALWAYS_INLINE MaskType greater ( __m128 a, __m128 b ) noexcept { return _mm_cmpgt_ps ( a, b ); }
+   static BLAZE_ALWAYS_INLINE MaskType isnan   ( __m128 a ) noexcept { return _mm_cmpunord_ps( a, a ); }
+   static BLAZE_ALWAYS_INLINE bool     any     ( MaskType m ) noexcept { return _mm_movemask_ps( m ) != 0; }
+
+#if BLAZE_SSE4_MODE
+   static BLAZE_ALWAYS_INLINE __m128 select( MaskType m, __m128 a, __m128 b ) noexcept { return _mm_blendv_ps( b, a, m ); }
+#else
+   static BLAZE_ALWAYS_INLINE __m128 select( MaskType m, __m128 a, __m128 b ) noexcept { return _mm_or_ps( _mm_and_ps( m, a ), _mm_andnot_ps( m, b ) ); }
+#endif
+
+   static BLAZE_ALWAYS_INLINE __m128 pow2( __m128 k ) noexcept {
+      return _mm_castsi128_ps( _mm_slli_epi32( _mm_castps_si128( _mm_add_ps( k, _mm_set1_ps( 12583039.0F ) ) ), 23 ) );
+   }
+
+   static BLAZE_ALWAYS_INLINE __m128 exponent( __m128 a ) noexcept {
+      const __m128 magic( _mm_set1_ps( 8388608.0F ) );
+      return _mm_sub_ps( _mm_or_ps( _mm_castsi128_ps( _mm_srli_epi32( _mm_castps_si128( a ), 23 ) ), magic ), magic );
+   }
+
+   static BLAZE_ALWAYS_INLINE __m128 mantissa( __m128 a ) noexcept {
+      return _mm_or_ps( _mm_andnot_ps( set( std::numeric_limits<float>::infinity() ), a ), _mm_set1_ps( 0.5F ) );
+   }
+
+   static BLAZE_ALWAYS_INLINE __m128 copySign( __m128 a, __m128 b ) noexcept {
+      const __m128 sign( _mm_set1_ps( -0.0F ) );
+      return _mm_or_ps( _mm_andnot_ps( sign, a ), _mm_and_ps( sign, b ) );
+   }
+
+   static BLAZE_ALWAYS_INLINE __m128d widenLow ( __m128 a ) noexcept { return _mm_cvtps_pd( a ); }
+   static BLAZE_ALWAYS_INLINE __m128d widenHigh( __m128 a ) noexcept { return _mm_cvtps_pd( _mm_movehl_ps( a, a ) ); }
+
+   static BLAZE_ALWAYS_INLINE __m128 narrow( __m128d lo, __m128d hi ) noexcept {
+      return _mm_movelh_ps( _mm_cvtpd_ps( lo ), _mm_cvtpd_ps( hi ) );
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the BuiltinMathOps class template for \c __m128d.
+// \ingroup simd
+*/
+template<>
+struct BuiltinMathOps<double,2UL>
+{
+   using ValueType = double;
+   using MaskType  = __m128d;
+
+   static constexpr size_t size = 2UL;
+
+   static BLAZE_ALWAYS_INLINE __m128d set( double v ) noexcept { return _mm_set1_pd( v ); }
+   static BLAZE_ALWAYS_INLINE __m128d loadu( const double* p ) noexcept { return _mm_loadu_pd( p ); }
+   static BLAZE_ALWAYS_INLINE void storeu( double* p, __m128d a ) noexcept { _mm_storeu_pd( p, a ); }
+
+   static BLAZE_ALWAYS_INLINE __m128d add( __m128d a, __m128d b ) noexcept { return _mm_add_pd( a, b ); }
+   static BLAZE_ALWAYS_INLINE __m128d sub( __m128d a, __m128d b ) noexcept { return _mm_sub_pd( a, b ); }
+   static BLAZE_ALWAYS_INLINE __m128d mul( __m128d a, __m128d b ) noexcept { return _mm_mul_pd( a, b ); }
+   static BLAZE_ALWAYS_INLINE __m128d div( __m128d a, __m128d b ) noexcept { return _mm_div_pd( a, b ); }
+   static BLAZE_ALWAYS_INLINE __m128d min( __m128d a, __m128d b ) noexcept { return _mm_min_pd( a, b ); }
+   static BLAZE_ALWAYS_INLINE __m128d max( __m128d a, __m128d b ) noexcept { return _mm_max_pd( a, b ); }
+   static BLAZE_ALWAYS_INLINE __m128d abs( __m128d a ) noexcept { return _mm_andnot_pd( _mm_set1_pd( -0.0 ), a ); }
+
+#if BLAZE_FMA_MODE
+   static BLAZE_ALWAYS_INLINE __m128d fmadd( __m128d a, __m128d b, __m128d c ) noexcept { return _mm_fmadd_pd( a, b, c ); }
+#else
+   static BLAZE_ALWAYS_INLINE __m128d fmadd( __m128d a, __m128d b, __m128d c ) noexcept { return _mm_add_pd( _mm_mul_pd( a, b ), c ); }
+#endif
+
+   static BLAZE_ALWAYS_INLINE MaskType equal   ( __m128d a, __m128d b ) noexcept { return _mm_cmpeq_pd ( a, b ); }
+   static BLAZE_ALWAYS_INLINE MaskType notEqual( __m128d a, __m128d b ) noexcept { return _mm_cmpneq_pd( a, b ); }
+   static BLAZE_ALWAYS_INLINE MaskType less    ( __m128d a, __m128d b ) noexcept { return _mm_cmplt_pd ( a, b ); }
+   static BLAZE_ALWAYS_INLINE MaskType greater ( __m128d a, __m128d b ) noexcept { return _mm_cmpgt_pd ( a, b ); }
+   static BLAZE_ALWAYS_INLINE MaskType isnan   ( __m128d a ) noexcept { return _mm_cmpunord_pd( a, a ); }
+   static BLAZE_ALWAYS_INLINE bool     any     ( MaskType m ) noexcept { return _mm_movemask_pd( m ) != 0; }
+
+#if BLAZE_SSE4_MODE
+   static BLAZE_ALWAYS_INLINE __m128d select( MaskType m, __m128d a, __m128d b ) noexcept { return _mm_blendv_pd( b, a, m ); }
+#else
+   static BLAZE_ALWAYS_INLINE __m128d select( MaskType m, __m128d a, __m128d b ) noexcept { return _mm_or_pd( _mm_and_pd( m, a ), _mm_andnot_pd( m, b ) ); }
+#endif
+
+   static BLAZE_ALWAYS_INLINE __m128d pow2( __m128d k ) noexcept {
+      return _mm_castsi128_pd( _mm_slli_epi64( _mm_castpd_si128( _mm_add_pd( k, _mm_set1_pd( 6755399441056767.0 ) ) ), 52 ) );
+   }
+
+   static BLAZE_ALWAYS_INLINE __m128d exponent( __m128d a ) noexcept {
+      const __m128d magic( _mm_set1_pd( 4503599627370496.0 ) );
+      return _mm_sub_pd( _mm_or_pd( _mm_castsi128_pd( _mm_srli_epi64( _mm_castpd_si128( a ), 52 ) ), magic ), magic );
+   }
+
+   static BLAZE_ALWAYS_INLINE __m128d mantissa( __m128d a ) noexcept {
+      return _mm_or_pd( _mm_andnot_pd( set( std::numeric_limits<double>::infinity() ), a ), _mm_set1_pd( 0.5 ) );
+   }
+
+   static BLAZE_ALWAYS_INLINE __m128d copySign( __m128d a, __m128d b ) noexcept {
+      const __m128d sign( _mm_set1_pd( -0.0 ) );
+      return _mm_or_pd( _mm_andnot_pd( sign, a ), _mm_and_pd( sign, b ) );
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  AVX SPECIALIZATIONS
+//
+//=================================================================================================
+
+#if BLAZE_AVX_MODE
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the BuiltinMathOps class template for \c __m256.
+// \ingroup simd
+*/
+template<>
+struct BuiltinMathOps<float,8UL>
+{
+   using ValueType = float;
+   using MaskType  = __m256;
+
+   static constexpr size_t size = 8UL;
+
+   static BLAZE_ALWAYS_INLINE __m256 set( float v ) noexcept { return _mm256_set1_ps( v ); }
+   static BLAZE_ALWAYS_INLINE __m256 loadu( const float* p ) noexcept { return _mm256_loadu_ps( p ); }
+   static BLAZE_ALWAYS_INLINE void storeu( float* p, __m256 a ) noexcept { _mm256_storeu_ps( p, a ); }
+
+   static BLAZE_ALWAYS_INLINE __m256 add( __m256 a, __m256 b ) noexcept { return _mm256_add_ps( a, b ); }
+   static BLAZE_ALWAYS_INLINE __m256 sub( __m256 a, __m256 b ) noexcept { return _mm256_sub_ps( a, b ); }
+   static BLAZE_ALWAYS_INLINE __m256 mul( __m256 a, __m256 b ) noexcept { return _mm256_mul_ps( a, b ); }
+   static BLAZE_ALWAYS_INLINE __m256 div( __m256 a, __m256 b ) noexcept { return _mm256_div_ps( a, b ); }
+   static BLAZE_ALWAYS_INLINE __m256 min( __m256 a, __m256 b ) noexcept { return _mm256_min_ps( a, b ); }
+   static BLAZE_ALWAYS_INLINE __m256 max( __m256 a, __m256 b ) noexcept { return _mm256_max_ps( a, b ); }
+   static BLAZE_ALWAYS_INLINE __m256 abs( __m256 a ) noexcept { return _mm256_andnot_ps( _mm256_set1_ps( -0.0F ), a ); }
+
+#if BLAZE_FMA_MODE
+   static BLAZE_ALWAYS_INLINE __m256 fmadd( __m256 a, __m256 b, __m256 c ) noexcept { return _mm256_fmadd_ps( a, b, c ); }
+#else
+   static BLAZE_ALWAYS_INLINE __m256 fmadd( __m256 a, __m256 b, __m256 c ) noexcept { return _mm256_add_ps( _mm256_mul_ps( a, b ), c ); }
+#endif
+
+   static BLAZE_ALWAYS_INLINE MaskType equal   ( __m256 a, __m256 b ) noexcept { return _mm256_cmp_ps( a, b, _CMP_EQ_OQ  ); }
+   static BLAZE_ALWAYS_INLINE MaskType notEqual( __m256 a, __m256 b ) noexcept { return _mm256_cmp_ps( a, b, _CMP_NEQ_UQ ); }
+   static BLAZE_ALWAYS_INLINE MaskType less    ( __m256 a, __m256 b ) noexcept { return _mm256_cmp_ps( a, b, _CMP_LT_OQ  ); }
+   static BLAZE_ALWAYS_INLINE MaskType greater ( __m256 a, __m256 b ) noexcept { return _mm256_cmp_ps( a, b, _CMP_GT_OQ  ); }
+   static BLAZE_ALWAYS_INLINE MaskType isnan   ( __m256 a ) noexcept { return _mm256_cmp_ps( a, a, _CMP_UNORD_Q ); }
+   static BLAZE_ALWAYS_INLINE bool     any     ( MaskType m ) noexcept { return _mm256_movemask_ps( m ) != 0; }
+
+   static BLAZE_ALWAYS_INLINE __m256 select( MaskType m, __m256 a, __m256 b ) noexcept { return _mm256_blendv_ps( b, a, m ); }
+
+   static BLAZE_ALWAYS_INLINE __m256 pow2( __m256 k ) noexcept {
+      return shiftLeft<23>( _mm256_add_ps( k, _mm256_set1_ps( 12583039.0F ) ) );
+   }
+
+   static BLAZE_ALWAYS_INLINE __m256 exponent( __m256 a ) noexcept {
+      const __m256 magic( _mm256_set1_ps( 8388608.0F ) );
+      return _mm256_sub_ps( _mm256_or_ps( shiftRight<23>( a ), magic ), magic );
+   }
+
+   static BLAZE_ALWAYS_INLINE __m256 mantissa( __m256 a ) noexcept {
+      return _mm256_or_ps( _mm256_andnot_ps( set( std::numeric_limits<float>::infinity() ), a ), _mm256_set1_ps( 0.5F ) );
+   }
+
+   static BLAZE_ALWAYS_INLINE __m256 copySign( __m256 a, __m256 b ) noexcept {
+      const __m256 sign( _mm256_set1_ps( -0.0F ) );
+      return _mm256_or_ps( _mm256_andnot_ps( sign, a ), _mm256_and_ps( sign, b ) );
+   }
+
+   static BLAZE_ALWAYS_INLINE __m256d widenLow ( __m256 a ) noexcept { return _mm256_cvtps_pd( _mm256_castps256_ps128( a ) ); }
+   static BLAZE_ALWAYS_INLINE __m256d widenHigh( __m256 a ) noexcept { return _mm256_cvtps_pd( _mm256_extractf128_ps( a, 1 ) ); }
+
+   static BLAZE_ALWAYS_INLINE __m256 narrow( __m256d lo, __m256d hi ) noexcept {
+      return _mm256_insertf128_ps( _mm256_castps128_ps256( _mm256_cvtpd_ps( lo ) ), _mm256_cvtpd_ps( hi ), 1 );
+   }
+
+ private:
+   template< int N >
+   static BLAZE_ALWAYS_INLINE __m256 shiftLeft( __m256 a ) noexcept {
+#if BLAZE_AVX2_MODE
+      return _mm256_castsi256_ps( _mm256_slli_epi32( _mm256_castps_si256( a ), N ) );
+#else
+      const __m128i lo( _mm_slli_epi32( _mm_castps_si128( _mm256_castps256_ps128( a ) ), N ) );
+      const __m128i hi( _mm_slli_epi32( _mm_castps_si128( _mm256_extractf128_ps( a, 1 ) ), N ) );
+      return _mm256_insertf128_ps( _mm256_castps128_ps256( _mm_castsi128_ps( lo ) ), _mm_castsi128_ps( hi ), 1 );
+#endif
+   }
+
+   template< int N >
+   static BLAZE_ALWAYS_INLINE __m256 shiftRight( __m256 a ) noexcept {
+#if BLAZE_AVX2_MODE
+      return _mm256_castsi256_ps( _mm256_srli_epi32( _mm256_castps_si256( a ), N ) );
+#else
+      const __m128i lo( _mm_srli_epi32( _mm_castps_si128( _mm256_castps256_ps128( a ) ), N ) );
+      const __m128i hi( _mm_srli_epi32( _mm_castps_si128( _mm256_extractf128_ps( a, 1 ) ), N ) );
+      return _mm256_insertf128_ps( _mm256_castps128_ps256( _mm_castsi128_ps( lo ) ), _mm_castsi128_ps( hi ), 1 );
+#endif
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the BuiltinMathOps class template for \c __m256d.
+// \ingroup simd
+*/
+template<>
+struct BuiltinMathOps<double,4UL>
+{
+   using ValueType = double;
+   using MaskType  = __m256d;
+
+   static constexpr size_t size = 4UL;
+
+   static BLAZE_ALWAYS_INLINE __m256d set( double v ) noexcept { return _mm256_set1_pd( v ); }
+   static BLAZE_ALWAYS_INLINE __m256d loadu( const double* p ) noexcept { return _mm256_loadu_pd( p ); }
+   static BLAZE_ALWAYS_INLINE void storeu( double* p, __m256d a ) noexcept { _mm256_storeu_pd( p, a ); }
+
+   static BLAZE_ALWAYS_INLINE __m256d add( __m256d a, __m256d b ) noexcept { return _mm256_add_pd( a, b ); }
+   static BLAZE_ALWAYS_INLINE __m256d sub( __m256d a, __m256d b ) noexcept { return _mm256_sub_pd( a, b ); }
+   static BLAZE_ALWAYS_INLINE __m256d mul( __m256d a, __m256d b ) noexcept { return _mm256_mul_pd( a, b ); }
+   static BLAZE_ALWAYS_INLINE __m256d div( __m256d a, __m256d b ) noexcept { return _mm256_div_pd( a, b ); }
+   static BLAZE_ALWAYS_INLINE __m256d min( __m256d a, __m256d b ) noexcept { return _mm256_min_pd( a, b ); }
+   static BLAZE_ALWAYS_INLINE __m256d max( __m256d a, __m256d b ) noexcept { return _mm256_max_pd( a, b ); }
+   static BLAZE_ALWAYS_INLINE __m256d abs( __m256d a ) noexcept { return _mm256_andnot_pd( _mm256_set1_pd( -0.0 ), a ); }
+
+#if BLAZE_FMA_MODE
+   static BLAZE_ALWAYS_INLINE __m256d fmadd( __m256d a, __m256d b, __m256d c ) noexcept { return _mm256_fmadd_pd( a, b, c ); }
+#else
+   static BLAZE_ALWAYS_INLINE __m256d fmadd( __m256d a, __m256d b, __m256d c ) noexcept { return _mm256_add_pd( _mm256_mul_pd( a, b ), c ); }
+#endif
+
+   static BLAZE_ALWAYS_INLINE MaskType equal   ( __m256d a, __m256d b ) noexcept { return _mm256_cmp_pd( a, b, _CMP_EQ_OQ  ); }
+   static BLAZE_ALWAYS_INLINE MaskType notEqual( __m256d a, __m256d b ) noexcept { return _mm256_cmp_pd( a, b, _CMP_NEQ_UQ ); }
+   static BLAZE_ALWAYS_INLINE MaskType less    ( __m256d a, __m256d b ) noexcept { return _mm256_cmp_pd( a, b, _CMP_LT_OQ  ); }
+   static BLAZE_ALWAYS_INLINE MaskType greater ( __m256d a, __m256d b ) noexcept { return _mm256_cmp_pd( a, b, _CMP_GT_OQ  ); }
+   static BLAZE_ALWAYS_INLINE MaskType isnan   ( __m256d a ) noexcept { return _mm256_cmp_pd( a, a, _CMP_UNORD_Q ); }
+   static BLAZE_ALWAYS_INLINE bool     any     ( MaskType m ) noexcept { return _mm256_movemask_pd( m ) != 0; }
+
+   static BLAZE_ALWAYS_INLINE __m256d select( MaskType m, __m256d a, __m256d b ) noexcept { return _mm256_blendv_pd( b, a, m ); }
+
+   static BLAZE_ALWAYS_INLINE __m256d pow2( __m256d k ) noexcept {
+      return shiftLeft<52>( _mm256_add_pd( k, _mm256_set1_pd( 6755399441056767.0 ) ) );
+   }
+
+   static BLAZE_ALWAYS_INLINE __m256d exponent( __m256d a ) noexcept {
+      const __m256d magic( _mm256_set1_pd( 4503599627370496.0 ) );
+      return _mm256_sub_pd( _mm256_or_pd( shiftRight<52>( a ), magic ), magic );
+   }
+
+   static BLAZE_ALWAYS_INLINE __m256d mantissa( __m256d a ) noexcept {
+      return _mm256_or_pd( _mm256_andnot_pd( set( std::numeric_limits<double>::infinity() ), a ), _mm256_set1_pd( 0.5 ) );
+   }
+
+   static BLAZE_ALWAYS_INLINE __m256d copySign( __m256d a, __m256d b ) noexcept {
+      const __m256d sign( _mm256_set1_pd( -0.0 ) );
+      return _mm256_or_pd( _mm256_andnot_pd( sign, a ), _mm256_and_pd( sign, b ) );
+   }
+
+ private:
+   template< int N >
+   static BLAZE_ALWAYS_INLINE __m256d shiftLeft( __m256d a ) noexcept {
+#if BLAZE_AVX2_MODE
+      return _mm256_castsi256_pd( _mm256_slli_epi64( _mm256_castpd_si256( a ), N ) );
+#else
+      const __m128i lo( _mm_slli_epi64( _mm_castpd_si128( _mm256_castpd256_pd128( a ) ), N ) );
+      const __m128i hi( _mm_slli_epi64( _mm_castpd_si128( _mm256_extractf128_pd( a, 1 ) ), N ) );
+      return _mm256_insertf128_pd( _mm256_castpd128_pd256( _mm_castsi128_pd( lo ) ), _mm_castsi128_pd( hi ), 1 );
+#endif
+   }
+
+   template< int N >
+   static BLAZE_ALWAYS_INLINE __m256d shiftRight( __m256d a ) noexcept {
+#if BLAZE_AVX2_MODE
+      return _mm256_castsi256_pd( _mm256_srli_epi64( _mm256_castpd_si256( a ), N ) );
+#else
+      const __m128i lo( _mm_srli_epi64( _mm_castpd_si128( _mm256_castpd256_pd128( a ) ), N ) );
+      const __m128i hi( _mm_srli_epi64( _mm_castpd_si128( _mm256_extractf128_pd( a, 1 ) ), N ) );
+      return _mm256_insertf128_pd( _mm256_castpd128_pd256( _mm_castsi128_pd( lo ) ), _mm_castsi128_pd( hi ), 1 );
+#endif
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+#endif
+
+
+
+
+//=================================================================================================
+//
+//  AVX-512 SPECIALIZATIONS
+//
+//=================================================================================================
+
+#if BLAZE_AVX512F_MODE
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the BuiltinMathOps class template for \c __m512.
+// \ingroup simd
+*/
+template<>
+struct BuiltinMathOps<float,16UL>
+{
+   using ValueType = float;
+   using MaskType  = __mmask16;
+
+   static constexpr size_t size = 16UL;
+
+   static BLAZE_ALWAYS_INLINE __m512 set( float v ) noexcept { return _mm512_set1_ps( v ); }
+   static BLAZE_ALWAYS_INLINE __m512 loadu( const float* p ) noexcept { return _mm512_loadu_ps( p ); }
+   static BLAZE_ALWAYS_INLINE void storeu( float* p, __m512 a ) noexcept { _mm512_storeu_ps( p, a ); }
+
+   static BLAZE_ALWAYS_INLINE __m512 add( __m512 a, __m512 b ) noexcept { return _mm512_add_ps( a, b ); }
+   static BLAZE_ALWAYS_INLINE __m512 sub( __m512 a, __m512 b ) noexcept { return _mm512_sub_ps( a, b ); }
+   static BLAZE_ALWAYS_INLINE __m512 mul( __m512 a, __m512 b ) noexcept { return _mm512_mul_ps( a, b ); }
+   static BLAZE_ALWAYS_INLINE __m512 div( __m512 a, __m512 b ) noexcept { return _mm512_div_ps( a, b ); }
+   static BLAZE_ALWAYS_INLINE __m512 min( __m512 a, __m512 b ) noexcept { return _mm512_min_ps( a, b ); }
+   static BLAZE_ALWAYS_INLINE __m512 max( __m512 a, __m512 b ) noexcept { return _mm512_max_ps( a, b ); }
+   static BLAZE_ALWAYS_INLINE __m512 abs( __m512 a ) noexcept { return _mm512_abs_ps( a ); }
+
+   static BLAZE_ALWAYS_INLINE __m512 fmadd( __m512 a, __m512 b, __m512 c ) noexcept { return _mm512_fmadd_ps( a, b, c ); }
+
+   static BLAZE_ALWAYS_INLINE MaskType equal   ( __m512 a, __m512 b ) noexcept { return _mm512_cmp_ps_mask( a, b, _CMP_EQ_OQ  ); }
+   static BLAZE_ALWAYS_INLINE MaskType notEqual( __m512 a, __m512 b ) noexcept { return _mm512_cmp_ps_mask( a, b, _CMP_NEQ_UQ ); }
+   static BLAZE_ALWAYS_INLINE MaskType less    ( __m512 a, __m512 b ) noexcept { return _mm512_cmp_ps_mask( a, b, _CMP_LT_OQ  ); }
+   static BLAZE_ALWAYS_INLINE MaskType greater ( __m512 a, __m512 b ) noexcept { return _mm512_cmp_ps_mask( a, b, _CMP_GT_OQ  ); }
+   static BLAZE_ALWAYS_INLINE MaskType isnan   ( __m512 a ) noexcept { return _mm512_cmp_ps_mask( a, a, _CMP_UNORD_Q ); }
+   static BLAZE_ALWAYS_INLINE bool     any     ( MaskType m ) noexcept { return m != 0; }
+
+   static BLAZE_ALWAYS_INLINE __m512 select( MaskType m, __m512 a, __m512 b ) noexcept { return _mm512_mask_blend_ps( m, b, a ); }
+
+   static BLAZE_ALWAYS_INLINE __m512 pow2( __m512 k ) noexcept {
+      return _mm512_castsi512_ps( _mm512_slli_epi32( _mm512_castps_si512( _mm512_add_ps( k, _mm512_set1_ps( 12583039.0F ) ) ), 23 ) );
+   }
+
+   static BLAZE_ALWAYS_INLINE __m512 exponent( __m512 a ) noexcept {
+      const __m512 magic( _mm512_set1_ps( 8388608.0F ) );
+      const __m512i bits( _mm512_srli_epi32( _mm512_castps_si512( a ), 23 ) );
+      return _mm512_sub_ps( _mm512_castsi512_ps( _mm512_or_si512( bits, _mm512_castps_si512( magic ) ) ), magic );
+   }
+
+   static BLAZE_ALWAYS_INLINE __m512 mantissa( __m512 a ) noexcept {
+      const __m512i inf ( _mm512_castps_si512( set( std::numeric_limits<float>::infinity() ) ) );
+      const __m512i half( _mm512_castps_si512( _mm512_set1_ps( 0.5F ) ) );
+      return _mm512_castsi512_ps( _mm512_or_si512( _mm512_andnot_si512( inf, _mm512_castps_si512( a ) ), half ) );
+   }
+
+   static BLAZE_ALWAYS_INLINE __m512 copySign( __m512 a, __m512 b ) noexcept {
+      const __m512i sign( _mm512_castps_si512( _mm512_set1_ps( -0.0F ) ) );
+      return _mm512_castsi512_ps( _mm512_or_si512( _mm512_andnot_si512( sign, _mm512_castps_si512( a ) ),
+                                                   _mm512_and_si512( sign, _mm512_castps_si512( b ) ) ) );
+   }
+
+   static BLAZE_ALWAYS_INLINE __m512d widenLow ( __m512 a ) noexcept { return _mm512_cvtps_pd( _mm512_castps512_ps256( a ) ); }
+   static BLAZE_ALWAYS_INLINE __m512d widenHigh( __m512 a ) noexcept {
+      return _mm512_cvtps_pd( _mm256_castpd_ps( _mm512_extractf64x4_pd( _mm512_castps_pd( a ), 1 ) ) );
+   }
+
+   static BLAZE_ALWAYS_INLINE __m512 narrow( __m512d lo, __m512d hi ) noexcept {
+      const __m512d tmp( _mm512_castps_pd( _mm512_castps256_ps512( _mm512_cvtpd_ps( lo ) ) ) );
+      return _mm512_castpd_ps( _mm512_insertf64x4( tmp, _mm256_castps_pd( _mm512_cvtpd_ps( hi ) ), 1 ) );
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the BuiltinMathOps class template for \c __m512d.
+// \ingroup simd
+*/
+template<>
+struct BuiltinMathOps<double,8UL>
+{
+   using ValueType = double;
+   using MaskType  = __mmask8;
+
+   static constexpr size_t size = 8UL;
+
+   static BLAZE_ALWAYS_INLINE __m512d set( double v ) noexcept { return _mm512_set1_pd( v ); }
+   static BLAZE_ALWAYS_INLINE __m512d loadu( const double* p ) noexcept { return _mm512_loadu_pd( p ); }
+   static BLAZE_ALWAYS_INLINE void storeu( double* p, __m512d a ) noexcept { _mm512_storeu_pd( p, a ); }
+
+   static BLAZE_ALWAYS_INLINE __m512d add( __m512d a, __m512d b ) noexcept { return _mm512_add_pd( a, b ); }
+   static BLAZE_ALWAYS_INLINE __m512d sub( __m512d a, __m512d b ) noexcept { return _mm512_sub_pd( a, b ); }
+   static BLAZE_ALWAYS_INLINE __m512d mul( __m512d a, __m512d b ) noexcept { return _mm512_mul_pd( a, b ); }
+   static BLAZE_ALWAYS_INLINE __m512d div( __m512d a, __m512d b ) noexcept { return _mm512_div_pd( a, b ); }
+   static BLAZE_ALWAYS_INLINE __m512d min( __m512d a, __m512d b ) noexcept { return _mm512_min_pd( a, b ); }
+   static BLAZE_ALWAYS_INLINE __m512d max( __m512d a, __m512d b ) noexcept { return _mm512_max_pd( a, b ); }
+   static BLAZE_ALWAYS_INLINE __m512d abs( __m512d a ) noexcept { return _mm512_abs_pd( a ); }
+
+   static BLAZE_ALWAYS_INLINE __m512d fmadd( __m512d a, __m512d b, __m512d c ) noexcept { return _mm512_fmadd_pd( a, b, c ); }
+
+   static BLAZE_ALWAYS_INLINE MaskType equal   ( __m512d a, __m512d b ) noexcept { return _mm512_cmp_pd_mask( a, b, _CMP_EQ_OQ  ); }
+   static BLAZE_ALWAYS_INLINE MaskType notEqual( __m512d a, __m512d b ) noexcept { return _mm512_cmp_pd_mask( a, b, _CMP_NEQ_UQ ); }
+   static BLAZE_ALWAYS_INLINE MaskType less    ( __m512d a, __m512d b ) noexcept { return _mm512_cmp_pd_mask( a, b, _CMP_LT_OQ  ); }
+   static BLAZE_ALWAYS_INLINE MaskType greater ( __m512d a, __m512d b ) noexcept { return _mm512_cmp_pd_mask( a, b, _CMP_GT_OQ  ); }
+   static BLAZE_ALWAYS_INLINE MaskType isnan   ( __m512d a ) noexcept { return _mm512_cmp_pd_mask( a, a, _CMP_UNORD_Q ); }
+   static BLAZE_ALWAYS_INLINE bool     any     ( MaskType m ) noexcept { return m != 0; }
+
+   static BLAZE_ALWAYS_INLINE __m512d select( MaskType m, __m512d a, __m512d b ) noexcept { return _mm512_mask_blend_pd( m, b, a ); }
+
+   static BLAZE_ALWAYS_INLINE __m512d pow2( __m512d k ) noexcept {
+      return _mm512_castsi512_pd( _mm512_slli_epi64( _mm512_castpd_si512( _mm512_add_pd( k, _mm512_set1_pd( 6755399441056767.0 ) ) ), 52 ) );
+   }
+
+   static BLAZE_ALWAYS_INLINE __m512d exponent( __m512d a ) noexcept {
+      const __m512d magic( _mm512_set1_pd( 4503599627370496.0 ) );
+      const __m512i bits( _mm512_srli_epi64( _mm512_castpd_si512( a ), 52 ) );
+      return _mm512_sub_pd( _mm512_castsi512_pd( _mm512_or_si512( bits, _mm512_castpd_si512( magic ) ) ), magic );
+   }
+
+   static BLAZE_ALWAYS_INLINE __m512d mantissa( __m512d a ) noexcept {
+      const __m512i inf ( _mm512_castpd_si512( set( std::numeric_limits<double>::infinity() ) ) );
+      const __m512i half( _mm512_castpd_si512( _mm512_set1_pd( 0.5 ) ) );
+      return _mm512_castsi512_pd( _mm512_or_si512( _mm512_andnot_si512( inf, _mm512_castpd_si512( a ) ), half ) );
+   }
+
+   static BLAZE_ALWAYS_INLINE __m512d copySign( __m512d a, __m512d b ) noexcept {
+      const __m512i sign( _mm512_castpd_si512( _mm512_set1_pd( -0.0 ) ) );
+      return _mm512_castsi512_pd( _mm512_or_si512( _mm512_andnot_si512( sign, _mm512_castpd_si512( a ) ),
+                                                   _mm512_and_si512( sign, _mm512_castpd_si512( b ) ) ) );
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+#endif
+
+
+
+
+//=================================================================================================
+//
+//  OPERAND TYPE MAPPING
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Declarations mapping the intrinsic floating point types to their BuiltinMathOps.
+// \ingroup simd
+//
+// These functions are never defined; they are only used in unevaluated contexts to select the
+// BuiltinMathOps specialization of an intrinsic type without naming the intrinsic type as a
+// template argument (which would drop its alignment and vector attributes).
+*/
+BuiltinMathOps<float,4UL>  builtinMathOps( __m128  );
+BuiltinMathOps<double,2UL> builtinMathOps( __m128d );
+#if BLAZE_AVX_MODE
+BuiltinMathOps<float,8UL>  builtinMathOps( __m256  );
+BuiltinMathOps<double,4UL> builtinMathOps( __m256d );
+#endif
+#if BLAZE_AVX512F_MODE
+BuiltinMathOps<float,16UL> builtinMathOps( __m512  );
+BuiltinMathOps<double,8UL> builtinMathOps( __m512d );
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary alias declaration for the BuiltinMathOps specialization of an intrinsic type.
+// \ingroup simd
+*/
+template< typename T >  // Type of the intrinsic operand
+using BuiltinMathOps_t = decltype( builtinMathOps( std::declval<T>() ) );
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Rounds the given SIMD vector to the nearest integral values.
+// \ingroup simd
+//
+// \param a The vector of floating point values (\f$ |a| < 2^{22} \f$ (float), \f$ 2^{51} \f$ (double)).
+// \return The vector of rounded values.
+//
+// The rounding adds and subtracts \f$ 1.5 \cdot 2^{p-1} \f$, which pushes all fractional bits out
+// of the mantissa and rounds to nearest-even in the default rounding mode.
+*/
+template< typename T >  // Type of the intrinsic operand
+BLAZE_ALWAYS_INLINE T builtinRound( T a ) noexcept
+{
+   using Ops = BuiltinMathOps_t<T>;
+   using ET  = typename Ops::ValueType;
+
+   const T magic( Ops::set( IsFloat_v<ET> ? ET( 12582912.0 ) : ET( 6755399441055744.0 ) ) );
+   return Ops::sub( Ops::add( a, magic ), magic );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scalar fallback for the built-in SIMD functions.
+// \ingroup simd
+//
+// \param a The vector of floating point values.
+// \param f The scalar function to be applied to each element.
+// \return The resulting vector.
+*/
+template< typename T    // Type of the intrinsic operand
+        , typename F >  // Type of the scalar function
+inline T builtinScalarFallback( T a, F f ) noexcept
+{
+   using Ops = BuiltinMathOps_t<T>;
+   using ET  = typename Ops::ValueType;
+
+   ET tmp[Ops::size];
+   Ops::storeu( tmp, a );
+   for( size_t i=0UL; i<Ops::size; ++i ) {
+      tmp[i] = f( tmp[i] );
+   }
+   return Ops::loadu( tmp );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPONENTIAL FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Built-in computation of \f$ e^x \f$ for a vector of double precision values.
+// \ingroup simd
+//
+// \param x The vector of double precision floating point values.
+// \return The resulting vector.
+//
+// The argument is reduced to \f$ x = n \ln 2 + r \f$ with \f$ |r| \leq \frac{1}{2} \ln 2 \f$
+// (Cody-Waite reduction) and \f$ e^r \f$ is approximated by a Pade form \f$ 1 + 2r P(r^2) /
+// (Q(r^2) - r P(r^2)) \f$ (Cephes). The maximum error is 2 ULP.
+*/
+template< typename T >  // Type of the intrinsic operand
+BLAZE_ALWAYS_INLINE EnableIf_t< IsDouble_v< typename BuiltinMathOps_t<T>::ValueType >, T >
+   builtinExp( T x ) noexcept
+{
+   using Ops = BuiltinMathOps_t<T>;
+
+   const T xc( Ops::min( Ops::max( x, Ops::set( -746.0 ) ), Ops::set( 710.0 ) ) );
+   const T n ( builtinRound( Ops::mul( xc, Ops::set( 1.4426950408889634073599 ) ) ) );
+
+   T r( Ops::fmadd( n, Ops::set( -6.93145751953125E-1 ), xc ) );
+   r = Ops::fmadd( n, Ops::set( -1.42860682030941723212E-6 ), r );
+
+   const T rr( Ops::mul( r, r ) );
+
+   T p( Ops::set( 1.26177193074810590878E-4 ) );
+   p = Ops::fmadd( p, rr, Ops::set( 3.02994407707441961300E-2 ) );
+   p = Ops::mul( Ops::fmadd( p, rr, Ops::set( 9.99999999999999999910E-1 ) ), r );
+
+   T q( Ops::set( 3.00198505138664455042E-6 ) );
+   q = Ops::fmadd( q, rr, Ops::set( 2.52448340349684104192E-3 ) );
+   q = Ops::fmadd( q, rr, Ops::set( 2.27265548208155028766E-1 ) );
+   q = Ops::fmadd( q, rr, Ops::set( 2.00000000000000000009E0 ) );
+
+   p = Ops::div( p, Ops::sub( q, p ) );
+   p = Ops::fmadd( p, Ops::set( 2.0 ), Ops::set( 1.0 ) );
+
+   const T n1( builtinRound( Ops::mul( n, Ops::set( 0.5 ) ) ) );
+   const T n2( Ops::sub( n, n1 ) );
+   const T y ( Ops::mul( Ops::mul( p, Ops::pow2( n1 ) ), Ops::pow2( n2 ) ) );
+
+   return Ops::select( Ops::isnan( x ), x, y );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Built-in computation of \f$ e^x \f$ for a vector of single precision values.
+// \ingroup simd
+//
+// \param x The vector of single precision floating point values.
+// \return The resulting vector.
+//
+// Both halves of the vector are converted to double precision and evaluated by the double
+// precision kernel. Overflow, underflow, and denormal results are produced by the final rounding
+// to single precision. The maximum error is 1 ULP.
+*/
+template< typename T >  // Type of the intrinsic operand
+BLAZE_ALWAYS_INLINE EnableIf_t< IsFloat_v< typename BuiltinMathOps_t<T>::ValueType >, T >
+   builtinExp( T x ) noexcept
+{
+   using Ops = BuiltinMathOps_t<T>;
+
+   return Ops::narrow( builtinExp( Ops::widenLow( x ) ), builtinExp( Ops::widenHigh( x ) ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  NATURAL LOGARITHM
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Handling of the special cases of the built-in logarithm.
+// \ingroup simd
+//
+// \param x The original arguments.
+// \param y The results of the logarithm for positive, finite arguments.
+// \return The results including all special cases (NaN, negative values, zero, and infinity).
+*/
+template< typename T >  // Type of the intrinsic operand
+BLAZE_ALWAYS_INLINE T builtinLogSpecialCases( T x, T y ) noexcept
+{
+   using Ops = BuiltinMathOps_t<T>;
+   using ET  = typename Ops::ValueType;
+
+   const T zero( Ops::set( ET(0) ) );
+   const T inf ( Ops::set( std::numeric_limits<ET>::infinity() ) );
+
+   y = Ops::select( Ops::equal( x, inf ), inf, y );
+   y = Ops::select( Ops::equal( x, zero ), Ops::sub( zero, inf ), y );
+   y = Ops::select( Ops::less( x, zero ), Ops::set( std::numeric_limits<ET>::quiet_NaN() ), y );
+   return Ops::select( Ops::isnan( x ), x, y );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Built-in computation of the natural logarithm for a vector of single precision values.
+// \ingroup simd
+//
+// \param x The vector of single precision floating point values.
+// \return The resulting vector.
+//
+// The argument is decomposed into \f$ x = m 2^e \f$ with \f$ \sqrt{1/2} \leq m < \sqrt{2} \f$
+// and \f$ \ln(m) \f$ is approximated by a degree 10 polynomial in \f$ m-1 \f$ (Cephes). Denormal
+// arguments are scaled into the normal range first. The maximum error is 1 ULP.
+*/
+template< typename T >  // Type of the intrinsic operand
+BLAZE_ALWAYS_INLINE EnableIf_t< IsFloat_v< typename BuiltinMathOps_t<T>::ValueType >, T >
+   builtinLog( T x ) noexcept
+{
+   using Ops = BuiltinMathOps_t<T>;
+
+   const auto denormal( Ops::less( x, Ops::set( std::numeric_limits<float>::min() ) ) );
+   const T xs( Ops::select( denormal, Ops::mul( x, Ops::set( 8388608.0F ) ), x ) );
+
+   T e( Ops::sub( Ops::exponent( xs ), Ops::select( denormal, Ops::set( 149.0F ), Ops::set( 126.0F ) ) ) );
+   T m( Ops::mantissa( xs ) );
+
+   const auto small( Ops::less( m, Ops::set( 0.707106781186547524F ) ) );
+   e = Ops::select( small, Ops::sub( e, Ops::set( 1.0F ) ), e );
+   m = Ops::select( small, Ops::add( m, m ), m );
+
+   const T f( Ops::sub( m, Ops::set( 1.0F ) ) );
+   const T z( Ops::mul( f, f ) );
+
+   T p( Ops::set( 7.0376836292E-2F ) );
+   p = Ops::fmadd( p, f, Ops::set( -1.1514610310E-1F ) );
+   p = Ops::fmadd( p, f, Ops::set(  1.1676998740E-1F ) );
+   p = Ops::fmadd( p, f, Ops::set( -1.2420140846E-1F ) );
+   p = Ops::fmadd( p, f, Ops::set(  1.4249322787E-1F ) );
+   p = Ops::fmadd( p, f, Ops::set( -1.6668057665E-1F ) );
+   p = Ops::fmadd( p, f, Ops::set(  2.0000714765E-1F ) );
+   p = Ops::fmadd( p, f, Ops::set( -2.4999993993E-1F ) );
+   p = Ops::fmadd( p, f, Ops::set(  3.3333331174E-1F ) );
+   p = Ops::mul( Ops::mul( p, f ), z );
+
+   p = Ops::fmadd( e, Ops::set( -2.12194440E-4F ), p );
+   p = Ops::fmadd( z, Ops::set( -0.5F ), p );
+
+   T y( Ops::add( f, p ) );
+   y = Ops::fmadd( e, Ops::set( 0.693359375F ), y );
+
+   return builtinLogSpecialCases( x, y );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Built-in computation of the natural logarithm for a vector of double precision values.
+// \ingroup simd
+//
+// \param x The vector of double precision floating point values.
+// \return The resulting vector.
+//
+// The argument is decomposed into \f$ x = m 2^e \f$ with \f$ \sqrt{1/2} \leq m < \sqrt{2} \f$
+// and \f$ \ln(m) \f$ is computed via \f$ s = (m-1)/(m+1) \f$ and a degree 14 polynomial in
+// \f$ s \f$ (fdlibm). Denormal arguments are scaled into the normal range first. The maximum
+// error is 1 ULP.
+*/
+template< typename T >  // Type of the intrinsic operand
+BLAZE_ALWAYS_INLINE EnableIf_t< IsDouble_v< typename BuiltinMathOps_t<T>::ValueType >, T >
+   builtinLog( T x ) noexcept
+{
+   using Ops = BuiltinMathOps_t<T>;
+
+   const auto denormal( Ops::less( x, Ops::set( std::numeric_limits<double>::min() ) ) );
+   const T xs( Ops::select( denormal, Ops::mul( x, Ops::set( 18014398509481984.0 ) ), x ) );
+
+   T e( Ops::sub( Ops::exponent( xs ), Ops::select( denormal, Ops::set( 1076.0 ), Ops::set( 1022.0 ) ) ) );
+   T m( Ops::mantissa( xs ) );
+
+   const auto small( Ops::less( m, Ops::set( 0.707106781186547524 ) ) );
+   e = Ops::select( small, Ops::sub( e, Ops::set( 1.0 ) ), e );
+   m = Ops::select( small, Ops::add( m, m ), m );
+
+   const T f( Ops::sub( m, Ops::set( 1.0 ) ) );
+   const T s( Ops::div( f, Ops::add( f, Ops::set( 2.0 ) ) ) );
+   const T z( Ops::mul( s, s ) );
+   const T w( Ops::mul( z, z ) );
+
+   T t1( Ops::set( 1.531383769920937332E-1 ) );
+   t1 = Ops::fmadd( t1, w, Ops::set( 2.222219843214978396E-1 ) );
+   t1 = Ops::fmadd( t1, w, Ops::set( 3.999999999940941908E-1 ) );
+   t1 = Ops::mul( t1, w );
+
+   T t2( Ops::set( 1.479819860511658591E-1 ) );
+   t2 = Ops::fmadd( t2, w, Ops::set( 1.818357216161805012E-1 ) );
+   t2 = Ops::fmadd( t2, w, Ops::set( 2.857142874366239149E-1 ) );
+   t2 = Ops::fmadd( t2, w, Ops::set( 6.666666666666735130E-1 ) );
+   t2 = Ops::mul( t2, z );
+
+   const T hfsq( Ops::mul( Ops::set( 0.5 ), Ops::mul( f, f ) ) );
+   const T R   ( Ops::add( t2, t1 ) );
+
+   T y( Ops::fmadd( s, Ops::add( hfsq, R ), Ops::mul( e, Ops::set( 1.90821492927058770002E-10 ) ) ) );
+   y = Ops::sub( Ops::sub( hfsq, y ), f );
+   y = Ops::sub( Ops::mul( e, Ops::set( 6.93147180369123816490E-1 ) ), y );
+
+   return builtinLogSpecialCases( x, y );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SINE AND COSINE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Built-in sine/cosine kernel for a vector of double precision values.
+// \ingroup simd
+//
+// \param x The vector of reduced arguments \f$ |x| \leq \pi/4 \f$.
+// \param n The quadrant offsets \f$ n \f$ of the original arguments \f$ x + n \pi/2 \f$.
+// \return The resulting vector \f$ \sin( x + n \pi/2 ) \f$.
+*/
+template< typename T >  // Type of the intrinsic operand
+BLAZE_ALWAYS_INLINE T builtinSinKernel( T x, T n ) noexcept
+{
+   using Ops = BuiltinMathOps_t<T>;
+
+   const T z( Ops::mul( x, x ) );
+
+   T s( Ops::set( 1.58962301576546568060E-10 ) );
+   s = Ops::fmadd( s, z, Ops::set( -2.50507477628578072866E-8 ) );
+   s = Ops::fmadd( s, z, Ops::set(  2.75573136213857245213E-6 ) );
+   s = Ops::fmadd( s, z, Ops::set( -1.98412698295895385996E-4 ) );
+   s = Ops::fmadd( s, z, Ops::set(  8.33333333332211858878E-3 ) );
+   s = Ops::fmadd( s, z, Ops::set( -1.66666666666666307295E-1 ) );
+   s = Ops::fmadd( Ops::mul( s, z ), x, x );
+
+   T c( Ops::set( -1.13585365213876817300E-11 ) );
+   c = Ops::fmadd( c, z, Ops::set(  2.08757008419747316778E-9 ) );
+   c = Ops::fmadd( c, z, Ops::set( -2.75573141792967388112E-7 ) );
+   c = Ops::fmadd( c, z, Ops::set(  2.48015872888517045348E-5 ) );
+   c = Ops::fmadd( c, z, Ops::set( -1.38888888888730564116E-3 ) );
+   c = Ops::fmadd( c, z, Ops::set(  4.16666666666665929218E-2 ) );
+   c = Ops::fmadd( Ops::mul( c, z ), z, Ops::fmadd( z, Ops::set( -0.5 ), Ops::set( 1.0 ) ) );
+
+   const T h( Ops::mul( n, Ops::set( 0.5 ) ) );
+   const T q( Ops::mul( n, Ops::set( 0.25 ) ) );
+   const T f( Ops::sub( q, builtinRound( Ops::sub( q, Ops::set( 0.375 ) ) ) ) );
+
+   const T y( Ops::select( Ops::notEqual( h, builtinRound( h ) ), c, s ) );
+   return Ops::select( Ops::greater( f, Ops::set( 0.375 ) ), Ops::sub( Ops::set( 0.0 ), y ), y );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Built-in computation of \f$ \sin( x + k \pi/2 ) \f$ for a vector of double precision values.
+// \ingroup simd
+//
+// \param x The vector of double precision floating point values.
+// \param k The quadrant offset (0 for the sine, 1 for the cosine).
+// \return The resulting vector.
+//
+// The argument is reduced to \f$ x = n \pi/2 + r \f$ with \f$ |r| \leq \pi/4 \f$ by means of
+// a three-part Cody-Waite reduction and the result is evaluated by the sine or cosine polynomial
+// (Cephes), depending on the quadrant. Since the reduction loses accuracy for large arguments,
+// vectors containing finite arguments beyond \f$ 2^{20} \f$ are handled by the scalar functions.
+// The sine of \f$ \pm 0 \f$ is \f$ \pm 0 \f$. The maximum error is 2 ULP.
+*/
+template< typename T >  // Type of the intrinsic operand
+BLAZE_ALWAYS_INLINE EnableIf_t< IsDouble_v< typename BuiltinMathOps_t<T>::ValueType >, T >
+   builtinSinCos( T x, int k ) noexcept
+{
+   using Ops = BuiltinMathOps_t<T>;
+
+   const T ax( Ops::abs( x ) );
+   const T inf( Ops::set( std::numeric_limits<double>::infinity() ) );
+
+   if( Ops::any( Ops::greater( Ops::select( Ops::equal( ax, inf ), Ops::set( 0.0 ), ax ), Ops::set( 1048576.0 ) ) ) ) {
+      return ( k == 0 )
+             ? builtinScalarFallback( x, []( double a ){ return std::sin( a ); } )
+             : builtinScalarFallback( x, []( double a ){ return std::cos( a ); } );
+   }
+
+   const T n( builtinRound( Ops::mul( x, Ops::set( 0.636619772367581343075535 ) ) ) );
+
+   T r( Ops::fmadd( n, Ops::set( -1.57079625129699707031E0 ), x ) );
+   r = Ops::fmadd( n, Ops::set( -7.54978941586159635336E-8 ), r );
+   r = Ops::fmadd( n, Ops::set( -5.39030285815811905290E-15 ), r );
+
+   const T y( builtinSinKernel( r, Ops::add( n, Ops::set( double( k ) ) ) ) );
+
+   return ( k == 0 ) ? Ops::select( Ops::equal( x, Ops::set( 0.0 ) ), x, y ) : y;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Built-in computation of \f$ \sin( x + k \pi/2 ) \f$ for a vector of single precision values.
+// \ingroup simd
+//
+// \param x The vector of single precision floating point values.
+// \param k The quadrant offset (0 for the sine, 1 for the cosine).
+// \return The resulting vector.
+//
+// Both halves of the vector are converted to double precision and evaluated by the double
+// precision kernel. In contrast to a single precision reduction, the error is dominated by the
+// final rounding to single precision. The maximum error is 1 ULP.
+*/
+template< typename T >  // Type of the intrinsic operand
+BLAZE_ALWAYS_INLINE EnableIf_t< IsFloat_v< typename BuiltinMathOps_t<T>::ValueType >, T >
+   builtinSinCos( T x, int k ) noexcept
+{
+   using Ops = BuiltinMathOps_t<T>;
+
+   return Ops::narrow( builtinSinCos( Ops::widenLow( x ), k ), builtinSinCos( Ops::widenHigh( x ), k ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  HYPERBOLIC TANGENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Built-in computation of the hyperbolic tangent for a vector of single precision values.
+// \ingroup simd
+//
+// \param x The vector of single precision floating point values.
+// \return The resulting vector.
+//
+// For \f$ |x| < 0.625 \f$ the hyperbolic tangent is approximated by an odd polynomial (Cephes),
+// otherwise it is computed via \f$ 1 - 2 / ( e^{2|x|} + 1 ) \f$. The sign of the argument (including
+// the sign of zero) is restored via the sign bit. The maximum error is 2 ULP.
+*/
+template< typename T >  // Type of the intrinsic operand
+BLAZE_ALWAYS_INLINE EnableIf_t< IsFloat_v< typename BuiltinMathOps_t<T>::ValueType >, T >
+   builtinTanh( T x ) noexcept
+{
+   using Ops = BuiltinMathOps_t<T>;
+
+   const T ax( Ops::abs( x ) );
+   const T z ( Ops::mul( x, x ) );
+
+   T p( Ops::set( -5.70498872745E-3F ) );
+   p = Ops::fmadd( p, z, Ops::set(  2.06390887954E-2F ) );
+   p = Ops::fmadd( p, z, Ops::set( -5.37397155531E-2F ) );
+   p = Ops::fmadd( p, z, Ops::set(  1.33314422036E-1F ) );
+   p = Ops::fmadd( p, z, Ops::set( -3.33332819422E-1F ) );
+   p = Ops::fmadd( Ops::mul( p, z ), x, x );
+
+   const T one( Ops::set( 1.0F ) );
+   const T e  ( builtinExp( Ops::add( ax, ax ) ) );
+
+   const T y( Ops::sub( one, Ops::div( Ops::set( 2.0F ), Ops::add( e, one ) ) ) );
+
+   return Ops::copySign( Ops::select( Ops::less( ax, Ops::set( 0.625F ) ), p, y ), x );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Built-in computation of the hyperbolic tangent for a vector of double precision values.
+// \ingroup simd
+//
+// \param x The vector of double precision floating point values.
+// \return The resulting vector.
+//
+// For \f$ |x| < 0.625 \f$ the hyperbolic tangent is approximated by the rational function
+// \f$ x + x z P(z)/Q(z) \f$ with \f$ z = x^2 \f$ (Cephes), otherwise it is computed via
+// \f$ 1 - 2 / ( e^{2|x|} + 1 ) \f$. The sign of the argument (including the sign of zero) is
+// restored via the sign bit. The maximum error is 2 ULP.
+*/
+template< typename T >  // Type of the intrinsic operand
+BLAZE_ALWAYS_INLINE EnableIf_t< IsDouble_v< typename BuiltinMathOps_t<T>::ValueType >, T >
+   builtinTanh( T x ) noexcept
+{
+   using Ops = BuiltinMathOps_t<T>;
+
+   const T ax( Ops::abs( x ) );
+   const T z ( Ops::mul( x, x ) );
+
+   T p( Ops::set( -9.64399179425052238628E-1 ) );
+   p = Ops::fmadd( p, z, Ops::set( -9.92877231001918586564E1 ) );
+   p = Ops::fmadd( p, z, Ops::set( -1.61468768441708447952E3 ) );
+
+   T q( Ops::add( z, Ops::set( 1.12811678491632931402E2 ) ) );
+   q = Ops::fmadd( q, z, Ops::set( 2.23548839060100448583E3 ) );
+   q = Ops::fmadd( q, z, Ops::set( 4.84406305325125486048E3 ) );
+
+   p = Ops::fmadd( Ops::mul( x, z ), Ops::div( p, q ), x );
+
+   const T one( Ops::set( 1.0 ) );
+   const T e  ( builtinExp( Ops::add( ax, ax ) ) );
+
+   const T y( Ops::sub( one, Ops::div( Ops::set( 2.0 ), Ops::add( e, one ) ) ) );
+
+   return Ops::copySign( Ops::select( Ops::less( ax, Ops::set( 0.625 ) ), p, y ), x );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+#endif
+
+} // namespace blaze
+
+#endif
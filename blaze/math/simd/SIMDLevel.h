@@ -0,0 +1,195 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/simd/SIMDLevel.h
+//  \brief Header file for the runtime detection of the available SIMD instruction sets
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SIMD_SIMDLEVEL_H_
+#define _BLAZE_MATH_SIMD_SIMDLEVEL_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/system/Vectorization.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  SIMD LEVELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief SIMD instruction set levels.
+// \ingroup simd
+//
+// The SIMDLevel enumeration lists the SIMD instruction sets that are distinguished by the
+// runtime CPU dispatch (see the BLAZE_USE_CPU_DISPATCH switch). The levels are ordered, i.e.
+// a higher level implies the availability of all lower levels.
+*/
+enum SIMDLevel
+{
+   noSIMD     = 0,  //!< No SIMD instruction set.
+   simdSSE2   = 1,  //!< SSE2.
+   simdAVX    = 2,  //!< AVX.
+   simdAVX2   = 3,  //!< AVX2 in combination with FMA.
+   simdAVX512 = 4   //!< AVX-512 (foundation).
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The SIMD level selected at compile time.
+// \ingroup simd
+//
+// This constant represents the highest SIMD level that is used by the kernels compiled for
+// the instruction set selected at compile time (see the BLAZE_SSE2_MODE, BLAZE_AVX_MODE,
+// BLAZE_AVX2_MODE, BLAZE_FMA_MODE, and BLAZE_AVX512F_MODE compilation switches).
+*/
+constexpr SIMDLevel compiledSIMDLevel =
+   ( BLAZE_AVX512F_MODE ? simdAVX512
+   : ( BLAZE_AVX2_MODE && BLAZE_FMA_MODE ) ? simdAVX2
+   : BLAZE_AVX_MODE ? simdAVX
+   : BLAZE_SSE2_MODE ? simdSSE2
+   : noSIMD );
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SIMD LEVEL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Detects the highest SIMD level supported by the executing CPU.
+// \ingroup simd
+//
+// \return The highest SIMD level supported by the CPU and the operating system.
+//
+// This function queries the capabilities of the executing CPU via \c cpuid. Note that the
+// detection is only available for the GNU and Clang compilers on x86 platforms. For all
+// other configurations the function returns the SIMD level selected at compile time.
+*/
+inline SIMDLevel detectSIMDLevel() noexcept
+{
+#if ( BLAZE_GNU_COMPILER || BLAZE_CLANG_COMPILER ) && ( defined(__x86_64__) || defined(__i386__) )
+   __builtin_cpu_init();
+
+   if( __builtin_cpu_supports( "avx512f" ) )
+      return simdAVX512;
+   else if( __builtin_cpu_supports( "avx2" ) && __builtin_cpu_supports( "fma" ) )
+      return simdAVX2;
+   else if( __builtin_cpu_supports( "avx" ) )
+      return simdAVX;
+   else if( __builtin_cpu_supports( "sse2" ) )
+      return simdSSE2;
+   else
+      return noSIMD;
+#else
+   return compiledSIMDLevel;
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns a reference to the currently active SIMD level.
+// \ingroup simd
+//
+// \return Reference to the active SIMD level.
+//
+// The active SIMD level is initialized with the result of detectSIMDLevel() on first use.
+*/
+inline SIMDLevel& activeSIMDLevel() noexcept
+{
+   static SIMDLevel level( detectSIMDLevel() );
+   return level;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the SIMD level used by the runtime CPU dispatch.
+// \ingroup simd
+//
+// \return The currently active SIMD level.
+//
+// Via this function the SIMD level used by the runtime CPU dispatch can be queried. By default
+// this is the highest SIMD level supported by the executing CPU (see detectSIMDLevel()). In
+// case the CPU dispatch is disabled (see the BLAZE_USE_CPU_DISPATCH switch) the level has no
+// effect and only the kernels compiled for the SIMD level selected at compile time are used.
+*/
+inline SIMDLevel getSIMDLevel() noexcept
+{
+   return activeSIMDLevel();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Sets the SIMD level used by the runtime CPU dispatch.
+// \ingroup simd
+//
+// \param level The requested SIMD level.
+// \return The SIMD level that is actually used.
+//
+// Via this function the SIMD level used by the runtime CPU dispatch can be restricted, for
+// instance to compare the performance of different instruction sets on the same machine or
+// to reduce the clock frequency penalty of AVX-512. Since the SIMD level cannot exceed the
+// capabilities of the executing CPU, the given \a level is limited to the result of
+// detectSIMDLevel(). Levels below the SIMD level selected at compile time result in the
+// kernels compiled for that level. Note that this function is not thread-safe and should
+// be called before any computation is started:
+
+   \code
+   blaze::setSIMDLevel( blaze::simdAVX2 );  // Use AVX2/FMA kernels even on AVX-512 CPUs
+   \endcode
+*/
+inline SIMDLevel setSIMDLevel( SIMDLevel level ) noexcept
+{
+   const SIMDLevel detected( detectSIMDLevel() );
+   activeSIMDLevel() = ( level < detected ? level : detected );
+   return activeSIMDLevel();
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
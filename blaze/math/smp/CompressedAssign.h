@@ -0,0 +1,182 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/CompressedAssign.h
+//  \brief Header file for the shared two-pass SMP assignment to compressed matrices
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SMP_COMPRESSEDASSIGN_H_
+#define _BLAZE_MATH_SMP_COMPRESSEDASSIGN_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/sparse/Forward.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  SMP ASSIGNMENT TO COMPRESSED MATRICES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Two-pass SMP (compound) assignment of a matrix to a compressed matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side compressed matrix.
+// \param rhs The right-hand side matrix to be assigned.
+// \param op The (compound) assignment operation.
+// \param compound \a true in case \a op is a compound assignment, \a false for a plain assignment.
+// \param chunks The maximum number of chunks to be evaluated concurrently.
+// \param parallelFor The parallel loop of the SMP backend.
+// \return void
+//
+// This function implements the SMP assignment of a matrix to a compressed matrix, which is
+// shared by all SMP backends. Since the elements of a compressed matrix cannot be inserted
+// concurrently, the assignment is performed in two passes over contiguous blocks of rows (in
+// case of a row-major matrix) or columns (in case of a column-major matrix):
+//
+//  - In the first pass all chunks concurrently evaluate their block of rows/columns of the
+//    right-hand side (including the current values of \a lhs in case of a compound assignment)
+//    into a separate compressed matrix and record the number of non-zero elements of each
+//    row/column.
+//  - Based on these counts the row/column pointers of the result are computed by means of a
+//    prefix sum and the storage of the result is allocated at once.
+//  - In the second pass all chunks concurrently copy their block into the disjoint rows/columns
+//    of the result and release the block.
+//
+// Thus the right-hand side is evaluated exactly once. In case of a plain assignment the current
+// values of \a lhs are not touched. The given \a parallelFor functor is called with the number
+// of chunks and a kernel that has to be called once for each chunk index; it must not return
+// before all kernel calls have completed.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the left-hand side compressed matrix
+        , bool SO1       // Storage order of the left-hand side compressed matrix
+        , typename IT    // Index type of the left-hand side compressed matrix
+        , typename MT2   // Type of the right-hand side matrix
+        , bool SO2       // Storage order of the right-hand side matrix
+        , typename OP    // Type of the assignment operation
+        , typename PF >  // Type of the parallel loop
+void compressedAssign( CompressedMatrix<Type,SO1,IT>& lhs, const Matrix<MT2,SO2>& rhs,
+                       OP op, bool compound, size_t chunks, PF parallelFor )
+{
+   using Block = CompressedMatrix<Type,SO1,IT>;
+
+   const size_t M( SO1 ? lhs.columns() : lhs.rows()    );
+   const size_t N( SO1 ? lhs.rows()    : lhs.columns() );
+
+   if( M == 0UL || N == 0UL )
+      return;
+
+   const size_t threads( min( chunks, M ) );
+
+   const size_t addon        ( ( ( M % threads ) != 0UL )? 1UL : 0UL );
+   const size_t sizePerThread( M / threads + addon );
+
+   const CompressedMatrix<Type,SO1,IT>& target( lhs );
+
+   // First pass: Evaluating the blocks and counting the non-zero elements of each row/column
+   std::vector<Block> blocks( threads );
+   std::vector<size_t> nonzeros( M, 0UL );
+
+   parallelFor( threads, [&]( size_t i )
+   {
+      const size_t begin( i*sizePerThread );
+
+      if( begin >= M )
+         return;
+
+      const size_t size( min( sizePerThread, M - begin ) );
+
+      Block& block( blocks[i] );
+
+      if( SO1 ) {
+         if( compound ) block = serial( submatrix( target, 0UL, begin, N, size, unchecked ) );
+         op( block, submatrix( ~rhs, 0UL, begin, N, size, unchecked ) );
+      }
+      else {
+         if( compound ) block = serial( submatrix( target, begin, 0UL, size, N, unchecked ) );
+         op( block, submatrix( ~rhs, begin, 0UL, size, N, unchecked ) );
+      }
+
+      for( size_t k=0UL; k<size; ++k ) {
+         nonzeros[begin+k] = block.nonZeros( k );
+      }
+   } );
+
+   // Computing the row/column pointers and allocating the result
+   Block tmp( lhs.rows(), lhs.columns(), nonzeros );
+
+   // Second pass: Copying the blocks into the disjoint rows/columns of the result
+   parallelFor( threads, [&]( size_t i )
+   {
+      const size_t begin( i*sizePerThread );
+
+      if( begin >= M )
+         return;
+
+      const size_t size( min( sizePerThread, M - begin ) );
+
+      Block& block( blocks[i] );
+
+      for( size_t k=0UL; k<size; ++k ) {
+         for( auto element=block.begin(k); element!=block.end(k); ++element ) {
+            if( SO1 ) tmp.append( element->index(), begin+k, element->value() );
+            else      tmp.append( begin+k, element->index(), element->value() );
+         }
+      }
+
+      Block().swap( block );
+   } );
+
+   lhs.swap( tmp );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,171 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/FirstTouch.h
+//  \brief Header file for the SMP first touch initialization
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_FIRSTTOUCH_H_
+#define _BLAZE_MATH_SMP_FIRSTTOUCH_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/dense/Forward.h>
+#include <blaze/math/PaddingFlag.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/TransposeFlag.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/NUMA.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  FIRST TOUCH FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Parallel first touch initialization of the storage of a dense matrix.
+// \ingroup smp
+//
+// \param data The first element of the uninitialized storage.
+// \param m The number of rows of the storage (including padding for column-major matrices).
+// \param n The number of columns of the storage (including padding for row-major matrices).
+// \return void
+//
+// In case the first touch NUMA policy is active (see setNumaPolicy()) and more than a single
+// thread is available, this function initializes the given storage of newly allocated memory
+// with default values by means of an SMP assignment. Therefore the storage is partitioned in
+// the same way as in all subsequent parallel assignments and every page of memory is placed
+// on the NUMA node of the thread that is going to work on it. Otherwise, and within an active
+// parallel section, the function does not touch the storage.
+*/
+template< bool SO          // Storage order
+        , typename Type >  // Data type of the elements
+inline EnableIf_t< IsNumeric_v<Type> >
+   smpFirstTouch( Type* data, size_t m, size_t n )
+{
+   if( getNumaPolicy() != numaFirstTouch || getNumThreads() == 1UL || isParallelSectionActive() )
+      return;
+
+   CustomMatrix<Type,unaligned,unpadded,SO,DynamicMatrix<Type,SO> > storage( data, m, n );
+   smpAssign( storage, UniformMatrix<Type,SO>( m, n ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Parallel first touch initialization of the storage of a dense matrix.
+// \ingroup smp
+//
+// \param data The first element of the uninitialized storage.
+// \param m The number of rows of the storage.
+// \param n The number of columns of the storage.
+// \return void
+//
+// The storage of matrices of non-numeric elements is initialized during the allocation and is
+// therefore not affected by the first touch NUMA policy.
+*/
+template< bool SO          // Storage order
+        , typename Type >  // Data type of the elements
+inline DisableIf_t< IsNumeric_v<Type> >
+   smpFirstTouch( Type* data, size_t m, size_t n )
+{
+   MAYBE_UNUSED( data, m, n );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Parallel first touch initialization of the storage of a dense vector.
+// \ingroup smp
+//
+// \param data The first element of the uninitialized storage.
+// \param n The size of the storage (including padding).
+// \return void
+//
+// In case the first touch NUMA policy is active (see setNumaPolicy()) and more than a single
+// thread is available, this function initializes the given storage of newly allocated memory
+// with default values by means of an SMP assignment, i.e. with the same partitioning as all
+// subsequent parallel assignments. Otherwise the function does not touch the storage.
+*/
+template< typename Type >  // Data type of the elements
+inline EnableIf_t< IsNumeric_v<Type> >
+   smpFirstTouch( Type* data, size_t n )
+{
+   if( getNumaPolicy() != numaFirstTouch || getNumThreads() == 1UL || isParallelSectionActive() )
+      return;
+
+   CustomVector<Type,unaligned,unpadded,columnVector,DynamicVector<Type,columnVector> > storage( data, n );
+   smpAssign( storage, UniformVector<Type,columnVector>( n ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Parallel first touch initialization of the storage of a dense vector.
+// \ingroup smp
+//
+// \param data The first element of the uninitialized storage.
+// \param n The size of the storage.
+// \return void
+//
+// The storage of vectors of non-numeric elements is initialized during the allocation and is
+// therefore not affected by the first touch NUMA policy.
+*/
+template< typename Type >  // Data type of the elements
+inline DisableIf_t< IsNumeric_v<Type> >
+   smpFirstTouch( Type* data, size_t n )
+{
+   MAYBE_UNUSED( data, n );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
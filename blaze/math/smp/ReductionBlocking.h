@@ -0,0 +1,230 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/ReductionBlocking.h
+//  \brief Header file for the blockwise evaluation of SMP reductions
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_REDUCTIONBLOCKING_H_
+#define _BLAZE_MATH_SMP_REDUCTIONBLOCKING_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <memory>
+#include <blaze/math/functors/Add.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/typetraits/IsFloatingPoint.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  COMPILE TIME CONSTRAINTS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+namespace {
+
+BLAZE_STATIC_ASSERT( BLAZE_REPRODUCIBLE_REDUCTION_BLOCK_SIZE > 0 );
+BLAZE_STATIC_ASSERT( BLAZE_REPRODUCIBLE_REDUCTION_BLOCK_SIZE % 64 == 0 );
+
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  REDUCTION BLOCKING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the chunk granularity of an SMP reduction.
+// \ingroup smp
+//
+// \param granularity The minimum granularity of the chunk sizes (for instance the SIMD width).
+// \param unit The number of elements per index of the reduction (for instance per row).
+// \return The granularity to be passed to smpReduce().
+//
+// By default this function returns the given \a granularity, i.e. the chunk sizes of an SMP
+// reduction are multiples of \a granularity. In case the reproducible reductions are activated
+// (see the \c BLAZE_USE_REPRODUCIBLE_REDUCTIONS switch), the function returns the fixed block
+// size of the reduction, which is a multiple of \a granularity close to
+// \c BLAZE_REPRODUCIBLE_REDUCTION_BLOCK_SIZE elements and only depends on the shape of the
+// operands.
+*/
+inline size_t reductionGranularity( size_t granularity, size_t unit = 1UL ) noexcept
+{
+   BLAZE_INTERNAL_ASSERT( granularity > 0UL, "Invalid chunk granularity" );
+
+   if( !BLAZE_REPRODUCIBLE_REDUCTION_MODE )
+      return granularity;
+
+   const size_t blocksize( BLAZE_REPRODUCIBLE_REDUCTION_BLOCK_SIZE / ( unit ? unit : 1UL ) );
+
+   return ( blocksize > granularity )?( blocksize - blocksize % granularity ):( granularity );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Combines the partial results of a blockwise or parallel reduction.
+// \ingroup smp
+//
+// \param partial Pointer to the first partial result.
+// \param n The total number of partial results \f$ [1..\infty) \f$.
+// \param combine The binary operation to combine two partial results.
+// \return The combined result.
+//
+// This function combines the given partial results in ascending order.
+*/
+template< typename T      // Type of the partial results
+        , typename OP >   // Type of the combination operation
+inline T combinePartials( const T* partial, size_t n, OP combine )
+{
+   BLAZE_INTERNAL_ASSERT( n > 0UL, "Invalid number of partial results" );
+
+   T result( partial[0UL] );
+
+   for( size_t i=1UL; i<n; ++i ) {
+      result = combine( result, partial[i] );
+   }
+
+   return result;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Compensated summation of the partial results of a blockwise or parallel reduction.
+// \ingroup smp
+//
+// \param partial Pointer to the first partial result.
+// \param n The total number of partial results \f$ [1..\infty) \f$.
+// \return The sum of all partial results.
+//
+// This function sums up the given partial results in ascending order by means of the
+// Kahan-Babuska-Neumaier algorithm. It is selected for sums of built-in floating point
+// values in case the compensated summation is activated (see the
+// \c BLAZE_USE_COMPENSATED_SUMMATION switch).
+*/
+template< typename T >  // Type of the partial results
+inline auto combinePartials( const T* partial, size_t n, Add )
+   -> EnableIf_t< BLAZE_COMPENSATED_SUMMATION_MODE && IsFloatingPoint_v<T>, T >
+{
+   BLAZE_INTERNAL_ASSERT( n > 0UL, "Invalid number of partial results" );
+
+   if( n == 1UL )
+      return partial[0UL];
+
+   T sum( partial[0UL] );
+   T compensation{};
+
+   for( size_t i=1UL; i<n; ++i )
+   {
+      const T tmp( sum + partial[i] );
+
+      if( std::abs( sum ) >= std::abs( partial[i] ) )
+         compensation += ( sum - tmp ) + partial[i];
+      else
+         compensation += ( partial[i] - tmp ) + sum;
+
+      sum = tmp;
+   }
+
+   return sum + compensation;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Serial evaluation of an SMP reduction.
+// \ingroup smp
+//
+// \param size The total number of elements/rows/columns to be reduced.
+// \param granularity The chunk granularity as computed by reductionGranularity().
+// \param kernel The reduction kernel, called with the index and the size of a single chunk.
+// \param combine The binary operation to combine two partial results.
+// \return The result of the reduction.
+//
+// This function evaluates an SMP reduction on the calling thread. By default, the given
+// \a kernel is evaluated for the complete index range \f$ [0..size) \f$. In case the
+// reproducible reductions are activated, the range is split into blocks of \a granularity
+// indices exactly as in a parallel evaluation, which guarantees a bit-identical result.
+*/
+template< typename T      // Type of the (partial) result
+        , typename OP1    // Type of the reduction kernel
+        , typename OP2 >  // Type of the combination operation
+T serialReduce( size_t size, size_t granularity, OP1 kernel, OP2 combine )
+{
+   BLAZE_INTERNAL_ASSERT( granularity > 0UL, "Invalid chunk granularity" );
+
+   if( !BLAZE_REPRODUCIBLE_REDUCTION_MODE || size <= granularity )
+      return kernel( 0UL, size );
+
+   const size_t blocks( ( size + granularity - 1UL ) / granularity );
+
+   std::unique_ptr<T[]> partial( new T[blocks] );
+
+   for( size_t i=0UL; i<blocks; ++i ) {
+      const size_t index( i*granularity );
+      partial[i] = kernel( index, min( granularity, size - index ) );
+   }
+
+   return combinePartials( partial.get(), blocks, combine );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -46,6 +46,7 @@
 #include <blaze/math/shims/Sqrt.h>
 #include <blaze/util/algorithms/Max.h>
 #include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Topology.h>
 #include <blaze/util/Types.h>
 
 
@@ -66,24 +67,17 @@ using ThreadMapping = std::pair<size_t,size_t>;
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Creates a 2D mapping of threads.
+/*!\brief Creates a 2D mapping of threads for a matrix of the given size.
 // \ingroup smp
 //
 // \param threads The total number of threads to be mapped.
-// \param A The matrix the mapping is created for.
+// \param M The number of rows of the matrix.
+// \param N The number of columns of the matrix.
+// \param SO The storage order of the matrix.
 // \return 2D mapping of the given number of threads.
-//
-// This function creates a 2D mapping of the given number of threads for the given matrix \a A.
-// The mapping will depend on the ratio between rows and columns of the matrix and its storage
-// order.
 */
-template< typename MT  // Type of the matrix
-        , bool SO >    // Storage order of the matrix
-ThreadMapping createThreadMapping( size_t threads, const Matrix<MT,SO>& A )
+inline ThreadMapping createThreadMapping_backend( size_t threads, size_t M, size_t N, bool SO )
 {
-   const size_t M( (~A).rows()    );
-   const size_t N( (~A).columns() );
-
    if( M > N || ( M == N && !SO ) )
    {
       const double ratio( double(M)/double(N) );
@@ -114,6 +108,98 @@ ThreadMapping createThreadMapping( size_t threads, const Matrix<MT,SO>& A )
 /*! \endcond */
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the block of a 2D mapping of threads that is assigned to the given chunk.
+// \ingroup smp
+//
+// \param mapping The 2D mapping of threads.
+// \param index The index of the chunk \f$[0..mapping.first \cdot mapping.second)\f$.
+// \param SO The storage order of the matrix.
+// \return The row and column index of the according block.
+//
+// The blocks are enumerated along the storage order of the matrix, i.e. row by row for
+// row-major matrices and column by column for column-major matrices. Thus contiguous ranges
+// of chunks work on contiguous parts of the memory of the matrix.
+*/
+inline std::pair<size_t,size_t> getThreadBlock( const ThreadMapping& mapping, size_t index, bool SO ) noexcept
+{
+   if( SO )
+      return std::pair<size_t,size_t>( index % mapping.first, index / mapping.first );
+   else
+      return std::pair<size_t,size_t>( index / mapping.second, index % mapping.second );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creates a 2D mapping of threads.
+// \ingroup smp
+//
+// \param threads The total number of threads to be mapped.
+// \param A The matrix the mapping is created for.
+// \param domains The number of cache domains spanned by the threads.
+// \return 2D mapping of the given number of threads.
+//
+// This function creates a 2D mapping of the given number of threads for the given matrix \a A.
+// The mapping will depend on the ratio between rows and columns of the matrix and its storage
+// order. The blocks of the mapping are enumerated along the storage order of \a A (see
+// getThreadBlock()). In case the threads span several last-level cache domains (i.e. threads
+// \f$ [k \cdot T/D, (k+1) \cdot T/D) \f$ share the \a k-th of \a D cache domains), the matrix
+// is first split into \a D bands, one per cache domain, and the threads of each domain are
+// mapped to their band. The bands consist of rows for row-major matrices and of columns for
+// column-major matrices. Thus threads sharing a cache work on a contiguous part of \a A.
+*/
+template< typename MT  // Type of the matrix
+        , bool SO >    // Storage order of the matrix
+ThreadMapping createThreadMapping( size_t threads, const Matrix<MT,SO>& A, size_t domains )
+{
+   const size_t M( (~A).rows()    );
+   const size_t N( (~A).columns() );
+
+   if( domains > 1UL && threads % domains == 0UL )
+   {
+      if( !SO && M >= threads ) {
+         const ThreadMapping local( createThreadMapping_backend( threads / domains, M / domains, N, SO ) );
+         return ThreadMapping( domains * local.first, local.second );
+      }
+      else if( SO && N >= threads ) {
+         const ThreadMapping local( createThreadMapping_backend( threads / domains, M, N / domains, SO ) );
+         return ThreadMapping( local.first, domains * local.second );
+      }
+   }
+
+   return createThreadMapping_backend( threads, M, N, SO );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creates a 2D mapping of threads.
+// \ingroup smp
+//
+// \param threads The total number of threads to be mapped.
+// \param A The matrix the mapping is created for.
+// \return 2D mapping of the given number of threads.
+//
+// This function creates a 2D mapping of the given number of threads for the given matrix \a A,
+// taking the cache domains of the threads according to the active thread affinity policy into
+// account (see setThreadAffinity()).
+*/
+template< typename MT  // Type of the matrix
+        , bool SO >    // Storage order of the matrix
+ThreadMapping createThreadMapping( size_t threads, const Matrix<MT,SO>& A )
+{
+   return createThreadMapping( threads, ~A, getCacheDomains( threads ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
 } // namespace blaze
 
 #endif
@@ -42,8 +42,10 @@
 
 #include <blaze/system/Inline.h>
 #include <blaze/system/SMP.h>
+#include <blaze/util/Exception.h>
 #include <blaze/util/MaybeUnused.h>
 #include <blaze/util/StaticAssert.h>
+#include <blaze/util/Topology.h>
 #include <blaze/util/Types.h>
 
 
@@ -58,9 +60,10 @@ namespace blaze {
 //*************************************************************************************************
 /*!\name SMP utility functions */
 //@{
-BLAZE_ALWAYS_INLINE size_t getNumThreads  ();
-BLAZE_ALWAYS_INLINE void   setNumThreads  ( size_t number );
-BLAZE_ALWAYS_INLINE void   shutDownThreads();
+BLAZE_ALWAYS_INLINE size_t getNumThreads    ();
+BLAZE_ALWAYS_INLINE void   setNumThreads    ( size_t number );
+BLAZE_ALWAYS_INLINE void   setThreadAffinity( ThreadAffinity policy );
+BLAZE_ALWAYS_INLINE void   shutDownThreads  ();
 //@}
 //*************************************************************************************************
 
@@ -101,6 +104,29 @@ BLAZE_ALWAYS_INLINE void setNumThreads( size_t number )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Sets the thread affinity policy for thread parallel operations.
+// \ingroup smp
+//
+// \param policy The thread affinity policy (see ThreadAffinity).
+// \return void
+// \exception std::invalid_argument Invalid thread affinity policy.
+//
+// Via this function the thread affinity policy for thread parallel operations can be specified.
+// In case an invalid policy is specified, a \a std::invalid_argument exception is thrown. Also
+// note that in case no parallelization is active, the function has no effect.
+*/
+BLAZE_ALWAYS_INLINE void setThreadAffinity( ThreadAffinity policy )
+{
+   if( policy < affinityNone || policy > affinityCores ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid thread affinity policy" );
+   }
+
+   threadAffinitySetting() = policy;
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Provides a reliable shutdown of C++11 threads for Visual Studio compilers.
 // \ingroup smp
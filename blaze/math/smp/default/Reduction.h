@@ -0,0 +1,114 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/default/Reduction.h
+//  \brief Header file for the default SMP reduction implementation
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_DEFAULT_REDUCTION_H_
+#define _BLAZE_MATH_SMP_DEFAULT_REDUCTION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/smp/ReductionBlocking.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  REDUCTION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the check whether a reduction can be executed in parallel.
+// \ingroup smp
+//
+// \param size The total number of elements/rows/columns to be reduced.
+// \param threshold The SMP threshold of the reduction.
+// \return \a false.
+//
+// Since no shared memory parallelization is active, all reductions are executed serially.
+*/
+inline bool canSMPReduce( size_t size, size_t threshold ) noexcept
+{
+   MAYBE_UNUSED( size, threshold );
+
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the SMP reduction.
+// \ingroup smp
+//
+// \param size The total number of elements/rows/columns to be reduced.
+// \param granularity The chunk granularity as computed by reductionGranularity().
+// \param parallel \a true in case the reduction can be executed in parallel (see canSMPReduce()).
+// \param kernel The reduction kernel, called with the index and the size of a single chunk.
+// \param combine The binary operation to combine two partial results.
+// \return The result of the reduction.
+//
+// This function implements the default SMP reduction, which evaluates the given \a kernel for
+// the complete index range \f$ [0..size) \f$. In case the reproducible reductions are activated
+// (see the \c BLAZE_USE_REPRODUCIBLE_REDUCTIONS switch), the range is split into blocks of
+// \a granularity indices exactly as in a parallel reduction.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename T      // Type of the (partial) result
+        , typename OP1    // Type of the reduction kernel
+        , typename OP2 >  // Type of the combination operation
+inline T smpReduce( size_t size, size_t granularity, bool parallel, OP1 kernel, OP2 combine )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   MAYBE_UNUSED( parallel );
+
+   return serialReduce<T>( size, granularity, kernel, combine );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -125,8 +125,9 @@ void hpxAssign( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>& rhs, OP o
 
    for_loop( par, size_t(0), threads, [&](int i)
    {
-      const size_t row   ( ( i / threadmap.second ) * rowsPerThread );
-      const size_t column( ( i % threadmap.second ) * colsPerThread );
+      const auto   block ( getThreadBlock( threadmap, i, SO2 ) );
+      const size_t row   ( block.first  * rowsPerThread );
+      const size_t column( block.second * colsPerThread );
 
       if( row >= (~rhs).rows() || column >= (~rhs).columns() )
          return;
@@ -200,8 +201,9 @@ void hpxAssign( DenseMatrix<MT1,SO1>& lhs, const SparseMatrix<MT2,SO2>& rhs, OP
 
    for_loop( par, size_t(0), threads, [&](int i)
    {
-      const size_t row   ( ( i / threadmap.second ) * rowsPerThread );
-      const size_t column( ( i % threadmap.second ) * colsPerThread );
+      const auto   block ( getThreadBlock( threadmap, i, SO2 ) );
+      const size_t row   ( block.first  * rowsPerThread );
+      const size_t column( block.second * colsPerThread );
 
       if( row >= (~rhs).rows() || column >= (~rhs).columns() )
          return;
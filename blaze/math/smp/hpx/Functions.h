@@ -46,6 +46,7 @@
 #include <blaze/system/Inline.h>
 #include <blaze/system/SMP.h>
 #include <blaze/util/StaticAssert.h>
+#include <blaze/util/Topology.h>
 #include <blaze/util/Types.h>
 
 
@@ -76,6 +77,32 @@ BLAZE_ALWAYS_INLINE size_t getNumThreads()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Sets the thread affinity policy for thread parallel operations.
+// \ingroup smp
+//
+// \param policy The thread affinity policy (see ThreadAffinity).
+// \return void
+// \exception std::invalid_argument Invalid thread affinity policy.
+//
+// Via this function the thread affinity policy can be specified. Note that the worker threads
+// of HPX are pinned by the HPX runtime system (see the \c --hpx:bind command line option), i.e.
+// the function only affects the partitioning of matrices among the threads. In case an invalid
+// policy is specified, a \a std::invalid_argument exception is thrown.
+*/
+BLAZE_ALWAYS_INLINE void setThreadAffinity( ThreadAffinity policy )
+{
+   if( policy < affinityNone || policy > affinityCores ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid thread affinity policy" );
+   }
+
+   threadAffinitySetting() = policy;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Provides a reliable shutdown of C++11 threads for Visual Studio compilers.
@@ -60,7 +60,9 @@
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
+#include <blaze/util/KernelTrace.h>
 #include <blaze/util/StaticAssert.h>
+#include <blaze/util/Topology.h>
 #include <blaze/util/Types.h>
 
 
@@ -97,9 +99,12 @@ template< typename MT1   // Type of the left-hand side dense matrix
 void openmpAssign( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>& rhs, OP op )
 {
    BLAZE_FUNCTION_TRACE;
+   BLAZE_KERNEL_TRACE( "openmpAssign", "smp", (~rhs).rows(), (~rhs).columns(), 0UL );
 
    BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
 
+   updateCurrentThreadAffinity( static_cast<size_t>( omp_get_thread_num() ) );
+
    using ET1 = ElementType_t<MT1>;
    using ET2 = ElementType_t<MT2>;
 
@@ -125,8 +130,9 @@ void openmpAssign( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>& rhs, O
 #pragma omp for schedule(dynamic,1) nowait
    for( int i=0; i<threads; ++i )
    {
-      const size_t row   ( ( i / threadmap.second ) * rowsPerThread );
-      const size_t column( ( i % threadmap.second ) * colsPerThread );
+      const auto   block ( getThreadBlock( threadmap, i, SO2 ) );
+      const size_t row   ( block.first  * rowsPerThread );
+      const size_t column( block.second * colsPerThread );
 
       if( row >= (~rhs).rows() || column >= (~rhs).columns() )
          continue;
@@ -185,9 +191,12 @@ template< typename MT1   // Type of the left-hand side dense matrix
 void openmpAssign( DenseMatrix<MT1,SO1>& lhs, const SparseMatrix<MT2,SO2>& rhs, OP op )
 {
    BLAZE_FUNCTION_TRACE;
+   BLAZE_KERNEL_TRACE( "openmpAssign", "smp", (~rhs).rows(), (~rhs).columns(), 0UL );
 
    BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
 
+   updateCurrentThreadAffinity( static_cast<size_t>( omp_get_thread_num() ) );
+
    const size_t threads( omp_get_num_threads() );
    const ThreadMapping threadmap( createThreadMapping( threads, ~rhs ) );
 
@@ -200,8 +209,9 @@ void openmpAssign( DenseMatrix<MT1,SO1>& lhs, const SparseMatrix<MT2,SO2>& rhs,
 #pragma omp for schedule(dynamic,1) nowait
    for( size_t i=0; i<threads; ++i )
    {
-      const size_t row   ( ( i / threadmap.second ) * rowsPerThread );
-      const size_t column( ( i % threadmap.second ) * colsPerThread );
+      const auto   block ( getThreadBlock( threadmap, i, SO2 ) );
+      const size_t row   ( block.first  * rowsPerThread );
+      const size_t column( block.second * colsPerThread );
 
       if( row >= (~rhs).rows() || column >= (~rhs).columns() )
          continue;
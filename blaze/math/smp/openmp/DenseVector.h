@@ -57,7 +57,9 @@
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
+#include <blaze/util/KernelTrace.h>
 #include <blaze/util/StaticAssert.h>
+#include <blaze/util/Topology.h>
 #include <blaze/util/Types.h>
 
 
@@ -94,9 +96,12 @@ template< typename VT1   // Type of the left-hand side dense vector
 void openmpAssign( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>& rhs, OP op )
 {
    BLAZE_FUNCTION_TRACE;
+   BLAZE_KERNEL_TRACE( "openmpAssign", "smp", (~rhs).size(), 0UL, 0UL );
 
    BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
 
+   updateCurrentThreadAffinity( static_cast<size_t>( omp_get_thread_num() ) );
+
    using ET1 = ElementType_t<VT1>;
    using ET2 = ElementType_t<VT2>;
 
@@ -173,9 +178,12 @@ template< typename VT1   // Type of the left-hand side dense vector
 void openmpAssign( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2>& rhs, OP op )
 {
    BLAZE_FUNCTION_TRACE;
+   BLAZE_KERNEL_TRACE( "openmpAssign", "smp", (~rhs).size(), 0UL, 0UL );
 
    BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
 
+   updateCurrentThreadAffinity( static_cast<size_t>( omp_get_thread_num() ) );
+
    const int    threads      ( omp_get_num_threads() );
    const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
    const size_t sizePerThread( (~lhs).size() / threads + addon );
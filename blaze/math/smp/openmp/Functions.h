@@ -45,6 +45,7 @@
 #include <blaze/system/Inline.h>
 #include <blaze/system/SMP.h>
 #include <blaze/util/StaticAssert.h>
+#include <blaze/util/Topology.h>
 #include <blaze/util/Types.h>
 
 
@@ -100,6 +101,40 @@ BLAZE_ALWAYS_INLINE void setNumThreads( size_t number )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Sets the thread affinity policy for thread parallel operations.
+// \ingroup smp
+//
+// \param policy The thread affinity policy (see ThreadAffinity).
+// \return void
+// \exception std::invalid_argument Invalid thread affinity policy.
+//
+// Via this function the threads used for OpenMP parallel operations can be pinned to the
+// hardware threads of the system. The function pins all threads of the current OpenMP thread
+// team immediately. Threads that join the team later on (for instance due to an increased
+// number of threads, see setNumThreads()) are pinned at the beginning of the next parallel
+// operation. The initial policy can be specified via the \c BLAZE_THREAD_AFFINITY environment
+// variable (\c none, \c compact, \c scatter, or \c cores), in which case the threads are
+// pinned at the beginning of the first parallel operation. Alternatively, the threads can be
+// pinned via the \c OMP_PROC_BIND and \c OMP_PLACES environment variables. In case an invalid
+// policy is specified, a \a std::invalid_argument exception is thrown.
+*/
+BLAZE_ALWAYS_INLINE void setThreadAffinity( ThreadAffinity policy )
+{
+   if( policy < affinityNone || policy > affinityCores ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid thread affinity policy" );
+   }
+
+   threadAffinitySetting() = policy;
+
+#pragma omp parallel
+   updateCurrentThreadAffinity( static_cast<size_t>( omp_get_thread_num() ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Provides a reliable shutdown of C++11 threads for Visual Studio compilers.
@@ -59,6 +59,7 @@
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
+#include <blaze/util/KernelTrace.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/Types.h>
 
@@ -96,6 +97,7 @@ template< typename MT1   // Type of the left-hand side dense matrix
 void threadAssign( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>& rhs, OP op )
 {
    BLAZE_FUNCTION_TRACE;
+   BLAZE_KERNEL_TRACE( "threadAssign", "smp", (~rhs).rows(), (~rhs).columns(), 0UL );
 
    BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
 
@@ -108,7 +110,7 @@ void threadAssign( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>& rhs, O
    const bool lhsAligned( (~lhs).isAligned() );
    const bool rhsAligned( (~rhs).isAligned() );
 
-   const ThreadMapping threads( createThreadMapping( TheThreadBackend::size(), ~rhs ) );
+   const ThreadMapping threads( createThreadMapping( TheThreadBackend::chunks(), ~rhs, TheThreadBackend::domains() ) );
 
    const size_t addon1     ( ( ( (~rhs).rows() % threads.first ) != 0UL )? 1UL : 0UL );
    const size_t equalShare1( (~rhs).rows() / threads.first + addon1 );
@@ -120,43 +122,37 @@ void threadAssign( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>& rhs, O
    const size_t rest2      ( equalShare2 & ( SIMDSIZE - 1UL ) );
    const size_t colsPerThread( ( simdEnabled && rest2 )?( equalShare2 - rest2 + SIMDSIZE ):( equalShare2 ) );
 
-   for( size_t i=0UL; i<threads.first; ++i )
+   for( size_t k=0UL; k<threads.first*threads.second; ++k )
    {
-      const size_t row( i*rowsPerThread );
+      const auto   block ( getThreadBlock( threads, k, SO2 ) );
+      const size_t row   ( block.first  * rowsPerThread );
+      const size_t column( block.second * colsPerThread );
 
-      if( row >= (~lhs).rows() )
+      if( row >= (~lhs).rows() || column >= (~rhs).columns() )
          continue;
 
-      for( size_t j=0UL; j<threads.second; ++j )
-      {
-         const size_t column( j*colsPerThread );
-
-         if( column >= (~rhs).columns() )
-            continue;
-
-         const size_t m( min( rowsPerThread, (~lhs).rows()    - row    ) );
-         const size_t n( min( colsPerThread, (~rhs).columns() - column ) );
-
-         if( simdEnabled && lhsAligned && rhsAligned ) {
-            auto       target( submatrix<aligned>( ~lhs, row, column, m, n, unchecked ) );
-            const auto source( submatrix<aligned>( ~rhs, row, column, m, n, unchecked ) );
-            TheThreadBackend::schedule( target, source, op );
-         }
-         else if( simdEnabled && lhsAligned ) {
-            auto       target( submatrix<aligned>( ~lhs, row, column, m, n, unchecked ) );
-            const auto source( submatrix<unaligned>( ~rhs, row, column, m, n, unchecked ) );
-            TheThreadBackend::schedule( target, source, op );
-         }
-         else if( simdEnabled && rhsAligned ) {
-            auto       target( submatrix<unaligned>( ~lhs, row, column, m, n, unchecked ) );
-            const auto source( submatrix<aligned>( ~rhs, row, column, m, n, unchecked ) );
-            TheThreadBackend::schedule( target, source, op );
-         }
-         else {
-            auto       target( submatrix<unaligned>( ~lhs, row, column, m, n, unchecked ) );
-            const auto source( submatrix<unaligned>( ~rhs, row, column, m, n, unchecked ) );
-            TheThreadBackend::schedule( target, source, op );
-         }
+      const size_t m( min( rowsPerThread, (~lhs).rows()    - row    ) );
+      const size_t n( min( colsPerThread, (~rhs).columns() - column ) );
+
+      if( simdEnabled && lhsAligned && rhsAligned ) {
+         auto       target( submatrix<aligned>( ~lhs, row, column, m, n, unchecked ) );
+         const auto source( submatrix<aligned>( ~rhs, row, column, m, n, unchecked ) );
+         TheThreadBackend::schedule( target, source, op );
+      }
+      else if( simdEnabled && lhsAligned ) {
+         auto       target( submatrix<aligned>( ~lhs, row, column, m, n, unchecked ) );
+         const auto source( submatrix<unaligned>( ~rhs, row, column, m, n, unchecked ) );
+         TheThreadBackend::schedule( target, source, op );
+      }
+      else if( simdEnabled && rhsAligned ) {
+         auto       target( submatrix<unaligned>( ~lhs, row, column, m, n, unchecked ) );
+         const auto source( submatrix<aligned>( ~rhs, row, column, m, n, unchecked ) );
+         TheThreadBackend::schedule( target, source, op );
+      }
+      else {
+         auto       target( submatrix<unaligned>( ~lhs, row, column, m, n, unchecked ) );
+         const auto source( submatrix<unaligned>( ~rhs, row, column, m, n, unchecked ) );
+         TheThreadBackend::schedule( target, source, op );
       }
    }
 
@@ -192,10 +188,11 @@ template< typename MT1   // Type of the left-hand side dense matrix
 void threadAssign( DenseMatrix<MT1,SO1>& lhs, const SparseMatrix<MT2,SO2>& rhs, OP op )
 {
    BLAZE_FUNCTION_TRACE;
+   BLAZE_KERNEL_TRACE( "threadAssign", "smp", (~rhs).rows(), (~rhs).columns(), 0UL );
 
    BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
 
-   const ThreadMapping threads( createThreadMapping( TheThreadBackend::size(), ~rhs ) );
+   const ThreadMapping threads( createThreadMapping( TheThreadBackend::chunks(), ~rhs, TheThreadBackend::domains() ) );
 
    const size_t addon1       ( ( ( (~rhs).rows() % threads.first ) != 0UL )? 1UL : 0UL );
    const size_t rowsPerThread( (~rhs).rows() / threads.first + addon1 );
@@ -203,27 +200,21 @@ void threadAssign( DenseMatrix<MT1,SO1>& lhs, const SparseMatrix<MT2,SO2>& rhs,
    const size_t addon2       ( ( ( (~rhs).columns() % threads.second ) != 0UL )? 1UL : 0UL );
    const size_t colsPerThread( (~rhs).columns() / threads.second + addon2 );
 
-   for( size_t i=0UL; i<threads.first; ++i )
+   for( size_t k=0UL; k<threads.first*threads.second; ++k )
    {
-      const size_t row( i*rowsPerThread );
+      const auto   block ( getThreadBlock( threads, k, SO2 ) );
+      const size_t row   ( block.first  * rowsPerThread );
+      const size_t column( block.second * colsPerThread );
 
-      if( row >= (~lhs).rows() )
+      if( row >= (~lhs).rows() || column >= (~lhs).columns() )
          continue;
 
-      for( size_t j=0UL; j<threads.second; ++j )
-      {
-         const size_t column( j*colsPerThread );
-
-         if( column >= (~lhs).columns() )
-            continue;
-
-         const size_t m( min( rowsPerThread, (~lhs).rows()    - row    ) );
-         const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
+      const size_t m( min( rowsPerThread, (~lhs).rows()    - row    ) );
+      const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
 
-         auto       target( submatrix<unaligned>( ~lhs, row, column, m, n, unchecked ) );
-         const auto source( submatrix<unaligned>( ~rhs, row, column, m, n, unchecked ) );
-         TheThreadBackend::schedule( target, source, op );
-      }
+      auto       target( submatrix<unaligned>( ~lhs, row, column, m, n, unchecked ) );
+      const auto source( submatrix<unaligned>( ~rhs, row, column, m, n, unchecked ) );
+      TheThreadBackend::schedule( target, source, op );
    }
 
    TheThreadBackend::wait();
@@ -57,6 +57,7 @@
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
+#include <blaze/util/KernelTrace.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/Types.h>
 
@@ -95,6 +96,7 @@ template< typename VT1   // Type of the left-hand side dense vector
 void threadAssign( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>& rhs, OP op )
 {
    BLAZE_FUNCTION_TRACE;
+   BLAZE_KERNEL_TRACE( "threadAssign", "smp", (~rhs).size(), 0UL, 0UL );
 
    BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
 
@@ -107,7 +109,7 @@ void threadAssign( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>& rhs, O
    const bool lhsAligned( (~lhs).isAligned() );
    const bool rhsAligned( (~rhs).isAligned() );
 
-   const size_t threads      ( TheThreadBackend::size() );
+   const size_t threads      ( TheThreadBackend::chunks() );
    const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
    const size_t equalShare   ( (~lhs).size() / threads + addon );
    const size_t rest         ( equalShare & ( SIMDSIZE - 1UL ) );
@@ -176,10 +178,11 @@ template< typename VT1   // Type of the left-hand side dense vector
 void threadAssign( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2>& rhs, OP op )
 {
    BLAZE_FUNCTION_TRACE;
+   BLAZE_KERNEL_TRACE( "threadAssign", "smp", (~rhs).size(), 0UL, 0UL );
 
    BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
 
-   const size_t threads      ( TheThreadBackend::size() );
+   const size_t threads      ( TheThreadBackend::chunks() );
    const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
    const size_t sizePerThread( (~lhs).size() / threads + addon );
 
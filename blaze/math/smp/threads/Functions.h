@@ -45,6 +45,7 @@
 #include <blaze/system/Inline.h>
 #include <blaze/system/SMP.h>
 #include <blaze/util/StaticAssert.h>
+#include <blaze/util/Topology.h>
 #include <blaze/util/Types.h>
 
 
@@ -98,6 +99,35 @@ BLAZE_ALWAYS_INLINE void setNumThreads( size_t number )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Sets the thread affinity policy for thread parallel operations.
+// \ingroup smp
+//
+// \param policy The thread affinity policy (see ThreadAffinity).
+// \return void
+// \exception std::invalid_argument Invalid thread affinity policy.
+//
+// Via this function the threads used for thread parallel operations can be pinned to the
+// hardware threads of the system. All threads of the thread pool are pinned immediately, all
+// threads created later on are pinned on creation. The initial policy can be specified via
+// the \c BLAZE_THREAD_AFFINITY environment variable (\c none, \c compact, \c scatter, or
+// \c cores). In case an invalid policy is specified, a \a std::invalid_argument exception
+// is thrown.
+*/
+BLAZE_ALWAYS_INLINE void setThreadAffinity( ThreadAffinity policy )
+{
+   if( policy < affinityNone || policy > affinityCores ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid thread affinity policy" );
+   }
+
+   threadAffinitySetting() = policy;
+   TheThreadBackend::pin();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Provides a reliable shutdown of C++11 threads for Visual Studio compilers.
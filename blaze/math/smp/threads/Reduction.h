@@ -0,0 +1,169 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/threads/Reduction.h
+//  \brief Header file for the C++11/Boost thread-based SMP reduction implementation
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_THREADS_REDUCTION_H_
+#define _BLAZE_MATH_SMP_THREADS_REDUCTION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <memory>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/ReductionBlocking.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/threads/ThreadBackend.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  REDUCTION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether a reduction of the given size can be executed in parallel.
+// \ingroup smp
+//
+// \param size The total number of elements/rows/columns to be reduced.
+// \param threshold The SMP threshold of the reduction.
+// \return \a true in case the reduction can be executed in parallel, \a false if not.
+//
+// This function returns whether a reduction can be executed by means of the C++11/Boost
+// thread-based parallelization. This is the case if the size of the reduction reaches the
+// given SMP \a threshold, if more than a single thread is available, and if the function is
+// not called from within a serial section or a parallel section.
+*/
+inline bool canSMPReduce( size_t size, size_t threshold )
+{
+   return !isSerialSectionActive() && !isParallelSectionActive() &&
+          TheThreadBackend::size() > 1UL && size >= threshold;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief C++11/Boost thread-based SMP reduction.
+// \ingroup smp
+//
+// \param size The total number of elements/rows/columns to be reduced.
+// \param granularity The chunk granularity as computed by reductionGranularity().
+// \param parallel \a true in case the reduction can be executed in parallel (see canSMPReduce()).
+// \param kernel The reduction kernel, called with the index and the size of a single chunk.
+// \param combine The binary operation to combine two partial results.
+// \return The result of the reduction.
+//
+// This function reduces the index range \f$ [0..size) \f$ in parallel. By default, the range
+// is split into one chunk per thread (the size of each chunk except the last is a multiple of
+// \a granularity). In case the reproducible reductions are activated (see the
+// \c BLAZE_USE_REPRODUCIBLE_REDUCTIONS switch), the range is split into blocks of exactly
+// \a granularity indices, which are evenly distributed among the threads. The partial result
+// of every chunk is computed by \a kernel and the partial results are combined via \a combine
+// in ascending order of the chunks. Therefore the result is independent of the order in which
+// the chunks are finished and, in reproducible mode, also independent of the number of threads.
+// In case \a parallel is \a false, the reduction is evaluated serially by means of the same
+// chunking.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename T      // Type of the (partial) result
+        , typename OP1    // Type of the reduction kernel
+        , typename OP2 >  // Type of the combination operation
+T smpReduce( size_t size, size_t granularity, bool parallel, OP1 kernel, OP2 combine )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( granularity > 0UL, "Invalid chunk granularity" );
+
+   if( !parallel )
+      return serialReduce<T>( size, granularity, kernel, combine );
+
+   const size_t threads( TheThreadBackend::size() );
+
+   size_t sizePerChunk( granularity );
+
+   if( !BLAZE_REPRODUCIBLE_REDUCTION_MODE ) {
+      const size_t addon     ( ( ( size % threads ) != 0UL )? 1UL : 0UL );
+      const size_t equalShare( size / threads + addon );
+      const size_t rest      ( equalShare % granularity );
+      sizePerChunk = ( rest )?( equalShare - rest + granularity ):( equalShare );
+   }
+
+   const size_t chunks( ( size + sizePerChunk - 1UL ) / sizePerChunk );
+
+   if( chunks <= 1UL )
+      return kernel( 0UL, size );
+
+   const size_t tasks         ( min( threads, chunks ) );
+   const size_t chunksPerTask ( ( chunks + tasks - 1UL ) / tasks );
+
+   std::unique_ptr<T[]> partial( new T[chunks] );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      for( size_t first=0UL; first<chunks; first+=chunksPerTask )
+      {
+         const size_t last( min( first+chunksPerTask, chunks ) );
+
+         TheThreadBackend::schedule( [&partial,&kernel,size,sizePerChunk,first,last]() {
+            for( size_t i=first; i<last; ++i ) {
+               const size_t index( i*sizePerChunk );
+               partial[i] = kernel( index, min( sizePerChunk, size - index ) );
+            }
+         } );
+      }
+
+      TheThreadBackend::wait();
+   }
+
+   return combinePartials( partial.get(), chunks, combine );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -52,11 +52,15 @@
 
 #include <cstdlib>
 #include <blaze/math/constraints/Expression.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/expressions/Vector.h>
 #include <blaze/system/SMP.h>
 #include <blaze/util/algorithms/Max.h>
 #include <blaze/util/constraints/Const.h>
+#include <blaze/util/KernelTrace.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/ThreadPool.h>
+#include <blaze/util/WorkStealingPool.h>
 #include <blaze/util/Types.h>
 
 
@@ -85,13 +89,25 @@ template< typename TT    // Type of the encapsulated thread
         , typename CT >  // Type of the condition variable
 class ThreadBackend
 {
+ private:
+   //**Type definitions****************************************************************************
+#if BLAZE_WORK_STEALING_MODE
+   using Pool = WorkStealingPool<TT,MT,LT,CT>;  //!< Type of the thread pool.
+#else
+   using Pool = ThreadPool<TT,MT,LT,CT>;  //!< Type of the thread pool.
+#endif
+   //**********************************************************************************************
+
  public:
    //**Utility functions***************************************************************************
    /*!\name Utility functions */
    //@{
    static inline size_t size  ();
+   static inline size_t chunks();
+   static inline size_t domains();
    static inline void   resize( size_t n, bool block=false );
    static inline void   wait  ();
+   static inline void   pin   ();
    //@}
    //**********************************************************************************************
 
@@ -100,6 +116,9 @@ class ThreadBackend
    //@{
    template< typename Target, typename Source, typename OP >
    static inline void schedule( Target& target, const Source& source, OP op );
+
+   template< typename Callable >
+   static inline void schedule( Callable func );
    //@}
    //**********************************************************************************************
 
@@ -132,6 +151,7 @@ class ThreadBackend
       // \return void
       */
       inline void operator()() {
+         BLAZE_KERNEL_TRACE( "ThreadBackend::Assigner", "smp", blaze::size( target_ ), 0UL, 0UL );
          op_( target_, source_ );
       }
       //*******************************************************************************************
@@ -159,12 +179,10 @@ class ThreadBackend
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
-   static ThreadPool<TT,MT,LT,CT> threadpool_;  //!< The pool of active threads of the backend system.
-                                                /*!< It is initialized with the number of threads
-                                                     specified via the environment variable
-                                                     \c BLAZE_NUM_THREADS. However, it can be
-                                                     explicitly resized to arbitrary numbers of
-                                                     threads. */
+   static Pool threadpool_;  //!< The pool of active threads of the backend system.
+                             /*!< It is initialized with the number of threads specified via
+                                  the environment variable \c BLAZE_NUM_THREADS. However, it
+                                  can be explicitly resized to arbitrary numbers of threads. */
    //@}
    //**********************************************************************************************
 };
@@ -183,7 +201,7 @@ class ThreadBackend
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 template< typename TT, typename MT, typename LT, typename CT >
-ThreadPool<TT,MT,LT,CT> ThreadBackend<TT,MT,LT,CT>::threadpool_( initPool() );
+typename ThreadBackend<TT,MT,LT,CT>::Pool ThreadBackend<TT,MT,LT,CT>::threadpool_( initPool() );
 /*! \endcond */
 //*************************************************************************************************
 
@@ -214,6 +232,60 @@ inline size_t ThreadBackend<TT,MT,LT,CT>::size()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of chunks a parallel (compound) assignment is split into.
+//
+// \return The number of chunks per parallel (compound) assignment.
+//
+// By default every parallel (compound) assignment is split into one chunk per thread. In case
+// the work-stealing scheduler is active (see the \c BLAZE_USE_WORK_STEALING command line
+// argument), the assignment is split into \c BLAZE_WORK_STEALING_GRANULARITY chunks per thread,
+// which are balanced between the threads by the WorkStealingPool.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline size_t ThreadBackend<TT,MT,LT,CT>::chunks()
+{
+#if BLAZE_WORK_STEALING_MODE
+   return threadpool_.size() * BLAZE_WORK_STEALING_GRANULARITY;
+#else
+   return threadpool_.size();
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of cache domains the chunks of an assignment can be grouped into.
+//
+// \return The number of cache domains spanned by the threads of the backend system.
+//
+// The WorkStealingPool assigns contiguous ranges of chunks to the threads. Therefore, in case
+// the threads are pinned (see setThreadAffinity()), the chunks can be grouped by the last-level
+// cache domain of their thread. Since the default thread pool schedules the chunks from a shared
+// task queue, the placement of the chunks is not deterministic and the function returns 1.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline size_t ThreadBackend<TT,MT,LT,CT>::domains()
+{
+#if BLAZE_WORK_STEALING_MODE
+   return getCacheDomains( threadpool_.size() );
+#else
+   return 1UL;
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Changes the total number of threads managed by the thread backend system.
@@ -262,6 +334,24 @@ inline void ThreadBackend<TT,MT,LT,CT>::wait()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Pinning all threads according to the active thread affinity policy.
+//
+// \return void
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline void ThreadBackend<TT,MT,LT,CT>::pin()
+{
+   threadpool_.pin();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -297,6 +387,30 @@ inline void ThreadBackend<TT,MT,LT,CT>::schedule( Target& target, const Source&
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scheduling the given function/functor for execution.
+//
+// \param func The given function/functor.
+// \return void
+//
+// This function schedules the given function/functor for execution. It is used by SMP kernels
+// that cannot be expressed as a single (compound) assignment of two operands, as for instance
+// the multi-pass assignment to a sparse matrix.
+*/
+template< typename TT        // Type of the encapsulated thread
+        , typename MT        // Type of the synchronization mutex
+        , typename LT        // Type of the mutex lock
+        , typename CT >      // Type of the condition variable
+template< typename Callable >  // Type of the function/functor
+inline void ThreadBackend<TT,MT,LT,CT>::schedule( Callable func )
+{
+   threadpool_.schedule( func );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -385,6 +499,7 @@ using TheThreadBackend = ThreadBackend< boost::thread
 namespace {
 
 BLAZE_STATIC_ASSERT( BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE );
+BLAZE_STATIC_ASSERT( BLAZE_WORK_STEALING_GRANULARITY >= 1 );
 
 }
 /*! \endcond */
@@ -41,6 +41,7 @@
 //*************************************************************************************************
 
 #include <algorithm>
+#include <limits>
 #include <utility>
 #include <vector>
 #include <blaze/math/Aliases.h>
@@ -122,11 +123,11 @@ namespace blaze {
 //
 // The CompressedMatrix class template is the representation of an arbitrary sized sparse
 // matrix with \f$ M \cdot N \f$ dynamically allocated elements of arbitrary type. The type
-// of the elements and the storage order of the matrix can be specified via the two template
-// parameters:
+// of the elements, the storage order of the matrix, and the type of the stored indices can be
+// specified via the three template parameters:
 
    \code
-   template< typename Type, bool SO >
+   template< typename Type, bool SO, typename IT >
    class CompressedMatrix;
    \endcode
 
@@ -134,7 +135,28 @@ namespace blaze {
 //          any non-cv-qualified, non-reference, non-pointer element type.
 //  - SO  : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
 //          The default value is blaze::rowMajor.
-//
+//  - IT  : specifies the unsigned integral type used to store the column indices (row-major)
+//          or row indices (column-major) of the non-zero elements. Using a 32-bit type such as
+//          \c uint32_t reduces the memory footprint (and thus the memory traffic of sparse
+//          kernels) for matrices with less than \f$ 2^{32} \f$ columns/rows. The default
+//          value is \c size_t.
+//
+// Note that the index type is not propagated through expressions: the result type of any
+// operation involving a CompressedMatrix with a custom index type (e.g. the result of \c A+B
+// or \c A*B) is a CompressedMatrix with the default index type \c size_t. In order to keep
+// the compact index representation, the result has to be assigned to a matrix with the
+// desired index type:
+
+   \code
+   using blaze::CompressedMatrix;
+   using blaze::rowMajor;
+
+   CompressedMatrix<float,rowMajor,uint32_t> A( 1000, 1000 ), B( 1000, 1000 );
+
+   auto C = evaluate( A * B );                            // CompressedMatrix<float,rowMajor,size_t>
+   CompressedMatrix<float,rowMajor,uint32_t> D( A * B );  // Keeps the 32-bit indices
+   \endcode
+
 // Inserting/accessing elements in a compressed matrix can be done by several alternative
 // functions. The following example demonstrates all options:
 
@@ -224,13 +246,14 @@ namespace blaze {
    \endcode
 */
 template< typename Type                    // Data type of the matrix
-        , bool SO = defaultStorageOrder >  // Storage order
+        , bool SO = defaultStorageOrder    // Storage order
+        , typename IT = size_t >           // Index type
 class CompressedMatrix
-   : public SparseMatrix< CompressedMatrix<Type,SO>, SO >
+   : public SparseMatrix< CompressedMatrix<Type,SO,IT>, SO >
 {
  private:
    //**Type definitions****************************************************************************
-   using ElementBase  = ValueIndexPair<Type>;  //!< Base class for the compressed matrix element.
+   using ElementBase  = ValueIndexPair<Type,IT>;  //!< Base class for the compressed matrix element.
    using IteratorBase = ElementBase*;          //!< Iterator over non-constant base elements.
    //**********************************************************************************************
 
@@ -315,18 +338,18 @@ class CompressedMatrix
 
  public:
    //**Type definitions****************************************************************************
-   using This           = CompressedMatrix<Type,SO>;   //!< Type of this CompressedMatrix instance.
-   using BaseType       = SparseMatrix<This,SO>;       //!< Base type of this CompressedMatrix instance.
-   using ResultType     = This;                        //!< Result type for expression template evaluations.
-   using OppositeType   = CompressedMatrix<Type,!SO>;  //!< Result type with opposite storage order for expression template evaluations.
-   using TransposeType  = CompressedMatrix<Type,!SO>;  //!< Transpose type for expression template evaluations.
-   using ElementType    = Type;                        //!< Type of the compressed matrix elements.
-   using ReturnType     = const Type&;                 //!< Return type for expression template evaluations.
-   using CompositeType  = const This&;                 //!< Data type for composite expression templates.
-   using Reference      = MatrixAccessProxy<This>;     //!< Reference to a compressed matrix value.
-   using ConstReference = const Type&;                 //!< Reference to a constant compressed matrix value.
-   using Iterator       = Element*;                    //!< Iterator over non-constant elements.
-   using ConstIterator  = const Element*;              //!< Iterator over constant elements.
+   using This           = CompressedMatrix<Type,SO,IT>;   //!< Type of this CompressedMatrix instance.
+   using BaseType       = SparseMatrix<This,SO>;          //!< Base type of this CompressedMatrix instance.
+   using ResultType     = This;                           //!< Result type for expression template evaluations.
+   using OppositeType   = CompressedMatrix<Type,!SO,IT>;  //!< Result type with opposite storage order for expression template evaluations.
+   using TransposeType  = CompressedMatrix<Type,!SO,IT>;  //!< Transpose type for expression template evaluations.
+   using ElementType    = Type;                           //!< Type of the compressed matrix elements.
+   using ReturnType     = const Type&;                    //!< Return type for expression template evaluations.
+   using CompositeType  = const This&;                    //!< Data type for composite expression templates.
+   using Reference      = MatrixAccessProxy<This>;        //!< Reference to a compressed matrix value.
+   using ConstReference = const Type&;                    //!< Reference to a constant compressed matrix value.
+   using Iterator       = Element*;                       //!< Iterator over non-constant elements.
+   using ConstIterator  = const Element*;                 //!< Iterator over constant elements.
    //**********************************************************************************************
 
    //**Rebind struct definition********************************************************************
@@ -334,7 +357,7 @@ class CompressedMatrix
    */
    template< typename NewType >  // Data type of the other matrix
    struct Rebind {
-      using Other = CompressedMatrix<NewType,SO>;  //!< The type of the other CompressedMatrix.
+      using Other = CompressedMatrix<NewType,SO,IT>;  //!< The type of the other CompressedMatrix.
    };
    //**********************************************************************************************
 
@@ -344,7 +367,7 @@ class CompressedMatrix
    template< size_t NewM    // Number of rows of the other matrix
            , size_t NewN >  // Number of columns of the other matrix
    struct Resize {
-      using Other = CompressedMatrix<Type,SO>;  //!< The type of the other CompressedMatrix.
+      using Other = CompressedMatrix<Type,SO,IT>;  //!< The type of the other CompressedMatrix.
    };
    //**********************************************************************************************
 
@@ -560,8 +583,8 @@ class CompressedMatrix
 //
 //=================================================================================================
 
-template< typename Type, bool SO >
-const Type CompressedMatrix<Type,SO>::zero_{};
+template< typename Type, bool SO, typename IT >
+const Type CompressedMatrix<Type,SO,IT>::zero_{};
 
 
 
@@ -576,8 +599,9 @@ const Type CompressedMatrix<Type,SO>::zero_{};
 /*!\brief The default constructor for CompressedMatrix.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline CompressedMatrix<Type,SO>::CompressedMatrix()
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompressedMatrix<Type,SO,IT>::CompressedMatrix()
    : m_       ( 0UL )      // The current number of rows of the compressed matrix
    , n_       ( 0UL )      // The current number of columns of the compressed matrix
    , capacity_( 0UL )      // The current capacity of the pointer array
@@ -592,14 +616,20 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix()
 //
 // \param m The number of rows of the matrix.
 // \param n The number of columns of the matrix.
+// \exception std::invalid_argument Invalid number of columns for the index type.
 //
 // The matrix is initialized to the zero matrix and has no free capacity.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline CompressedMatrix<Type,SO>::CompressedMatrix( size_t m, size_t n )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompressedMatrix<Type,SO,IT>::CompressedMatrix( size_t m, size_t n )
    : CompressedMatrix( m, n, Uninitialized() )
 {
+   if( n > std::numeric_limits<IT>::max() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of columns for the index type" );
+   }
+
    for( size_t i=1UL; i<2UL*m_+2UL; ++i )
       begin_[i] = nullptr;
 }
@@ -612,14 +642,20 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix( size_t m, size_t n )
 // \param m The number of rows of the matrix.
 // \param n The number of columns of the matrix.
 // \param nonzeros The number of expected non-zero elements.
+// \exception std::invalid_argument Invalid number of columns for the index type.
 //
 // The matrix is initialized to the zero matrix.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline CompressedMatrix<Type,SO>::CompressedMatrix( size_t m, size_t n, size_t nonzeros )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompressedMatrix<Type,SO,IT>::CompressedMatrix( size_t m, size_t n, size_t nonzeros )
    : CompressedMatrix( m, n, Uninitialized() )
 {
+   if( n > std::numeric_limits<IT>::max() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of columns for the index type" );
+   }
+
    begin_[0UL] = allocate<Element>( nonzeros );
    for( size_t i=1UL; i<(2UL*m_+1UL); ++i )
       begin_[i] = begin_[0UL];
@@ -634,16 +670,22 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix( size_t m, size_t n, size_t n
 // \param m The number of rows of the matrix.
 // \param n The number of columns of the matrix.
 // \param nonzeros The expected number of non-zero elements in each row/column.
+// \exception std::invalid_argument Invalid number of columns for the index type.
 //
 // The matrix is initialized to the zero matrix and will have the specified capacity in each
 // row/column. Note that in case of a row-major matrix the given vector must have at least
 // \a m elements, in case of a column-major matrix at least \a n elements.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-CompressedMatrix<Type,SO>::CompressedMatrix( size_t m, size_t n, const std::vector<size_t>& nonzeros )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+CompressedMatrix<Type,SO,IT>::CompressedMatrix( size_t m, size_t n, const std::vector<size_t>& nonzeros )
    : CompressedMatrix( m, n, Uninitialized() )
 {
+   if( n > std::numeric_limits<IT>::max() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of columns for the index type" );
+   }
+
    BLAZE_USER_ASSERT( nonzeros.size() == m, "Size of capacity vector and number of rows don't match" );
 
    size_t newCapacity( 0UL );
@@ -679,8 +721,9 @@ CompressedMatrix<Type,SO>::CompressedMatrix( size_t m, size_t n, const std::vect
 // be default values.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline CompressedMatrix<Type,SO>::CompressedMatrix( initializer_list< initializer_list<Type> > list )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompressedMatrix<Type,SO,IT>::CompressedMatrix( initializer_list< initializer_list<Type> > list )
    : CompressedMatrix( list.size(), determineColumns( list ), blaze::nonZeros( list ) )
 {
    size_t i( 0UL );
@@ -708,8 +751,9 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix( initializer_list< initialize
 // \param sm Sparse matrix to be copied.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline CompressedMatrix<Type,SO>::CompressedMatrix( const CompressedMatrix& sm )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompressedMatrix<Type,SO,IT>::CompressedMatrix( const CompressedMatrix& sm )
    : CompressedMatrix( sm.m_, sm.n_, Uninitialized() )
 {
    const size_t nonzeros( sm.nonZeros() );
@@ -730,8 +774,9 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix( const CompressedMatrix& sm )
 // \param sm The compressed matrix to be moved into this instance.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline CompressedMatrix<Type,SO>::CompressedMatrix( CompressedMatrix&& sm ) noexcept
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompressedMatrix<Type,SO,IT>::CompressedMatrix( CompressedMatrix&& sm ) noexcept
    : m_       ( sm.m_ )         // The current number of rows of the compressed matrix
    , n_       ( sm.n_ )         // The current number of columns of the compressed matrix
    , capacity_( sm.capacity_ )  // The current capacity of the pointer array
@@ -753,15 +798,14 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix( CompressedMatrix&& sm ) noex
 // \param dm Dense matrix to be copied.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename IT >  // Index type
 template< typename MT    // Type of the foreign dense matrix
         , bool SO2 >     // Storage order of the foreign dense matrix
-inline CompressedMatrix<Type,SO>::CompressedMatrix( const DenseMatrix<MT,SO2>& dm )
+inline CompressedMatrix<Type,SO,IT>::CompressedMatrix( const DenseMatrix<MT,SO2>& dm )
    : CompressedMatrix( (~dm).rows(), (~dm).columns() )
 {
-   using blaze::assign;
-
-   assign( *this, ~dm );
+   smpAssign( *this, ~dm );
 }
 //*************************************************************************************************
 
@@ -772,15 +816,14 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix( const DenseMatrix<MT,SO2>& d
 // \param sm Sparse matrix to be copied.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename IT >  // Index type
 template< typename MT    // Type of the foreign compressed matrix
         , bool SO2 >     // Storage order of the foreign compressed matrix
-inline CompressedMatrix<Type,SO>::CompressedMatrix( const SparseMatrix<MT,SO2>& sm )
+inline CompressedMatrix<Type,SO,IT>::CompressedMatrix( const SparseMatrix<MT,SO2>& sm )
    : CompressedMatrix( (~sm).rows(), (~sm).columns(), (~sm).nonZeros() )
 {
-   using blaze::assign;
-
-   assign( *this, ~sm );
+   smpAssign( *this, ~sm );
 }
 //*************************************************************************************************
 
@@ -792,8 +835,9 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix( const SparseMatrix<MT,SO2>&
 // \param n The number of columns of the matrix.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline CompressedMatrix<Type,SO>::CompressedMatrix( size_t m, size_t n, Uninitialized )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompressedMatrix<Type,SO,IT>::CompressedMatrix( size_t m, size_t n, Uninitialized )
    : m_       ( m )                     // The current number of rows of the compressed matrix
    , n_       ( n )                     // The current number of columns of the compressed matrix
    , capacity_( m )                     // The current capacity of the pointer array
@@ -817,8 +861,9 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix( size_t m, size_t n, Uninitia
 /*!\brief The destructor for CompressedMatrix.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline CompressedMatrix<Type,SO>::~CompressedMatrix()
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompressedMatrix<Type,SO,IT>::~CompressedMatrix()
 {
    if( begin_ != nullptr ) {
       deallocate( begin_[0UL] );
@@ -850,9 +895,10 @@ inline CompressedMatrix<Type,SO>::~CompressedMatrix()
 // check of the given access indices.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::Reference
-   CompressedMatrix<Type,SO>::operator()( size_t i, size_t j ) noexcept
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::Reference
+   CompressedMatrix<Type,SO,IT>::operator()( size_t i, size_t j ) noexcept
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
@@ -873,9 +919,10 @@ inline typename CompressedMatrix<Type,SO>::Reference
 // the at() function is guaranteed to perform a check of the given access indices.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::ConstReference
-   CompressedMatrix<Type,SO>::operator()( size_t i, size_t j ) const noexcept
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::ConstReference
+   CompressedMatrix<Type,SO,IT>::operator()( size_t i, size_t j ) const noexcept
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
@@ -904,9 +951,10 @@ inline typename CompressedMatrix<Type,SO>::ConstReference
 // always performs a check of the given access indices.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::Reference
-   CompressedMatrix<Type,SO>::at( size_t i, size_t j )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::Reference
+   CompressedMatrix<Type,SO,IT>::at( size_t i, size_t j )
 {
    if( i >= m_ ) {
       BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
@@ -931,9 +979,10 @@ inline typename CompressedMatrix<Type,SO>::Reference
 // access indices.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::ConstReference
-   CompressedMatrix<Type,SO>::at( size_t i, size_t j ) const
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::ConstReference
+   CompressedMatrix<Type,SO,IT>::at( size_t i, size_t j ) const
 {
    if( i >= m_ ) {
       BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
@@ -958,9 +1007,10 @@ inline typename CompressedMatrix<Type,SO>::ConstReference
 // returns an iterator to the first non-zero element of column \a i.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::Iterator
-   CompressedMatrix<Type,SO>::begin( size_t i ) noexcept
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::Iterator
+   CompressedMatrix<Type,SO,IT>::begin( size_t i ) noexcept
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid compressed matrix row access index" );
    return begin_[i];
@@ -980,9 +1030,10 @@ inline typename CompressedMatrix<Type,SO>::Iterator
 // returns an iterator to the first non-zero element of column \a i.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::ConstIterator
-   CompressedMatrix<Type,SO>::begin( size_t i ) const noexcept
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::ConstIterator
+   CompressedMatrix<Type,SO,IT>::begin( size_t i ) const noexcept
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid compressed matrix row access index" );
    return begin_[i];
@@ -1002,9 +1053,10 @@ inline typename CompressedMatrix<Type,SO>::ConstIterator
 // returns an iterator to the first non-zero element of column \a i.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::ConstIterator
-   CompressedMatrix<Type,SO>::cbegin( size_t i ) const noexcept
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::ConstIterator
+   CompressedMatrix<Type,SO,IT>::cbegin( size_t i ) const noexcept
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid compressed matrix row access index" );
    return begin_[i];
@@ -1024,9 +1076,10 @@ inline typename CompressedMatrix<Type,SO>::ConstIterator
 // the function returns an iterator just past the last non-zero element of column \a i.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::Iterator
-   CompressedMatrix<Type,SO>::end( size_t i ) noexcept
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::Iterator
+   CompressedMatrix<Type,SO,IT>::end( size_t i ) noexcept
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid compressed matrix row access index" );
    return end_[i];
@@ -1046,9 +1099,10 @@ inline typename CompressedMatrix<Type,SO>::Iterator
 // the function returns an iterator just past the last non-zero element of column \a i.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::ConstIterator
-   CompressedMatrix<Type,SO>::end( size_t i ) const noexcept
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::ConstIterator
+   CompressedMatrix<Type,SO,IT>::end( size_t i ) const noexcept
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid compressed matrix row access index" );
    return end_[i];
@@ -1068,9 +1122,10 @@ inline typename CompressedMatrix<Type,SO>::ConstIterator
 // the function returns an iterator just past the last non-zero element of column \a i.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::ConstIterator
-   CompressedMatrix<Type,SO>::cend( size_t i ) const noexcept
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::ConstIterator
+   CompressedMatrix<Type,SO,IT>::cend( size_t i ) const noexcept
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid compressed matrix row access index" );
    return end_[i];
@@ -1108,9 +1163,10 @@ inline typename CompressedMatrix<Type,SO>::ConstIterator
 // be default values.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline CompressedMatrix<Type,SO>&
-   CompressedMatrix<Type,SO>::operator=( initializer_list< initializer_list<Type> > list )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompressedMatrix<Type,SO,IT>&
+   CompressedMatrix<Type,SO,IT>::operator=( initializer_list< initializer_list<Type> > list )
 {
    using blaze::nonZeros;
 
@@ -1148,9 +1204,10 @@ inline CompressedMatrix<Type,SO>&
 // as a copy of this matrix.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline CompressedMatrix<Type,SO>&
-   CompressedMatrix<Type,SO>::operator=( const CompressedMatrix& rhs )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompressedMatrix<Type,SO,IT>&
+   CompressedMatrix<Type,SO,IT>::operator=( const CompressedMatrix& rhs )
 {
    using std::swap;
 
@@ -1201,9 +1258,10 @@ inline CompressedMatrix<Type,SO>&
 // \return Reference to the assigned compressed matrix.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline CompressedMatrix<Type,SO>&
-   CompressedMatrix<Type,SO>::operator=( CompressedMatrix&& rhs ) noexcept
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompressedMatrix<Type,SO,IT>&
+   CompressedMatrix<Type,SO,IT>::operator=( CompressedMatrix&& rhs ) noexcept
 {
    if( begin_ != nullptr ) {
       deallocate( begin_[0UL] );
@@ -1237,21 +1295,20 @@ inline CompressedMatrix<Type,SO>&
 // copy of this matrix.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename IT >  // Index type
 template< typename MT    // Type of the right-hand side dense matrix
         , bool SO2 >     // Storage order of the right-hand side dense matrix
-inline CompressedMatrix<Type,SO>&
-   CompressedMatrix<Type,SO>::operator=( const DenseMatrix<MT,SO2>& rhs )
+inline CompressedMatrix<Type,SO,IT>&
+   CompressedMatrix<Type,SO,IT>::operator=( const DenseMatrix<MT,SO2>& rhs )
 {
-   using blaze::assign;
-
    if( (~rhs).canAlias( this ) ) {
       CompressedMatrix tmp( ~rhs );
       swap( tmp );
    }
    else {
       resize( (~rhs).rows(), (~rhs).columns(), false );
-      assign( *this, ~rhs );
+      smpAssign( *this, ~rhs );
    }
 
    return *this;
@@ -1269,14 +1326,13 @@ inline CompressedMatrix<Type,SO>&
 // copy of this matrix.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename IT >  // Index type
 template< typename MT    // Type of the right-hand side compressed matrix
         , bool SO2 >     // Storage order of the right-hand side compressed matrix
-inline CompressedMatrix<Type,SO>&
-   CompressedMatrix<Type,SO>::operator=( const SparseMatrix<MT,SO2>& rhs )
+inline CompressedMatrix<Type,SO,IT>&
+   CompressedMatrix<Type,SO,IT>::operator=( const SparseMatrix<MT,SO2>& rhs )
 {
-   using blaze::assign;
-
    if( (~rhs).canAlias( this ) ||
        (~rhs).rows()     > capacity_ ||
        (~rhs).nonZeros() > capacity() ) {
@@ -1288,7 +1344,7 @@ inline CompressedMatrix<Type,SO>&
       reset();
 
       if( !IsZero_v<MT> ) {
-         assign( *this, ~rhs );
+         smpAssign( *this, ~rhs );
       }
    }
 
@@ -1308,20 +1364,19 @@ inline CompressedMatrix<Type,SO>&
 // is thrown.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename IT >  // Index type
 template< typename MT    // Type of the right-hand side matrix
         , bool SO2 >     // Storage order of the right-hand side matrix
-inline CompressedMatrix<Type,SO>&
-   CompressedMatrix<Type,SO>::operator+=( const Matrix<MT,SO2>& rhs )
+inline CompressedMatrix<Type,SO,IT>&
+   CompressedMatrix<Type,SO,IT>::operator+=( const Matrix<MT,SO2>& rhs )
 {
-   using blaze::addAssign;
-
    if( (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
       BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
    }
 
    if( !IsZero_v<MT> ) {
-      addAssign( *this, ~rhs );
+      smpAddAssign( *this, ~rhs );
    }
 
    return *this;
@@ -1340,19 +1395,18 @@ inline CompressedMatrix<Type,SO>&
 // is thrown.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename IT >  // Index type
 template< typename MT    // Type of the right-hand side matrix
         , bool SO2 >     // Storage order of the right-hand side matrix
-inline CompressedMatrix<Type,SO>& CompressedMatrix<Type,SO>::operator-=( const Matrix<MT,SO2>& rhs )
+inline CompressedMatrix<Type,SO,IT>& CompressedMatrix<Type,SO,IT>::operator-=( const Matrix<MT,SO2>& rhs )
 {
-   using blaze::subAssign;
-
    if( (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
       BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
    }
 
    if( !IsZero_v<MT> ) {
-      subAssign( *this, ~rhs );
+      smpSubAssign( *this, ~rhs );
    }
 
    return *this;
@@ -1372,14 +1426,13 @@ inline CompressedMatrix<Type,SO>& CompressedMatrix<Type,SO>::operator-=( const M
 // is thrown.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename IT >  // Index type
 template< typename MT    // Type of the right-hand side dense matrix
         , bool SO2 >     // Storage order of the right-hand side dense matrix
-inline CompressedMatrix<Type,SO>&
-   CompressedMatrix<Type,SO>::operator%=( const DenseMatrix<MT,SO2>& rhs )
+inline CompressedMatrix<Type,SO,IT>&
+   CompressedMatrix<Type,SO,IT>::operator%=( const DenseMatrix<MT,SO2>& rhs )
 {
-   using blaze::schurAssign;
-
    if( (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
       BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
    }
@@ -1390,7 +1443,7 @@ inline CompressedMatrix<Type,SO>&
    }
    else {
       CompositeType_t<MT> tmp( ~rhs );
-      schurAssign( *this, tmp );
+      smpSchurAssign( *this, tmp );
    }
 
    return *this;
@@ -1410,11 +1463,12 @@ inline CompressedMatrix<Type,SO>&
 // is thrown.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename IT >  // Index type
 template< typename MT    // Type of the right-hand side sparse matrix
         , bool SO2 >     // Storage order of the right-hand side sparse matrix
-inline CompressedMatrix<Type,SO>&
-   CompressedMatrix<Type,SO>::operator%=( const SparseMatrix<MT,SO2>& rhs )
+inline CompressedMatrix<Type,SO,IT>&
+   CompressedMatrix<Type,SO,IT>::operator%=( const SparseMatrix<MT,SO2>& rhs )
 {
    if( (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
       BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
@@ -1447,8 +1501,9 @@ inline CompressedMatrix<Type,SO>&
 // \return The number of rows of the compressed matrix.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline size_t CompressedMatrix<Type,SO>::rows() const noexcept
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t CompressedMatrix<Type,SO,IT>::rows() const noexcept
 {
    return m_;
 }
@@ -1461,8 +1516,9 @@ inline size_t CompressedMatrix<Type,SO>::rows() const noexcept
 // \return The number of columns of the compressed matrix.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline size_t CompressedMatrix<Type,SO>::columns() const noexcept
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t CompressedMatrix<Type,SO,IT>::columns() const noexcept
 {
    return n_;
 }
@@ -1475,8 +1531,9 @@ inline size_t CompressedMatrix<Type,SO>::columns() const noexcept
 // \return The capacity of the compressed matrix.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline size_t CompressedMatrix<Type,SO>::capacity() const noexcept
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t CompressedMatrix<Type,SO,IT>::capacity() const noexcept
 {
    if( begin_ != nullptr )
       return end_[m_] - begin_[0UL];
@@ -1497,8 +1554,9 @@ inline size_t CompressedMatrix<Type,SO>::capacity() const noexcept
 // of column \a i.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline size_t CompressedMatrix<Type,SO>::capacity( size_t i ) const noexcept
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t CompressedMatrix<Type,SO,IT>::capacity( size_t i ) const noexcept
 {
    BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
    return begin_[i+1UL] - begin_[i];
@@ -1512,8 +1570,9 @@ inline size_t CompressedMatrix<Type,SO>::capacity( size_t i ) const noexcept
 // \return The number of non-zero elements in the compressed matrix.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline size_t CompressedMatrix<Type,SO>::nonZeros() const
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t CompressedMatrix<Type,SO,IT>::nonZeros() const
 {
    size_t nonzeros( 0UL );
 
@@ -1537,8 +1596,9 @@ inline size_t CompressedMatrix<Type,SO>::nonZeros() const
 // the number of non-zero elements in column \a i.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline size_t CompressedMatrix<Type,SO>::nonZeros( size_t i ) const
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t CompressedMatrix<Type,SO,IT>::nonZeros( size_t i ) const
 {
    BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
    return end_[i] - begin_[i];
@@ -1552,8 +1612,9 @@ inline size_t CompressedMatrix<Type,SO>::nonZeros( size_t i ) const
 // \return void
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void CompressedMatrix<Type,SO>::reset()
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompressedMatrix<Type,SO,IT>::reset()
 {
    for( size_t i=0UL; i<m_; ++i )
       end_[i] = begin_[i];
@@ -1573,8 +1634,9 @@ inline void CompressedMatrix<Type,SO>::reset()
 // Note that the capacity of the row/column remains unchanged.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void CompressedMatrix<Type,SO>::reset( size_t i )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompressedMatrix<Type,SO,IT>::reset( size_t i )
 {
    BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
    end_[i] = begin_[i];
@@ -1590,8 +1652,9 @@ inline void CompressedMatrix<Type,SO>::reset( size_t i )
 // After the clear() function, the size of the compressed matrix is 0.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void CompressedMatrix<Type,SO>::clear()
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompressedMatrix<Type,SO,IT>::clear()
 {
    if( end_ != nullptr )
       end_[0UL] = end_[m_];
@@ -1608,6 +1671,7 @@ inline void CompressedMatrix<Type,SO>::clear()
 // \param n The new number of columns of the compressed matrix.
 // \param preserve \a true if the old values of the matrix should be preserved, \a false if not.
 // \return void
+// \exception std::invalid_argument Invalid number of columns for the index type.
 //
 // This function resizes the matrix using the given size to \f$ m \times n \f$. During this
 // operation, new dynamic memory may be allocated in case the capacity of the matrix is too
@@ -1617,14 +1681,19 @@ inline void CompressedMatrix<Type,SO>::clear()
 // \a preserve flag can be set to \a true.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-void CompressedMatrix<Type,SO>::resize( size_t m, size_t n, bool preserve )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+void CompressedMatrix<Type,SO,IT>::resize( size_t m, size_t n, bool preserve )
 {
    using std::swap;
 
    BLAZE_INTERNAL_ASSERT( end_ >= begin_, "Invalid internal storage detected" );
    BLAZE_INTERNAL_ASSERT( begin_ == nullptr || size_t( end_ - begin_ ) == capacity_ + 1UL, "Invalid storage setting detected" );
 
+   if( n > std::numeric_limits<IT>::max() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of columns for the index type" );
+   }
+
    if( m == m_ && n == n_ ) return;
 
    if( begin_ == nullptr )
@@ -1714,8 +1783,9 @@ void CompressedMatrix<Type,SO>::resize( size_t m, size_t n, bool preserve )
 // are preserved.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void CompressedMatrix<Type,SO>::reserve( size_t nonzeros )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompressedMatrix<Type,SO,IT>::reserve( size_t nonzeros )
 {
    if( nonzeros > capacity() )
       reserveElements( nonzeros );
@@ -1738,8 +1808,9 @@ inline void CompressedMatrix<Type,SO>::reserve( size_t nonzeros )
 // \a i and the index has to be in the range \f$[0..N-1]\f$.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-void CompressedMatrix<Type,SO>::reserve( size_t i, size_t nonzeros )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+void CompressedMatrix<Type,SO,IT>::reserve( size_t i, size_t nonzeros )
 {
    using std::swap;
 
@@ -1810,8 +1881,9 @@ void CompressedMatrix<Type,SO>::reserve( size_t i, size_t nonzeros )
 // remove the overall capacity but only reduces the capacity per row/column.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void CompressedMatrix<Type,SO>::trim()
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompressedMatrix<Type,SO,IT>::trim()
 {
    for( size_t i=0UL; i<m_; ++i )
       trim( i );
@@ -1831,8 +1903,9 @@ inline void CompressedMatrix<Type,SO>::trim()
 // subsequent row/column.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void CompressedMatrix<Type,SO>::trim( size_t i )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompressedMatrix<Type,SO,IT>::trim( size_t i )
 {
    BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
 
@@ -1853,8 +1926,9 @@ inline void CompressedMatrix<Type,SO>::trim( size_t i )
 // and references to elements of this matrix are invalidated.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void CompressedMatrix<Type,SO>::shrinkToFit()
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompressedMatrix<Type,SO,IT>::shrinkToFit()
 {
    if( nonZeros() < capacity() ) {
       CompressedMatrix( *this ).swap( *this );
@@ -1870,8 +1944,9 @@ inline void CompressedMatrix<Type,SO>::shrinkToFit()
 // \return void
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void CompressedMatrix<Type,SO>::swap( CompressedMatrix& sm ) noexcept
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompressedMatrix<Type,SO,IT>::swap( CompressedMatrix& sm ) noexcept
 {
    using std::swap;
 
@@ -1893,8 +1968,9 @@ inline void CompressedMatrix<Type,SO>::swap( CompressedMatrix& sm ) noexcept
 // matrix. Note that the new capacity is restricted to the interval \f$[7..M \cdot N]\f$.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline size_t CompressedMatrix<Type,SO>::extendCapacity() const noexcept
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t CompressedMatrix<Type,SO,IT>::extendCapacity() const noexcept
 {
    size_t nonzeros( 2UL*capacity()+1UL );
    nonzeros = blaze::max( nonzeros, 7UL   );
@@ -1913,8 +1989,9 @@ inline size_t CompressedMatrix<Type,SO>::extendCapacity() const noexcept
 // \return void
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-void CompressedMatrix<Type,SO>::reserveElements( size_t nonzeros )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+void CompressedMatrix<Type,SO,IT>::reserveElements( size_t nonzeros )
 {
    using std::swap;
 
@@ -1951,9 +2028,10 @@ void CompressedMatrix<Type,SO>::reserveElements( size_t nonzeros )
 // derived elements.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::Iterator
-   CompressedMatrix<Type,SO>::castDown( IteratorBase it ) const noexcept
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::Iterator
+   CompressedMatrix<Type,SO,IT>::castDown( IteratorBase it ) const noexcept
 {
    return static_cast<Iterator>( it );
 }
@@ -1969,9 +2047,10 @@ inline typename CompressedMatrix<Type,SO>::Iterator
 // to base elements.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::IteratorBase
-   CompressedMatrix<Type,SO>::castUp( Iterator it ) const noexcept
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::IteratorBase
+   CompressedMatrix<Type,SO,IT>::castUp( Iterator it ) const noexcept
 {
    return static_cast<IteratorBase>( it );
 }
@@ -1999,9 +2078,10 @@ inline typename CompressedMatrix<Type,SO>::IteratorBase
 // modified, else a new element with the given \a value is inserted.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::Iterator
-   CompressedMatrix<Type,SO>::set( size_t i, size_t j, const Type& value )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::Iterator
+   CompressedMatrix<Type,SO,IT>::set( size_t i, size_t j, const Type& value )
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
@@ -2031,9 +2111,10 @@ inline typename CompressedMatrix<Type,SO>::Iterator
 // and column index \a j, a \a std::invalid_argument exception is thrown.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::Iterator
-   CompressedMatrix<Type,SO>::insert( size_t i, size_t j, const Type& value )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::Iterator
+   CompressedMatrix<Type,SO,IT>::insert( size_t i, size_t j, const Type& value )
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
@@ -2060,9 +2141,10 @@ inline typename CompressedMatrix<Type,SO>::Iterator
 // \exception std::invalid_argument Invalid compressed matrix access index.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-typename CompressedMatrix<Type,SO>::Iterator
-   CompressedMatrix<Type,SO>::insert( Iterator pos, size_t i, size_t j, const Type& value )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+typename CompressedMatrix<Type,SO,IT>::Iterator
+   CompressedMatrix<Type,SO,IT>::insert( Iterator pos, size_t i, size_t j, const Type& value )
 {
    using std::swap;
 
@@ -2182,8 +2264,9 @@ typename CompressedMatrix<Type,SO>::Iterator
 // returned by the end() functions!
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void CompressedMatrix<Type,SO>::append( size_t i, size_t j, const Type& value, bool check )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompressedMatrix<Type,SO,IT>::append( size_t i, size_t j, const Type& value, bool check )
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < n_, "Invalid column access index" );
@@ -2214,8 +2297,9 @@ inline void CompressedMatrix<Type,SO>::append( size_t i, size_t j, const Type& v
 // returned by the end() functions!
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void CompressedMatrix<Type,SO>::finalize( size_t i )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompressedMatrix<Type,SO,IT>::finalize( size_t i )
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid row access index" );
 
@@ -2244,8 +2328,9 @@ inline void CompressedMatrix<Type,SO>::finalize( size_t i )
 // This function erases an element from the compressed matrix.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void CompressedMatrix<Type,SO>::erase( size_t i, size_t j )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompressedMatrix<Type,SO,IT>::erase( size_t i, size_t j )
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
@@ -2269,9 +2354,10 @@ inline void CompressedMatrix<Type,SO>::erase( size_t i, size_t j )
 // to \a columnMajor the function erases an element from column \a i.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::Iterator
-   CompressedMatrix<Type,SO>::erase( size_t i, Iterator pos )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::Iterator
+   CompressedMatrix<Type,SO,IT>::erase( size_t i, Iterator pos )
 {
    BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
    BLAZE_USER_ASSERT( pos >= begin_[i] && pos <= end_[i], "Invalid compressed matrix iterator" );
@@ -2297,9 +2383,10 @@ inline typename CompressedMatrix<Type,SO>::Iterator
 // flag is set to \a columnMajor the function erases a range of elements from column \a i.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::Iterator
-   CompressedMatrix<Type,SO>::erase( size_t i, Iterator first, Iterator last )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::Iterator
+   CompressedMatrix<Type,SO,IT>::erase( size_t i, Iterator first, Iterator last )
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index" );
    BLAZE_USER_ASSERT( first <= last, "Invalid iterator range"   );
@@ -2336,9 +2423,10 @@ inline typename CompressedMatrix<Type,SO>::Iterator
 // with the same value. The attempt to use an impure predicate leads to undefined behavior!
 */
 template< typename Type    // Data type of the matrix
-        , bool SO >        // Storage order
+        , bool SO          // Storage order
+        , typename IT >    // Index type
 template< typename Pred >  // Type of the unary predicate
-inline void CompressedMatrix<Type,SO>::erase( Pred predicate )
+inline void CompressedMatrix<Type,SO,IT>::erase( Pred predicate )
 {
    for( size_t i=0UL; i<m_; ++i ) {
       end_[i] = castDown( std::remove_if( castUp( begin_[i] ), castUp( end_[i] ),
@@ -2378,9 +2466,10 @@ inline void CompressedMatrix<Type,SO>::erase( Pred predicate )
 // with the same value. The attempt to use an impure predicate leads to undefined behavior!
 */
 template< typename Type    // Data type of the matrix
-        , bool SO >        // Storage order
+        , bool SO          // Storage order
+        , typename IT >    // Index type
 template< typename Pred >  // Type of the unary predicate
-inline void CompressedMatrix<Type,SO>::erase( size_t i, Iterator first, Iterator last, Pred predicate )
+inline void CompressedMatrix<Type,SO,IT>::erase( size_t i, Iterator first, Iterator last, Pred predicate )
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index" );
    BLAZE_USER_ASSERT( first <= last, "Invalid iterator range"   );
@@ -2421,9 +2510,10 @@ inline void CompressedMatrix<Type,SO>::erase( size_t i, Iterator first, Iterator
 // function or the insert() function!
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::Iterator
-   CompressedMatrix<Type,SO>::find( size_t i, size_t j )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::Iterator
+   CompressedMatrix<Type,SO,IT>::find( size_t i, size_t j )
 {
    return const_cast<Iterator>( const_cast<const This&>( *this ).find( i, j ) );
 }
@@ -2446,9 +2536,10 @@ inline typename CompressedMatrix<Type,SO>::Iterator
 // function or the insert() function!
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::ConstIterator
-   CompressedMatrix<Type,SO>::find( size_t i, size_t j ) const
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::ConstIterator
+   CompressedMatrix<Type,SO,IT>::find( size_t i, size_t j ) const
 {
    const ConstIterator pos( lowerBound( i, j ) );
    if( pos != end_[i] && pos->index_ == j )
@@ -2474,9 +2565,10 @@ inline typename CompressedMatrix<Type,SO>::ConstIterator
 // the set() function or the insert() function!
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::Iterator
-   CompressedMatrix<Type,SO>::lowerBound( size_t i, size_t j )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::Iterator
+   CompressedMatrix<Type,SO,IT>::lowerBound( size_t i, size_t j )
 {
    return const_cast<Iterator>( const_cast<const This&>( *this ).lowerBound( i, j ) );
 }
@@ -2499,9 +2591,10 @@ inline typename CompressedMatrix<Type,SO>::Iterator
 // the set() function or the insert() function!
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::ConstIterator
-   CompressedMatrix<Type,SO>::lowerBound( size_t i, size_t j ) const
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::ConstIterator
+   CompressedMatrix<Type,SO,IT>::lowerBound( size_t i, size_t j ) const
 {
    BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
    return std::lower_bound( begin_[i], end_[i], j,
@@ -2529,9 +2622,10 @@ inline typename CompressedMatrix<Type,SO>::ConstIterator
 // the set() function or or the insert() function!
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::Iterator
-   CompressedMatrix<Type,SO>::upperBound( size_t i, size_t j )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::Iterator
+   CompressedMatrix<Type,SO,IT>::upperBound( size_t i, size_t j )
 {
    return const_cast<Iterator>( const_cast<const This&>( *this ).upperBound( i, j ) );
 }
@@ -2554,9 +2648,10 @@ inline typename CompressedMatrix<Type,SO>::Iterator
 // the set() function or the insert() function!
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::ConstIterator
-   CompressedMatrix<Type,SO>::upperBound( size_t i, size_t j ) const
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::ConstIterator
+   CompressedMatrix<Type,SO,IT>::upperBound( size_t i, size_t j ) const
 {
    BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
    return std::upper_bound( begin_[i], end_[i], j,
@@ -2582,8 +2677,9 @@ inline typename CompressedMatrix<Type,SO>::ConstIterator
 // \return Reference to the transposed matrix.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline CompressedMatrix<Type,SO>& CompressedMatrix<Type,SO>::transpose()
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompressedMatrix<Type,SO,IT>& CompressedMatrix<Type,SO,IT>::transpose()
 {
    CompressedMatrix tmp( trans( *this ) );
    swap( tmp );
@@ -2598,8 +2694,9 @@ inline CompressedMatrix<Type,SO>& CompressedMatrix<Type,SO>::transpose()
 // \return Reference to the transposed matrix.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline CompressedMatrix<Type,SO>& CompressedMatrix<Type,SO>::ctranspose()
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompressedMatrix<Type,SO,IT>& CompressedMatrix<Type,SO,IT>::ctranspose()
 {
    CompressedMatrix tmp( ctrans( *this ) );
    swap( tmp );
@@ -2626,9 +2723,10 @@ inline CompressedMatrix<Type,SO>& CompressedMatrix<Type,SO>::ctranspose()
    \endcode
 */
 template< typename Type     // Data type of the matrix
-        , bool SO >         // Storage order
+        , bool SO           // Storage order
+        , typename IT >     // Index type
 template< typename Other >  // Data type of the scalar value
-inline CompressedMatrix<Type,SO>& CompressedMatrix<Type,SO>::scale( const Other& scalar )
+inline CompressedMatrix<Type,SO,IT>& CompressedMatrix<Type,SO,IT>::scale( const Other& scalar )
 {
    for( size_t i=0UL; i<m_; ++i )
       for( auto element=begin_[i]; element!=end_[i]; ++element )
@@ -2658,9 +2756,10 @@ inline CompressedMatrix<Type,SO>& CompressedMatrix<Type,SO>::scale( const Other&
 // to optimize the evaluation.
 */
 template< typename Type     // Data type of the matrix
-        , bool SO >         // Storage order
+        , bool SO           // Storage order
+        , typename IT >     // Index type
 template< typename Other >  // Data type of the foreign expression
-inline bool CompressedMatrix<Type,SO>::canAlias( const Other* alias ) const noexcept
+inline bool CompressedMatrix<Type,SO,IT>::canAlias( const Other* alias ) const noexcept
 {
    return static_cast<const void*>( this ) == static_cast<const void*>( alias );
 }
@@ -2678,9 +2777,10 @@ inline bool CompressedMatrix<Type,SO>::canAlias( const Other* alias ) const noex
 // to optimize the evaluation.
 */
 template< typename Type     // Data type of the matrix
-        , bool SO >         // Storage order
+        , bool SO           // Storage order
+        , typename IT >     // Index type
 template< typename Other >  // Data type of the foreign expression
-inline bool CompressedMatrix<Type,SO>::isAliased( const Other* alias ) const noexcept
+inline bool CompressedMatrix<Type,SO,IT>::isAliased( const Other* alias ) const noexcept
 {
    return static_cast<const void*>( this ) == static_cast<const void*>( alias );
 }
@@ -2698,10 +2798,11 @@ inline bool CompressedMatrix<Type,SO>::isAliased( const Other* alias ) const noe
 // rows and/or columns of the matrix).
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline bool CompressedMatrix<Type,SO>::canSMPAssign() const noexcept
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline bool CompressedMatrix<Type,SO,IT>::canSMPAssign() const noexcept
 {
-   return false;
+   return ( nonZeros() >= SMP_SMATASSIGN_THRESHOLD );
 }
 //*************************************************************************************************
 
@@ -2718,10 +2819,11 @@ inline bool CompressedMatrix<Type,SO>::canSMPAssign() const noexcept
 // assignment operator.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename IT >  // Index type
 template< typename MT    // Type of the right-hand side dense matrix
         , bool SO2 >     // Storage order of the right-hand side dense matrix
-inline void CompressedMatrix<Type,SO>::assign( const DenseMatrix<MT,SO2>& rhs )
+inline void CompressedMatrix<Type,SO,IT>::assign( const DenseMatrix<MT,SO2>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -2780,9 +2882,10 @@ inline void CompressedMatrix<Type,SO>::assign( const DenseMatrix<MT,SO2>& rhs )
 // assignment operator.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename IT >  // Index type
 template< typename MT >  // Type of the right-hand side compressed matrix
-inline void CompressedMatrix<Type,SO>::assign( const SparseMatrix<MT,SO>& rhs )
+inline void CompressedMatrix<Type,SO,IT>::assign( const SparseMatrix<MT,SO>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -2812,9 +2915,10 @@ inline void CompressedMatrix<Type,SO>::assign( const SparseMatrix<MT,SO>& rhs )
 // assignment operator.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename IT >  // Index type
 template< typename MT >  // Type of the right-hand side compressed matrix
-inline void CompressedMatrix<Type,SO>::assign( const SparseMatrix<MT,!SO>& rhs )
+inline void CompressedMatrix<Type,SO,IT>::assign( const SparseMatrix<MT,!SO>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
 
@@ -2856,10 +2960,11 @@ inline void CompressedMatrix<Type,SO>::assign( const SparseMatrix<MT,!SO>& rhs )
 // assignment operator.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename IT >  // Index type
 template< typename MT    // Type of the right-hand side dense matrix
         , bool SO2 >     // Storage order of the right-hand side dense matrix
-inline void CompressedMatrix<Type,SO>::addAssign( const DenseMatrix<MT,SO2>& rhs )
+inline void CompressedMatrix<Type,SO,IT>::addAssign( const DenseMatrix<MT,SO2>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -2882,10 +2987,11 @@ inline void CompressedMatrix<Type,SO>::addAssign( const DenseMatrix<MT,SO2>& rhs
 // assignment operator.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename IT >  // Index type
 template< typename MT    // Type of the right-hand side compressed matrix
         , bool SO2 >     // Storage order of the right-hand side compressed matrix
-inline void CompressedMatrix<Type,SO>::addAssign( const SparseMatrix<MT,SO2>& rhs )
+inline void CompressedMatrix<Type,SO,IT>::addAssign( const SparseMatrix<MT,SO2>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -2908,10 +3014,11 @@ inline void CompressedMatrix<Type,SO>::addAssign( const SparseMatrix<MT,SO2>& rh
 // assignment operator.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename IT >  // Index type
 template< typename MT    // Type of the right-hand side dense matrix
         , bool SO2 >     // Storage order of the right-hand side dense matrix
-inline void CompressedMatrix<Type,SO>::subAssign( const DenseMatrix<MT,SO2>& rhs )
+inline void CompressedMatrix<Type,SO,IT>::subAssign( const DenseMatrix<MT,SO2>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -2934,10 +3041,11 @@ inline void CompressedMatrix<Type,SO>::subAssign( const DenseMatrix<MT,SO2>& rhs
 // assignment operator.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename IT >  // Index type
 template< typename MT    // Type of the right-hand side compressed matrix
         , bool SO2 >     // Storage order of the right-hand compressed matrix
-inline void CompressedMatrix<Type,SO>::subAssign( const SparseMatrix<MT,SO2>& rhs )
+inline void CompressedMatrix<Type,SO,IT>::subAssign( const SparseMatrix<MT,SO2>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -2960,10 +3068,11 @@ inline void CompressedMatrix<Type,SO>::subAssign( const SparseMatrix<MT,SO2>& rh
 // assignment operator.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename IT >  // Index type
 template< typename MT    // Type of the right-hand side dense matrix
         , bool SO2 >     // Storage order of the right-hand side dense matrix
-inline void CompressedMatrix<Type,SO>::schurAssign( const DenseMatrix<MT,SO2>& rhs )
+inline void CompressedMatrix<Type,SO,IT>::schurAssign( const DenseMatrix<MT,SO2>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -2999,13 +3108,14 @@ inline void CompressedMatrix<Type,SO>::schurAssign( const DenseMatrix<MT,SO2>& r
 // This specialization of CompressedMatrix adapts the class template to the requirements of
 // column-major matrices.
 */
-template< typename Type >  // Data type of the matrix
-class CompressedMatrix<Type,true>
-   : public SparseMatrix< CompressedMatrix<Type,true>, true >
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
+class CompressedMatrix<Type,true,IT>
+   : public SparseMatrix< CompressedMatrix<Type,true,IT>, true >
 {
  private:
    //**Type definitions****************************************************************************
-   using ElementBase  = ValueIndexPair<Type>;  //!< Base class for the compressed matrix element.
+   using ElementBase  = ValueIndexPair<Type,IT>;  //!< Base class for the compressed matrix element.
    using IteratorBase = ElementBase*;          //!< Iterator over non-constant base elements.
    //**********************************************************************************************
 
@@ -3086,18 +3196,18 @@ class CompressedMatrix<Type,true>
 
  public:
    //**Type definitions****************************************************************************
-   using This           = CompressedMatrix<Type,true>;   //!< Type of this CompressedMatrix instance.
-   using BaseType       = SparseMatrix<This,true>;       //!< Base type of this CompressedMatrix instance.
-   using ResultType     = This;                          //!< Result type for expression template evaluations.
-   using OppositeType   = CompressedMatrix<Type,false>;  //!< Result type with opposite storage order for expression template evaluations.
-   using TransposeType  = CompressedMatrix<Type,false>;  //!< Transpose type for expression template evaluations.
-   using ElementType    = Type;                          //!< Type of the compressed matrix elements.
-   using ReturnType     = const Type&;                   //!< Return type for expression template evaluations.
-   using CompositeType  = const This&;                   //!< Data type for composite expression templates.
-   using Reference      = MatrixAccessProxy<This>;       //!< Reference to a non-constant matrix value.
-   using ConstReference = const Type&;                   //!< Reference to a constant matrix value.
-   using Iterator       = Element*;                      //!< Iterator over non-constant elements.
-   using ConstIterator  = const Element*;                //!< Iterator over constant elements.
+   using This           = CompressedMatrix<Type,true,IT>;   //!< Type of this CompressedMatrix instance.
+   using BaseType       = SparseMatrix<This,true>;          //!< Base type of this CompressedMatrix instance.
+   using ResultType     = This;                             //!< Result type for expression template evaluations.
+   using OppositeType   = CompressedMatrix<Type,false,IT>;  //!< Result type with opposite storage order for expression template evaluations.
+   using TransposeType  = CompressedMatrix<Type,false,IT>;  //!< Transpose type for expression template evaluations.
+   using ElementType    = Type;                             //!< Type of the compressed matrix elements.
+   using ReturnType     = const Type&;                      //!< Return type for expression template evaluations.
+   using CompositeType  = const This&;                      //!< Data type for composite expression templates.
+   using Reference      = MatrixAccessProxy<This>;          //!< Reference to a non-constant matrix value.
+   using ConstReference = const Type&;                      //!< Reference to a constant matrix value.
+   using Iterator       = Element*;                         //!< Iterator over non-constant elements.
+   using ConstIterator  = const Element*;                   //!< Iterator over constant elements.
    //**********************************************************************************************
 
    //**Rebind struct definition********************************************************************
@@ -3105,7 +3215,7 @@ class CompressedMatrix<Type,true>
    */
    template< typename NewType >  // Data type of the other matrix
    struct Rebind {
-      using Other = CompressedMatrix<NewType,true>;  //!< The type of the other CompressedMatrix.
+      using Other = CompressedMatrix<NewType,true,IT>;  //!< The type of the other CompressedMatrix.
    };
    //**********************************************************************************************
 
@@ -3115,7 +3225,7 @@ class CompressedMatrix<Type,true>
    template< size_t NewM    // Number of rows of the other matrix
            , size_t NewN >  // Number of columns of the other matrix
    struct Resize {
-      using Other = CompressedMatrix<Type,true>;  //!< The type of the other CompressedMatrix.
+      using Other = CompressedMatrix<Type,true,IT>;  //!< The type of the other CompressedMatrix.
    };
    //**********************************************************************************************
 
@@ -3330,8 +3440,8 @@ class CompressedMatrix<Type,true>
 //
 //=================================================================================================
 
-template< typename Type >
-const Type CompressedMatrix<Type,true>::zero_{};
+template< typename Type, typename IT >
+const Type CompressedMatrix<Type,true,IT>::zero_{};
 
 
 
@@ -3346,8 +3456,9 @@ const Type CompressedMatrix<Type,true>::zero_{};
 /*! \cond BLAZE_INTERNAL */
 /*!\brief The default constructor for CompressedMatrix.
 */
-template< typename Type >  // Data type of the matrix
-inline CompressedMatrix<Type,true>::CompressedMatrix()
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
+inline CompressedMatrix<Type,true,IT>::CompressedMatrix()
    : m_       ( 0UL )      // The current number of rows of the compressed matrix
    , n_       ( 0UL )      // The current number of columns of the compressed matrix
    , capacity_( 0UL )      // The current capacity of the pointer array
@@ -3364,13 +3475,19 @@ inline CompressedMatrix<Type,true>::CompressedMatrix()
 //
 // \param m The number of rows of the matrix.
 // \param n The number of columns of the matrix.
+// \exception std::invalid_argument Invalid number of rows for the index type.
 //
 // The matrix is initialized to the zero matrix and has no free capacity.
 */
-template< typename Type >  // Data type of the matrix
-inline CompressedMatrix<Type,true>::CompressedMatrix( size_t m, size_t n )
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
+inline CompressedMatrix<Type,true,IT>::CompressedMatrix( size_t m, size_t n )
    : CompressedMatrix( m, n, Uninitialized() )
 {
+   if( m > std::numeric_limits<IT>::max() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of rows for the index type" );
+   }
+
    for( size_t j=1UL; j<2UL*n_+2UL; ++j )
       begin_[j] = nullptr;
 }
@@ -3385,13 +3502,19 @@ inline CompressedMatrix<Type,true>::CompressedMatrix( size_t m, size_t n )
 // \param m The number of rows of the matrix.
 // \param n The number of columns of the matrix.
 // \param nonzeros The number of expected non-zero elements.
+// \exception std::invalid_argument Invalid number of rows for the index type.
 //
 // The matrix is initialized to the zero matrix.
 */
-template< typename Type >  // Data type of the matrix
-inline CompressedMatrix<Type,true>::CompressedMatrix( size_t m, size_t n, size_t nonzeros )
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
+inline CompressedMatrix<Type,true,IT>::CompressedMatrix( size_t m, size_t n, size_t nonzeros )
    : CompressedMatrix( m, n, Uninitialized() )
 {
+   if( m > std::numeric_limits<IT>::max() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of rows for the index type" );
+   }
+
    begin_[0UL] = allocate<Element>( nonzeros );
    for( size_t j=1UL; j<(2UL*n_+1UL); ++j )
       begin_[j] = begin_[0UL];
@@ -3408,14 +3531,20 @@ inline CompressedMatrix<Type,true>::CompressedMatrix( size_t m, size_t n, size_t
 // \param m The number of rows of the matrix.
 // \param n The number of columns of the matrix.
 // \param nonzeros The expected number of non-zero elements in each column.
+// \exception std::invalid_argument Invalid number of rows for the index type.
 //
 // The matrix is initialized to the zero matrix and will have the specified capacity in each
 // column. Note that the given vector must have at least \a n elements.
 */
-template< typename Type >  // Data type of the matrix
-CompressedMatrix<Type,true>::CompressedMatrix( size_t m, size_t n, const std::vector<size_t>& nonzeros )
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
+CompressedMatrix<Type,true,IT>::CompressedMatrix( size_t m, size_t n, const std::vector<size_t>& nonzeros )
    : CompressedMatrix( m, n, Uninitialized() )
 {
+   if( m > std::numeric_limits<IT>::max() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of rows for the index type" );
+   }
+
    BLAZE_USER_ASSERT( nonzeros.size() == n, "Size of capacity vector and number of columns don't match" );
 
    size_t newCapacity( 0UL );
@@ -3452,8 +3581,9 @@ CompressedMatrix<Type,true>::CompressedMatrix( size_t m, size_t n, const std::ve
 // initialized by the values of the given initializer list. Missing values are considered to
 // be default values.
 */
-template< typename Type >  // Data type of the matrix
-inline CompressedMatrix<Type,true>::CompressedMatrix( initializer_list< initializer_list<Type> > list )
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
+inline CompressedMatrix<Type,true,IT>::CompressedMatrix( initializer_list< initializer_list<Type> > list )
    : CompressedMatrix( list.size(), determineColumns( list ), blaze::nonZeros( list ) )
 {
    for( size_t j=0UL; j<n_; ++j )
@@ -3487,8 +3617,9 @@ inline CompressedMatrix<Type,true>::CompressedMatrix( initializer_list< initiali
 //
 // \param sm Sparse matrix to be copied.
 */
-template< typename Type >  // Data type of the matrix
-inline CompressedMatrix<Type,true>::CompressedMatrix( const CompressedMatrix& sm )
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
+inline CompressedMatrix<Type,true,IT>::CompressedMatrix( const CompressedMatrix& sm )
    : CompressedMatrix( sm.m_, sm.n_, Uninitialized() )
 {
    const size_t nonzeros( sm.nonZeros() );
@@ -3510,8 +3641,9 @@ inline CompressedMatrix<Type,true>::CompressedMatrix( const CompressedMatrix& sm
 //
 // \param sm The compressed matrix to be moved into this instance.
 */
-template< typename Type >  // Data type of the matrix
-inline CompressedMatrix<Type,true>::CompressedMatrix( CompressedMatrix&& sm ) noexcept
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
+inline CompressedMatrix<Type,true,IT>::CompressedMatrix( CompressedMatrix&& sm ) noexcept
    : m_       ( sm.m_ )         // The current number of rows of the compressed matrix
    , n_       ( sm.n_ )         // The current number of columns of the compressed matrix
    , capacity_( sm.capacity_ )  // The current capacity of the pointer array
@@ -3534,15 +3666,14 @@ inline CompressedMatrix<Type,true>::CompressedMatrix( CompressedMatrix&& sm ) no
 //
 // \param dm Dense matrix to be copied.
 */
-template< typename Type >  // Data type of the matrix
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
 template< typename MT      // Type of the foreign dense matrix
         , bool SO >        // Storage order of the foreign dense matrix
-inline CompressedMatrix<Type,true>::CompressedMatrix( const DenseMatrix<MT,SO>& dm )
+inline CompressedMatrix<Type,true,IT>::CompressedMatrix( const DenseMatrix<MT,SO>& dm )
    : CompressedMatrix( (~dm).rows(), (~dm).columns() )
 {
-   using blaze::assign;
-
-   assign( *this, ~dm );
+   smpAssign( *this, ~dm );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -3554,15 +3685,14 @@ inline CompressedMatrix<Type,true>::CompressedMatrix( const DenseMatrix<MT,SO>&
 //
 // \param sm Sparse matrix to be copied.
 */
-template< typename Type >  // Data type of the matrix
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
 template< typename MT      // Type of the foreign compressed matrix
         , bool SO >        // Storage order of the foreign compressed matrix
-inline CompressedMatrix<Type,true>::CompressedMatrix( const SparseMatrix<MT,SO>& sm )
+inline CompressedMatrix<Type,true,IT>::CompressedMatrix( const SparseMatrix<MT,SO>& sm )
    : CompressedMatrix( (~sm).rows(), (~sm).columns(), (~sm).nonZeros() )
 {
-   using blaze::assign;
-
-   assign( *this, ~sm );
+   smpAssign( *this, ~sm );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -3575,8 +3705,9 @@ inline CompressedMatrix<Type,true>::CompressedMatrix( const SparseMatrix<MT,SO>&
 // \param m The number of rows of the matrix.
 // \param n The number of columns of the matrix.
 */
-template< typename Type >  // Data type of the matrix
-inline CompressedMatrix<Type,true>::CompressedMatrix( size_t m, size_t n, Uninitialized )
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
+inline CompressedMatrix<Type,true,IT>::CompressedMatrix( size_t m, size_t n, Uninitialized )
    : m_       ( m )                     // The current number of rows of the compressed matrix
    , n_       ( n )                     // The current number of columns of the compressed matrix
    , capacity_( n )                     // The current capacity of the pointer array
@@ -3601,8 +3732,9 @@ inline CompressedMatrix<Type,true>::CompressedMatrix( size_t m, size_t n, Uninit
 /*! \cond BLAZE_INTERNAL */
 /*!\brief The destructor for CompressedMatrix.
 */
-template< typename Type >  // Data type of the matrix
-inline CompressedMatrix<Type,true>::~CompressedMatrix()
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
+inline CompressedMatrix<Type,true,IT>::~CompressedMatrix()
 {
    if( begin_ != nullptr ) {
       deallocate( begin_[0UL] );
@@ -3635,9 +3767,10 @@ inline CompressedMatrix<Type,true>::~CompressedMatrix()
 // case BLAZE_USER_ASSERT() is active. In contrast, the at() function is guaranteed to perform a
 // check of the given access indices.
 */
-template< typename Type >  // Data type of the matrix
-inline typename CompressedMatrix<Type,true>::Reference
-   CompressedMatrix<Type,true>::operator()( size_t i, size_t j ) noexcept
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
+inline typename CompressedMatrix<Type,true,IT>::Reference
+   CompressedMatrix<Type,true,IT>::operator()( size_t i, size_t j ) noexcept
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
@@ -3659,9 +3792,10 @@ inline typename CompressedMatrix<Type,true>::Reference
 // This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
 // the at() function is guaranteed to perform a check of the given access indices.
 */
-template< typename Type >  // Data type of the matrix
-inline typename CompressedMatrix<Type,true>::ConstReference
-   CompressedMatrix<Type,true>::operator()( size_t i, size_t j ) const noexcept
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
+inline typename CompressedMatrix<Type,true,IT>::ConstReference
+   CompressedMatrix<Type,true,IT>::operator()( size_t i, size_t j ) const noexcept
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
@@ -3691,9 +3825,10 @@ inline typename CompressedMatrix<Type,true>::ConstReference
 // inserted into the compressed matrix. In contrast to the subscript operator this function
 // always performs a check of the given access indices.
 */
-template< typename Type >  // Data type of the matrix
-inline typename CompressedMatrix<Type,true>::Reference
-   CompressedMatrix<Type,true>::at( size_t i, size_t j )
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
+inline typename CompressedMatrix<Type,true,IT>::Reference
+   CompressedMatrix<Type,true,IT>::at( size_t i, size_t j )
 {
    if( i >= m_ ) {
       BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
@@ -3719,9 +3854,10 @@ inline typename CompressedMatrix<Type,true>::Reference
 // In contrast to the subscript operator this function always performs a check of the given
 // access indices.
 */
-template< typename Type >  // Data type of the matrix
-inline typename CompressedMatrix<Type,true>::ConstReference
-   CompressedMatrix<Type,true>::at( size_t i, size_t j ) const
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
+inline typename CompressedMatrix<Type,true,IT>::ConstReference
+   CompressedMatrix<Type,true,IT>::at( size_t i, size_t j ) const
 {
    if( i >= m_ ) {
       BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
@@ -3742,9 +3878,10 @@ inline typename CompressedMatrix<Type,true>::ConstReference
 // \param j The column index.
 // \return Iterator to the first non-zero element of column \a j.
 */
-template< typename Type >  // Data type of the matrix
-inline typename CompressedMatrix<Type,true>::Iterator
-   CompressedMatrix<Type,true>::begin( size_t j ) noexcept
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
+inline typename CompressedMatrix<Type,true,IT>::Iterator
+   CompressedMatrix<Type,true,IT>::begin( size_t j ) noexcept
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid compressed matrix column access index" );
    return begin_[j];
@@ -3760,9 +3897,10 @@ inline typename CompressedMatrix<Type,true>::Iterator
 // \param j The column index.
 // \return Iterator to the first non-zero element of column \a j.
 */
-template< typename Type >  // Data type of the matrix
-inline typename CompressedMatrix<Type,true>::ConstIterator
-   CompressedMatrix<Type,true>::begin( size_t j ) const noexcept
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
+inline typename CompressedMatrix<Type,true,IT>::ConstIterator
+   CompressedMatrix<Type,true,IT>::begin( size_t j ) const noexcept
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid compressed matrix column access index" );
    return begin_[j];
@@ -3778,9 +3916,10 @@ inline typename CompressedMatrix<Type,true>::ConstIterator
 // \param j The column index.
 // \return Iterator to the first non-zero element of column \a j.
 */
-template< typename Type >  // Data type of the matrix
-inline typename CompressedMatrix<Type,true>::ConstIterator
-   CompressedMatrix<Type,true>::cbegin( size_t j ) const noexcept
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
+inline typename CompressedMatrix<Type,true,IT>::ConstIterator
+   CompressedMatrix<Type,true,IT>::cbegin( size_t j ) const noexcept
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid compressed matrix column access index" );
    return begin_[j];
@@ -3796,9 +3935,10 @@ inline typename CompressedMatrix<Type,true>::ConstIterator
 // \param j The column index.
 // \return Iterator just past the last non-zero element of column \a j.
 */
-template< typename Type >  // Data type of the matrix
-inline typename CompressedMatrix<Type,true>::Iterator
-   CompressedMatrix<Type,true>::end( size_t j ) noexcept
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
+inline typename CompressedMatrix<Type,true,IT>::Iterator
+   CompressedMatrix<Type,true,IT>::end( size_t j ) noexcept
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid compressed matrix column access index" );
    return end_[j];
@@ -3814,9 +3954,10 @@ inline typename CompressedMatrix<Type,true>::Iterator
 // \param j The column index.
 // \return Iterator just past the last non-zero element of column \a j.
 */
-template< typename Type >  // Data type of the matrix
-inline typename CompressedMatrix<Type,true>::ConstIterator
-   CompressedMatrix<Type,true>::end( size_t j ) const noexcept
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
+inline typename CompressedMatrix<Type,true,IT>::ConstIterator
+   CompressedMatrix<Type,true,IT>::end( size_t j ) const noexcept
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid compressed matrix column access index" );
    return end_[j];
@@ -3832,9 +3973,10 @@ inline typename CompressedMatrix<Type,true>::ConstIterator
 // \param j The column index.
 // \return Iterator just past the last non-zero element of column \a j.
 */
-template< typename Type >  // Data type of the matrix
-inline typename CompressedMatrix<Type,true>::ConstIterator
-   CompressedMatrix<Type,true>::cend( size_t j ) const noexcept
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
+inline typename CompressedMatrix<Type,true,IT>::ConstIterator
+   CompressedMatrix<Type,true,IT>::cend( size_t j ) const noexcept
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid compressed matrix column access index" );
    return end_[j];
@@ -3873,9 +4015,10 @@ inline typename CompressedMatrix<Type,true>::ConstIterator
 // assigned the values from the given initializer list. Missing values are considered to
 // be default values.
 */
-template< typename Type >  // Data type of the matrix
-inline CompressedMatrix<Type,true>&
-   CompressedMatrix<Type,true>::operator=( initializer_list< initializer_list<Type> > list )
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
+inline CompressedMatrix<Type,true,IT>&
+   CompressedMatrix<Type,true,IT>::operator=( initializer_list< initializer_list<Type> > list )
 {
    using blaze::nonZeros;
 
@@ -3919,9 +4062,10 @@ inline CompressedMatrix<Type,true>&
 // The compressed matrix is resized according to the given compressed matrix and initialized
 // as a copy of this matrix.
 */
-template< typename Type >  // Data type of the matrix
-inline CompressedMatrix<Type,true>&
-   CompressedMatrix<Type,true>::operator=( const CompressedMatrix& rhs )
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
+inline CompressedMatrix<Type,true,IT>&
+   CompressedMatrix<Type,true,IT>::operator=( const CompressedMatrix& rhs )
 {
    using std::swap;
 
@@ -3973,9 +4117,10 @@ inline CompressedMatrix<Type,true>&
 // \param rhs The compressed matrix to be moved into this instance.
 // \return Reference to the assigned compressed matrix.
 */
-template< typename Type >  // Data type of the matrix
-inline CompressedMatrix<Type,true>&
-   CompressedMatrix<Type,true>::operator=( CompressedMatrix&& rhs ) noexcept
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
+inline CompressedMatrix<Type,true,IT>&
+   CompressedMatrix<Type,true,IT>::operator=( CompressedMatrix&& rhs ) noexcept
 {
    if( begin_ != nullptr ) {
       deallocate( begin_[0UL] );
@@ -4010,21 +4155,20 @@ inline CompressedMatrix<Type,true>&
 // The matrix is resized according to the given \f$ M \times N \f$ matrix and initialized as a
 // copy of this matrix.
 */
-template< typename Type >  // Data type of the matrix
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
 template< typename MT      // Type of the right-hand side dense matrix
         , bool SO >        // Storage order of the right-hand side dense matrix
-inline CompressedMatrix<Type,true>&
-   CompressedMatrix<Type,true>::operator=( const DenseMatrix<MT,SO>& rhs )
+inline CompressedMatrix<Type,true,IT>&
+   CompressedMatrix<Type,true,IT>::operator=( const DenseMatrix<MT,SO>& rhs )
 {
-   using blaze::assign;
-
    if( (~rhs).canAlias( this ) ) {
       CompressedMatrix tmp( ~rhs );
       swap( tmp );
    }
    else {
       resize( (~rhs).rows(), (~rhs).columns(), false );
-      assign( *this, ~rhs );
+      smpAssign( *this, ~rhs );
    }
 
    return *this;
@@ -4043,14 +4187,13 @@ inline CompressedMatrix<Type,true>&
 // The matrix is resized according to the given \f$ M \times N \f$ matrix and initialized as a
 // copy of this matrix.
 */
-template< typename Type >  // Data type of the matrix
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
 template< typename MT      // Type of the right-hand side compressed matrix
         , bool SO >        // Storage order of the right-hand side compressed matrix
-inline CompressedMatrix<Type,true>&
-   CompressedMatrix<Type,true>::operator=( const SparseMatrix<MT,SO>& rhs )
+inline CompressedMatrix<Type,true,IT>&
+   CompressedMatrix<Type,true,IT>::operator=( const SparseMatrix<MT,SO>& rhs )
 {
-   using blaze::assign;
-
    if( (~rhs).canAlias( this ) ||
        (~rhs).columns()  > capacity_ ||
        (~rhs).nonZeros() > capacity() ) {
@@ -4062,7 +4205,7 @@ inline CompressedMatrix<Type,true>&
       reset();
 
       if( !IsZero_v<MT> ) {
-         assign( *this, ~rhs );
+         smpAssign( *this, ~rhs );
       }
    }
 
@@ -4083,19 +4226,18 @@ inline CompressedMatrix<Type,true>&
 // In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
 // is thrown.
 */
-template< typename Type >  // Data type of the matrix
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
 template< typename MT      // Type of the right-hand side matrix
         , bool SO >        // Storage order of the right-hand side matrix
-inline CompressedMatrix<Type,true>& CompressedMatrix<Type,true>::operator+=( const Matrix<MT,SO>& rhs )
+inline CompressedMatrix<Type,true,IT>& CompressedMatrix<Type,true,IT>::operator+=( const Matrix<MT,SO>& rhs )
 {
-   using blaze::addAssign;
-
    if( (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
       BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
    }
 
    if( !IsZero_v<MT> ) {
-      addAssign( *this, ~rhs );
+      smpAddAssign( *this, ~rhs );
    }
 
    return *this;
@@ -4115,19 +4257,18 @@ inline CompressedMatrix<Type,true>& CompressedMatrix<Type,true>::operator+=( con
 // In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
 // is thrown.
 */
-template< typename Type >  // Data type of the matrix
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
 template< typename MT      // Type of the right-hand side matrix
         , bool SO >        // Storage order of the right-hand side matrix
-inline CompressedMatrix<Type,true>& CompressedMatrix<Type,true>::operator-=( const Matrix<MT,SO>& rhs )
+inline CompressedMatrix<Type,true,IT>& CompressedMatrix<Type,true,IT>::operator-=( const Matrix<MT,SO>& rhs )
 {
-   using blaze::subAssign;
-
    if( (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
       BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
    }
 
    if( !IsZero_v<MT> ) {
-      subAssign( *this, ~rhs );
+      smpSubAssign( *this, ~rhs );
    }
 
    return *this;
@@ -4148,14 +4289,13 @@ inline CompressedMatrix<Type,true>& CompressedMatrix<Type,true>::operator-=( con
 // In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
 // is thrown.
 */
-template< typename Type >  // Data type of the matrix
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
 template< typename MT      // Type of the right-hand side dense matrix
         , bool SO >        // Storage order of the right-hand side dense matrix
-inline CompressedMatrix<Type,true>&
-   CompressedMatrix<Type,true>::operator%=( const DenseMatrix<MT,SO>& rhs )
+inline CompressedMatrix<Type,true,IT>&
+   CompressedMatrix<Type,true,IT>::operator%=( const DenseMatrix<MT,SO>& rhs )
 {
-   using blaze::schurAssign;
-
    if( (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
       BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
    }
@@ -4166,7 +4306,7 @@ inline CompressedMatrix<Type,true>&
    }
    else {
       CompositeType_t<MT> tmp( ~rhs );
-      schurAssign( *this, tmp );
+      smpSchurAssign( *this, tmp );
    }
 
    return *this;
@@ -4187,11 +4327,12 @@ inline CompressedMatrix<Type,true>&
 // In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
 // is thrown.
 */
-template< typename Type >  // Data type of the matrix
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
 template< typename MT      // Type of the right-hand side sparse matrix
         , bool SO >        // Storage order of the right-hand side sparse matrix
-inline CompressedMatrix<Type,true>&
-   CompressedMatrix<Type,true>::operator%=( const SparseMatrix<MT,SO>& rhs )
+inline CompressedMatrix<Type,true,IT>&
+   CompressedMatrix<Type,true,IT>::operator%=( const SparseMatrix<MT,SO>& rhs )
 {
    if( (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
       BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
@@ -4225,8 +4366,9 @@ inline CompressedMatrix<Type,true>&
 //
 // \return The number of rows of the compressed matrix.
 */
-template< typename Type >  // Data type of the matrix
-inline size_t CompressedMatrix<Type,true>::rows() const noexcept
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
+inline size_t CompressedMatrix<Type,true,IT>::rows() const noexcept
 {
    return m_;
 }
@@ -4240,8 +4382,9 @@ inline size_t CompressedMatrix<Type,true>::rows() const noexcept
 //
 // \return The number of columns of the compressed matrix.
 */
-template< typename Type >  // Data type of the matrix
-inline size_t CompressedMatrix<Type,true>::columns() const noexcept
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
+inline size_t CompressedMatrix<Type,true,IT>::columns() const noexcept
 {
    return n_;
 }
@@ -4255,8 +4398,9 @@ inline size_t CompressedMatrix<Type,true>::columns() const noexcept
 //
 // \return The capacity of the compressed matrix.
 */
-template< typename Type >  // Data type of the matrix
-inline size_t CompressedMatrix<Type,true>::capacity() const noexcept
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
+inline size_t CompressedMatrix<Type,true,IT>::capacity() const noexcept
 {
    if( begin_ != nullptr )
       return end_[n_] - begin_[0UL];
@@ -4273,8 +4417,9 @@ inline size_t CompressedMatrix<Type,true>::capacity() const noexcept
 // \param j The index of the column.
 // \return The current capacity of column \a j.
 */
-template< typename Type >  // Data type of the matrix
-inline size_t CompressedMatrix<Type,true>::capacity( size_t j ) const noexcept
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
+inline size_t CompressedMatrix<Type,true,IT>::capacity( size_t j ) const noexcept
 {
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
    return begin_[j+1UL] - begin_[j];
@@ -4289,8 +4434,9 @@ inline size_t CompressedMatrix<Type,true>::capacity( size_t j ) const noexcept
 //
 // \return The number of non-zero elements in the compressed matrix.
 */
-template< typename Type >  // Data type of the matrix
-inline size_t CompressedMatrix<Type,true>::nonZeros() const
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
+inline size_t CompressedMatrix<Type,true,IT>::nonZeros() const
 {
    size_t nonzeros( 0UL );
 
@@ -4310,8 +4456,9 @@ inline size_t CompressedMatrix<Type,true>::nonZeros() const
 // \param j The index of the column.
 // \return The number of non-zero elements of column \a j.
 */
-template< typename Type >  // Data type of the matrix
-inline size_t CompressedMatrix<Type,true>::nonZeros( size_t j ) const
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
+inline size_t CompressedMatrix<Type,true,IT>::nonZeros( size_t j ) const
 {
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
    return end_[j] - begin_[j];
@@ -4326,8 +4473,9 @@ inline size_t CompressedMatrix<Type,true>::nonZeros( size_t j ) const
 //
 // \return void
 */
-template< typename Type >  // Data type of the matrix
-inline void CompressedMatrix<Type,true>::reset()
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
+inline void CompressedMatrix<Type,true,IT>::reset()
 {
    for( size_t j=0UL; j<n_; ++j )
       end_[j] = begin_[j];
@@ -4346,8 +4494,9 @@ inline void CompressedMatrix<Type,true>::reset()
 // This function reset the values in the specified column to their default value. Note that
 // the capacity of the column remains unchanged.
 */
-template< typename Type >  // Data type of the matrix
-inline void CompressedMatrix<Type,true>::reset( size_t j )
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
+inline void CompressedMatrix<Type,true,IT>::reset( size_t j )
 {
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
    end_[j] = begin_[j];
@@ -4364,8 +4513,9 @@ inline void CompressedMatrix<Type,true>::reset( size_t j )
 //
 // After the clear() function, the size of the compressed matrix is 0.
 */
-template< typename Type >  // Data type of the matrix
-inline void CompressedMatrix<Type,true>::clear()
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
+inline void CompressedMatrix<Type,true,IT>::clear()
 {
    if( end_ != nullptr )
       end_[0UL] = end_[n_];
@@ -4384,6 +4534,7 @@ inline void CompressedMatrix<Type,true>::clear()
 // \param n The new number of columns of the compressed matrix.
 // \param preserve \a true if the old values of the matrix should be preserved, \a false if not.
 // \return void
+// \exception std::invalid_argument Invalid number of rows for the index type.
 //
 // This function resizes the matrix using the given size to \f$ m \times n \f$. During this
 // operation, new dynamic memory may be allocated in case the capacity of the matrix is too
@@ -4392,14 +4543,19 @@ inline void CompressedMatrix<Type,true>::clear()
 // potentially changes all matrix elements. In order to preserve the old matrix values, the
 // \a preserve flag can be set to \a true.
 */
-template< typename Type >  // Data type of the matrix
-void CompressedMatrix<Type,true>::resize( size_t m, size_t n, bool preserve )
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
+void CompressedMatrix<Type,true,IT>::resize( size_t m, size_t n, bool preserve )
 {
    using std::swap;
 
    BLAZE_INTERNAL_ASSERT( end_ >= begin_, "Invalid internal storage detected" );
    BLAZE_INTERNAL_ASSERT( begin_ == nullptr || size_t( end_ - begin_ ) == capacity_ + 1UL, "Invalid storage setting detected" );
 
+   if( m > std::numeric_limits<IT>::max() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of rows for the index type" );
+   }
+
    if( m == m_ && n == n_ ) return;
 
    if( begin_ == nullptr )
@@ -4490,8 +4646,9 @@ void CompressedMatrix<Type,true>::resize( size_t m, size_t n, bool preserve )
 // The current values of the matrix elements and the individual capacities of the matrix rows
 // are preserved.
 */
-template< typename Type >  // Data type of the matrix
-inline void CompressedMatrix<Type,true>::reserve( size_t nonzeros )
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
+inline void CompressedMatrix<Type,true,IT>::reserve( size_t nonzeros )
 {
    if( nonzeros > capacity() )
       reserveElements( nonzeros );
@@ -4512,8 +4669,9 @@ inline void CompressedMatrix<Type,true>::reserve( size_t nonzeros )
 // \a nonzeros elements. The current values of the compressed matrix and all other individual
 // column capacities are preserved.
 */
-template< typename Type >  // Data type of the matrix
-void CompressedMatrix<Type,true>::reserve( size_t j, size_t nonzeros )
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
+void CompressedMatrix<Type,true,IT>::reserve( size_t j, size_t nonzeros )
 {
    using std::swap;
 
@@ -4584,8 +4742,9 @@ void CompressedMatrix<Type,true>::reserve( size_t j, size_t nonzeros )
 // It removes all excessive capacity from all columns. Note that this function does not remove
 // the overall capacity but only reduces the capacity per column.
 */
-template< typename Type >  // Data type of the matrix
-void CompressedMatrix<Type,true>::trim()
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
+void CompressedMatrix<Type,true,IT>::trim()
 {
    for( size_t j=0UL; j<n_; ++j )
       trim( j );
@@ -4605,8 +4764,9 @@ void CompressedMatrix<Type,true>::trim()
 // removes all excessive capacity from the specified column. The excessive capacity is assigned
 // to the subsequent column.
 */
-template< typename Type >  // Data type of the matrix
-void CompressedMatrix<Type,true>::trim( size_t j )
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
+void CompressedMatrix<Type,true,IT>::trim( size_t j )
 {
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
 
@@ -4628,8 +4788,9 @@ void CompressedMatrix<Type,true>::trim( size_t j )
 // that in case a reallocation occurs, all iterators (including end() iterators), all pointers
 // and references to elements of this matrix are invalidated.
 */
-template< typename Type >  // Data type of the matrix
-inline void CompressedMatrix<Type,true>::shrinkToFit()
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
+inline void CompressedMatrix<Type,true,IT>::shrinkToFit()
 {
    if( nonZeros() < capacity() ) {
       CompressedMatrix( *this ).swap( *this );
@@ -4646,8 +4807,9 @@ inline void CompressedMatrix<Type,true>::shrinkToFit()
 // \param sm The compressed matrix to be swapped.
 // \return void
 */
-template< typename Type >  // Data type of the matrix
-inline void CompressedMatrix<Type,true>::swap( CompressedMatrix& sm ) noexcept
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
+inline void CompressedMatrix<Type,true,IT>::swap( CompressedMatrix& sm ) noexcept
 {
    using std::swap;
 
@@ -4670,8 +4832,9 @@ inline void CompressedMatrix<Type,true>::swap( CompressedMatrix& sm ) noexcept
 // This function calculates a new matrix capacity based on the current capacity of the sparse
 // matrix. Note that the new capacity is restricted to the interval \f$[7..M \cdot N]\f$.
 */
-template< typename Type >  // Data type of the matrix
-inline size_t CompressedMatrix<Type,true>::extendCapacity() const noexcept
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
+inline size_t CompressedMatrix<Type,true,IT>::extendCapacity() const noexcept
 {
    size_t nonzeros( 2UL*capacity()+1UL );
    nonzeros = blaze::max( nonzeros, 7UL );
@@ -4691,8 +4854,9 @@ inline size_t CompressedMatrix<Type,true>::extendCapacity() const noexcept
 // \param nonzeros The number of matrix elements to be reserved.
 // \return void
 */
-template< typename Type >  // Data type of the matrix
-void CompressedMatrix<Type,true>::reserveElements( size_t nonzeros )
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
+void CompressedMatrix<Type,true,IT>::reserveElements( size_t nonzeros )
 {
    using std::swap;
 
@@ -4729,9 +4893,10 @@ void CompressedMatrix<Type,true>::reserveElements( size_t nonzeros )
 // This function performs a down-cast of the given iterator to base elements to an iterator to
 // derived elements.
 */
-template< typename Type >  // Data type of the matrix
-inline typename CompressedMatrix<Type,true>::Iterator
-   CompressedMatrix<Type,true>::castDown( IteratorBase it ) const noexcept
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
+inline typename CompressedMatrix<Type,true,IT>::Iterator
+   CompressedMatrix<Type,true,IT>::castDown( IteratorBase it ) const noexcept
 {
    return static_cast<Iterator>( it );
 }
@@ -4746,9 +4911,10 @@ inline typename CompressedMatrix<Type,true>::Iterator
 // This function performs an up-cast of the given iterator to derived elements to an iterator
 // to base elements.
 */
-template< typename Type >  // Data type of the matrix
-inline typename CompressedMatrix<Type,true>::IteratorBase
-   CompressedMatrix<Type,true>::castUp( Iterator it ) const noexcept
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
+inline typename CompressedMatrix<Type,true,IT>::IteratorBase
+   CompressedMatrix<Type,true,IT>::castUp( Iterator it ) const noexcept
 {
    return static_cast<IteratorBase>( it );
 }
@@ -4776,9 +4942,10 @@ inline typename CompressedMatrix<Type,true>::IteratorBase
 // matrix already contains an element with row index \a i and column index \a j its value is
 // modified, else a new element with the given \a value is inserted.
 */
-template< typename Type >  // Data type of the matrix
-inline typename CompressedMatrix<Type,true>::Iterator
-   CompressedMatrix<Type,true>::set( size_t i, size_t j, const Type& value )
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
+inline typename CompressedMatrix<Type,true,IT>::Iterator
+   CompressedMatrix<Type,true,IT>::set( size_t i, size_t j, const Type& value )
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
@@ -4809,9 +4976,10 @@ inline typename CompressedMatrix<Type,true>::Iterator
 // are not allowed. In case the compressed matrix already contains an element with row index \a i
 // and column index \a j, a \a std::invalid_argument exception is thrown.
 */
-template< typename Type >  // Data type of the matrix
-inline typename CompressedMatrix<Type,true>::Iterator
-   CompressedMatrix<Type,true>::insert( size_t i, size_t j, const Type& value )
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
+inline typename CompressedMatrix<Type,true,IT>::Iterator
+   CompressedMatrix<Type,true,IT>::insert( size_t i, size_t j, const Type& value )
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
@@ -4839,9 +5007,10 @@ inline typename CompressedMatrix<Type,true>::Iterator
 // \return Iterator to the newly inserted element.
 // \exception std::invalid_argument Invalid compressed matrix access index.
 */
-template< typename Type >  // Data type of the matrix
-typename CompressedMatrix<Type,true>::Iterator
-   CompressedMatrix<Type,true>::insert( Iterator pos, size_t i, size_t j, const Type& value )
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
+typename CompressedMatrix<Type,true,IT>::Iterator
+   CompressedMatrix<Type,true,IT>::insert( Iterator pos, size_t i, size_t j, const Type& value )
 {
    using std::swap;
 
@@ -4961,8 +5130,9 @@ typename CompressedMatrix<Type,true>::Iterator
 // \note Although append() does not allocate new memory, it still invalidates all iterators
 // returned by the end() functions!
 */
-template< typename Type >  // Data type of the matrix
-inline void CompressedMatrix<Type,true>::append( size_t i, size_t j, const Type& value, bool check )
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
+inline void CompressedMatrix<Type,true,IT>::append( size_t i, size_t j, const Type& value, bool check )
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < n_, "Invalid column access index" );
@@ -4994,8 +5164,9 @@ inline void CompressedMatrix<Type,true>::append( size_t i, size_t j, const Type&
 // \note Although finalize() does not allocate new memory, it still invalidates all iterators
 // returned by the end() functions!
 */
-template< typename Type >  // Data type of the matrix
-inline void CompressedMatrix<Type,true>::finalize( size_t j )
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
+inline void CompressedMatrix<Type,true,IT>::finalize( size_t j )
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid column access index" );
 
@@ -5025,8 +5196,9 @@ inline void CompressedMatrix<Type,true>::finalize( size_t j )
 //
 // This function erases an element from the compressed matrix.
 */
-template< typename Type >  // Data type of the matrix
-inline void CompressedMatrix<Type,true>::erase( size_t i, size_t j )
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
+inline void CompressedMatrix<Type,true,IT>::erase( size_t i, size_t j )
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
@@ -5049,9 +5221,10 @@ inline void CompressedMatrix<Type,true>::erase( size_t i, size_t j )
 //
 // This function erases an element from column \a j of the compressed matrix.
 */
-template< typename Type >  // Data type of the matrix
-inline typename CompressedMatrix<Type,true>::Iterator
-   CompressedMatrix<Type,true>::erase( size_t j, Iterator pos )
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
+inline typename CompressedMatrix<Type,true,IT>::Iterator
+   CompressedMatrix<Type,true,IT>::erase( size_t j, Iterator pos )
 {
    BLAZE_USER_ASSERT( j < columns()   , "Invalid column access index"    );
    BLAZE_USER_ASSERT( pos >= begin_[j] && pos <= end_[j], "Invalid compressed matrix iterator" );
@@ -5076,9 +5249,10 @@ inline typename CompressedMatrix<Type,true>::Iterator
 //
 // This function erases a range of elements from column \a j of the compressed matrix.
 */
-template< typename Type >  // Data type of the matrix
-inline typename CompressedMatrix<Type,true>::Iterator
-   CompressedMatrix<Type,true>::erase( size_t j, Iterator first, Iterator last )
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
+inline typename CompressedMatrix<Type,true,IT>::Iterator
+   CompressedMatrix<Type,true,IT>::erase( size_t j, Iterator first, Iterator last )
 {
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
    BLAZE_USER_ASSERT( first <= last, "Invalid iterator range"   );
@@ -5116,9 +5290,10 @@ inline typename CompressedMatrix<Type,true>::Iterator
 // \note The predicate is required to be pure, i.e. to produce deterministic results for elements
 // with the same value. The attempt to use an impure predicate leads to undefined behavior!
 */
-template< typename Type >  // Data type of the matrix
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
 template< typename Pred >  // Type of the unary predicate
-inline void CompressedMatrix<Type,true>::erase( Pred predicate )
+inline void CompressedMatrix<Type,true,IT>::erase( Pred predicate )
 {
    for( size_t j=0UL; j<n_; ++j ) {
       end_[j] = castDown( std::remove_if( castUp( begin_[j] ), castUp( end_[j] ),
@@ -5156,9 +5331,10 @@ inline void CompressedMatrix<Type,true>::erase( Pred predicate )
 // \note The predicate is required to be pure, i.e. to produce deterministic results for elements
 // with the same value. The attempt to use an impure predicate leads to undefined behavior!
 */
-template< typename Type >  // Data type of the matrix
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
 template< typename Pred >  // Type of the unary predicate
-inline void CompressedMatrix<Type,true>::erase( size_t j, Iterator first, Iterator last, Pred predicate )
+inline void CompressedMatrix<Type,true,IT>::erase( size_t j, Iterator first, Iterator last, Pred predicate )
 {
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
    BLAZE_USER_ASSERT( first <= last, "Invalid iterator range"   );
@@ -5199,9 +5375,10 @@ inline void CompressedMatrix<Type,true>::erase( size_t j, Iterator first, Iterat
 // Note that the returned compressed matrix iterator is subject to invalidation due to inserting
 // operations via the subscript operator, the set() function or the insert() function!
 */
-template< typename Type >  // Data type of the matrix
-inline typename CompressedMatrix<Type,true>::Iterator
-   CompressedMatrix<Type,true>::find( size_t i, size_t j )
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
+inline typename CompressedMatrix<Type,true,IT>::Iterator
+   CompressedMatrix<Type,true,IT>::find( size_t i, size_t j )
 {
    return const_cast<Iterator>( const_cast<const This&>( *this ).find( i, j ) );
 }
@@ -5224,9 +5401,10 @@ inline typename CompressedMatrix<Type,true>::Iterator
 // Note that the returned compressed matrix iterator is subject to invalidation due to inserting
 // operations via the subscript operator, the set() function or the insert() function!
 */
-template< typename Type >  // Data type of the matrix
-inline typename CompressedMatrix<Type,true>::ConstIterator
-   CompressedMatrix<Type,true>::find( size_t i, size_t j ) const
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
+inline typename CompressedMatrix<Type,true,IT>::ConstIterator
+   CompressedMatrix<Type,true,IT>::find( size_t i, size_t j ) const
 {
    const ConstIterator pos( lowerBound( i, j ) );
    if( pos != end_[j] && pos->index_ == i )
@@ -5251,9 +5429,10 @@ inline typename CompressedMatrix<Type,true>::ConstIterator
 // matrix iterator is subject to invalidation due to inserting operations via the function call
 // operator, the set() function or the insert() function!
 */
-template< typename Type >  // Data type of the matrix
-inline typename CompressedMatrix<Type,true>::Iterator
-   CompressedMatrix<Type,true>::lowerBound( size_t i, size_t j )
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
+inline typename CompressedMatrix<Type,true,IT>::Iterator
+   CompressedMatrix<Type,true,IT>::lowerBound( size_t i, size_t j )
 {
    return const_cast<Iterator>( const_cast<const This&>( *this ).lowerBound( i, j ) );
 }
@@ -5275,9 +5454,10 @@ inline typename CompressedMatrix<Type,true>::Iterator
 // matrix iterator is subject to invalidation due to inserting operations via the function call
 // operator, the set() function or the insert() function!
 */
-template< typename Type >  // Data type of the matrix
-inline typename CompressedMatrix<Type,true>::ConstIterator
-   CompressedMatrix<Type,true>::lowerBound( size_t i, size_t j ) const
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
+inline typename CompressedMatrix<Type,true,IT>::ConstIterator
+   CompressedMatrix<Type,true,IT>::lowerBound( size_t i, size_t j ) const
 {
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
    return std::lower_bound( begin_[j], end_[j], i,
@@ -5304,9 +5484,10 @@ inline typename CompressedMatrix<Type,true>::ConstIterator
 // matrix iterator is subject to invalidation due to inserting operations via the function call
 // operator, the set() function or the insert() function!
 */
-template< typename Type >  // Data type of the matrix
-inline typename CompressedMatrix<Type,true>::Iterator
-   CompressedMatrix<Type,true>::upperBound( size_t i, size_t j )
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
+inline typename CompressedMatrix<Type,true,IT>::Iterator
+   CompressedMatrix<Type,true,IT>::upperBound( size_t i, size_t j )
 {
    return const_cast<Iterator>( const_cast<const This&>( *this ).upperBound( i, j ) );
 }
@@ -5328,9 +5509,10 @@ inline typename CompressedMatrix<Type,true>::Iterator
 // matrix iterator is subject to invalidation due to inserting operations via the function call
 // operator, the set() function or the insert() function!
 */
-template< typename Type >  // Data type of the matrix
-inline typename CompressedMatrix<Type,true>::ConstIterator
-   CompressedMatrix<Type,true>::upperBound( size_t i, size_t j ) const
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
+inline typename CompressedMatrix<Type,true,IT>::ConstIterator
+   CompressedMatrix<Type,true,IT>::upperBound( size_t i, size_t j ) const
 {
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
    return std::upper_bound( begin_[j], end_[j], i,
@@ -5357,8 +5539,9 @@ inline typename CompressedMatrix<Type,true>::ConstIterator
 //
 // \return Reference to the transposed matrix.
 */
-template< typename Type >  // Data type of the matrix
-inline CompressedMatrix<Type,true>& CompressedMatrix<Type,true>::transpose()
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
+inline CompressedMatrix<Type,true,IT>& CompressedMatrix<Type,true,IT>::transpose()
 {
    CompressedMatrix tmp( trans( *this ) );
    swap( tmp );
@@ -5374,8 +5557,9 @@ inline CompressedMatrix<Type,true>& CompressedMatrix<Type,true>::transpose()
 //
 // \return Reference to the transposed matrix.
 */
-template< typename Type >  // Data type of the matrix
-inline CompressedMatrix<Type,true>& CompressedMatrix<Type,true>::ctranspose()
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
+inline CompressedMatrix<Type,true,IT>& CompressedMatrix<Type,true,IT>::ctranspose()
 {
    CompressedMatrix tmp( ctrans( *this ) );
    swap( tmp );
@@ -5403,9 +5587,10 @@ inline CompressedMatrix<Type,true>& CompressedMatrix<Type,true>::ctranspose()
    A.scale( 4 );  // Same effect as above
    \endcode
 */
-template< typename Type >   // Data type of the matrix
+template< typename Type     // Data type of the matrix
+        , typename IT >     // Index type
 template< typename Other >  // Data type of the scalar value
-inline CompressedMatrix<Type,true>& CompressedMatrix<Type,true>::scale( const Other& scalar )
+inline CompressedMatrix<Type,true,IT>& CompressedMatrix<Type,true,IT>::scale( const Other& scalar )
 {
    for( size_t j=0UL; j<n_; ++j )
       for( auto element=begin_[j]; element!=end_[j]; ++element )
@@ -5436,9 +5621,10 @@ inline CompressedMatrix<Type,true>& CompressedMatrix<Type,true>::scale( const Ot
 // to the isAliased() function this function is allowed to use compile time expressions
 // to optimize the evaluation.
 */
-template< typename Type >   // Data type of the matrix
+template< typename Type     // Data type of the matrix
+        , typename IT >     // Index type
 template< typename Other >  // Data type of the foreign expression
-inline bool CompressedMatrix<Type,true>::canAlias( const Other* alias ) const noexcept
+inline bool CompressedMatrix<Type,true,IT>::canAlias( const Other* alias ) const noexcept
 {
    return static_cast<const void*>( this ) == static_cast<const void*>( alias );
 }
@@ -5457,9 +5643,10 @@ inline bool CompressedMatrix<Type,true>::canAlias( const Other* alias ) const no
 // to the canAlias() function this function is not allowed to use compile time expressions
 // to optimize the evaluation.
 */
-template< typename Type >   // Data type of the matrix
+template< typename Type     // Data type of the matrix
+        , typename IT >     // Index type
 template< typename Other >  // Data type of the foreign expression
-inline bool CompressedMatrix<Type,true>::isAliased( const Other* alias ) const noexcept
+inline bool CompressedMatrix<Type,true,IT>::isAliased( const Other* alias ) const noexcept
 {
    return static_cast<const void*>( this ) == static_cast<const void*>( alias );
 }
@@ -5478,10 +5665,11 @@ inline bool CompressedMatrix<Type,true>::isAliased( const Other* alias ) const n
 // function additionally provides runtime information (as for instance the current number of
 // rows and/or columns of the matrix).
 */
-template< typename Type >  // Data type of the matrix
-inline bool CompressedMatrix<Type,true>::canSMPAssign() const noexcept
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
+inline bool CompressedMatrix<Type,true,IT>::canSMPAssign() const noexcept
 {
-   return false;
+   return ( nonZeros() >= SMP_SMATASSIGN_THRESHOLD );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -5499,10 +5687,11 @@ inline bool CompressedMatrix<Type,true>::canSMPAssign() const noexcept
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
 template< typename MT      // Type of the right-hand side dense matrix
         , bool SO >        // Storage order of the right-hand side dense matrix
-inline void CompressedMatrix<Type,true>::assign( const DenseMatrix<MT,SO>& rhs )
+inline void CompressedMatrix<Type,true,IT>::assign( const DenseMatrix<MT,SO>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -5562,9 +5751,10 @@ inline void CompressedMatrix<Type,true>::assign( const DenseMatrix<MT,SO>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
 template< typename MT >    // Type of the right-hand side compressed matrix
-inline void CompressedMatrix<Type,true>::assign( const SparseMatrix<MT,true>& rhs )
+inline void CompressedMatrix<Type,true,IT>::assign( const SparseMatrix<MT,true>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -5595,9 +5785,10 @@ inline void CompressedMatrix<Type,true>::assign( const SparseMatrix<MT,true>& rh
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
 template< typename MT >    // Type of the right-hand side compressed matrix
-inline void CompressedMatrix<Type,true>::assign( const SparseMatrix<MT,false>& rhs )
+inline void CompressedMatrix<Type,true,IT>::assign( const SparseMatrix<MT,false>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
 
@@ -5640,10 +5831,11 @@ inline void CompressedMatrix<Type,true>::assign( const SparseMatrix<MT,false>& r
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
 template< typename MT      // Type of the right-hand side dense matrix
         , bool SO >        // Storage order of the right-hand side dense matrix
-inline void CompressedMatrix<Type,true>::addAssign( const DenseMatrix<MT,SO>& rhs )
+inline void CompressedMatrix<Type,true,IT>::addAssign( const DenseMatrix<MT,SO>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -5667,10 +5859,11 @@ inline void CompressedMatrix<Type,true>::addAssign( const DenseMatrix<MT,SO>& rh
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
 template< typename MT      // Type of the right-hand side compressed matrix
         , bool SO >        // Storage order of the right-hand side compressed matrix
-inline void CompressedMatrix<Type,true>::addAssign( const SparseMatrix<MT,SO>& rhs )
+inline void CompressedMatrix<Type,true,IT>::addAssign( const SparseMatrix<MT,SO>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -5694,10 +5887,11 @@ inline void CompressedMatrix<Type,true>::addAssign( const SparseMatrix<MT,SO>& r
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
 template< typename MT      // Type of the right-hand side dense matrix
         , bool SO >        // Storage order of the right-hand side dense matrix
-inline void CompressedMatrix<Type,true>::subAssign( const DenseMatrix<MT,SO>& rhs )
+inline void CompressedMatrix<Type,true,IT>::subAssign( const DenseMatrix<MT,SO>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -5721,10 +5915,11 @@ inline void CompressedMatrix<Type,true>::subAssign( const DenseMatrix<MT,SO>& rh
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
 template< typename MT      // Type of the right-hand side compressed matrix
         , bool SO >        // Storage order of the right-hand side compressed matrix
-inline void CompressedMatrix<Type,true>::subAssign( const SparseMatrix<MT,SO>& rhs )
+inline void CompressedMatrix<Type,true,IT>::subAssign( const SparseMatrix<MT,SO>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -5748,10 +5943,11 @@ inline void CompressedMatrix<Type,true>::subAssign( const SparseMatrix<MT,SO>& r
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
 template< typename MT      // Type of the right-hand side dense matrix
         , bool SO >        // Storage order of the right-hand side dense matrix
-inline void CompressedMatrix<Type,true>::schurAssign( const DenseMatrix<MT,SO>& rhs )
+inline void CompressedMatrix<Type,true,IT>::schurAssign( const DenseMatrix<MT,SO>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -5783,23 +5979,23 @@ inline void CompressedMatrix<Type,true>::schurAssign( const DenseMatrix<MT,SO>&
 //*************************************************************************************************
 /*!\name CompressedMatrix operators */
 //@{
-template< typename Type, bool SO >
-void reset( CompressedMatrix<Type,SO>& m );
+template< typename Type, bool SO, typename IT >
+void reset( CompressedMatrix<Type,SO,IT>& m );
 
-template< typename Type, bool SO >
-void reset( CompressedMatrix<Type,SO>& m, size_t i );
+template< typename Type, bool SO, typename IT >
+void reset( CompressedMatrix<Type,SO,IT>& m, size_t i );
 
-template< typename Type, bool SO >
-void clear( CompressedMatrix<Type,SO>& m );
+template< typename Type, bool SO, typename IT >
+void clear( CompressedMatrix<Type,SO,IT>& m );
 
-template< bool RF, typename Type, bool SO >
-bool isDefault( const CompressedMatrix<Type,SO>& m );
+template< bool RF, typename Type, bool SO, typename IT >
+bool isDefault( const CompressedMatrix<Type,SO,IT>& m );
 
-template< typename Type, bool SO >
-bool isIntact( const CompressedMatrix<Type,SO>& m );
+template< typename Type, bool SO, typename IT >
+bool isIntact( const CompressedMatrix<Type,SO,IT>& m );
 
-template< typename Type, bool SO >
-void swap( CompressedMatrix<Type,SO>& a, CompressedMatrix<Type,SO>& b ) noexcept;
+template< typename Type, bool SO, typename IT >
+void swap( CompressedMatrix<Type,SO,IT>& a, CompressedMatrix<Type,SO,IT>& b ) noexcept;
 //@}
 //*************************************************************************************************
 
@@ -5812,8 +6008,9 @@ void swap( CompressedMatrix<Type,SO>& a, CompressedMatrix<Type,SO>& b ) noexcept
 // \return void
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void reset( CompressedMatrix<Type,SO>& m )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void reset( CompressedMatrix<Type,SO,IT>& m )
 {
    m.reset();
 }
@@ -5834,8 +6031,9 @@ inline void reset( CompressedMatrix<Type,SO>& m )
 // \a i. Note that the capacity of the row/column remains unchanged.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void reset( CompressedMatrix<Type,SO>& m, size_t i )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void reset( CompressedMatrix<Type,SO,IT>& m, size_t i )
 {
    m.reset( i );
 }
@@ -5850,8 +6048,9 @@ inline void reset( CompressedMatrix<Type,SO>& m, size_t i )
 // \return void
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void clear( CompressedMatrix<Type,SO>& m )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void clear( CompressedMatrix<Type,SO,IT>& m )
 {
    m.clear();
 }
@@ -5885,8 +6084,9 @@ inline void clear( CompressedMatrix<Type,SO>& m )
 */
 template< bool RF        // Relaxation flag
         , typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline bool isDefault( const CompressedMatrix<Type,SO>& m )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline bool isDefault( const CompressedMatrix<Type,SO,IT>& m )
 {
    return ( m.rows() == 0UL && m.columns() == 0UL );
 }
@@ -5912,8 +6112,9 @@ inline bool isDefault( const CompressedMatrix<Type,SO>& m )
    \endcode
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline bool isIntact( const CompressedMatrix<Type,SO>& m )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline bool isIntact( const CompressedMatrix<Type,SO,IT>& m )
 {
    return ( m.nonZeros() <= m.capacity() );
 }
@@ -5929,8 +6130,9 @@ inline bool isIntact( const CompressedMatrix<Type,SO>& m )
 // \return void
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void swap( CompressedMatrix<Type,SO>& a, CompressedMatrix<Type,SO>& b ) noexcept
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void swap( CompressedMatrix<Type,SO,IT>& a, CompressedMatrix<Type,SO,IT>& b ) noexcept
 {
    a.swap( b );
 }
@@ -5947,8 +6149,8 @@ inline void swap( CompressedMatrix<Type,SO>& a, CompressedMatrix<Type,SO>& b ) n
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T, bool SO >
-struct IsResizable< CompressedMatrix<T,SO> >
+template< typename T, bool SO, typename IT >
+struct IsResizable< CompressedMatrix<T,SO,IT> >
    : public TrueType
 {};
 /*! \endcond */
@@ -5965,8 +6167,8 @@ struct IsResizable< CompressedMatrix<T,SO> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T, bool SO >
-struct IsShrinkable< CompressedMatrix<T,SO> >
+template< typename T, bool SO, typename IT >
+struct IsShrinkable< CompressedMatrix<T,SO,IT> >
    : public TrueType
 {};
 /*! \endcond */
@@ -6218,10 +6420,10 @@ struct ExpandTraitEval2< T, E
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool SO, typename T2 >
-struct HighType< CompressedMatrix<T1,SO>, CompressedMatrix<T2,SO> >
+template< typename T1, bool SO, typename T2, typename IT >
+struct HighType< CompressedMatrix<T1,SO,IT>, CompressedMatrix<T2,SO,IT> >
 {
-   using Type = CompressedMatrix< typename HighType<T1,T2>::Type, SO >;
+   using Type = CompressedMatrix< typename HighType<T1,T2>::Type, SO, IT >;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -6237,10 +6439,10 @@ struct HighType< CompressedMatrix<T1,SO>, CompressedMatrix<T2,SO> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool SO, typename T2 >
-struct LowType< CompressedMatrix<T1,SO>, CompressedMatrix<T2,SO> >
+template< typename T1, bool SO, typename T2, typename IT >
+struct LowType< CompressedMatrix<T1,SO,IT>, CompressedMatrix<T2,SO,IT> >
 {
-   using Type = CompressedMatrix< typename LowType<T1,T2>::Type, SO >;
+   using Type = CompressedMatrix< typename LowType<T1,T2>::Type, SO, IT >;
 };
 /*! \endcond */
 //*************************************************************************************************
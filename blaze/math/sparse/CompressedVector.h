@@ -41,6 +41,7 @@
 //*************************************************************************************************
 
 #include <algorithm>
+#include <limits>
 #include <utility>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/DenseVector.h>
@@ -118,11 +119,12 @@ namespace blaze {
 // \ingroup compressed_vector
 //
 // The CompressedVector class is the representation of an arbitrarily sized sparse vector,
-// which stores only non-zero elements of arbitrary type. The type of the elements and the
-// transpose flag of the vector can be specified via the two template parameters:
+// which stores only non-zero elements of arbitrary type. The type of the elements, the
+// transpose flag of the vector, and the type of the stored indices can be specified via the
+// three template parameters:
 
    \code
-   template< typename Type, bool TF >
+   template< typename Type, bool TF, typename IT >
    class CompressedVector;
    \endcode
 
@@ -130,6 +132,14 @@ namespace blaze {
 //          non-cv-qualified, non-reference, non-pointer element type.
 //  - TF  : specifies whether the vector is a row vector (\a blaze::rowVector) or a column
 //          vector (\a blaze::columnVector). The default value is \a blaze::columnVector.
+//  - IT  : specifies the unsigned integral type used to store the indices of the non-zero
+//          elements. Using a 32-bit type such as \c uint32_t reduces the memory footprint of
+//          vectors with less than \f$ 2^{32} \f$ elements. The default value is \c size_t.
+//
+// Note that the index type is not propagated through expressions: the result type of any
+// operation involving a CompressedVector with a custom index type is a CompressedVector with
+// the default index type \c size_t. In order to keep the compact index representation, the
+// result has to be assigned to a vector with the desired index type.
 //
 // Inserting/accessing elements in a compressed vector can be done by several alternative
 // functions. The following example demonstrates all options:
@@ -205,13 +215,14 @@ namespace blaze {
    \endcode
 */
 template< typename Type                     // Data type of the vector
-        , bool TF = defaultTransposeFlag >  // Transpose flag
+        , bool TF = defaultTransposeFlag    // Transpose flag
+        , typename IT = size_t >            // Index type
 class CompressedVector
-   : public SparseVector< CompressedVector<Type,TF>, TF >
+   : public SparseVector< CompressedVector<Type,TF,IT>, TF >
 {
  private:
    //**Type definitions****************************************************************************
-   using ElementBase  = ValueIndexPair<Type>;  //!< Base class for the compressed vector element.
+   using ElementBase  = ValueIndexPair<Type,IT>;  //!< Base class for the compressed vector element.
    using IteratorBase = ElementBase*;          //!< Iterator over non-constant base elements.
    //**********************************************************************************************
 
@@ -288,17 +299,17 @@ class CompressedVector
 
  public:
    //**Type definitions****************************************************************************
-   using This           = CompressedVector<Type,TF>;   //!< Type of this CompressedVector instance.
-   using BaseType       = SparseVector<This,TF>;       //!< Base type of this CompressedVector instance.
-   using ResultType     = This;                        //!< Result type for expression template evaluations.
-   using TransposeType  = CompressedVector<Type,!TF>;  //!< Transpose type for expression template evaluations.
-   using ElementType    = Type;                        //!< Type of the compressed vector elements.
-   using ReturnType     = const Type&;                 //!< Return type for expression template evaluations.
-   using CompositeType  = const CompressedVector&;     //!< Data type for composite expression templates.
-   using Reference      = VectorAccessProxy<This>;     //!< Reference to a non-constant vector value.
-   using ConstReference = const Type&;                 //!< Reference to a constant vector value.
-   using Iterator       = Element*;                    //!< Iterator over non-constant elements.
-   using ConstIterator  = const Element*;              //!< Iterator over constant elements.
+   using This           = CompressedVector<Type,TF,IT>;   //!< Type of this CompressedVector instance.
+   using BaseType       = SparseVector<This,TF>;          //!< Base type of this CompressedVector instance.
+   using ResultType     = This;                           //!< Result type for expression template evaluations.
+   using TransposeType  = CompressedVector<Type,!TF,IT>;  //!< Transpose type for expression template evaluations.
+   using ElementType    = Type;                           //!< Type of the compressed vector elements.
+   using ReturnType     = const Type&;                    //!< Return type for expression template evaluations.
+   using CompositeType  = const CompressedVector&;        //!< Data type for composite expression templates.
+   using Reference      = VectorAccessProxy<This>;        //!< Reference to a non-constant vector value.
+   using ConstReference = const Type&;                    //!< Reference to a constant vector value.
+   using Iterator       = Element*;                       //!< Iterator over non-constant elements.
+   using ConstIterator  = const Element*;                 //!< Iterator over constant elements.
    //**********************************************************************************************
 
    //**Rebind struct definition********************************************************************
@@ -306,7 +317,7 @@ class CompressedVector
    */
    template< typename NewType >  // Data type of the other vector
    struct Rebind {
-      using Other = CompressedVector<NewType,TF>;  //!< The type of the other CompressedVector.
+      using Other = CompressedVector<NewType,TF,IT>;  //!< The type of the other CompressedVector.
    };
    //**********************************************************************************************
 
@@ -315,7 +326,7 @@ class CompressedVector
    */
    template< size_t NewN >  // Number of elements of the other vector
    struct Resize {
-      using Other = CompressedVector<Type,TF>;  //!< The type of the other CompressedVector.
+      using Other = CompressedVector<Type,TF,IT>;  //!< The type of the other CompressedVector.
    };
    //**********************************************************************************************
 
@@ -331,7 +342,7 @@ class CompressedVector
    /*!\name Constructors */
    //@{
    explicit inline CompressedVector() noexcept;
-   explicit inline CompressedVector( size_t size ) noexcept;
+   explicit inline CompressedVector( size_t size );
    explicit inline CompressedVector( size_t size, size_t nonzeros );
             inline CompressedVector( initializer_list<Type> list );
 
@@ -512,8 +523,9 @@ class CompressedVector
 //=================================================================================================
 
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-const Type CompressedVector<Type,TF>::zero_{};
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+const Type CompressedVector<Type,TF,IT>::zero_{};
 
 
 
@@ -528,8 +540,9 @@ const Type CompressedVector<Type,TF>::zero_{};
 /*!\brief The default constructor for CompressedVector.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline CompressedVector<Type,TF>::CompressedVector() noexcept
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline CompressedVector<Type,TF,IT>::CompressedVector() noexcept
    : size_    ( 0UL )      // The current size/dimension of the compressed vector
    , capacity_( 0UL )      // The maximum capacity of the compressed vector
    , begin_   ( nullptr )  // Pointer to the first non-zero element of the compressed vector
@@ -542,15 +555,21 @@ inline CompressedVector<Type,TF>::CompressedVector() noexcept
 /*!\brief Constructor for a compressed vector of size \a n.
 //
 // \param n The size of the vector.
+// \exception std::invalid_argument Invalid size for the index type.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline CompressedVector<Type,TF>::CompressedVector( size_t n ) noexcept
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline CompressedVector<Type,TF,IT>::CompressedVector( size_t n )
    : size_    ( n   )      // The current size/dimension of the compressed vector
    , capacity_( 0UL )      // The maximum capacity of the compressed vector
    , begin_   ( nullptr )  // Pointer to the first non-zero element of the compressed vector
    , end_     ( nullptr )  // Pointer to the last non-zero element of the compressed vector
-{}
+{
+   if( n > std::numeric_limits<IT>::max() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid size for the index type" );
+   }
+}
 //*************************************************************************************************
 
 
@@ -559,15 +578,22 @@ inline CompressedVector<Type,TF>::CompressedVector( size_t n ) noexcept
 //
 // \param n The size of the vector.
 // \param nonzeros The number of expected non-zero elements.
+// \exception std::invalid_argument Invalid size for the index type.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline CompressedVector<Type,TF>::CompressedVector( size_t n, size_t nonzeros )
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline CompressedVector<Type,TF,IT>::CompressedVector( size_t n, size_t nonzeros )
    : size_    ( n )                               // The current size/dimension of the compressed vector
    , capacity_( nonzeros )                        // The maximum capacity of the compressed vector
    , begin_   ( allocate<Element>( capacity_ ) )  // Pointer to the first non-zero element of the compressed vector
    , end_     ( begin_ )                          // Pointer to the last non-zero element of the compressed vector
-{}
+{
+   if( n > std::numeric_limits<IT>::max() ) {
+      deallocate( begin_ );
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid size for the index type" );
+   }
+}
 //*************************************************************************************************
 
 
@@ -587,8 +613,9 @@ inline CompressedVector<Type,TF>::CompressedVector( size_t n, size_t nonzeros )
 // initialized by the non-zero elements of the given initializer list.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline CompressedVector<Type,TF>::CompressedVector( initializer_list<Type> list )
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline CompressedVector<Type,TF,IT>::CompressedVector( initializer_list<Type> list )
    : CompressedVector( list.size(), blaze::nonZeros( list ) )
 {
    size_t i( 0UL );
@@ -611,8 +638,9 @@ inline CompressedVector<Type,TF>::CompressedVector( initializer_list<Type> list
 // and in order to enable/facilitate NRV optimization.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline CompressedVector<Type,TF>::CompressedVector( const CompressedVector& sv )
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline CompressedVector<Type,TF,IT>::CompressedVector( const CompressedVector& sv )
    : CompressedVector( sv.size_, sv.nonZeros() )
 {
    end_ = begin_ + capacity_;
@@ -627,8 +655,9 @@ inline CompressedVector<Type,TF>::CompressedVector( const CompressedVector& sv )
 // \param sv The compressed vector to be moved into this instance.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline CompressedVector<Type,TF>::CompressedVector( CompressedVector&& sv ) noexcept
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline CompressedVector<Type,TF,IT>::CompressedVector( CompressedVector&& sv ) noexcept
    : size_    ( sv.size_ )      // The current size/dimension of the compressed vector
    , capacity_( sv.capacity_ )  // The maximum capacity of the compressed vector
    , begin_   ( sv.begin_ )     // Pointer to the first non-zero element of the compressed vector
@@ -648,9 +677,10 @@ inline CompressedVector<Type,TF>::CompressedVector( CompressedVector&& sv ) noex
 // \param dv Dense vector to be copied.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
 template< typename VT >  // Type of the foreign dense vector
-inline CompressedVector<Type,TF>::CompressedVector( const DenseVector<VT,TF>& dv )
+inline CompressedVector<Type,TF,IT>::CompressedVector( const DenseVector<VT,TF>& dv )
    : CompressedVector( (~dv).size() )
 {
    using blaze::assign;
@@ -666,9 +696,10 @@ inline CompressedVector<Type,TF>::CompressedVector( const DenseVector<VT,TF>& dv
 // \param sv Sparse vector to be copied.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
 template< typename VT >  // Type of the foreign sparse vector
-inline CompressedVector<Type,TF>::CompressedVector( const SparseVector<VT,TF>& sv )
+inline CompressedVector<Type,TF,IT>::CompressedVector( const SparseVector<VT,TF>& sv )
    : CompressedVector( (~sv).size(), (~sv).nonZeros() )
 {
    using blaze::assign;
@@ -690,8 +721,9 @@ inline CompressedVector<Type,TF>::CompressedVector( const SparseVector<VT,TF>& s
 /*!\brief The destructor for CompressedVector.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline CompressedVector<Type,TF>::~CompressedVector()
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline CompressedVector<Type,TF,IT>::~CompressedVector()
 {
    deallocate( begin_ );
 }
@@ -718,9 +750,10 @@ inline CompressedVector<Type,TF>::~CompressedVector()
 // vector are the begin() and end() functions.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename CompressedVector<Type,TF>::Reference
-   CompressedVector<Type,TF>::operator[]( size_t index ) noexcept
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename CompressedVector<Type,TF,IT>::Reference
+   CompressedVector<Type,TF,IT>::operator[]( size_t index ) noexcept
 {
    BLAZE_USER_ASSERT( index < size_, "Invalid compressed vector access index" );
 
@@ -736,9 +769,10 @@ inline typename CompressedVector<Type,TF>::Reference
 // \return Reference to the accessed value.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename CompressedVector<Type,TF>::ConstReference
-   CompressedVector<Type,TF>::operator[]( size_t index ) const noexcept
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename CompressedVector<Type,TF,IT>::ConstReference
+   CompressedVector<Type,TF,IT>::operator[]( size_t index ) const noexcept
 {
    BLAZE_USER_ASSERT( index < size_, "Invalid compressed vector access index" );
 
@@ -765,9 +799,10 @@ inline typename CompressedVector<Type,TF>::ConstReference
 // performs a check of the given access index.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename CompressedVector<Type,TF>::Reference
-   CompressedVector<Type,TF>::at( size_t index )
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename CompressedVector<Type,TF,IT>::Reference
+   CompressedVector<Type,TF,IT>::at( size_t index )
 {
    if( index >= size_ ) {
       BLAZE_THROW_OUT_OF_RANGE( "Invalid compressed vector access index" );
@@ -788,9 +823,10 @@ inline typename CompressedVector<Type,TF>::Reference
 // access indices.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename CompressedVector<Type,TF>::ConstReference
-   CompressedVector<Type,TF>::at( size_t index ) const
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename CompressedVector<Type,TF,IT>::ConstReference
+   CompressedVector<Type,TF,IT>::at( size_t index ) const
 {
    if( index >= size_ ) {
       BLAZE_THROW_OUT_OF_RANGE( "Invalid compressed vector access index" );
@@ -806,8 +842,9 @@ inline typename CompressedVector<Type,TF>::ConstReference
 // \return Iterator to the first non-zero element of the compressed vector.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename CompressedVector<Type,TF>::Iterator CompressedVector<Type,TF>::begin() noexcept
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename CompressedVector<Type,TF,IT>::Iterator CompressedVector<Type,TF,IT>::begin() noexcept
 {
    return Iterator( begin_ );
 }
@@ -820,9 +857,10 @@ inline typename CompressedVector<Type,TF>::Iterator CompressedVector<Type,TF>::b
 // \return Iterator to the first non-zero element of the compressed vector.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename CompressedVector<Type,TF>::ConstIterator
-   CompressedVector<Type,TF>::begin() const noexcept
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename CompressedVector<Type,TF,IT>::ConstIterator
+   CompressedVector<Type,TF,IT>::begin() const noexcept
 {
    return ConstIterator( begin_ );
 }
@@ -835,9 +873,10 @@ inline typename CompressedVector<Type,TF>::ConstIterator
 // \return Iterator to the first non-zero element of the compressed vector.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename CompressedVector<Type,TF>::ConstIterator
-   CompressedVector<Type,TF>::cbegin() const noexcept
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename CompressedVector<Type,TF,IT>::ConstIterator
+   CompressedVector<Type,TF,IT>::cbegin() const noexcept
 {
    return ConstIterator( begin_ );
 }
@@ -850,8 +889,9 @@ inline typename CompressedVector<Type,TF>::ConstIterator
 // \return Iterator just past the last non-zero element of the compressed vector.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename CompressedVector<Type,TF>::Iterator CompressedVector<Type,TF>::end() noexcept
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename CompressedVector<Type,TF,IT>::Iterator CompressedVector<Type,TF,IT>::end() noexcept
 {
    return Iterator( end_ );
 }
@@ -864,9 +904,10 @@ inline typename CompressedVector<Type,TF>::Iterator CompressedVector<Type,TF>::e
 // \return Iterator just past the last non-zero element of the compressed vector.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename CompressedVector<Type,TF>::ConstIterator
-   CompressedVector<Type,TF>::end() const noexcept
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename CompressedVector<Type,TF,IT>::ConstIterator
+   CompressedVector<Type,TF,IT>::end() const noexcept
 {
    return ConstIterator( end_ );
 }
@@ -879,9 +920,10 @@ inline typename CompressedVector<Type,TF>::ConstIterator
 // \return Iterator just past the last non-zero element of the compressed vector.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename CompressedVector<Type,TF>::ConstIterator
-   CompressedVector<Type,TF>::cend() const noexcept
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename CompressedVector<Type,TF,IT>::ConstIterator
+   CompressedVector<Type,TF,IT>::cend() const noexcept
 {
    return ConstIterator( end_ );
 }
@@ -913,9 +955,10 @@ inline typename CompressedVector<Type,TF>::ConstIterator
 // assigned the non-zero values from the given initializer list.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline CompressedVector<Type,TF>&
-   CompressedVector<Type,TF>::operator=( initializer_list<Type> list )
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline CompressedVector<Type,TF,IT>&
+   CompressedVector<Type,TF,IT>::operator=( initializer_list<Type> list )
 {
    using blaze::nonZeros;
 
@@ -945,9 +988,10 @@ inline CompressedVector<Type,TF>&
 // as a copy of this vector.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline CompressedVector<Type,TF>&
-   CompressedVector<Type,TF>::operator=( const CompressedVector& rhs )
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline CompressedVector<Type,TF,IT>&
+   CompressedVector<Type,TF,IT>::operator=( const CompressedVector& rhs )
 {
    using std::swap;
 
@@ -981,9 +1025,10 @@ inline CompressedVector<Type,TF>&
 // \return Reference to the assigned compressed vector.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline CompressedVector<Type,TF>&
-   CompressedVector<Type,TF>::operator=( CompressedVector&& rhs ) noexcept
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline CompressedVector<Type,TF,IT>&
+   CompressedVector<Type,TF,IT>::operator=( CompressedVector&& rhs ) noexcept
 {
    deallocate( begin_ );
 
@@ -1007,18 +1052,24 @@ inline CompressedVector<Type,TF>&
 //
 // \param rhs Dense vector to be copied.
 // \return Reference to the assigned compressed vector.
+// \exception std::invalid_argument Invalid size for the index type.
 //
 // The vector is resized according to the given dense vector and initialized as a copy of
 // this vector.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
 template< typename VT >  // Type of the right-hand side dense vector
-inline CompressedVector<Type,TF>&
-   CompressedVector<Type,TF>::operator=( const DenseVector<VT,TF>& rhs )
+inline CompressedVector<Type,TF,IT>&
+   CompressedVector<Type,TF,IT>::operator=( const DenseVector<VT,TF>& rhs )
 {
    using blaze::assign;
 
+   if( (~rhs).size() > std::numeric_limits<IT>::max() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid size for the index type" );
+   }
+
    if( (~rhs).canAlias( this ) ) {
       CompressedVector tmp( ~rhs );
       swap( tmp );
@@ -1039,18 +1090,24 @@ inline CompressedVector<Type,TF>&
 //
 // \param rhs Sparse vector to be copied.
 // \return Reference to the assigned compressed vector.
+// \exception std::invalid_argument Invalid size for the index type.
 //
 // The vector is resized according to the given sparse vector and initialized as a copy of
 // this vector.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
 template< typename VT >  // Type of the right-hand side sparse vector
-inline CompressedVector<Type,TF>&
-   CompressedVector<Type,TF>::operator=( const SparseVector<VT,TF>& rhs )
+inline CompressedVector<Type,TF,IT>&
+   CompressedVector<Type,TF,IT>::operator=( const SparseVector<VT,TF>& rhs )
 {
    using blaze::assign;
 
+   if( (~rhs).size() > std::numeric_limits<IT>::max() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid size for the index type" );
+   }
+
    if( (~rhs).canAlias( this ) || (~rhs).nonZeros() > capacity_ ) {
       CompressedVector tmp( ~rhs );
       swap( tmp );
@@ -1080,9 +1137,10 @@ inline CompressedVector<Type,TF>&
 // is thrown.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
 template< typename VT >  // Type of the right-hand side vector
-inline CompressedVector<Type,TF>& CompressedVector<Type,TF>::operator+=( const Vector<VT,TF>& rhs )
+inline CompressedVector<Type,TF,IT>& CompressedVector<Type,TF,IT>::operator+=( const Vector<VT,TF>& rhs )
 {
    using blaze::addAssign;
 
@@ -1110,9 +1168,10 @@ inline CompressedVector<Type,TF>& CompressedVector<Type,TF>::operator+=( const V
 // is thrown.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
 template< typename VT >  // Type of the right-hand side vector
-inline CompressedVector<Type,TF>& CompressedVector<Type,TF>::operator-=( const Vector<VT,TF>& rhs )
+inline CompressedVector<Type,TF,IT>& CompressedVector<Type,TF,IT>::operator-=( const Vector<VT,TF>& rhs )
 {
    using blaze::subAssign;
 
@@ -1141,10 +1200,11 @@ inline CompressedVector<Type,TF>& CompressedVector<Type,TF>::operator-=( const V
 // is thrown.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
 template< typename VT >  // Type of the right-hand side vector
-inline CompressedVector<Type,TF>&
-   CompressedVector<Type,TF>::operator*=( const DenseVector<VT,TF>& rhs )
+inline CompressedVector<Type,TF,IT>&
+   CompressedVector<Type,TF,IT>::operator*=( const DenseVector<VT,TF>& rhs )
 {
    using blaze::multAssign;
 
@@ -1178,10 +1238,11 @@ inline CompressedVector<Type,TF>&
 // is thrown.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
 template< typename VT >  // Type of the right-hand side vector
-inline CompressedVector<Type,TF>&
-   CompressedVector<Type,TF>::operator*=( const SparseVector<VT,TF>& rhs )
+inline CompressedVector<Type,TF,IT>&
+   CompressedVector<Type,TF,IT>::operator*=( const SparseVector<VT,TF>& rhs )
 {
    if( (~rhs).size() != size_ ) {
       BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
@@ -1211,9 +1272,10 @@ inline CompressedVector<Type,TF>&
 // is thrown.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
 template< typename VT >  // Type of the right-hand side vector
-inline CompressedVector<Type,TF>& CompressedVector<Type,TF>::operator/=( const DenseVector<VT,TF>& rhs )
+inline CompressedVector<Type,TF,IT>& CompressedVector<Type,TF,IT>::operator/=( const DenseVector<VT,TF>& rhs )
 {
    using blaze::divAssign;
 
@@ -1247,9 +1309,10 @@ inline CompressedVector<Type,TF>& CompressedVector<Type,TF>::operator/=( const D
 // exception is thrown.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
 template< typename VT >  // Type of the right-hand side vector
-inline CompressedVector<Type,TF>& CompressedVector<Type,TF>::operator%=( const Vector<VT,TF>& rhs )
+inline CompressedVector<Type,TF,IT>& CompressedVector<Type,TF,IT>::operator%=( const Vector<VT,TF>& rhs )
 {
    using blaze::assign;
 
@@ -1294,8 +1357,9 @@ inline CompressedVector<Type,TF>& CompressedVector<Type,TF>::operator%=( const V
 // \return The size of the compressed vector.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline size_t CompressedVector<Type,TF>::size() const noexcept
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline size_t CompressedVector<Type,TF,IT>::size() const noexcept
 {
    return size_;
 }
@@ -1308,8 +1372,9 @@ inline size_t CompressedVector<Type,TF>::size() const noexcept
 // \return The capacity of the compressed vector.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline size_t CompressedVector<Type,TF>::capacity() const noexcept
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline size_t CompressedVector<Type,TF,IT>::capacity() const noexcept
 {
    return capacity_;
 }
@@ -1325,8 +1390,9 @@ inline size_t CompressedVector<Type,TF>::capacity() const noexcept
 // compressed vector.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline size_t CompressedVector<Type,TF>::nonZeros() const
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline size_t CompressedVector<Type,TF,IT>::nonZeros() const
 {
    return end_ - begin_;
 }
@@ -1339,8 +1405,9 @@ inline size_t CompressedVector<Type,TF>::nonZeros() const
 // \return void
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline void CompressedVector<Type,TF>::reset()
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline void CompressedVector<Type,TF,IT>::reset()
 {
    end_ = begin_;
 }
@@ -1355,8 +1422,9 @@ inline void CompressedVector<Type,TF>::reset()
 // After the clear() function, the size of the compressed vector is 0.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline void CompressedVector<Type,TF>::clear()
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline void CompressedVector<Type,TF,IT>::clear()
 {
    size_ = 0UL;
    end_  = begin_;
@@ -1370,6 +1438,7 @@ inline void CompressedVector<Type,TF>::clear()
 // \param n The new size of the compressed vector.
 // \param preserve \a true if the old values of the vector should be preserved, \a false if not.
 // \return void
+// \exception std::invalid_argument Invalid size for the index type.
 //
 // This function resizes the compressed vector using the given size to \a n. During this
 // operation, new dynamic memory may be allocated in case the capacity of the compressed
@@ -1379,9 +1448,14 @@ inline void CompressedVector<Type,TF>::clear()
 // \a preserve flag can be set to \a true.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline void CompressedVector<Type,TF>::resize( size_t n, bool preserve )
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline void CompressedVector<Type,TF,IT>::resize( size_t n, bool preserve )
 {
+   if( n > std::numeric_limits<IT>::max() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid size for the index type" );
+   }
+
    if( preserve ) {
       end_ = lowerBound( n );
    }
@@ -1404,8 +1478,9 @@ inline void CompressedVector<Type,TF>::resize( size_t n, bool preserve )
 // current values of the vector elements are preserved.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-void CompressedVector<Type,TF>::reserve( size_t n )
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+void CompressedVector<Type,TF,IT>::reserve( size_t n )
 {
    using std::swap;
 
@@ -1435,8 +1510,9 @@ void CompressedVector<Type,TF>::reserve( size_t n )
 // and references to elements of this vector are invalidated.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline void CompressedVector<Type,TF>::shrinkToFit()
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline void CompressedVector<Type,TF,IT>::shrinkToFit()
 {
    if( nonZeros() < capacity_ ) {
       CompressedVector( *this ).swap( *this );
@@ -1452,8 +1528,9 @@ inline void CompressedVector<Type,TF>::shrinkToFit()
 // \return void
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline void CompressedVector<Type,TF>::swap( CompressedVector& sv ) noexcept
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline void CompressedVector<Type,TF,IT>::swap( CompressedVector& sv ) noexcept
 {
    using std::swap;
 
@@ -1474,8 +1551,9 @@ inline void CompressedVector<Type,TF>::swap( CompressedVector& sv ) noexcept
 // vector. Note that the new capacity is restricted to the interval \f$[7..size]\f$.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline size_t CompressedVector<Type,TF>::extendCapacity() const noexcept
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline size_t CompressedVector<Type,TF,IT>::extendCapacity() const noexcept
 {
    using blaze::max;
    using blaze::min;
@@ -1500,9 +1578,10 @@ inline size_t CompressedVector<Type,TF>::extendCapacity() const noexcept
 // derived elements.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename CompressedVector<Type,TF>::Iterator
-   CompressedVector<Type,TF>::castDown( IteratorBase it ) const noexcept
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename CompressedVector<Type,TF,IT>::Iterator
+   CompressedVector<Type,TF,IT>::castDown( IteratorBase it ) const noexcept
 {
    return static_cast<Iterator>( it );
 }
@@ -1518,9 +1597,10 @@ inline typename CompressedVector<Type,TF>::Iterator
 // to base elements.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename CompressedVector<Type,TF>::IteratorBase
-   CompressedVector<Type,TF>::castUp( Iterator it ) const noexcept
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename CompressedVector<Type,TF,IT>::IteratorBase
+   CompressedVector<Type,TF,IT>::castUp( Iterator it ) const noexcept
 {
    return static_cast<IteratorBase>( it );
 }
@@ -1547,9 +1627,10 @@ inline typename CompressedVector<Type,TF>::IteratorBase
 // the given \a value is inserted.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename CompressedVector<Type,TF>::Iterator
-   CompressedVector<Type,TF>::set( size_t index, const Type& value )
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename CompressedVector<Type,TF,IT>::Iterator
+   CompressedVector<Type,TF,IT>::set( size_t index, const Type& value )
 {
    BLAZE_USER_ASSERT( index < size_, "Invalid compressed vector access index" );
 
@@ -1577,9 +1658,10 @@ inline typename CompressedVector<Type,TF>::Iterator
 // a \a std::invalid_argument exception is thrown.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-typename CompressedVector<Type,TF>::Iterator
-   CompressedVector<Type,TF>::insert( size_t index, const Type& value )
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+typename CompressedVector<Type,TF,IT>::Iterator
+   CompressedVector<Type,TF,IT>::insert( size_t index, const Type& value )
 {
    BLAZE_USER_ASSERT( index < size_, "Invalid compressed vector access index" );
 
@@ -1604,9 +1686,10 @@ typename CompressedVector<Type,TF>::Iterator
 // \exception std::invalid_argument Invalid compressed vector access index.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-typename CompressedVector<Type,TF>::Iterator
-   CompressedVector<Type,TF>::insert( Iterator pos, size_t index, const Type& value )
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+typename CompressedVector<Type,TF,IT>::Iterator
+   CompressedVector<Type,TF,IT>::insert( Iterator pos, size_t index, const Type& value )
 {
    using std::swap;
 
@@ -1662,8 +1745,9 @@ typename CompressedVector<Type,TF>::Iterator
 // returned by the end() functions!
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline void CompressedVector<Type,TF>::append( size_t index, const Type& value, bool check )
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline void CompressedVector<Type,TF,IT>::append( size_t index, const Type& value, bool check )
 {
    BLAZE_USER_ASSERT( index < size_, "Invalid compressed vector access index" );
    BLAZE_USER_ASSERT( nonZeros() < capacity(), "Not enough reserved capacity" );
@@ -1696,8 +1780,9 @@ inline void CompressedVector<Type,TF>::append( size_t index, const Type& value,
 // This function erases an element from the compressed vector.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline void CompressedVector<Type,TF>::erase( size_t index )
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline void CompressedVector<Type,TF,IT>::erase( size_t index )
 {
    BLAZE_USER_ASSERT( index < size_, "Invalid compressed vector access index" );
 
@@ -1717,9 +1802,10 @@ inline void CompressedVector<Type,TF>::erase( size_t index )
 // This function erases an element from the compressed vector.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename CompressedVector<Type,TF>::Iterator
-   CompressedVector<Type,TF>::erase( Iterator pos )
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename CompressedVector<Type,TF,IT>::Iterator
+   CompressedVector<Type,TF,IT>::erase( Iterator pos )
 {
    BLAZE_USER_ASSERT( pos >= begin_ && pos <= end_, "Invalid compressed vector iterator" );
 
@@ -1740,9 +1826,10 @@ inline typename CompressedVector<Type,TF>::Iterator
 // This function erases a range of elements from the compressed vector.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename CompressedVector<Type,TF>::Iterator
-   CompressedVector<Type,TF>::erase( Iterator first, Iterator last )
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename CompressedVector<Type,TF,IT>::Iterator
+   CompressedVector<Type,TF,IT>::erase( Iterator first, Iterator last )
 {
    BLAZE_USER_ASSERT( first <= last, "Invalid iterator range" );
    BLAZE_USER_ASSERT( first >= begin_ && first <= end_, "Invalid compressed vector iterator" );
@@ -1777,10 +1864,11 @@ inline typename CompressedVector<Type,TF>::Iterator
 // with the same value. The attempt to use an impure predicate leads to undefined behavior!
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
 template< typename Pred  // Type of the unary predicate
         , typename >     // Type restriction on the unary predicate
-inline void CompressedVector<Type,TF>::erase( Pred predicate )
+inline void CompressedVector<Type,TF,IT>::erase( Pred predicate )
 {
    end_ = castDown( std::remove_if( castUp( begin_ ), castUp( end_ ),
                                     [predicate=predicate]( const ElementBase& element ) {
@@ -1814,9 +1902,10 @@ inline void CompressedVector<Type,TF>::erase( Pred predicate )
 // with the same value. The attempt to use an impure predicate leads to undefined behavior!
 */
 template< typename Type    // Data type of the vector
-        , bool TF >        // Transpose flag
+        , bool TF          // Transpose flag
+        , typename IT >    // Index type
 template< typename Pred >  // Type of the unary predicate
-inline void CompressedVector<Type,TF>::erase( Iterator first, Iterator last, Pred predicate )
+inline void CompressedVector<Type,TF,IT>::erase( Iterator first, Iterator last, Pred predicate )
 {
    BLAZE_USER_ASSERT( first <= last, "Invalid iterator range" );
    BLAZE_USER_ASSERT( first >= begin_ && first <= end_, "Invalid compressed vector iterator" );
@@ -1854,8 +1943,9 @@ inline void CompressedVector<Type,TF>::erase( Iterator first, Iterator last, Pre
 // operations via the subscript operator, the set() function or the insert() function!
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename CompressedVector<Type,TF>::Iterator CompressedVector<Type,TF>::find( size_t index )
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename CompressedVector<Type,TF,IT>::Iterator CompressedVector<Type,TF,IT>::find( size_t index )
 {
    return const_cast<Iterator>( const_cast<const This&>( *this ).find( index ) );
 }
@@ -1876,8 +1966,9 @@ inline typename CompressedVector<Type,TF>::Iterator CompressedVector<Type,TF>::f
 // operations via the subscript operator, the set() function or the insert() function!
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename CompressedVector<Type,TF>::ConstIterator CompressedVector<Type,TF>::find( size_t index ) const
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename CompressedVector<Type,TF,IT>::ConstIterator CompressedVector<Type,TF,IT>::find( size_t index ) const
 {
    const ConstIterator pos( lowerBound( index ) );
    if( pos != end_ && pos->index_ == index )
@@ -1900,9 +1991,10 @@ inline typename CompressedVector<Type,TF>::ConstIterator CompressedVector<Type,T
 // the set() function or the insert() function!
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename CompressedVector<Type,TF>::Iterator
-   CompressedVector<Type,TF>::lowerBound( size_t index )
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename CompressedVector<Type,TF,IT>::Iterator
+   CompressedVector<Type,TF,IT>::lowerBound( size_t index )
 {
    return const_cast<Iterator>( const_cast<const This&>( *this ).lowerBound( index ) );
 }
@@ -1922,9 +2014,10 @@ inline typename CompressedVector<Type,TF>::Iterator
 // the set() function or the insert() function!
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename CompressedVector<Type,TF>::ConstIterator
-   CompressedVector<Type,TF>::lowerBound( size_t index ) const
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename CompressedVector<Type,TF,IT>::ConstIterator
+   CompressedVector<Type,TF,IT>::lowerBound( size_t index ) const
 {
    return std::lower_bound( begin_, end_, index,
                             []( const Element& element, size_t i )
@@ -1948,9 +2041,10 @@ inline typename CompressedVector<Type,TF>::ConstIterator
 // the set() function or the insert() function!
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename CompressedVector<Type,TF>::Iterator
-   CompressedVector<Type,TF>::upperBound( size_t index )
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename CompressedVector<Type,TF,IT>::Iterator
+   CompressedVector<Type,TF,IT>::upperBound( size_t index )
 {
    return const_cast<Iterator>( const_cast<const This&>( *this ).upperBound( index ) );
 }
@@ -1970,9 +2064,10 @@ inline typename CompressedVector<Type,TF>::Iterator
 // the set() function or the insert() function!
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename CompressedVector<Type,TF>::ConstIterator
-   CompressedVector<Type,TF>::upperBound( size_t index ) const
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename CompressedVector<Type,TF,IT>::ConstIterator
+   CompressedVector<Type,TF,IT>::upperBound( size_t index ) const
 {
    return std::upper_bound( begin_, end_, index,
                             []( size_t i, const Element& element )
@@ -2009,9 +2104,10 @@ inline typename CompressedVector<Type,TF>::ConstIterator
    \endcode
 */
 template< typename Type     // Data type of the vector
-        , bool TF >         // Transpose flag
+        , bool TF           // Transpose flag
+        , typename IT >     // Index type
 template< typename Other >  // Data type of the scalar value
-inline CompressedVector<Type,TF>& CompressedVector<Type,TF>::scale( const Other& scalar )
+inline CompressedVector<Type,TF,IT>& CompressedVector<Type,TF,IT>::scale( const Other& scalar )
 {
    for( auto element=begin_; element!=end_; ++element )
       element->value_ *= scalar;
@@ -2039,9 +2135,10 @@ inline CompressedVector<Type,TF>& CompressedVector<Type,TF>::scale( const Other&
 // to optimize the evaluation.
 */
 template< typename Type     // Data type of the vector
-        , bool TF >         // Transpose flag
+        , bool TF           // Transpose flag
+        , typename IT >     // Index type
 template< typename Other >  // Data type of the foreign expression
-inline bool CompressedVector<Type,TF>::canAlias( const Other* alias ) const noexcept
+inline bool CompressedVector<Type,TF,IT>::canAlias( const Other* alias ) const noexcept
 {
    return static_cast<const void*>( this ) == static_cast<const void*>( alias );
 }
@@ -2059,9 +2156,10 @@ inline bool CompressedVector<Type,TF>::canAlias( const Other* alias ) const noex
 // to optimize the evaluation.
 */
 template< typename Type     // Data type of the vector
-        , bool TF >         // Transpose flag
+        , bool TF           // Transpose flag
+        , typename IT >     // Index type
 template< typename Other >  // Data type of the foreign expression
-inline bool CompressedVector<Type,TF>::isAliased( const Other* alias ) const noexcept
+inline bool CompressedVector<Type,TF,IT>::isAliased( const Other* alias ) const noexcept
 {
    return static_cast<const void*>( this ) == static_cast<const void*>( alias );
 }
@@ -2079,8 +2177,9 @@ inline bool CompressedVector<Type,TF>::isAliased( const Other* alias ) const noe
 // vector).
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline bool CompressedVector<Type,TF>::canSMPAssign() const noexcept
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline bool CompressedVector<Type,TF,IT>::canSMPAssign() const noexcept
 {
    return false;
 }
@@ -2099,9 +2198,10 @@ inline bool CompressedVector<Type,TF>::canSMPAssign() const noexcept
 // assignment operator.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
 template< typename VT >  // Type of the right-hand side dense vector
-inline void CompressedVector<Type,TF>::assign( const DenseVector<VT,TF>& rhs )
+inline void CompressedVector<Type,TF,IT>::assign( const DenseVector<VT,TF>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
    BLAZE_INTERNAL_ASSERT( nonZeros() == 0UL, "Invalid non-zero elements detected" );
@@ -2137,9 +2237,10 @@ inline void CompressedVector<Type,TF>::assign( const DenseVector<VT,TF>& rhs )
 // assignment operator.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
 template< typename VT >  // Type of the right-hand side sparse vector
-inline void CompressedVector<Type,TF>::assign( const SparseVector<VT,TF>& rhs )
+inline void CompressedVector<Type,TF,IT>::assign( const SparseVector<VT,TF>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
    BLAZE_INTERNAL_ASSERT( nonZeros() == 0UL, "Invalid non-zero elements detected" );
@@ -2168,9 +2269,10 @@ inline void CompressedVector<Type,TF>::assign( const SparseVector<VT,TF>& rhs )
 // assignment operator.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
 template< typename VT >  // Type of the right-hand side dense vector
-inline void CompressedVector<Type,TF>::addAssign( const DenseVector<VT,TF>& rhs )
+inline void CompressedVector<Type,TF,IT>::addAssign( const DenseVector<VT,TF>& rhs )
 {
    using AddType = AddTrait_t< This, ResultType_t<VT> >;
 
@@ -2199,9 +2301,10 @@ inline void CompressedVector<Type,TF>::addAssign( const DenseVector<VT,TF>& rhs
 // assignment operator.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
 template< typename VT >  // Type of the right-hand side sparse vector
-inline void CompressedVector<Type,TF>::addAssign( const SparseVector<VT,TF>& rhs )
+inline void CompressedVector<Type,TF,IT>::addAssign( const SparseVector<VT,TF>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
 
@@ -2223,9 +2326,10 @@ inline void CompressedVector<Type,TF>::addAssign( const SparseVector<VT,TF>& rhs
 // assignment operator.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
 template< typename VT >  // Type of the right-hand side dense vector
-inline void CompressedVector<Type,TF>::subAssign( const DenseVector<VT,TF>& rhs )
+inline void CompressedVector<Type,TF,IT>::subAssign( const DenseVector<VT,TF>& rhs )
 {
    using SubType = SubTrait_t< This, ResultType_t<VT> >;
 
@@ -2254,9 +2358,10 @@ inline void CompressedVector<Type,TF>::subAssign( const DenseVector<VT,TF>& rhs
 // assignment operator.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
 template< typename VT >  // Type of the right-hand side sparse vector
-inline void CompressedVector<Type,TF>::subAssign( const SparseVector<VT,TF>& rhs )
+inline void CompressedVector<Type,TF,IT>::subAssign( const SparseVector<VT,TF>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
 
@@ -2278,9 +2383,10 @@ inline void CompressedVector<Type,TF>::subAssign( const SparseVector<VT,TF>& rhs
 // assignment operator.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
 template< typename VT >  // Type of the right-hand side dense vector
-inline void CompressedVector<Type,TF>::multAssign( const DenseVector<VT,TF>& rhs )
+inline void CompressedVector<Type,TF,IT>::multAssign( const DenseVector<VT,TF>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
 
@@ -2305,9 +2411,10 @@ inline void CompressedVector<Type,TF>::multAssign( const DenseVector<VT,TF>& rhs
 // assignment operator.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
 template< typename VT >  // Type of the right-hand side dense vector
-inline void CompressedVector<Type,TF>::divAssign( const DenseVector<VT,TF>& rhs )
+inline void CompressedVector<Type,TF,IT>::divAssign( const DenseVector<VT,TF>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
 
@@ -2331,20 +2438,20 @@ inline void CompressedVector<Type,TF>::divAssign( const DenseVector<VT,TF>& rhs
 //*************************************************************************************************
 /*!\name CompressedVector operators */
 //@{
-template< typename Type, bool TF >
-void reset( CompressedVector<Type,TF>& v );
+template< typename Type, bool TF, typename IT >
+void reset( CompressedVector<Type,TF,IT>& v );
 
-template< typename Type, bool TF >
-void clear( CompressedVector<Type,TF>& v );
+template< typename Type, bool TF, typename IT >
+void clear( CompressedVector<Type,TF,IT>& v );
 
-template< bool RF, typename Type, bool TF >
-bool isDefault( const CompressedVector<Type,TF>& v );
+template< bool RF, typename Type, bool TF, typename IT >
+bool isDefault( const CompressedVector<Type,TF,IT>& v );
 
-template< typename Type, bool TF >
-bool isIntact( const CompressedVector<Type,TF>& v ) noexcept;
+template< typename Type, bool TF, typename IT >
+bool isIntact( const CompressedVector<Type,TF,IT>& v ) noexcept;
 
-template< typename Type, bool TF >
-void swap( CompressedVector<Type,TF>& a, CompressedVector<Type,TF>& b ) noexcept;
+template< typename Type, bool TF, typename IT >
+void swap( CompressedVector<Type,TF,IT>& a, CompressedVector<Type,TF,IT>& b ) noexcept;
 //@}
 //*************************************************************************************************
 
@@ -2357,8 +2464,9 @@ void swap( CompressedVector<Type,TF>& a, CompressedVector<Type,TF>& b ) noexcept
 // \return void
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline void reset( CompressedVector<Type,TF>& v )
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline void reset( CompressedVector<Type,TF,IT>& v )
 {
    v.reset();
 }
@@ -2373,8 +2481,9 @@ inline void reset( CompressedVector<Type,TF>& v )
 // \return void
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline void clear( CompressedVector<Type,TF>& v )
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline void clear( CompressedVector<Type,TF,IT>& v )
 {
    v.clear();
 }
@@ -2407,8 +2516,9 @@ inline void clear( CompressedVector<Type,TF>& v )
 */
 template< bool RF        // Relaxation flag
         , typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline bool isDefault( const CompressedVector<Type,TF>& v )
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline bool isDefault( const CompressedVector<Type,TF,IT>& v )
 {
    return ( v.size() == 0UL );
 }
@@ -2434,8 +2544,9 @@ inline bool isDefault( const CompressedVector<Type,TF>& v )
    \endcode
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline bool isIntact( const CompressedVector<Type,TF>& v ) noexcept
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline bool isIntact( const CompressedVector<Type,TF,IT>& v ) noexcept
 {
    return ( v.nonZeros() <= v.capacity() );
 }
@@ -2451,8 +2562,9 @@ inline bool isIntact( const CompressedVector<Type,TF>& v ) noexcept
 // \return void
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline void swap( CompressedVector<Type,TF>& a, CompressedVector<Type,TF>& b ) noexcept
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline void swap( CompressedVector<Type,TF,IT>& a, CompressedVector<Type,TF,IT>& b ) noexcept
 {
    a.swap( b );
 }
@@ -2469,8 +2581,8 @@ inline void swap( CompressedVector<Type,TF>& a, CompressedVector<Type,TF>& b ) n
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T, bool TF >
-struct IsResizable< CompressedVector<T,TF> >
+template< typename T, bool TF, typename IT >
+struct IsResizable< CompressedVector<T,TF,IT> >
    : public TrueType
 {};
 /*! \endcond */
@@ -2487,8 +2599,8 @@ struct IsResizable< CompressedVector<T,TF> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T, bool TF >
-struct IsShrinkable< CompressedVector<T,TF> >
+template< typename T, bool TF, typename IT >
+struct IsShrinkable< CompressedVector<T,TF,IT> >
    : public TrueType
 {};
 /*! \endcond */
@@ -2700,10 +2812,10 @@ struct UnaryMapTraitEval2< T, OP
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool TF, typename T2 >
-struct HighType< CompressedVector<T1,TF>, CompressedVector<T2,TF> >
+template< typename T1, bool TF, typename T2, typename IT >
+struct HighType< CompressedVector<T1,TF,IT>, CompressedVector<T2,TF,IT> >
 {
-   using Type = CompressedVector< typename HighType<T1,T2>::Type, TF >;
+   using Type = CompressedVector< typename HighType<T1,T2>::Type, TF, IT >;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -2719,10 +2831,10 @@ struct HighType< CompressedVector<T1,TF>, CompressedVector<T2,TF> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool TF, typename T2 >
-struct LowType< CompressedVector<T1,TF>, CompressedVector<T2,TF> >
+template< typename T1, bool TF, typename T2, typename IT >
+struct LowType< CompressedVector<T1,TF,IT>, CompressedVector<T2,TF,IT> >
 {
-   using Type = CompressedVector< typename LowType<T1,T2>::Type, TF >;
+   using Type = CompressedVector< typename LowType<T1,T2>::Type, TF, IT >;
 };
 /*! \endcond */
 //*************************************************************************************************
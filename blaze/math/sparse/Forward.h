@@ -44,9 +44,12 @@ namespace blaze {
 //
 //=================================================================================================
 
-template< typename, bool > class CompressedMatrix;
-template< typename, bool > class CompressedVector;
+template< typename, bool, typename > class CompressedMatrix;
+template< typename, bool, typename > class CompressedMatrixView;
+template< typename, bool, typename > class CompressedVector;
 template< typename, bool > class IdentityMatrix;
+template< typename, typename > class SlicedEllpackMatrix;
+template< typename, bool, typename > class SplitCompressedVector;
 template< typename, bool > class ZeroMatrix;
 template< typename, bool > class ZeroVector;
 
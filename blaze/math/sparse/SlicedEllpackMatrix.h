@@ -0,0 +1,1374 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/SlicedEllpackMatrix.h
+//  \brief Implementation of a sliced ELLPACK (SELL-C-sigma) sparse matrix
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_SLICEDELLPACKMATRIX_H_
+#define _BLAZE_MATH_SPARSE_SLICEDELLPACKMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/shims/Serial.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/sparse/ValueIndexPair.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/math/typetraits/IsSlicedEllpack.h>
+#include <blaze/math/typetraits/IsSparseMatrix.h>
+#include <blaze/system/StorageOrder.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/AlignedAllocator.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsSame.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup sliced_ellpack_matrix SlicedEllpackMatrix
+// \ingroup sparse_matrix
+*/
+/*!\brief Efficient implementation of a row-major sliced ELLPACK (SELL-C-sigma) sparse matrix.
+// \ingroup sliced_ellpack_matrix
+//
+// The SlicedEllpackMatrix class template is the representation of an immutable, arbitrarily
+// sized row-major sparse matrix, which is optimized for fast sparse matrix/dense vector
+// multiplications. The type of the elements and the type of the column indices can be specified
+// via the two template parameters:
+
+   \code
+   template< typename Type, typename IT >
+   class SlicedEllpackMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. SlicedEllpackMatrix can be used with any
+//          non-cv-qualified, non-reference, non-pointer element type.
+//  - IT  : specifies the type of the stored column indices, which is either \a size_t (the
+//          default) or \a uint32_t. In case the number of columns is known to be smaller than
+//          \f$ 2^{31} \f$, 32-bit indices halve the memory required for the indices and enable
+//          the use of 32-bit SIMD gathers.
+//
+// In contrast to CompressedMatrix, which stores the value and the index of each non-zero element
+// next to each other, the SlicedEllpackMatrix stores the values and the indices of the non-zero
+// elements in two separate arrays. The rows of the matrix are grouped into slices of \a C rows,
+// where \a C is the number of elements in a SIMD vector of the element type. Within a slice the
+// elements are stored column by column and each row of the slice is padded to the length of the
+// longest row of the slice. In order to minimize the padding, the rows within windows of \a sigma
+// consecutive rows are sorted according to their number of non-zero elements. This layout allows
+// the multiplication with a dense vector to process \a C rows at once by means of SIMD gathers.
+//
+// A SlicedEllpackMatrix is created by conversion from any other dense or sparse matrix. It is not
+// possible to insert, erase or modify the elements of a sliced ELLPACK matrix. It is only possible
+// to read from the elements:
+
+   \code
+   using blaze::SlicedEllpackMatrix;
+   using blaze::CompressedMatrix;
+   using blaze::DynamicVector;
+
+   CompressedMatrix<double> C( 1000UL, 1000UL );
+   // ... Initialization of C
+
+   // Creating a sliced ELLPACK matrix from the compressed matrix, using the default sorting scope
+   SlicedEllpackMatrix<double> A( C );
+
+   // Creating a sliced ELLPACK matrix from the compressed matrix, sorting windows of 64 rows
+   SlicedEllpackMatrix<double> B( C, 64UL );
+
+   A(1,2) = 2.0;       // Compilation error: It is not possible to write to a sliced ELLPACK matrix
+   double d = A(2,1);  // Access to the element (2,1)
+
+   // In order to traverse all non-zero elements currently stored in the matrix, the begin()
+   // and end() functions can be used. In the example, all non-zero elements of the 2nd row
+   // of A are traversed.
+   for( SlicedEllpackMatrix<double>::ConstIterator i=A.begin(1); i!=A.end(1); ++i ) {
+      ... = i->value();  // Access to the value of the non-zero element
+      ... = i->index();  // Access to the index of the non-zero element
+   }
+
+   DynamicVector<double> x( 1000UL ), y;
+   // ... Initialization of x
+
+   y = A * x;             // Vectorized sparse matrix/dense vector multiplication
+   y = trans( x ) * A;    // Vectorized transpose dense vector/sparse matrix multiplication
+   \endcode
+*/
+template< typename Type           // Data type of the matrix
+        , typename IT = size_t >  // Index type
+class SlicedEllpackMatrix
+   : public SparseMatrix< SlicedEllpackMatrix<Type,IT>, rowMajor >
+{
+ public:
+   //**Type definitions****************************************************************************
+   using This           = SlicedEllpackMatrix<Type,IT>;              //!< Type of this SlicedEllpackMatrix instance.
+   using BaseType       = SparseMatrix<This,rowMajor>;            //!< Base type of this SlicedEllpackMatrix instance.
+   using ResultType     = This;                                   //!< Result type for expression template evaluations.
+   using OppositeType   = CompressedMatrix<Type,columnMajor>;     //!< Result type with opposite storage order for expression template evaluations.
+   using TransposeType  = CompressedMatrix<Type,columnMajor>;     //!< Transpose type for expression template evaluations.
+   using ElementType    = Type;                                   //!< Type of the sparse matrix elements.
+   using ReturnType     = const Type;                             //!< Return type for expression template evaluations.
+   using CompositeType  = const This&;                            //!< Data type for composite expression templates.
+   using Reference      = const Type;                             //!< Reference to a sparse matrix element.
+   using ConstReference = const Type;                             //!< Reference to a constant sparse matrix element.
+   using IndexType      = IT;                                     //!< Type of the stored column indices.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a SlicedEllpackMatrix with different data/element type.
+   */
+   template< typename NewType >  // Data type of the other matrix
+   struct Rebind {
+      using Other = SlicedEllpackMatrix<NewType,IT>;  //!< The type of the other SlicedEllpackMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Resize struct definition********************************************************************
+   /*!\brief Resize mechanism to obtain a SlicedEllpackMatrix with different fixed dimensions.
+   */
+   template< size_t NewM    // Number of rows of the other matrix
+           , size_t NewN >  // Number of columns of the other matrix
+   struct Resize {
+      using Other = SlicedEllpackMatrix<Type,IT>;  //!< The type of the other SlicedEllpackMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! The number of rows per slice.
+   /*! The slice height corresponds to the number of elements in a SIMD vector of the element
+       type. In case the element type cannot be vectorized, each slice consists of a single row. */
+   static constexpr size_t SIMDSIZE = SIMDTrait<Type>::size;
+
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). */
+   static constexpr bool smpAssignable = false;
+
+   //! The default number of consecutive rows that are sorted according to their length.
+   static constexpr size_t defaultSigma = 32UL * SIMDSIZE;
+   //**********************************************************************************************
+
+   //**ConstIterator class definition**************************************************************
+   /*!\brief Iterator over the elements of a single row of the sliced ELLPACK matrix.
+   */
+   class ConstIterator
+   {
+    public:
+      //**Type definitions*************************************************************************
+      //! Element type of the sliced ELLPACK matrix.
+      using Element = ValueIndexPair<Type>;
+
+      using IteratorCategory = std::forward_iterator_tag;  //!< The iterator category.
+      using ValueType        = Element;                    //!< Type of the underlying pointers.
+      using PointerType      = ValueType*;                 //!< Pointer return type.
+      using ReferenceType    = ValueType&;                 //!< Reference return type.
+      using DifferenceType   = ptrdiff_t;                  //!< Difference between two iterators.
+
+      // STL iterator requirements
+      using iterator_category = IteratorCategory;  //!< The iterator category.
+      using value_type        = ValueType;         //!< Type of the underlying pointers.
+      using pointer           = PointerType;       //!< Pointer return type.
+      using reference         = ReferenceType;     //!< Reference return type.
+      using difference_type   = DifferenceType;    //!< Difference between two iterators.
+      //*******************************************************************************************
+
+      //**Default constructor**********************************************************************
+      /*!\brief Default constructor for the ConstIterator class.
+      */
+      inline ConstIterator() noexcept
+         : value_( nullptr )  // Pointer to the value of the current element
+         , index_( nullptr )  // Pointer to the index of the current element
+      {}
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the ConstIterator class.
+      //
+      // \param value Pointer to the value of the initial element.
+      // \param index Pointer to the index of the initial element.
+      */
+      inline ConstIterator( const Type* value, const IT* index ) noexcept
+         : value_( value )  // Pointer to the value of the current element
+         , index_( index )  // Pointer to the index of the current element
+      {}
+      //*******************************************************************************************
+
+      //**Prefix increment operator****************************************************************
+      /*!\brief Pre-increment operator.
+      //
+      // \return Reference to the incremented iterator.
+      */
+      inline ConstIterator& operator++() noexcept {
+         value_ += SIMDSIZE;
+         index_ += SIMDSIZE;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix increment operator***************************************************************
+      /*!\brief Post-increment operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline ConstIterator operator++( int ) noexcept {
+         ConstIterator tmp( *this );
+         ++(*this);
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the sparse matrix element at the current iterator position.
+      //
+      // \return The current value of the sparse element.
+      */
+      inline const Element operator*() const noexcept {
+         return Element( *value_, *index_ );
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the sparse matrix element at the current iterator position.
+      //
+      // \return Reference to the sparse matrix element at the current iterator position.
+      */
+      inline const ConstIterator* operator->() const noexcept {
+         return this;
+      }
+      //*******************************************************************************************
+
+      //**Value function***************************************************************************
+      /*!\brief Access to the current value of the sparse element.
+      //
+      // \return The current value of the sparse element.
+      */
+      inline const Type& value() const noexcept {
+         return *value_;
+      }
+      //*******************************************************************************************
+
+      //**Index function***************************************************************************
+      /*!\brief Access to the current index of the sparse element.
+      //
+      // \return The current index of the sparse element.
+      */
+      inline size_t index() const noexcept {
+         return *index_;
+      }
+      //*******************************************************************************************
+
+      //**Equality operator************************************************************************
+      /*!\brief Equality comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side ConstIterator object.
+      // \return \a true if the iterators refer to the same element, \a false if not.
+      */
+      inline bool operator==( const ConstIterator& rhs ) const noexcept {
+         return value_ == rhs.value_;
+      }
+      //*******************************************************************************************
+
+      //**Inequality operator**********************************************************************
+      /*!\brief Inequality comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side ConstIterator object.
+      // \return \a true if the iterators don't refer to the same element, \a false if they do.
+      */
+      inline bool operator!=( const ConstIterator& rhs ) const noexcept {
+         return value_ != rhs.value_;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Calculating the number of elements between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side ConstIterator object.
+      // \return The number of elements between the two ConstIterator objects.
+      */
+      inline DifferenceType operator-( const ConstIterator& rhs ) const noexcept {
+         return ( value_ - rhs.value_ ) / DifferenceType( SIMDSIZE );
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      const Type* value_;  //!< Pointer to the value of the current element.
+      const IT*   index_;  //!< Pointer to the index of the current element.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   using Iterator = ConstIterator;  //!< Iterator over non-constant elements.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline SlicedEllpackMatrix() noexcept;
+   inline SlicedEllpackMatrix( size_t m, size_t n );
+
+   template< typename MT, bool SO >
+   inline SlicedEllpackMatrix( const Matrix<MT,SO>& m );
+
+   template< typename MT, bool SO >
+   inline SlicedEllpackMatrix( const Matrix<MT,SO>& m, size_t sigma );
+
+   SlicedEllpackMatrix( const SlicedEllpackMatrix& ) = default;
+   SlicedEllpackMatrix( SlicedEllpackMatrix&& ) = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   ~SlicedEllpackMatrix() = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline ConstReference operator()( size_t i, size_t j ) const noexcept;
+   inline ConstReference at( size_t i, size_t j ) const;
+   inline ConstIterator  begin ( size_t i ) const noexcept;
+   inline ConstIterator  cbegin( size_t i ) const noexcept;
+   inline ConstIterator  end   ( size_t i ) const noexcept;
+   inline ConstIterator  cend  ( size_t i ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   template< typename MT, bool SO >
+   inline SlicedEllpackMatrix& operator=( const Matrix<MT,SO>& rhs );
+
+   SlicedEllpackMatrix& operator=( const SlicedEllpackMatrix& ) = default;
+   SlicedEllpackMatrix& operator=( SlicedEllpackMatrix&& ) = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows() const noexcept;
+   inline size_t columns() const noexcept;
+   inline size_t capacity() const noexcept;
+   inline size_t capacity( size_t i ) const noexcept;
+   inline size_t nonZeros() const noexcept;
+   inline size_t nonZeros( size_t i ) const noexcept;
+   inline void   clear();
+   inline void   swap( SlicedEllpackMatrix& m ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Lookup functions****************************************************************************
+   /*!\name Lookup functions */
+   //@{
+   inline ConstIterator find      ( size_t i, size_t j ) const;
+   inline ConstIterator lowerBound( size_t i, size_t j ) const;
+   inline ConstIterator upperBound( size_t i, size_t j ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Low-level data access functions*************************************************************
+   /*!\name Low-level data access functions */
+   //@{
+   inline size_t        slices() const noexcept;
+   inline size_t        sliceOffset( size_t s ) const noexcept;
+   inline size_t        sliceWidth( size_t s ) const noexcept;
+   inline size_t        rowIndex( size_t s, size_t k ) const noexcept;
+   inline size_t        rowLength( size_t s, size_t k ) const noexcept;
+   inline const Type*   values() const noexcept;
+   inline const IT*     indices() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const noexcept;
+   template< typename Other > inline bool isAliased( const Other* alias ) const noexcept;
+
+   inline bool canSMPAssign() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Construction functions**********************************************************************
+   /*!\name Construction functions */
+   //@{
+   template< typename MT >
+   inline void build( const MT& A, size_t sigma );
+   //@}
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   using Values  = std::vector< Type, AlignedAllocator<Type> >;  //!< Type of the value array.
+   using Indices = std::vector<IT>;                              //!< Type of the column index array.
+   using Sizes   = std::vector<size_t>;                          //!< Type of the row index arrays.
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t  m_;         //!< The current number of rows of the sparse matrix.
+   size_t  n_;         //!< The current number of columns of the sparse matrix.
+   size_t  nonzeros_;  //!< The total number of non-zero elements.
+   Sizes   offsets_;   //!< The offsets of the slices in the value and index arrays.
+   Sizes   rows_;      //!< The row index of each row position within the slices.
+   Sizes   lengths_;   //!< The number of non-zero elements of each row position within the slices.
+   Sizes   position_;  //!< The row position within the slices of each row.
+   Values  values_;    //!< The values of the non-zero elements.
+   Indices indices_;   //!< The column indices of the non-zero elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   BLAZE_STATIC_ASSERT( ( IsSame_v<IT,size_t> || IsSame_v<IT,uint32_t> ) );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for SlicedEllpackMatrix.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline SlicedEllpackMatrix<Type,IT>::SlicedEllpackMatrix() noexcept
+   : m_       ( 0UL )  // The current number of rows of the sparse matrix
+   , n_       ( 0UL )  // The current number of columns of the sparse matrix
+   , nonzeros_( 0UL )  // The total number of non-zero elements
+   , offsets_ ()       // The offsets of the slices in the value and index arrays
+   , rows_    ()       // The row index of each row position within the slices
+   , lengths_ ()       // The number of non-zero elements of each row position within the slices
+   , position_()       // The row position within the slices of each row
+   , values_  ()       // The values of the non-zero elements
+   , indices_ ()       // The column indices of the non-zero elements
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for an empty \f$ M \times N \f$ sliced ELLPACK matrix.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+//
+// The matrix is initialized without any non-zero elements.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline SlicedEllpackMatrix<Type,IT>::SlicedEllpackMatrix( size_t m, size_t n )
+   : SlicedEllpackMatrix()
+{
+   build( CompressedMatrix<Type,rowMajor>( m, n ), defaultSigma );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different matrices.
+//
+// \param m Matrix to be copied.
+//
+// The matrix is sized according to the given matrix and initialized as a copy of this matrix.
+// The rows are sorted within windows of \a defaultSigma rows.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+template< typename MT      // Type of the foreign matrix
+        , bool SO >        // Storage order of the foreign matrix
+inline SlicedEllpackMatrix<Type,IT>::SlicedEllpackMatrix( const Matrix<MT,SO>& m )
+   : SlicedEllpackMatrix( m, defaultSigma )
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different matrices with a specific sorting scope.
+//
+// \param m Matrix to be copied.
+// \param sigma The number of consecutive rows to be sorted according to their length.
+// \exception std::invalid_argument Invalid sorting scope.
+// \exception std::invalid_argument Invalid number of columns for the index type.
+//
+// The matrix is sized according to the given matrix and initialized as a copy of this matrix.
+// The rows are sorted within windows of \a sigma rows (rounded up to a multiple of the slice
+// height). A sorting scope of 1 disables the sorting.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+template< typename MT      // Type of the foreign matrix
+        , bool SO >        // Storage order of the foreign matrix
+inline SlicedEllpackMatrix<Type,IT>::SlicedEllpackMatrix( const Matrix<MT,SO>& m, size_t sigma )
+   : SlicedEllpackMatrix()
+{
+   if( sigma == 0UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid sorting scope" );
+   }
+
+   if( (~m).columns() > size_t( std::numeric_limits< std::make_signed_t<IT> >::max() ) + 1UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of columns for the index type" );
+   }
+
+   using Operand = If_t< IsSparseMatrix_v<MT> && IsRowMajorMatrix_v<MT>
+                       , CompositeType_t<MT>
+                       , const CompressedMatrix<Type,rowMajor> >;
+
+   Operand A( serial( ~m ) );
+   build( A, sigma );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the sparse matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return The value of the accessed element.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access indices.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline typename SlicedEllpackMatrix<Type,IT>::ConstReference
+   SlicedEllpackMatrix<Type,IT>::operator()( size_t i, size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const ConstIterator pos( lowerBound( i, j ) );
+
+   if( pos == end(i) || pos->index() != j )
+      return Type();
+   else
+      return pos->value();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the sparse matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return The value of the accessed element.
+// \exception std::out_of_range Invalid matrix access index.
+//
+// In contrast to the function call operator this function always performs a check of the
+// given access indices.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline typename SlicedEllpackMatrix<Type,IT>::ConstReference
+   SlicedEllpackMatrix<Type,IT>::at( size_t i, size_t j ) const
+{
+   if( i >= m_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first non-zero element of row \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline typename SlicedEllpackMatrix<Type,IT>::ConstIterator
+   SlicedEllpackMatrix<Type,IT>::begin( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
+
+   const size_t p( position_[i] );
+   const size_t offset( offsets_[p/SIMDSIZE] + p%SIMDSIZE );
+
+   return ConstIterator( values_.data() + offset, indices_.data() + offset );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first non-zero element of row \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline typename SlicedEllpackMatrix<Type,IT>::ConstIterator
+   SlicedEllpackMatrix<Type,IT>::cbegin( size_t i ) const noexcept
+{
+   return begin( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last non-zero element of row \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline typename SlicedEllpackMatrix<Type,IT>::ConstIterator
+   SlicedEllpackMatrix<Type,IT>::end( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
+
+   const size_t p( position_[i] );
+   const size_t offset( offsets_[p/SIMDSIZE] + p%SIMDSIZE + lengths_[p]*SIMDSIZE );
+
+   return ConstIterator( values_.data() + offset, indices_.data() + offset );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last non-zero element of row \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline typename SlicedEllpackMatrix<Type,IT>::ConstIterator
+   SlicedEllpackMatrix<Type,IT>::cend( size_t i ) const noexcept
+{
+   return end( i );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Assignment operator for different matrices.
+//
+// \param rhs Matrix to be copied.
+// \return Reference to the assigned matrix.
+//
+// The matrix is resized according to the given matrix and rebuilt as a copy of this matrix,
+// using the default sorting scope.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+template< typename MT      // Type of the right-hand side matrix
+        , bool SO >        // Storage order of the right-hand side matrix
+inline SlicedEllpackMatrix<Type,IT>&
+   SlicedEllpackMatrix<Type,IT>::operator=( const Matrix<MT,SO>& rhs )
+{
+   SlicedEllpackMatrix tmp( ~rhs );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the sparse matrix.
+//
+// \return The number of rows of the sparse matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline size_t SlicedEllpackMatrix<Type,IT>::rows() const noexcept
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the sparse matrix.
+//
+// \return The number of columns of the sparse matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline size_t SlicedEllpackMatrix<Type,IT>::columns() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of elements stored in the sparse matrix, including the padding.
+//
+// \return The capacity of the sparse matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline size_t SlicedEllpackMatrix<Type,IT>::capacity() const noexcept
+{
+   return ( offsets_.empty() ? 0UL : offsets_.back() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of elements stored for row \a i, including the padding.
+//
+// \param i The index of the row.
+// \return The capacity of row \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline size_t SlicedEllpackMatrix<Type,IT>::capacity( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid row access index" );
+   return sliceWidth( position_[i] / SIMDSIZE );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the total number of non-zero elements in the sparse matrix
+//
+// \return The number of non-zero elements in the sparse matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline size_t SlicedEllpackMatrix<Type,IT>::nonZeros() const noexcept
+{
+   return nonzeros_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified row.
+//
+// \param i The index of the row.
+// \return The number of non-zero elements of row \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline size_t SlicedEllpackMatrix<Type,IT>::nonZeros( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid row access index" );
+   return lengths_[position_[i]];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the sparse matrix.
+//
+// \return void
+//
+// After the clear() function, the size of the sparse matrix is 0.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline void SlicedEllpackMatrix<Type,IT>::clear()
+{
+   SlicedEllpackMatrix tmp;
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two sparse matrices.
+//
+// \param m The sparse matrix to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline void SlicedEllpackMatrix<Type,IT>::swap( SlicedEllpackMatrix& m ) noexcept
+{
+   using std::swap;
+
+   swap( m_, m.m_ );
+   swap( n_, m.n_ );
+   swap( nonzeros_, m.nonzeros_ );
+   swap( offsets_, m.offsets_ );
+   swap( rows_, m.rows_ );
+   swap( lengths_, m.lengths_ );
+   swap( position_, m.position_ );
+   swap( values_, m.values_ );
+   swap( indices_, m.indices_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOOKUP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline typename SlicedEllpackMatrix<Type,IT>::ConstIterator
+   SlicedEllpackMatrix<Type,IT>::find( size_t i, size_t j ) const
+{
+   const ConstIterator pos( lowerBound( i, j ) );
+   if( pos != end(i) && pos->index() == j )
+      return pos;
+   else return end(i);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline typename SlicedEllpackMatrix<Type,IT>::ConstIterator
+   SlicedEllpackMatrix<Type,IT>::lowerBound( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
+
+   const size_t p( position_[i] );
+   const size_t offset( offsets_[p/SIMDSIZE] + p%SIMDSIZE );
+
+   size_t first( 0UL ), count( lengths_[p] );
+
+   while( count > 0UL ) {
+      const size_t step( count / 2UL );
+      if( indices_[offset+(first+step)*SIMDSIZE] < j ) {
+         first += step + 1UL;
+         count -= step + 1UL;
+      }
+      else count = step;
+   }
+
+   return ConstIterator( values_.data()  + offset + first*SIMDSIZE,
+                         indices_.data() + offset + first*SIMDSIZE );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater then the given index, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline typename SlicedEllpackMatrix<Type,IT>::ConstIterator
+   SlicedEllpackMatrix<Type,IT>::upperBound( size_t i, size_t j ) const
+{
+   ConstIterator pos( lowerBound( i, j ) );
+   if( pos != end(i) && pos->index() == j )
+      ++pos;
+   return pos;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOW-LEVEL DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of slices of the sparse matrix.
+//
+// \return The number of slices of \a SIMDSIZE rows.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline size_t SlicedEllpackMatrix<Type,IT>::slices() const noexcept
+{
+   return ( offsets_.empty() ? 0UL : offsets_.size() - 1UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the offset of the given slice in the value and index arrays.
+//
+// \param s The index of the slice.
+// \return The offset of the first element of slice \a s.
+//
+// The element \a k of the row position \a r within slice \a s is stored at the offset
+// \f$ sliceOffset(s) + k \cdot SIMDSIZE + r \f$. The offset is a multiple of \a SIMDSIZE.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline size_t SlicedEllpackMatrix<Type,IT>::sliceOffset( size_t s ) const noexcept
+{
+   BLAZE_USER_ASSERT( s < slices(), "Invalid slice access index" );
+   return offsets_[s];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the width of the given slice, i.e. the length of its longest row.
+//
+// \param s The index of the slice.
+// \return The number of elements stored per row of slice \a s.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline size_t SlicedEllpackMatrix<Type,IT>::sliceWidth( size_t s ) const noexcept
+{
+   BLAZE_USER_ASSERT( s < slices(), "Invalid slice access index" );
+   return ( offsets_[s+1UL] - offsets_[s] ) / SIMDSIZE;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the index of the row stored at the given position of a slice.
+//
+// \param s The index of the slice.
+// \param k The row position within the slice. The index has to be in the range \f$[0..SIMDSIZE-1]\f$.
+// \return The index of the row, rows() in case the position is padding.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline size_t SlicedEllpackMatrix<Type,IT>::rowIndex( size_t s, size_t k ) const noexcept
+{
+   BLAZE_USER_ASSERT( s < slices(), "Invalid slice access index" );
+   BLAZE_USER_ASSERT( k < SIMDSIZE, "Invalid row position" );
+   return rows_[s*SIMDSIZE+k];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements of the row stored at the given position of a slice.
+//
+// \param s The index of the slice.
+// \param k The row position within the slice. The index has to be in the range \f$[0..SIMDSIZE-1]\f$.
+// \return The number of non-zero elements of the row, 0 in case the position is padding.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline size_t SlicedEllpackMatrix<Type,IT>::rowLength( size_t s, size_t k ) const noexcept
+{
+   BLAZE_USER_ASSERT( s < slices(), "Invalid slice access index" );
+   BLAZE_USER_ASSERT( k < SIMDSIZE, "Invalid row position" );
+   return lengths_[s*SIMDSIZE+k];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level access to the values of the non-zero elements.
+//
+// \return Pointer to the (properly aligned) value array.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline const Type* SlicedEllpackMatrix<Type,IT>::values() const noexcept
+{
+   return values_.data();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level access to the column indices of the non-zero elements.
+//
+// \return Pointer to the index array.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline const IT* SlicedEllpackMatrix<Type,IT>::indices() const noexcept
+{
+   return indices_.data();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address can alias with the matrix. In contrast
+// to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type    // Data type of the matrix
+        , typename IT >   // Index type
+template< typename Other >  // Data type of the foreign expression
+inline bool SlicedEllpackMatrix<Type,IT>::canAlias( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address is aliased with the matrix. In contrast
+// to the canAlias() function this function is not allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type    // Data type of the matrix
+        , typename IT >   // Index type
+template< typename Other >  // Data type of the foreign expression
+inline bool SlicedEllpackMatrix<Type,IT>::isAliased( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a true in case the matrix can be used in SMP assignments, \a false if not.
+//
+// This function returns whether the matrix can be used in SMP assignments. In contrast to the
+// \a smpAssignable member enumeration, which is based solely on compile time information, this
+// function additionally provides runtime information (as for instance the current number of
+// rows and/or columns of the matrix).
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline bool SlicedEllpackMatrix<Type,IT>::canSMPAssign() const noexcept
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Setup of the sliced ELLPACK layout from the given row-major sparse matrix.
+//
+// \param A The row-major sparse matrix to be converted.
+// \param sigma The number of consecutive rows to be sorted according to their length.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+template< typename MT >    // Type of the row-major sparse matrix
+inline void SlicedEllpackMatrix<Type,IT>::build( const MT& A, size_t sigma )
+{
+   const size_t m( A.rows() );
+   const size_t slices( ( m + SIMDSIZE - 1UL ) / SIMDSIZE );
+   const size_t window( ( ( sigma + SIMDSIZE - 1UL ) / SIMDSIZE ) * SIMDSIZE );
+
+   m_        = m;
+   n_        = A.columns();
+   nonzeros_ = 0UL;
+
+   // Sorting the rows within each window by descending number of non-zero elements
+   rows_.assign( slices*SIMDSIZE, m );
+   lengths_.assign( slices*SIMDSIZE, 0UL );
+   position_.resize( m );
+
+   for( size_t i=0UL; i<m; ++i ) {
+      rows_[i] = i;
+   }
+
+   for( size_t first=0UL; first<m; first+=window ) {
+      const size_t last( min( first+window, m ) );
+      std::stable_sort( rows_.begin()+first, rows_.begin()+last, [&A]( size_t i1, size_t i2 ) {
+         return A.nonZeros( i1 ) > A.nonZeros( i2 );
+      } );
+   }
+
+   for( size_t p=0UL; p<m; ++p ) {
+      position_[rows_[p]] = p;
+      lengths_[p] = A.nonZeros( rows_[p] );
+      nonzeros_ += lengths_[p];
+   }
+
+   // Computing the offsets of the slices
+   offsets_.resize( slices+1UL );
+   offsets_[0UL] = 0UL;
+
+   for( size_t s=0UL; s<slices; ++s ) {
+      const auto first( lengths_.begin() + s*SIMDSIZE );
+      offsets_[s+1UL] = offsets_[s] + SIMDSIZE * *std::max_element( first, first+SIMDSIZE );
+   }
+
+   // Storing the elements column by column within each slice
+   values_.assign( offsets_[slices] + SIMDSIZE, Type() );
+   indices_.assign( offsets_[slices] + SIMDSIZE, IT( 0 ) );
+
+   for( size_t p=0UL; p<m; ++p )
+   {
+      size_t offset( offsets_[p/SIMDSIZE] + p%SIMDSIZE );
+
+      const auto end( A.end( rows_[p] ) );
+      for( auto element=A.begin( rows_[p] ); element!=end; ++element ) {
+         values_ [offset] = element->value();
+         indices_[offset] = static_cast<IT>( element->index() );
+         offset += SIMDSIZE;
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SLICEDELLPACKMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name SlicedEllpackMatrix operators */
+//@{
+template< typename Type, typename IT >
+void clear( SlicedEllpackMatrix<Type,IT>& m );
+
+template< bool RF, typename Type, typename IT >
+bool isDefault( const SlicedEllpackMatrix<Type,IT>& m ) noexcept;
+
+template< typename Type, typename IT >
+bool isIntact( const SlicedEllpackMatrix<Type,IT>& m ) noexcept;
+
+template< typename Type, typename IT >
+void swap( SlicedEllpackMatrix<Type,IT>& a, SlicedEllpackMatrix<Type,IT>& b ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given sliced ELLPACK matrix.
+// \ingroup sliced_ellpack_matrix
+//
+// \param m The matrix to be cleared.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline void clear( SlicedEllpackMatrix<Type,IT>& m )
+{
+   m.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given sliced ELLPACK matrix is in default state.
+// \ingroup sliced_ellpack_matrix
+//
+// \param m The matrix to be tested for its default state.
+// \return \a true in case the given matrix's rows and columns are zero, \a false otherwise.
+//
+// This function checks whether the sliced ELLPACK matrix is in default (constructed) state,
+// i.e. if it's number of rows and columns is 0:
+
+   \code
+   blaze::SlicedEllpackMatrix<double> A;
+   // ... Initialization
+   if( isDefault( A ) ) { ... }
+   \endcode
+*/
+template< bool RF        // Relaxation flag
+        , typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline bool isDefault( const SlicedEllpackMatrix<Type,IT>& m ) noexcept
+{
+   return ( m.rows() == 0UL && m.columns() == 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the invariants of the given sliced ELLPACK matrix are intact.
+// \ingroup sliced_ellpack_matrix
+//
+// \param m The sliced ELLPACK matrix to be tested.
+// \return \a true in case the given matrix's invariants are intact, \a false otherwise.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline bool isIntact( const SlicedEllpackMatrix<Type,IT>& m ) noexcept
+{
+   return ( m.nonZeros() <= m.capacity() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two sliced ELLPACK matrices.
+// \ingroup sliced_ellpack_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline void swap( SlicedEllpackMatrix<Type,IT>& a, SlicedEllpackMatrix<Type,IT>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISSLICEDELLPACK SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, typename IT >
+struct IsSlicedEllpack< SlicedEllpackMatrix<T,IT> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
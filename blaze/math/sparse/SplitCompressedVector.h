@@ -0,0 +1,1108 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/SplitCompressedVector.h
+//  \brief Implementation of a sparse vector with separate value and index arrays
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SPARSE_SPLITCOMPRESSEDVECTOR_H_
+#define _BLAZE_MATH_SPARSE_SPLITCOMPRESSEDVECTOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/SparseVector.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/Serial.h>
+#include <blaze/math/sparse/CompressedVector.h>
+#include <blaze/math/sparse/ValueIndexPair.h>
+#include <blaze/math/typetraits/IsSparseVector.h>
+#include <blaze/math/typetraits/IsSplitCompressed.h>
+#include <blaze/system/TransposeFlag.h>
+#include <blaze/util/AlignedAllocator.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsSame.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup split_compressed_vector SplitCompressedVector
+// \ingroup sparse_vector
+*/
+/*!\brief Efficient implementation of a sparse vector with separate value and index arrays.
+// \ingroup split_compressed_vector
+//
+// The SplitCompressedVector class template is the representation of an immutable, arbitrarily
+// sized sparse vector, which is optimized for fast inner products. The type of the elements,
+// the transpose flag and the type of the indices can be specified via the three template
+// parameters:
+
+   \code
+   template< typename Type, bool TF, typename IT >
+   class SplitCompressedVector;
+   \endcode
+
+//  - Type: specifies the type of the vector elements. SplitCompressedVector can be used with any
+//          non-cv-qualified, non-reference, non-pointer element type.
+//  - TF  : specifies whether the vector is a row vector (\a blaze::rowVector) or a column
+//          vector (\a blaze::columnVector). The default value is \a blaze::defaultTransposeFlag.
+//  - IT  : specifies the type of the stored indices, which is either \a size_t (the default)
+//          or \a uint32_t. In case the size of the vector is known to be smaller than
+//          \f$ 2^{31} \f$, 32-bit indices halve the memory required for the indices and enable
+//          the use of 32-bit SIMD gathers.
+//
+// In contrast to CompressedVector, which stores the value and the index of each non-zero element
+// next to each other, the SplitCompressedVector stores the values and the indices of the non-zero
+// elements in two separate, contiguous arrays (structure of arrays). Algorithms that only need
+// the indices (as for instance the intersection of the non-zero patterns of two sparse vectors)
+// therefore only stream the index array, and the inner product with a dense vector is computed
+// by means of SIMD loads of the values and SIMD gathers of the according dense vector elements.
+//
+// A SplitCompressedVector is created by conversion from any other dense or sparse vector. It is
+// not possible to insert, erase or modify the elements of the vector. It is only possible to
+// read from the elements:
+
+   \code
+   using blaze::SplitCompressedVector;
+   using blaze::CompressedVector;
+   using blaze::DynamicVector;
+   using blaze::columnVector;
+
+   CompressedVector<double,columnVector> c( 1000UL );
+   // ... Initialization of c
+
+   // Creating a split compressed vector from the compressed vector
+   SplitCompressedVector<double,columnVector> a( c );
+
+   a[2] = 2.0;        // Compilation error: It is not possible to write to a split compressed vector
+   double d = a[2];   // Access to the element at index 2
+
+   // In order to traverse all non-zero elements currently stored in the vector, the begin()
+   // and end() functions can be used.
+   for( SplitCompressedVector<double>::ConstIterator i=a.begin(); i!=a.end(); ++i ) {
+      ... = i->value();  // Access to the value of the non-zero element
+      ... = i->index();  // Access to the index of the non-zero element
+   }
+
+   DynamicVector<double,columnVector> x( 1000UL );
+   // ... Initialization of x
+
+   d = trans( x ) * a;  // Vectorized dense vector/sparse vector inner product
+   d = trans( a ) * a;  // Sparse vector/sparse vector inner product on the index arrays
+   \endcode
+
+// Apart from the inner products the SplitCompressedVector can be used in all vector operations
+// as any other sparse vector.
+*/
+template< typename Type                     // Data type of the vector
+        , bool TF = defaultTransposeFlag    // Transpose flag
+        , typename IT = size_t >            // Index type
+class SplitCompressedVector
+   : public SparseVector< SplitCompressedVector<Type,TF,IT>, TF >
+{
+ public:
+   //**Type definitions****************************************************************************
+   using This           = SplitCompressedVector<Type,TF,IT>;    //!< Type of this SplitCompressedVector instance.
+   using BaseType       = SparseVector<This,TF>;                //!< Base type of this SplitCompressedVector instance.
+   using ResultType     = This;                                 //!< Result type for expression template evaluations.
+   using TransposeType  = SplitCompressedVector<Type,!TF,IT>;   //!< Transpose type for expression template evaluations.
+   using ElementType    = Type;                                 //!< Type of the sparse vector elements.
+   using ReturnType     = const Type;                           //!< Return type for expression template evaluations.
+   using CompositeType  = const This&;                          //!< Data type for composite expression templates.
+   using Reference      = const Type;                           //!< Reference to a sparse vector element.
+   using ConstReference = const Type;                           //!< Reference to a constant sparse vector element.
+   using IndexType      = IT;                                   //!< Type of the stored indices.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a SplitCompressedVector with different data/element type.
+   */
+   template< typename NewType >  // Data type of the other vector
+   struct Rebind {
+      using Other = SplitCompressedVector<NewType,TF,IT>;  //!< The type of the other SplitCompressedVector.
+   };
+   //**********************************************************************************************
+
+   //**Resize struct definition********************************************************************
+   /*!\brief Resize mechanism to obtain a SplitCompressedVector with a different fixed number of elements.
+   */
+   template< size_t NewN >  // Number of elements of the other vector
+   struct Resize {
+      using Other = SplitCompressedVector<Type,TF,IT>;  //!< The type of the other SplitCompressedVector.
+   };
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the vector can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). */
+   static constexpr bool smpAssignable = false;
+   //**********************************************************************************************
+
+   //**ConstIterator class definition**************************************************************
+   /*!\brief Iterator over the non-zero elements of the split compressed vector.
+   */
+   class ConstIterator
+   {
+    public:
+      //**Type definitions*************************************************************************
+      //! Element type of the split compressed vector.
+      using Element = ValueIndexPair<Type>;
+
+      using IteratorCategory = std::forward_iterator_tag;  //!< The iterator category.
+      using ValueType        = Element;                    //!< Type of the underlying pointers.
+      using PointerType      = ValueType*;                 //!< Pointer return type.
+      using ReferenceType    = ValueType&;                 //!< Reference return type.
+      using DifferenceType   = ptrdiff_t;                  //!< Difference between two iterators.
+
+      // STL iterator requirements
+      using iterator_category = IteratorCategory;  //!< The iterator category.
+      using value_type        = ValueType;         //!< Type of the underlying pointers.
+      using pointer           = PointerType;       //!< Pointer return type.
+      using reference         = ReferenceType;     //!< Reference return type.
+      using difference_type   = DifferenceType;    //!< Difference between two iterators.
+      //*******************************************************************************************
+
+      //**Default constructor**********************************************************************
+      /*!\brief Default constructor for the ConstIterator class.
+      */
+      inline ConstIterator() noexcept
+         : value_( nullptr )  // Pointer to the value of the current element
+         , index_( nullptr )  // Pointer to the index of the current element
+      {}
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the ConstIterator class.
+      //
+      // \param value Pointer to the value of the initial element.
+      // \param index Pointer to the index of the initial element.
+      */
+      inline ConstIterator( const Type* value, const IT* index ) noexcept
+         : value_( value )  // Pointer to the value of the current element
+         , index_( index )  // Pointer to the index of the current element
+      {}
+      //*******************************************************************************************
+
+      //**Prefix increment operator****************************************************************
+      /*!\brief Pre-increment operator.
+      //
+      // \return Reference to the incremented iterator.
+      */
+      inline ConstIterator& operator++() noexcept {
+         ++value_;
+         ++index_;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix increment operator***************************************************************
+      /*!\brief Post-increment operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline ConstIterator operator++( int ) noexcept {
+         ConstIterator tmp( *this );
+         ++(*this);
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the sparse vector element at the current iterator position.
+      //
+      // \return The current value of the sparse element.
+      */
+      inline const Element operator*() const noexcept {
+         return Element( *value_, *index_ );
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the sparse vector element at the current iterator position.
+      //
+      // \return Reference to the sparse vector element at the current iterator position.
+      */
+      inline const ConstIterator* operator->() const noexcept {
+         return this;
+      }
+      //*******************************************************************************************
+
+      //**Value function***************************************************************************
+      /*!\brief Access to the current value of the sparse element.
+      //
+      // \return The current value of the sparse element.
+      */
+      inline const Type& value() const noexcept {
+         return *value_;
+      }
+      //*******************************************************************************************
+
+      //**Index function***************************************************************************
+      /*!\brief Access to the current index of the sparse element.
+      //
+      // \return The current index of the sparse element.
+      */
+      inline size_t index() const noexcept {
+         return *index_;
+      }
+      //*******************************************************************************************
+
+      //**Equality operator************************************************************************
+      /*!\brief Equality comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side ConstIterator object.
+      // \return \a true if the iterators refer to the same element, \a false if not.
+      */
+      inline bool operator==( const ConstIterator& rhs ) const noexcept {
+         return value_ == rhs.value_;
+      }
+      //*******************************************************************************************
+
+      //**Inequality operator**********************************************************************
+      /*!\brief Inequality comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side ConstIterator object.
+      // \return \a true if the iterators don't refer to the same element, \a false if they do.
+      */
+      inline bool operator!=( const ConstIterator& rhs ) const noexcept {
+         return value_ != rhs.value_;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Calculating the number of elements between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side ConstIterator object.
+      // \return The number of elements between the two ConstIterator objects.
+      */
+      inline DifferenceType operator-( const ConstIterator& rhs ) const noexcept {
+         return value_ - rhs.value_;
+      }
+      //*******************************************************************************************
+
+      //**Base function****************************************************************************
+      /*!\brief Low-level access to the value array at the current iterator position.
+      //
+      // \return Pointer to the value of the current element.
+      */
+      inline const Type* valueBase() const noexcept {
+         return value_;
+      }
+      //*******************************************************************************************
+
+      //**Base function****************************************************************************
+      /*!\brief Low-level access to the index array at the current iterator position.
+      //
+      // \return Pointer to the index of the current element.
+      */
+      inline const IT* indexBase() const noexcept {
+         return index_;
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      const Type* value_;  //!< Pointer to the value of the current element.
+      const IT*   index_;  //!< Pointer to the index of the current element.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   using Iterator = ConstIterator;  //!< Iterator over non-constant elements.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline SplitCompressedVector() noexcept;
+   explicit inline SplitCompressedVector( size_t n );
+
+   template< typename VT >
+   inline SplitCompressedVector( const Vector<VT,TF>& v );
+
+   SplitCompressedVector( const SplitCompressedVector& ) = default;
+   SplitCompressedVector( SplitCompressedVector&& ) = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   ~SplitCompressedVector() = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline ConstReference operator[]( size_t index ) const noexcept;
+   inline ConstReference at( size_t index ) const;
+   inline ConstIterator  begin () const noexcept;
+   inline ConstIterator  cbegin() const noexcept;
+   inline ConstIterator  end   () const noexcept;
+   inline ConstIterator  cend  () const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   template< typename VT >
+   inline SplitCompressedVector& operator=( const Vector<VT,TF>& rhs );
+
+   SplitCompressedVector& operator=( const SplitCompressedVector& ) = default;
+   SplitCompressedVector& operator=( SplitCompressedVector&& ) = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t size() const noexcept;
+   inline size_t capacity() const noexcept;
+   inline size_t nonZeros() const noexcept;
+   inline void   clear();
+   inline void   swap( SplitCompressedVector& v ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Lookup functions****************************************************************************
+   /*!\name Lookup functions */
+   //@{
+   inline ConstIterator find      ( size_t index ) const;
+   inline ConstIterator lowerBound( size_t index ) const;
+   inline ConstIterator upperBound( size_t index ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Low-level data access functions*************************************************************
+   /*!\name Low-level data access functions */
+   //@{
+   inline const Type* values() const noexcept;
+   inline const IT*   indices() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const noexcept;
+   template< typename Other > inline bool isAliased( const Other* alias ) const noexcept;
+
+   inline bool canSMPAssign() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   using Values  = std::vector< Type, AlignedAllocator<Type> >;  //!< Type of the value array.
+   using Indices = std::vector<IT>;                              //!< Type of the index array.
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t  size_;     //!< The current size/dimension of the sparse vector.
+   Values  values_;   //!< The values of the non-zero elements.
+   Indices indices_;  //!< The indices of the non-zero elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   BLAZE_STATIC_ASSERT( ( IsSame_v<IT,size_t> || IsSame_v<IT,uint32_t> ) );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for SplitCompressedVector.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline SplitCompressedVector<Type,TF,IT>::SplitCompressedVector() noexcept
+   : size_   ( 0UL )  // The current size/dimension of the sparse vector
+   , values_ ()       // The values of the non-zero elements
+   , indices_()       // The indices of the non-zero elements
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for an empty split compressed vector of size \a n.
+//
+// \param n The size of the vector.
+// \exception std::invalid_argument Invalid size for the index type.
+//
+// The vector is initialized without any non-zero elements.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline SplitCompressedVector<Type,TF,IT>::SplitCompressedVector( size_t n )
+   : SplitCompressedVector()
+{
+   if( n > size_t( std::numeric_limits< std::make_signed_t<IT> >::max() ) + 1UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid size for the index type" );
+   }
+
+   size_ = n;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different vectors.
+//
+// \param v Vector to be copied.
+// \exception std::invalid_argument Invalid size for the index type.
+//
+// The vector is sized according to the given vector and initialized as a copy of this vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+template< typename VT >  // Type of the foreign vector
+inline SplitCompressedVector<Type,TF,IT>::SplitCompressedVector( const Vector<VT,TF>& v )
+   : SplitCompressedVector( (~v).size() )
+{
+   using Operand = If_t< IsSparseVector_v<VT>
+                       , CompositeType_t<VT>
+                       , const CompressedVector<Type,TF> >;
+
+   Operand x( serial( ~v ) );
+
+   values_.reserve( x.nonZeros() );
+   indices_.reserve( x.nonZeros() );
+
+   for( auto element=x.begin(); element!=x.end(); ++element ) {
+      values_.push_back( element->value() );
+      indices_.push_back( static_cast<IT>( element->index() ) );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Subscript operator for the direct access to the split compressed vector elements.
+//
+// \param index Access index. The index has to be in the range \f$[0..N-1]\f$.
+// \return The value of the accessed element.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access index.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename SplitCompressedVector<Type,TF,IT>::ConstReference
+   SplitCompressedVector<Type,TF,IT>::operator[]( size_t index ) const noexcept
+{
+   BLAZE_USER_ASSERT( index < size(), "Invalid split compressed vector access index" );
+
+   const ConstIterator pos( lowerBound( index ) );
+
+   if( pos == end() || pos->index() != index )
+      return Type();
+   else
+      return pos->value();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the split compressed vector elements.
+//
+// \param index Access index. The index has to be in the range \f$[0..N-1]\f$.
+// \return The value of the accessed element.
+// \exception std::out_of_range Invalid split compressed vector access index.
+//
+// In contrast to the subscript operator this function always performs a check of the given
+// access index.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename SplitCompressedVector<Type,TF,IT>::ConstReference
+   SplitCompressedVector<Type,TF,IT>::at( size_t index ) const
+{
+   if( index >= size_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid split compressed vector access index" );
+   }
+   return (*this)[index];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of the split compressed vector.
+//
+// \return Iterator to the first non-zero element of the split compressed vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename SplitCompressedVector<Type,TF,IT>::ConstIterator
+   SplitCompressedVector<Type,TF,IT>::begin() const noexcept
+{
+   return ConstIterator( values_.data(), indices_.data() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of the split compressed vector.
+//
+// \return Iterator to the first non-zero element of the split compressed vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename SplitCompressedVector<Type,TF,IT>::ConstIterator
+   SplitCompressedVector<Type,TF,IT>::cbegin() const noexcept
+{
+   return begin();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of the split compressed vector.
+//
+// \return Iterator just past the last non-zero element of the split compressed vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename SplitCompressedVector<Type,TF,IT>::ConstIterator
+   SplitCompressedVector<Type,TF,IT>::end() const noexcept
+{
+   return ConstIterator( values_.data() + values_.size(), indices_.data() + indices_.size() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of the split compressed vector.
+//
+// \return Iterator just past the last non-zero element of the split compressed vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename SplitCompressedVector<Type,TF,IT>::ConstIterator
+   SplitCompressedVector<Type,TF,IT>::cend() const noexcept
+{
+   return end();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Assignment operator for different vectors.
+//
+// \param rhs Vector to be copied.
+// \return Reference to the assigned vector.
+// \exception std::invalid_argument Invalid size for the index type.
+//
+// The vector is resized according to the given vector and rebuilt as a copy of this vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+template< typename VT >  // Type of the right-hand side vector
+inline SplitCompressedVector<Type,TF,IT>&
+   SplitCompressedVector<Type,TF,IT>::operator=( const Vector<VT,TF>& rhs )
+{
+   SplitCompressedVector tmp( ~rhs );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current size/dimension of the split compressed vector.
+//
+// \return The size of the split compressed vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline size_t SplitCompressedVector<Type,TF,IT>::size() const noexcept
+{
+   return size_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of elements stored in the split compressed vector.
+//
+// \return The capacity of the split compressed vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline size_t SplitCompressedVector<Type,TF,IT>::capacity() const noexcept
+{
+   return values_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the split compressed vector.
+//
+// \return The number of non-zero elements in the split compressed vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline size_t SplitCompressedVector<Type,TF,IT>::nonZeros() const noexcept
+{
+   return values_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the split compressed vector.
+//
+// \return void
+//
+// After the clear() function, the size of the split compressed vector is 0.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline void SplitCompressedVector<Type,TF,IT>::clear()
+{
+   SplitCompressedVector tmp;
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two split compressed vectors.
+//
+// \param v The split compressed vector to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline void SplitCompressedVector<Type,TF,IT>::swap( SplitCompressedVector& v ) noexcept
+{
+   using std::swap;
+
+   swap( size_, v.size_ );
+   swap( values_, v.values_ );
+   swap( indices_, v.indices_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOOKUP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Searches for a specific vector element.
+//
+// \param index The index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename SplitCompressedVector<Type,TF,IT>::ConstIterator
+   SplitCompressedVector<Type,TF,IT>::find( size_t index ) const
+{
+   const ConstIterator pos( lowerBound( index ) );
+   if( pos != end() && pos->index() == index )
+      return pos;
+   else return end();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param index The index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+//
+// The search only touches the index array.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename SplitCompressedVector<Type,TF,IT>::ConstIterator
+   SplitCompressedVector<Type,TF,IT>::lowerBound( size_t index ) const
+{
+   const size_t pos( std::lower_bound( indices_.begin(), indices_.end(), index,
+                                       []( IT i, size_t j ) { return size_t( i ) < j; } )
+                     - indices_.begin() );
+
+   return ConstIterator( values_.data() + pos, indices_.data() + pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater then the given index.
+//
+// \param index The index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater then the given index, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename SplitCompressedVector<Type,TF,IT>::ConstIterator
+   SplitCompressedVector<Type,TF,IT>::upperBound( size_t index ) const
+{
+   ConstIterator pos( lowerBound( index ) );
+   if( pos != end() && pos->index() == index )
+      ++pos;
+   return pos;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOW-LEVEL DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Low-level access to the values of the non-zero elements.
+//
+// \return Pointer to the (properly aligned) value array.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline const Type* SplitCompressedVector<Type,TF,IT>::values() const noexcept
+{
+   return values_.data();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level access to the indices of the non-zero elements.
+//
+// \return Pointer to the index array.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline const IT* SplitCompressedVector<Type,TF,IT>::indices() const noexcept
+{
+   return indices_.data();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the vector can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this vector, \a false if not.
+//
+// This function returns whether the given address can alias with the vector. In contrast
+// to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename IT >     // Index type
+template< typename Other >  // Data type of the foreign expression
+inline bool SplitCompressedVector<Type,TF,IT>::canAlias( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the vector is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this vector, \a false if not.
+//
+// This function returns whether the given address is aliased with the vector. In contrast
+// to the canAlias() function this function is not allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename IT >     // Index type
+template< typename Other >  // Data type of the foreign expression
+inline bool SplitCompressedVector<Type,TF,IT>::isAliased( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the vector can be used in SMP assignments.
+//
+// \return \a true in case the vector can be used in SMP assignments, \a false if not.
+//
+// This function returns whether the vector can be used in SMP assignments. In contrast to the
+// \a smpAssignable member enumeration, which is based solely on compile time information, this
+// function additionally provides runtime information (as for instance the current size of the
+// vector).
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline bool SplitCompressedVector<Type,TF,IT>::canSMPAssign() const noexcept
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SPLITCOMPRESSEDVECTOR OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name SplitCompressedVector operators */
+//@{
+template< typename Type, bool TF, typename IT >
+void clear( SplitCompressedVector<Type,TF,IT>& v );
+
+template< bool RF, typename Type, bool TF, typename IT >
+bool isDefault( const SplitCompressedVector<Type,TF,IT>& v ) noexcept;
+
+template< typename Type, bool TF, typename IT >
+bool isIntact( const SplitCompressedVector<Type,TF,IT>& v ) noexcept;
+
+template< typename Type, bool TF, typename IT >
+void swap( SplitCompressedVector<Type,TF,IT>& a, SplitCompressedVector<Type,TF,IT>& b ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given split compressed vector.
+// \ingroup split_compressed_vector
+//
+// \param v The vector to be cleared.
+// \return void
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline void clear( SplitCompressedVector<Type,TF,IT>& v )
+{
+   v.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given split compressed vector is in default state.
+// \ingroup split_compressed_vector
+//
+// \param v The vector to be tested for its default state.
+// \return \a true in case the given vector's size is zero, \a false otherwise.
+//
+// This function checks whether the split compressed vector is in default (constructed) state,
+// i.e. if it's size is 0:
+
+   \code
+   blaze::SplitCompressedVector<double> a;
+   // ... Initialization
+   if( isDefault( a ) ) { ... }
+   \endcode
+*/
+template< bool RF        // Relaxation flag
+        , typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline bool isDefault( const SplitCompressedVector<Type,TF,IT>& v ) noexcept
+{
+   return ( v.size() == 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the invariants of the given split compressed vector are intact.
+// \ingroup split_compressed_vector
+//
+// \param v The split compressed vector to be tested.
+// \return \a true in case the given vector's invariants are intact, \a false otherwise.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline bool isIntact( const SplitCompressedVector<Type,TF,IT>& v ) noexcept
+{
+   return ( v.nonZeros() <= v.size() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two split compressed vectors.
+// \ingroup split_compressed_vector
+//
+// \param a The first vector to be swapped.
+// \param b The second vector to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline void swap( SplitCompressedVector<Type,TF,IT>& a, SplitCompressedVector<Type,TF,IT>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISSPLITCOMPRESSED SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool TF, typename IT >
+struct IsSplitCompressed< SplitCompressedVector<T,TF,IT> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
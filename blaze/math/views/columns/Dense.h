@@ -2243,7 +2243,7 @@ inline void Columns<MT,true,true,SF,CCAs...>::assign( const DenseMatrix<MT2,fals
    BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
 
-   constexpr size_t block( BLOCK_SIZE );
+   const size_t block( BLOCK_SIZE );
 
    if( rows() < block && columns() < block )
    {
@@ -2485,7 +2485,7 @@ inline void Columns<MT,true,true,SF,CCAs...>::addAssign( const DenseMatrix<MT2,f
    BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
 
-   constexpr size_t block( BLOCK_SIZE );
+   const size_t block( BLOCK_SIZE );
 
    if( rows() < block && columns() < block )
    {
@@ -2727,7 +2727,7 @@ inline void Columns<MT,true,true,SF,CCAs...>::subAssign( const DenseMatrix<MT2,f
    BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
 
-   constexpr size_t block( BLOCK_SIZE );
+   const size_t block( BLOCK_SIZE );
 
    if( rows() < block && columns() < block )
    {
@@ -2955,7 +2955,7 @@ inline void Columns<MT,true,true,SF,CCAs...>::schurAssign( const DenseMatrix<MT2
    BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
 
-   constexpr size_t block( BLOCK_SIZE );
+   const size_t block( BLOCK_SIZE );
 
    if( rows() < block && columns() < block )
    {
@@ -5181,7 +5181,7 @@ inline void Columns<MT,false,true,false,CCAs...>::assign( const DenseMatrix<MT2,
    BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
 
-   constexpr size_t block( BLOCK_SIZE );
+   const size_t block( BLOCK_SIZE );
 
    if( rows() < block && columns() < block )
    {
@@ -5356,7 +5356,7 @@ inline void Columns<MT,false,true,false,CCAs...>::addAssign( const DenseMatrix<M
    BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
 
-   constexpr size_t block( BLOCK_SIZE );
+   const size_t block( BLOCK_SIZE );
 
    if( rows() < block && columns() < block )
    {
@@ -5531,7 +5531,7 @@ inline void Columns<MT,false,true,false,CCAs...>::subAssign( const DenseMatrix<M
    BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
 
-   constexpr size_t block( BLOCK_SIZE );
+   const size_t block( BLOCK_SIZE );
 
    if( rows() < block && columns() < block )
    {
@@ -5699,7 +5699,7 @@ inline void Columns<MT,false,true,false,CCAs...>::schurAssign( const DenseMatrix
    BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
 
-   constexpr size_t block( BLOCK_SIZE );
+   const size_t block( BLOCK_SIZE );
 
    if( rows() < block && columns() < block )
    {
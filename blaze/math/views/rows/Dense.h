@@ -2238,7 +2238,7 @@ inline void Rows<MT,true,true,SF,CRAs...>::assign( const DenseMatrix<MT2,true>&
    BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
 
-   constexpr size_t block( BLOCK_SIZE );
+   const size_t block( BLOCK_SIZE );
 
    if( rows() < block && columns() < block )
    {
@@ -2480,7 +2480,7 @@ inline void Rows<MT,true,true,SF,CRAs...>::addAssign( const DenseMatrix<MT2,true
    BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
 
-   constexpr size_t block( BLOCK_SIZE );
+   const size_t block( BLOCK_SIZE );
 
    if( rows() < block && columns() < block )
    {
@@ -2723,7 +2723,7 @@ inline void Rows<MT,true,true,SF,CRAs...>::subAssign( const DenseMatrix<MT2,true
    BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
 
-   constexpr size_t block( BLOCK_SIZE );
+   const size_t block( BLOCK_SIZE );
 
    if( rows() < block && columns() < block )
    {
@@ -2951,7 +2951,7 @@ inline void Rows<MT,true,true,SF,CRAs...>::schurAssign( const DenseMatrix<MT2,tr
    BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
 
-   constexpr size_t block( BLOCK_SIZE );
+   const size_t block( BLOCK_SIZE );
 
    if( rows() < block && columns() < block )
    {
@@ -5173,7 +5173,7 @@ inline void Rows<MT,false,true,false,CRAs...>::assign( const DenseMatrix<MT2,tru
    BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
 
-   constexpr size_t block( BLOCK_SIZE );
+   const size_t block( BLOCK_SIZE );
 
    if( rows() < block && columns() < block )
    {
@@ -5347,7 +5347,7 @@ inline void Rows<MT,false,true,false,CRAs...>::addAssign( const DenseMatrix<MT2,
    BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
 
-   constexpr size_t block( BLOCK_SIZE );
+   const size_t block( BLOCK_SIZE );
 
    if( rows() < block && columns() < block )
    {
@@ -5522,7 +5522,7 @@ inline void Rows<MT,false,true,false,CRAs...>::subAssign( const DenseMatrix<MT2,
    BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
 
-   constexpr size_t block( BLOCK_SIZE );
+   const size_t block( BLOCK_SIZE );
 
    if( rows() < block && columns() < block )
    {
@@ -5690,7 +5690,7 @@ inline void Rows<MT,false,true,false,CRAs...>::schurAssign( const DenseMatrix<MT
    BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
 
-   constexpr size_t block( BLOCK_SIZE );
+   const size_t block( BLOCK_SIZE );
 
    if( rows() < block && columns() < block )
    {
@@ -62,6 +62,7 @@
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/SIMD.h>
+#include <blaze/math/smp/CacheSize.h>
 #include <blaze/math/StorageOrder.h>
 #include <blaze/math/traits/AddTrait.h>
 #include <blaze/math/traits/SchurTrait.h>
@@ -91,7 +92,6 @@
 #include <blaze/math/views/submatrix/BaseTemplate.h>
 #include <blaze/math/views/submatrix/SubmatrixData.h>
 #include <blaze/system/Blocking.h>
-#include <blaze/system/CacheSize.h>
 #include <blaze/system/Inline.h>
 #include <blaze/system/Optimizations.h>
 #include <blaze/system/Thresholds.h>
@@ -2629,7 +2629,7 @@ inline auto Submatrix<MT,unaligned,false,true,CSAs...>::assign( const DenseMatri
    BLAZE_INTERNAL_ASSERT( ( columns() - ( columns() % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
 
    if( useStreaming && isAligned_ &&
-       rows()*columns() > ( cacheSize / ( sizeof(ElementType) * 3UL ) ) &&
+       rows()*columns() > ( smpCacheSize() / ( sizeof(ElementType) * 3UL ) ) &&
        !(~rhs).isAliased( this ) )
    {
       for( size_t i=0UL; i<rows(); ++i )
@@ -2695,7 +2695,7 @@ inline void Submatrix<MT,unaligned,false,true,CSAs...>::assign( const DenseMatri
    BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
 
-   constexpr size_t block( BLOCK_SIZE );
+   const size_t block( BLOCK_SIZE );
 
    for( size_t ii=0UL; ii<rows(); ii+=block ) {
       const size_t iend( ( rows()<(ii+block) )?( rows() ):( ii+block ) );
@@ -2895,7 +2895,7 @@ inline void Submatrix<MT,unaligned,false,true,CSAs...>::addAssign( const DenseMa
    BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
 
-   constexpr size_t block( BLOCK_SIZE );
+   const size_t block( BLOCK_SIZE );
 
    for( size_t ii=0UL; ii<rows(); ii+=block ) {
       const size_t iend( ( rows()<(ii+block) )?( rows() ):( ii+block ) );
@@ -3095,7 +3095,7 @@ inline void Submatrix<MT,unaligned,false,true,CSAs...>::subAssign( const DenseMa
    BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
 
-   constexpr size_t block( BLOCK_SIZE );
+   const size_t block( BLOCK_SIZE );
 
    for( size_t ii=0UL; ii<rows(); ii+=block ) {
       const size_t iend( ( rows()<(ii+block) )?( rows() ):( ii+block ) );
@@ -3281,7 +3281,7 @@ inline void Submatrix<MT,unaligned,false,true,CSAs...>::schurAssign( const Dense
    BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
 
-   constexpr size_t block( BLOCK_SIZE );
+   const size_t block( BLOCK_SIZE );
 
    for( size_t ii=0UL; ii<rows(); ii+=block ) {
       const size_t iend( ( rows()<(ii+block) )?( rows() ):( ii+block ) );
@@ -5865,7 +5865,7 @@ inline auto Submatrix<MT,unaligned,true,true,CSAs...>::assign( const DenseMatrix
    BLAZE_INTERNAL_ASSERT( ( rows() - ( rows() % (SIMDSIZE) ) ) == ipos, "Invalid end calculation" );
 
    if( useStreaming && isAligned_ &&
-       rows()*columns() > ( cacheSize / ( sizeof(ElementType) * 3UL ) ) &&
+       rows()*columns() > ( smpCacheSize() / ( sizeof(ElementType) * 3UL ) ) &&
        !(~rhs).isAliased( this ) )
    {
       for( size_t j=0UL; j<columns(); ++j )
@@ -5931,7 +5931,7 @@ inline void Submatrix<MT,unaligned,true,true,CSAs...>::assign( const DenseMatrix
    BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
 
-   constexpr size_t block( BLOCK_SIZE );
+   const size_t block( BLOCK_SIZE );
 
    for( size_t jj=0UL; jj<columns(); jj+=block ) {
       const size_t jend( ( columns()<(jj+block) )?( columns() ):( jj+block ) );
@@ -6131,7 +6131,7 @@ inline void Submatrix<MT,unaligned,true,true,CSAs...>::addAssign( const DenseMat
    BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
 
-   constexpr size_t block( BLOCK_SIZE );
+   const size_t block( BLOCK_SIZE );
 
    for( size_t jj=0UL; jj<columns(); jj+=block ) {
       const size_t jend( ( columns()<(jj+block) )?( columns() ):( jj+block ) );
@@ -6331,7 +6331,7 @@ inline void Submatrix<MT,unaligned,true,true,CSAs...>::subAssign( const DenseMat
    BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
 
-   constexpr size_t block( BLOCK_SIZE );
+   const size_t block( BLOCK_SIZE );
 
    for( size_t jj=0UL; jj<columns(); jj+=block ) {
       const size_t jend( ( columns()<(jj+block) )?( columns() ):( jj+block ) );
@@ -6518,7 +6518,7 @@ inline void Submatrix<MT,unaligned,true,true,CSAs...>::schurAssign( const DenseM
    BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
 
-   constexpr size_t block( BLOCK_SIZE );
+   const size_t block( BLOCK_SIZE );
 
    for( size_t jj=0UL; jj<columns(); jj+=block ) {
       const size_t jend( ( columns()<(jj+block) )?( columns() ):( jj+block ) );
@@ -8727,7 +8727,7 @@ inline auto Submatrix<MT,aligned,false,true,CSAs...>::assign( const DenseMatrix<
    BLAZE_INTERNAL_ASSERT( ( columns() - ( columns() % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
 
    if( useStreaming &&
-       rows()*columns() > ( cacheSize / ( sizeof(ElementType) * 3UL ) ) &&
+       rows()*columns() > ( smpCacheSize() / ( sizeof(ElementType) * 3UL ) ) &&
        !(~rhs).isAliased( this ) )
    {
       for( size_t i=0UL; i<rows(); ++i )
@@ -8793,7 +8793,7 @@ inline void Submatrix<MT,aligned,false,true,CSAs...>::assign( const DenseMatrix<
    BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
 
-   constexpr size_t block( BLOCK_SIZE );
+   const size_t block( BLOCK_SIZE );
 
    for( size_t ii=0UL; ii<rows(); ii+=block ) {
       const size_t iend( ( rows()<(ii+block) )?( rows() ):( ii+block ) );
@@ -8993,7 +8993,7 @@ inline void Submatrix<MT,aligned,false,true,CSAs...>::addAssign( const DenseMatr
    BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
 
-   constexpr size_t block( BLOCK_SIZE );
+   const size_t block( BLOCK_SIZE );
 
    for( size_t ii=0UL; ii<rows(); ii+=block ) {
       const size_t iend( ( rows()<(ii+block) )?( rows() ):( ii+block ) );
@@ -9193,7 +9193,7 @@ inline void Submatrix<MT,aligned,false,true,CSAs...>::subAssign( const DenseMatr
    BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
 
-   constexpr size_t block( BLOCK_SIZE );
+   const size_t block( BLOCK_SIZE );
 
    for( size_t ii=0UL; ii<rows(); ii+=block ) {
       const size_t iend( ( rows()<(ii+block) )?( rows() ):( ii+block ) );
@@ -9379,7 +9379,7 @@ inline void Submatrix<MT,aligned,false,true,CSAs...>::schurAssign( const DenseMa
    BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
 
-   constexpr size_t block( BLOCK_SIZE );
+   const size_t block( BLOCK_SIZE );
 
    for( size_t ii=0UL; ii<rows(); ii+=block ) {
       const size_t iend( ( rows()<(ii+block) )?( rows() ):( ii+block ) );
@@ -11542,7 +11542,7 @@ inline auto Submatrix<MT,aligned,true,true,CSAs...>::assign( const DenseMatrix<M
    BLAZE_INTERNAL_ASSERT( ( rows() - ( rows() % (SIMDSIZE) ) ) == ipos, "Invalid end calculation" );
 
    if( useStreaming &&
-       rows()*columns() > ( cacheSize / ( sizeof(ElementType) * 3UL ) ) &&
+       rows()*columns() > ( smpCacheSize() / ( sizeof(ElementType) * 3UL ) ) &&
        !(~rhs).isAliased( this ) )
    {
       for( size_t j=0UL; j<columns(); ++j )
@@ -11608,7 +11608,7 @@ inline void Submatrix<MT,aligned,true,true,CSAs...>::assign( const DenseMatrix<M
    BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
 
-   constexpr size_t block( BLOCK_SIZE );
+   const size_t block( BLOCK_SIZE );
 
    for( size_t jj=0UL; jj<columns(); jj+=block ) {
       const size_t jend( ( columns()<(jj+block) )?( columns() ):( jj+block ) );
@@ -11808,7 +11808,7 @@ inline void Submatrix<MT,aligned,true,true,CSAs...>::addAssign( const DenseMatri
    BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
 
-   constexpr size_t block( BLOCK_SIZE );
+   const size_t block( BLOCK_SIZE );
 
    for( size_t jj=0UL; jj<columns(); jj+=block ) {
       const size_t jend( ( columns()<(jj+block) )?( columns() ):( jj+block ) );
@@ -12008,7 +12008,7 @@ inline void Submatrix<MT,aligned,true,true,CSAs...>::subAssign( const DenseMatri
    BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
 
-   constexpr size_t block( BLOCK_SIZE );
+   const size_t block( BLOCK_SIZE );
 
    for( size_t jj=0UL; jj<columns(); jj+=block ) {
       const size_t jend( ( columns()<(jj+block) )?( columns() ):( jj+block ) );
@@ -12195,7 +12195,7 @@ inline void Submatrix<MT,aligned,true,true,CSAs...>::schurAssign( const DenseMat
    BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
 
-   constexpr size_t block( BLOCK_SIZE );
+   const size_t block( BLOCK_SIZE );
 
    for( size_t jj=0UL; jj<columns(); jj+=block ) {
       const size_t jend( ( columns()<(jj+block) )?( columns() ):( jj+block ) );
@@ -61,6 +61,7 @@
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/SIMD.h>
+#include <blaze/math/smp/CacheSize.h>
 #include <blaze/math/traits/CrossTrait.h>
 #include <blaze/math/traits/SubvectorTrait.h>
 #include <blaze/math/typetraits/HasMutableDataAccess.h>
@@ -76,7 +77,6 @@
 #include <blaze/math/views/Check.h>
 #include <blaze/math/views/subvector/BaseTemplate.h>
 #include <blaze/math/views/subvector/SubvectorData.h>
-#include <blaze/system/CacheSize.h>
 #include <blaze/system/HostDevice.h>
 #include <blaze/system/Inline.h>
 #include <blaze/system/Optimizations.h>
@@ -2161,7 +2161,7 @@ inline auto Subvector<VT,unaligned,TF,true,CSAs...>::assign( const DenseVector<V
    ConstIterator_t<VT2> right( (~rhs).begin() );
 
    if( useStreaming && isAligned_ &&
-       ( size() > ( cacheSize/( sizeof(ElementType) * 3UL ) ) ) &&
+       ( size() > ( smpCacheSize()/( sizeof(ElementType) * 3UL ) ) ) &&
        !(~rhs).isAliased( this ) )
    {
       for( ; i<ipos; i+=SIMDSIZE ) {
@@ -4277,7 +4277,7 @@ inline auto Subvector<VT,aligned,TF,true,CSAs...>::assign( const DenseVector<VT2
    Iterator left( begin() );
    ConstIterator_t<VT2> right( (~rhs).begin() );
 
-   if( useStreaming && size() > ( cacheSize/( sizeof(ElementType) * 3UL ) ) && !(~rhs).isAliased( this ) )
+   if( useStreaming && size() > ( smpCacheSize()/( sizeof(ElementType) * 3UL ) ) && !(~rhs).isAliased( this ) )
    {
       for( ; i<ipos; i+=SIMDSIZE ) {
          left.stream( right.load() ); left += SIMDSIZE; right += SIMDSIZE;
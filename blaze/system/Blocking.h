@@ -40,7 +40,10 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/config/CacheSize.h>
 #include <blaze/system/Debugging.h>
+#include <blaze/util/CacheInfo.h>
+#include <blaze/util/MaybeUnused.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/Types.h>
 
@@ -59,6 +62,14 @@ constexpr size_t DEFAULT_BLOCK_SIZE = 256UL;
 
 constexpr size_t MMM_DEFAULT_OUTER_BLOCK_SIZE = 112UL;
 constexpr size_t MMM_DEFAULT_INNER_BLOCK_SIZE =  96UL;
+
+constexpr size_t MMM_DEFAULT_MC_BLOCK_SIZE =   96UL;
+constexpr size_t MMM_DEFAULT_KC_BLOCK_SIZE =  256UL;
+constexpr size_t MMM_DEFAULT_NC_BLOCK_SIZE = 4096UL;
+
+constexpr size_t FACTORIZATION_DEFAULT_BLOCK_SIZE = 64UL;
+
+constexpr size_t MAPPEDMATRIX_DEFAULT_TILE_SIZE = 512UL;
 /*! \endcond */
 //*************************************************************************************************
 
@@ -69,16 +80,222 @@ constexpr size_t DEBUG_BLOCK_SIZE = 8UL;
 
 constexpr size_t MMM_DEBUG_OUTER_BLOCK_SIZE = 16UL;
 constexpr size_t MMM_DEBUG_INNER_BLOCK_SIZE = 16UL;
+
+constexpr size_t MMM_DEBUG_MC_BLOCK_SIZE = 12UL;
+constexpr size_t MMM_DEBUG_KC_BLOCK_SIZE =  8UL;
+constexpr size_t MMM_DEBUG_NC_BLOCK_SIZE = 32UL;
+
+constexpr size_t FACTORIZATION_DEBUG_BLOCK_SIZE = 4UL;
+
+constexpr size_t MAPPEDMATRIX_DEBUG_TILE_SIZE = 16UL;
 /*! \endcond */
 //*************************************************************************************************
 
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
+#if BLAZE_USE_CACHE_DETECTION
+namespace defaults {
+#endif
 constexpr size_t BLOCK_SIZE = ( BLAZE_DEBUG_MODE ? DEBUG_BLOCK_SIZE : DEFAULT_BLOCK_SIZE );
+#if BLAZE_USE_CACHE_DETECTION
+} // namespace defaults
+#endif
 
 constexpr size_t MMM_OUTER_BLOCK_SIZE = ( BLAZE_DEBUG_MODE ? MMM_DEBUG_OUTER_BLOCK_SIZE : MMM_DEFAULT_OUTER_BLOCK_SIZE );
 constexpr size_t MMM_INNER_BLOCK_SIZE = ( BLAZE_DEBUG_MODE ? MMM_DEBUG_INNER_BLOCK_SIZE : MMM_DEFAULT_INNER_BLOCK_SIZE );
+
+constexpr size_t MMM_MC_BLOCK_SIZE = ( BLAZE_DEBUG_MODE ? MMM_DEBUG_MC_BLOCK_SIZE : MMM_DEFAULT_MC_BLOCK_SIZE );
+constexpr size_t MMM_KC_BLOCK_SIZE = ( BLAZE_DEBUG_MODE ? MMM_DEBUG_KC_BLOCK_SIZE : MMM_DEFAULT_KC_BLOCK_SIZE );
+constexpr size_t MMM_NC_BLOCK_SIZE = ( BLAZE_DEBUG_MODE ? MMM_DEBUG_NC_BLOCK_SIZE : MMM_DEFAULT_NC_BLOCK_SIZE );
+
+constexpr size_t FACTORIZATION_BLOCK_SIZE = ( BLAZE_DEBUG_MODE ? FACTORIZATION_DEBUG_BLOCK_SIZE : FACTORIZATION_DEFAULT_BLOCK_SIZE );
+
+constexpr size_t MAPPEDMATRIX_TILE_SIZE = ( BLAZE_DEBUG_MODE ? MAPPEDMATRIX_DEBUG_TILE_SIZE : MAPPEDMATRIX_DEFAULT_TILE_SIZE );
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+//! Number of rows (columns for column-major targets) of the register tile of the MMM microkernel.
+constexpr size_t MMM_MICROKERNEL_ROWS = 6UL;
+
+//! Number of SIMD vectors per row (column) of the register tile of the MMM microkernel.
+constexpr size_t MMM_MICROKERNEL_SIMD_COLUMNS = 2UL;
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+
+
+
+#if BLAZE_USE_CACHE_DETECTION
+//=================================================================================================
+//
+//  RUNTIME BLOCK SIZE
+//
+//=================================================================================================
+
+namespace blaze {
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Storage of the runtime block size.
+// \ingroup system
+//
+// The block size is constant-initialized with the compile time default and therefore usable
+// during static initialization. The class template only serves to define the value in a header.
+*/
+template< typename T = void >
+struct BlockSizeTable
+{
+   static size_t blockSize;  //!< The block size of blocked dense matrix operations.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T >
+size_t BlockSizeTable<T>::blockSize = defaults::BLOCK_SIZE;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+static constexpr size_t& BLOCK_SIZE = BlockSizeTable<>::blockSize;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Adapts the block size to the size of the detected L1 data cache.
+// \ingroup system
+//
+// \return \a true in case the block size has been adapted, \a false if not.
+//
+// The block size is chosen such that one cache line for each of the \c BLOCK_SIZE rows (or
+// columns) of both the source and the target block fits into half of the L1 data cache, which
+// results in the default block size of 256 for a 32 KiB L1 cache. The block size is adapted
+// only once, independent of the number of calls to this function. In debug mode or in case
+// the detection fails the default block size is retained.
+*/
+inline bool detectBlockSize()
+{
+   static const bool detected( []() -> bool
+   {
+      const size_t l1( getCacheInfo().l1 );
+
+      if( BLAZE_DEBUG_MODE || l1 == 0UL )
+         return false;
+
+      const size_t blockSize( ( l1 / 128UL ) & ~size_t( 15UL ) );
+
+      BlockSizeTable<>::blockSize = ( blockSize < 64UL )?( 64UL )
+                                                        :( blockSize > 1024UL ? 1024UL : blockSize );
+      return true;
+   }() );
+
+   return detected;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+namespace {
+
+const bool blazeBlockSizeDetected = blaze::detectBlockSize();
+
+}
+/*! \endcond */
+//*************************************************************************************************
+
+#endif
+
+
+
+
+//=================================================================================================
+//
+//  MMM BLOCKING
+//
+//=================================================================================================
+
+namespace blaze {
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The block sizes of the packed dense matrix multiplication kernels.
+// \ingroup system
+*/
+struct MMMBlocking
+{
+   size_t mc;  //!< Number of rows (columns) of the packed blocks of the broadcast operand.
+   size_t kc;  //!< Length of the packed blocks along the inner dimension.
+   size_t nc;  //!< Number of columns (rows) of the packed blocks of the vector operand.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the block sizes of the packed dense matrix multiplication kernels.
+// \ingroup system
+//
+// \param bytes The size of a single matrix element in bytes.
+// \param MR The number of rows (columns) of the register tile of the microkernel.
+// \param NR The number of columns (rows) of the register tile of the microkernel.
+// \return The block sizes for the given element size and register tile.
+//
+// In case the cache detection is enabled (see \c BLAZE_USE_CACHE_DETECTION), the block sizes
+// are derived from the detected cache sizes: A \a kc \f$ \times \f$ \a NR micro-panel of the
+// vector operand occupies half of the L1 data cache, an \a mc \f$ \times \f$ \a kc block of
+// the broadcast operand half of the L2 cache, and a \a kc \f$ \times \f$ \a nc block of the
+// vector operand the per-core share of the L3 cache. Otherwise, and in debug mode, the compile
+// time settings MMM_MC_BLOCK_SIZE, MMM_KC_BLOCK_SIZE, and MMM_NC_BLOCK_SIZE are used. In both
+// cases \a mc is a multiple of \a MR and \a nc is a multiple of \a NR.
+*/
+inline MMMBlocking getMMMBlocking( size_t bytes, size_t MR, size_t NR )
+{
+   size_t mc( MMM_MC_BLOCK_SIZE );
+   size_t kc( MMM_KC_BLOCK_SIZE );
+   size_t nc( MMM_NC_BLOCK_SIZE );
+
+#if BLAZE_USE_CACHE_DETECTION
+   const CacheInfo& info( getCacheInfo() );
+
+   if( !BLAZE_DEBUG_MODE && info.l1 > 0UL && info.l2 > 0UL )
+   {
+      const size_t l3( info.l3 > 0UL ? info.l3 : info.l2 );
+
+      kc = ( info.l1 / 2UL ) / ( NR * bytes );
+      kc = ( kc < 32UL )?( 32UL ):( kc > 1024UL ? 1024UL : kc );
+
+      mc = ( info.l2 / 2UL ) / ( kc * bytes );
+      mc = ( mc > 1024UL )?( 1024UL ):( mc );
+
+      nc = l3 / ( kc * bytes );
+      nc = ( nc > 8192UL )?( 8192UL ):( nc );
+   }
+#else
+   MAYBE_UNUSED( bytes );
+#endif
+
+   mc = ( mc < MR )?( MR ):( mc - mc % MR );
+   nc = ( nc < NR )?( NR ):( nc - nc % NR );
+
+   return MMMBlocking{ mc, kc, nc };
+}
 /*! \endcond */
 //*************************************************************************************************
 
@@ -97,11 +314,24 @@ constexpr size_t MMM_INNER_BLOCK_SIZE = ( BLAZE_DEBUG_MODE ? MMM_DEBUG_INNER_BLO
 /*! \cond BLAZE_INTERNAL */
 namespace {
 
+#if BLAZE_USE_CACHE_DETECTION
+BLAZE_STATIC_ASSERT( blaze::defaults::BLOCK_SIZE >= 4UL );
+#else
 BLAZE_STATIC_ASSERT( blaze::BLOCK_SIZE >= 4UL );
+#endif
 
 BLAZE_STATIC_ASSERT( blaze::MMM_OUTER_BLOCK_SIZE >= 16UL && blaze::MMM_OUTER_BLOCK_SIZE % 16UL == 0UL );
 BLAZE_STATIC_ASSERT( blaze::MMM_INNER_BLOCK_SIZE >= 16UL && blaze::MMM_INNER_BLOCK_SIZE % 16UL == 0UL );
 
+BLAZE_STATIC_ASSERT( blaze::MMM_KC_BLOCK_SIZE >= 1UL );
+BLAZE_STATIC_ASSERT( blaze::MMM_MC_BLOCK_SIZE >= blaze::MMM_MICROKERNEL_ROWS );
+BLAZE_STATIC_ASSERT( blaze::MMM_NC_BLOCK_SIZE >= 16UL && blaze::MMM_NC_BLOCK_SIZE % 16UL == 0UL );
+BLAZE_STATIC_ASSERT( blaze::MMM_MICROKERNEL_ROWS >= 1UL && blaze::MMM_MICROKERNEL_SIMD_COLUMNS >= 1UL );
+
+BLAZE_STATIC_ASSERT( blaze::FACTORIZATION_BLOCK_SIZE >= 1UL );
+
+BLAZE_STATIC_ASSERT( blaze::MAPPEDMATRIX_TILE_SIZE >= 1UL );
+
 }
 /*! \endcond */
 //*************************************************************************************************
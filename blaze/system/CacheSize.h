@@ -41,6 +41,7 @@
 //*************************************************************************************************
 
 #include <blaze/config/CacheSize.h>
+#include <blaze/util/CacheInfo.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/Types.h>
 
@@ -55,7 +56,13 @@ namespace blaze {
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
+#if BLAZE_USE_CACHE_DETECTION
+namespace defaults {
+#endif
 constexpr size_t cacheSize = BLAZE_CACHE_SIZE;
+#if BLAZE_USE_CACHE_DETECTION
+} // namespace defaults
+#endif
 /*! \endcond */
 //*************************************************************************************************
 
@@ -64,6 +71,94 @@ constexpr size_t cacheSize = BLAZE_CACHE_SIZE;
 
 
 
+#if BLAZE_USE_CACHE_DETECTION
+//=================================================================================================
+//
+//  RUNTIME CACHE SIZE
+//
+//=================================================================================================
+
+namespace blaze {
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Storage of the runtime cache size.
+// \ingroup system
+//
+// The cache size is constant-initialized with the compile time default and therefore usable
+// during static initialization. The class template only serves to define the value in a header.
+*/
+template< typename T = void >
+struct CacheSizeTable
+{
+   static size_t cacheSize;  //!< The size of the last-level cache in bytes.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T >
+size_t CacheSizeTable<T>::cacheSize = defaults::cacheSize;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+static constexpr size_t& cacheSize = CacheSizeTable<>::cacheSize;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Replaces the default cache size by the size of the detected last-level cache.
+// \ingroup system
+//
+// \return \a true in case the cache size has been detected, \a false if not.
+//
+// The cache size is detected only once, independent of the number of calls to this function.
+// In case the detection fails or results in an implausible value, the default cache size
+// (see \c BLAZE_CACHE_SIZE) is retained.
+*/
+inline bool detectCacheSize()
+{
+   static const bool detected( []() -> bool
+   {
+      const size_t llc( getCacheInfo().llc );
+
+      if( llc <= 100000UL || llc >= 100000000000UL )
+         return false;
+
+      CacheSizeTable<>::cacheSize = llc;
+      return true;
+   }() );
+
+   return detected;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+namespace {
+
+const bool blazeCacheSizeDetected = blaze::detectCacheSize();
+
+}
+/*! \endcond */
+//*************************************************************************************************
+
+#endif
+
+
+
+
 //=================================================================================================
 //
 //  COMPILE TIME CONSTRAINT
@@ -74,7 +169,11 @@ constexpr size_t cacheSize = BLAZE_CACHE_SIZE;
 /*! \cond BLAZE_INTERNAL */
 namespace {
 
+#if BLAZE_USE_CACHE_DETECTION
+BLAZE_STATIC_ASSERT( blaze::defaults::cacheSize > 100000UL && blaze::defaults::cacheSize < 100000000UL );
+#else
 BLAZE_STATIC_ASSERT( blaze::cacheSize > 100000UL && blaze::cacheSize < 100000000UL );
+#endif
 
 }
 /*! \endcond */
@@ -153,4 +153,75 @@
 #endif
 //*************************************************************************************************
 
+
+
+
+//=================================================================================================
+//
+//  WORK-STEALING SCHEDULER CONFIGURATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the work-stealing scheduler of the C++11 and Boost thread-based
+//        parallelization.
+// \ingroup system
+//
+// This compilation switch enables/disables the work-stealing scheduler of the C++11 and Boost
+// thread-based parallelization. In case the \c BLAZE_USE_WORK_STEALING command line argument is
+// specified in addition to either \c BLAZE_USE_CPP_THREADS or \c BLAZE_USE_BOOST_THREADS, the
+// thread backend uses a WorkStealingPool instead of a ThreadPool and splits every parallel
+// (compound) assignment into \c BLAZE_WORK_STEALING_GRANULARITY chunks per thread (see the
+// <tt><blaze/config/SMP.h></tt> configuration file).
+*/
+#if ( BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE ) && defined(BLAZE_USE_WORK_STEALING)
+#define BLAZE_WORK_STEALING_MODE 1
+#else
+#define BLAZE_WORK_STEALING_MODE 0
+#endif
+//*************************************************************************************************
+
+
+
+//=================================================================================================
+//
+//  REPRODUCIBLE REDUCTION CONFIGURATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Compilation switch for bitwise reproducible reductions.
+// \ingroup system
+//
+// This compilation switch enables/disables the blockwise evaluation of dense reductions, inner
+// products and norms with a fixed block size, which makes the results of these operations
+// independent of the number of threads. Additionally, the kernels of dense matrix/dense vector
+// multiplications are selected independently of the size of the matrix. The switch is activated
+// via the \c BLAZE_USE_REPRODUCIBLE_REDUCTIONS setting (see the <tt><blaze/config/SMP.h></tt>
+// configuration file).
+*/
+#if BLAZE_USE_REPRODUCIBLE_REDUCTIONS
+#define BLAZE_REPRODUCIBLE_REDUCTION_MODE 1
+#else
+#define BLAZE_REPRODUCIBLE_REDUCTION_MODE 0
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the compensated summation of partial results.
+// \ingroup system
+//
+// This compilation switch enables/disables the compensated summation of the partial results of
+// blockwise or parallel evaluated sums, inner products and norms. The switch is activated via
+// the \c BLAZE_USE_COMPENSATED_SUMMATION setting (see the <tt><blaze/config/SMP.h></tt>
+// configuration file).
+*/
+#if BLAZE_USE_COMPENSATED_SUMMATION
+#define BLAZE_COMPENSATED_SUMMATION_MODE 1
+#else
+#define BLAZE_COMPENSATED_SUMMATION_MODE 0
+#endif
+//*************************************************************************************************
+
 #endif
@@ -40,7 +40,15 @@
 // Includes
 //*************************************************************************************************
 
+#include <cstdlib>
+#include <exception>
+#include <fstream>
+#include <iomanip>
+#include <ostream>
+#include <sstream>
+#include <string>
 #include <blaze/system/Debugging.h>
+#include <blaze/util/Exception.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/Types.h>
 
@@ -248,6 +256,9 @@ constexpr size_t TSMATTDMATMULT_DEBUG_THRESHOLD = 256UL;
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
+#if BLAZE_USE_RUNTIME_THRESHOLDS
+namespace defaults {
+#endif
 constexpr size_t DMATDVECMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? DMATDVECMULT_DEBUG_THRESHOLD   : BLAZE_DMATDVECMULT_THRESHOLD   );
 constexpr size_t TDMATDVECMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? TDMATDVECMULT_DEBUG_THRESHOLD  : BLAZE_TDMATDVECMULT_THRESHOLD  );
 constexpr size_t TDVECDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? TDVECDMATMULT_DEBUG_THRESHOLD  : BLAZE_TDVECDMATMULT_THRESHOLD  );
@@ -260,6 +271,9 @@ constexpr size_t DMATSMATMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? DMATSMATMULT_DE
 constexpr size_t TDMATSMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? TDMATSMATMULT_DEBUG_THRESHOLD  : BLAZE_TDMATSMATMULT_THRESHOLD  );
 constexpr size_t TSMATDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? TSMATDMATMULT_DEBUG_THRESHOLD  : BLAZE_TSMATDMATMULT_THRESHOLD  );
 constexpr size_t TSMATTDMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? TSMATTDMATMULT_DEBUG_THRESHOLD : BLAZE_TSMATTDMATMULT_THRESHOLD );
+#if BLAZE_USE_RUNTIME_THRESHOLDS
+} // namespace defaults
+#endif
 /*! \endcond */
 //*************************************************************************************************
 
@@ -939,6 +953,20 @@ constexpr size_t SMP_TSMATTSMATMULT_DEBUG_THRESHOLD = 256UL;
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief SMP sparse matrix assignment threshold.
+// \ingroup config
+//
+// This debug value is used instead of the BLAZE_SMP_SMATASSIGN_THRESHOLD while the Blaze
+// debug mode is active. It specifies when an assignment with a simple sparse matrix can be
+// executed in parallel. In case the number of non-zero elements of the sparse matrix is larger
+// or equal to this threshold, the operation is executed in parallel. If the number of non-zero
+// elements is below this threshold the operation is executed single-threaded.
+*/
+constexpr size_t SMP_SMATASSIGN_DEBUG_THRESHOLD = 16UL;
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief SMP dense matrix reduction threshold.
 // \ingroup config
@@ -967,8 +995,67 @@ constexpr size_t SMP_SMATREDUCE_DEBUG_THRESHOLD = 16UL;
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief SMP dense vector/dense vector inner product threshold.
+// \ingroup config
+//
+// This debug value is used instead of the BLAZE_SMP_DVECDVECINNER_THRESHOLD while the Blaze
+// debug mode is active. It specifies when the inner product of two dense vectors can be executed in
+// parallel. In case the number of elements of the vectors is larger or equal to this threshold, the
+// operation is executed in parallel. If the number of elements is below this threshold the
+// operation is executed single-threaded.
+*/
+constexpr size_t SMP_DVECDVECINNER_DEBUG_THRESHOLD = 32UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP dense vector reduction threshold.
+// \ingroup config
+//
+// This debug value is used instead of the BLAZE_SMP_DVECREDUCE_THRESHOLD while the Blaze
+// debug mode is active. It specifies when a total reduction or a norm of a dense vector can be executed in
+// parallel. In case the number of elements of the vector is larger or equal to this threshold, the
+// operation is executed in parallel. If the number of elements is below this threshold the
+// operation is executed single-threaded.
+*/
+constexpr size_t SMP_DVECREDUCE_DEBUG_THRESHOLD = 32UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP dense matrix total reduction threshold.
+// \ingroup config
+//
+// This debug value is used instead of the BLAZE_SMP_DMATTOTALREDUCE_THRESHOLD while the Blaze
+// debug mode is active. It specifies when a total reduction or a norm of a dense matrix can be executed in
+// parallel. In case the number of elements of the matrix is larger or equal to this threshold, the
+// operation is executed in parallel. If the number of elements is below this threshold the
+// operation is executed single-threaded.
+*/
+constexpr size_t SMP_DMATTOTALREDUCE_DEBUG_THRESHOLD = 256UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP batched matrix operation threshold.
+// \ingroup config
+//
+// This debug value is used instead of the BLAZE_SMP_BATCHEDMATRIX_THRESHOLD while the Blaze
+// debug mode is active. It specifies when a batched operation on a BatchedMatrix can be executed
+// in parallel. In case the number of matrices of the batch is larger or equal to this threshold,
+// the operation is executed in parallel. If the number of matrices is below this threshold the
+// operation is executed single-threaded.
+*/
+constexpr size_t SMP_BATCHEDMATRIX_DEBUG_THRESHOLD = 16UL;
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
+#if BLAZE_USE_RUNTIME_THRESHOLDS
+namespace defaults {
+#endif
 constexpr size_t SMP_DVECASSIGN_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_DVECASSIGN_DEBUG_THRESHOLD     : BLAZE_SMP_DVECASSIGN_THRESHOLD     );
 constexpr size_t SMP_DVECSCALARMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_DVECSCALARMULT_DEBUG_THRESHOLD : BLAZE_SMP_DVECSCALARMULT_THRESHOLD );
 constexpr size_t SMP_DVECDVECADD_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_DVECDVECADD_DEBUG_THRESHOLD    : BLAZE_SMP_DVECDVECADD_THRESHOLD    );
@@ -1016,8 +1103,16 @@ constexpr size_t SMP_SMATSMATMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_SMATSMA
 constexpr size_t SMP_SMATTSMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_SMATTSMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_SMATTSMATMULT_THRESHOLD  );
 constexpr size_t SMP_TSMATSMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TSMATSMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TSMATSMATMULT_THRESHOLD  );
 constexpr size_t SMP_TSMATTSMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TSMATTSMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TSMATTSMATMULT_THRESHOLD );
+constexpr size_t SMP_SMATASSIGN_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_SMATASSIGN_DEBUG_THRESHOLD     : BLAZE_SMP_SMATASSIGN_THRESHOLD     );
 constexpr size_t SMP_DMATREDUCE_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_DMATREDUCE_DEBUG_THRESHOLD     : BLAZE_SMP_DMATREDUCE_THRESHOLD     );
 constexpr size_t SMP_SMATREDUCE_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_SMATREDUCE_DEBUG_THRESHOLD     : BLAZE_SMP_SMATREDUCE_THRESHOLD     );
+constexpr size_t SMP_DVECDVECINNER_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DVECDVECINNER_DEBUG_THRESHOLD   : BLAZE_SMP_DVECDVECINNER_THRESHOLD   );
+constexpr size_t SMP_DVECREDUCE_THRESHOLD      = ( BLAZE_DEBUG_MODE ? SMP_DVECREDUCE_DEBUG_THRESHOLD      : BLAZE_SMP_DVECREDUCE_THRESHOLD      );
+constexpr size_t SMP_DMATTOTALREDUCE_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_DMATTOTALREDUCE_DEBUG_THRESHOLD : BLAZE_SMP_DMATTOTALREDUCE_THRESHOLD );
+constexpr size_t SMP_BATCHEDMATRIX_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_BATCHEDMATRIX_DEBUG_THRESHOLD   : BLAZE_SMP_BATCHEDMATRIX_THRESHOLD   );
+#if BLAZE_USE_RUNTIME_THRESHOLDS
+} // namespace defaults
+#endif
 /*! \endcond */
 //*************************************************************************************************
 
@@ -1026,6 +1121,457 @@ constexpr size_t SMP_SMATREDUCE_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_SMATRED
 
 
 
+//=================================================================================================
+//
+//  RUNTIME THRESHOLDS
+//
+//=================================================================================================
+
+#if BLAZE_USE_RUNTIME_THRESHOLDS
+
+namespace blaze {
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief List of all runtime-tunable thresholds.
+// \ingroup system
+//
+// The table of runtime thresholds, the according IDs and the threshold references are all
+// generated from this list by applying the given macro \a X to the name of every threshold.
+// New thresholds therefore only have to be added to this list (and to the compile time
+// defaults).
+*/
+#define BLAZE_RUNTIME_THRESHOLD_LIST( X ) \
+   X( DMATDVECMULT_THRESHOLD )        \
+   X( TDMATDVECMULT_THRESHOLD )       \
+   X( TDVECDMATMULT_THRESHOLD )       \
+   X( TDVECTDMATMULT_THRESHOLD )      \
+   X( DMATDMATMULT_THRESHOLD )        \
+   X( DMATTDMATMULT_THRESHOLD )       \
+   X( TDMATDMATMULT_THRESHOLD )       \
+   X( TDMATTDMATMULT_THRESHOLD )      \
+   X( DMATSMATMULT_THRESHOLD )        \
+   X( TDMATSMATMULT_THRESHOLD )       \
+   X( TSMATDMATMULT_THRESHOLD )       \
+   X( TSMATTDMATMULT_THRESHOLD )      \
+   X( SMP_DVECASSIGN_THRESHOLD )      \
+   X( SMP_DVECSCALARMULT_THRESHOLD )  \
+   X( SMP_DVECDVECADD_THRESHOLD )     \
+   X( SMP_DVECDVECSUB_THRESHOLD )     \
+   X( SMP_DVECDVECMULT_THRESHOLD )    \
+   X( SMP_DVECDVECDIV_THRESHOLD )     \
+   X( SMP_DVECDVECOUTER_THRESHOLD )   \
+   X( SMP_DMATDVECMULT_THRESHOLD )    \
+   X( SMP_TDMATDVECMULT_THRESHOLD )   \
+   X( SMP_TDVECDMATMULT_THRESHOLD )   \
+   X( SMP_TDVECTDMATMULT_THRESHOLD )  \
+   X( SMP_DMATSVECMULT_THRESHOLD )    \
+   X( SMP_TDMATSVECMULT_THRESHOLD )   \
+   X( SMP_TSVECDMATMULT_THRESHOLD )   \
+   X( SMP_TSVECTDMATMULT_THRESHOLD )  \
+   X( SMP_SMATDVECMULT_THRESHOLD )    \
+   X( SMP_TSMATDVECMULT_THRESHOLD )   \
+   X( SMP_TDVECSMATMULT_THRESHOLD )   \
+   X( SMP_TDVECTSMATMULT_THRESHOLD )  \
+   X( SMP_SMATSVECMULT_THRESHOLD )    \
+   X( SMP_TSMATSVECMULT_THRESHOLD )   \
+   X( SMP_TSVECSMATMULT_THRESHOLD )   \
+   X( SMP_TSVECTSMATMULT_THRESHOLD )  \
+   X( SMP_DMATASSIGN_THRESHOLD )      \
+   X( SMP_DMATSCALARMULT_THRESHOLD )  \
+   X( SMP_DMATDMATADD_THRESHOLD )     \
+   X( SMP_DMATTDMATADD_THRESHOLD )    \
+   X( SMP_DMATDMATSUB_THRESHOLD )     \
+   X( SMP_DMATTDMATSUB_THRESHOLD )    \
+   X( SMP_DMATDMATSCHUR_THRESHOLD )   \
+   X( SMP_DMATTDMATSCHUR_THRESHOLD )  \
+   X( SMP_DMATDMATMULT_THRESHOLD )    \
+   X( SMP_DMATTDMATMULT_THRESHOLD )   \
+   X( SMP_TDMATDMATMULT_THRESHOLD )   \
+   X( SMP_TDMATTDMATMULT_THRESHOLD )  \
+   X( SMP_DMATSMATMULT_THRESHOLD )    \
+   X( SMP_DMATTSMATMULT_THRESHOLD )   \
+   X( SMP_TDMATSMATMULT_THRESHOLD )   \
+   X( SMP_TDMATTSMATMULT_THRESHOLD )  \
+   X( SMP_SMATDMATMULT_THRESHOLD )    \
+   X( SMP_SMATTDMATMULT_THRESHOLD )   \
+   X( SMP_TSMATDMATMULT_THRESHOLD )   \
+   X( SMP_TSMATTDMATMULT_THRESHOLD )  \
+   X( SMP_SMATSMATMULT_THRESHOLD )    \
+   X( SMP_SMATTSMATMULT_THRESHOLD )   \
+   X( SMP_TSMATSMATMULT_THRESHOLD )   \
+   X( SMP_TSMATTSMATMULT_THRESHOLD )  \
+   X( SMP_SMATASSIGN_THRESHOLD )      \
+   X( SMP_DMATREDUCE_THRESHOLD )      \
+   X( SMP_SMATREDUCE_THRESHOLD )      \
+   X( SMP_DVECDVECINNER_THRESHOLD )   \
+   X( SMP_DVECREDUCE_THRESHOLD )      \
+   X( SMP_DMATTOTALREDUCE_THRESHOLD ) \
+   X( SMP_BATCHEDMATRIX_THRESHOLD )
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief IDs of all runtime-tunable thresholds, i.e. their indices in the threshold table.
+// \ingroup system
+*/
+enum class RuntimeThresholdID : size_t
+{
+#define BLAZE_RUNTIME_THRESHOLD_ID( NAME ) NAME,
+   BLAZE_RUNTIME_THRESHOLD_LIST( BLAZE_RUNTIME_THRESHOLD_ID )
+#undef BLAZE_RUNTIME_THRESHOLD_ID
+   count  //!< The total number of thresholds.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Entry of the runtime threshold table.
+// \ingroup system
+*/
+struct RuntimeThreshold
+{
+   const char* const name;          //!< The name of the threshold.
+   const size_t      defaultValue;  //!< The compile time default of the threshold.
+   size_t            value;         //!< The current value of the threshold.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Table of all runtime-tunable thresholds.
+// \ingroup system
+//
+// The table is constant-initialized with the compile time defaults and therefore usable during
+// static initialization. The class template only serves to define the table in a header.
+*/
+template< typename T = void >
+struct RuntimeThresholdTable
+{
+   static constexpr size_t size = static_cast<size_t>( RuntimeThresholdID::count );  //!< The total number of thresholds.
+
+   static RuntimeThreshold entries[size];  //!< The threshold entries.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T >
+constexpr size_t RuntimeThresholdTable<T>::size;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T >
+RuntimeThreshold RuntimeThresholdTable<T>::entries[RuntimeThresholdTable<T>::size] = {
+#define BLAZE_RUNTIME_THRESHOLD_ENTRY( NAME ) { #NAME, defaults::NAME, defaults::NAME },
+   BLAZE_RUNTIME_THRESHOLD_LIST( BLAZE_RUNTIME_THRESHOLD_ENTRY )
+#undef BLAZE_RUNTIME_THRESHOLD_ENTRY
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+#define BLAZE_RUNTIME_THRESHOLD_REFERENCE( NAME ) \
+   static constexpr size_t& NAME = RuntimeThresholdTable<>::entries[static_cast<size_t>( RuntimeThresholdID::NAME )].value;
+BLAZE_RUNTIME_THRESHOLD_LIST( BLAZE_RUNTIME_THRESHOLD_REFERENCE )
+#undef BLAZE_RUNTIME_THRESHOLD_REFERENCE
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  RUNTIME THRESHOLD FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Runtime threshold functions */
+//@{
+inline size_t getThreshold   ( const std::string& name );
+inline void   setThreshold   ( const std::string& name, size_t value );
+inline void   resetThresholds();
+inline void   loadThresholds ( const std::string& filename );
+inline void   writeThresholds( std::ostream& os );
+inline void   writeThresholds( const std::string& filename );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the entry of the threshold with the given name.
+// \ingroup system
+//
+// \param name The name of the threshold (e.g. "SMP_DVECASSIGN_THRESHOLD").
+// \return Reference to the threshold entry.
+// \exception std::invalid_argument Unknown threshold.
+*/
+inline RuntimeThreshold& getThresholdEntry( const std::string& name )
+{
+   for( RuntimeThreshold& entry : RuntimeThresholdTable<>::entries ) {
+      if( name == entry.name )
+         return entry;
+   }
+
+   BLAZE_THROW_INVALID_ARGUMENT( "Unknown threshold" );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current value of the threshold with the given name.
+// \ingroup system
+//
+// \param name The name of the threshold (e.g. "SMP_DVECASSIGN_THRESHOLD").
+// \return The current value of the threshold.
+// \exception std::invalid_argument Unknown threshold.
+*/
+inline size_t getThreshold( const std::string& name )
+{
+   return getThresholdEntry( name ).value;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Sets the threshold with the given name to the given value.
+// \ingroup system
+//
+// \param name The name of the threshold (e.g. "SMP_DVECASSIGN_THRESHOLD").
+// \param value The new value of the threshold.
+// \return void
+// \exception std::invalid_argument Unknown threshold.
+// \exception std::invalid_argument Invalid threshold value.
+//
+// This function changes the value of the given threshold for all subsequent operations. Whereas
+// SMP thresholds may be set to 0 to unconditionally enable the parallel execution, BLAS and
+// kernel thresholds must be larger than 0. Note that the thresholds must not be changed while
+// any other thread is executing Blaze operations.
+*/
+inline void setThreshold( const std::string& name, size_t value )
+{
+   RuntimeThreshold& entry( getThresholdEntry( name ) );
+
+   if( value == 0UL && name.compare( 0UL, 4UL, "SMP_" ) != 0 ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid threshold value" );
+   }
+
+   entry.value = value;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resets all thresholds to their compile time defaults.
+// \ingroup system
+//
+// \return void
+*/
+inline void resetThresholds()
+{
+   for( RuntimeThreshold& entry : RuntimeThresholdTable<>::entries ) {
+      entry.value = entry.defaultValue;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Loads a tuning table from the given file.
+// \ingroup system
+//
+// \param filename The name of the tuning table file.
+// \return void
+// \exception std::runtime_error File could not be opened.
+// \exception std::invalid_argument Invalid tuning table entry.
+//
+// This function reads the tuning table from the given file and updates all listed thresholds.
+// Every line of the file contains the name of a threshold followed by its value. Empty lines
+// are ignored and the character '#' starts a comment that extends to the end of the line:
+
+   \code
+   # Tuning table
+   DMATDMATMULT_THRESHOLD     10000
+   SMP_DVECASSIGN_THRESHOLD   38000
+   \endcode
+
+// Thresholds that are not listed retain their current value. In case the file contains an
+// invalid entry (i.e. an unknown threshold, a missing, negative, or out-of-range value, or
+// additional characters), a \a std::invalid_argument exception is thrown and all thresholds
+// retain their current value.
+*/
+inline void loadThresholds( const std::string& filename )
+{
+   std::ifstream file( filename );
+
+   if( !file ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Tuning table could not be opened" );
+   }
+
+   size_t values[RuntimeThresholdTable<>::size];
+
+   for( size_t i=0UL; i<RuntimeThresholdTable<>::size; ++i ) {
+      values[i] = RuntimeThresholdTable<>::entries[i].value;
+   }
+
+   std::string line;
+
+   try
+   {
+      while( std::getline( file, line ) )
+      {
+         const std::string::size_type comment( line.find( '#' ) );
+         if( comment != std::string::npos ) {
+            line.erase( comment );
+         }
+
+         std::istringstream iss( line );
+         std::string name, token, rest;
+         size_t value( 0UL );
+
+         if( !( iss >> name ) )
+            continue;
+
+         if( !( iss >> token ) || ( iss >> rest ) ||
+             token.find_first_not_of( "0123456789" ) != std::string::npos ||
+             !( std::istringstream( token ) >> value ) ) {
+            BLAZE_THROW_INVALID_ARGUMENT( "Invalid tuning table entry" );
+         }
+
+         setThreshold( name, value );
+      }
+   }
+   catch( ... )
+   {
+      for( size_t i=0UL; i<RuntimeThresholdTable<>::size; ++i ) {
+         RuntimeThresholdTable<>::entries[i].value = values[i];
+      }
+      throw;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes the current tuning table to the given output stream.
+// \ingroup system
+//
+// \param os Reference to the output stream.
+// \return void
+//
+// This function writes all thresholds with their current value in the format expected by
+// loadThresholds().
+*/
+inline void writeThresholds( std::ostream& os )
+{
+   for( const RuntimeThreshold& entry : RuntimeThresholdTable<>::entries ) {
+      os << std::left << std::setw( 32 ) << entry.name << std::right << " " << entry.value << "\n";
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes the current tuning table to the given file.
+// \ingroup system
+//
+// \param filename The name of the tuning table file.
+// \return void
+// \exception std::runtime_error File could not be opened.
+*/
+inline void writeThresholds( const std::string& filename )
+{
+   std::ofstream file( filename );
+
+   if( !file ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Tuning table could not be opened" );
+   }
+
+   writeThresholds( file );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Loads the tuning table specified by the \c BLAZE_THRESHOLDS environment variable.
+// \ingroup system
+//
+// \return \a true in case a tuning table has been loaded, \a false if not.
+//
+// The tuning table is loaded only once, independent of the number of calls to this function.
+// Since the function is called during static initialization, it does not throw: In case the
+// tuning table cannot be opened or contains an invalid entry, the table is ignored (analogous
+// to invalid values of the \c BLAZE_NUMA_POLICY and \c BLAZE_THREAD_AFFINITY environment
+// variables), all thresholds retain their compile time defaults and the function returns
+// \a false.
+*/
+#if (defined _MSC_VER)
+#  pragma warning(push)
+#  pragma warning(disable:4996)
+#endif
+inline bool loadThresholdsFromEnvironment()
+{
+   static const bool loaded( []() -> bool
+   {
+      const char* env = std::getenv( "BLAZE_THRESHOLDS" );
+
+      if( env == nullptr || *env == '\0' )
+         return false;
+
+      try {
+         loadThresholds( env );
+      }
+      catch( const std::exception& ) {
+         resetThresholds();
+         return false;
+      }
+
+      return true;
+   }() );
+
+   return loaded;
+}
+#if (defined _MSC_VER)
+#  pragma warning(pop)
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+namespace {
+
+const bool blazeThresholdsLoaded = blaze::loadThresholdsFromEnvironment();
+
+}
+/*! \endcond */
+//*************************************************************************************************
+
+#endif
+
+
+
 //=================================================================================================
 //
 //  COMPILE TIME CONSTRAINT
@@ -1034,6 +1580,7 @@ constexpr size_t SMP_SMATREDUCE_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_SMATRED
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
+#if !BLAZE_USE_RUNTIME_THRESHOLDS
 namespace {
 
 BLAZE_STATIC_ASSERT( blaze::DMATDVECMULT_THRESHOLD   > 0UL );
@@ -1092,10 +1639,16 @@ BLAZE_STATIC_ASSERT( blaze::SMP_SMATSMATMULT_THRESHOLD   >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_SMATTSMATMULT_THRESHOLD  >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_TSMATSMATMULT_THRESHOLD  >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_TSMATTSMATMULT_THRESHOLD >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_SMATASSIGN_THRESHOLD     >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_DMATREDUCE_THRESHOLD     >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_SMATREDUCE_THRESHOLD     >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DVECDVECINNER_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DVECREDUCE_THRESHOLD      >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATTOTALREDUCE_THRESHOLD >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_BATCHEDMATRIX_THRESHOLD   >= 0UL );
 
 }
+#endif
 /*! \endcond */
 //*************************************************************************************************
 
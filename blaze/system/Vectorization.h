@@ -41,6 +41,7 @@
 //*************************************************************************************************
 
 #include <blaze/config/Vectorization.h>
+#include <blaze/system/Compiler.h>
 #include <blaze/util/StaticAssert.h>
 
 
@@ -353,6 +354,59 @@
 
 
 
+//=================================================================================================
+//
+//  BUILT-IN SIMD MATH MODE CONFIGURATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the built-in SIMD math mode.
+// \ingroup system
+//
+// This compilation switch indicates whether the built-in SIMD implementations of several
+// transcendental functions (\c exp(), \c log(), \c sin(), \c cos(), and \c tanh()) are used.
+// These implementations are portable replacements for the according SVML intrinsics and are
+// enabled in case they are requested via the BLAZE_USE_BUILTIN_SIMD_MATH switch, the SVML is
+// not available, and at least SSE2 is available (excluding MIC).
+*/
+#if BLAZE_USE_BUILTIN_SIMD_MATH && !BLAZE_SVML_MODE && !BLAZE_MIC_MODE && BLAZE_SSE2_MODE
+#  define BLAZE_BUILTIN_SIMD_MATH_MODE 1
+#else
+#  define BLAZE_BUILTIN_SIMD_MATH_MODE 0
+#endif
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CPU DISPATCH MODE CONFIGURATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!rief Compilation switch for the CPU dispatch mode.
+// \ingroup system
+//
+// This compilation switch indicates whether the performance critical kernels are additionally
+// compiled for AVX, AVX2/FMA, and AVX-512 and selected at runtime based on the capabilities of
+// the executing CPU. The CPU dispatch mode is enabled in case it is requested via the
+// BLAZE_USE_CPU_DISPATCH switch, the GNU or Clang compiler is used on an x86 platform with
+// at least SSE2, and AVX-512 is not already selected at compile time.
+*/
+#if BLAZE_USE_CPU_DISPATCH && BLAZE_SSE2_MODE && !BLAZE_AVX512F_MODE && !BLAZE_MIC_MODE && \
+    ( BLAZE_GNU_COMPILER || BLAZE_CLANG_COMPILER ) && ( defined(__x86_64__) || defined(__i386__) )
+#  define BLAZE_CPU_DISPATCH_MODE 1
+#else
+#  define BLAZE_CPU_DISPATCH_MODE 0
+#endif
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  COMPILE TIME CONSTRAINTS
@@ -0,0 +1,328 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/CacheInfo.h
+//  \brief Header file for the runtime detection of the cache sizes
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_UTIL_CACHEINFO_H_
+#define _BLAZE_UTIL_CACHEINFO_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#if defined(_MSC_VER) && ( defined(_M_X64) || defined(_M_IX86) )
+#  include <intrin.h>
+#elif defined(__GNUC__) && ( defined(__x86_64__) || defined(__i386__) )
+#  include <cpuid.h>
+#endif
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/Topology.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CACHE INFORMATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The cache sizes of the executing CPU.
+// \ingroup util
+//
+// The CacheInfo class describes the data and unified caches available to a single core (see
+// getCacheInfo()). Caches that are shared between several cores (as for instance the L3 cache
+// of most multi-core CPUs) are accounted for by their per-core share. All sizes are given in
+// bytes. A size of 0 indicates that the according cache could not be detected.
+*/
+struct CacheInfo
+{
+   size_t l1;   //!< Size of the L1 data cache per core.
+   size_t l2;   //!< Size of the L2 cache per core.
+   size_t l3;   //!< Share of the L3 cache per core.
+   size_t llc;  //!< Total size of the last-level cache.
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Description of a single cache level.
+// \ingroup util
+*/
+struct CacheLevel
+{
+   size_t level;    //!< The level of the cache.
+   size_t size;     //!< The size of the cache in bytes.
+   size_t sharing;  //!< The number of hardware threads sharing the cache.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Combines the given cache levels to the per-core cache information.
+// \ingroup util
+//
+// \param levels The detected data and unified cache levels.
+// \return The according per-core cache information.
+//
+// The number of cores sharing a cache is estimated by the number of hardware threads sharing
+// the cache divided by the number of hardware threads sharing the L1 cache (i.e. the number of
+// hardware threads per core).
+*/
+inline CacheInfo combineCacheLevels( const std::vector<CacheLevel>& levels )
+{
+   CacheInfo info{ 0UL, 0UL, 0UL, 0UL };
+
+   size_t smt( 1UL );
+   size_t llcLevel( 0UL );
+
+   for( const CacheLevel& cache : levels ) {
+      if( cache.level == 1UL && cache.sharing > 0UL )
+         smt = cache.sharing;
+   }
+
+   for( const CacheLevel& cache : levels )
+   {
+      const size_t cores( cache.sharing > smt ? cache.sharing / smt : 1UL );
+      const size_t share( cache.size / cores );
+
+      if     ( cache.level == 1UL ) info.l1 = share;
+      else if( cache.level == 2UL ) info.l2 = share;
+      else if( cache.level == 3UL ) info.l3 = share;
+
+      if( cache.level >= llcLevel ) {
+         llcLevel = cache.level;
+         info.llc = cache.size;
+      }
+   }
+
+   return info;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Detects the cache levels via the Linux sysfs.
+// \ingroup util
+//
+// \return The detected data and unified cache levels (empty in case of an error).
+*/
+inline std::vector<CacheLevel> detectCacheLevelsSysfs()
+{
+   std::vector<CacheLevel> levels;
+
+#if defined(__linux__)
+   for( size_t index=0UL; ; ++index )
+   {
+      const std::string cache( "/sys/devices/system/cpu/cpu0/cache/index" + std::to_string( index ) );
+
+      size_t level( 0UL );
+      std::string type, size, shared;
+
+      if( !readTopologyValue( cache + "/level", level ) )
+         break;
+
+      if( !readTopologyValue( cache + "/type", type ) || type == "Instruction" ||
+          !readTopologyValue( cache + "/size", size ) )
+         continue;
+
+      char* end( nullptr );
+      size_t bytes( std::strtoul( size.c_str(), &end, 10 ) );
+
+      if     ( *end == 'K' ) bytes *= 1024UL;
+      else if( *end == 'M' ) bytes *= 1024UL*1024UL;
+      else if( *end == 'G' ) bytes *= 1024UL*1024UL*1024UL;
+
+      // Counting the hardware threads of the shared CPU list (e.g. "0-3,8-11")
+      size_t sharing( 0UL );
+
+      if( readTopologyValue( cache + "/shared_cpu_list", shared ) )
+      {
+         const char* pos( shared.c_str() );
+
+         while( *pos != '\0' ) {
+            char* next( nullptr );
+            const size_t first( std::strtoul( pos, &next, 10 ) );
+            size_t last( first );
+            if( *next == '-' )
+               last = std::strtoul( next+1, &next, 10 );
+            sharing += last - first + 1UL;
+            pos = ( *next == ',' )?( next+1 ):( next );
+            if( next == pos && *pos != '\0' ) break;
+         }
+      }
+
+      if( bytes > 0UL )
+         levels.push_back( CacheLevel{ level, bytes, sharing } );
+   }
+#endif
+
+   return levels;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Executes the \c cpuid instruction for the given leaf and subleaf.
+// \ingroup util
+//
+// \param leaf The requested leaf.
+// \param subleaf The requested subleaf.
+// \param regs The resulting values of the EAX, EBX, ECX, and EDX registers.
+// \return \a true in case the leaf is supported, \a false if not.
+*/
+inline bool cpuid( unsigned int leaf, unsigned int subleaf, unsigned int (&regs)[4] )
+{
+#if defined(_MSC_VER) && ( defined(_M_X64) || defined(_M_IX86) )
+   int info[4];
+   __cpuid( info, static_cast<int>( leaf & 0x80000000U ) );
+   if( static_cast<unsigned int>( info[0] ) < leaf )
+      return false;
+   __cpuidex( info, static_cast<int>( leaf ), static_cast<int>( subleaf ) );
+   for( size_t i=0UL; i<4UL; ++i ) {
+      regs[i] = static_cast<unsigned int>( info[i] );
+   }
+   return true;
+#elif defined(__GNUC__) && ( defined(__x86_64__) || defined(__i386__) )
+   if( __get_cpuid_max( leaf & 0x80000000U, nullptr ) < leaf )
+      return false;
+   __cpuid_count( leaf, subleaf, regs[0], regs[1], regs[2], regs[3] );
+   return true;
+#else
+   MAYBE_UNUSED( leaf, subleaf, regs );
+   return false;
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Detects the cache levels via the \c cpuid instruction.
+// \ingroup util
+//
+// \return The detected data and unified cache levels (empty in case of an error).
+//
+// This function evaluates the deterministic cache parameters of Intel (leaf 4) and AMD (leaf
+// 0x8000001D) CPUs. On all non-x86 platforms the function returns an empty vector.
+*/
+inline std::vector<CacheLevel> detectCacheLevelsCpuid()
+{
+   std::vector<CacheLevel> levels;
+
+   for( unsigned int leaf : { 0x00000004U, 0x8000001DU } )
+   {
+      unsigned int regs[4];
+
+      for( unsigned int subleaf=0U; cpuid( leaf, subleaf, regs ); ++subleaf )
+      {
+         const unsigned int type( regs[0] & 0x1FU );
+
+         if( type == 0U || subleaf >= 16U )
+            break;
+         if( type == 2U )  // Instruction cache
+            continue;
+
+         const size_t ways      ( ( regs[1] >> 22 ) + 1UL );
+         const size_t partitions( ( ( regs[1] >> 12 ) & 0x3FFU ) + 1UL );
+         const size_t lineSize  ( ( regs[1] & 0xFFFU ) + 1UL );
+         const size_t sets      ( static_cast<size_t>( regs[2] ) + 1UL );
+
+         levels.push_back( CacheLevel{ ( regs[0] >> 5 ) & 0x7U, ways*partitions*lineSize*sets,
+                                       ( ( regs[0] >> 14 ) & 0xFFFU ) + 1UL } );
+      }
+
+      if( !levels.empty() )
+         break;
+   }
+
+   return levels;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Detects the cache sizes of the executing CPU.
+// \ingroup util
+//
+// \return The detected cache sizes.
+//
+// On Linux the cache sizes are determined from \c /sys/devices/system/cpu. In case this
+// information is not available, the cache sizes are queried via the \c cpuid instruction on
+// x86 platforms. The sizes of all caches that cannot be detected are set to 0.
+*/
+inline CacheInfo detectCacheInfo()
+{
+   std::vector<CacheLevel> levels( detectCacheLevelsSysfs() );
+
+   if( levels.empty() )
+      levels = detectCacheLevelsCpuid();
+
+   return combineCacheLevels( levels );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the cache sizes of the executing CPU.
+// \ingroup util
+//
+// \return The detected cache sizes.
+//
+// The cache sizes are detected once, at the first call of the function (see detectCacheInfo()).
+*/
+inline const CacheInfo& getCacheInfo()
+{
+   static const CacheInfo info( detectCacheInfo() );
+   return info;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
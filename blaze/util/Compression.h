@@ -0,0 +1,481 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/Compression.h
+//  \brief Header file for the byte filters and the LZ codec used for data compression
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_COMPRESSION_H_
+#define _BLAZE_UTIL_COMPRESSION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstring>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  BYTE FILTERS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Byte-wise shuffling of an array of \a n elements of size \a TypeSize.
+// \ingroup util
+//
+// \param src The array to be shuffled.
+// \param dst The array for the shuffled bytes.
+// \param n The number of elements.
+// \param typeSize The size of a single element in bytes (only used if \a TypeSize is 0).
+// \return void
+//
+// This function performs the shuffling of byteShuffle(). For a compile time element size the
+// inner loop is completely unrolled, which enables the vectorization of the outer loop.
+*/
+template< size_t TypeSize >
+inline void byteShuffle( const char* src, char* dst, size_t n, size_t typeSize ) noexcept
+{
+   const size_t size( TypeSize > 0UL ? TypeSize : typeSize );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      for( size_t k=0UL; k<size; ++k ) {
+         dst[k*n+i] = src[i*size+k];
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reverting the byte-wise shuffling of an array of \a n elements of size \a TypeSize.
+// \ingroup util
+//
+// \param src The shuffled array.
+// \param dst The array for the restored elements.
+// \param n The number of elements.
+// \param typeSize The size of a single element in bytes (only used if \a TypeSize is 0).
+// \return void
+*/
+template< size_t TypeSize >
+inline void byteUnshuffle( const char* src, char* dst, size_t n, size_t typeSize ) noexcept
+{
+   const size_t size( TypeSize > 0UL ? TypeSize : typeSize );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      for( size_t k=0UL; k<size; ++k ) {
+         dst[i*size+k] = src[k*n+i];
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Byte-wise shuffling of an array of elements.
+// \ingroup util
+//
+// \param src The array to be shuffled.
+// \param dst The array for the shuffled bytes (must not overlap with \a src).
+// \param size The size of both arrays in bytes.
+// \param typeSize The size of a single element in bytes.
+// \return void
+//
+// This function reorders the bytes of the given array of elements of size \a typeSize such that
+// the first bytes of all elements are followed by all second bytes, all third bytes, etc. For
+// arrays of numeric values, bytes of the same significance are usually very similar, which can
+// be exploited by a subsequent compression step. Trailing bytes that do not form a complete
+// element are copied unchanged.
+*/
+inline void byteShuffle( const char* src, char* dst, size_t size, size_t typeSize ) noexcept
+{
+   if( typeSize <= 1UL ) {
+      std::memcpy( dst, src, size );
+      return;
+   }
+
+   const size_t n( size / typeSize );
+
+   switch( typeSize ) {
+      case 2UL:  byteShuffle<2UL>( src, dst, n, typeSize ); break;
+      case 4UL:  byteShuffle<4UL>( src, dst, n, typeSize ); break;
+      case 8UL:  byteShuffle<8UL>( src, dst, n, typeSize ); break;
+      case 16UL: byteShuffle<16UL>( src, dst, n, typeSize ); break;
+      default:   byteShuffle<0UL>( src, dst, n, typeSize ); break;
+   }
+
+   std::memcpy( dst+n*typeSize, src+n*typeSize, size-n*typeSize );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reverting the byte-wise shuffling of an array of elements.
+// \ingroup util
+//
+// \param src The shuffled array.
+// \param dst The array for the restored elements (must not overlap with \a src).
+// \param size The size of both arrays in bytes.
+// \param typeSize The size of a single element in bytes.
+// \return void
+//
+// This function reverts the byteShuffle() function for the same \a size and \a typeSize.
+*/
+inline void byteUnshuffle( const char* src, char* dst, size_t size, size_t typeSize ) noexcept
+{
+   if( typeSize <= 1UL ) {
+      std::memcpy( dst, src, size );
+      return;
+   }
+
+   const size_t n( size / typeSize );
+
+   switch( typeSize ) {
+      case 2UL:  byteUnshuffle<2UL>( src, dst, n, typeSize ); break;
+      case 4UL:  byteUnshuffle<4UL>( src, dst, n, typeSize ); break;
+      case 8UL:  byteUnshuffle<8UL>( src, dst, n, typeSize ); break;
+      case 16UL: byteUnshuffle<16UL>( src, dst, n, typeSize ); break;
+      default:   byteUnshuffle<0UL>( src, dst, n, typeSize ); break;
+   }
+
+   std::memcpy( dst+n*typeSize, src+n*typeSize, size-n*typeSize );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place delta encoding of an array of bytes.
+// \ingroup util
+//
+// \param data The array to be encoded.
+// \param size The size of the array in bytes.
+// \return void
+//
+// This function replaces every byte (except the first) by its difference to the preceding byte
+// (modulo 256). In combination with byteShuffle(), slowly varying values result in long runs of
+// zero bytes.
+*/
+inline void byteDeltaEncode( char* data, size_t size ) noexcept
+{
+   unsigned char* bytes( reinterpret_cast<unsigned char*>( data ) );
+
+   for( size_t i=size; i>1UL; --i ) {
+      bytes[i-1UL] = static_cast<unsigned char>( bytes[i-1UL] - bytes[i-2UL] );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place delta decoding of an array of bytes.
+// \ingroup util
+//
+// \param data The array to be decoded.
+// \param size The size of the array in bytes.
+// \return void
+//
+// This function reverts the byteDeltaEncode() function.
+*/
+inline void byteDeltaDecode( char* data, size_t size ) noexcept
+{
+   unsigned char* bytes( reinterpret_cast<unsigned char*>( data ) );
+
+   for( size_t i=1UL; i<size; ++i ) {
+      bytes[i] = static_cast<unsigned char>( bytes[i] + bytes[i-1UL] );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LZ CODEC
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary function for the LZ codec to read 4 bytes.
+// \ingroup util
+*/
+inline uint32_t lzRead32( const unsigned char* ptr ) noexcept
+{
+   uint32_t value;
+   std::memcpy( &value, ptr, sizeof( uint32_t ) );
+   return value;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary function for the LZ codec to write a length in the extended encoding.
+// \ingroup util
+*/
+inline unsigned char* lzWriteLength( unsigned char* op, size_t length ) noexcept
+{
+   while( length >= 255UL ) {
+      *op++ = 255U;
+      length -= 255UL;
+   }
+   *op++ = static_cast<unsigned char>( length );
+   return op;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary function for the LZ codec to read a length in the extended encoding.
+// \ingroup util
+//
+// \return \a false in case the end of the input is reached prematurely, \a true otherwise.
+*/
+inline bool lzReadLength( const unsigned char*& ip, const unsigned char* end, size_t& length ) noexcept
+{
+   unsigned char byte;
+   do {
+      if( ip == end ) return false;
+      byte = *ip++;
+      length += byte;
+   } while( byte == 255U );
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary function for the LZ codec to write a single sequence of literals and a match.
+// \ingroup util
+//
+// \return Pointer past the written sequence, \a nullptr in case the capacity is exceeded.
+*/
+inline unsigned char* lzWriteSequence( unsigned char* op, const unsigned char* end,
+                                       const unsigned char* literals, size_t literalLength,
+                                       size_t offset, size_t matchLength ) noexcept
+{
+   const size_t ml( ( matchLength > 0UL )?( matchLength - 4UL ):( 0UL ) );
+
+   const size_t required( 1UL + literalLength +
+                          ( ( literalLength >= 15UL )?( ( literalLength - 15UL )/255UL + 1UL ):( 0UL ) ) +
+                          ( ( matchLength > 0UL )?( 2UL ):( 0UL ) ) +
+                          ( ( ml >= 15UL )?( ( ml - 15UL )/255UL + 1UL ):( 0UL ) ) );
+
+   if( static_cast<size_t>( end - op ) < required ) {
+      return nullptr;
+   }
+
+   unsigned char* token( op++ );
+   *token = static_cast<unsigned char>( ( ( literalLength < 15UL )?( literalLength ):( 15UL ) ) << 4 |
+                                        ( ( ml < 15UL )?( ml ):( 15UL ) ) );
+
+   if( literalLength >= 15UL ) {
+      op = lzWriteLength( op, literalLength - 15UL );
+   }
+
+   std::memcpy( op, literals, literalLength );
+   op += literalLength;
+
+   if( matchLength > 0UL ) {
+      *op++ = static_cast<unsigned char>( offset & 0xFFUL );
+      *op++ = static_cast<unsigned char>( offset >> 8 );
+      if( ml >= 15UL ) {
+         op = lzWriteLength( op, ml - 15UL );
+      }
+   }
+
+   return op;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compression of an array of bytes by means of an LZ77-type codec.
+// \ingroup util
+//
+// \param src The array to be compressed.
+// \param size The size of the array in bytes.
+// \param dst The array for the compressed data.
+// \param capacity The capacity of \a dst in bytes.
+// \return The size of the compressed data, 0 in case the compressed data exceeds \a capacity.
+//
+// This function compresses the given array of bytes by replacing repeated byte sequences by
+// references to a previous occurrence within the last 64 KiB (using a greedy, hash-based match
+// search). The encoding follows the LZ4 block format: Each sequence consists of a token byte
+// holding the number of literals and the match length, the literals, a 2-byte little-endian
+// offset and optional extension bytes for long lengths. The last sequence consists of literals
+// only. The codec is optimized for speed and works best in combination with the byte filters
+// byteShuffle() and byteDeltaEncode().
+*/
+inline size_t lzCompress( const char* src, size_t size, char* dst, size_t capacity ) noexcept
+{
+   constexpr size_t hashBits  ( 13UL );
+   constexpr size_t minMatch  ( 4UL );
+   constexpr size_t maxOffset ( 65535UL );
+
+   const unsigned char* const in( reinterpret_cast<const unsigned char*>( src ) );
+   unsigned char* op( reinterpret_cast<unsigned char*>( dst ) );
+   unsigned char* const end( op + capacity );
+
+   uint32_t table[1UL << hashBits] = {};
+
+   size_t ip    ( 0UL );
+   size_t anchor( 0UL );
+
+   while( ip + minMatch <= size )
+   {
+      const uint32_t sequence( lzRead32( in+ip ) );
+      const uint32_t hash( ( sequence * 2654435761U ) >> ( 32UL - hashBits ) );
+      const size_t   ref( table[hash] );
+
+      table[hash] = static_cast<uint32_t>( ip );
+
+      if( ref >= ip || ip - ref > maxOffset || lzRead32( in+ref ) != sequence ) {
+         ip += 1UL + ( ( ip - anchor ) >> 6 );
+         continue;
+      }
+
+      size_t length( minMatch );
+      while( ip + length < size && in[ref+length] == in[ip+length] ) {
+         ++length;
+      }
+
+      op = lzWriteSequence( op, end, in+anchor, ip-anchor, ip-ref, length );
+      if( op == nullptr ) return 0UL;
+
+      ip    += length;
+      anchor = ip;
+   }
+
+   op = lzWriteSequence( op, end, in+anchor, size-anchor, 0UL, 0UL );
+   if( op == nullptr ) return 0UL;
+
+   return static_cast<size_t>( op - reinterpret_cast<unsigned char*>( dst ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Decompression of an array of bytes compressed by the lzCompress() function.
+// \ingroup util
+//
+// \param src The compressed data.
+// \param size The size of the compressed data in bytes.
+// \param dst The array for the decompressed data.
+// \param capacity The capacity of \a dst in bytes.
+// \return The size of the decompressed data, 0 in case the compressed data is corrupt.
+//
+// This function decompresses the given data. All offsets and lengths are validated, i.e. the
+// function never reads beyond the compressed data and never writes beyond the given capacity.
+// Data that does not end with a sequence of literals (as written by lzCompress()) is treated
+// as truncated.
+*/
+inline size_t lzDecompress( const char* src, size_t size, char* dst, size_t capacity ) noexcept
+{
+   const unsigned char* ip( reinterpret_cast<const unsigned char*>( src ) );
+   const unsigned char* const iend( ip + size );
+   unsigned char* const out( reinterpret_cast<unsigned char*>( dst ) );
+
+   size_t op( 0UL );
+
+   while( true )
+   {
+      if( ip == iend ) {
+         return 0UL;
+      }
+
+      const unsigned char token( *ip++ );
+
+      size_t literalLength( token >> 4 );
+      if( literalLength == 15UL && !lzReadLength( ip, iend, literalLength ) ) {
+         return 0UL;
+      }
+
+      if( static_cast<size_t>( iend - ip ) < literalLength || capacity - op < literalLength ) {
+         return 0UL;
+      }
+
+      std::memcpy( out+op, ip, literalLength );
+      ip += literalLength;
+      op += literalLength;
+
+      if( ip == iend ) break;
+
+      if( iend - ip < 2 ) {
+         return 0UL;
+      }
+
+      const size_t offset( size_t( ip[0] ) | ( size_t( ip[1] ) << 8 ) );
+      ip += 2;
+
+      size_t matchLength( token & 15U );
+      if( matchLength == 15UL && !lzReadLength( ip, iend, matchLength ) ) {
+         return 0UL;
+      }
+      matchLength += 4UL;
+
+      if( offset == 0UL || offset > op || capacity - op < matchLength ) {
+         return 0UL;
+      }
+
+      if( offset >= matchLength ) {
+         std::memcpy( out+op, out+op-offset, matchLength );
+         op += matchLength;
+      }
+      else {
+         for( size_t i=0UL; i<matchLength; ++i, ++op ) {
+            out[op] = out[op-offset];
+         }
+      }
+   }
+
+   return op;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
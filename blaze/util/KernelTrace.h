@@ -0,0 +1,88 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/KernelTrace.h
+//  \brief Header file for the kernel trace functionality
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_KERNELTRACE_H_
+#define _BLAZE_UTIL_KERNELTRACE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/system/Debugging.h>
+#include <blaze/util/kerneltrace/KernelTrace.h>
+
+
+
+
+//=================================================================================================
+//
+//  BLAZE_KERNEL_TRACE MACRO
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Kernel trace macro.
+// \ingroup util
+//
+// This macro records the execution of a computational kernel in a low-overhead kernel trace.
+// It expects the name of the operation and the selected kernel (both as string literals) and
+// up to three dimensions of the operation (unused dimensions are set to 0):
+
+   \code
+   BLAZE_KERNEL_TRACE( "DMatDMatMultExpr::assign", "large", A.rows(), B.columns(), A.columns() );
+   \endcode
+
+// The macro records the time stamps at the point of its use and at the end of the enclosing
+// scope, the index of the calling thread, the name, the kernel, and the dimensions in a ring
+// buffer of the calling thread. The recorded events can be written in the Chrome trace event
+// format via the writeKernelTraces() function:
+
+   \code
+   blaze::writeKernelTraces( "trace.json" );  // Display via chrome://tracing or ui.perfetto.dev
+   \endcode
+
+// Kernel tracing can be enabled or disabled via the BLAZE_USE_KERNEL_TRACES macro. In case
+// kernel tracing is deactivated, the macro is completely removed from the code, i.e. no events
+// are recorded and no overhead results from the BLAZE_KERNEL_TRACE macro.
+*/
+#if BLAZE_USE_KERNEL_TRACES
+#  define BLAZE_KERNEL_TRACE( NAME, KERNEL, M, N, K ) \
+   blaze::KernelTrace BLAZE_KERNEL_TRACE_OBJECT( NAME, KERNEL, M, N, K )
+#else
+#  define BLAZE_KERNEL_TRACE( NAME, KERNEL, M, N, K )
+#endif
+//*************************************************************************************************
+
+#endif
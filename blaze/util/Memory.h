@@ -48,6 +48,7 @@
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/Exception.h>
+#include <blaze/util/NUMA.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/AlignmentOf.h>
 #include <blaze/util/typetraits/IsBuiltin.h>
@@ -73,7 +74,8 @@ namespace blaze {
 //
 // This function provides the functionality to allocate memory based on the given alignment
 // restrictions. For that purpose it uses the according system-specific memory allocation
-// functions.
+// functions. Additionally, the active NUMA interleave or bind policy is applied to the memory
+// (see setNumaPolicy()).
 */
 inline byte_t* allocate_backend( size_t size, size_t alignment )
 {
@@ -92,6 +94,8 @@ inline byte_t* allocate_backend( size_t size, size_t alignment )
       BLAZE_THROW_BAD_ALLOC;
    }
 
+   applyNumaPolicy( raw, size );
+
    return reinterpret_cast<byte_t*>( raw );
 }
 /*! \endcond */
@@ -0,0 +1,700 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/MemoryMap.h
+//  \brief Header file for the MemoryMap class
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_MEMORYMAP_H_
+#define _BLAZE_UTIL_MEMORYMAP_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#if defined(_MSC_VER) || defined(__MINGW64_VERSION_MAJOR) || defined(__MINGW32__)
+#  ifndef NOMINMAX
+#    define NOMINMAX
+#  endif
+#  include <windows.h>
+#else
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <sys/types.h>
+#  include <unistd.h>
+#endif
+#include <string>
+#include <utility>
+#include <blaze/util/Exception.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Memory mapping of a complete file.
+// \ingroup util
+//
+// The MemoryMap class maps the complete content of a file into the address space of the
+// process. Either an existing file is mapped for reading (and optionally for writing) or a new
+// file of a given size is created and mapped for reading and writing:
+
+   \code
+   // Creating a new file of 1 GiB and mapping it for reading and writing
+   blaze::MemoryMap map1( "data.bin", 1073741824UL );
+
+   // Mapping an existing file for reading only
+   blaze::MemoryMap map2( "input.bin", false );
+   const char* data = map2.data();
+
+   // Mapping an existing file for reading and writing without modifying the file
+   blaze::MemoryMap map3( "input.bin", true, false );
+   \endcode
+
+// In case a file is mapped for writing, but not shared, the modifications are private to the
+// process and are never written back to the file (copy-on-write). In that case only the modified
+// pages of the file occupy main memory. The content of the file is not read on construction, but on demand when the mapped memory is
+// accessed. In order to stream through files that are considerably larger than the available
+// main memory, the willNeed() function announces that a range of the file will be accessed
+// soon (i.e. it triggers an asynchronous read-ahead), and the release() function writes back
+// a range of the file and removes it from the working set of the process. Note that all ranges
+// are extended to full pages of memory.
+//
+// A MemoryMap is not copyable, but movable. The file is unmapped and closed on destruction.
+*/
+class MemoryMap
+   : private NonCopyable
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline MemoryMap() noexcept;
+   inline MemoryMap( const std::string& file, bool writable, bool shared = true );
+   inline MemoryMap( const std::string& file, size_t size );
+   inline MemoryMap( MemoryMap&& m ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~MemoryMap();
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline MemoryMap& operator=( MemoryMap&& m ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline char*       data() noexcept;
+   inline const char* data() const noexcept;
+   inline size_t      size() const noexcept;
+   inline bool        isOpen() const noexcept;
+   inline bool        isWritable() const noexcept;
+   inline bool        isShared() const noexcept;
+   inline void        willNeed( size_t offset, size_t length ) const noexcept;
+   inline void        release( size_t offset, size_t length ) const noexcept;
+   inline void        flush();
+   inline void        close() noexcept;
+   inline void        swap( MemoryMap& m ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline void open( const std::string& file, bool writable, bool shared, bool create, size_t size );
+   inline bool pageRange( size_t& offset, size_t& length ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   char*  data_;      //!< The start of the mapped memory.
+   size_t size_;      //!< The size of the mapped file in bytes.
+   bool   writable_;  //!< Flag for a writable mapping.
+   bool   shared_;    //!< Flag for a mapping that writes modifications back to the file.
+#if defined(_MSC_VER) || defined(__MINGW64_VERSION_MAJOR) || defined(__MINGW32__)
+   HANDLE file_;      //!< The handle of the mapped file.
+   HANDLE mapping_;   //!< The handle of the file mapping object.
+#else
+   int    file_;      //!< The file descriptor of the mapped file.
+#endif
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for MemoryMap.
+//
+// The default constructor creates an empty memory map that is not associated with any file.
+*/
+inline MemoryMap::MemoryMap() noexcept
+   : data_    ( nullptr )  // The start of the mapped memory
+   , size_    ( 0UL )      // The size of the mapped file in bytes
+   , writable_( false )    // Flag for a writable mapping
+   , shared_  ( true )     // Flag for a mapping that writes modifications back to the file
+#if defined(_MSC_VER) || defined(__MINGW64_VERSION_MAJOR) || defined(__MINGW32__)
+   , file_    ( INVALID_HANDLE_VALUE )  // The handle of the mapped file
+   , mapping_ ( nullptr )               // The handle of the file mapping object
+#else
+   , file_    ( -1 )       // The file descriptor of the mapped file
+#endif
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Mapping an existing file.
+//
+// \param file The name of the file to be mapped.
+// \param writable \a true to map the file for reading and writing, \a false for reading only.
+// \param shared \a true to write modifications back to the file, \a false for private modifications.
+// \exception std::runtime_error File could not be opened.
+// \exception std::runtime_error File could not be mapped.
+//
+// In case \a shared is \a false, the file itself is opened for reading only and all modifications
+// of the mapped memory are private to the process (copy-on-write).
+*/
+inline MemoryMap::MemoryMap( const std::string& file, bool writable, bool shared )
+   : MemoryMap()
+{
+   open( file, writable, shared, false, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creating and mapping a new file of the given size.
+//
+// \param file The name of the file to be created.
+// \param size The size of the file in bytes.
+// \exception std::runtime_error File could not be opened.
+// \exception std::runtime_error File could not be resized.
+// \exception std::runtime_error File could not be mapped.
+//
+// This constructor creates a new file of the given size (or truncates an existing file) and
+// maps it for reading and writing. The content of the file is initialized with zeros. On file
+// systems that support sparse files, no disk space is allocated until the memory is written.
+*/
+inline MemoryMap::MemoryMap( const std::string& file, size_t size )
+   : MemoryMap()
+{
+   open( file, true, true, true, size );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The move constructor for MemoryMap.
+//
+// \param m The memory map to be moved into this instance.
+*/
+inline MemoryMap::MemoryMap( MemoryMap&& m ) noexcept
+   : MemoryMap()
+{
+   swap( m );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for MemoryMap.
+//
+// The destructor unmaps and closes the file. Modifications are written back to the file by
+// the operating system.
+*/
+inline MemoryMap::~MemoryMap()
+{
+   close();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Move assignment operator for MemoryMap.
+//
+// \param m The memory map to be moved into this instance.
+// \return Reference to the assigned memory map.
+*/
+inline MemoryMap& MemoryMap::operator=( MemoryMap&& m ) noexcept
+{
+   MemoryMap tmp( std::move( m ) );
+   swap( tmp );
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Low-level access to the mapped memory.
+//
+// \return Pointer to the start of the mapped memory.
+*/
+inline char* MemoryMap::data() noexcept
+{
+   return data_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level access to the mapped memory.
+//
+// \return Pointer to the start of the mapped memory.
+*/
+inline const char* MemoryMap::data() const noexcept
+{
+   return data_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the size of the mapped file.
+//
+// \return The size of the mapped file in bytes.
+*/
+inline size_t MemoryMap::size() const noexcept
+{
+   return size_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the memory map is associated with a file.
+//
+// \return \a true in case a file is mapped, \a false if not.
+*/
+inline bool MemoryMap::isOpen() const noexcept
+{
+   return data_ != nullptr;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the file is mapped for writing.
+//
+// \return \a true in case the mapped memory can be written, \a false if not.
+*/
+inline bool MemoryMap::isWritable() const noexcept
+{
+   return writable_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether modifications of the mapped memory are written back to the file.
+//
+// \return \a true in case modifications are written back to the file, \a false if they are private.
+*/
+inline bool MemoryMap::isShared() const noexcept
+{
+   return shared_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Announces that the given range of the file will be accessed soon.
+//
+// \param offset The offset of the first byte of the range.
+// \param length The number of bytes of the range.
+// \return void
+//
+// This function triggers an asynchronous read-ahead of the given range of the file. It is
+// merely a hint to the operating system and does not have any effect on the content of the
+// mapped memory.
+*/
+inline void MemoryMap::willNeed( size_t offset, size_t length ) const noexcept
+{
+   if( !pageRange( offset, length ) ) return;
+
+#if defined(_MSC_VER) || defined(__MINGW64_VERSION_MAJOR) || defined(__MINGW32__)
+#  if defined(_WIN32_WINNT) && _WIN32_WINNT >= 0x0602
+   WIN32_MEMORY_RANGE_ENTRY entry;
+   entry.VirtualAddress = data_ + offset;
+   entry.NumberOfBytes  = length;
+   PrefetchVirtualMemory( GetCurrentProcess(), 1, &entry, 0 );
+#  endif
+#else
+   ::madvise( data_ + offset, length, MADV_WILLNEED );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removes the given range of the file from the working set of the process.
+//
+// \param offset The offset of the first byte of the range.
+// \param length The number of bytes of the range.
+// \return void
+//
+// This function initiates the write back of all modifications within the given range of the
+// file and removes the according pages from the working set of the process. The content of the
+// mapped memory is not affected: Any subsequent access to the range reads the current content
+// of the file (typically from the page cache of the operating system). In case of a private
+// writable mapping the function has no effect, since the pages may contain modifications.
+*/
+inline void MemoryMap::release( size_t offset, size_t length ) const noexcept
+{
+   if( ( writable_ && !shared_ ) || !pageRange( offset, length ) ) return;
+
+#if defined(_MSC_VER) || defined(__MINGW64_VERSION_MAJOR) || defined(__MINGW32__)
+   if( writable_ ) {
+      FlushViewOfFile( data_ + offset, length );
+   }
+   VirtualUnlock( data_ + offset, length );
+#else
+   if( writable_ ) {
+      ::msync( data_ + offset, length, MS_ASYNC );
+   }
+   ::madvise( data_ + offset, length, MADV_DONTNEED );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes all modifications of the mapped memory back to the file.
+//
+// \return void
+// \exception std::runtime_error File could not be written.
+//
+// This function blocks until all modifications have been written to the file. In case of a
+// private mapping the function has no effect.
+*/
+inline void MemoryMap::flush()
+{
+   if( !writable_ || !shared_ || data_ == nullptr ) return;
+
+#if defined(_MSC_VER) || defined(__MINGW64_VERSION_MAJOR) || defined(__MINGW32__)
+   if( !FlushViewOfFile( data_, 0 ) || !FlushFileBuffers( file_ ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "File could not be written" );
+   }
+#else
+   if( ::msync( data_, size_, MS_SYNC ) != 0 ) {
+      BLAZE_THROW_RUNTIME_ERROR( "File could not be written" );
+   }
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Unmapping and closing the file.
+//
+// \return void
+//
+// After this function the memory map is not associated with any file. Modifications are
+// written back to the file by the operating system.
+*/
+inline void MemoryMap::close() noexcept
+{
+#if defined(_MSC_VER) || defined(__MINGW64_VERSION_MAJOR) || defined(__MINGW32__)
+   if( data_ != nullptr ) {
+      UnmapViewOfFile( data_ );
+   }
+   if( mapping_ != nullptr ) {
+      CloseHandle( mapping_ );
+   }
+   if( file_ != INVALID_HANDLE_VALUE ) {
+      CloseHandle( file_ );
+   }
+
+   mapping_ = nullptr;
+   file_    = INVALID_HANDLE_VALUE;
+#else
+   if( data_ != nullptr ) {
+      ::munmap( data_, size_ );
+   }
+   if( file_ != -1 ) {
+      ::close( file_ );
+   }
+
+   file_ = -1;
+#endif
+
+   data_     = nullptr;
+   size_     = 0UL;
+   writable_ = false;
+   shared_   = true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two memory maps.
+//
+// \param m The memory map to be swapped.
+// \return void
+*/
+inline void MemoryMap::swap( MemoryMap& m ) noexcept
+{
+   using std::swap;
+
+   swap( data_    , m.data_     );
+   swap( size_    , m.size_     );
+   swap( writable_, m.writable_ );
+   swap( shared_  , m.shared_   );
+   swap( file_    , m.file_     );
+#if defined(_MSC_VER) || defined(__MINGW64_VERSION_MAJOR) || defined(__MINGW32__)
+   swap( mapping_ , m.mapping_  );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Opening and mapping the given file.
+//
+// \param file The name of the file to be mapped.
+// \param writable \a true to map the file for reading and writing, \a false for reading only.
+// \param shared \a true to write modifications back to the file, \a false for private modifications.
+// \param create \a true to create a new file of the given size, \a false to open an existing file.
+// \param size The size of the new file in bytes (only used in case \a create is \a true).
+// \return void
+// \exception std::runtime_error File could not be opened.
+// \exception std::runtime_error File could not be resized.
+// \exception std::runtime_error File could not be mapped.
+*/
+inline void MemoryMap::open( const std::string& file, bool writable, bool shared, bool create, size_t size )
+{
+   const bool writeFile( writable && shared );
+
+#if defined(_MSC_VER) || defined(__MINGW64_VERSION_MAJOR) || defined(__MINGW32__)
+   file_ = CreateFileA( file.c_str(),
+                        writeFile ? ( GENERIC_READ | GENERIC_WRITE ) : GENERIC_READ,
+                        FILE_SHARE_READ, nullptr, create ? CREATE_ALWAYS : OPEN_EXISTING,
+                        FILE_ATTRIBUTE_NORMAL, nullptr );
+
+   if( file_ == INVALID_HANDLE_VALUE ) {
+      BLAZE_THROW_RUNTIME_ERROR( "File could not be opened" );
+   }
+
+   LARGE_INTEGER filesize;
+
+   if( create ) {
+      filesize.QuadPart = static_cast<LONGLONG>( size );
+      if( !SetFilePointerEx( file_, filesize, nullptr, FILE_BEGIN ) || !SetEndOfFile( file_ ) ) {
+         close();
+         BLAZE_THROW_RUNTIME_ERROR( "File could not be resized" );
+      }
+   }
+   else if( !GetFileSizeEx( file_, &filesize ) ) {
+      close();
+      BLAZE_THROW_RUNTIME_ERROR( "File could not be opened" );
+   }
+
+   size_     = static_cast<size_t>( filesize.QuadPart );
+   writable_ = writable;
+   shared_   = shared;
+
+   if( size_ == 0UL ) return;
+
+   mapping_ = CreateFileMappingA( file_, nullptr,
+                                  writeFile ? PAGE_READWRITE : ( writable ? PAGE_WRITECOPY : PAGE_READONLY ),
+                                  0, 0, nullptr );
+
+   if( mapping_ == nullptr ) {
+      close();
+      BLAZE_THROW_RUNTIME_ERROR( "File could not be mapped" );
+   }
+
+   data_ = static_cast<char*>( MapViewOfFile( mapping_,
+                                              writeFile ? FILE_MAP_WRITE : ( writable ? FILE_MAP_COPY : FILE_MAP_READ ),
+                                              0, 0, 0 ) );
+
+   if( data_ == nullptr ) {
+      close();
+      BLAZE_THROW_RUNTIME_ERROR( "File could not be mapped" );
+   }
+#else
+   const int flags( create ? ( O_RDWR | O_CREAT | O_TRUNC ) : ( writeFile ? O_RDWR : O_RDONLY ) );
+
+   file_ = ::open( file.c_str(), flags, 0644 );
+
+   if( file_ == -1 ) {
+      BLAZE_THROW_RUNTIME_ERROR( "File could not be opened" );
+   }
+
+   if( create ) {
+      if( ::ftruncate( file_, static_cast<off_t>( size ) ) != 0 ) {
+         close();
+         BLAZE_THROW_RUNTIME_ERROR( "File could not be resized" );
+      }
+   }
+   else {
+      struct stat status;
+      if( ::fstat( file_, &status ) != 0 ) {
+         close();
+         BLAZE_THROW_RUNTIME_ERROR( "File could not be opened" );
+      }
+      size = static_cast<size_t>( status.st_size );
+   }
+
+   size_     = size;
+   writable_ = writable;
+   shared_   = shared;
+
+   if( size_ == 0UL ) return;
+
+   void* ptr( ::mmap( nullptr, size_, writable ? ( PROT_READ | PROT_WRITE ) : PROT_READ,
+                      shared ? MAP_SHARED : MAP_PRIVATE, file_, 0 ) );
+
+   if( ptr == MAP_FAILED ) {
+      close();
+      BLAZE_THROW_RUNTIME_ERROR( "File could not be mapped" );
+   }
+
+   data_ = static_cast<char*>( ptr );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Extends the given range of the file to full pages of memory.
+//
+// \param offset The offset of the first byte of the range; adjusted to the start of a page.
+// \param length The number of bytes of the range; adjusted to a multiple of the page size.
+// \return \a true in case the adjusted range is not empty, \a false if it is.
+*/
+inline bool MemoryMap::pageRange( size_t& offset, size_t& length ) const noexcept
+{
+   if( data_ == nullptr || offset >= size_ || length == 0UL ) return false;
+
+#if defined(_MSC_VER) || defined(__MINGW64_VERSION_MAJOR) || defined(__MINGW32__)
+   SYSTEM_INFO info;
+   GetSystemInfo( &info );
+   const size_t pagesize( info.dwPageSize );
+#else
+   const size_t pagesize( static_cast<size_t>( ::sysconf( _SC_PAGESIZE ) ) );
+#endif
+
+   const size_t last( ( length > size_ - offset )?( size_ ):( offset + length ) );
+
+   offset -= offset % pagesize;
+   length  = last - offset;
+
+   return true;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name MemoryMap operators */
+//@{
+inline void swap( MemoryMap& a, MemoryMap& b ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two memory maps.
+// \ingroup util
+//
+// \param a The first memory map to be swapped.
+// \param b The second memory map to be swapped.
+// \return void
+*/
+inline void swap( MemoryMap& a, MemoryMap& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
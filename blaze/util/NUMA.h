@@ -0,0 +1,424 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/NUMA.h
+//  \brief Header file for the NUMA memory placement policies
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_NUMA_H_
+#define _BLAZE_UTIL_NUMA_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#if defined(__linux__)
+#  include <sys/syscall.h>
+#  include <unistd.h>
+#endif
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <blaze/util/Exception.h>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  NUMA POLICIES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Placement policies for the memory of large dense containers on NUMA systems.
+// \ingroup util
+//
+// On NUMA systems the operating system places a page of memory on the node of the thread that
+// first writes to it (first touch). By default, the elements of dense vectors and matrices are
+// initialized by the thread that creates the container, i.e. all pages end up on a single node
+// and all other threads of a parallel operation have to access remote memory. The NUMA policy
+// (see setNumaPolicy()) selects a different placement:
+//
+//  - \a numaDefault: The memory is placed by the operating system (default).
+//  - \a numaFirstTouch: The elements of large DynamicVector and DynamicMatrix instances are
+//    initialized in parallel, with the same partitioning as the parallel assignments. Thus
+//    every thread mostly works on node-local memory in subsequent parallel operations.
+//  - \a numaInterleave: The pages of all large allocations are distributed round-robin over
+//    the selected NUMA nodes.
+//  - \a numaBind: The pages of all large allocations are restricted to the selected NUMA nodes.
+//
+// The interleave and bind policies are only available on Linux and are ignored on all other
+// platforms. The first touch policy only pays off in case the shared memory parallelization
+// is active and the threads are distributed over the NUMA nodes.
+*/
+enum NumaPolicy
+{
+   numaDefault    = 0,  //!< Placement by the operating system.
+   numaFirstTouch = 1,  //!< Parallel first touch initialization of large dense containers.
+   numaInterleave = 2,  //!< Round-robin interleaving of pages over the selected nodes.
+   numaBind       = 3   //!< Binding of pages to the selected nodes.
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Minimum size in bytes of an allocation that is affected by the interleave and bind policies.
+// \ingroup util
+*/
+constexpr size_t NUMA_POLICY_MINIMUM_SIZE = 65536UL;
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  NUMA UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Parsing a list of NUMA nodes.
+// \ingroup util
+//
+// \param list The list of nodes in the format "0-3,5" (as used by the Linux kernel).
+// \return The according bit mask of nodes.
+//
+// Nodes beyond 63 and invalid characters are ignored.
+*/
+inline uint64_t parseNumaNodes( const std::string& list ) noexcept
+{
+   uint64_t nodes( 0UL );
+   size_t pos( 0UL );
+
+   while( pos < list.size() )
+   {
+      if( list[pos] < '0' || list[pos] > '9' ) {
+         ++pos;
+         continue;
+      }
+
+      char* end( nullptr );
+      const unsigned long first( std::strtoul( list.c_str()+pos, &end, 10 ) );
+      unsigned long last( first );
+      pos = static_cast<size_t>( end - list.c_str() );
+
+      if( pos < list.size() && list[pos] == '-' ) {
+         last = std::strtoul( list.c_str()+pos+1UL, &end, 10 );
+         pos = static_cast<size_t>( end - list.c_str() );
+      }
+
+      for( unsigned long node=first; node<=last && node<64UL; ++node ) {
+         nodes |= ( uint64_t(1) << node );
+      }
+   }
+
+   return nodes;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the bit mask of the available NUMA nodes.
+// \ingroup util
+//
+// \return The bit mask of the online NUMA nodes (at least node 0).
+//
+// On Linux the available nodes are determined from \c /sys/devices/system/node/online. On all
+// other platforms, and in case the file is not available, the system is assumed to consist of
+// a single node.
+*/
+inline uint64_t getNumaNodeMask()
+{
+   static const uint64_t nodes = []() -> uint64_t
+   {
+      std::ifstream file( "/sys/devices/system/node/online" );
+      std::string list;
+
+      if( !std::getline( file, list ) )
+         return 1UL;
+
+      const uint64_t mask( parseNumaNodes( list ) );
+      return ( mask != 0UL )?( mask ):( 1UL );
+   }();
+
+   return nodes;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of available NUMA nodes.
+// \ingroup util
+//
+// \return The number of online NUMA nodes.
+*/
+inline size_t getNumaNodes()
+{
+   size_t count( 0UL );
+
+   for( uint64_t nodes=getNumaNodeMask(); nodes!=0UL; nodes&=nodes-1UL ) {
+      ++count;
+   }
+
+   return count;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  NUMA POLICY SETTINGS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The currently active NUMA policy and the according set of nodes.
+// \ingroup util
+*/
+struct NumaSettings
+{
+   std::atomic<int>      policy;    //!< The active NUMA policy.
+   std::atomic<uint64_t> nodes;     //!< The bit mask of the selected NUMA nodes.
+   std::atomic<bool>     modified;  //!< Flag for a previously active interleave or bind policy.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Parsing the specification of a NUMA policy.
+// \ingroup util
+//
+// \param value The specification of the NUMA policy (as for instance "interleave:0-3").
+// \param settings The NUMA settings to be updated.
+// \return void
+//
+// The specification consists of the name of the policy (\c default, \c firsttouch,
+// \c interleave, or \c bind), optionally followed by a colon and a list of nodes. Unknown
+// policy names select the default policy, unavailable nodes are ignored. In case none of the
+// given nodes is available, the previously selected nodes are kept.
+*/
+inline void parseNumaPolicy( const std::string& value, NumaSettings& settings )
+{
+   const size_t colon( value.find( ':' ) );
+   const std::string name( value.substr( 0UL, colon ) );
+
+   if     ( name == "firsttouch" ) settings.policy = numaFirstTouch;
+   else if( name == "interleave" ) settings.policy = numaInterleave;
+   else if( name == "bind"       ) settings.policy = numaBind;
+   else                            settings.policy = numaDefault;
+
+   if( settings.policy == numaInterleave || settings.policy == numaBind ) {
+      settings.modified = true;
+   }
+
+   if( colon != std::string::npos ) {
+      const uint64_t nodes( parseNumaNodes( value.substr( colon + 1UL ) ) & getNumaNodeMask() );
+      if( nodes != 0UL ) settings.nodes = nodes;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the NUMA settings.
+// \ingroup util
+//
+// \return Reference to the NUMA settings.
+//
+// The settings are initialized from the \c BLAZE_NUMA_POLICY environment variable, which can
+// be set to \c default, \c firsttouch, \c interleave, or \c bind, optionally followed by a
+// list of nodes (as for instance \c interleave:0-3 or \c bind:1). By default, all available
+// nodes are selected.
+*/
+#if (defined _MSC_VER)
+#  pragma warning(push)
+#  pragma warning(disable:4996)
+#endif
+inline NumaSettings& numaSettings()
+{
+   static NumaSettings settings{ { numaDefault }, { getNumaNodeMask() }, { false } };
+
+   static const bool initialized = []()
+   {
+      const char* env = std::getenv( "BLAZE_NUMA_POLICY" );
+
+      if( env != nullptr )
+         parseNumaPolicy( env, settings );
+
+      return true;
+   }();
+
+   MAYBE_UNUSED( initialized );
+
+   return settings;
+}
+#if (defined _MSC_VER)
+#  pragma warning(pop)
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Sets the NUMA policy for the memory of large dense containers.
+// \ingroup util
+//
+// \param policy The new NUMA policy.
+// \param nodes The bit mask of the NUMA nodes for the interleave and bind policies.
+// \return void
+// \exception std::invalid_argument Invalid NUMA policy.
+// \exception std::invalid_argument Invalid set of NUMA nodes.
+//
+// This function sets the NUMA policy for all subsequent allocations (see NumaPolicy). The
+// \a nodes argument selects the NUMA nodes for the interleave and bind policies (bit \a i
+// represents node \a i). By default, all available nodes are selected. Unavailable nodes are
+// ignored; in case none of the given nodes is available, a \a std::invalid_argument exception
+// is thrown:
+
+   \code
+   blaze::setNumaPolicy( blaze::numaFirstTouch );      // Parallel initialization
+   blaze::setNumaPolicy( blaze::numaInterleave );      // Interleaving over all nodes
+   blaze::setNumaPolicy( blaze::numaBind, 0b0010UL );  // Binding to node 1
+   \endcode
+
+// The initial policy can also be specified by means of the \c BLAZE_NUMA_POLICY environment
+// variable (as for instance \c BLAZE_NUMA_POLICY=interleave:0-1). Note that this function
+// does not affect memory that has already been allocated.
+*/
+inline void setNumaPolicy( NumaPolicy policy, uint64_t nodes = ~uint64_t(0) )
+{
+   if( policy < numaDefault || policy > numaBind ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid NUMA policy" );
+   }
+
+   nodes &= getNumaNodeMask();
+
+   if( nodes == 0UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid set of NUMA nodes" );
+   }
+
+   numaSettings().nodes  = nodes;
+   numaSettings().policy = policy;
+
+   if( policy == numaInterleave || policy == numaBind ) {
+      numaSettings().modified = true;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the currently active NUMA policy.
+// \ingroup util
+//
+// \return The active NUMA policy.
+*/
+inline NumaPolicy getNumaPolicy()
+{
+   return static_cast<NumaPolicy>( numaSettings().policy.load( std::memory_order_relaxed ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Applies the active NUMA policy to the given memory.
+// \ingroup util
+//
+// \param address The address of the first byte of the memory.
+// \param size The size of the memory in bytes.
+// \return void
+//
+// This function applies the interleave and bind policies to all complete pages of the given
+// memory that has been allocated but not yet been written to. Pages that have already been
+// touched are migrated in case the operating system permits it. Since the operating system
+// keeps the policy for the address range after the memory has been released, the default
+// policy is restored for new allocations once an interleave or bind policy has been active.
+// Memory smaller than \a NUMA_POLICY_MINIMUM_SIZE is not affected. The function never fails;
+// in case the policy cannot be applied the memory is placed by the operating system.
+*/
+inline void applyNumaPolicy( void* address, size_t size )
+{
+#if defined(__linux__) && defined(SYS_mbind)
+   if( size < NUMA_POLICY_MINIMUM_SIZE )
+      return;
+
+   const int policy( numaSettings().policy.load( std::memory_order_relaxed ) );
+   const bool restricted( policy == numaInterleave || policy == numaBind );
+
+   if( !restricted && !numaSettings().modified.load( std::memory_order_relaxed ) )
+      return;
+
+   static const size_t pagesize( static_cast<size_t>( sysconf( _SC_PAGESIZE ) ) );
+
+   const size_t begin( ( reinterpret_cast<size_t>( address ) + pagesize - 1UL ) & ~( pagesize - 1UL ) );
+   const size_t end  ( ( reinterpret_cast<size_t>( address ) + size ) & ~( pagesize - 1UL ) );
+
+   if( begin >= end )
+      return;
+
+   const unsigned long nodes( numaSettings().nodes.load( std::memory_order_relaxed ) );
+
+   // Selection of MPOL_INTERLEAVE, MPOL_BIND or MPOL_DEFAULT and of the MPOL_MF_MOVE flag. The
+   // maximum node number passed to the kernel is the number of bits of the mask plus one.
+   if( restricted ) {
+      const int mode( ( policy == numaInterleave )?( 3 ):( 2 ) );
+      syscall( SYS_mbind, begin, end-begin, mode, &nodes, 65UL, 2U );
+   }
+   else {
+      syscall( SYS_mbind, begin, end-begin, 0, nullptr, 0UL, 0U );
+   }
+#else
+   MAYBE_UNUSED( address, size );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -50,6 +50,7 @@
 #include <blaze/util/Thread.h>
 #include <blaze/util/threadpool/Task.h>
 #include <blaze/util/threadpool/TaskQueue.h>
+#include <blaze/util/Topology.h>
 #include <blaze/util/Types.h>
 
 
@@ -364,6 +365,7 @@ class ThreadPool
    void resize( size_t n, bool block=false );
    void wait();
    void clear();
+   void pin();
    //@}
    //**********************************************************************************************
 
@@ -372,6 +374,7 @@ class ThreadPool
    /*!\name Thread functions */
    //@{
    void createThread();
+   void pinThreads();
    bool executeTask();
    //@}
    //**********************************************************************************************
@@ -682,6 +685,8 @@ void ThreadPool<TT,MT,LT,CT>::resize( size_t n, bool block )
          }
          else ++thread;
       }
+
+      pinThreads();
    }
 }
 //*************************************************************************************************
@@ -729,6 +734,27 @@ void ThreadPool<TT,MT,LT,CT>::clear()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Pinning all threads according to the active thread affinity policy.
+//
+// \return void
+//
+// This function (re-)pins all threads of the thread pool according to the currently active
+// thread affinity policy (see getThreadAffinity()). Threads are pinned automatically on
+// creation, i.e. this function only has to be called after a change of the policy.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void ThreadPool<TT,MT,LT,CT>::pin()
+{
+   Lock lock( mutex_ );
+   pinThreads();
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -756,6 +782,29 @@ void ThreadPool<TT,MT,LT,CT>::createThread()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Pinning all threads of the thread pool.
+//
+// \return void
+//
+// This function must only be called while holding the lock on the synchronization mutex.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void ThreadPool<TT,MT,LT,CT>::pinThreads()
+{
+   size_t index( 0UL );
+
+   for( auto const& thread : threads_ ) {
+      if( !thread->hasTerminated() )
+         pinThread( *thread->thread_, index++ );
+   }
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Executing a scheduled task.
 //
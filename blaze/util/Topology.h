@@ -0,0 +1,521 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/Topology.h
+//  \brief Header file for the CPU topology discovery and the thread affinity policies
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_TOPOLOGY_H_
+#define _BLAZE_UTIL_TOPOLOGY_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#if defined(__linux__)
+#  include <pthread.h>
+#  include <sched.h>
+#endif
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CPU TOPOLOGY
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Topological information about a single hardware thread.
+// \ingroup util
+//
+// The CpuTopology class describes the position of a single hardware thread (i.e. a logical
+// CPU of the operating system) within the processor topology (see getTopology()).
+*/
+struct CpuTopology
+{
+   size_t cpu;      //!< The index of the logical CPU.
+   size_t package;  //!< The index of the physical package (socket).
+   size_t core;     //!< The index of the core within the package.
+   size_t smt;      //!< The index of the hardware thread within the core.
+   size_t cache;    //!< The index of the shared last-level cache domain.
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reading a single value from a sysfs file.
+// \ingroup util
+//
+// \param file The name of the file.
+// \param value The value read from the file.
+// \return \a true in case the value was successfully read, \a false if not.
+*/
+template< typename T >
+inline bool readTopologyValue( const std::string& file, T& value )
+{
+   std::ifstream in( file );
+   return static_cast<bool>( in >> value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Discovers the topology of all hardware threads available to the process.
+// \ingroup util
+//
+// \return The topology of the available hardware threads, sorted by CPU index.
+//
+// On Linux the topology is determined from \c /sys/devices/system/cpu. Only the CPUs of the
+// affinity mask of the process are taken into account. The last-level cache domain of a CPU
+// is identified by the smallest CPU sharing its highest-level data or unified cache. On all
+// other platforms, and in case the topology information is not available, every hardware
+// thread is assumed to be a separate core with a private cache.
+*/
+inline std::vector<CpuTopology> discoverTopology()
+{
+   std::vector<CpuTopology> topology;
+
+#if defined(__linux__)
+   cpu_set_t mask;
+   CPU_ZERO( &mask );
+
+   if( sched_getaffinity( 0, sizeof( cpu_set_t ), &mask ) == 0 )
+   {
+      for( size_t cpu=0UL; cpu<static_cast<size_t>( CPU_SETSIZE ); ++cpu )
+      {
+         if( !CPU_ISSET( cpu, &mask ) )
+            continue;
+
+         const std::string path( "/sys/devices/system/cpu/cpu" + std::to_string( cpu ) );
+
+         CpuTopology info{ cpu, 0UL, cpu, 0UL, cpu };
+         readTopologyValue( path + "/topology/physical_package_id", info.package );
+         readTopologyValue( path + "/topology/core_id", info.core );
+
+         size_t level( 0UL );
+
+         for( size_t index=0UL; ; ++index )
+         {
+            const std::string cache( path + "/cache/index" + std::to_string( index ) );
+
+            size_t current( 0UL );
+            std::string type, shared;
+
+            if( !readTopologyValue( cache + "/level", current ) )
+               break;
+
+            if( !readTopologyValue( cache + "/type", type ) || type == "Instruction" ||
+                current < level || !readTopologyValue( cache + "/shared_cpu_list", shared ) )
+               continue;
+
+            level = current;
+            info.cache = std::strtoul( shared.c_str(), nullptr, 10 );
+         }
+
+         topology.push_back( info );
+      }
+   }
+#endif
+
+   if( topology.empty() ) {
+      const size_t cpus( std::max( 1U, std::thread::hardware_concurrency() ) );
+      for( size_t cpu=0UL; cpu<cpus; ++cpu ) {
+         topology.push_back( CpuTopology{ cpu, 0UL, cpu, 0UL, cpu } );
+      }
+   }
+
+   // Numbering the hardware threads of every core
+   for( CpuTopology& info : topology ) {
+      info.smt = static_cast<size_t>( std::count_if( topology.begin(), topology.end(),
+         [&info]( const CpuTopology& other ) {
+            return other.package == info.package && other.core == info.core && other.cpu < info.cpu;
+         } ) );
+   }
+
+   return topology;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the topology of all hardware threads available to the process.
+// \ingroup util
+//
+// \return The topology of the available hardware threads, sorted by CPU index.
+//
+// The topology is discovered once, at the first call of the function (see CpuTopology).
+*/
+inline const std::vector<CpuTopology>& getTopology()
+{
+   static const std::vector<CpuTopology> topology( discoverTopology() );
+   return topology;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  THREAD AFFINITY POLICIES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Policies for the pinning of the threads of the shared memory parallelization.
+// \ingroup util
+//
+// By default, the threads of the C++11/Boost thread parallelization are not pinned and the
+// operating system is free to migrate them between cores. The thread affinity policy (see
+// setThreadAffinity()) pins the threads to hardware threads in the following order:
+//
+//  - \a affinityNone: The threads are not pinned (default).
+//  - \a affinityCompact: Consecutive threads are pinned to consecutive hardware threads of
+//    the same core, cache domain, and package.
+//  - \a affinityScatter: Consecutive threads are distributed round-robin over the last-level
+//    cache domains; the second hardware threads of the cores are only used after all cores
+//    have been used.
+//  - \a affinityCores: As \a affinityCompact, but only the first hardware thread of every
+//    core is used, i.e. no two threads share a core.
+//
+// In case there are more threads than hardware threads, the order is repeated.
+*/
+enum ThreadAffinity
+{
+   affinityNone    = 0,  //!< No thread pinning.
+   affinityCompact = 1,  //!< Compact placement of consecutive threads.
+   affinityScatter = 2,  //!< Round-robin placement over the cache domains.
+   affinityCores   = 3   //!< Compact placement on the first hardware thread of every core.
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the setting of the thread affinity policy.
+// \ingroup util
+//
+// \return Reference to the thread affinity setting.
+//
+// The setting is initialized from the \c BLAZE_THREAD_AFFINITY environment variable, which can
+// be set to \c none, \c compact, \c scatter, or \c cores.
+*/
+#if (defined _MSC_VER)
+#  pragma warning(push)
+#  pragma warning(disable:4996)
+#endif
+inline std::atomic<int>& threadAffinitySetting()
+{
+   static std::atomic<int> setting( []() -> int
+   {
+      const char* env = std::getenv( "BLAZE_THREAD_AFFINITY" );
+
+      if( env == nullptr )
+         return affinityNone;
+
+      const std::string value( env );
+
+      if     ( value == "compact" ) return affinityCompact;
+      else if( value == "scatter" ) return affinityScatter;
+      else if( value == "cores"   ) return affinityCores;
+      else                          return affinityNone;
+   }() );
+
+   return setting;
+}
+#if (defined _MSC_VER)
+#  pragma warning(pop)
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the currently active thread affinity policy.
+// \ingroup util
+//
+// \return The active thread affinity policy.
+*/
+inline ThreadAffinity getThreadAffinity()
+{
+   return static_cast<ThreadAffinity>( threadAffinitySetting().load( std::memory_order_relaxed ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the order in which threads are pinned to hardware threads.
+// \ingroup util
+//
+// \param policy The thread affinity policy.
+// \return The topology of the hardware threads in pinning order (empty for \a affinityNone).
+*/
+inline std::vector<CpuTopology> getAffinityOrder( ThreadAffinity policy )
+{
+   std::vector<CpuTopology> order;
+
+   if( policy == affinityNone )
+      return order;
+
+   for( const CpuTopology& info : getTopology() ) {
+      if( policy != affinityCores || info.smt == 0UL )
+         order.push_back( info );
+   }
+
+   if( policy == affinityScatter )
+   {
+      // Ranking the cores within their cache domain
+      std::vector<size_t> rank( order.size() );
+
+      for( size_t i=0UL; i<order.size(); ++i ) {
+         rank[i] = static_cast<size_t>( std::count_if( order.begin(), order.end(),
+            [&]( const CpuTopology& other ) {
+               return other.cache == order[i].cache && other.smt == order[i].smt &&
+                      ( other.package < order[i].package ||
+                        ( other.package == order[i].package && other.core < order[i].core ) );
+            } ) );
+      }
+
+      std::vector<size_t> indices( order.size() );
+      for( size_t i=0UL; i<indices.size(); ++i ) indices[i] = i;
+
+      std::stable_sort( indices.begin(), indices.end(), [&]( size_t a, size_t b ) {
+         if( order[a].smt     != order[b].smt     ) return order[a].smt     < order[b].smt;
+         if( rank[a]          != rank[b]          ) return rank[a]          < rank[b];
+         if( order[a].package != order[b].package ) return order[a].package < order[b].package;
+         return order[a].cache < order[b].cache;
+      } );
+
+      std::vector<CpuTopology> scattered;
+      for( size_t i : indices ) scattered.push_back( order[i] );
+      return scattered;
+   }
+
+   std::stable_sort( order.begin(), order.end(), []( const CpuTopology& a, const CpuTopology& b ) {
+      if( a.package != b.package ) return a.package < b.package;
+      if( a.cache   != b.cache   ) return a.cache   < b.cache;
+      if( a.core    != b.core    ) return a.core    < b.core;
+      return a.smt < b.smt;
+   } );
+
+   return order;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the cached order in which threads are pinned to hardware threads.
+// \ingroup util
+//
+// \param policy The thread affinity policy.
+// \return The topology of the hardware threads in pinning order (empty for \a affinityNone).
+//
+// This function returns the result of getAffinityOrder() for the given policy. The order of
+// every policy is computed only once, i.e. the function can be used on every assignment.
+*/
+inline const std::vector<CpuTopology>& getCachedAffinityOrder( ThreadAffinity policy )
+{
+   static const std::vector<CpuTopology> orders[] = {
+      getAffinityOrder( affinityNone    ),
+      getAffinityOrder( affinityCompact ),
+      getAffinityOrder( affinityScatter ),
+      getAffinityOrder( affinityCores   )
+   };
+
+   return orders[policy];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of cache domains spanned by the given number of pinned threads.
+// \ingroup util
+//
+// \param threads The number of threads.
+// \return The number of cache domains (1 in case the domains cannot be exploited).
+//
+// This function returns the number \a D of last-level cache domains occupied by the given
+// number of threads according to the active thread affinity policy, in case the threads form
+// \a D contiguous groups of equal size (i.e. threads \f$ [k \cdot T/D, (k+1) \cdot T/D) \f$
+// share a cache domain). Otherwise, and in case the threads are not pinned, it returns 1.
+*/
+inline size_t getCacheDomains( size_t threads )
+{
+   const ThreadAffinity policy( getThreadAffinity() );
+
+   if( policy == affinityNone || policy == affinityScatter || threads < 2UL )
+      return 1UL;
+
+   const std::vector<CpuTopology>& order( getCachedAffinityOrder( policy ) );
+
+   if( threads > order.size() )
+      return 1UL;
+
+   size_t domains( 1UL );
+   for( size_t i=1UL; i<threads; ++i ) {
+      if( order[i].cache != order[i-1UL].cache )
+         ++domains;
+   }
+
+   if( threads % domains != 0UL )
+      return 1UL;
+
+   const size_t share( threads / domains );
+   for( size_t i=1UL; i<threads; ++i ) {
+      if( ( order[i].cache != order[i-1UL].cache ) != ( i % share == 0UL ) )
+         return 1UL;
+   }
+
+   return domains;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Pins the given thread according to the active thread affinity policy.
+// \ingroup util
+//
+// \param thread The thread to be pinned (\c std::thread or \c boost::thread).
+// \param index The index of the thread within its thread pool.
+// \return void
+//
+// This function pins the given thread to the hardware thread at position \a index of the
+// pinning order of the active thread affinity policy. For \a affinityNone the thread may run
+// on all available hardware threads. Pinning is only available on Linux; on all other
+// platforms the function has no effect.
+*/
+template< typename TT >  // Type of the thread
+inline void pinThread( TT& thread, size_t index )
+{
+#if defined(__linux__)
+   const std::vector<CpuTopology>& order( getCachedAffinityOrder( getThreadAffinity() ) );
+
+   cpu_set_t mask;
+   CPU_ZERO( &mask );
+
+   if( order.empty() ) {
+      for( const CpuTopology& info : getTopology() )
+         CPU_SET( info.cpu, &mask );
+   }
+   else {
+      CPU_SET( order[index % order.size()].cpu, &mask );
+   }
+
+   pthread_setaffinity_np( thread.native_handle(), sizeof( cpu_set_t ), &mask );
+#else
+   MAYBE_UNUSED( thread, index );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Pins the calling thread according to the active thread affinity policy.
+// \ingroup util
+//
+// \param index The index of the calling thread within its team of threads.
+// \return void
+*/
+inline void pinCurrentThread( size_t index )
+{
+#if defined(__linux__)
+   struct Self {
+      pthread_t native_handle() const { return pthread_self(); }
+   } self;
+
+   pinThread( self, index );
+#else
+   MAYBE_UNUSED( index );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Pins the calling thread in case its pinning does not match the active policy.
+// \ingroup util
+//
+// \param index The index of the calling thread within its team of threads.
+// \return void
+//
+// This function pins the calling thread via pinCurrentThread() unless it has already been
+// pinned to the given index according to the active thread affinity policy. Threads that have
+// never been pinned are left untouched as long as the policy is \a affinityNone. The function
+// enables the lazy pinning of thread teams that are not managed by Blaze (as for instance the
+// OpenMP thread team) at the beginning of every parallel region.
+*/
+inline void updateCurrentThreadAffinity( size_t index )
+{
+   struct Pinning {
+      int policy;    //!< The thread affinity policy the thread has been pinned with.
+      size_t index;  //!< The index the thread has been pinned with.
+   };
+
+   static thread_local Pinning pinning{ affinityNone, 0UL };
+
+   const int policy( threadAffinitySetting().load( std::memory_order_relaxed ) );
+
+   if( pinning.policy == policy && ( policy == affinityNone || pinning.index == index ) )
+      return;
+
+   pinCurrentThread( index );
+   pinning = Pinning{ policy, index };
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
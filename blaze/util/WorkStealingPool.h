@@ -0,0 +1,755 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/WorkStealingPool.h
+//  \brief Header file of the WorkStealingPool class
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_UTIL_WORKSTEALINGPOOL_H_
+#define _BLAZE_UTIL_WORKSTEALINGPOOL_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <exception>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Exception.h>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/threadpool/Task.h>
+#include <blaze/util/threadpool/WorkStealingDeque.h>
+#include <blaze/util/Topology.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Implementation of a work-stealing thread pool.
+// \ingroup threads
+//
+// The WorkStealingPool class template is an alternative to the ThreadPool class template with
+// an identical interface. In contrast to the ThreadPool, which hands out tasks from a single,
+// mutex-protected queue, the WorkStealingPool assigns every worker thread its own lock-free
+// deque (see threadpool::WorkStealingDeque):
+
+   \code
+   template< typename TT, typename MT, typename LT, typename CT >
+   class WorkStealingPool;
+   \endcode
+
+//  - TT: specifies the type of the encapsulated thread. This can for instance be \c std::thread
+//        or \c boost::thread.
+//  - MT: specifies the type of the used synchronization mutex. This can for instance be
+//        \c std::mutex or \c boost::mutex.
+//  - LT: specifies the type of lock used in combination with the given mutex type. This can
+//        for instance be \c std::unique_lock or \c boost::unique_lock.
+//  - CT: specifies the type of the used condition variable. This can for instance be
+//        \c std::condition_variable or \c boost::condition_variable.
+//
+// All tasks scheduled via the schedule() function are collected and started as one batch as
+// soon as the wait() function is called. At that point the batch is split into contiguous
+// ranges of tasks, one range per worker thread. Every worker processes the tasks in its own
+// deque and, as soon as its deque runs empty, steals half of the remaining tasks of another
+// worker. Thus the pool balances uneven workloads (for instance due to slow cores, NUMA effects,
+// or operands with a nonuniform distribution of work) without any central synchronization. The
+// following example demonstrates the use of the WorkStealingPool:
+
+   \code
+   using StdWorkStealingPool = blaze::WorkStealingPool< std::thread
+                                                      , std::mutex
+                                                      , std::unique_lock<std::mutex>
+                                                      , std::condition_variable >;
+
+   StdWorkStealingPool pool( 4 );
+
+   // Scheduling 16 tasks for the 4 worker threads
+   for( size_t i=0UL; i<16UL; ++i )
+      pool.schedule( task, i );
+
+   // Starting and waiting for the completion of all 16 tasks
+   pool.wait();
+   \endcode
+
+// Note that it is not possible to schedule further tasks from within a running task. In case a
+// task throws an exception, all remaining tasks of the batch are still executed and the first
+// exception is rethrown by the wait() function.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+class WorkStealingPool
+   : private NonCopyable
+{
+ private:
+   //**Type definitions****************************************************************************
+   using Task      = threadpool::Task;                       //!< Type of a single task.
+   using Deque     = threadpool::WorkStealingDeque;          //!< Type of the task deques.
+   using Threads   = std::vector< std::unique_ptr<TT> >;     //!< Type of the thread container.
+   using Deques    = std::vector< std::unique_ptr<Deque> >;  //!< Type of the deque container.
+   using Tasks     = std::vector<Task>;                      //!< Type of the task container.
+   using Mutex     = MT;                                     //!< Type of the mutex.
+   using Lock      = LT;                                     //!< Type of a locking object.
+   using Condition = CT;                                     //!< Condition variable type.
+   //**********************************************************************************************
+
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit WorkStealingPool( size_t n );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   ~WorkStealingPool();
+   //@}
+   //**********************************************************************************************
+
+   //**Get functions*******************************************************************************
+   /*!\name Get functions */
+   //@{
+   inline bool   isEmpty() const;
+   inline size_t size()    const;
+   inline size_t active()  const;
+   inline size_t ready()   const;
+   //@}
+   //**********************************************************************************************
+
+   //**Task scheduling*****************************************************************************
+   /*!\name Task scheduling */
+   //@{
+   template< typename Callable, typename... Args >
+   void schedule( Callable func, Args&&... args );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   void resize( size_t n, bool block=false );
+   void wait();
+   void clear();
+   void pin();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Thread functions****************************************************************************
+   /*!\name Thread functions */
+   //@{
+   void  createThreads ( size_t n );
+   void  pinThreads    ();
+   void  destroyThreads( Lock& lock );
+   void  work          ( size_t id, size_t epoch );
+   Task* acquireTask   ( size_t id );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t total_;              //!< Total number of threads in the thread pool.
+   size_t active_;             //!< Number of threads currently working on a batch of tasks.
+   size_t epoch_;              //!< Number of batches started so far.
+   bool terminate_;            //!< Termination flag for all threads in the thread pool.
+   Threads threads_;           //!< The threads contained in the thread pool.
+   Deques deques_;             //!< The task deques of all threads (one per thread).
+   Tasks pending_;             //!< Tasks scheduled for the next batch.
+   Tasks running_;             //!< Tasks of the currently running batch.
+   std::exception_ptr error_;  //!< The first exception thrown by a task of the current batch.
+   mutable Mutex mutex_;       //!< Synchronization mutex.
+   Condition waitForTask_;     //!< Wait condition for idle threads.
+   Condition waitForThread_;   //!< Wait condition for the completion of a batch.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the WorkStealingPool class.
+//
+// \param n Initial number of threads \f$[1..\infty)\f$.
+// \exception std::invalid_argument Invalid number of threads.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+WorkStealingPool<TT,MT,LT,CT>::WorkStealingPool( size_t n )
+   : total_    ( 0UL )    // Total number of threads in the thread pool
+   , active_   ( 0UL )    // Number of threads currently working on a batch of tasks
+   , epoch_    ( 0UL )    // Number of batches started so far
+   , terminate_( false )  // Termination flag for all threads in the thread pool
+   , threads_      ()     // The threads contained in the thread pool
+   , deques_       ()     // The task deques of all threads
+   , pending_      ()     // Tasks scheduled for the next batch
+   , running_      ()     // Tasks of the currently running batch
+   , error_        ()     // The first exception thrown by a task of the current batch
+   , mutex_        ()     // Synchronization mutex
+   , waitForTask_  ()     // Wait condition for idle threads
+   , waitForThread_()     // Wait condition for the completion of a batch
+{
+   resize( n );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Destructor for the WorkStealingPool class.
+//
+// The destructor removes all tasks that have not been started yet, waits for the completion of
+// the currently running batch of tasks and destroys all threads.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+WorkStealingPool<TT,MT,LT,CT>::~WorkStealingPool()
+{
+   Lock lock( mutex_ );
+
+   pending_.clear();
+
+   while( active_ > 0UL ) {
+      waitForThread_.wait( lock );
+   }
+
+   destroyThreads( lock );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether any tasks are scheduled for execution.
+//
+// \return \a true in case task are scheduled, \a false if not.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline bool WorkStealingPool<TT,MT,LT,CT>::isEmpty() const
+{
+   Lock lock( mutex_ );
+   return pending_.empty();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current size of the thread pool.
+//
+// \return The total number of threads in the thread pool.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline size_t WorkStealingPool<TT,MT,LT,CT>::size() const
+{
+   Lock lock( mutex_ );
+   return total_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of currently active/busy threads.
+//
+// \return The number of currently active threads.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline size_t WorkStealingPool<TT,MT,LT,CT>::active() const
+{
+   Lock lock( mutex_ );
+   return active_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of currently ready/inactive threads.
+//
+// \return The number of currently ready threads.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline size_t WorkStealingPool<TT,MT,LT,CT>::ready() const
+{
+   Lock lock( mutex_ );
+   return total_ - active_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SCHEDULING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Scheduling the given function/functor for execution.
+//
+// \param func The given function/functor.
+// \param args The arguments for the function/functor.
+// \return void
+//
+// This function schedules the given function/functor for execution. In contrast to the
+// ThreadPool, the task is not started immediately, but as part of the next batch of tasks,
+// which is started by the next call to the wait() function.
+*/
+template< typename TT         // Type of the encapsulated thread
+        , typename MT         // Type of the synchronization mutex
+        , typename LT         // Type of the mutex lock
+        , typename CT >       // Type of the condition variable
+template< typename Callable   // Type of the function/functor
+        , typename... Args >  // Types of the function/functor arguments
+void WorkStealingPool<TT,MT,LT,CT>::schedule( Callable func, Args&&... args )
+{
+   Lock lock( mutex_ );
+   pending_.push_back( std::bind<void>( func, std::forward<Args>( args )... ) );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Changes the total number of threads in the thread pool.
+//
+// \param n The new number of threads \f$[1..\infty)\f$.
+// \param block \a true in case the function shall block, \a false if not.
+// \return void
+// \exception std::invalid_argument Invalid number of threads.
+//
+// This function changes the size of the thread pool. Since the deques of the worker threads
+// have to be rebuilt, the function waits for the completion of the currently running batch of
+// tasks and for the termination of all removed threads, i.e. it always blocks, independent of
+// the \a block argument.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void WorkStealingPool<TT,MT,LT,CT>::resize( size_t n, bool block )
+{
+   MAYBE_UNUSED( block );
+
+   // Checking the given number of threads
+#if !(defined _MSC_VER)
+   if( n == 0UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of threads" );
+   }
+#endif
+
+   Lock lock( mutex_ );
+
+   while( active_ > 0UL ) {
+      waitForThread_.wait( lock );
+   }
+
+   if( n == total_ )
+      return;
+
+   destroyThreads( lock );
+   createThreads( n );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Starting and waiting for all scheduled tasks to be completed.
+//
+// \return void
+// \exception ... The first exception thrown by a task of the batch.
+//
+// This function distributes all scheduled tasks among the deques of the worker threads, wakes
+// up all threads and blocks until all tasks have been completed. Every worker thread receives
+// a contiguous range of tasks. In case a batch of tasks scheduled by another thread is still
+// running, the function first waits for the completion of that batch. In case any task of the
+// batch has thrown an exception, the first of these exceptions is rethrown after all tasks of
+// the batch have been completed.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void WorkStealingPool<TT,MT,LT,CT>::wait()
+{
+   Lock lock( mutex_ );
+
+   while( active_ > 0UL ) {
+      waitForThread_.wait( lock );
+   }
+
+   if( pending_.empty() || total_ == 0UL )
+      return;
+
+   running_.clear();
+   running_.swap( pending_ );
+
+   // Distributing the tasks among the deques (all worker threads are idle at this point,
+   // therefore it is safe to access the owner end of the deques)
+   const size_t tasks( running_.size() );
+
+   for( size_t t=0UL; t<total_; ++t )
+   {
+      const size_t begin( ( t     *tasks ) / total_ );
+      const size_t end  ( ( (t+1UL)*tasks ) / total_ );
+
+      for( size_t i=end; i>begin; --i ) {
+         deques_[t]->push( &running_[i-1UL] );
+      }
+   }
+
+   // Starting the batch
+   active_ = total_;
+   ++epoch_;
+   waitForTask_.notify_all();
+
+   while( active_ > 0UL ) {
+      waitForThread_.wait( lock );
+   }
+
+   running_.clear();
+
+   if( error_ ) {
+      std::exception_ptr error;
+      std::swap( error, error_ );
+      std::rethrow_exception( error );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removing all scheduled tasks from the thread pool.
+//
+// \return void
+//
+// This function removes all tasks that have been scheduled but not yet started. The currently
+// running batch of tasks is not affected.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void WorkStealingPool<TT,MT,LT,CT>::clear()
+{
+   Lock lock( mutex_ );
+   pending_.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Pinning all threads according to the active thread affinity policy.
+//
+// \return void
+//
+// This function (re-)pins all threads of the thread pool according to the currently active
+// thread affinity policy (see getThreadAffinity()). Threads are pinned automatically on
+// creation, i.e. this function only has to be called after a change of the policy.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void WorkStealingPool<TT,MT,LT,CT>::pin()
+{
+   Lock lock( mutex_ );
+   pinThreads();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  THREAD FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Adding the given number of threads to the (empty) thread pool.
+//
+// \param n The number of threads to be created.
+// \return void
+//
+// This function must only be called while holding the lock on the synchronization mutex.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void WorkStealingPool<TT,MT,LT,CT>::createThreads( size_t n )
+{
+   BLAZE_INTERNAL_ASSERT( threads_.empty() && deques_.empty(), "Non-empty thread pool detected" );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      deques_.push_back( std::unique_ptr<Deque>( new Deque() ) );
+   }
+
+   for( size_t i=0UL; i<n; ++i ) {
+      threads_.push_back( std::unique_ptr<TT>(
+         new TT( std::bind( &WorkStealingPool::work, this, i, epoch_ ) ) ) );
+   }
+
+   total_ = n;
+
+   pinThreads();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Pinning all threads of the thread pool.
+//
+// \return void
+//
+// This function must only be called while holding the lock on the synchronization mutex.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void WorkStealingPool<TT,MT,LT,CT>::pinThreads()
+{
+   for( size_t i=0UL; i<threads_.size(); ++i ) {
+      pinThread( *threads_[i], i );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Terminating and destroying all threads of the thread pool.
+//
+// \param lock The lock on the synchronization mutex.
+// \return void
+//
+// This function must only be called while holding the lock on the synchronization mutex and
+// while no batch of tasks is running. The lock is temporarily released for joining the threads.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void WorkStealingPool<TT,MT,LT,CT>::destroyThreads( Lock& lock )
+{
+   BLAZE_INTERNAL_ASSERT( active_ == 0UL, "Active threads detected" );
+
+   terminate_ = true;
+   waitForTask_.notify_all();
+
+   lock.unlock();
+
+   for( auto const& thread : threads_ ) {
+      thread->join();
+   }
+
+   lock.lock();
+
+   threads_.clear();
+   deques_.clear();
+   total_ = 0UL;
+   terminate_ = false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The main function of every worker thread.
+//
+// \param id The index of the worker thread and its task deque.
+// \param epoch The number of batches started before the creation of the thread.
+// \return void
+//
+// Every worker thread sleeps until a new batch of tasks is started. It then executes tasks
+// until no task is left in any deque and goes back to sleep. Exceptions thrown by the tasks
+// are caught and handed over to the wait() function.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void WorkStealingPool<TT,MT,LT,CT>::work( size_t id, size_t epoch )
+{
+   while( true )
+   {
+      // Waiting for the next batch of tasks
+      {
+         Lock lock( mutex_ );
+
+         while( epoch_ == epoch && !terminate_ ) {
+            waitForTask_.wait( lock );
+         }
+
+         if( terminate_ )
+            return;
+
+         epoch = epoch_;
+      }
+
+      // Executing tasks
+      while( Task* task = acquireTask( id ) )
+      {
+         try {
+            (*task)();
+         }
+         catch( ... ) {
+            Lock lock( mutex_ );
+            if( !error_ ) error_ = std::current_exception();
+         }
+      }
+
+      // Signaling the completion of the work on this batch
+      {
+         Lock lock( mutex_ );
+
+         if( --active_ == 0UL ) {
+            waitForThread_.notify_all();
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Acquiring the next task for the given worker thread.
+//
+// \param id The index of the worker thread.
+// \return The handle to the next task, \a nullptr in case no task is left.
+//
+// This function returns the next task from the deque of the given worker thread. In case the
+// deque is empty, the function tries to steal from the other worker threads, starting with the
+// next neighbor. From the first non-empty deque half of the contained tasks are stolen: one of
+// them is returned, the rest is moved into the deque of the given worker thread.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+typename WorkStealingPool<TT,MT,LT,CT>::Task* WorkStealingPool<TT,MT,LT,CT>::acquireTask( size_t id )
+{
+   Deque& own( *deques_[id] );
+
+   if( Task* task = own.pop() )
+      return task;
+
+   const size_t n( deques_.size() );
+
+   for( size_t i=1UL; i<n; ++i )
+   {
+      Deque& victim( *deques_[(id+i)%n] );
+      bool abort( false );
+
+      do {
+         const size_t half( ( victim.size() + 1UL ) / 2UL );
+
+         if( Task* task = victim.steal( abort ) )
+         {
+            for( size_t j=1UL; j<half; ++j ) {
+               bool failed( false );
+               Task* const additional( victim.steal( failed ) );
+               if( additional == nullptr ) break;
+               own.push( additional );
+            }
+
+            return task;
+         }
+      } while( abort );
+   }
+
+   return nullptr;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,570 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/kerneltrace/KernelTrace.h
+//  \brief Header file for the KernelTrace class and the kernel trace export
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_KERNELTRACE_KERNELTRACE_H_
+#define _BLAZE_UTIL_KERNELTRACE_KERNELTRACE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#if defined(_MSC_VER) && ( defined(_M_X64) || defined(_M_IX86) )
+#  include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#  include <x86intrin.h>
+#endif
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+#include <blaze/util/Exception.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  KERNEL TRACE SETTINGS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Number of kernel trace events per thread.
+// \ingroup util
+//
+// Every thread records its kernel trace events in a ring buffer of this size (which must be a
+// power of two). In case a thread records more events, the oldest events are overwritten.
+*/
+constexpr size_t KERNEL_TRACE_BUFFER_SIZE = 16384UL;
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  KERNEL TRACE EVENTS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief A single event of the kernel trace.
+// \ingroup util
+*/
+struct KernelTraceEvent
+{
+   const char* name;    //!< The name of the traced operation.
+   const char* kernel;  //!< The selected kernel (e.g. "small", "large", "blas", "smp").
+   uint64_t    begin;   //!< The time stamp at the begin of the operation.
+   uint64_t    end;     //!< The time stamp at the end of the operation.
+   size_t      m;       //!< The first dimension of the operation.
+   size_t      n;       //!< The second dimension of the operation.
+   size_t      k;       //!< The third dimension of the operation.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the current time stamp for the kernel trace.
+// \ingroup util
+//
+// \return The current time stamp.
+//
+// On x86 architectures the time stamp is given by the time stamp counter (TSC), which is read
+// in a few cycles. On all other architectures the time stamp is given in nanoseconds of the
+// steady clock.
+*/
+inline uint64_t getKernelTraceTime() noexcept
+{
+#if ( defined(_MSC_VER) && ( defined(_M_X64) || defined(_M_IX86) ) ) || \
+    defined(__x86_64__) || defined(__i386__)
+   return static_cast<uint64_t>( __rdtsc() );
+#else
+   return static_cast<uint64_t>( std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now().time_since_epoch() ).count() );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS KERNELTRACEBUFFER
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Per-thread ring buffer for kernel trace events.
+// \ingroup util
+//
+// The KernelTraceBuffer class stores the kernel trace events of a single thread. Events are
+// only added by the owning thread, which does not require any synchronization except for a
+// single release store. Events can be read by any thread, but only while the owning thread
+// does not record new events.
+*/
+class KernelTraceBuffer
+   : private NonCopyable
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the KernelTraceBuffer class.
+   //
+   // \param thread The index of the owning thread.
+   */
+   explicit inline KernelTraceBuffer( size_t thread )
+      : thread_( thread )                                          // The index of the owning thread
+      , head_  ( 0UL )                                             // The total number of recorded events
+      , tail_  ( 0UL )                                             // The index of the first valid event
+      , events_( new KernelTraceEvent[KERNEL_TRACE_BUFFER_SIZE] )  // The ring buffer of events
+   {}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\brief Returns the index of the owning thread.
+   //
+   // \return The index of the owning thread.
+   */
+   inline size_t thread() const noexcept {
+      return thread_;
+   }
+
+   /*!\brief Adds the given event to the buffer (must only be called by the owning thread).
+   //
+   // \param event The event to be added.
+   // \return void
+   */
+   inline void push( const KernelTraceEvent& event ) noexcept {
+      const size_t head( head_.load( std::memory_order_relaxed ) );
+      events_[head & ( KERNEL_TRACE_BUFFER_SIZE - 1UL )] = event;
+      head_.store( head + 1UL, std::memory_order_release );
+   }
+
+   /*!\brief Appends all valid events of the buffer to the given vector.
+   //
+   // \param events The vector of events.
+   // \return void
+   */
+   inline void copy( std::vector<KernelTraceEvent>& events ) const {
+      const size_t head( head_.load( std::memory_order_acquire ) );
+      const size_t tail( tail_.load( std::memory_order_relaxed ) );
+      const size_t first( std::max( tail, head > KERNEL_TRACE_BUFFER_SIZE ? head - KERNEL_TRACE_BUFFER_SIZE : 0UL ) );
+      for( size_t i=first; i<head; ++i ) {
+         events.push_back( events_[i & ( KERNEL_TRACE_BUFFER_SIZE - 1UL )] );
+      }
+   }
+
+   /*!\brief Discards all events recorded so far.
+   //
+   // \return void
+   */
+   inline void clear() noexcept {
+      tail_.store( head_.load( std::memory_order_acquire ), std::memory_order_relaxed );
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   const size_t thread_;                         //!< The index of the owning thread.
+   std::atomic<size_t> head_;                    //!< The total number of recorded events.
+   std::atomic<size_t> tail_;                    //!< The index of the first valid event.
+   std::unique_ptr<KernelTraceEvent[]> events_;  //!< The ring buffer of events.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS KERNELTRACEREGISTRY
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Registry of the kernel trace buffers of all threads.
+// \ingroup util
+//
+// The KernelTraceRegistry owns the trace buffers of all threads, which therefore outlive the
+// threads, and the reference time stamp used for the conversion of time stamps to microseconds.
+// The buffers of exited threads are kept in a free list and are reused by new threads. Thus the
+// number of buffers is bounded by the maximum number of threads that record kernel traces at
+// the same time.
+*/
+struct KernelTraceRegistry
+{
+   //**Constructor*********************************************************************************
+   /*!\brief Default constructor for the KernelTraceRegistry class.
+   */
+   inline KernelTraceRegistry()
+      : mutex_  ()                                     // Synchronization mutex
+      , buffers_()                                     // The trace buffers of all threads
+      , free_   ()                                     // The trace buffers of exited threads
+      , ticks_  ( getKernelTraceTime() )               // The reference time stamp
+      , time_   ( std::chrono::steady_clock::now() )   // The reference time
+   {}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   std::mutex mutex_;                                           //!< Synchronization mutex.
+   std::vector< std::unique_ptr<KernelTraceBuffer> > buffers_;  //!< The trace buffers of all threads.
+   std::vector<KernelTraceBuffer*> free_;                       //!< The trace buffers of exited threads.
+   const uint64_t ticks_;                                       //!< The reference time stamp.
+   const std::chrono::steady_clock::time_point time_;           //!< The reference time.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the registry of the kernel trace buffers.
+// \ingroup util
+//
+// \return Reference to the kernel trace registry.
+*/
+inline KernelTraceRegistry& getKernelTraceRegistry()
+{
+   static KernelTraceRegistry registry;
+   return registry;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Per-thread owner of a kernel trace buffer.
+// \ingroup util
+//
+// The KernelTraceBufferOwner class acquires a trace buffer from the kernel trace registry on
+// construction, preferably a buffer released by an exited thread, and returns it to the free
+// list of the registry on destruction. The recorded events remain in the buffer until they are
+// overwritten by the next owner, i.e. the events of exited threads are still exported by
+// writeKernelTraces(). Since consecutive owners share the index of the buffer, the thread index
+// in the trace identifies a trace slot rather than a specific thread.
+*/
+class KernelTraceBufferOwner
+   : private NonCopyable
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\brief Default constructor for the KernelTraceBufferOwner class.
+   */
+   inline KernelTraceBufferOwner()
+      : buffer_( nullptr )  // The owned trace buffer
+   {
+      KernelTraceRegistry& registry( getKernelTraceRegistry() );
+      std::lock_guard<std::mutex> lock( registry.mutex_ );
+
+      if( !registry.free_.empty() ) {
+         buffer_ = registry.free_.back();
+         registry.free_.pop_back();
+      }
+      else {
+         registry.buffers_.emplace_back( new KernelTraceBuffer( registry.buffers_.size() ) );
+         buffer_ = registry.buffers_.back().get();
+      }
+   }
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\brief Destructor for the KernelTraceBufferOwner class.
+   */
+   inline ~KernelTraceBufferOwner() {
+      KernelTraceRegistry& registry( getKernelTraceRegistry() );
+      std::lock_guard<std::mutex> lock( registry.mutex_ );
+      registry.free_.push_back( buffer_ );
+   }
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\brief Returns the owned trace buffer.
+   //
+   // \return Reference to the owned trace buffer.
+   */
+   inline KernelTraceBuffer& buffer() const noexcept {
+      return *buffer_;
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   KernelTraceBuffer* buffer_;  //!< The owned trace buffer.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the kernel trace buffer of the calling thread.
+// \ingroup util
+//
+// \return Reference to the kernel trace buffer of the calling thread.
+//
+// The buffer is acquired at the first call of the function by a thread and is released when
+// the thread exits (see KernelTraceBufferOwner).
+*/
+inline KernelTraceBuffer& getKernelTraceBuffer()
+{
+   thread_local KernelTraceBufferOwner owner;
+   return owner.buffer();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS KERNELTRACE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief RAII object for the tracing of computational kernels.
+// \ingroup util
+//
+// The KernelTrace class records the execution of a computational kernel in the trace buffer
+// of the calling thread (see the BLAZE_KERNEL_TRACE macro). In contrast to the FunctionTrace
+// class it neither allocates memory nor performs any output during the execution of the kernel,
+// but only stores the name of the operation, the selected kernel, the operand dimensions, and
+// the time stamps at the begin and end of the kernel.
+*/
+class KernelTrace
+   : private NonCopyable
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the KernelTrace class.
+   //
+   // \param name The name of the traced operation (must be a string literal).
+   // \param kernel The selected kernel (must be a string literal).
+   // \param m The first dimension of the operation.
+   // \param n The second dimension of the operation.
+   // \param k The third dimension of the operation.
+   */
+   inline KernelTrace( const char* name, const char* kernel, size_t m, size_t n, size_t k )
+      : buffer_( getKernelTraceBuffer() )                            // The trace buffer of the calling thread
+      , event_ { name, kernel, getKernelTraceTime(), 0UL, m, n, k }  // The recorded event
+   {}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\brief Destructor for the KernelTrace class.
+   */
+   inline ~KernelTrace() {
+      event_.end = getKernelTraceTime();
+      buffer_.push( event_ );
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   KernelTraceBuffer& buffer_;  //!< The trace buffer of the calling thread.
+   KernelTraceEvent event_;     //!< The recorded event.
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  KERNEL TRACE EXPORT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Writes the given string as JSON string to the given output stream.
+// \ingroup util
+//
+// \param os Reference to the output stream.
+// \param str The string to be written.
+// \return void
+*/
+inline void writeKernelTraceString( std::ostream& os, const char* str )
+{
+   os << '"';
+   for( ; *str != '\0'; ++str ) {
+      if( *str == '"' || *str == '\\' )
+         os << '\\';
+      if( static_cast<unsigned char>( *str ) >= 0x20 )
+         os << *str;
+   }
+   os << '"';
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes all recorded kernel trace events in the Chrome trace event format.
+// \ingroup util
+//
+// \param os Reference to the output stream.
+// \return void
+//
+// This function writes the kernel trace events of all threads as JSON in the Chrome trace
+// event format, which can be displayed via \c chrome://tracing or the Perfetto UI. Every
+// traced kernel results in a complete event (\c "ph":"X") with the name of the operation,
+// the selected kernel as category, the index of the thread, and the operand dimensions as
+// arguments. The function must not be called while traced kernels are executed.
+*/
+inline void writeKernelTraces( std::ostream& os )
+{
+   KernelTraceRegistry& registry( getKernelTraceRegistry() );
+   std::lock_guard<std::mutex> lock( registry.mutex_ );
+
+   // Calibrating the time stamps
+   const uint64_t ticks( getKernelTraceTime() );
+   const double elapsed( std::chrono::duration<double,std::micro>(
+      std::chrono::steady_clock::now() - registry.time_ ).count() );
+   const double ticksPerMicrosecond( ( elapsed > 0.0 && ticks > registry.ticks_ )
+                                     ?( static_cast<double>( ticks - registry.ticks_ ) / elapsed )
+                                     :( 1.0 ) );
+
+   const auto microseconds = [&]( uint64_t stamp ) {
+      return static_cast<double>( static_cast<int64_t>( stamp - registry.ticks_ ) ) / ticksPerMicrosecond;
+   };
+
+   const std::ios_base::fmtflags flags( os.flags() );
+   const std::streamsize precision( os.precision() );
+
+   os << std::fixed << std::setprecision( 3 ) << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+
+   bool first( true );
+   std::vector<KernelTraceEvent> events;
+
+   for( const auto& buffer : registry.buffers_ )
+   {
+      os << ( first ? "\n" : ",\n" )
+         << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << buffer->thread()
+         << ",\"args\":{\"name\":\"Thread " << buffer->thread() << "\"}}";
+      first = false;
+
+      events.clear();
+      buffer->copy( events );
+
+      for( const KernelTraceEvent& event : events ) {
+         os << ",\n{\"name\":";
+         writeKernelTraceString( os, event.name );
+         os << ",\"cat\":";
+         writeKernelTraceString( os, event.kernel );
+         os << ",\"ph\":\"X\",\"pid\":0,\"tid\":" << buffer->thread()
+            << ",\"ts\":" << microseconds( event.begin )
+            << ",\"dur\":" << static_cast<double>( event.end - event.begin ) / ticksPerMicrosecond
+            << ",\"args\":{\"kernel\":";
+         writeKernelTraceString( os, event.kernel );
+         os << ",\"m\":" << event.m << ",\"n\":" << event.n << ",\"k\":" << event.k << "}}";
+      }
+   }
+
+   os << "\n]}\n";
+
+   os.flags( flags );
+   os.precision( precision );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes all recorded kernel trace events in the Chrome trace event format to a file.
+// \ingroup util
+//
+// \param filename The name of the output file.
+// \return void
+// \exception std::runtime_error Output file could not be opened.
+//
+// This function writes the kernel trace events of all threads to the given file (see
+// writeKernelTraces(std::ostream&)).
+*/
+inline void writeKernelTraces( const std::string& filename )
+{
+   std::ofstream os( filename.c_str(), std::ofstream::out | std::ofstream::trunc );
+
+   if( !os ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Error opening kernel trace file" );
+   }
+
+   writeKernelTraces( os );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Discards all kernel trace events recorded so far.
+// \ingroup util
+//
+// \return void
+*/
+inline void clearKernelTraces()
+{
+   KernelTraceRegistry& registry( getKernelTraceRegistry() );
+   std::lock_guard<std::mutex> lock( registry.mutex_ );
+
+   for( const auto& buffer : registry.buffers_ ) {
+      buffer->clear();
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,394 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/serialization/ArchiveBuffer.h
+//  \brief Header file for the ArchiveBuffer class
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_SERIALIZATION_ARCHIVEBUFFER_H_
+#define _BLAZE_UTIL_SERIALIZATION_ARCHIVEBUFFER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstring>
+#include <memory>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Buffer for the bulk transfer of built-in data values to and from an archive.
+// \ingroup serialization
+//
+// The ArchiveBuffer class template collects many small values of built-in data type in an
+// internal buffer and transfers them to or from the underlying Archive in a single bulk \a write
+// or \a read call. In contrast to writing or reading every single value via the archive, this
+// avoids the per-call overhead of the bound stream, which dominates the (de-)serialization of
+// large vectors and matrices. The resulting byte sequence is identical to writing each value
+// directly to the archive.
+//
+// When writing, values are added via the output operator and are written to the archive as
+// soon as the buffer is full or when flush() is called. Note that the buffer is not flushed
+// automatically on destruction:
+
+   \code
+   blaze::Archive<std::ofstream> archive( "data.blaze" );
+   blaze::ArchiveBuffer< blaze::Archive<std::ofstream> > buffer( archive );
+
+   for( size_t i=0UL; i<N; ++i ) {
+      buffer << index[i] << value[i];
+   }
+   buffer.flush();
+   \endcode
+
+// When reading, the buffer must never read beyond the data of the current object, since the
+// following data might belong to a different object. Therefore values are read one by one from
+// the archive, unless the number of bytes that may be read in bulk has been announced via the
+// prefetch() function:
+
+   \code
+   blaze::Archive<std::ifstream> archive( "data.blaze" );
+   blaze::ArchiveBuffer< blaze::Archive<std::ifstream> > buffer( archive );
+
+   buffer.prefetch( N * ( sizeof(size_t) + sizeof(double) ) );
+   for( size_t i=0UL; i<N && ( buffer >> index[i] >> value[i] ); ++i ) {}
+   \endcode
+
+// Values of user-defined data type are always directly (de-)serialized via the archive. A
+// single ArchiveBuffer must be used either for writing or for reading, but not for both.
+*/
+template< typename Archive >  // Type of the archive
+class ArchiveBuffer
+   : private NonCopyable
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline ArchiveBuffer( Archive& archive );
+   //@}
+   //**********************************************************************************************
+
+   //**Operators***********************************************************************************
+   /*!\name Operators */
+   //@{
+   inline operator bool() const;
+   inline bool operator!() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Serialization functions*********************************************************************
+   /*!\name Serialization functions */
+   //@{
+   template< typename T >
+   EnableIf_t< IsNumeric_v<T>, ArchiveBuffer& > operator<<( const T& value );
+
+   template< typename T >
+   DisableIf_t< IsNumeric_v<T>, ArchiveBuffer& > operator<<( const T& value );
+
+   template< typename T >
+   EnableIf_t< IsNumeric_v<T>, ArchiveBuffer& > operator>>( T& value );
+
+   template< typename T >
+   DisableIf_t< IsNumeric_v<T>, ArchiveBuffer& > operator>>( T& value );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline void flush();
+   inline void prefetch( size_t bytes ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**********************************************************************************************
+   static constexpr size_t capacity = 65536UL;  //!< The size of the internal buffer in bytes.
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline bool fill( size_t bytes );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   Archive&                archive_;  //!< Reference to the underlying archive.
+   std::unique_ptr<char[]> buffer_;   //!< The internal buffer.
+   size_t                  begin_;    //!< The first unread byte of the internal buffer.
+   size_t                  end_;      //!< The end of the used part of the internal buffer.
+   size_t                  pending_;  //!< The remaining number of bytes available for prefetching.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creating a buffer for the given archive.
+//
+// \param archive The archive to be written or read.
+*/
+template< typename Archive >  // Type of the archive
+inline ArchiveBuffer<Archive>::ArchiveBuffer( Archive& archive )
+   : archive_( archive )              // Reference to the underlying archive
+   , buffer_ ( new char[capacity] )  // The internal buffer
+   , begin_  ( 0UL )                  // The first unread byte of the internal buffer
+   , end_    ( 0UL )                  // The end of the used part of the internal buffer
+   , pending_( 0UL )                  // The remaining number of bytes available for prefetching
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current state of the underlying archive.
+//
+// \return \a false in case an input/output error has occurred, \a true otherwise.
+*/
+template< typename Archive >  // Type of the archive
+inline ArchiveBuffer<Archive>::operator bool() const
+{
+   return static_cast<bool>( archive_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the negated state of the underlying archive.
+//
+// \return \a true in case an input/output error has occurred, \a false otherwise.
+*/
+template< typename Archive >  // Type of the archive
+inline bool ArchiveBuffer<Archive>::operator!() const
+{
+   return !archive_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SERIALIZATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Adds the given built-in data value to the buffer.
+//
+// \param value The built-in data value to be serialized.
+// \return Reference to the buffer.
+*/
+template< typename Archive >  // Type of the archive
+template< typename T >        // Type of the value to be serialized
+EnableIf_t< IsNumeric_v<T>, ArchiveBuffer<Archive>& > ArchiveBuffer<Archive>::operator<<( const T& value )
+{
+   if( end_ + sizeof( T ) > capacity ) {
+      flush();
+   }
+
+   std::memcpy( buffer_.get() + end_, &value, sizeof( T ) );
+   end_ += sizeof( T );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Serializes the given user-defined object via the underlying archive.
+//
+// \param value The user-defined object to be serialized.
+// \return Reference to the buffer.
+*/
+template< typename Archive >  // Type of the archive
+template< typename T >        // Type of the object to be serialized
+DisableIf_t< IsNumeric_v<T>, ArchiveBuffer<Archive>& > ArchiveBuffer<Archive>::operator<<( const T& value )
+{
+   flush();
+   archive_ << value;
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deserializes a value of built-in data type from the buffer.
+//
+// \param value The built-in data value to be read.
+// \return Reference to the buffer.
+//
+// In case the buffer is empty, it is refilled from the archive with up to the number of bytes
+// announced via prefetch(). If no bytes have been announced, the value is directly read from
+// the archive.
+*/
+template< typename Archive >  // Type of the archive
+template< typename T >        // Type of the value to be deserialized
+EnableIf_t< IsNumeric_v<T>, ArchiveBuffer<Archive>& > ArchiveBuffer<Archive>::operator>>( T& value )
+{
+   if( begin_ + sizeof( T ) > end_ && !fill( sizeof( T ) ) ) {
+      archive_ >> value;
+      return *this;
+   }
+
+   std::memcpy( &value, buffer_.get() + begin_, sizeof( T ) );
+   begin_ += sizeof( T );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deserializes an object of user-defined data type via the underlying archive.
+//
+// \param value The user-defined object to be read.
+// \return Reference to the buffer.
+*/
+template< typename Archive >  // Type of the archive
+template< typename T >        // Type of the value to be deserialized
+DisableIf_t< IsNumeric_v<T>, ArchiveBuffer<Archive>& > ArchiveBuffer<Archive>::operator>>( T& value )
+{
+   archive_ >> value;
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Writes all buffered values to the archive.
+//
+// \return void
+*/
+template< typename Archive >  // Type of the archive
+inline void ArchiveBuffer<Archive>::flush()
+{
+   if( end_ > 0UL ) {
+      archive_.write( buffer_.get(), end_ );
+   }
+
+   end_ = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Announces the number of bytes that can be read from the archive in bulk.
+//
+// \param bytes The number of bytes that exclusively belong to the values to be read next.
+// \return void
+//
+// This function announces that the next \a bytes bytes of the archive consist of built-in data
+// values that will all be read via this buffer. These bytes are subsequently read in chunks of
+// up to 64 KiB. The function must not be called in case any of these bytes belongs to a value
+// of user-defined data type.
+*/
+template< typename Archive >  // Type of the archive
+inline void ArchiveBuffer<Archive>::prefetch( size_t bytes ) noexcept
+{
+   pending_ += bytes;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Refills the buffer from the archive.
+//
+// \param bytes The minimum number of bytes required.
+// \return \a true in case the buffer was refilled, \a false if not enough bytes are announced.
+*/
+template< typename Archive >  // Type of the archive
+inline bool ArchiveBuffer<Archive>::fill( size_t bytes )
+{
+   const size_t remaining( end_ - begin_ );
+
+   if( remaining + pending_ < bytes ) {
+      return false;
+   }
+
+   std::memmove( buffer_.get(), buffer_.get() + begin_, remaining );
+
+   const size_t count( ( pending_ < capacity - remaining )?( pending_ ):( capacity - remaining ) );
+
+   archive_.read( buffer_.get() + remaining, count );
+
+   begin_    = 0UL;
+   end_      = remaining + count;
+   pending_ -= count;
+
+   return static_cast<bool>( archive_ );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,386 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/threadpool/WorkStealingDeque.h
+//  \brief Lock-free work-stealing deque for the work-stealing thread pool
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_UTIL_THREADPOOL_WORKSTEALINGDEQUE_H_
+#define _BLAZE_UTIL_THREADPOOL_WORKSTEALINGDEQUE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <blaze/util/Assert.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/threadpool/Task.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+namespace threadpool {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Lock-free work-stealing deque for the work-stealing thread pool.
+// \ingroup threads
+//
+// The WorkStealingDeque class implements the lock-free, dynamically growing work-stealing deque
+// by Chase and Lev (see D. Chase, Y. Lev: "Dynamic Circular Work-Stealing Deque", SPAA 2005, and
+// N.M. Le et al.: "Correct and Efficient Work-Stealing for Weak Memory Models", PPoPP 2013). The
+// deque stores handles to tasks that are owned by the thread pool. The owning worker thread adds
+// and removes tasks at the bottom of the deque via the push() and pop() functions (LIFO), all
+// other threads remove tasks from the top of the deque via the steal() function (FIFO). Note that
+// only the owning thread is allowed to call push() and pop()!
+*/
+class WorkStealingDeque
+   : private NonCopyable
+{
+ private:
+   //**Buffer class definition*********************************************************************
+   /*!\brief Circular buffer of a work-stealing deque.
+   */
+   struct Buffer
+   {
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the Buffer class.
+      //
+      // \param capacity The capacity of the buffer (must be a power of two).
+      */
+      explicit inline Buffer( ptrdiff_t capacity )
+         : mask_ ( capacity-1L )                              // Mask for the circular indexing
+         , tasks_( new std::atomic<Task*>[capacity] )  // The task handles
+      {}
+      //*******************************************************************************************
+
+      //**Utility functions************************************************************************
+      /*!\brief Returns the capacity of the buffer.
+      //
+      // \return The capacity of the buffer.
+      */
+      inline ptrdiff_t capacity() const noexcept {
+         return mask_+1L;
+      }
+
+      /*!\brief Returns the task handle at the given position.
+      //
+      // \param index The (unbounded) position of the task.
+      // \return The handle to the task.
+      */
+      inline Task* get( ptrdiff_t index ) const noexcept {
+         return tasks_[index & mask_].load( std::memory_order_relaxed );
+      }
+
+      /*!\brief Stores the given task handle at the given position.
+      //
+      // \param index The (unbounded) position of the task.
+      // \param task The handle to the task.
+      // \return void
+      */
+      inline void put( ptrdiff_t index, Task* task ) noexcept {
+         tasks_[index & mask_].store( task, std::memory_order_relaxed );
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      const ptrdiff_t mask_;                          //!< Mask for the circular indexing.
+      std::unique_ptr< std::atomic<Task*>[] > tasks_;  //!< The task handles.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline WorkStealingDeque( size_t capacity = 64UL );
+   //@}
+   //**********************************************************************************************
+
+   //**Get functions*******************************************************************************
+   /*!\name Get functions */
+   //@{
+   inline size_t size   () const noexcept;
+   inline bool   isEmpty() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Element functions***************************************************************************
+   /*!\name Element functions */
+   //@{
+   inline void  push ( Task* task );
+   inline Task* pop  () noexcept;
+   inline Task* steal( bool& abort ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   Buffer* grow( Buffer* buffer, ptrdiff_t top, ptrdiff_t bottom );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::atomic<ptrdiff_t> top_;     //!< Index of the top of the deque (steal end).
+   std::atomic<ptrdiff_t> bottom_;  //!< Index of the bottom of the deque (owner end).
+   std::atomic<Buffer*>   buffer_;  //!< The currently active circular buffer.
+
+   std::vector< std::unique_ptr<Buffer> > buffers_;
+                                    //!< All buffers ever allocated by the deque.
+                                    /*!< Since concurrent thieves might still access a buffer
+                                         after the deque has grown, retired buffers are only
+                                         released on destruction of the deque. */
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for WorkStealingDeque.
+//
+// \param capacity The initial capacity of the deque.
+*/
+inline WorkStealingDeque::WorkStealingDeque( size_t capacity )
+   : top_    ( 0L )       // Index of the top of the deque
+   , bottom_ ( 0L )       // Index of the bottom of the deque
+   , buffer_ ( nullptr )  // The currently active circular buffer
+   , buffers_()           // All buffers ever allocated by the deque
+{
+   ptrdiff_t n( 1L );
+   while( n < static_cast<ptrdiff_t>( capacity ) ) n <<= 1;
+
+   buffers_.emplace_back( new Buffer( n ) );
+   buffer_.store( buffers_.back().get(), std::memory_order_relaxed );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of tasks in the deque.
+//
+// \return The current number of tasks in the deque.
+//
+// Note that in the presence of concurrent stealing threads the returned value is only a
+// snapshot and might already be outdated when the function returns.
+*/
+inline size_t WorkStealingDeque::size() const noexcept
+{
+   const ptrdiff_t bottom( bottom_.load( std::memory_order_relaxed ) );
+   const ptrdiff_t top   ( top_.load( std::memory_order_relaxed ) );
+   return ( bottom > top )?( static_cast<size_t>( bottom - top ) ):( 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the deque is currently empty.
+//
+// \return \a true in case the deque is empty, \a false if not.
+*/
+inline bool WorkStealingDeque::isEmpty() const noexcept
+{
+   return size() == 0UL;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ELEMENT FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Adding a task to the bottom of the deque.
+//
+// \param task The handle to the task to be added.
+// \return void
+//
+// This function must only be called by the owning thread of the deque.
+*/
+inline void WorkStealingDeque::push( Task* task )
+{
+   const ptrdiff_t bottom( bottom_.load( std::memory_order_relaxed ) );
+   const ptrdiff_t top   ( top_.load( std::memory_order_acquire ) );
+   Buffer* buffer( buffer_.load( std::memory_order_relaxed ) );
+
+   if( bottom - top > buffer->capacity() - 1L ) {
+      buffer = grow( buffer, top, bottom );
+   }
+
+   buffer->put( bottom, task );
+   std::atomic_thread_fence( std::memory_order_release );
+   bottom_.store( bottom+1L, std::memory_order_relaxed );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removing a task from the bottom of the deque.
+//
+// \return The handle to the removed task, \a nullptr in case the deque is empty.
+//
+// This function must only be called by the owning thread of the deque.
+*/
+inline Task* WorkStealingDeque::pop() noexcept
+{
+   const ptrdiff_t bottom( bottom_.load( std::memory_order_relaxed ) - 1L );
+   Buffer* buffer( buffer_.load( std::memory_order_relaxed ) );
+   bottom_.store( bottom, std::memory_order_relaxed );
+   std::atomic_thread_fence( std::memory_order_seq_cst );
+   ptrdiff_t top( top_.load( std::memory_order_relaxed ) );
+
+   Task* task( nullptr );
+
+   if( top <= bottom ) {
+      task = buffer->get( bottom );
+      if( top == bottom ) {
+         if( !top_.compare_exchange_strong( top, top+1L, std::memory_order_seq_cst,
+                                                          std::memory_order_relaxed ) ) {
+            task = nullptr;
+         }
+         bottom_.store( bottom+1L, std::memory_order_relaxed );
+      }
+   }
+   else {
+      bottom_.store( bottom+1L, std::memory_order_relaxed );
+   }
+
+   return task;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removing a task from the top of the deque.
+//
+// \param abort Set to \a true in case the attempt failed due to a concurrent access.
+// \return The handle to the removed task, \a nullptr in case no task could be removed.
+//
+// This function can be called by any thread. In case the function returns \a nullptr and
+// \a abort is set to \a true, the deque was not empty but the task was taken by a concurrent
+// thread. In that case the caller may retry the attempt.
+*/
+inline Task* WorkStealingDeque::steal( bool& abort ) noexcept
+{
+   ptrdiff_t top( top_.load( std::memory_order_acquire ) );
+   std::atomic_thread_fence( std::memory_order_seq_cst );
+   const ptrdiff_t bottom( bottom_.load( std::memory_order_acquire ) );
+
+   abort = false;
+
+   if( top < bottom ) {
+      Buffer* buffer( buffer_.load( std::memory_order_acquire ) );
+      Task* task( buffer->get( top ) );
+      if( !top_.compare_exchange_strong( top, top+1L, std::memory_order_seq_cst,
+                                                      std::memory_order_relaxed ) ) {
+         abort = true;
+         return nullptr;
+      }
+      return task;
+   }
+
+   return nullptr;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Doubling the capacity of the deque.
+//
+// \param buffer The currently active buffer.
+// \param top The current index of the top of the deque.
+// \param bottom The current index of the bottom of the deque.
+// \return The new active buffer.
+*/
+inline WorkStealingDeque::Buffer*
+   WorkStealingDeque::grow( Buffer* buffer, ptrdiff_t top, ptrdiff_t bottom )
+{
+   buffers_.emplace_back( new Buffer( 2L*buffer->capacity() ) );
+   Buffer* const newBuffer( buffers_.back().get() );
+
+   for( ptrdiff_t i=top; i<bottom; ++i ) {
+      newBuffer->put( i, buffer->get( i ) );
+   }
+
+   buffer_.store( newBuffer, std::memory_order_release );
+
+   return newBuffer;
+}
+//*************************************************************************************************
+
+} // namespace threadpool
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,522 @@
+//=================================================================================================
+/*!
+//  \file src/main/Autotune.cpp
+//  \brief Source file for the Blaze threshold autotuner
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#ifndef BLAZE_USE_RUNTIME_THRESHOLDS
+#  define BLAZE_USE_RUNTIME_THRESHOLDS 1
+#endif
+
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/SMP.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Random.h>
+#include <blaze/util/Time.h>
+#include <blaze/util/Timing.h>
+#include <blazemark/blaze/init/DynamicMatrix.h>
+#include <blazemark/blaze/init/DynamicVector.h>
+#include <blazemark/system/Config.h>
+#include <blazemark/system/Types.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+#if !BLAZE_USE_RUNTIME_THRESHOLDS
+#  error "The autotuner requires runtime-tunable thresholds (BLAZE_USE_RUNTIME_THRESHOLDS=1)"
+#endif
+
+
+
+
+//=================================================================================================
+//
+//  TYPE DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Description of a single threshold to be tuned.
+//
+// The benchmark function returns the runtime of a single execution of the operation for the
+// given problem size, measured with the current threshold settings. The unit function converts
+// the problem size to the quantity compared against the threshold (e.g. the number of elements
+// of the target matrix).
+*/
+struct Case
+{
+   std::string                    name;       //!< The name of the threshold.
+   std::string                    operation;  //!< Description of the benchmarked operation.
+   std::vector<size_t>            sizes;      //!< The problem sizes to measure.
+   std::function<size_t(size_t)>  unit;       //!< Conversion from problem size to threshold unit.
+   std::function<double(size_t)>  benchmark;  //!< The benchmark for a single problem size.
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTANTS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Threshold value to unconditionally disable a kernel or the parallel execution.
+*/
+constexpr size_t never = std::numeric_limits<size_t>::max();
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Minimum runtime of a single measurement [s].
+*/
+constexpr double mintime = 0.01;
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns a geometric sequence of problem sizes.
+//
+// \param first The first problem size.
+// \param last The upper bound for the problem sizes.
+// \param factor The growth factor between two consecutive problem sizes.
+// \return The sequence of problem sizes.
+*/
+std::vector<size_t> geometric( size_t first, size_t last, double factor )
+{
+   std::vector<size_t> sizes;
+
+   for( double size=first; size<=last; size*=factor ) {
+      const size_t N( static_cast<size_t>( std::round( size ) ) );
+      if( sizes.empty() || sizes.back() != N )
+         sizes.push_back( N );
+   }
+
+   return sizes;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the runtime of a single execution of the given operation.
+//
+// \param op The operation to be measured.
+// \return Minimum runtime of a single execution of the operation [s].
+//
+// The number of executions per measurement is increased until a single measurement takes at
+// least \a mintime seconds. The result is the minimum over \a blazemark::reps measurements.
+*/
+template< typename OP >
+double measure( OP op )
+{
+   size_t steps( 1UL );
+
+   op();
+
+   while( true ) {
+      blaze::timing::WcTimer timer;
+      timer.start();
+      for( size_t step=0UL; step<steps; ++step ) {
+         op();
+      }
+      timer.end();
+      if( timer.last() >= mintime ) break;
+      steps *= 2UL;
+   }
+
+   blaze::timing::WcTimer timer;
+
+   for( size_t rep=0UL; rep<blazemark::reps; ++rep ) {
+      timer.start();
+      for( size_t step=0UL; step<steps; ++step ) {
+         op();
+      }
+      timer.end();
+   }
+
+   return timer.min() / steps;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Benchmark for a dense vector operation.
+//
+// \param op The operation, called with the two operand vectors and the target vector.
+// \return The benchmark function for the operation.
+*/
+template< typename OP >
+std::function<double(size_t)> vectorBenchmark( OP op )
+{
+   return [op]( size_t N ) -> double
+   {
+      using blazemark::element_t;
+
+      blaze::setSeed( blazemark::seed );
+
+      blaze::DynamicVector<element_t,blaze::columnVector> a( N ), b( N ), c( N );
+
+      blazemark::blaze::init( a );
+      blazemark::blaze::init( b );
+
+      return measure( [&]() { op( a, b, c ); } );
+   };
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Benchmark for a dense matrix operation.
+//
+// \param op The operation, called with the two operand matrices and the target matrix.
+// \return The benchmark function for the operation.
+*/
+template< bool SO1, bool SO2, typename OP >
+std::function<double(size_t)> matrixBenchmark( OP op )
+{
+   return [op]( size_t N ) -> double
+   {
+      using blazemark::element_t;
+
+      blaze::setSeed( blazemark::seed );
+
+      blaze::DynamicMatrix<element_t,SO1> A( N, N );
+      blaze::DynamicMatrix<element_t,SO2> B( N, N );
+      blaze::DynamicMatrix<element_t,blaze::rowMajor> C( N, N );
+
+      blazemark::blaze::init( A );
+      blazemark::blaze::init( B );
+
+      return measure( [&]() { op( A, B, C ); } );
+   };
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Benchmark for a dense matrix/dense vector operation.
+//
+// \param op The operation, called with the matrix, the operand vector and the target vector.
+// \return The benchmark function for the operation.
+*/
+template< bool SO, bool TF, typename OP >
+std::function<double(size_t)> matrixVectorBenchmark( OP op )
+{
+   return [op]( size_t N ) -> double
+   {
+      using blazemark::element_t;
+
+      blaze::setSeed( blazemark::seed );
+
+      blaze::DynamicMatrix<element_t,SO> A( N, N );
+      blaze::DynamicVector<element_t,TF> x( N ), y( N );
+
+      blazemark::blaze::init( A );
+      blazemark::blaze::init( x );
+
+      return measure( [&]() { op( A, x, y ); } );
+   };
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Determines the crossover of the given threshold.
+//
+// \param c The threshold to be tuned.
+// \return The measured crossover.
+//
+// For every problem size the operation is measured once with the threshold disabled and once
+// with the threshold set to its minimum. The crossover is the first problem size for which the
+// latter variant is faster for two consecutive problem sizes. In case no crossover is found,
+// the upper bound of the measured range is returned.
+*/
+size_t tune( const Case& c )
+{
+   const size_t minimum( c.name.compare( 0UL, 4UL, "SMP_" ) == 0 ? 0UL : 1UL );
+
+   std::cout << "   " << c.operation << " (" << c.name << ")\n";
+
+   size_t crossover( never );
+   size_t wins( 0UL );
+
+   for( size_t N : c.sizes )
+   {
+      blaze::setThreshold( c.name, never );
+      const double below( c.benchmark( N ) );
+
+      blaze::setThreshold( c.name, minimum );
+      const double above( c.benchmark( N ) );
+
+      std::cout << "      N=" << std::setw(8) << N
+                << "   below: " << std::setw(12) << below*1E6 << " us"
+                << "   above: " << std::setw(12) << above*1E6 << " us"
+                << "   speedup: " << std::setw(6) << below/above << "\n";
+
+      if( above < below ) {
+         if( wins++ == 0UL ) crossover = c.unit( N );
+         if( wins == 2UL ) break;
+      }
+      else {
+         wins = 0UL;
+         crossover = never;
+      }
+   }
+
+   if( crossover == never ) {
+      crossover = c.unit( c.sizes.back() );
+      std::cout << "      No crossover found, using the upper bound " << crossover << "\n\n";
+   }
+   else {
+      std::cout << "      Crossover: " << crossover << "\n\n";
+   }
+
+   return crossover;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TUNING CASES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the kernel thresholds to be tuned.
+//
+// \return The kernel threshold cases.
+//
+// The kernel thresholds select between the kernels for small matrices and the BLAS or
+// vectorized kernels for large matrices. They are measured single-threaded.
+*/
+std::vector<Case> kernelCases()
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+   using blaze::columnVector;
+   using blaze::rowVector;
+
+   const auto square = []( size_t N ) { return N*N; };
+   const auto mmult  = []( auto& A, auto& B, auto& C ) { C = A * B; };
+   const auto mvmult = []( auto& A, auto& x, auto& y ) { y = A * x; };
+   const auto vmmult = []( auto& A, auto& x, auto& y ) { y = x * A; };
+
+   const std::vector<size_t> mmsizes( geometric( 32UL, 724UL, 1.189207 ) );
+   const std::vector<size_t> mvsizes( geometric( 32UL, 2896UL, 1.414214 ) );
+
+   return {
+      { "DMATDVECMULT_THRESHOLD"  , "y = A * x"         , mvsizes, square, matrixVectorBenchmark<rowMajor   ,columnVector>( mvmult ) },
+      { "TDMATDVECMULT_THRESHOLD" , "y = A * x (A^T)"   , mvsizes, square, matrixVectorBenchmark<columnMajor,columnVector>( mvmult ) },
+      { "TDVECDMATMULT_THRESHOLD" , "y^T = x^T * A"     , mvsizes, square, matrixVectorBenchmark<rowMajor   ,rowVector   >( vmmult ) },
+      { "TDVECTDMATMULT_THRESHOLD", "y^T = x^T * A^T"   , mvsizes, square, matrixVectorBenchmark<columnMajor,rowVector   >( vmmult ) },
+      { "DMATDMATMULT_THRESHOLD"  , "C = A * B"         , mmsizes, square, matrixBenchmark<rowMajor   ,rowMajor   >( mmult ) },
+      { "DMATTDMATMULT_THRESHOLD" , "C = A * B^T"       , mmsizes, square, matrixBenchmark<rowMajor   ,columnMajor>( mmult ) },
+      { "TDMATDMATMULT_THRESHOLD" , "C = A^T * B"       , mmsizes, square, matrixBenchmark<columnMajor,rowMajor   >( mmult ) },
+      { "TDMATTDMATMULT_THRESHOLD", "C = A^T * B^T"     , mmsizes, square, matrixBenchmark<columnMajor,columnMajor>( mmult ) }
+   };
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the SMP thresholds to be tuned.
+//
+// \return The SMP threshold cases.
+//
+// The SMP thresholds select between the single-threaded and the parallel execution. While
+// an SMP threshold is tuned, all other SMP thresholds are disabled.
+*/
+std::vector<Case> smpCases()
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+   using blaze::columnVector;
+   using blaze::rowVector;
+
+   const auto identity = []( size_t N ) { return N; };
+   const auto square   = []( size_t N ) { return N*N; };
+   const auto mmult    = []( auto& A, auto& B, auto& C ) { C = A * B; };
+   const auto mvmult   = []( auto& A, auto& x, auto& y ) { y = A * x; };
+   const auto vmmult   = []( auto& A, auto& x, auto& y ) { y = x * A; };
+
+   const std::vector<size_t> vsizes ( geometric( 1000UL, 8192000UL, 2.0 ) );
+   const std::vector<size_t> msizes ( geometric( 16UL, 2896UL, 1.414214 ) );
+   const std::vector<size_t> mvsizes( geometric( 16UL, 4096UL, 1.414214 ) );
+   const std::vector<size_t> mmsizes( geometric( 8UL, 512UL, 1.414214 ) );
+
+   return {
+      { "SMP_DVECASSIGN_THRESHOLD"     , "c = a"             , vsizes , identity, vectorBenchmark( []( auto& a, auto&  , auto& c ) { c = a; } ) },
+      { "SMP_DVECSCALARMULT_THRESHOLD" , "c = a * s"         , vsizes , identity, vectorBenchmark( []( auto& a, auto&  , auto& c ) { c = a * 2.1; } ) },
+      { "SMP_DVECDVECADD_THRESHOLD"    , "c = a + b"         , vsizes , identity, vectorBenchmark( []( auto& a, auto& b, auto& c ) { c = a + b; } ) },
+      { "SMP_DVECDVECSUB_THRESHOLD"    , "c = a - b"         , vsizes , identity, vectorBenchmark( []( auto& a, auto& b, auto& c ) { c = a - b; } ) },
+      { "SMP_DVECDVECMULT_THRESHOLD"   , "c = a * b"         , vsizes , identity, vectorBenchmark( []( auto& a, auto& b, auto& c ) { c = a * b; } ) },
+      { "SMP_DVECDVECINNER_THRESHOLD"  , "c[0] = a^T * b"    , vsizes , identity, vectorBenchmark( []( auto& a, auto& b, auto& c ) { c[0] = dot( a, b ); } ) },
+      { "SMP_DVECREDUCE_THRESHOLD"     , "c[0] = sum( a )"   , vsizes , identity, vectorBenchmark( []( auto& a, auto&  , auto& c ) { c[0] = sum( a ); } ) },
+      { "SMP_DMATASSIGN_THRESHOLD"     , "C = A"             , msizes , square  , matrixBenchmark<rowMajor,rowMajor>( []( auto& A, auto&  , auto& C ) { C = A; } ) },
+      { "SMP_DMATSCALARMULT_THRESHOLD" , "C = A * s"         , msizes , square  , matrixBenchmark<rowMajor,rowMajor>( []( auto& A, auto&  , auto& C ) { C = A * 2.1; } ) },
+      { "SMP_DMATDMATADD_THRESHOLD"    , "C = A + B"         , msizes , square  , matrixBenchmark<rowMajor,rowMajor>( []( auto& A, auto& B, auto& C ) { C = A + B; } ) },
+      { "SMP_DMATDMATSUB_THRESHOLD"    , "C = A - B"         , msizes , square  , matrixBenchmark<rowMajor,rowMajor>( []( auto& A, auto& B, auto& C ) { C = A - B; } ) },
+      { "SMP_DMATDMATSCHUR_THRESHOLD"  , "C = A % B"         , msizes , square  , matrixBenchmark<rowMajor,rowMajor>( []( auto& A, auto& B, auto& C ) { C = A % B; } ) },
+      { "SMP_DMATTOTALREDUCE_THRESHOLD", "C(0,0) = sum( A )" , msizes , square  , matrixBenchmark<rowMajor,rowMajor>( []( auto& A, auto&  , auto& C ) { C(0,0) = sum( A ); } ) },
+      { "SMP_DMATDVECMULT_THRESHOLD"   , "y = A * x"         , mvsizes, identity, matrixVectorBenchmark<rowMajor   ,columnVector>( mvmult ) },
+      { "SMP_TDMATDVECMULT_THRESHOLD"  , "y = A^T * x"       , mvsizes, identity, matrixVectorBenchmark<columnMajor,columnVector>( mvmult ) },
+      { "SMP_TDVECDMATMULT_THRESHOLD"  , "y^T = x^T * A"     , mvsizes, identity, matrixVectorBenchmark<rowMajor   ,rowVector   >( vmmult ) },
+      { "SMP_TDVECTDMATMULT_THRESHOLD" , "y^T = x^T * A^T"   , mvsizes, identity, matrixVectorBenchmark<columnMajor,rowVector   >( vmmult ) },
+      { "SMP_DMATDMATMULT_THRESHOLD"   , "C = A * B"         , mmsizes, square  , matrixBenchmark<rowMajor   ,rowMajor   >( mmult ) },
+      { "SMP_DMATTDMATMULT_THRESHOLD"  , "C = A * B^T"       , mmsizes, square  , matrixBenchmark<rowMajor   ,columnMajor>( mmult ) },
+      { "SMP_TDMATDMATMULT_THRESHOLD"  , "C = A^T * B"       , mmsizes, square  , matrixBenchmark<columnMajor,rowMajor   >( mmult ) },
+      { "SMP_TDMATTDMATMULT_THRESHOLD" , "C = A^T * B^T"     , mmsizes, square  , matrixBenchmark<columnMajor,columnMajor>( mmult ) }
+   };
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The main function for the Blaze threshold autotuner.
+//
+// \param argc Number of command line arguments.
+// \param argv Array of command line arguments.
+// \return Success code for the execution.
+//
+// The autotuner measures the crossovers of the kernel and SMP thresholds on the host system
+// and writes the resulting tuning table to the given file. The tuning table can be loaded via
+// blaze::loadThresholds() or the \c BLAZE_THRESHOLDS environment variable by any application
+// that is compiled with runtime-tunable thresholds (see BLAZE_USE_RUNTIME_THRESHOLDS). The
+// SMP thresholds are only tuned in case more than one thread is available; otherwise they
+// retain their default values.
+*/
+int main( int argc, char** argv )
+{
+   if( argc > 2 ) {
+      std::cerr << " Invalid use of program 'Autotune'!\n"
+                << "   Use: ./autotune [<tuning_table>]\n" << std::endl;
+      return EXIT_FAILURE;
+   }
+
+   const std::string filename( argc == 2 ? argv[1] : "thresholds.txt" );
+   const size_t threads( blaze::getNumThreads() );
+
+   std::cout << "\n Blaze threshold autotuner (" << threads << " thread(s)):\n\n";
+
+   try {
+      for( const Case& c : kernelCases() ) {
+         blaze::setThreshold( c.name, tune( c ) );
+      }
+
+      if( threads > 1UL )
+      {
+         std::map<std::string,size_t> crossovers;
+
+         for( const blaze::RuntimeThreshold& entry : blaze::RuntimeThresholdTable<>::entries ) {
+            if( std::string( entry.name ).compare( 0UL, 4UL, "SMP_" ) == 0 )
+               blaze::setThreshold( entry.name, never );
+         }
+
+         for( const Case& c : smpCases() ) {
+            const size_t crossover( tune( c ) );
+            crossovers[c.name] = crossover;
+            blaze::setThreshold( c.name, never );
+         }
+
+         for( const blaze::RuntimeThreshold& entry : blaze::RuntimeThresholdTable<>::entries ) {
+            if( std::string( entry.name ).compare( 0UL, 4UL, "SMP_" ) == 0 )
+               blaze::setThreshold( entry.name, entry.defaultValue );
+         }
+
+         for( const auto& crossover : crossovers ) {
+            blaze::setThreshold( crossover.first, crossover.second );
+         }
+      }
+      else {
+         std::cout << "   Single thread: skipping the SMP thresholds\n\n";
+      }
+
+      std::ofstream file( filename );
+
+      if( !file ) {
+         throw std::runtime_error( "Tuning table could not be opened" );
+      }
+
+      file << "# Blaze tuning table\n"
+           << "# Generated by the Blazemark autotuner on " << blaze::getTime()
+           << " using " << threads << " thread(s)\n";
+      blaze::writeThresholds( file );
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "   Error during autotuning: " << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   std::cout << " Tuning table written to '" << filename << "'\n" << std::endl;
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
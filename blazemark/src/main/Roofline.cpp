@@ -0,0 +1,1062 @@
+//=================================================================================================
+/*!
+//  \file src/main/Roofline.cpp
+//  \brief Source file for the Blaze roofline benchmark
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#if defined(__linux__)
+#  include <linux/perf_event.h>
+#  include <sys/ioctl.h>
+#  include <sys/syscall.h>
+#  include <unistd.h>
+#endif
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/SMP.h>
+#include <blaze/system/CacheSize.h>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/policies/Deallocate.h>
+#include <blaze/util/Random.h>
+#include <blaze/util/Time.h>
+#include <blaze/util/Timing.h>
+#include <blazemark/blaze/init/DynamicMatrix.h>
+#include <blazemark/blaze/init/DynamicVector.h>
+#include <blazemark/system/Config.h>
+#include <blazemark/system/Types.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+
+
+//=================================================================================================
+//
+//  TYPE DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Hardware counter values of a single kernel execution.
+*/
+struct Counters
+{
+   bool   valid        = false;  //!< Indicates whether the counter values are available.
+   double cycles       = 0.0;    //!< Number of CPU cycles.
+   double instructions = 0.0;    //!< Number of retired instructions.
+   double misses       = 0.0;    //!< Number of last-level cache misses.
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The result of a single measurement.
+*/
+struct Measurement
+{
+   double   time;      //!< Minimum runtime of a single execution [s].
+   Counters counters;  //!< Hardware counter values of a single execution.
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Description of a single benchmarked kernel.
+//
+// The flop and byte counts describe a single execution of the kernel. The byte count is the
+// compulsory memory traffic, i.e. every operand is read and every target is written exactly
+// once (the write-allocate traffic is not counted, in accordance with the STREAM benchmark).
+*/
+struct Kernel
+{
+   std::string                     name;       //!< The name of the kernel.
+   std::string                     operation;  //!< Description of the benchmarked operation.
+   size_t                          size;       //!< The problem size.
+   double                          flops;      //!< Floating point operations per execution.
+   double                          bytes;      //!< Compulsory memory traffic per execution.
+   std::function<Measurement()>    benchmark;  //!< The benchmark of the kernel.
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The measured performance characteristics of the host system.
+*/
+struct Machine
+{
+   size_t threads;  //!< The number of threads.
+   double peak;     //!< Peak floating point throughput [GFlop/s].
+   double copy;     //!< STREAM copy bandwidth [GB/s].
+   double scale;    //!< STREAM scale bandwidth [GB/s].
+   double add;      //!< STREAM add bandwidth [GB/s].
+   double triad;    //!< STREAM triad bandwidth [GB/s].
+
+   //! Returns the bandwidth ceiling of the roofline model [GB/s].
+   double bandwidth() const { return std::max( std::max( copy, scale ), std::max( add, triad ) ); }
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The measured performance of a single kernel.
+*/
+struct Result
+{
+   std::string name;       //!< The name of the kernel.
+   std::string operation;  //!< Description of the benchmarked operation.
+   size_t      size;       //!< The problem size.
+   double      flops;      //!< Floating point operations per execution.
+   double      bytes;      //!< Compulsory memory traffic per execution.
+   double      time;       //!< Runtime of a single execution [s].
+   double      gflops;     //!< Achieved floating point throughput [GFlop/s].
+   double      gbytes;     //!< Achieved bandwidth [GB/s].
+   double      intensity;  //!< Arithmetic intensity [Flop/Byte].
+   double      roof;       //!< Fraction of the attainable performance.
+   Counters    counters;   //!< Hardware counter values of a single execution.
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTANTS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Minimum runtime of a single measurement [s].
+*/
+constexpr double mintime = 0.05;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Number of iterations of the peak throughput kernel per execution.
+*/
+constexpr size_t fmaIterations = 1UL << 20;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Number of independent FMA chains of the peak throughput kernel.
+//
+// The number of chains has to cover the latency of the FMA units times the number of FMA
+// units per core in order to saturate the floating point pipelines.
+*/
+constexpr size_t fmaChains = 12UL;
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS PERFCOUNTERS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Hardware performance counters via the Linux \c perf_event_open() interface.
+//
+// The PerfCounters class measures the number of CPU cycles, retired instructions, and last-level
+// cache misses of the process. The counters include all threads that are created after the
+// counters have been opened. In case the counters are not available (e.g. on non-Linux systems,
+// in containers, or due to the \c perf_event_paranoid setting), available() returns \a false
+// and all measurements are invalid.
+*/
+class PerfCounters
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\brief Opens the hardware performance counters.
+   */
+   PerfCounters()
+      : fds_{ -1, -1, -1 }  // The file descriptors of the counters
+   {
+#if defined(__linux__)
+      const uint64_t configs[3] = { PERF_COUNT_HW_CPU_CYCLES,
+                                    PERF_COUNT_HW_INSTRUCTIONS,
+                                    PERF_COUNT_HW_CACHE_MISSES };
+
+      for( size_t i=0UL; i<3UL; ++i )
+      {
+         perf_event_attr attr{};
+         attr.type           = PERF_TYPE_HARDWARE;
+         attr.size           = sizeof( perf_event_attr );
+         attr.config         = configs[i];
+         attr.disabled       = 1;
+         attr.inherit        = 1;
+         attr.exclude_kernel = 1;
+         attr.exclude_hv     = 1;
+
+         fds_[i] = static_cast<int>( syscall( __NR_perf_event_open, &attr, 0, -1, -1, 0 ) );
+
+         if( fds_[i] < 0 ) {
+            close();
+            break;
+         }
+      }
+#endif
+   }
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\brief Closes the hardware performance counters.
+   */
+   ~PerfCounters()
+   {
+      close();
+   }
+   //**********************************************************************************************
+
+   PerfCounters( const PerfCounters& ) = delete;
+   PerfCounters& operator=( const PerfCounters& ) = delete;
+
+   //**Utility functions***************************************************************************
+   /*!\brief Returns whether the hardware performance counters are available.
+   //
+   // \return \a true in case the counters are available, \a false if not.
+   */
+   bool available() const
+   {
+      return fds_[0] >= 0;
+   }
+
+   /*!\brief Resets and starts the hardware performance counters.
+   */
+   void start()
+   {
+#if defined(__linux__)
+      for( int fd : fds_ ) {
+         if( fd >= 0 ) {
+            ioctl( fd, PERF_EVENT_IOC_RESET, 0 );
+            ioctl( fd, PERF_EVENT_IOC_ENABLE, 0 );
+         }
+      }
+#endif
+   }
+
+   /*!\brief Stops the hardware performance counters.
+   //
+   // \param executions The number of kernel executions since the last call to start().
+   // \return The counter values of a single kernel execution.
+   */
+   Counters stop( size_t executions )
+   {
+      Counters counters;
+
+#if defined(__linux__)
+      if( !available() )
+         return counters;
+
+      uint64_t values[3] = { 0UL, 0UL, 0UL };
+
+      for( size_t i=0UL; i<3UL; ++i ) {
+         ioctl( fds_[i], PERF_EVENT_IOC_DISABLE, 0 );
+         if( ::read( fds_[i], &values[i], sizeof( uint64_t ) ) != sizeof( uint64_t ) )
+            return counters;
+      }
+
+      counters.valid        = true;
+      counters.cycles       = static_cast<double>( values[0] ) / executions;
+      counters.instructions = static_cast<double>( values[1] ) / executions;
+      counters.misses       = static_cast<double>( values[2] ) / executions;
+#else
+      MAYBE_UNUSED( executions );
+#endif
+
+      return counters;
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\brief Closes all open file descriptors.
+   */
+   void close()
+   {
+#if defined(__linux__)
+      for( int& fd : fds_ ) {
+         if( fd >= 0 ) ::close( fd );
+         fd = -1;
+      }
+#endif
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   int fds_[3];  //!< The file descriptors of the cycle, instruction, and cache miss counters.
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the runtime of a single execution of the given operation.
+//
+// \param op The operation to be measured.
+// \param perf The hardware performance counters (may be \a nullptr).
+// \return The minimum runtime and the counter values of a single execution of the operation.
+//
+// The number of executions per measurement is increased until a single measurement takes at
+// least \a mintime seconds. The runtime is the minimum over \a blazemark::reps measurements,
+// the counter values are averaged over all measurements.
+*/
+template< typename OP >
+Measurement measure( OP op, PerfCounters* perf )
+{
+   size_t steps( 1UL );
+
+   op();
+
+   while( true ) {
+      blaze::timing::WcTimer timer;
+      timer.start();
+      for( size_t step=0UL; step<steps; ++step ) {
+         op();
+      }
+      timer.end();
+      if( timer.last() >= mintime ) break;
+      steps *= 2UL;
+   }
+
+   blaze::timing::WcTimer timer;
+
+   if( perf ) perf->start();
+
+   for( size_t rep=0UL; rep<blazemark::reps; ++rep ) {
+      timer.start();
+      for( size_t step=0UL; step<steps; ++step ) {
+         op();
+      }
+      timer.end();
+   }
+
+   Measurement m{ timer.min() / steps, Counters() };
+
+   if( perf ) m.counters = perf->stop( steps * blazemark::reps );
+
+   return m;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Executes the given function in parallel on the given number of threads.
+//
+// \param threads The number of threads.
+// \param N The total number of elements.
+// \param granularity The granularity of the index ranges of the threads.
+// \param f The function, called with the index range of each thread.
+// \return void
+*/
+template< typename F >
+void parallel( size_t threads, size_t N, size_t granularity, F f )
+{
+   const size_t blocks( N / granularity );
+
+   std::vector<std::thread> pool;
+   pool.reserve( threads );
+
+   for( size_t t=0UL; t<threads; ++t ) {
+      const size_t begin( granularity * ( ( blocks / threads ) * t + std::min( t, blocks % threads ) ) );
+      const size_t end  ( t+1UL == threads ? N : begin + granularity * ( blocks / threads + ( t < blocks % threads ? 1UL : 0UL ) ) );
+      pool.emplace_back( [=]() { f( begin, end ); } );
+   }
+
+   for( std::thread& thread : pool ) {
+      thread.join();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Register-resident FMA kernel for the measurement of the peak floating point throughput.
+//
+// \param iterations The number of iterations.
+// \return The sum of all intermediate results (to prevent the elimination of the kernel).
+*/
+template< typename T >
+T fmaKernel( size_t iterations )
+{
+   using SIMDType = typename blaze::SIMDTrait<T>::Type;
+
+   const SIMDType a( blaze::set( T( 0.999999 ) ) );
+   const SIMDType b( blaze::set( T( 1E-6 ) ) );
+
+   SIMDType acc[fmaChains];
+
+   for( size_t i=0UL; i<fmaChains; ++i ) {
+      acc[i] = blaze::set( T( i ) );
+   }
+
+   for( size_t it=0UL; it<iterations; ++it ) {
+      for( size_t i=0UL; i<fmaChains; ++i ) {
+         acc[i] = acc[i] * a + b;
+      }
+   }
+
+   T result{};
+
+   for( size_t i=0UL; i<fmaChains; ++i ) {
+      result += sum( acc[i] );
+   }
+
+   return result;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Measures the peak floating point throughput of the host system.
+//
+// \param threads The number of threads.
+// \return The peak floating point throughput [GFlop/s].
+*/
+double peak( size_t threads )
+{
+   using blazemark::element_t;
+
+   constexpr size_t SIMDSIZE( blaze::SIMDTrait<element_t>::size );
+
+   std::vector<element_t> sink( threads );
+
+   const Measurement m( measure( [&]() {
+      parallel( threads, threads, 1UL, [&]( size_t begin, size_t end ) {
+         for( size_t t=begin; t<end; ++t )
+            sink[t] += fmaKernel<element_t>( fmaIterations );
+      } );
+   }, nullptr ) );
+
+   if( !std::isfinite( std::accumulate( sink.begin(), sink.end(), element_t() ) ) )
+      std::cerr << " Line " << __LINE__ << ": ERROR detected!!!\n";
+
+   return 2.0 * fmaChains * SIMDSIZE * fmaIterations * threads / m.time / 1E9;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Measures the STREAM bandwidths of the host system.
+//
+// \param machine The machine description to be completed.
+// \param N The number of elements per array.
+// \return void
+//
+// The four STREAM kernels (copy, scale, add, and triad) are executed on plain arrays that are
+// first touched by the same threads that execute the kernels. The size of the arrays exceeds
+// the last-level cache such that the measured bandwidths represent the main memory bandwidth.
+// In accordance with the large assignments of Blaze the kernels use non-temporal stores and
+// therefore avoid the write-allocate traffic.
+*/
+void stream( Machine& machine, size_t N )
+{
+   using blazemark::element_t;
+   using blaze::loada;
+
+   constexpr size_t SIMDSIZE( blaze::SIMDTrait<element_t>::size );
+
+   const size_t threads( machine.threads );
+   const element_t s( 3.0 );
+
+   std::unique_ptr<element_t[],blaze::Deallocate> a( blaze::allocate<element_t>( N ) );
+   std::unique_ptr<element_t[],blaze::Deallocate> b( blaze::allocate<element_t>( N ) );
+   std::unique_ptr<element_t[],blaze::Deallocate> c( blaze::allocate<element_t>( N ) );
+
+   element_t* const pa( a.get() );
+   element_t* const pb( b.get() );
+   element_t* const pc( c.get() );
+
+   parallel( threads, N, SIMDSIZE, [=]( size_t begin, size_t end ) {
+      for( size_t i=begin; i<end; ++i ) {
+         pa[i] = element_t( 1 ); pb[i] = element_t( 2 ); pc[i] = element_t( 0 );
+      }
+   } );
+
+   const double bytes( N * sizeof(element_t) / 1E9 );
+
+   machine.copy = 2.0 * bytes / measure( [=]() {
+      parallel( threads, N, SIMDSIZE, [=]( size_t begin, size_t end ) {
+         size_t i( begin );
+         for( ; i+SIMDSIZE<=end; i+=SIMDSIZE ) blaze::stream( pc+i, loada( pa+i ) );
+         for( ; i<end; ++i ) pc[i] = pa[i];
+      } );
+   }, nullptr ).time;
+
+   machine.scale = 2.0 * bytes / measure( [=]() {
+      parallel( threads, N, SIMDSIZE, [=]( size_t begin, size_t end ) {
+         const auto S( blaze::set( s ) );
+         size_t i( begin );
+         for( ; i+SIMDSIZE<=end; i+=SIMDSIZE ) blaze::stream( pb+i, ( S * loada( pc+i ) ).eval() );
+         for( ; i<end; ++i ) pb[i] = s * pc[i];
+      } );
+   }, nullptr ).time;
+
+   machine.add = 3.0 * bytes / measure( [=]() {
+      parallel( threads, N, SIMDSIZE, [=]( size_t begin, size_t end ) {
+         size_t i( begin );
+         for( ; i+SIMDSIZE<=end; i+=SIMDSIZE ) blaze::stream( pc+i, ( loada( pa+i ) + loada( pb+i ) ).eval() );
+         for( ; i<end; ++i ) pc[i] = pa[i] + pb[i];
+      } );
+   }, nullptr ).time;
+
+   machine.triad = 3.0 * bytes / measure( [=]() {
+      parallel( threads, N, SIMDSIZE, [=]( size_t begin, size_t end ) {
+         const auto S( blaze::set( s ) );
+         size_t i( begin );
+         for( ; i+SIMDSIZE<=end; i+=SIMDSIZE ) blaze::stream( pa+i, ( loada( pb+i ) + S * loada( pc+i ) ).eval() );
+         for( ; i<end; ++i ) pa[i] = pb[i] + s * pc[i];
+      } );
+   }, nullptr ).time;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Benchmark for a dense vector kernel.
+//
+// \param N The size of the vectors.
+// \param op The operation, called with the two operand vectors and the target vector.
+// \param perf The hardware performance counters.
+// \return The benchmark function for the kernel.
+*/
+template< typename OP >
+std::function<Measurement()> vectorBenchmark( size_t N, OP op, PerfCounters* perf )
+{
+   return [=]() -> Measurement
+   {
+      using blazemark::element_t;
+
+      blaze::setSeed( blazemark::seed );
+
+      blaze::DynamicVector<element_t,blaze::columnVector> a( N ), b( N ), c( N );
+
+      blazemark::blaze::init( a );
+      blazemark::blaze::init( b );
+      blazemark::blaze::init( c );
+
+      return measure( [&]() { op( a, b, c ); }, perf );
+   };
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Benchmark for a dense matrix kernel.
+//
+// \param N The number of rows and columns of the matrices.
+// \param op The operation, called with the two operand matrices and the target matrix.
+// \param perf The hardware performance counters.
+// \return The benchmark function for the kernel.
+*/
+template< typename OP >
+std::function<Measurement()> matrixBenchmark( size_t N, OP op, PerfCounters* perf )
+{
+   return [=]() -> Measurement
+   {
+      using blazemark::element_t;
+
+      blaze::setSeed( blazemark::seed );
+
+      blaze::DynamicMatrix<element_t,blaze::rowMajor> A( N, N ), B( N, N ), C( N, N );
+
+      blazemark::blaze::init( A );
+      blazemark::blaze::init( B );
+
+      return measure( [&]() { op( A, B, C ); }, perf );
+   };
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Benchmark for a dense matrix/dense vector kernel.
+//
+// \param N The number of rows and columns of the matrix.
+// \param op The operation, called with the matrix, the operand vector and the target vector.
+// \param perf The hardware performance counters.
+// \return The benchmark function for the kernel.
+*/
+template< typename OP >
+std::function<Measurement()> matrixVectorBenchmark( size_t N, OP op, PerfCounters* perf )
+{
+   return [=]() -> Measurement
+   {
+      using blazemark::element_t;
+
+      blaze::setSeed( blazemark::seed );
+
+      blaze::DynamicMatrix<element_t,blaze::rowMajor> A( N, N );
+      blaze::DynamicVector<element_t,blaze::columnVector> x( N ), y( N );
+
+      blazemark::blaze::init( A );
+      blazemark::blaze::init( x );
+
+      return measure( [&]() { op( A, x, y ); }, perf );
+   };
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the kernels of the roofline benchmark.
+//
+// \param N The size of the vector kernels.
+// \param perf The hardware performance counters.
+// \return The kernels.
+//
+// The vector and matrix/vector kernels operate on operands exceeding the last-level cache and
+// are therefore bound by the main memory bandwidth, whereas the matrix multiplication is bound
+// by the floating point throughput.
+*/
+std::vector<Kernel> kernels( size_t N, PerfCounters* perf )
+{
+   using blazemark::element_t;
+
+   const double s( sizeof(element_t) );
+   const double n( N );
+   const size_t M( static_cast<size_t>( std::sqrt( n ) ) );
+   const double m( M );
+   const size_t K( 1000UL );
+   const double k( K );
+
+   return {
+      { "dvecassign"    , "c = a"        , N, 0.0      , 2.0*n*s      , vectorBenchmark( N, []( auto& a, auto&  , auto& c ) { c = a; }, perf ) },
+      { "dvecscalarmult", "c = a * s"    , N, n        , 2.0*n*s      , vectorBenchmark( N, []( auto& a, auto&  , auto& c ) { c = a * 2.1; }, perf ) },
+      { "dvecdvecadd"   , "c = a + b"    , N, n        , 3.0*n*s      , vectorBenchmark( N, []( auto& a, auto& b, auto& c ) { c = a + b; }, perf ) },
+      { "daxpy"         , "c += a * s"   , N, 2.0*n    , 3.0*n*s      , vectorBenchmark( N, []( auto& a, auto&  , auto& c ) { c += a * 0.001; }, perf ) },
+      { "dvecdvecinner" , "s = a^T * b"  , N, 2.0*n    , 2.0*n*s      , vectorBenchmark( N, []( auto& a, auto& b, auto& c ) { c[0] = dot( a, b ); }, perf ) },
+      { "dvecnorm"      , "s = norm( a )", N, 2.0*n    , n*s          , vectorBenchmark( N, []( auto& a, auto&  , auto& c ) { c[0] = norm( a ); }, perf ) },
+      { "dmattrans"     , "C = A^T"      , M, 0.0      , 2.0*m*m*s    , matrixBenchmark( M, []( auto& A, auto&  , auto& C ) { C = trans( A ); }, perf ) },
+      { "dmatdvecmult"  , "y = A * x"    , M, 2.0*m*m  , (m*m+2.0*m)*s, matrixVectorBenchmark( M, []( auto& A, auto& x, auto& y ) { y = A * x; }, perf ) },
+      { "dmatdmatmult"  , "C = A * B"    , K, 2.0*k*k*k, 3.0*k*k*s    , matrixBenchmark( K, []( auto& A, auto& B, auto& C ) { C = A * B; }, perf ) }
+   };
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Evaluates the measurement of the given kernel.
+//
+// \param kernel The benchmarked kernel.
+// \param m The measurement of the kernel.
+// \param machine The performance characteristics of the host system.
+// \return The performance of the kernel.
+//
+// The attainable performance of a kernel with arithmetic intensity \f$ I \f$ is given by the
+// roofline model as \f$ \min( P, I \cdot B ) \f$, with the peak floating point throughput
+// \f$ P \f$ and the STREAM bandwidth \f$ B \f$. For kernels without floating point operations
+// the achieved bandwidth is compared to the STREAM bandwidth.
+*/
+Result evaluate( const Kernel& kernel, const Measurement& m, const Machine& machine )
+{
+   Result r;
+
+   r.name      = kernel.name;
+   r.operation = kernel.operation;
+   r.size      = kernel.size;
+   r.flops     = kernel.flops;
+   r.bytes     = kernel.bytes;
+   r.time      = m.time;
+   r.gflops    = kernel.flops / m.time / 1E9;
+   r.gbytes    = kernel.bytes / m.time / 1E9;
+   r.intensity = kernel.flops / kernel.bytes;
+   r.counters  = m.counters;
+
+   if( kernel.flops > 0.0 )
+      r.roof = r.gflops / std::min( machine.peak, r.intensity * machine.bandwidth() );
+   else
+      r.roof = r.gbytes / machine.bandwidth();
+
+   return r;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  OUTPUT FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Writes the results in CSV format.
+//
+// \param filename The name of the output file.
+// \param machine The performance characteristics of the host system.
+// \param results The performance of all kernels.
+// \return void
+// \exception std::runtime_error Output file could not be opened.
+//
+// The performance characteristics of the host system are written as comment lines in front of
+// the table. The resulting file can be used as baseline for a subsequent run (see compare()).
+*/
+void writeCSV( const std::string& filename, const Machine& machine, const std::vector<Result>& results )
+{
+   std::ofstream file( filename );
+
+   if( !file ) {
+      throw std::runtime_error( "CSV file '" + filename + "' could not be opened" );
+   }
+
+   file << std::setprecision( 8 )
+        << "# Blaze roofline benchmark, " << blaze::getTime() << "\n"
+        << "# threads=" << machine.threads << "\n"
+        << "# peak_gflops=" << machine.peak << "\n"
+        << "# stream_copy_gbytes=" << machine.copy << "\n"
+        << "# stream_scale_gbytes=" << machine.scale << "\n"
+        << "# stream_add_gbytes=" << machine.add << "\n"
+        << "# stream_triad_gbytes=" << machine.triad << "\n"
+        << "kernel,size,flops,bytes,seconds,intensity,gflops,gbytes,roof,cycles,instructions,ipc,llc_misses\n";
+
+   for( const Result& r : results )
+   {
+      file << r.name << "," << r.size << "," << r.flops << "," << r.bytes << "," << r.time << ","
+           << r.intensity << "," << r.gflops << "," << r.gbytes << "," << r.roof;
+
+      if( r.counters.valid ) {
+         file << "," << r.counters.cycles << "," << r.counters.instructions << ","
+              << r.counters.instructions / r.counters.cycles << "," << r.counters.misses << "\n";
+      }
+      else {
+         file << ",,,,\n";
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes the results in JSON format.
+//
+// \param filename The name of the output file.
+// \param machine The performance characteristics of the host system.
+// \param results The performance of all kernels.
+// \return void
+// \exception std::runtime_error Output file could not be opened.
+*/
+void writeJSON( const std::string& filename, const Machine& machine, const std::vector<Result>& results )
+{
+   std::ofstream file( filename );
+
+   if( !file ) {
+      throw std::runtime_error( "JSON file '" + filename + "' could not be opened" );
+   }
+
+   std::string time( blaze::getTime() );
+   time.erase( std::remove( time.begin(), time.end(), '\n' ), time.end() );
+
+   file << std::setprecision( 8 )
+        << "{\n"
+        << "  \"date\": \"" << time << "\",\n"
+        << "  \"machine\": {\n"
+        << "    \"threads\": " << machine.threads << ",\n"
+        << "    \"peak_gflops\": " << machine.peak << ",\n"
+        << "    \"stream_copy_gbytes\": " << machine.copy << ",\n"
+        << "    \"stream_scale_gbytes\": " << machine.scale << ",\n"
+        << "    \"stream_add_gbytes\": " << machine.add << ",\n"
+        << "    \"stream_triad_gbytes\": " << machine.triad << "\n"
+        << "  },\n"
+        << "  \"kernels\": [";
+
+   for( size_t i=0UL; i<results.size(); ++i )
+   {
+      const Result& r( results[i] );
+
+      file << ( i == 0UL ? "\n" : ",\n" )
+           << "    {\n"
+           << "      \"kernel\": \"" << r.name << "\",\n"
+           << "      \"operation\": \"" << r.operation << "\",\n"
+           << "      \"size\": " << r.size << ",\n"
+           << "      \"flops\": " << r.flops << ",\n"
+           << "      \"bytes\": " << r.bytes << ",\n"
+           << "      \"seconds\": " << r.time << ",\n"
+           << "      \"intensity\": " << r.intensity << ",\n"
+           << "      \"gflops\": " << r.gflops << ",\n"
+           << "      \"gbytes\": " << r.gbytes << ",\n"
+           << "      \"roof\": " << r.roof;
+
+      if( r.counters.valid ) {
+         file << ",\n"
+              << "      \"cycles\": " << r.counters.cycles << ",\n"
+              << "      \"instructions\": " << r.counters.instructions << ",\n"
+              << "      \"ipc\": " << r.counters.instructions / r.counters.cycles << ",\n"
+              << "      \"llc_misses\": " << r.counters.misses;
+      }
+
+      file << "\n    }";
+   }
+
+   file << "\n  ]\n}\n";
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compares the results to the given baseline.
+//
+// \param filename The name of the baseline file (as written by writeCSV()).
+// \param results The performance of all kernels.
+// \param tolerance The tolerated relative slowdown.
+// \return The number of detected regressions.
+// \exception std::runtime_error Baseline file could not be opened.
+//
+// Kernels with floating point operations are compared by their floating point throughput, all
+// other kernels by their bandwidth. A kernel that is slower than the baseline by more than the
+// given tolerance is reported as regression. Kernels that are not contained in the baseline
+// are ignored.
+*/
+size_t compare( const std::string& filename, const std::vector<Result>& results, double tolerance )
+{
+   std::ifstream file( filename );
+
+   if( !file ) {
+      throw std::runtime_error( "Baseline file '" + filename + "' could not be opened" );
+   }
+
+   std::map<std::string,double> baseline;
+   std::string line;
+
+   while( std::getline( file, line ) )
+   {
+      if( line.empty() || line[0] == '#' || line.compare( 0UL, 7UL, "kernel," ) == 0 )
+         continue;
+
+      std::vector<std::string> fields;
+      std::istringstream iss( line );
+      std::string field;
+
+      while( std::getline( iss, field, ',' ) ) {
+         fields.push_back( field );
+      }
+
+      if( fields.size() < 8UL ) {
+         throw std::runtime_error( "Invalid baseline entry '" + line + "'" );
+      }
+
+      const double flops( std::atof( fields[2].c_str() ) );
+      baseline[fields[0]] = std::atof( fields[ flops > 0.0 ? 6UL : 7UL ].c_str() );
+   }
+
+   std::cout << " Comparison to baseline '" << filename << "' (tolerance " << tolerance*100.0 << "%):\n";
+
+   size_t regressions( 0UL );
+
+   for( const Result& r : results )
+   {
+      const auto pos( baseline.find( r.name ) );
+
+      if( pos == baseline.end() || pos->second <= 0.0 )
+         continue;
+
+      const double current( r.flops > 0.0 ? r.gflops : r.gbytes );
+      const double ratio( current / pos->second );
+      const bool regression( ratio < 1.0 - tolerance );
+
+      if( regression ) ++regressions;
+
+      std::cout << "   " << std::setw(16) << r.name
+                << std::setw(12) << pos->second << " -> " << std::setw(12) << current
+                << ( r.flops > 0.0 ? " GFlop/s" : " GB/s   " )
+                << std::setw(10) << ratio*100.0 << "%"
+                << ( regression ? "   REGRESSION" : "" ) << "\n";
+   }
+
+   std::cout << "\n";
+
+   return regressions;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The main function for the Blaze roofline benchmark.
+//
+// \param argc Number of command line arguments.
+// \param argv Array of command line arguments.
+// \return Success code for the execution.
+//
+// The roofline benchmark measures the peak floating point throughput and the STREAM bandwidths
+// of the host system and reports the arithmetic intensity, the achieved throughput and bandwidth,
+// and the fraction of the attainable performance of a set of Blaze kernels. All measurements use
+// the number of threads of the active parallelization backend. Optionally, the results can be
+// written in CSV and JSON format and can be compared to a baseline CSV file. In case a regression
+// is detected, the benchmark returns with an error code.
+*/
+int main( int argc, char** argv )
+{
+   std::string csv, json, baseline;
+   double tolerance( 0.1 );
+   bool counters( true );
+
+   for( int i=1; i<argc; ++i )
+   {
+      const std::string arg( argv[i] );
+
+      if     ( arg == "--csv"       && i+1 < argc ) csv       = argv[++i];
+      else if( arg == "--json"      && i+1 < argc ) json      = argv[++i];
+      else if( arg == "--baseline"  && i+1 < argc ) baseline  = argv[++i];
+      else if( arg == "--tolerance" && i+1 < argc ) tolerance = std::atof( argv[++i] );
+      else if( arg == "--no-counters" ) counters = false;
+      else {
+         std::cerr << " Invalid use of program 'Roofline'!\n"
+                   << "   Use: ./roofline [--csv <file>] [--json <file>] [--baseline <file>]\n"
+                   << "                   [--tolerance <fraction>] [--no-counters]\n" << std::endl;
+         return EXIT_FAILURE;
+      }
+   }
+
+   Machine machine{ blaze::getNumThreads(), 0.0, 0.0, 0.0, 0.0, 0.0 };
+
+   const size_t N( std::min( std::max( 4UL * blaze::cacheSize / sizeof(blazemark::element_t), 1UL << 20 ), 1UL << 24 ) );
+
+   std::unique_ptr<PerfCounters> perf( counters ? new PerfCounters() : nullptr );
+
+   if( perf && !perf->available() ) {
+      perf.reset();
+   }
+
+   std::cout << "\n Blaze roofline benchmark (" << machine.threads << " thread(s)):\n\n";
+
+   std::vector<Result> results;
+
+   try {
+      machine.peak = peak( machine.threads );
+      stream( machine, N );
+
+      std::cout << std::fixed << std::setprecision( 2 )
+                << "   Peak FMA throughput: " << std::setw(10) << machine.peak  << " GFlop/s\n"
+                << "   STREAM copy        : " << std::setw(10) << machine.copy  << " GB/s\n"
+                << "   STREAM scale       : " << std::setw(10) << machine.scale << " GB/s\n"
+                << "   STREAM add         : " << std::setw(10) << machine.add   << " GB/s\n"
+                << "   STREAM triad       : " << std::setw(10) << machine.triad << " GB/s\n"
+                << "   Ridge point        : " << std::setw(10) << machine.peak / machine.bandwidth() << " Flop/Byte\n"
+                << "   Hardware counters  : " << ( perf ? "available" : "not available" ) << "\n\n";
+
+      std::cout << "   " << std::left << std::setw(16) << "Kernel" << std::setw(16) << "Operation" << std::right
+                << std::setw(10) << "Size" << std::setw(12) << "Flop/Byte" << std::setw(10) << "GFlop/s"
+                << std::setw(10) << "GB/s" << std::setw(8) << "Roof";
+      if( perf ) std::cout << std::setw(8) << "IPC" << std::setw(14) << "LLC misses";
+      std::cout << "\n";
+
+      for( const Kernel& kernel : kernels( N, perf.get() ) )
+      {
+         const Result r( evaluate( kernel, kernel.benchmark(), machine ) );
+
+         std::cout << "   " << std::left << std::setw(16) << r.name << std::setw(16) << r.operation << std::right
+                   << std::setw(10) << r.size << std::setw(12) << r.intensity << std::setw(10) << r.gflops
+                   << std::setw(10) << r.gbytes << std::setw(7) << r.roof*100.0 << "%";
+         if( r.counters.valid ) {
+            std::cout << std::setw(8) << r.counters.instructions / r.counters.cycles
+                      << std::setw(14) << std::setprecision( 0 ) << r.counters.misses << std::setprecision( 2 );
+         }
+         std::cout << std::endl;
+
+         results.push_back( r );
+      }
+
+      std::cout << "\n";
+
+      if( !csv.empty() ) {
+         writeCSV( csv, machine, results );
+         std::cout << " Results written to '" << csv << "'\n";
+      }
+
+      if( !json.empty() ) {
+         writeJSON( json, machine, results );
+         std::cout << " Results written to '" << json << "'\n";
+      }
+
+      if( !baseline.empty() ) {
+         std::cout << "\n";
+         if( compare( baseline, results, tolerance ) > 0UL ) {
+            std::cerr << "   Performance regression detected!\n";
+            return EXIT_FAILURE;
+         }
+      }
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "   Error during benchmark execution: " << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   std::cout << std::endl;
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,840 @@
+//=================================================================================================
+/*!
+//  \file src/main/Scaling.cpp
+//  \brief Source file for the Blaze SMP scaling benchmark
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#ifndef BLAZE_USE_RUNTIME_THRESHOLDS
+#  define BLAZE_USE_RUNTIME_THRESHOLDS 1
+#endif
+
+#ifndef BLAZE_USE_KERNEL_TRACES
+#  define BLAZE_USE_KERNEL_TRACES 1
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/SMP.h>
+#include <blaze/system/SMP.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/KernelTrace.h>
+#include <blaze/util/Random.h>
+#include <blaze/util/Time.h>
+#include <blaze/util/Timing.h>
+#include <blazemark/blaze/init/DynamicMatrix.h>
+#include <blazemark/blaze/init/DynamicVector.h>
+#include <blazemark/system/Config.h>
+#include <blazemark/system/Types.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+#if !BLAZE_USE_RUNTIME_THRESHOLDS
+#  error "The scaling benchmark requires runtime-tunable thresholds (BLAZE_USE_RUNTIME_THRESHOLDS=1)"
+#endif
+
+
+
+
+//=================================================================================================
+//
+//  TYPE DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The result of a single measurement.
+*/
+struct Measurement
+{
+   double time;       //!< Minimum runtime of a single execution [s].
+   double imbalance;  //!< Load imbalance between the threads (NaN if not available).
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Description of a single benchmarked kernel.
+//
+// The problem size of the kernel is scaled with the number of threads for weak scaling runs
+// such that the amount of work per thread remains constant. The work of the kernel grows with
+// the problem size to the power of \a work, the value compared against the SMP threshold with
+// the problem size to the power of \a unit.
+*/
+struct Kernel
+{
+   std::string                          name;       //!< The name of the kernel.
+   std::string                          operation;  //!< Description of the benchmarked operation.
+   std::string                          threshold;  //!< The SMP threshold of the kernel.
+   size_t                               size;       //!< The problem size for strong scaling runs.
+   double                               work;       //!< Exponent of the work of the kernel.
+   double                               unit;       //!< Exponent of the threshold unit.
+   std::function<Measurement(size_t)>   benchmark;  //!< The benchmark for a single problem size.
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The measured performance of a kernel for a single number of threads.
+*/
+struct Result
+{
+   std::string backend;     //!< The parallelization backend.
+   std::string kernel;      //!< The name of the kernel.
+   std::string mode;        //!< The scaling mode ("strong" or "weak").
+   size_t      threads;     //!< The number of threads.
+   size_t      size;        //!< The problem size.
+   double      time;        //!< Runtime of a single execution [s].
+   double      speedup;     //!< Speedup relative to the serial execution.
+   double      efficiency;  //!< Parallel efficiency.
+   double      imbalance;   //!< Load imbalance between the threads.
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTANTS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Threshold value to unconditionally disable the parallel execution.
+*/
+constexpr size_t never = std::numeric_limits<size_t>::max();
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Minimum runtime of a single measurement [s].
+*/
+constexpr double mintime = 0.02;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Number of executions for the determination of the load imbalance.
+*/
+constexpr size_t traceSteps = 10UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Tolerance of the SMP threshold check.
+//
+// A threshold is only reported as too low or too high in case the alternative execution mode
+// is faster by more than the given fraction.
+*/
+constexpr double thresholdTolerance = 0.1;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Name of the active parallelization backend.
+*/
+#if BLAZE_OPENMP_PARALLEL_MODE
+const std::string backend( "openmp" );
+#elif BLAZE_HPX_PARALLEL_MODE
+const std::string backend( "hpx" );
+#elif BLAZE_CPP_THREADS_PARALLEL_MODE
+const std::string backend( "cppthreads" );
+#elif BLAZE_BOOST_THREADS_PARALLEL_MODE
+const std::string backend( "boostthreads" );
+#else
+const std::string backend( "serial" );
+#endif
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Splits the given comma-separated list.
+//
+// \param list The comma-separated list.
+// \return The list elements.
+*/
+std::vector<std::string> split( const std::string& list )
+{
+   std::vector<std::string> elements;
+   std::istringstream iss( list );
+   std::string element;
+
+   while( std::getline( iss, element, ',' ) ) {
+      if( !element.empty() )
+         elements.push_back( element );
+   }
+
+   return elements;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Sets the number of threads of the parallelization backend.
+//
+// \param threads The number of threads.
+// \return void
+// \exception std::invalid_argument Invalid number of threads for the backend.
+//
+// The number of threads of the HPX backend is specified on the command line (\c --hpx:threads)
+// and cannot be changed at runtime. Without parallelization backend the number of threads is 1.
+*/
+void setThreads( size_t threads )
+{
+#if BLAZE_OPENMP_PARALLEL_MODE || BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+   blaze::setNumThreads( threads );
+#else
+   if( threads != blaze::getNumThreads() ) {
+      throw std::invalid_argument( "Number of threads cannot be changed for the '" + backend + "' backend" );
+   }
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the load imbalance of the traced SMP assignments.
+//
+// \param threads The number of threads.
+// \return The load imbalance (NaN in case no SMP assignment has been traced).
+//
+// The load imbalance is defined as the ratio of the maximum and the average busy time of the
+// threads minus one, i.e. it is 0 for a perfectly balanced execution and \a threads-1 in case
+// a single thread performs all the work. The busy times are determined from the kernel trace
+// events of the SMP backends.
+*/
+double imbalance( size_t threads )
+{
+   blaze::KernelTraceRegistry& registry( blaze::getKernelTraceRegistry() );
+   std::lock_guard<std::mutex> lock( registry.mutex_ );
+
+   std::vector<blaze::KernelTraceEvent> events;
+   double total( 0.0 ), maximum( 0.0 );
+
+   for( const auto& buffer : registry.buffers_ )
+   {
+      events.clear();
+      buffer->copy( events );
+
+      double busy( 0.0 );
+
+      for( const blaze::KernelTraceEvent& event : events ) {
+         if( std::strcmp( event.name, "openmpAssign" ) == 0 ||
+             std::strcmp( event.name, "ThreadBackend::Assigner" ) == 0 )
+            busy += static_cast<double>( event.end - event.begin );
+      }
+
+      total  += busy;
+      maximum = std::max( maximum, busy );
+   }
+
+   if( total == 0.0 )
+      return std::numeric_limits<double>::quiet_NaN();
+
+   return maximum / ( total / threads ) - 1.0;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Measures the given operation.
+//
+// \param op The operation to be measured.
+// \return The minimum runtime of a single execution and the load imbalance.
+//
+// The number of executions per measurement is increased until a single measurement takes at
+// least \a mintime seconds. The runtime is the minimum over \a blazemark::reps measurements.
+// The load imbalance is determined from \a traceSteps additional executions.
+*/
+template< typename OP >
+Measurement measure( OP op )
+{
+   size_t steps( 1UL );
+
+   op();
+
+   while( true ) {
+      blaze::timing::WcTimer timer;
+      timer.start();
+      for( size_t step=0UL; step<steps; ++step ) {
+         op();
+      }
+      timer.end();
+      if( timer.last() >= mintime ) break;
+      steps *= 2UL;
+   }
+
+   blaze::timing::WcTimer timer;
+
+   for( size_t rep=0UL; rep<blazemark::reps; ++rep ) {
+      timer.start();
+      for( size_t step=0UL; step<steps; ++step ) {
+         op();
+      }
+      timer.end();
+   }
+
+   blaze::clearKernelTraces();
+
+   for( size_t step=0UL; step<traceSteps; ++step ) {
+      op();
+   }
+
+   return Measurement{ timer.min() / steps, imbalance( blaze::getNumThreads() ) };
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Benchmark for a dense vector kernel.
+//
+// \param op The operation, called with the two operand vectors and the target vector.
+// \return The benchmark function for the kernel.
+*/
+template< typename OP >
+std::function<Measurement(size_t)> vectorBenchmark( OP op )
+{
+   return [op]( size_t N ) -> Measurement
+   {
+      using blazemark::element_t;
+
+      blaze::setSeed( blazemark::seed );
+
+      blaze::DynamicVector<element_t,blaze::columnVector> a( N ), b( N ), c( N );
+
+      blazemark::blaze::init( a );
+      blazemark::blaze::init( b );
+
+      return measure( [&]() { op( a, b, c ); } );
+   };
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Benchmark for a dense matrix kernel.
+//
+// \param op The operation, called with the two operand matrices and the target matrix.
+// \return The benchmark function for the kernel.
+*/
+template< typename OP >
+std::function<Measurement(size_t)> matrixBenchmark( OP op )
+{
+   return [op]( size_t N ) -> Measurement
+   {
+      using blazemark::element_t;
+
+      blaze::setSeed( blazemark::seed );
+
+      blaze::DynamicMatrix<element_t,blaze::rowMajor> A( N, N ), B( N, N ), C( N, N );
+
+      blazemark::blaze::init( A );
+      blazemark::blaze::init( B );
+
+      return measure( [&]() { op( A, B, C ); } );
+   };
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Benchmark for a dense matrix/dense vector kernel.
+//
+// \param op The operation, called with the matrix, the operand vector and the target vector.
+// \return The benchmark function for the kernel.
+*/
+template< typename OP >
+std::function<Measurement(size_t)> matrixVectorBenchmark( OP op )
+{
+   return [op]( size_t N ) -> Measurement
+   {
+      using blazemark::element_t;
+
+      blaze::setSeed( blazemark::seed );
+
+      blaze::DynamicMatrix<element_t,blaze::rowMajor> A( N, N );
+      blaze::DynamicVector<element_t,blaze::columnVector> x( N ), y( N );
+
+      blazemark::blaze::init( A );
+      blazemark::blaze::init( x );
+
+      return measure( [&]() { op( A, x, y ); } );
+   };
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the kernels of the scaling benchmark.
+//
+// \return The kernels.
+*/
+std::vector<Kernel> kernels()
+{
+   return {
+      { "dvecdvecadd"   , "c = a + b"    , "SMP_DVECDVECADD_THRESHOLD"   , 4194304UL, 1.0, 1.0, vectorBenchmark( []( auto& a, auto& b, auto& c ) { c = a + b; } ) },
+      { "dvecscalarmult", "c = a * s"    , "SMP_DVECSCALARMULT_THRESHOLD", 4194304UL, 1.0, 1.0, vectorBenchmark( []( auto& a, auto&  , auto& c ) { c = a * 2.1; } ) },
+      { "dvecdvecinner" , "s = a^T * b"  , "SMP_DVECDVECINNER_THRESHOLD" , 4194304UL, 1.0, 1.0, vectorBenchmark( []( auto& a, auto& b, auto& c ) { c[0] = dot( a, b ); } ) },
+      { "dmatdmatadd"   , "C = A + B"    , "SMP_DMATDMATADD_THRESHOLD"   ,    1024UL, 2.0, 2.0, matrixBenchmark( []( auto& A, auto& B, auto& C ) { C = A + B; } ) },
+      { "dmatdvecmult"  , "y = A * x"    , "SMP_DMATDVECMULT_THRESHOLD"  ,    2048UL, 2.0, 1.0, matrixVectorBenchmark( []( auto& A, auto& x, auto& y ) { y = A * x; } ) },
+      { "dmatdmatmult"  , "C = A * B"    , "SMP_DMATDMATMULT_THRESHOLD"  ,     512UL, 3.0, 2.0, matrixBenchmark( []( auto& A, auto& B, auto& C ) { C = A * B; } ) }
+   };
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BENCHMARK FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Runs the scaling benchmark for the given kernel.
+//
+// \param kernel The kernel to be benchmarked.
+// \param threads The numbers of threads.
+// \param weak \a true for weak scaling, \a false for strong scaling.
+// \return The results for all numbers of threads.
+//
+// The serial reference is measured by disabling the SMP threshold of the kernel. For strong
+// scaling the speedup is the ratio of the serial and the parallel runtime for the same problem
+// size. For weak scaling the problem size grows with the number of threads and the speedup is
+// the scaled speedup (i.e. the number of threads times the ratio of the serial runtime for the
+// base problem size and the parallel runtime for the scaled problem size). In both cases the
+// parallel efficiency is the speedup divided by the number of threads.
+*/
+std::vector<Result> scale( const Kernel& kernel, const std::vector<size_t>& threads, bool weak )
+{
+   const std::string mode( weak ? "weak" : "strong" );
+   const size_t threshold( blaze::getThreshold( kernel.threshold ) );
+
+   std::cout << "   " << kernel.operation << " (" << kernel.name << ", " << mode << " scaling)\n";
+
+   blaze::setThreshold( kernel.threshold, never );
+   const double serial( kernel.benchmark( kernel.size ).time );
+   blaze::setThreshold( kernel.threshold, threshold );
+
+   std::vector<Result> results;
+
+   for( size_t T : threads )
+   {
+      const size_t N( weak ? static_cast<size_t>( std::round( kernel.size * std::pow( T, 1.0/kernel.work ) ) )
+                           : kernel.size );
+
+      setThreads( T );
+
+      const Measurement m( T > 1UL ? kernel.benchmark( N ) : Measurement{ serial, 0.0 } );
+      const double speedup( weak ? T * serial / m.time : serial / m.time );
+
+      results.push_back( Result{ backend, kernel.name, mode, T, N, m.time, speedup, speedup / T, m.imbalance } );
+
+      std::cout << "      threads=" << std::setw(4) << T
+                << "   N=" << std::setw(9) << N
+                << "   time: " << std::setw(10) << m.time*1E6 << " us"
+                << "   speedup: " << std::setw(6) << speedup
+                << "   efficiency: " << std::setw(6) << speedup / T * 100.0 << "%"
+                << "   imbalance: ";
+      if( std::isnan( m.imbalance ) ) std::cout << "n/a";
+      else std::cout << m.imbalance * 100.0 << "%";
+      std::cout << std::endl;
+   }
+
+   std::cout << "\n";
+
+   return results;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checks the SMP threshold of the given kernel.
+//
+// \param kernel The kernel to be checked.
+// \return \a true in case the threshold is plausible, \a false if a regression is detected.
+//
+// The kernel is measured at twice the problem size at which the parallel execution starts and at
+// half of this problem size, each time with and without parallel execution. The threshold is
+// reported as too low in case the serial execution is faster above the threshold and as too
+// high in case the parallel execution is faster below the threshold (in both cases by more than
+// \a thresholdTolerance). The check is performed with the current number of threads.
+*/
+bool check( const Kernel& kernel )
+{
+   const size_t threshold( blaze::getThreshold( kernel.threshold ) );
+   const size_t crossover( static_cast<size_t>( std::ceil( std::pow( threshold, 1.0/kernel.unit ) ) ) );
+
+   std::cout << "   " << std::left << std::setw(30) << kernel.threshold << std::right
+             << std::setw(10) << threshold << "   ";
+
+   if( crossover == 0UL || crossover > 16UL*kernel.size ) {
+      std::cout << "skipped\n";
+      return true;
+   }
+
+   const auto compare = [&]( size_t N ) {
+      blaze::setThreshold( kernel.threshold, never );
+      const double serial( kernel.benchmark( N ).time );
+      blaze::setThreshold( kernel.threshold, 0UL );
+      const double parallel( kernel.benchmark( N ).time );
+      blaze::setThreshold( kernel.threshold, threshold );
+      return serial / parallel;
+   };
+
+   const double above( compare( 2UL*crossover ) );
+   const double below( crossover > 1UL ? compare( crossover/2UL ) : 0.0 );
+
+   std::cout << "speedup at N=" << std::setw(8) << 2UL*crossover << ": " << std::setw(6) << above
+             << "   speedup at N=" << std::setw(8) << crossover/2UL << ": " << std::setw(6) << below;
+
+   if( above < 1.0 - thresholdTolerance ) {
+      std::cout << "   TOO LOW\n";
+      return false;
+   }
+   else if( below > 1.0 + thresholdTolerance ) {
+      std::cout << "   TOO HIGH\n";
+      return false;
+   }
+
+   std::cout << "   OK\n";
+   return true;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  OUTPUT FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Writes the results in CSV format.
+//
+// \param filename The name of the output file.
+// \param results The results of all kernels.
+// \return void
+// \exception std::runtime_error Output file could not be opened.
+*/
+void writeCSV( const std::string& filename, const std::vector<Result>& results )
+{
+   std::ofstream file( filename );
+
+   if( !file ) {
+      throw std::runtime_error( "CSV file '" + filename + "' could not be opened" );
+   }
+
+   file << std::setprecision( 8 )
+        << "# Blaze SMP scaling benchmark, " << blaze::getTime() << "\n"
+        << "backend,kernel,mode,threads,size,seconds,speedup,efficiency,imbalance\n";
+
+   for( const Result& r : results ) {
+      file << r.backend << "," << r.kernel << "," << r.mode << "," << r.threads << "," << r.size << ","
+           << r.time << "," << r.speedup << "," << r.efficiency << ",";
+      if( !std::isnan( r.imbalance ) ) file << r.imbalance;
+      file << "\n";
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Prints the results of several CSV files side by side.
+//
+// \param filenames The names of the CSV files (as written by writeCSV()).
+// \return void
+// \exception std::runtime_error CSV file could not be opened.
+//
+// This function allows to compare the scaling of different parallelization backends, which
+// are selected at compile time and therefore have to be measured by separate executables.
+// For every kernel, scaling mode, and number of threads the function prints the speedup and
+// the parallel efficiency of all given files.
+*/
+void compare( const std::vector<std::string>& filenames )
+{
+   using Key = std::tuple<std::string,std::string,size_t>;
+
+   std::map< Key, std::vector<std::string> > table;
+   std::vector<std::string> labels;
+
+   for( size_t i=0UL; i<filenames.size(); ++i )
+   {
+      std::ifstream file( filenames[i] );
+
+      if( !file ) {
+         throw std::runtime_error( "CSV file '" + filenames[i] + "' could not be opened" );
+      }
+
+      std::string line, label( filenames[i] );
+
+      while( std::getline( file, line ) )
+      {
+         if( line.empty() || line[0] == '#' || line.compare( 0UL, 8UL, "backend," ) == 0 )
+            continue;
+
+         std::vector<std::string> fields;
+         std::istringstream iss( line );
+         std::string field;
+
+         while( std::getline( iss, field, ',' ) ) {
+            fields.push_back( field );
+         }
+
+         if( fields.size() < 8UL ) {
+            throw std::runtime_error( "Invalid CSV entry '" + line + "'" );
+         }
+
+         label = fields[0];
+
+         std::ostringstream oss;
+         oss << std::fixed << std::setprecision( 2 ) << std::atof( fields[6].c_str() )
+             << " (" << std::setprecision( 0 ) << std::atof( fields[7].c_str() )*100.0 << "%)";
+
+         std::vector<std::string>& row( table[ Key( fields[1], fields[2], std::atol( fields[3].c_str() ) ) ] );
+         row.resize( filenames.size(), "-" );
+         row[i] = oss.str();
+      }
+
+      labels.push_back( label );
+   }
+
+   std::cout << "   " << std::left << std::setw(16) << "Kernel" << std::setw(8) << "Mode"
+             << std::right << std::setw(8) << "Threads";
+   for( const std::string& label : labels ) {
+      std::cout << std::setw(18) << label;
+   }
+   std::cout << "\n";
+
+   for( const auto& entry : table )
+   {
+      std::cout << "   " << std::left << std::setw(16) << std::get<0>( entry.first )
+                << std::setw(8) << std::get<1>( entry.first )
+                << std::right << std::setw(8) << std::get<2>( entry.first );
+      for( size_t i=0UL; i<filenames.size(); ++i ) {
+         std::cout << std::setw(18) << ( i < entry.second.size() ? entry.second[i] : "-" );
+      }
+      std::cout << "\n";
+   }
+
+   std::cout << std::endl;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Prints the usage of the scaling benchmark.
+//
+// \return void
+*/
+void usage()
+{
+   std::cerr << " Invalid use of program 'Scaling'!\n"
+             << "   Use: ./scaling [--threads <list>] [--kernels <list>] [--weak] [--csv <file>]\n"
+             << "                  [--no-threshold-check]\n"
+             << "        ./scaling --compare <file> [<file> ...]\n" << std::endl;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The main function for the Blaze SMP scaling benchmark.
+//
+// \param argc Number of command line arguments.
+// \param argv Array of command line arguments.
+// \return Success code for the execution.
+//
+// The scaling benchmark runs a set of kernels for several numbers of threads (per default all
+// powers of two up to the number of hardware threads) and reports the speedup, the parallel
+// efficiency, and the load imbalance between the threads. Afterwards the SMP thresholds of all
+// benchmarked kernels are checked for the maximum number of threads. In case a threshold is
+// detected to be too low or too high, the benchmark returns with an error code. The results
+// of executables built for different parallelization backends can be compared side by side
+// via the \c --compare option.
+*/
+int main( int argc, char** argv )
+{
+   std::vector<size_t> threads;
+   std::vector<std::string> names, files;
+   std::string csv;
+   bool weak( false ), checkThresholds( true ), compareFiles( false );
+
+   for( int i=1; i<argc; ++i )
+   {
+      const std::string arg( argv[i] );
+
+      if( compareFiles ) {
+         files.push_back( arg );
+      }
+      else if( arg == "--threads" && i+1 < argc ) {
+         for( const std::string& T : split( argv[++i] ) )
+            threads.push_back( static_cast<size_t>( std::atol( T.c_str() ) ) );
+      }
+      else if( arg == "--kernels" && i+1 < argc ) names = split( argv[++i] );
+      else if( arg == "--csv"     && i+1 < argc ) csv   = argv[++i];
+      else if( arg == "--weak" ) weak = true;
+      else if( arg == "--no-threshold-check" ) checkThresholds = false;
+      else if( arg == "--compare" ) compareFiles = true;
+      else {
+         usage();
+         return EXIT_FAILURE;
+      }
+   }
+
+   try {
+      if( compareFiles )
+      {
+         if( files.empty() ) {
+            usage();
+            return EXIT_FAILURE;
+         }
+
+         std::cout << "\n Blaze SMP scaling comparison (speedup and parallel efficiency):\n\n";
+         compare( files );
+         return EXIT_SUCCESS;
+      }
+
+      if( threads.empty() ) {
+#if BLAZE_OPENMP_PARALLEL_MODE || BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+         const size_t hardware( std::max( std::thread::hardware_concurrency(), 1U ) );
+         for( size_t T=1UL; T<hardware; T*=2UL )
+            threads.push_back( T );
+         threads.push_back( hardware );
+#else
+         threads.push_back( blaze::getNumThreads() );
+#endif
+      }
+
+      if( std::find( threads.begin(), threads.end(), 0UL ) != threads.end() ) {
+         throw std::invalid_argument( "Invalid number of threads" );
+      }
+
+      std::vector<Kernel> selection;
+
+      for( const Kernel& kernel : kernels() ) {
+         if( names.empty() || std::find( names.begin(), names.end(), kernel.name ) != names.end() )
+            selection.push_back( kernel );
+      }
+
+      if( selection.empty() ) {
+         throw std::invalid_argument( "No valid kernel selected" );
+      }
+
+      std::cout << "\n Blaze SMP scaling benchmark (" << backend << " backend):\n\n"
+                << std::fixed << std::setprecision( 2 );
+
+      std::vector<Result> results;
+
+      for( const Kernel& kernel : selection ) {
+         const std::vector<Result> r( scale( kernel, threads, weak ) );
+         results.insert( results.end(), r.begin(), r.end() );
+      }
+
+      if( !csv.empty() ) {
+         writeCSV( csv, results );
+         std::cout << " Results written to '" << csv << "'\n\n";
+      }
+
+      const size_t maximum( *std::max_element( threads.begin(), threads.end() ) );
+
+      if( checkThresholds && maximum > 1UL )
+      {
+         setThreads( maximum );
+
+         std::cout << " SMP threshold check (" << maximum << " threads):\n\n";
+
+         bool valid( true );
+
+         for( const Kernel& kernel : selection ) {
+            valid = check( kernel ) && valid;
+         }
+
+         std::cout << std::endl;
+
+         if( !valid ) {
+            std::cerr << "   SMP threshold regression detected!\n";
+            return EXIT_FAILURE;
+         }
+      }
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "   Error during benchmark execution: " << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,842 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/batchedmatrix/ClassTest.h
+//  \brief Header file for the BatchedMatrix class test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_BATCHEDMATRIX_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_BATCHEDMATRIX_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+#include <blaze/math/BatchedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/StaticMatrix.h>
+#include <blaze/util/AlignedAllocator.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Random.h>
+#include <blaze/util/typetraits/IsComplex.h>
+#include <blazetest/system/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace batchedmatrix {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the BatchedMatrix class template.
+//
+// This class represents a test suite for the blaze::BatchedMatrix class template. It performs
+// a series of runtime tests, which compare the batched operations with the according operations
+// on the single StaticMatrix instances of the batch. All batch sizes are chosen such that the
+// last group of the batch is only partially filled.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   //! Vector of single matrices of a batch.
+   template< typename Type, size_t M, size_t N >
+   using Matrices = std::vector< blaze::StaticMatrix<Type,M,N>
+                               , blaze::AlignedAllocator< blaze::StaticMatrix<Type,M,N> > >;
+
+   using cdouble = blaze::complex<double>;                //!< Double precision complex test type.
+   using BMT     = blaze::BatchedMatrix<double,3UL,4UL>;  //!< Type of the batch for the basic tests.
+   using MT      = BMT::MatrixType;                       //!< Type of a single matrix of the batch.
+   using MTs     = Matrices<double,3UL,4UL>;              //!< Vector of single matrices of the basic tests.
+   //**********************************************************************************************
+
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testConstructors();
+   void testAccess      ();
+   void testGetSet      ();
+   void testResize      ();
+   void testSwap        ();
+   void testGemm        ();
+   void testLU          ();
+   void testInvert      ();
+   void testSolve       ();
+
+   template< typename Type, size_t M, size_t N, size_t K >
+   void runGemmTest();
+
+   template< typename Type, size_t N >
+   void runGemmAliasingTest();
+
+   template< typename Type, size_t N, size_t R >
+   void runLUTest();
+
+   template< typename Type, size_t N >
+   void runInvertTest();
+
+   template< typename Type, size_t N, size_t R >
+   void runSolveTest();
+
+   template< typename Type, size_t M, size_t N >
+   void checkSize( const blaze::BatchedMatrix<Type,M,N>& batch, size_t expectedSize ) const;
+
+   template< typename Type, size_t M, size_t N >
+   void checkBatch( const blaze::BatchedMatrix<Type,M,N>& batch,
+                    const Matrices<Type,M,N>& reference ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename Type >
+   static blaze::EnableIf_t< !blaze::IsComplex_v<Type>, Type > value();
+
+   template< typename Type >
+   static blaze::EnableIf_t< blaze::IsComplex_v<Type>, Type > value();
+
+   template< typename Type, size_t M, size_t N >
+   static void initialize( blaze::BatchedMatrix<Type,M,N>& batch );
+
+   template< typename Type, size_t N >
+   static void makeRegular( blaze::BatchedMatrix<Type,N,N>& batch );
+
+   template< typename Type, size_t M, size_t N >
+   static Matrices<Type,M,N>
+      extract( const blaze::BatchedMatrix<Type,M,N>& batch );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the batched multiplication with randomly initialized batches.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the batched multiplication of \f$ M \times K \f$ and \f$ K \times N \f$
+// matrices with the multiplication of the single matrices. The plain multiplication, the scaled
+// multiplication with and without contribution of the target matrices as well as the handling
+// of non-matching batch sizes are tested. Since all values are small integers, the results are
+// exact independent of the order of the summation.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows of the target matrices
+        , size_t N       // Number of columns of the target matrices
+        , size_t K >     // Number of columns of the left-hand side matrices
+void ClassTest::runGemmTest()
+{
+   constexpr size_t S( blaze::BatchedMatrix<Type,M,N>::SIMDSIZE );
+
+   for( size_t n : { 1UL, S+1UL, 3UL*S+3UL } )
+   {
+      blaze::BatchedMatrix<Type,M,K> A( n );
+      blaze::BatchedMatrix<Type,K,N> B( n );
+      blaze::BatchedMatrix<Type,M,N> C( n );
+
+      initialize( A );
+      initialize( B );
+      initialize( C );
+
+      Matrices<Type,M,N> ref( n );
+
+      {
+         blaze::BatchedMatrix<Type,M,N> C1;
+         gemm( C1, A, B );
+
+         for( size_t b=0UL; b<n; ++b )
+            ref[b] = A.get(b) * B.get(b);
+
+         checkBatch( C1, ref );
+      }
+
+      {
+         blaze::BatchedMatrix<Type,M,N> C2( C );
+         gemm( C2, A, B, Type(2), Type(-3) );
+
+         for( size_t b=0UL; b<n; ++b )
+            ref[b] = Type(2) * ( A.get(b) * B.get(b) ) - Type(3) * C.get(b);
+
+         checkBatch( C2, ref );
+      }
+
+      {
+         blaze::BatchedMatrix<Type,M,N> C3( C );
+         gemm( C3, A, B, Type(-1) );
+
+         for( size_t b=0UL; b<n; ++b )
+            ref[b] = -( A.get(b) * B.get(b) );
+
+         checkBatch( C3, ref );
+      }
+
+      try {
+         blaze::BatchedMatrix<Type,M,N> C4( n+1UL );
+         gemm( C4, A, B, Type(1), Type(1) );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication with non-matching target batch succeeded\n"
+             << " Details:\n"
+             << "   Batch size: " << n << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the batched multiplication with a target batch that is also an operand.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the batched multiplication of \f$ N \times N \f$ matrices in case the
+// target batch is identical to the left-hand side operand, the right-hand side operand or to
+// both operands. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t N >     // Number of rows and columns
+void ClassTest::runGemmAliasingTest()
+{
+   constexpr size_t S( blaze::BatchedMatrix<Type,N,N>::SIMDSIZE );
+
+   for( size_t n : { 1UL, S+1UL, 3UL*S+3UL } )
+   {
+      blaze::BatchedMatrix<Type,N,N> A( n ), B( n );
+
+      initialize( A );
+      initialize( B );
+
+      const auto A0( extract( A ) );
+      const auto B0( extract( B ) );
+
+      Matrices<Type,N,N> ref( n );
+
+      gemm( A, A, B, Type(2), Type(1) );
+
+      for( size_t b=0UL; b<n; ++b )
+         ref[b] = Type(2) * ( A0[b] * B0[b] ) + A0[b];
+
+      checkBatch( A, ref );
+
+      gemm( B, A, B );
+
+      for( size_t b=0UL; b<n; ++b )
+         ref[b] = ( Type(2) * ( A0[b] * B0[b] ) + A0[b] ) * B0[b];
+
+      checkBatch( B, ref );
+
+      const auto B1( extract( B ) );
+
+      gemm( B, B, B );
+
+      for( size_t b=0UL; b<n; ++b )
+         ref[b] = B1[b] * B1[b];
+
+      checkBatch( B, ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the batched LU decomposition and substitution.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the batched LU decomposition getrf() and the subsequent substitution
+// getrs() of \f$ N \times N \f$ systems with \a R right-hand sides. The system matrices are
+// dominated by their anti-diagonal, i.e. the partial pivoting has to interchange rows. For
+// every matrix of the batch, the product of the factors \a L and \a U is compared with the
+// row-interchanged original matrix and the solution of the systems is checked by means of
+// the original matrices. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t N       // Number of rows and columns of the system matrices
+        , size_t R >     // Number of right-hand sides
+void ClassTest::runLUTest()
+{
+   constexpr size_t S( blaze::BatchedMatrix<Type,N,N>::SIMDSIZE );
+
+   for( size_t n : { 1UL, S+1UL, 3UL*S+3UL } )
+   {
+      blaze::BatchedMatrix<Type,N,N> A( n );
+      blaze::BatchedMatrix<Type,N,R> B( n );
+
+      initialize( A );
+      makeRegular( A );
+      initialize( B );
+
+      const auto A0( extract( A ) );
+
+      std::vector<int> ipiv( n*N );
+      getrf( A, ipiv.data() );
+
+      for( size_t b=0UL; b<n; ++b )
+      {
+         blaze::StaticMatrix<Type,N,N> PA( A0[b] ), L, U;
+
+         for( size_t k=0UL; k<N; ++k ) {
+            const int p( ipiv[b*N+k] );
+            if( p < int(k+1UL) || p > int(N) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Invalid pivot index detected\n"
+                   << " Details:\n"
+                   << "   Matrix index: " << b << "\n"
+                   << "   Row         : " << k << "\n"
+                   << "   Pivot index : " << p << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+            for( size_t j=0UL; j<N; ++j )
+               std::swap( PA(k,j), PA(p-1,j) );
+         }
+
+         for( size_t i=0UL; i<N; ++i ) {
+            for( size_t j=0UL; j<N; ++j ) {
+               L(i,j) = ( i > j )?( A(b,i,j) ):( i == j ? Type(1) : Type(0) );
+               U(i,j) = ( i <= j )?( A(b,i,j) ):( Type(0) );
+            }
+         }
+
+         if( L * U != PA ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: LU decomposition failed\n"
+                << " Details:\n"
+                << "   Element type:\n"
+                << "     " << typeid( Type ).name() << "\n"
+                << "   Matrix index: " << b << " of " << n << "\n"
+                << "   L:\n" << L << "\n"
+                << "   U:\n" << U << "\n"
+                << "   Row-interchanged matrix:\n" << PA << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      blaze::BatchedMatrix<Type,N,R> X( B );
+      getrs( A, X, ipiv.data() );
+
+      Matrices<Type,N,R> ref( extract( B ) );
+      Matrices<Type,N,R> res( n );
+
+      for( size_t b=0UL; b<n; ++b )
+         res[b] = A0[b] * X.get(b);
+
+      for( size_t b=0UL; b<n; ++b ) {
+         if( res[b] != ref[b] ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Substitution failed\n"
+                << " Details:\n"
+                << "   Element type:\n"
+                << "     " << typeid( Type ).name() << "\n"
+                << "   Matrix index: " << b << " of " << n << "\n"
+                << "   A * X:\n" << res[b] << "\n"
+                << "   Expected result:\n" << ref[b] << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      try {
+         blaze::BatchedMatrix<Type,N,R> Y( n+1UL );
+         getrs( A, Y, ipiv.data() );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Substitution with non-matching batch succeeded\n"
+             << " Details:\n"
+             << "   Batch size: " << n << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the batched in-place inversion.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the batched inversion of \f$ N \times N \f$ matrices by multiplying every
+// original matrix with its computed inverse. Additionally it tests that a singular matrix within
+// the batch results in a \a std::runtime_error exception, whereas all other matrices of the
+// batch are inverted nonetheless. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t N >     // Number of rows and columns
+void ClassTest::runInvertTest()
+{
+   constexpr size_t S( blaze::BatchedMatrix<Type,N,N>::SIMDSIZE );
+
+   for( size_t n : { 1UL, S+1UL, 3UL*S+3UL } )
+   {
+      for( size_t singular : { n, n/2UL, n-1UL } )
+      {
+         blaze::BatchedMatrix<Type,N,N> A( n );
+
+         initialize( A );
+         makeRegular( A );
+
+         if( singular < n ) {
+            for( size_t j=0UL; j<N; ++j )
+               A(singular,N/2UL,j) = Type(0);
+         }
+
+         const auto A0( extract( A ) );
+
+         try {
+            invert( A );
+
+            if( singular < n ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Inversion of a singular matrix succeeded\n"
+                   << " Details:\n"
+                   << "   Matrix index: " << singular << " of " << n << "\n"
+                   << "   Matrix:\n" << A0[singular] << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+         catch( std::runtime_error& ex ) {
+            if( singular == n || std::string( ex.what() ).find( "singular" ) == std::string::npos )
+               throw;
+         }
+
+         for( size_t b=0UL; b<n; ++b )
+         {
+            if( b == singular ) continue;
+
+            const blaze::StaticMatrix<Type,N,N> I( A0[b] * A.get(b) );
+
+            if( !isIdentity( I ) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Inversion failed\n"
+                   << " Details:\n"
+                   << "   Element type:\n"
+                   << "     " << typeid( Type ).name() << "\n"
+                   << "   Matrix index: " << b << " of " << n << "\n"
+                   << "   Matrix:\n" << A0[b] << "\n"
+                   << "   Inverse:\n" << A.get(b) << "\n"
+                   << "   A * inv(A):\n" << I << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the batched solution of systems of linear equations.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the batched solution of \f$ N \times N \f$ systems with \a R right-hand
+// sides by multiplying every original system matrix with the computed solution. The solution
+// into a separate batch and into the batch of right-hand sides are tested, as well as the
+// handling of a singular system matrix within the batch, which results in a \a std::runtime_error
+// exception, whereas all other systems are solved nonetheless. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t N       // Number of rows and columns of the system matrices
+        , size_t R >     // Number of right-hand sides
+void ClassTest::runSolveTest()
+{
+   constexpr size_t S( blaze::BatchedMatrix<Type,N,N>::SIMDSIZE );
+
+   for( size_t n : { 1UL, S+1UL, 3UL*S+3UL } )
+   {
+      for( size_t singular : { n, 0UL, n-1UL } )
+      {
+         blaze::BatchedMatrix<Type,N,N> A( n );
+         blaze::BatchedMatrix<Type,N,R> B( n ), X, Y;
+
+         initialize( A );
+         makeRegular( A );
+         initialize( B );
+
+         if( singular < n ) {
+            for( size_t i=0UL; i<N; ++i )
+               A(singular,i,N-1UL) = Type(0);
+         }
+
+         const auto A0( extract( A ) );
+         const auto B0( extract( B ) );
+
+         try {
+            solve( A, X, B );
+
+            if( singular < n ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Solving a singular system succeeded\n"
+                   << " Details:\n"
+                   << "   Matrix index: " << singular << " of " << n << "\n"
+                   << "   Matrix:\n" << A0[singular] << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+         catch( std::runtime_error& ex ) {
+            if( singular == n || std::string( ex.what() ).find( "singular" ) == std::string::npos )
+               throw;
+         }
+
+         checkBatch( A, A0 );
+         checkSize( X, n );
+
+         Y = B;
+         try {
+            solve( A, Y, Y );
+         }
+         catch( std::runtime_error& ) {
+            if( singular == n ) throw;
+         }
+
+         for( size_t b=0UL; b<n; ++b )
+         {
+            if( b == singular ) continue;
+
+            const blaze::StaticMatrix<Type,N,R> AX( A0[b] * X.get(b) );
+            const blaze::StaticMatrix<Type,N,R> AY( A0[b] * Y.get(b) );
+
+            if( AX != B0[b] || AY != B0[b] ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Solving the system of equations failed\n"
+                   << " Details:\n"
+                   << "   Element type:\n"
+                   << "     " << typeid( Type ).name() << "\n"
+                   << "   Matrix index: " << b << " of " << n << "\n"
+                   << "   A * X:\n" << AX << "\n"
+                   << "   A * X (in-place solution):\n" << AY << "\n"
+                   << "   Expected result:\n" << B0[b] << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+
+         try {
+            blaze::BatchedMatrix<Type,N,R> C( n+1UL );
+            solve( A, X, C );
+
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Solving with non-matching batch succeeded\n"
+                << " Details:\n"
+                << "   Batch size: " << n << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+         catch( std::invalid_argument& ) {}
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the size of the given batch.
+//
+// \param batch The batch to be checked.
+// \param expectedSize The expected number of matrices of the batch.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the number of matrices and the number of groups of the given batch.
+// In case the actual size does not correspond to the given expected size, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+void ClassTest::checkSize( const blaze::BatchedMatrix<Type,M,N>& batch, size_t expectedSize ) const
+{
+   constexpr size_t S( blaze::BatchedMatrix<Type,M,N>::SIMDSIZE );
+
+   if( batch.size() != expectedSize ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid batch size detected\n"
+          << " Details:\n"
+          << "   Size         : " << batch.size() << "\n"
+          << "   Expected size: " << expectedSize << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   if( batch.groups() != ( expectedSize + S - 1UL ) / S ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of groups detected\n"
+          << " Details:\n"
+          << "   Size            : " << batch.size() << "\n"
+          << "   SIMD size       : " << S << "\n"
+          << "   Number of groups: " << batch.groups() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Comparison of a batch with a vector of reference matrices.
+//
+// \param batch The batch to be checked.
+// \param reference The reference matrices.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the size of the given batch and all of its matrices with the given
+// reference matrices. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+void ClassTest::checkBatch( const blaze::BatchedMatrix<Type,M,N>& batch,
+                            const Matrices<Type,M,N>& reference ) const
+{
+   checkSize( batch, reference.size() );
+
+   for( size_t b=0UL; b<reference.size(); ++b ) {
+      if( batch.get(b) != reference[b] ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Matrix comparison failed\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Matrix index: " << b << " of " << reference.size() << "\n"
+             << "   Result:\n" << batch.get(b) << "\n"
+             << "   Expected result:\n" << reference[b] << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creation of a random value.
+//
+// \return A random integral value in the range \f$ [-4..4] \f$.
+*/
+template< typename Type >  // Data type of the value
+blaze::EnableIf_t< !blaze::IsComplex_v<Type>, Type > ClassTest::value()
+{
+   return Type( blaze::rand<int>( -4, 4 ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creation of a random complex value.
+//
+// \return A random complex value with integral real and imaginary parts in the range \f$ [-4..4] \f$.
+*/
+template< typename Type >  // Data type of the value
+blaze::EnableIf_t< blaze::IsComplex_v<Type>, Type > ClassTest::value()
+{
+   return Type( blaze::rand<int>( -4, 4 ), blaze::rand<int>( -4, 4 ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Random initialization of all matrices of the given batch.
+//
+// \param batch The batch to be initialized.
+// \return void
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+void ClassTest::initialize( blaze::BatchedMatrix<Type,M,N>& batch )
+{
+   for( size_t b=0UL; b<batch.size(); ++b )
+      for( size_t i=0UL; i<M; ++i )
+         for( size_t j=0UL; j<N; ++j )
+            batch(b,i,j) = value<Type>();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Turns all matrices of the given batch into regular matrices.
+//
+// \param batch The batch of randomly initialized matrices.
+// \return void
+//
+// This function makes all matrices of the given batch dominant on their anti-diagonal. The
+// resulting matrices are row interchanged, diagonally dominant matrices, i.e. they are regular
+// and well-conditioned, but their LU decomposition requires pivoting.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t N >     // Number of rows and columns
+void ClassTest::makeRegular( blaze::BatchedMatrix<Type,N,N>& batch )
+{
+   for( size_t b=0UL; b<batch.size(); ++b )
+      for( size_t i=0UL; i<N; ++i )
+         batch(b,i,N-1UL-i) += Type( 12*N );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Extraction of all matrices of the given batch.
+//
+// \param batch The given batch.
+// \return Copies of all matrices of the batch.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+ClassTest::Matrices<Type,M,N>
+   ClassTest::extract( const blaze::BatchedMatrix<Type,M,N>& batch )
+{
+   Matrices<Type,M,N> matrices( batch.size() );
+
+   for( size_t b=0UL; b<batch.size(); ++b )
+      matrices[b] = batch.get(b);
+
+   return matrices;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the functionality of the BatchedMatrix class template.
+//
+// \return void
+*/
+void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the BatchedMatrix class test.
+*/
+#define RUN_BATCHEDMATRIX_CLASS_TEST \
+   blazetest::mathtest::batchedmatrix::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace batchedmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,434 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/binaryserialization/ClassTest.h
+//  \brief Header file for the BinarySerialization class test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_BINARYSERIALIZATION_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_BINARYSERIALIZATION_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <vector>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/CompressedMatrixView.h>
+#include <blaze/math/CustomMatrix.h>
+#include <blaze/math/CustomVector.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/serialization/BinarySerialization.h>
+#include <blaze/util/MemoryMap.h>
+#include <blaze/util/Random.h>
+#include <blazetest/system/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace binaryserialization {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the binary serialization.
+//
+// This class represents a test suite for the binary serialization of dense vectors, dense
+// matrices and sparse matrices (see the writeBinary(), mapDenseVector(), mapDenseMatrix() and
+// mapSparseMatrix() functions). It performs a series of runtime tests on temporary binary files
+// in the current working directory, which are removed after the tests.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testDenseVector ();
+   void testDenseMatrix ();
+   void testSparseMatrix();
+   void testCopyOnWrite ();
+   void testFailures    ();
+
+   template< typename Type, bool TF >
+   void runDenseVectorTest( size_t n );
+
+   template< typename Type, bool SO >
+   void runDenseMatrixTest( size_t m, size_t n );
+
+   template< typename Type, bool SO >
+   void runSparseMatrixTest( size_t m, size_t n );
+
+   template< typename T1, typename T2 >
+   void checkResult( const T1& result, const T2& reference, const std::string& file ) const;
+
+   template< typename Mapping >
+   void checkInvalidFile( const std::string& file, Mapping mapping, const std::string& message );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename Type >
+   static Type value();
+
+   static std::vector<char> readFile( const std::string& file );
+   static void writeFile( const std::string& file, const std::vector<char>& bytes );
+   static void patchFile( const std::string& file, const std::vector<char>& bytes,
+                          size_t offset, uint64_t value );
+   static void removeFiles();
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   using cdouble = blaze::complex<double>;  //!< Double precision complex test type.
+   //**********************************************************************************************
+
+   //**Member constants****************************************************************************
+   /*!\name Member constants */
+   //@{
+   static const char* const fileA;  //!< The name of the first temporary binary file.
+   static const char* const fileB;  //!< The name of the second temporary binary file.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Round trip test of the binary serialization of a dense vector.
+//
+// \param n The size of the vector.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function writes a randomly initialized dense vector into a binary file, maps the file
+// back into memory and compares the mapped vector with the original vector. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type  // Data type of the vector elements
+        , bool TF >      // Transpose flag
+void ClassTest::runDenseVectorTest( size_t n )
+{
+   blaze::DynamicVector<Type,TF> ref( n );
+   for( Type& element : ref ) element = value<Type>();
+
+   blaze::writeBinary( fileA, ref );
+
+   blaze::MemoryMap map;
+   const blaze::CustomVector<Type,blaze::aligned,blaze::unpadded,TF> x(
+      blaze::mapDenseVector<Type,TF>( fileA, map ) );
+
+   checkResult( x, ref, fileA );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Round trip test of the binary serialization of a dense matrix.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function writes a randomly initialized dense matrix and a dense matrix expression into
+// a binary file, maps the file back into memory and compares the mapped matrix with the
+// original matrix. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool SO >      // Storage order
+void ClassTest::runDenseMatrixTest( size_t m, size_t n )
+{
+   blaze::DynamicMatrix<Type,SO> ref( m, n );
+   for( size_t i=0UL; i<m; ++i )
+      for( size_t j=0UL; j<n; ++j )
+         ref(i,j) = value<Type>();
+
+   {
+      blaze::writeBinary( fileA, ref );
+
+      blaze::MemoryMap map;
+      const blaze::CustomMatrix<Type,blaze::aligned,blaze::unpadded,SO> A(
+         blaze::mapDenseMatrix<Type,SO>( fileA, map ) );
+
+      checkResult( A, ref, fileA );
+   }
+
+   {
+      blaze::writeBinary( fileA, blaze::trans( ref ) );
+
+      blaze::MemoryMap map;
+      const blaze::CustomMatrix<Type,blaze::aligned,blaze::unpadded,!SO> A(
+         blaze::mapDenseMatrix<Type,!SO>( fileA, map ) );
+
+      checkResult( A, blaze::DynamicMatrix<Type,!SO>( trans( ref ) ), fileA );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Round trip test of the binary serialization of a sparse matrix.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function writes a randomly initialized compressed matrix into a binary file, maps the
+// file back into memory and compares the mapped view with the original matrix. Additionally,
+// the mapped view is used in sparse matrix/dense vector and transpose dense vector/sparse
+// matrix multiplications. Since all values are small integers, the results are exact
+// independent of the order of the summation. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool SO >      // Storage order
+void ClassTest::runSparseMatrixTest( size_t m, size_t n )
+{
+   blaze::CompressedMatrix<Type,SO> ref( m, n );
+   for( size_t i=0UL; i<m; ++i ) {
+      if( i % 5UL == 2UL ) continue;
+      for( size_t k=0UL; k<4UL && n>0UL; ++k )
+         ref(i,blaze::rand<size_t>( 0UL, n-1UL )) = value<Type>();
+   }
+
+   blaze::writeBinary( fileA, ref );
+
+   blaze::MemoryMap map;
+   const blaze::CompressedMatrixView<Type,SO> A( blaze::mapSparseMatrix<Type,SO>( fileA, map ) );
+
+   checkResult( A, ref, fileA );
+
+   if( A.nonZeros() != ref.nonZeros() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of non-zero elements\n"
+          << " Details:\n"
+          << "   File: " << fileA << "\n"
+          << "   Number of non-zeros         : " << A.nonZeros() << "\n"
+          << "   Expected number of non-zeros: " << ref.nonZeros() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   blaze::DynamicVector<Type,blaze::columnVector> x( n );
+   blaze::DynamicVector<Type,blaze::rowVector> z( m );
+   for( Type& element : x ) element = value<Type>();
+   for( Type& element : z ) element = value<Type>();
+
+   {
+      const blaze::DynamicVector<Type,blaze::columnVector> y( A * x );
+      checkResult( y, eval( ref * x ), fileA );
+   }
+
+   {
+      const blaze::DynamicVector<Type,blaze::rowVector> y( z * A );
+      checkResult( y, eval( z * ref ), fileA );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Comparison of a mapped vector or matrix with the expected result.
+//
+// \param result The mapped vector or matrix.
+// \param reference The expected result.
+// \param file The name of the mapped file.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the given result with the given reference. In case they differ, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename T1    // Type of the result
+        , typename T2 >  // Type of the reference
+void ClassTest::checkResult( const T1& result, const T2& reference, const std::string& file ) const
+{
+   if( result != reference ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Comparison with the expected result failed\n"
+          << " Details:\n"
+          << "   File: " << file << "\n"
+          << "   Result type:\n"
+          << "     " << typeid( T1 ).name() << "\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << reference << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking that the given file is rejected by the given mapping.
+//
+// \param file The name of the binary file.
+// \param mapping The mapping of the binary file.
+// \param message The expected part of the error message.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that mapping the given file by means of the given mapping function
+// results in a \a std::runtime_error exception with the given message. In case no exception
+// or a different exception is thrown, a \a std::runtime_error exception is thrown.
+*/
+template< typename Mapping >  // Type of the mapping function
+void ClassTest::checkInvalidFile( const std::string& file, Mapping mapping, const std::string& message )
+{
+   try {
+      blaze::MemoryMap map;
+      mapping( file, map );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Mapping an invalid binary file succeeded\n"
+          << " Details:\n"
+          << "   File            : " << file << "\n"
+          << "   Expected message: " << message << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& ex ) {
+      if( std::string( ex.what() ).find( message ) == std::string::npos )
+         throw;
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns a random non-zero small integer value of the given type.
+//
+// \return The random value.
+*/
+template< typename Type >  // Data type of the value
+Type ClassTest::value()
+{
+   return Type( blaze::rand<int>( 1, 4 ) * ( blaze::rand<int>( 0, 1 ) ? 1 : -1 ) );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the binary serialization.
+//
+// \return void
+*/
+void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the BinarySerialization class test.
+*/
+#define RUN_BINARYSERIALIZATION_CLASS_TEST \
+   blazetest::mathtest::binaryserialization::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace binaryserialization
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -118,6 +118,10 @@ class ClassTest
    void testTranspose   ();
    void testCTranspose  ();
    void testIsDefault   ();
+   void testIndexType   ();
+
+   template< bool SO, typename IT >
+   void testIndexType( const std::string& label );
 
    template< typename Type >
    void checkRows( const Type& matrix, size_t expectedRows ) const;
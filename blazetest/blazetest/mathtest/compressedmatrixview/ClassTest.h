@@ -0,0 +1,699 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/compressedmatrixview/ClassTest.h
+//  \brief Header file for the CompressedMatrixView class test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_COMPRESSEDMATRIXVIEW_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_COMPRESSEDMATRIXVIEW_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <vector>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/CompressedMatrixView.h>
+#include <blaze/math/constraints/SparseMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/typetraits/IsColumnMajorMatrix.h>
+#include <blaze/util/Random.h>
+#include <blazetest/system/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace compressedmatrixview {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the CompressedMatrixView class template.
+//
+// This class represents a test suite for the blaze::CompressedMatrixView class template. All
+// views refer to the element and offset arrays of a randomly initialized compressed matrix of
+// the same storage order and index type, which serves as reference.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testConstructors  ();
+   void testAt            ();
+   void testLookup        ();
+   void testSwap          ();
+   void testConversion    ();
+   void testMultiplication();
+
+   template< typename Type, bool SO, typename IT >
+   void runLookupTest( size_t m, size_t n );
+
+   template< typename Type, bool SO, typename IT >
+   void runConversionTest( size_t m, size_t n );
+
+   template< typename Type, bool SO, typename IT >
+   void runMultiplicationTest( size_t m, size_t n );
+
+   template< typename Type >
+   void checkRows( const Type& matrix, size_t expectedRows ) const;
+
+   template< typename Type >
+   void checkColumns( const Type& matrix, size_t expectedColumns ) const;
+
+   template< typename Type >
+   void checkNonZeros( const Type& matrix, size_t expectedNonZeros ) const;
+
+   template< typename MT1, typename MT2 >
+   void checkMatrix( const MT1& matrix, const MT2& reference ) const;
+
+   template< typename VT1, typename VT2 >
+   void checkVector( const VT1& result, const VT2& reference ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename Type, bool SO, typename IT >
+   static blaze::CompressedMatrix<Type,SO,IT> createMatrix( size_t m, size_t n );
+
+   template< typename Type, bool SO, typename IT >
+   static void copyArrays( const blaze::CompressedMatrix<Type,SO,IT>& A,
+                           std::vector< blaze::ValueIndexPair<Type,IT> >& elements,
+                           std::vector<uint64_t>& offsets );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   using VT   = blaze::CompressedMatrixView<double,blaze::rowMajor>;           //!< Type of the row-major view.
+   using TVT  = blaze::CompressedMatrixView<double,blaze::columnMajor>;        //!< Type of the column-major view.
+   using VT32 = blaze::CompressedMatrixView<double,blaze::rowMajor,uint32_t>;  //!< Row-major view with 32-bit indices.
+   using RMT  = blaze::CompressedMatrix<double,blaze::rowMajor>;               //!< Row-major reference matrix type.
+   using CMT  = blaze::CompressedMatrix<double,blaze::columnMajor>;            //!< Column-major reference matrix type.
+   using ET   = blaze::ValueIndexPair<double,size_t>;                          //!< Type of the value-index-pairs.
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_SPARSE_MATRIX_TYPE( VT   );
+   BLAZE_CONSTRAINT_MUST_BE_SPARSE_MATRIX_TYPE( TVT  );
+   BLAZE_CONSTRAINT_MUST_BE_SPARSE_MATRIX_TYPE( VT32 );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the lookup functions with a randomly initialized matrix.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the function call operator and the find(), lowerBound() and
+// upperBound() member functions of a view with the according functions of the compressed
+// matrix, whose arrays are referenced by the view. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+void ClassTest::runLookupTest( size_t m, size_t n )
+{
+   const blaze::CompressedMatrix<Type,SO,IT> ref( createMatrix<Type,SO,IT>( m, n ) );
+
+   std::vector< blaze::ValueIndexPair<Type,IT> > elements;
+   std::vector<uint64_t> offsets;
+   copyArrays( ref, elements, offsets );
+
+   const blaze::CompressedMatrixView<Type,SO,IT> view( elements.data(), offsets.data(), m, n );
+
+   checkMatrix( view, ref );
+
+   for( size_t i=0UL; i<m; ++i ) {
+      for( size_t j=0UL; j<n; ++j )
+      {
+         const size_t k( SO ? j : i );
+
+         const auto found( view.find( i, j ) );
+         const auto lower( view.lowerBound( i, j ) );
+         const auto upper( view.upperBound( i, j ) );
+
+         const auto refFound( ref.find( i, j ) );
+         const auto refLower( ref.lowerBound( i, j ) );
+         const auto refUpper( ref.upperBound( i, j ) );
+
+         if( view(i,j) != ref(i,j) ||
+             ( found == view.end( k ) ) != ( refFound == ref.end( k ) ) ||
+             ( found != view.end( k ) && ( found->index() != refFound->index() || found->value() != refFound->value() ) ) ||
+             ( lower == view.end( k ) ) != ( refLower == ref.end( k ) ) ||
+             ( lower != view.end( k ) && lower->index() != refLower->index() ) ||
+             ( upper == view.end( k ) ) != ( refUpper == ref.end( k ) ) ||
+             ( upper != view.end( k ) && upper->index() != refUpper->index() ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Lookup of element (" << i << "," << j << ") failed\n"
+                << " Details:\n"
+                << "   View type:\n"
+                << "     " << typeid( view ).name() << "\n"
+                << "   Expected result:\n" << ref << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the conversion of a view into other matrix types.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function uses a view on the arrays of a randomly initialized compressed matrix as
+// operand of the construction of and the assignment to compressed and dense matrices of
+// both storage orders. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+void ClassTest::runConversionTest( size_t m, size_t n )
+{
+   const blaze::CompressedMatrix<Type,SO,IT> ref( createMatrix<Type,SO,IT>( m, n ) );
+
+   std::vector< blaze::ValueIndexPair<Type,IT> > elements;
+   std::vector<uint64_t> offsets;
+   copyArrays( ref, elements, offsets );
+
+   const blaze::CompressedMatrixView<Type,SO,IT> view( elements.data(), offsets.data(), m, n );
+
+   {
+      const blaze::CompressedMatrix<Type,SO,IT> A( view );
+      checkMatrix( A, ref );
+   }
+
+   {
+      const blaze::CompressedMatrix<Type,!SO> A( view );
+      checkMatrix( A, blaze::CompressedMatrix<Type,!SO>( ref ) );
+   }
+
+   {
+      blaze::CompressedMatrix<Type,SO,IT> A( 3UL, 5UL );
+      A(1,2) = Type(1);
+      A = view;
+      checkMatrix( A, ref );
+
+      A += view;
+      checkMatrix( A, blaze::CompressedMatrix<Type,SO,IT>( Type(2) * ref ) );
+
+      A -= view;
+      checkMatrix( A, ref );
+   }
+
+   {
+      const blaze::DynamicMatrix<Type,blaze::rowMajor> A( view );
+      const blaze::DynamicMatrix<Type,blaze::columnMajor> B( view );
+
+      if( A != ref || B != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Conversion to a dense matrix failed\n"
+             << " Details:\n"
+             << "   View type:\n"
+             << "     " << typeid( view ).name() << "\n"
+             << "   Row-major result:\n" << A << "\n"
+             << "   Column-major result:\n" << B << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the multiplication of a view with a randomly initialized matrix.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the sparse matrix/dense vector multiplication and the transpose
+// dense vector/sparse matrix multiplication of a view with the according multiplications of
+// the compressed matrix, whose arrays are referenced by the view. The plain, addition and
+// subtraction assignments as well as a scaled multiplication are tested. Since all values are
+// small integers, the results are exact independent of the order of the summation.
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+void ClassTest::runMultiplicationTest( size_t m, size_t n )
+{
+   const blaze::CompressedMatrix<Type,SO,IT> ref( createMatrix<Type,SO,IT>( m, n ) );
+
+   std::vector< blaze::ValueIndexPair<Type,IT> > elements;
+   std::vector<uint64_t> offsets;
+   copyArrays( ref, elements, offsets );
+
+   const blaze::CompressedMatrixView<Type,SO,IT> view( elements.data(), offsets.data(), m, n );
+
+   blaze::DynamicVector<Type,blaze::columnVector> x( n );
+   blaze::DynamicVector<Type,blaze::rowVector> z( m );
+   for( Type& element : x ) element = Type( blaze::rand<int>( -4, 4 ) );
+   for( Type& element : z ) element = Type( blaze::rand<int>( -4, 4 ) );
+
+   {
+      blaze::DynamicVector<Type,blaze::columnVector> y;
+      y = view * x;
+      checkVector( y, eval( ref * x ) );
+
+      y += view * x;
+      checkVector( y, eval( Type(2) * ( ref * x ) ) );
+
+      y -= view * x;
+      checkVector( y, eval( ref * x ) );
+
+      y = Type(3) * ( view * x );
+      checkVector( y, eval( Type(3) * ( ref * x ) ) );
+   }
+
+   {
+      blaze::DynamicVector<Type,blaze::rowVector> y;
+      y = z * view;
+      checkVector( y, eval( z * ref ) );
+
+      y += z * view;
+      checkVector( y, eval( Type(2) * ( z * ref ) ) );
+
+      y -= z * view;
+      checkVector( y, eval( z * ref ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the number of rows of the given matrix.
+//
+// \param matrix The matrix to be checked.
+// \param expectedRows The expected number of rows of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the number of rows of the given matrix. In case the actual number of
+// rows does not correspond to the given expected number of rows, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename Type >  // Type of the matrix
+void ClassTest::checkRows( const Type& matrix, size_t expectedRows ) const
+{
+   if( matrix.rows() != expectedRows ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of rows detected\n"
+          << " Details:\n"
+          << "   Number of rows         : " << matrix.rows() << "\n"
+          << "   Expected number of rows: " << expectedRows << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the number of columns of the given matrix.
+//
+// \param matrix The matrix to be checked.
+// \param expectedColumns The expected number of columns of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the number of columns of the given matrix. In case the actual number of
+// columns does not correspond to the given expected number of columns, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename Type >  // Type of the matrix
+void ClassTest::checkColumns( const Type& matrix, size_t expectedColumns ) const
+{
+   if( matrix.columns() != expectedColumns ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of columns detected\n"
+          << " Details:\n"
+          << "   Number of columns         : " << matrix.columns() << "\n"
+          << "   Expected number of columns: " << expectedColumns << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the number of non-zero elements of the given matrix.
+//
+// \param matrix The matrix to be checked.
+// \param expectedNonZeros The expected number of non-zero elements of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the number of non-zero elements of the given matrix. In case the
+// actual number of non-zero elements does not correspond to the given expected number,
+// a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Type of the matrix
+void ClassTest::checkNonZeros( const Type& matrix, size_t expectedNonZeros ) const
+{
+   if( matrix.nonZeros() != expectedNonZeros ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of non-zero elements\n"
+          << " Details:\n"
+          << "   Number of non-zeros         : " << matrix.nonZeros() << "\n"
+          << "   Expected number of non-zeros: " << expectedNonZeros << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   if( matrix.capacity() < matrix.nonZeros() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid capacity detected\n"
+          << " Details:\n"
+          << "   Number of non-zeros: " << matrix.nonZeros() << "\n"
+          << "   Capacity           : " << matrix.capacity() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Comparison of a sparse matrix with a reference matrix of the same storage order.
+//
+// \param matrix The sparse matrix to be checked.
+// \param reference The compressed reference matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the dimensions, the number of non-zero elements and all elements of
+// the given sparse matrix with the given reference matrix. Additionally it checks that the
+// iterators of each row (or column) traverse exactly the non-zero elements of the reference
+// row (or column) in ascending order of their indices. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename MT1    // Type of the sparse matrix
+        , typename MT2 >  // Type of the reference matrix
+void ClassTest::checkMatrix( const MT1& matrix, const MT2& reference ) const
+{
+   constexpr bool SO( blaze::IsColumnMajorMatrix_v<MT2> );
+
+   checkRows    ( matrix, reference.rows()     );
+   checkColumns ( matrix, reference.columns()  );
+   checkNonZeros( matrix, reference.nonZeros() );
+
+   if( matrix != reference ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Matrix comparison failed\n"
+          << " Details:\n"
+          << "   Matrix type:\n"
+          << "     " << typeid( MT1 ).name() << "\n"
+          << "   Result:\n" << matrix << "\n"
+          << "   Expected result:\n" << reference << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   const size_t N( SO ? reference.columns() : reference.rows() );
+
+   for( size_t i=0UL; i<N; ++i )
+   {
+      if( matrix.nonZeros( i ) != reference.nonZeros( i ) || matrix.capacity( i ) < matrix.nonZeros( i ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of non-zero elements in " << ( SO ? "column " : "row " ) << i << "\n"
+             << " Details:\n"
+             << "   Number of non-zeros         : " << matrix.nonZeros( i ) << "\n"
+             << "   Expected number of non-zeros: " << reference.nonZeros( i ) << "\n"
+             << "   Capacity                    : " << matrix.capacity( i ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      auto element( matrix.begin( i ) );
+      for( auto ref=reference.begin( i ); ref!=reference.end( i ); ++ref, ++element )
+      {
+         if( element == matrix.end( i ) || element->index() != ref->index() || element->value() != ref->value() ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Iteration over " << ( SO ? "column " : "row " ) << i << " failed\n"
+                << " Details:\n"
+                << "   Expected index: " << ref->index() << "\n"
+                << "   Expected value: " << ref->value() << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      if( element != matrix.end( i ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Iteration over " << ( SO ? "column " : "row " ) << i << " failed\n"
+             << " Details:\n"
+             << "   Additional elements detected after the last non-zero element\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Comparison of the result of a multiplication with the expected result.
+//
+// \param result The computed result vector.
+// \param reference The expected result vector.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the given result vector with the given reference vector. In case
+// the vectors differ, a \a std::runtime_error exception is thrown.
+*/
+template< typename VT1    // Type of the result vector
+        , typename VT2 >  // Type of the reference vector
+void ClassTest::checkVector( const VT1& result, const VT2& reference ) const
+{
+   if( result.size() != reference.size() || result != reference ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Multiplication failed\n"
+          << " Details:\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << reference << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creation of a randomly initialized compressed matrix.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \return The randomly initialized compressed matrix.
+//
+// This function creates a compressed matrix with rows of strongly varying length. Every
+// seventh row is empty, every eleventh row is (almost) completely filled, and all other rows
+// contain a random number of up to 8 non-zero elements. All values are small integers, which
+// keeps all multiplications exact.
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+blaze::CompressedMatrix<Type,SO,IT> ClassTest::createMatrix( size_t m, size_t n )
+{
+   blaze::CompressedMatrix<Type,blaze::rowMajor> A( m, n );
+
+   if( n == 0UL )
+      return blaze::CompressedMatrix<Type,SO,IT>( A );
+
+   for( size_t i=0UL; i<m; ++i )
+   {
+      if( i % 7UL == 3UL )
+         continue;
+
+      const size_t nonzeros( ( i % 11UL == 5UL )?( n ):( blaze::rand<size_t>( 1UL, 8UL ) ) );
+
+      for( size_t k=0UL; k<nonzeros; ++k ) {
+         A(i,blaze::rand<size_t>( 0UL, n-1UL )) = Type( blaze::rand<int>( 1, 9 ) );
+      }
+   }
+
+   return blaze::CompressedMatrix<Type,SO,IT>( A );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Copying the non-zero elements of a compressed matrix into separate arrays.
+//
+// \param A The compressed matrix to be copied.
+// \param elements The resulting array of value-index-pairs.
+// \param offsets The resulting array of row/column offsets.
+// \return void
+//
+// This function copies the non-zero elements of the given compressed matrix into the given
+// element array and the offset of the first element of each row (or column) into the given
+// offset array, as expected by the CompressedMatrixView class template.
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+void ClassTest::copyArrays( const blaze::CompressedMatrix<Type,SO,IT>& A,
+                            std::vector< blaze::ValueIndexPair<Type,IT> >& elements,
+                            std::vector<uint64_t>& offsets )
+{
+   const size_t N( SO ? A.columns() : A.rows() );
+
+   elements.clear();
+   elements.reserve( A.nonZeros() );
+   offsets.assign( N+1UL, 0U );
+
+   for( size_t i=0UL; i<N; ++i ) {
+      offsets[i] = elements.size();
+      for( auto element=A.begin( i ); element!=A.end( i ); ++element ) {
+         elements.emplace_back( element->value(), element->index() );
+      }
+   }
+
+   offsets[N] = elements.size();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the functionality of the CompressedMatrixView class template.
+//
+// \return void
+*/
+void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the CompressedMatrixView class test.
+*/
+#define RUN_COMPRESSEDMATRIXVIEW_CLASS_TEST \
+   blazetest::mathtest::compressedmatrixview::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace compressedmatrixview
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,287 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/compressedstream/ClassTest.h
+//  \brief Header file for the compressed stream class test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_COMPRESSEDSTREAM_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_COMPRESSEDSTREAM_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <vector>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/serialization/CompressedStream.h>
+#include <blaze/math/Serialization.h>
+#include <blaze/util/Random.h>
+#include <blaze/util/Serialization.h>
+#include <blazetest/system/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace compressedstream {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the compressed streams.
+//
+// This class represents a test suite for the CompressedOStream and CompressedIStream classes.
+// It performs round trips of vectors, matrices and raw data through compressed archives and
+// streams, and it checks that truncated and corrupt compressed streams are rejected.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testArchive    ();
+   void testFile       ();
+   void testCompression();
+   void testTruncated  ();
+   void testCorrupt    ();
+
+   template< typename Type >
+   void runArchiveTest( size_t m, size_t n, size_t typeSize );
+
+   template< typename T1, typename T2 >
+   void checkResult( const T1& result, const T2& reference ) const;
+
+   void checkStream( const std::string& stream, const std::vector<char>& data ) const;
+   void checkCorrupt( const std::string& stream, size_t size ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static std::string compress( const std::vector<char>& data, size_t typeSize );
+   static size_t decompress( const std::string& stream, std::vector<char>& data );
+   static void patch( std::string& stream, size_t offset, uint32_t value );
+   static std::vector<char> integerData( size_t n );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Round trip test of a compressed archive.
+//
+// \param m The number of rows of the matrices.
+// \param n The number of columns of the matrices.
+// \param typeSize The element size for the byte shuffle filter.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function writes randomly initialized dense and sparse matrices, a dense vector and a
+// scalar into a compressed archive, reads them back and compares them with the originals.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Data type of the elements
+void ClassTest::runArchiveTest( size_t m, size_t n, size_t typeSize )
+{
+   blaze::DynamicMatrix<Type,blaze::rowMajor> A( m, n );
+   blaze::CompressedMatrix<Type,blaze::columnMajor> B( n, m );
+   blaze::DynamicVector<Type,blaze::columnVector> x( n );
+   const Type s( blaze::rand<Type>() );
+
+   blaze::randomize( A );
+   blaze::randomize( B, blaze::rand<size_t>( 0UL, m*n/10UL ) );
+   blaze::randomize( x );
+
+   std::ostringstream oss;
+
+   {
+      blaze::Archive<blaze::CompressedOStream> archive( oss, typeSize );
+      archive << A << B << s << x;
+
+      if( !archive ) {
+         std::ostringstream msg;
+         msg << " Test: " << test_ << "\n"
+             << " Error: Writing to the compressed archive failed\n"
+             << " Details:\n"
+             << "   Element type: " << typeid( Type ).name() << "\n"
+             << "   Size        : " << m << "x" << n << "\n"
+             << "   Type size   : " << typeSize << "\n";
+         throw std::runtime_error( msg.str() );
+      }
+   }
+
+   blaze::DynamicMatrix<Type,blaze::rowMajor> A2;
+   blaze::CompressedMatrix<Type,blaze::columnMajor> B2;
+   blaze::DynamicVector<Type,blaze::columnVector> x2;
+   Type s2{};
+
+   std::istringstream iss( oss.str() );
+   blaze::CompressedIStream stream( iss );
+   blaze::Archive<blaze::CompressedIStream> archive( stream );
+   archive >> A2 >> B2 >> s2 >> x2;
+
+   checkResult( A2, A );
+   checkResult( B2, B );
+   checkResult( x2, x );
+
+   if( !archive || s2 != s || stream.get() != std::char_traits<char>::eof() ) {
+      std::ostringstream msg;
+      msg << " Test: " << test_ << "\n"
+          << " Error: Reading from the compressed archive failed\n"
+          << " Details:\n"
+          << "   Element type   : " << typeid( Type ).name() << "\n"
+          << "   Size           : " << m << "x" << n << "\n"
+          << "   Type size      : " << typeSize << "\n"
+          << "   Scalar         : " << s2 << "\n"
+          << "   Expected scalar: " << s << "\n";
+      throw std::runtime_error( msg.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Comparison of a deserialized vector or matrix with the expected result.
+//
+// \param result The deserialized vector or matrix.
+// \param reference The expected result.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the given result with the given reference. In case they differ, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename T1    // Type of the result
+        , typename T2 >  // Type of the reference
+void ClassTest::checkResult( const T1& result, const T2& reference ) const
+{
+   if( result != reference ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Comparison with the expected result failed\n"
+          << " Details:\n"
+          << "   Result type:\n"
+          << "     " << typeid( T1 ).name() << "\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << reference << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the compressed streams.
+//
+// \return void
+*/
+void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the compressed stream class test.
+*/
+#define RUN_COMPRESSEDSTREAM_CLASS_TEST \
+   blazetest::mathtest::compressedstream::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace compressedstream
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -112,6 +112,10 @@ class ClassTest
    void testLowerBound  ();
    void testUpperBound  ();
    void testIsDefault   ();
+   void testIndexType   ();
+
+   template< typename IT >
+   void testIndexType( const std::string& label );
 
    template< typename Type >
    void checkSize( const Type& vector, size_t expectedSize ) const;
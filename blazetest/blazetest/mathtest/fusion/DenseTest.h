@@ -0,0 +1,334 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/fusion/DenseTest.h
+//  \brief Header file for the fused dense assignment test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_FUSION_DENSETEST_H_
+#define _BLAZETEST_MATHTEST_FUSION_DENSETEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/Fusion.h>
+#include <blaze/math/Subvector.h>
+#include <blazetest/system/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace fusion {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all fused dense assignment tests.
+//
+// This class represents a test suite for the fuse() and lazy() functions. It performs a series
+// of fused (compound) assignments to dense vectors and dense matrices and compares the results
+// to the results of the according sequence of individual assignments.
+*/
+class DenseTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit DenseTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   using VT = blaze::DynamicVector<double,blaze::columnVector>;  //!< Type of the dense vectors.
+   //**********************************************************************************************
+
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testVectorAssign();
+   void testVectorCompoundAssign();
+
+   template< bool SO >
+   void testMatrixAssign();
+
+   void testInvalidSizes();
+   void testAliasing();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename ST >
+   size_t blockSize( const ST& statement, size_t count ) const;
+
+   template< typename VT2, bool TF >
+   void initialize( blaze::DenseVector<VT2,TF>& vector, int offset ) const;
+
+   template< typename MT, bool SO >
+   void initialize( blaze::DenseMatrix<MT,SO>& matrix, int offset ) const;
+
+   template< typename T1, typename T2 >
+   void checkResult( const T1& result, const T2& expected, const std::string& name ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of fused assignments to row-major or column-major dense matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests a chain of fused (compound) assignments to dense matrices with the given
+// storage order. The matrices are partitioned into blocks of rows (row-major) or columns
+// (column-major). The extent of the partitioned dimension is chosen such that it is not a
+// multiple of the block size. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+template< bool SO >  // Storage order of the target matrices
+void DenseTest::testMatrixAssign()
+{
+   using blaze::fuse;
+   using blaze::lazy;
+
+   using MT  = blaze::DynamicMatrix<double,SO>;
+   using OMT = blaze::DynamicMatrix<double,!SO>;
+
+   test_ = ( SO == blaze::rowMajor ? "Row-major fused matrix assignment"
+                                   : "Column-major fused matrix assignment" );
+
+   const size_t K( 13UL );
+
+   MT probe( K, K );
+   const size_t block ( blockSize( lazy( probe ) = probe, 4UL ) );
+   const size_t extent( 2UL*block + 5UL );
+   const size_t m( SO == blaze::rowMajor ? extent : K );
+   const size_t n( SO == blaze::rowMajor ? K : extent );
+
+   MT  A( m, n ), Y( m, n ), Z( m, n );
+   OMT B( m, n );
+
+   initialize( A, 1 );
+   initialize( B, 2 );
+   initialize( Y, 3 );
+   initialize( Z, 4 );
+
+   MT refY( Y ), refZ( Z );
+
+   refY  = A + B;
+   refZ  = refY - 2.0*A;
+   refY += refZ;
+   refZ -= A % refY;
+
+   fuse( lazy( Y ) = A + B,
+         lazy( Z ) = Y - 2.0*A,
+         lazy( Y ) += Z,
+         lazy( Z ) -= A % Y );
+
+   checkResult( Y, refY, "Y" );
+   checkResult( Z, refZ, "Z" );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the block size of a fused evaluation.
+//
+// \param statement The first statement of the fused evaluation.
+// \param count The total number of statements of the fused evaluation.
+// \return The number of elements/rows/columns per block.
+*/
+template< typename ST >  // Type of the statement
+size_t DenseTest::blockSize( const ST& statement, size_t count ) const
+{
+   return blaze::fusedBlockSize( statement, count, blaze::isFusedRowwise( statement.target() ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initializes the given dense vector with small integral values.
+//
+// \param vector The vector to be initialized.
+// \param offset The offset of the generated values.
+// \return void
+//
+// The values are chosen such that all results of the tests are exactly representable.
+*/
+template< typename VT2  // Type of the vector
+        , bool TF >      // Transpose flag
+void DenseTest::initialize( blaze::DenseVector<VT2,TF>& vector, int offset ) const
+{
+   for( size_t i=0UL; i<(~vector).size(); ++i ) {
+      (~vector)[i] = static_cast<int>( ( i + offset ) % 7UL ) - 3;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initializes the given dense matrix with small integral values.
+//
+// \param matrix The matrix to be initialized.
+// \param offset The offset of the generated values.
+// \return void
+//
+// The values are chosen such that all results of the tests are exactly representable.
+*/
+template< typename MT  // Type of the matrix
+        , bool SO >    // Storage order
+void DenseTest::initialize( blaze::DenseMatrix<MT,SO>& matrix, int offset ) const
+{
+   for( size_t i=0UL; i<(~matrix).rows(); ++i ) {
+      for( size_t j=0UL; j<(~matrix).columns(); ++j ) {
+         (~matrix)(i,j) = static_cast<int>( ( 3UL*i + j + offset ) % 7UL ) - 3;
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checks the result of a fused evaluation.
+//
+// \param result The result of the fused evaluation.
+// \param expected The result of the according individual assignments.
+// \param name The name of the checked target.
+// \return void
+// \exception std::runtime_error Invalid result detected.
+*/
+template< typename T1    // Type of the result
+        , typename T2 >  // Type of the expected result
+void DenseTest::checkResult( const T1& result, const T2& expected, const std::string& name ) const
+{
+   if( result != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid result of fused evaluation\n"
+          << " Details:\n"
+          << "   Target: " << name << "\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the fused dense assignments.
+//
+// \return void
+*/
+void runTest()
+{
+   DenseTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the fused dense assignment test.
+*/
+#define RUN_FUSION_DENSE_TEST \
+   blazetest::mathtest::fusion::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace fusion
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,366 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/inversion/NativeTest.h
+//  \brief Header file for the native dense matrix inversion test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_INVERSION_NATIVETEST_H_
+#define _BLAZETEST_MATHTEST_INVERSION_NATIVETEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/DenseMatrix.h>
+#include <blaze/math/InversionFlag.h>
+#include <blaze/system/Blocking.h>
+#include <blaze/util/Random.h>
+#include <blazetest/system/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace inversion {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the native dense matrix inversion tests.
+//
+// This class represents a test suite for the native (LAPACK-free) dense matrix inversion, which
+// is used in case the LAPACK mode is disabled (see the BLAZE_LAPACK_MODE switch). It performs a
+// series of inversions of matrices of both storage orders, whose sizes are chosen across the
+// boundaries of the blocked factorization kernels.
+*/
+class NativeTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit NativeTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename Type >
+   void testStorageOrder();
+
+   template< blaze::InversionFlag IF, typename Type >
+   void testRandom( size_t n );
+
+   template< blaze::InversionFlag IF, typename Type >
+   void testSingular( size_t n );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename Type >
+   void initialize( Type& A, blaze::InversionFlag flag );
+   //@}
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   using cdouble = blaze::complex<double>;  //!< Double precision complex test type.
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the native inversion for matrices of the given type.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the native inversion of general, symmetric, Hermitian, positive definite
+// and triangular matrices of the given type. The sizes are chosen across the boundaries of the
+// block size of the blocked factorization (see the FACTORIZATION_BLOCK_SIZE setting), including
+// the block size of the debug mode. Since matrices up to \f$ 6 \times 6 \f$ are inverted by
+// closed-form kernels, all sizes are larger than 6. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void NativeTest::testStorageOrder()
+{
+   const size_t B( blaze::FACTORIZATION_BLOCK_SIZE );
+   const size_t sizes[] = { 7UL, 8UL, 9UL, 13UL, B-1UL, B, B+1UL, 2UL*B+3UL };
+
+   for( size_t n : sizes )
+   {
+      testRandom< blaze::asGeneral  , Type >( n );
+      testRandom< blaze::asSymmetric, Type >( n );
+      testRandom< blaze::asHermitian, Type >( n );
+      testRandom< blaze::byLLH      , Type >( n );
+      testRandom< blaze::asLower    , Type >( n );
+      testRandom< blaze::asUniLower , Type >( n );
+      testRandom< blaze::asUpper    , Type >( n );
+      testRandom< blaze::asUniUpper , Type >( n );
+
+      testSingular< blaze::asGeneral  , Type >( n );
+      testSingular< blaze::asSymmetric, Type >( n );
+      testSingular< blaze::byLLH      , Type >( n );
+      testSingular< blaze::asLower    , Type >( n );
+      testSingular< blaze::asUpper    , Type >( n );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the native inversion with a random matrix.
+//
+// \param n The number of rows and columns of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the native inversion of a random \f$ n \times n \f$ matrix of the given
+// type, which fits the given inversion flag. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< blaze::InversionFlag IF  // Inversion algorithm
+        , typename Type >          // Type of the matrix
+void NativeTest::testRandom( size_t n )
+{
+   test_ = "Native dense matrix inversion";
+
+   Type A( n, n );
+   initialize( A, IF );
+
+   Type B( A );
+   blaze::invert<IF>( B );
+
+   const Type I( A * B );
+
+   if( !isIdentity( I ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Inversion failed\n"
+          << " Details:\n"
+          << "   Matrix type:\n"
+          << "     " << typeid( Type ).name() << "\n"
+          << "   Element type:\n"
+          << "     " << typeid( blaze::ElementType_t<Type> ).name() << "\n"
+          << "   Inversion flag: " << IF << "\n"
+          << "   Dimensions: " << n << "x" << n << "\n"
+          << "   Matrix:\n" << A << "\n"
+          << "   Inverse:\n" << B << "\n"
+          << "   A * inv(A):\n" << I << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the native inversion with a singular matrix.
+//
+// \param n The number of rows and columns of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the native inversion rejects a singular \f$ n \times n \f$ matrix of
+// the given type by means of a \a std::runtime_error exception. The matrix fits the given
+// inversion flag, but its row and column in the middle of the matrix are zero, i.e. the
+// singularity is only detected after the first blocks have been factorized. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+template< blaze::InversionFlag IF  // Inversion algorithm
+        , typename Type >          // Type of the matrix
+void NativeTest::testSingular( size_t n )
+{
+   test_ = "Native dense matrix inversion of a singular matrix";
+
+   Type A( n, n );
+   initialize( A, IF );
+   reset( row( A, n/2UL ) );
+   reset( column( A, n/2UL ) );
+
+   try {
+      Type B( A );
+      blaze::invert<IF>( B );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Inversion of a singular matrix succeeded\n"
+          << " Details:\n"
+          << "   Matrix type:\n"
+          << "     " << typeid( Type ).name() << "\n"
+          << "   Inversion flag: " << IF << "\n"
+          << "   Matrix:\n" << A << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& ex ) {
+      if( std::string( ex.what() ).find( "singular" ) == std::string::npos &&
+          std::string( ex.what() ).find( "non-positive-definite" ) == std::string::npos )
+         throw;
+   }
+}
+//*************************************************************************************************
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initializes the given matrix according to the given inversion flag.
+//
+// \param A The matrix to be initialized.
+// \param flag The inversion flag.
+// \return void
+//
+// This function initializes the given matrix with random values such that it fits the given
+// inversion flag. All resulting matrices are diagonally dominant and therefore well-conditioned.
+*/
+template< typename Type >
+void NativeTest::initialize( Type& A, blaze::InversionFlag flag )
+{
+   using ET = blaze::ElementType_t<Type>;
+
+   const size_t n( A.rows() );
+
+   randomize( A );
+
+   switch( flag ) {
+      case blaze::asSymmetric: A = A + trans( A ); break;
+      case blaze::asHermitian: A = A + ctrans( A ); break;
+      case blaze::byLLH      : makePositiveDefinite( A ); break;
+      case blaze::asUniLower :
+      case blaze::asUniUpper : A /= ET( 2*n ); break;
+      default: break;
+   }
+
+   for( size_t i=0UL; i<n; ++i ) {
+      if( flag == blaze::asUniLower || flag == blaze::asUniUpper )
+         A(i,i) = ET( 1 );
+      else if( flag != blaze::byLLH )
+         A(i,i) += ET( 2*n );
+   }
+
+   if( flag == blaze::asLower || flag == blaze::asUniLower ) {
+      for( size_t i=0UL; i<n; ++i )
+         for( size_t j=i+1UL; j<n; ++j )
+            A(i,j) = ET( 0 );
+   }
+   else if( flag == blaze::asUpper || flag == blaze::asUniUpper ) {
+      for( size_t i=0UL; i<n; ++i )
+         for( size_t j=0UL; j<i; ++j )
+            A(i,j) = ET( 0 );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the native dense matrix inversion.
+//
+// \return void
+*/
+void runTest()
+{
+   NativeTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the native dense matrix inversion test.
+*/
+#define RUN_NATIVE_INVERSION_TEST \
+   blazetest::mathtest::inversion::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace inversion
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
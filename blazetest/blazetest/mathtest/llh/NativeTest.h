@@ -0,0 +1,310 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/llh/NativeTest.h
+//  \brief Header file for the native dense matrix LLH test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_LLH_NATIVETEST_H_
+#define _BLAZETEST_MATHTEST_LLH_NATIVETEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/DenseMatrix.h>
+#include <blaze/system/Blocking.h>
+#include <blaze/util/Random.h>
+#include <blazetest/system/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace llh {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the native dense matrix LLH tests.
+//
+// This class represents a test suite for the native (LAPACK-free) dense matrix LLH decomposition,
+// which is used in case the LAPACK mode is disabled (see the BLAZE_LAPACK_MODE switch). It
+// performs a series of LLH decompositions of matrices of both storage orders, whose sizes are
+// chosen across the boundaries of the blocked factorization kernels.
+*/
+class NativeTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit NativeTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename Type >
+   void testStorageOrder();
+
+   template< typename Type >
+   void testRandom( size_t n );
+
+   template< typename Type >
+   void testNonPositiveDefinite( size_t n );
+   //@}
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   using cdouble = blaze::complex<double>;  //!< Double precision complex test type.
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the native LLH decomposition for matrices of the given type.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the native LLH decomposition for matrices of the given type. The sizes
+// are chosen across the boundaries of the block size of the blocked factorization (see the
+// FACTORIZATION_BLOCK_SIZE setting), including the block size of the debug mode. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void NativeTest::testStorageOrder()
+{
+   const size_t B( blaze::FACTORIZATION_BLOCK_SIZE );
+   const size_t sizes[] = { 1UL, 3UL, 4UL, 5UL, 9UL, B-1UL, B, B+1UL, 2UL*B+3UL };
+
+   for( size_t n : sizes ) {
+      testRandom<Type>( n );
+      testNonPositiveDefinite<Type>( n );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the native LLH decomposition with a random positive definite matrix.
+//
+// \param n The number of rows and columns of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the native LLH decomposition for a random positive definite
+// \f$ n \times n \f$ matrix of the given type. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void NativeTest::testRandom( size_t n )
+{
+   test_ = "Native LLH decomposition";
+
+   Type A( n, n ), L;
+   makePositiveDefinite( A );
+
+   blaze::llh( A, L );
+
+   const Type LLH( L * ctrans( L ) );
+
+   if( LLH != A || !isLower( L ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: LLH decomposition failed\n"
+          << " Details:\n"
+          << "   Matrix type:\n"
+          << "     " << typeid( Type ).name() << "\n"
+          << "   Element type:\n"
+          << "     " << typeid( blaze::ElementType_t<Type> ).name() << "\n"
+          << "   Dimensions: " << n << "x" << n << "\n"
+          << "   L:\n" << L << "\n"
+          << "   Result:\n" << LLH << "\n"
+          << "   Expected result:\n" << A << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the native LLH decomposition with non-positive-definite matrices.
+//
+// \param n The number of rows and columns of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the native LLH decomposition rejects a Hermitian indefinite and a
+// singular positive semi-definite \f$ n \times n \f$ matrix of the given type by means of a
+// \a std::runtime_error exception. The offending diagonal element is placed in the middle of
+// the matrix, i.e. it is only detected after the first blocks have been factorized. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void NativeTest::testNonPositiveDefinite( size_t n )
+{
+   using ET = blaze::ElementType_t<Type>;
+
+   const size_t k( n/2UL );
+
+   {
+      test_ = "Native LLH decomposition of an indefinite matrix";
+
+      Type A( n, n ), L;
+      makePositiveDefinite( A );
+      A(k,k) = ET( -1 );
+
+      try {
+         blaze::llh( A, L );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: LLH decomposition of an indefinite matrix succeeded\n"
+             << " Details:\n"
+             << "   Matrix type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Matrix:\n" << A << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::runtime_error& ex ) {
+         if( std::string( ex.what() ).find( "non-positive-definite" ) == std::string::npos )
+            throw;
+      }
+   }
+
+   {
+      test_ = "Native LLH decomposition of a singular matrix";
+
+      Type A( n, n ), L;
+      makePositiveDefinite( A );
+      reset( row( A, k ) );
+      reset( column( A, k ) );
+
+      try {
+         blaze::llh( A, L );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: LLH decomposition of a singular matrix succeeded\n"
+             << " Details:\n"
+             << "   Matrix type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Matrix:\n" << A << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::runtime_error& ex ) {
+         if( std::string( ex.what() ).find( "non-positive-definite" ) == std::string::npos )
+            throw;
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the native dense matrix LLH.
+//
+// \return void
+*/
+void runTest()
+{
+   NativeTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the native dense matrix LLH test.
+*/
+#define RUN_NATIVE_LLH_TEST \
+   blazetest::mathtest::llh::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace llh
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,405 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/lse/NativeTest.h
+//  \brief Header file for the native dense matrix LSE test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_LSE_NATIVETEST_H_
+#define _BLAZETEST_MATHTEST_LSE_NATIVETEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/DenseMatrix.h>
+#include <blaze/math/DenseVector.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/system/Blocking.h>
+#include <blaze/util/Random.h>
+#include <blazetest/system/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace lse {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the native dense matrix LSE tests.
+//
+// This class represents a test suite for the native (LAPACK-free) solution of dense linear
+// systems of equations, which is used in case the LAPACK mode is disabled (see the
+// BLAZE_LAPACK_MODE switch). It solves a series of linear systems with system matrices of both
+// storage orders, whose sizes are chosen across the boundaries of the blocked factorization
+// kernels.
+*/
+class NativeTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit NativeTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename Type >
+   void testStorageOrder();
+
+   template< typename Type >
+   void testRandom( size_t n );
+
+   template< typename Type >
+   void testSingular( size_t n );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename Type, typename Decl >
+   void checkSolve( const Type& A, Decl decl, const std::string& kind );
+
+   template< typename Type, typename Decl >
+   void checkSingular( const Type& A, Decl decl, const std::string& kind );
+   //@}
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   using cdouble = blaze::complex<double>;  //!< Double precision complex test type.
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the native linear system solvers for matrices of the given type.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the native solution of general, symmetric and Hermitian linear systems
+// with system matrices of the given type. The sizes are chosen across the boundaries of the
+// block size of the blocked factorization (see the FACTORIZATION_BLOCK_SIZE setting), including
+// the block size of the debug mode. Since systems up to \f$ 6 \times 6 \f$ are solved by
+// closed-form kernels, all sizes are larger than 6. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void NativeTest::testStorageOrder()
+{
+   const size_t B( blaze::FACTORIZATION_BLOCK_SIZE );
+   const size_t sizes[] = { 7UL, 8UL, 9UL, 13UL, B-1UL, B, B+1UL, 2UL*B+3UL };
+
+   for( size_t n : sizes ) {
+      testRandom<Type>( n );
+      testSingular<Type>( n );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the native linear system solvers with a random system matrix.
+//
+// \param n The number of rows and columns of the system matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the native solution of linear systems with a random, well-conditioned
+// \f$ n \times n \f$ system matrix of the given type, which is used as general, symmetric and
+// Hermitian system matrix. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+template< typename Type >
+void NativeTest::testRandom( size_t n )
+{
+   using ET = blaze::ElementType_t<Type>;
+
+   test_ = "Native dense matrix LSE";
+
+   Type A( n, n );
+   randomize( A );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      A(i,i) += ET( 2*n );
+   }
+
+   checkSolve( A, []( const Type& M ){ return M; }, "general" );
+
+   const Type S( A + trans( A ) );
+   checkSolve( S, []( const Type& M ){ return declsym( M ); }, "symmetric" );
+
+   const Type H( A + ctrans( A ) );
+   checkSolve( H, []( const Type& M ){ return declherm( M ); }, "Hermitian" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the native linear system solvers with a singular system matrix.
+//
+// \param n The number of rows and columns of the system matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the native linear system solvers reject a singular \f$ n \times n \f$
+// system matrix of the given type by means of a \a std::runtime_error exception. The row and
+// column in the middle of the system matrix are zero, i.e. the singularity is only detected
+// after the first blocks have been factorized. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void NativeTest::testSingular( size_t n )
+{
+   test_ = "Native dense matrix LSE with a singular system matrix";
+
+   Type A( n, n );
+   randomize( A );
+   A = A + ctrans( A );
+   reset( row( A, n/2UL ) );
+   reset( column( A, n/2UL ) );
+
+   checkSingular( A, []( const Type& M ){ return M; }, "general" );
+   checkSingular( A, []( const Type& M ){ return declherm( M ); }, "Hermitian" );
+}
+//*************************************************************************************************
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checks the solution of linear systems with the given system matrix.
+//
+// \param A The system matrix.
+// \param decl Function object declaring the properties of the system matrix.
+// \param kind The kind of the system matrix.
+// \return void
+// \exception std::runtime_error Invalid solution detected.
+//
+// This function solves a linear system with a single right-hand side vector and a linear system
+// with multiple right-hand sides (in both storage orders) and checks the residuals.
+*/
+template< typename Type    // Type of the system matrix
+        , typename Decl >  // Type of the declaration function object
+void NativeTest::checkSolve( const Type& A, Decl decl, const std::string& kind )
+{
+   using ET = blaze::ElementType_t<Type>;
+
+   const size_t n( A.rows() );
+
+   blaze::DynamicVector<ET,blaze::columnVector> b( n ), x;
+   randomize( b );
+
+   blaze::solve( decl( A ), x, b );
+
+   if( A * x != b ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Solving the " << kind << " LSE failed\n"
+          << " Details:\n"
+          << "   Matrix type:\n"
+          << "     " << typeid( Type ).name() << "\n"
+          << "   Dimensions: " << n << "x" << n << "\n"
+          << "   System matrix:\n" << A << "\n"
+          << "   Right-hand side:\n" << b << "\n"
+          << "   Solution:\n" << x << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   blaze::DynamicMatrix<ET,blaze::rowMajor> B1( n, 3UL ), X1;
+   blaze::DynamicMatrix<ET,blaze::columnMajor> B2( n, 5UL ), X2;
+   randomize( B1 );
+   randomize( B2 );
+
+   blaze::solve( decl( A ), X1, B1 );
+   blaze::solve( decl( A ), X2, B2 );
+
+   if( A * X1 != B1 || A * X2 != B2 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Solving the " << kind << " LSE with multiple right-hand sides failed\n"
+          << " Details:\n"
+          << "   Matrix type:\n"
+          << "     " << typeid( Type ).name() << "\n"
+          << "   Dimensions: " << n << "x" << n << "\n"
+          << "   System matrix:\n" << A << "\n"
+          << "   Row-major right-hand side:\n" << B1 << "\n"
+          << "   Row-major solution:\n" << X1 << "\n"
+          << "   Column-major right-hand side:\n" << B2 << "\n"
+          << "   Column-major solution:\n" << X2 << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checks that linear systems with the given singular system matrix are rejected.
+//
+// \param A The singular system matrix.
+// \param decl Function object declaring the properties of the system matrix.
+// \param kind The kind of the system matrix.
+// \return void
+// \exception std::runtime_error Singular system matrix not detected.
+*/
+template< typename Type    // Type of the system matrix
+        , typename Decl >  // Type of the declaration function object
+void NativeTest::checkSingular( const Type& A, Decl decl, const std::string& kind )
+{
+   using ET = blaze::ElementType_t<Type>;
+
+   const size_t n( A.rows() );
+
+   blaze::DynamicVector<ET,blaze::columnVector> b( n ), x;
+   blaze::DynamicMatrix<ET,blaze::columnMajor> B( n, 3UL ), X;
+   randomize( b );
+   randomize( B );
+
+   bool vectorFailed( false ), matrixFailed( false );
+
+   try {
+      blaze::solve( decl( A ), x, b );
+   }
+   catch( std::runtime_error& ) {
+      vectorFailed = true;
+   }
+
+   try {
+      blaze::solve( decl( A ), X, B );
+   }
+   catch( std::runtime_error& ) {
+      matrixFailed = true;
+   }
+
+   if( !vectorFailed || !matrixFailed ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Solving the singular " << kind << " LSE succeeded\n"
+          << " Details:\n"
+          << "   Matrix type:\n"
+          << "     " << typeid( Type ).name() << "\n"
+          << "   Single right-hand side rejected: " << vectorFailed << "\n"
+          << "   Multiple right-hand sides rejected: " << matrixFailed << "\n"
+          << "   System matrix:\n" << A << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the native dense matrix LSE.
+//
+// \return void
+*/
+void runTest()
+{
+   NativeTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the native dense matrix LSE test.
+*/
+#define RUN_NATIVE_LSE_TEST \
+   blazetest::mathtest::lse::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace lse
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
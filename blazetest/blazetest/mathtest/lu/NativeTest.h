@@ -0,0 +1,331 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/lu/NativeTest.h
+//  \brief Header file for the native dense matrix LU test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_LU_NATIVETEST_H_
+#define _BLAZETEST_MATHTEST_LU_NATIVETEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/DenseMatrix.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/system/Blocking.h>
+#include <blaze/util/Random.h>
+#include <blazetest/system/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace lu {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the native dense matrix LU tests.
+//
+// This class represents a test suite for the native (LAPACK-free) dense matrix LU decomposition,
+// which is used in case the LAPACK mode is disabled (see the BLAZE_LAPACK_MODE switch). It
+// performs a series of LU decompositions of matrices of both storage orders, whose sizes are
+// chosen across the boundaries of the blocked factorization kernels.
+*/
+class NativeTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit NativeTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename Type >
+   void testRandom( size_t m, size_t n );
+
+   template< typename Type >
+   void testSingular( size_t n );
+
+   template< typename Type >
+   void testStorageOrder();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename Type >
+   void checkDecomposition( const Type& A, const Type& L, const Type& U, const Type& P );
+   //@}
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   using cdouble = blaze::complex<double>;  //!< Double precision complex test type.
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the native LU decomposition for matrices of the given type.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the native LU decomposition for square and non-square matrices of the
+// given type. The sizes are chosen across the boundaries of the block size of the blocked
+// factorization (see the FACTORIZATION_BLOCK_SIZE setting), including the block size of the
+// debug mode. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void NativeTest::testStorageOrder()
+{
+   const size_t B( blaze::FACTORIZATION_BLOCK_SIZE );
+   const size_t sizes[] = { 1UL, 3UL, 4UL, 5UL, 9UL, B-1UL, B, B+1UL, 2UL*B+3UL };
+
+   for( size_t n : sizes ) {
+      testRandom<Type>( n, n );
+      testRandom<Type>( n+2UL, n );
+      testRandom<Type>( n, n+2UL );
+   }
+
+   for( size_t n : sizes ) {
+      testSingular<Type>( n );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the native LU decomposition with a randomly initialized matrix.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the native LU decomposition for a randomly initialized \f$ m \times n \f$
+// matrix of the given type. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+template< typename Type >
+void NativeTest::testRandom( size_t m, size_t n )
+{
+   test_ = "Native LU decomposition";
+
+   Type A( m, n ), L, U, P;
+   randomize( A );
+
+   blaze::lu( A, L, U, P );
+
+   checkDecomposition( A, L, U, P );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the native LU decomposition with a singular matrix.
+//
+// \param n The number of rows and columns of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the native LU decomposition for a singular \f$ n \times n \f$ matrix of
+// the given type, whose row and column in the middle of the matrix are zero. The decomposition
+// of a singular matrix is expected to succeed and to result in an exactly singular triangular
+// factor. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void NativeTest::testSingular( size_t n )
+{
+   test_ = "Native LU decomposition of a singular matrix";
+
+   Type A( n, n ), L, U, P;
+   randomize( A );
+   reset( row( A, n/2UL ) );
+   reset( column( A, n/2UL ) );
+
+   blaze::lu( A, L, U, P );
+
+   checkDecomposition( A, L, U, P );
+
+   bool singular( false );
+   for( size_t i=0UL; i<n; ++i ) {
+      if( blaze::isDefault( L(i,i) ) || blaze::isDefault( U(i,i) ) )
+         singular = true;
+   }
+
+   if( !singular ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Non-singular triangular factors detected\n"
+          << " Details:\n"
+          << "   Matrix type:\n"
+          << "     " << typeid( Type ).name() << "\n"
+          << "   Matrix:\n" << A << "\n"
+          << "   L:\n" << L << "\n"
+          << "   U:\n" << U << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checks the result of an LU decomposition.
+//
+// \param A The decomposed matrix.
+// \param L The resulting lower triangular matrix.
+// \param U The resulting upper triangular matrix.
+// \param P The resulting permutation matrix.
+// \return void
+// \exception std::runtime_error LU decomposition error detected.
+*/
+template< typename Type >
+void NativeTest::checkDecomposition( const Type& A, const Type& L, const Type& U, const Type& P )
+{
+   Type LU( L*U );
+
+   if( blaze::IsRowMajorMatrix<Type>::value ) {
+      LU = LU * P;
+   }
+   else {
+      LU = P * LU;
+   }
+
+   if( LU != A ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: LU decomposition failed\n"
+          << " Details:\n"
+          << "   Matrix type:\n"
+          << "     " << typeid( Type ).name() << "\n"
+          << "   Element type:\n"
+          << "     " << typeid( blaze::ElementType_t<Type> ).name() << "\n"
+          << "   Dimensions: " << A.rows() << "x" << A.columns() << "\n"
+          << "   Result:\n" << LU << "\n"
+          << "   Expected result:\n" << A << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the native dense matrix LU decomposition.
+//
+// \return void
+*/
+void runTest()
+{
+   NativeTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the native dense matrix LU test.
+*/
+#define RUN_NATIVE_LU_TEST \
+   blazetest::mathtest::lu::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace lu
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,444 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/mappedmatrix/ClassTest.h
+//  \brief Header file for the MappedMatrix class test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_MAPPEDMATRIX_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_MAPPEDMATRIX_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <vector>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/MappedMatrix.h>
+#include <blaze/util/Random.h>
+#include <blazetest/system/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace mappedmatrix {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the MappedMatrix class template.
+//
+// This class represents a test suite for the blaze::MappedMatrix class template. It performs
+// a series of runtime tests on temporary matrix files in the current working directory, which
+// are removed after every test. All tests are performed for tile sizes of 1 and 5 elements and
+// the number of elements in a SIMD vector, and for matrices whose size is not a multiple of
+// the tile size.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testConstructors();
+   void testFileFormat  ();
+   void testReopen      ();
+   void testHeaderChecks();
+   void testAt          ();
+   void testMove        ();
+   void testAssign      ();
+   void testGemv        ();
+   void testGemm        ();
+
+   template< typename Type >
+   void checkSize( const blaze::MappedMatrix<Type>& matrix, size_t m, size_t n, size_t tileSize ) const;
+
+   template< typename Type >
+   void checkMatrix( const blaze::MappedMatrix<Type>& matrix,
+                     const blaze::DynamicMatrix<Type,blaze::rowMajor>& reference ) const;
+
+   template< typename Type >
+   void checkPadding( const blaze::MappedMatrix<Type>& matrix ) const;
+
+   template< typename Type >
+   void checkInvalidFile( const std::string& file, const std::string& message );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename Type >
+   static blaze::DynamicMatrix<Type,blaze::rowMajor> createMatrix( size_t m, size_t n );
+
+   template< typename Type >
+   static blaze::DynamicVector<Type,blaze::columnVector> createVector( size_t n );
+
+   static std::vector<char> readFile( const std::string& file );
+   static void writeFile( const std::string& file, const std::vector<char>& bytes );
+   static void removeFiles();
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   using MT  = blaze::MappedMatrix<double>;                       //!< Type of the mapped matrix.
+   using DMT = blaze::DynamicMatrix<double,blaze::rowMajor>;      //!< Type of the reference matrix.
+   using DVT = blaze::DynamicVector<double,blaze::columnVector>;  //!< Type of the dense vectors.
+   //**********************************************************************************************
+
+   //**Member constants****************************************************************************
+   /*!\name Member constants */
+   //@{
+   static const char* const fileA;  //!< The name of the first temporary matrix file.
+   static const char* const fileB;  //!< The name of the second temporary matrix file.
+   static const char* const fileC;  //!< The name of the third temporary matrix file.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the size and the tile size of the given matrix.
+//
+// \param matrix The matrix to be checked.
+// \param m The expected number of rows of the matrix.
+// \param n The expected number of columns of the matrix.
+// \param tileSize The requested tile size of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the number of rows and columns of the given matrix, its tile size,
+// which is expected to be the requested tile size rounded up to a multiple of the number of
+// elements in a SIMD vector, and the according number of rows and columns of tiles. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Data type of the matrix
+void ClassTest::checkSize( const blaze::MappedMatrix<Type>& matrix, size_t m, size_t n, size_t tileSize ) const
+{
+   constexpr size_t S( blaze::MappedMatrix<Type>::SIMDSIZE );
+
+   const size_t T( ( ( tileSize + S - 1UL ) / S ) * S );
+
+   const size_t tm( T == 0UL ? 0UL : ( m + T - 1UL ) / T );
+   const size_t tn( T == 0UL ? 0UL : ( n + T - 1UL ) / T );
+
+   if( matrix.rows() != m || matrix.columns() != n || matrix.tileSize() != T ||
+       matrix.tileRows() != tm || matrix.tileColumns() != tn ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid matrix size detected\n"
+          << " Details:\n"
+          << "   Size               : " << matrix.rows() << "x" << matrix.columns() << "\n"
+          << "   Expected size      : " << m << "x" << n << "\n"
+          << "   Tile size          : " << matrix.tileSize() << "\n"
+          << "   Expected tile size : " << T << "\n"
+          << "   Number of tiles    : " << matrix.tileRows() << "x" << matrix.tileColumns() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Comparison of a mapped matrix with a reference matrix.
+//
+// \param matrix The mapped matrix to be checked.
+// \param reference The reference matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the size and all elements of the given mapped matrix with the given
+// reference matrix. Additionally it checks that the padding elements of all tiles are zero.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Data type of the matrix
+void ClassTest::checkMatrix( const blaze::MappedMatrix<Type>& matrix,
+                             const blaze::DynamicMatrix<Type,blaze::rowMajor>& reference ) const
+{
+   if( matrix.rows() != reference.rows() || matrix.columns() != reference.columns() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid matrix size detected\n"
+          << " Details:\n"
+          << "   Size         : " << matrix.rows() << "x" << matrix.columns() << "\n"
+          << "   Expected size: " << reference.rows() << "x" << reference.columns() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   for( size_t i=0UL; i<reference.rows(); ++i ) {
+      for( size_t j=0UL; j<reference.columns(); ++j ) {
+         if( !blaze::equal( matrix(i,j), reference(i,j) ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Matrix comparison failed\n"
+                << " Details:\n"
+                << "   Element type:\n"
+                << "     " << typeid( Type ).name() << "\n"
+                << "   Size     : " << matrix.rows() << "x" << matrix.columns() << "\n"
+                << "   Tile size: " << matrix.tileSize() << "\n"
+                << "   Element (" << i << "," << j << "): " << matrix(i,j)
+                << " (expected " << reference(i,j) << ")\n"
+                << "   Expected result:\n" << reference << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   checkPadding( matrix );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the padding elements of the given matrix.
+//
+// \param matrix The mapped matrix to be checked.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that all elements of the tiles at the bottom and right edge of the given
+// matrix that lie outside of the matrix are zero. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Data type of the matrix
+void ClassTest::checkPadding( const blaze::MappedMatrix<Type>& matrix ) const
+{
+   const size_t T( matrix.tileSize() );
+
+   for( size_t ti=0UL; ti<matrix.tileRows(); ++ti ) {
+      for( size_t tj=0UL; tj<matrix.tileColumns(); ++tj )
+      {
+         const Type* tile( matrix.data( ti, tj ) );
+
+         for( size_t i=0UL; i<T; ++i ) {
+            for( size_t j=0UL; j<T; ++j )
+            {
+               if( ti*T+i < matrix.rows() && tj*T+j < matrix.columns() )
+                  continue;
+
+               if( !blaze::isDefault( tile[i*T+j] ) ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Non-zero padding element detected\n"
+                      << " Details:\n"
+                      << "   Size     : " << matrix.rows() << "x" << matrix.columns() << "\n"
+                      << "   Tile size: " << T << "\n"
+                      << "   Tile     : (" << ti << "," << tj << ")\n"
+                      << "   Element  : (" << i << "," << j << ") = " << tile[i*T+j] << "\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking that the given file is rejected as matrix file.
+//
+// \param file The name of the matrix file.
+// \param message The expected part of the error message.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that opening the given file as a mapped matrix of the given element
+// type results in a \a std::runtime_error exception with the given message, both for reading
+// only and for reading and writing. In case no exception or a different exception is thrown,
+// a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Data type of the matrix
+void ClassTest::checkInvalidFile( const std::string& file, const std::string& message )
+{
+   for( bool writable : { false, true } )
+   {
+      try {
+         const blaze::MappedMatrix<Type> A( file, writable );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Opening an invalid matrix file succeeded\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Writable        : " << writable << "\n"
+             << "   Expected message: " << message << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::runtime_error& ex ) {
+         if( std::string( ex.what() ).find( message ) == std::string::npos )
+            throw;
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creation of a randomly initialized row-major dense matrix.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \return The randomly initialized matrix.
+//
+// All elements are non-zero small integers, which keeps all multiplications exact and makes
+// the padding elements distinguishable from the elements of the matrix.
+*/
+template< typename Type >  // Data type of the matrix
+blaze::DynamicMatrix<Type,blaze::rowMajor> ClassTest::createMatrix( size_t m, size_t n )
+{
+   blaze::DynamicMatrix<Type,blaze::rowMajor> A( m, n );
+
+   for( size_t i=0UL; i<m; ++i )
+      for( size_t j=0UL; j<n; ++j )
+         A(i,j) = Type( blaze::rand<int>( 1, 4 ) * ( blaze::rand<int>( 0, 1 ) ? 1 : -1 ) );
+
+   return A;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creation of a randomly initialized dense column vector.
+//
+// \param n The size of the vector.
+// \return The randomly initialized vector.
+*/
+template< typename Type >  // Data type of the vector
+blaze::DynamicVector<Type,blaze::columnVector> ClassTest::createVector( size_t n )
+{
+   blaze::DynamicVector<Type,blaze::columnVector> x( n );
+
+   for( size_t i=0UL; i<n; ++i )
+      x[i] = Type( blaze::rand<int>( -4, 4 ) );
+
+   return x;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the functionality of the MappedMatrix class template.
+//
+// \return void
+*/
+void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the MappedMatrix class test.
+*/
+#define RUN_MAPPEDMATRIX_CLASS_TEST \
+   blazetest::mathtest::mappedmatrix::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace mappedmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -299,8 +299,8 @@ void ClassTest::runDenseSubmatrixTests( const MT& src )
 // \exception std::runtime_error Error detected.
 //
 // This function tests the matrix (de-)serialization with the given matrix. The matrix is
-// serialized and deserialized several times, using instances of CompressedMatrix as destination
-// matrix type. In case an error is detected, a \a std::runtime_error exception is thrown.
+// serialized and deserialized several times, using instances of CompressedMatrix with both the
+// default and a 32-bit index type as destination matrix type. In case an error is detected, a \a std::runtime_error exception is thrown.
 */
 template< typename MT >  // Type of the matrix
 void ClassTest::runCompressedMatrixTests( const MT& src )
@@ -330,6 +330,16 @@ void ClassTest::runCompressedMatrixTests( const MT& src )
       randomize( dst );
       runTest( src, dst );
    }
+
+   {
+      blaze::CompressedMatrix<ET,blaze::rowMajor,uint32_t> dst;
+      runTest( src, dst );
+   }
+
+   {
+      blaze::CompressedMatrix<ET,blaze::columnMajor,uint32_t> dst;
+      runTest( src, dst );
+   }
 }
 //*************************************************************************************************
 
@@ -0,0 +1,661 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/simd/BuiltinMathTest.h
+//  \brief Header file for the test of the built-in SIMD math functions
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SIMD_BUILTINMATHTEST_H_
+#define _BLAZETEST_MATHTEST_SIMD_BUILTINMATHTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <blaze/math/SIMD.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Random.h>
+#include <blaze/util/typetraits/IsFloat.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace simd {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class template for the test of the built-in SIMD math functions.
+//
+// This class template represents the tests of the built-in SIMD implementations of the \c exp(),
+// \c log(), \c sin(), \c cos(), and \c tanh() functions for the floating point data type \a T
+// (see the BLAZE_USE_BUILTIN_SIMD_MATH switch). The accuracy of the functions is checked against
+// an extended precision reference, the special values (NaN, infinity, signed zero, denormal
+// values, and large arguments) against the behavior of the standard library.
+*/
+template< typename T >  // Data type of the built-in SIMD math test
+class BuiltinMathTest : private blaze::NonCopyable
+{
+ private:
+   //**Type definitions****************************************************************************
+   using SIMD     = blaze::SIMDTrait<T>;  //!< SIMD trait for the given numeric type.
+   using SIMDType = typename SIMD::Type;  //!< SIMD type for the given numeric type.
+   using Limits   = std::numeric_limits<T>;  //!< Numeric limits of the given numeric type.
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   static constexpr size_t SIMDSIZE = SIMD::size;  //!< Number of elements in a single SIMD vector.
+   static constexpr size_t N = 65536UL;            //!< Number of random arguments per test.
+   static constexpr bool   isFloat = blaze::IsFloat_v<T>;  //!< Single precision test flag.
+   //**********************************************************************************************
+
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit BuiltinMathTest();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testExp          ();
+   void testLog          ();
+   void testSin          ();
+   void testCos          ();
+   void testTanh         ();
+   void testSpecialValues();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename OP, typename REF >
+   void checkAccuracy( std::vector<T> args, OP op, REF ref, double maxUlp );
+
+   template< typename OP >
+   void checkSpecialValue( T arg, OP op, T expected );
+
+   template< typename OP >
+   static std::vector<T> evaluate( const std::vector<T>& args, OP op );
+
+   static std::vector<T> uniform( size_t n, T lower, T upper );
+   static std::vector<T> logUniform( size_t n, int minExp, int maxExp, bool negative );
+   static std::vector<T> join( std::vector<T> a, const std::vector<T>& b );
+   static double         ulpError( T value, long double ref );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the BuiltinMathTest class template.
+//
+// \exception std::runtime_error Error detected.
+*/
+template< typename T >  // Data type of the built-in SIMD math test
+BuiltinMathTest<T>::BuiltinMathTest()
+   : test_()  // Label of the currently performed test
+{
+   testExp();
+   testLog();
+   testSin();
+   testCos();
+   testTanh();
+   testSpecialValues();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the accuracy of the built-in exp() function.
+//
+// \return void
+// \exception std::runtime_error Error in exp() computation detected.
+//
+// This function tests the accuracy of the built-in exp() function for arguments producing
+// normal and denormal results. In case the error exceeds 1 ULP (double precision: 2 ULP), a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename T >  // Data type of the built-in SIMD math test
+void BuiltinMathTest<T>::testExp()
+{
+   test_ = "Accuracy of the exp() function";
+
+   const T lower( isFloat ? T(-103.9) : T(-744.4) );
+   const T upper( isFloat ? T(  88.7) : T( 709.7) );
+
+   const std::vector<T> args( join( join( uniform( N, lower, upper ), uniform( N, T(-1), T(1) ) ),
+                                    logUniform( N/4UL, Limits::min_exponent, -2, true ) ) );
+
+   checkAccuracy( args, []( SIMDType a ) { return blaze::exp( a ); },
+                        []( long double a ) { return std::exp( a ); },
+                        isFloat ? 1.0 : 2.0 );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Testing the accuracy of the built-in log() function.
+//
+// \return void
+// \exception std::runtime_error Error in log() computation detected.
+//
+// This function tests the accuracy of the built-in log() function for normal and denormal
+// arguments and for arguments close to 1. In case the error exceeds 1 ULP, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename T >  // Data type of the built-in SIMD math test
+void BuiltinMathTest<T>::testLog()
+{
+   test_ = "Accuracy of the log() function";
+
+   const int minExp( Limits::min_exponent - Limits::digits + 1 );
+
+   const std::vector<T> args( join( logUniform( N, minExp, Limits::max_exponent, false ),
+                                    uniform( N, T(0.5), T(2) ) ) );
+
+   checkAccuracy( args, []( SIMDType a ) { return blaze::log( a ); },
+                        []( long double a ) { return std::log( a ); },
+                        1.0 );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Testing the accuracy of the built-in sin() function.
+//
+// \return void
+// \exception std::runtime_error Error in sin() computation detected.
+//
+// This function tests the accuracy of the built-in sin() function for small arguments, for
+// arguments up to \f$ 2^{20} \f$, and for large arguments handled by the scalar fallback. In
+// case the error exceeds 1 ULP (double precision: 2 ULP), a \a std::runtime_error exception is
+// thrown.
+*/
+template< typename T >  // Data type of the built-in SIMD math test
+void BuiltinMathTest<T>::testSin()
+{
+   test_ = "Accuracy of the sin() function";
+
+   const std::vector<T> args( join( join( uniform( N, T(-4), T(4) ), uniform( N, T(-1048576), T(1048576) ) ),
+                                    join( logUniform( N/4UL, Limits::min_exponent, -2, true ),
+                                          logUniform( N/64UL, 21, isFloat ? 100 : 1000, true ) ) ) );
+
+   checkAccuracy( args, []( SIMDType a ) { return blaze::sin( a ); },
+                        []( long double a ) { return std::sin( a ); },
+                        isFloat ? 1.0 : 2.0 );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Testing the accuracy of the built-in cos() function.
+//
+// \return void
+// \exception std::runtime_error Error in cos() computation detected.
+//
+// This function tests the accuracy of the built-in cos() function for small arguments, for
+// arguments up to \f$ 2^{20} \f$, and for large arguments handled by the scalar fallback. In
+// case the error exceeds 1 ULP (double precision: 2 ULP), a \a std::runtime_error exception is
+// thrown.
+*/
+template< typename T >  // Data type of the built-in SIMD math test
+void BuiltinMathTest<T>::testCos()
+{
+   test_ = "Accuracy of the cos() function";
+
+   const std::vector<T> args( join( join( uniform( N, T(-4), T(4) ), uniform( N, T(-1048576), T(1048576) ) ),
+                                    logUniform( N/64UL, 21, isFloat ? 100 : 1000, true ) ) );
+
+   checkAccuracy( args, []( SIMDType a ) { return blaze::cos( a ); },
+                        []( long double a ) { return std::cos( a ); },
+                        isFloat ? 1.0 : 2.0 );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Testing the accuracy of the built-in tanh() function.
+//
+// \return void
+// \exception std::runtime_error Error in tanh() computation detected.
+//
+// This function tests the accuracy of the built-in tanh() function for small (including
+// denormal) and moderate arguments. In case the error exceeds 2 ULP, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename T >  // Data type of the built-in SIMD math test
+void BuiltinMathTest<T>::testTanh()
+{
+   test_ = "Accuracy of the tanh() function";
+
+   const int minExp( Limits::min_exponent - Limits::digits + 1 );
+
+   const std::vector<T> args( join( uniform( N, T(-20), T(20) ),
+                                    logUniform( N, minExp, 0, true ) ) );
+
+   checkAccuracy( args, []( SIMDType a ) { return blaze::tanh( a ); },
+                        []( long double a ) { return std::tanh( a ); },
+                        2.0 );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Testing the special values of the built-in SIMD math functions.
+//
+// \return void
+// \exception std::runtime_error Error in the computation of a special value detected.
+//
+// This function tests the results of the built-in SIMD math functions for NaN, infinite,
+// signed zero, and denormal arguments. Each special value is tested within a vector of
+// ordinary arguments to detect any influence on the other elements. In case any error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename T >  // Data type of the built-in SIMD math test
+void BuiltinMathTest<T>::testSpecialValues()
+{
+   const auto expOp ( []( SIMDType a ) { return blaze::exp ( a ); } );
+   const auto logOp ( []( SIMDType a ) { return blaze::log ( a ); } );
+   const auto sinOp ( []( SIMDType a ) { return blaze::sin ( a ); } );
+   const auto cosOp ( []( SIMDType a ) { return blaze::cos ( a ); } );
+   const auto tanhOp( []( SIMDType a ) { return blaze::tanh( a ); } );
+
+   const T nan ( Limits::quiet_NaN() );
+   const T inf ( Limits::infinity() );
+   const T dmin( Limits::denorm_min() );
+   const T zero( 0 );
+
+   test_ = "Special values of the exp() function";
+   checkSpecialValue(  nan , expOp, nan  );
+   checkSpecialValue(  inf , expOp, inf  );
+   checkSpecialValue( -inf , expOp, zero );
+   checkSpecialValue(  zero, expOp, T(1) );
+   checkSpecialValue( -zero, expOp, T(1) );
+   checkSpecialValue( T(1000), expOp, inf  );
+   checkSpecialValue( T(-1000), expOp, zero );
+
+   test_ = "Special values of the log() function";
+   checkSpecialValue(  nan , logOp,  nan );
+   checkSpecialValue(  inf , logOp,  inf );
+   checkSpecialValue( -inf , logOp,  nan );
+   checkSpecialValue(  zero, logOp, -inf );
+   checkSpecialValue( -zero, logOp, -inf );
+   checkSpecialValue( T(-1), logOp,  nan );
+   checkSpecialValue( -dmin, logOp,  nan );
+   checkSpecialValue(  T(1), logOp, zero );
+
+   test_ = "Special values of the sin() function";
+   checkSpecialValue(  nan , sinOp,  nan  );
+   checkSpecialValue(  inf , sinOp,  nan  );
+   checkSpecialValue( -inf , sinOp,  nan  );
+   checkSpecialValue(  zero, sinOp,  zero );
+   checkSpecialValue( -zero, sinOp, -zero );
+   checkSpecialValue(  dmin, sinOp,  dmin );
+   checkSpecialValue( -dmin, sinOp, -dmin );
+
+   test_ = "Special values of the cos() function";
+   checkSpecialValue(  nan , cosOp, nan  );
+   checkSpecialValue(  inf , cosOp, nan  );
+   checkSpecialValue( -inf , cosOp, nan  );
+   checkSpecialValue(  zero, cosOp, T(1) );
+   checkSpecialValue( -zero, cosOp, T(1) );
+   checkSpecialValue(  dmin, cosOp, T(1) );
+
+   test_ = "Special values of the tanh() function";
+   checkSpecialValue(  nan , tanhOp,  nan  );
+   checkSpecialValue(  inf , tanhOp,  T(1) );
+   checkSpecialValue( -inf , tanhOp, -T(1) );
+   checkSpecialValue(  zero, tanhOp,  zero );
+   checkSpecialValue( -zero, tanhOp, -zero );
+   checkSpecialValue(  dmin, tanhOp,  dmin );
+   checkSpecialValue( -dmin, tanhOp, -dmin );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the accuracy of a built-in SIMD math function.
+//
+// \param args The arguments of the function.
+// \param op The built-in SIMD math function.
+// \param ref The extended precision reference function.
+// \param maxUlp The maximum permitted error in ULP.
+// \return void
+// \exception std::runtime_error Accuracy violation detected.
+//
+// The arguments are shuffled in order to mix arguments taking different code paths (as for
+// instance the scalar fallback for large arguments) within the same SIMD vector.
+*/
+template< typename T >    // Data type of the built-in SIMD math test
+template< typename OP     // Type of the built-in SIMD math function
+        , typename REF >  // Type of the reference function
+void BuiltinMathTest<T>::checkAccuracy( std::vector<T> args, OP op, REF ref, double maxUlp )
+{
+   std::shuffle( args.begin(), args.end(), std::mt19937( 42U ) );
+
+   const std::vector<T> results( evaluate( args, op ) );
+
+   for( size_t i=0UL; i<args.size(); ++i )
+   {
+      const long double expected( ref( static_cast<long double>( args[i] ) ) );
+      const double error( ulpError( results[i], expected ) );
+
+      if( !( error <= maxUlp ) ) {
+         std::ostringstream oss;
+         oss.precision( 20 );
+         oss << " Test: " << test_ << "\n"
+             << " Error: Accuracy violation detected\n"
+             << " Details:\n"
+             << "   Argument  = " << args[i] << "\n"
+             << "   Result    = " << results[i] << "\n"
+             << "   Reference = " << expected << "\n"
+             << "   Error     = " << error << " ULP (maximum: " << maxUlp << " ULP)\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of a built-in SIMD math function for a special value.
+//
+// \param arg The special argument.
+// \param op The built-in SIMD math function.
+// \param expected The expected result.
+// \return void
+// \exception std::runtime_error Incorrect result detected.
+//
+// The special argument is placed in each element of a vector of ordinary arguments in turn.
+// The result has to match the expected result including the sign of zero; NaN is expected to
+// propagate. The results of the ordinary arguments must not be affected by the special value.
+*/
+template< typename T >  // Data type of the built-in SIMD math test
+template< typename OP >  // Type of the built-in SIMD math function
+void BuiltinMathTest<T>::checkSpecialValue( T arg, OP op, T expected )
+{
+   std::vector<T> ordinary( SIMDSIZE );
+   for( size_t i=0UL; i<SIMDSIZE; ++i ) {
+      ordinary[i] = T(0.25) * T( i+1UL );
+   }
+
+   const std::vector<T> reference( evaluate( ordinary, op ) );
+
+   for( size_t pos=0UL; pos<SIMDSIZE; ++pos )
+   {
+      std::vector<T> args( ordinary );
+      args[pos] = arg;
+
+      const std::vector<T> results( evaluate( args, op ) );
+
+      for( size_t i=0UL; i<SIMDSIZE; ++i )
+      {
+         const bool valid( ( i != pos )
+                           ? ( results[i] == reference[i] )
+                           : ( std::isnan( expected )
+                               ? std::isnan( results[i] )
+                               : ( results[i] == expected &&
+                                   std::signbit( results[i] ) == std::signbit( expected ) ) ) );
+
+         if( !valid ) {
+            std::ostringstream oss;
+            oss.precision( 20 );
+            oss << " Test: " << test_ << "\n"
+                << " Error: Incorrect result for a special value detected\n"
+                << " Details:\n"
+                << "   Argument        = " << arg << " (element " << pos << ")\n"
+                << "   Element         = " << i << "\n"
+                << "   Result          = " << results[i] << "\n"
+                << "   Expected result = " << ( i == pos ? expected : reference[i] ) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Evaluation of a built-in SIMD math function for the given arguments.
+//
+// \param args The arguments of the function (padded to a multiple of the SIMD size).
+// \param op The built-in SIMD math function.
+// \return The results of the function.
+*/
+template< typename T >  // Data type of the built-in SIMD math test
+template< typename OP >  // Type of the built-in SIMD math function
+std::vector<T> BuiltinMathTest<T>::evaluate( const std::vector<T>& args, OP op )
+{
+   const size_t n( ( args.size() + SIMDSIZE - 1UL ) / SIMDSIZE * SIMDSIZE );
+
+   std::vector<T> in( args );
+   in.resize( n, T(1) );
+
+   std::vector<T> out( n );
+
+   for( size_t i=0UL; i<n; i+=SIMDSIZE ) {
+      blaze::storeu( out.data()+i, op( blaze::loadu( in.data()+i ) ) );
+   }
+
+   out.resize( args.size() );
+   return out;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creation of uniformly distributed random arguments.
+//
+// \param n The number of arguments.
+// \param lower The lower limit of the arguments.
+// \param upper The upper limit of the arguments.
+// \return The random arguments.
+*/
+template< typename T >  // Data type of the built-in SIMD math test
+std::vector<T> BuiltinMathTest<T>::uniform( size_t n, T lower, T upper )
+{
+   std::vector<T> args( n );
+   for( T& arg : args ) {
+      arg = blaze::rand<T>( lower, upper );
+   }
+   return args;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creation of random arguments with uniformly distributed binary exponents.
+//
+// \param n The number of arguments.
+// \param minExp The minimum binary exponent.
+// \param maxExp The maximum binary exponent.
+// \param negative \a true in case also negative arguments are created, \a false if not.
+// \return The random arguments.
+//
+// The arguments are of the form \f$ m 2^e \f$ with \f$ m \in [0.5,1) \f$ and \f$ e \in
+// [minExp,maxExp] \f$. Exponents below the minimum normal exponent result in denormal arguments.
+*/
+template< typename T >  // Data type of the built-in SIMD math test
+std::vector<T> BuiltinMathTest<T>::logUniform( size_t n, int minExp, int maxExp, bool negative )
+{
+   std::vector<T> args( n );
+   for( T& arg : args ) {
+      arg = std::ldexp( blaze::rand<T>( T(0.5), T(1) ), blaze::rand<int>( minExp, maxExp ) );
+      if( negative && blaze::rand<int>( 0, 1 ) == 1 )
+         arg = -arg;
+   }
+   return args;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Concatenation of two sets of arguments.
+//
+// \param a The first set of arguments.
+// \param b The second set of arguments.
+// \return The concatenated arguments.
+*/
+template< typename T >  // Data type of the built-in SIMD math test
+std::vector<T> BuiltinMathTest<T>::join( std::vector<T> a, const std::vector<T>& b )
+{
+   a.insert( a.end(), b.begin(), b.end() );
+   return a;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computation of the error of a result in units of the last place.
+//
+// \param value The computed result.
+// \param ref The extended precision reference result.
+// \return The error in ULP (infinite in case of a non-finite deviation).
+//
+// The ULP is determined by the binary exponent of the reference result; below the minimum
+// normal exponent the spacing of the denormal values is used.
+*/
+template< typename T >  // Data type of the built-in SIMD math test
+double BuiltinMathTest<T>::ulpError( T value, long double ref )
+{
+   if( std::isnan( ref ) )
+      return std::isnan( value ) ? 0.0 : Limits::infinity();
+
+   if( !std::isfinite( value ) || std::fabs( ref ) > static_cast<long double>( Limits::max() ) )
+      return ( static_cast<long double>( value ) == ref ) ? 0.0 : Limits::infinity();
+
+   int exp( 0 );
+   std::frexp( ref, &exp );
+
+   const long double ulp( std::ldexp( 1.0L, std::max( exp, Limits::min_exponent ) - Limits::digits ) );
+
+   return static_cast<double>( std::fabs( static_cast<long double>( value ) - ref ) / ulp );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the built-in SIMD math functions of a specific floating point data type.
+//
+// \return void
+*/
+template< typename T >  // Data type of the built-in SIMD math test
+void runBuiltinMathTest()
+{
+   BuiltinMathTest<T>();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of a built-in SIMD math test case.
+*/
+#define RUN_SIMD_BUILTINMATH_TEST( T ) \
+   blazetest::mathtest::simd::runBuiltinMathTest<T>()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace simd
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,566 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/simd/DispatchedKernelsTest.h
+//  \brief Header file for the test of the runtime dispatched dense kernels
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SIMD_DISPATCHEDKERNELSTEST_H_
+#define _BLAZETEST_MATHTEST_SIMD_DISPATCHEDKERNELSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/dense/DispatchedKernels.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/simd/SIMDLevel.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Random.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace simd {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class template for the test of the runtime dispatched dense kernels.
+//
+// This class template represents the tests of the runtime dispatched dense matrix/dense matrix
+// multiplication, dense matrix/dense vector multiplication, inner product, and summation kernels
+// for the floating point data type \a T. All SIMD levels supported by the executing CPU are
+// selected in turn via setSIMDLevel() and the results of the dispatched kernels are compared
+// to the results of the kernels selected at compile time.
+*/
+template< typename T >  // Data type of the dispatched kernels test
+class DispatchedKernelsTest : private blaze::NonCopyable
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit DispatchedKernelsTest();
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   ~DispatchedKernelsTest();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testMmm ( blaze::SIMDLevel level );
+   void testGemv( blaze::SIMDLevel level );
+   void testDot ( blaze::SIMDLevel level );
+   void testSum ( blaze::SIMDLevel level );
+
+   template< bool SO1, bool SO2, bool SO3 >
+   void testMmm( blaze::SIMDLevel level, size_t M, size_t N, size_t K );
+
+   template< bool SO >
+   void testGemv( blaze::SIMDLevel level, size_t M, size_t N );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   void checkDispatch( blaze::SIMDLevel level, bool dispatched ) const;
+   void checkResult  ( blaze::SIMDLevel level, T result, T expected, size_t terms ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the DispatchedKernelsTest class template.
+//
+// \exception std::runtime_error Error detected.
+*/
+template< typename T >  // Data type of the dispatched kernels test
+DispatchedKernelsTest<T>::DispatchedKernelsTest()
+   : test_()  // Label of the currently performed test
+{
+   const blaze::SIMDLevel detected( blaze::detectSIMDLevel() );
+
+   for( int l=blaze::noSIMD; l<=detected; ++l )
+   {
+      const blaze::SIMDLevel level( static_cast<blaze::SIMDLevel>( l ) );
+
+      testMmm ( level );
+      testGemv( level );
+      testDot ( level );
+      testSum ( level );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Destructor for the DispatchedKernelsTest class template.
+//
+// The destructor restores the default SIMD level of the executing CPU.
+*/
+template< typename T >  // Data type of the dispatched kernels test
+DispatchedKernelsTest<T>::~DispatchedKernelsTest()
+{
+   blaze::setSIMDLevel( blaze::detectSIMDLevel() );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the dispatched dense matrix/dense matrix multiplication.
+//
+// \param level The SIMD level to be tested.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the dispatched dense matrix/dense matrix multiplication for all storage
+// order combinations and for matrix sizes that are not multiples of the SIMD vector width.
+*/
+template< typename T >  // Data type of the dispatched kernels test
+void DispatchedKernelsTest<T>::testMmm( blaze::SIMDLevel level )
+{
+   test_ = "Dispatched dense matrix/dense matrix multiplication";
+
+   const size_t sizes[][3] = { {   1UL,   1UL,   1UL }, {   2UL,   3UL,   5UL }, {   7UL,   9UL,  13UL },
+                               {  16UL,  16UL,  16UL }, {  17UL,  31UL,  33UL }, {  33UL,  65UL,  47UL },
+                               {  64UL,   8UL, 129UL }, { 100UL, 101UL,  99UL } };
+
+   for( const auto& s : sizes ) {
+      testMmm<false,false,false>( level, s[0], s[1], s[2] );
+      testMmm<false,false,true >( level, s[0], s[1], s[2] );
+      testMmm<false,true ,false>( level, s[0], s[1], s[2] );
+      testMmm<false,true ,true >( level, s[0], s[1], s[2] );
+      testMmm<true ,false,false>( level, s[0], s[1], s[2] );
+      testMmm<true ,false,true >( level, s[0], s[1], s[2] );
+      testMmm<true ,true ,false>( level, s[0], s[1], s[2] );
+      testMmm<true ,true ,true >( level, s[0], s[1], s[2] );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Testing the dispatched dense matrix/dense vector multiplication.
+//
+// \param level The SIMD level to be tested.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the dispatched dense matrix/dense vector multiplication for row-major
+// and column-major matrices and for sizes that are not multiples of the SIMD vector width.
+*/
+template< typename T >  // Data type of the dispatched kernels test
+void DispatchedKernelsTest<T>::testGemv( blaze::SIMDLevel level )
+{
+   test_ = "Dispatched dense matrix/dense vector multiplication";
+
+   const size_t sizes[][2] = { {   1UL,   1UL }, {   3UL,   7UL }, {  17UL,  33UL }, {  64UL,  65UL },
+                               { 127UL,   3UL }, {   5UL, 200UL }, { 300UL, 301UL } };
+
+   for( const auto& s : sizes ) {
+      testGemv<false>( level, s[0], s[1] );
+      testGemv<true >( level, s[0], s[1] );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Testing the dispatched dense vector inner product.
+//
+// \param level The SIMD level to be tested.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename T >  // Data type of the dispatched kernels test
+void DispatchedKernelsTest<T>::testDot( blaze::SIMDLevel level )
+{
+   test_ = "Dispatched dense vector inner product";
+
+   const size_t sizes[] = { 0UL, 1UL, 3UL, 7UL, 15UL, 16UL, 17UL, 31UL, 33UL, 63UL, 64UL, 65UL, 127UL, 1000UL };
+
+   for( size_t n : sizes )
+   {
+      blaze::DynamicVector<T> a( n ), b( n );
+      randomize( a );
+      randomize( b );
+
+      blaze::setSIMDLevel( blaze::noSIMD );
+      const T expected( dot( a, b ) );
+
+      blaze::setSIMDLevel( level );
+      T result{};
+      checkDispatch( level, blaze::dispatchedDot( a, b, result ) );
+
+      if( level <= blaze::compiledSIMDLevel )
+         continue;
+
+      try {
+         checkResult( level, result, expected, n );
+      }
+      catch( std::runtime_error& ex ) {
+         std::ostringstream oss;
+         oss << ex.what()
+             << "   Size            = " << n << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Testing the dispatched dense vector summation.
+//
+// \param level The SIMD level to be tested.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename T >  // Data type of the dispatched kernels test
+void DispatchedKernelsTest<T>::testSum( blaze::SIMDLevel level )
+{
+   test_ = "Dispatched dense vector summation";
+
+   const size_t sizes[] = { 0UL, 1UL, 3UL, 7UL, 15UL, 16UL, 17UL, 31UL, 33UL, 63UL, 64UL, 65UL, 127UL, 1000UL };
+
+   for( size_t n : sizes )
+   {
+      blaze::DynamicVector<T> a( n );
+      randomize( a );
+
+      blaze::setSIMDLevel( blaze::noSIMD );
+      const T expected( sum( a ) );
+
+      blaze::setSIMDLevel( level );
+      T result{};
+      checkDispatch( level, blaze::dispatchedSum( a, result ) );
+
+      if( level <= blaze::compiledSIMDLevel )
+         continue;
+
+      try {
+         checkResult( level, result, expected, n );
+      }
+      catch( std::runtime_error& ex ) {
+         std::ostringstream oss;
+         oss << ex.what()
+             << "   Size            = " << n << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Testing the dispatched dense matrix/dense matrix multiplication for specific sizes.
+//
+// \param level The SIMD level to be tested.
+// \param M The number of rows of the target matrix.
+// \param N The number of columns of the target matrix.
+// \param K The number of columns of the left-hand side operand.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the multiplication \f$ C+=\alpha*A*B \f$ for the storage orders \a SO1
+// (\f$ C \f$), \a SO2 (\f$ A \f$), and \a SO3 (\f$ B \f$).
+*/
+template< typename T >  // Data type of the dispatched kernels test
+template< bool SO1      // Storage order of the target matrix
+        , bool SO2      // Storage order of the left-hand side operand
+        , bool SO3 >    // Storage order of the right-hand side operand
+void DispatchedKernelsTest<T>::testMmm( blaze::SIMDLevel level, size_t M, size_t N, size_t K )
+{
+   blaze::DynamicMatrix<T,SO2> A( M, K );
+   blaze::DynamicMatrix<T,SO3> B( K, N );
+   blaze::DynamicMatrix<T,SO1> C( M, N );
+   randomize( A );
+   randomize( B );
+   randomize( C );
+
+   const T alpha( 2 );
+
+   blaze::setSIMDLevel( blaze::noSIMD );
+   blaze::DynamicMatrix<T,SO1> expected( C );
+   expected += alpha * ( A * B );
+
+   blaze::setSIMDLevel( level );
+   blaze::DynamicMatrix<T,SO1> result( C );
+   checkDispatch( level, blaze::dispatchedMmm( result, A, B, alpha ) );
+
+   if( level <= blaze::compiledSIMDLevel )
+      return;
+
+   for( size_t i=0UL; i<M; ++i ) {
+      for( size_t j=0UL; j<N; ++j )
+      {
+         try {
+            checkResult( level, result(i,j), expected(i,j), K+1UL );
+         }
+         catch( std::runtime_error& ex ) {
+            std::ostringstream oss;
+            oss << ex.what()
+                << "   Element         = (" << i << "," << j << ")\n"
+                << "   Sizes           = " << M << "x" << N << "x" << K << "\n"
+                << "   Storage orders  = " << ( SO1 ? "column" : "row" ) << "-major C, "
+                                           << ( SO2 ? "column" : "row" ) << "-major A, "
+                                           << ( SO3 ? "column" : "row" ) << "-major B\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Testing the dispatched dense matrix/dense vector multiplication for specific sizes.
+//
+// \param level The SIMD level to be tested.
+// \param M The number of rows of the matrix.
+// \param N The number of columns of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the multiplication \f$ \vec{y}=A*\vec{x} \f$ for a matrix with storage
+// order \a SO. The target vector is initialized with random values to detect elements that
+// are not written by the kernel.
+*/
+template< typename T >  // Data type of the dispatched kernels test
+template< bool SO >     // Storage order of the matrix
+void DispatchedKernelsTest<T>::testGemv( blaze::SIMDLevel level, size_t M, size_t N )
+{
+   blaze::DynamicMatrix<T,SO> A( M, N );
+   blaze::DynamicVector<T> x( N ), y( M );
+   randomize( A );
+   randomize( x );
+   randomize( y );
+
+   blaze::setSIMDLevel( blaze::noSIMD );
+   const blaze::DynamicVector<T> expected( A * x );
+
+   blaze::setSIMDLevel( level );
+   checkDispatch( level, blaze::dispatchedGemv( y, A, x ) );
+
+   if( level <= blaze::compiledSIMDLevel )
+      return;
+
+   for( size_t i=0UL; i<M; ++i )
+   {
+      try {
+         checkResult( level, y[i], expected[i], N );
+      }
+      catch( std::runtime_error& ex ) {
+         std::ostringstream oss;
+         oss << ex.what()
+             << "   Element         = " << i << "\n"
+             << "   Sizes           = " << M << "x" << N << "\n"
+             << "   Storage order   = " << ( SO ? "column" : "row" ) << "-major\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking whether a kernel has been dispatched for the given SIMD level.
+//
+// \param level The selected SIMD level.
+// \param dispatched \a true in case the dispatched kernel has been used, \a false if not.
+// \return void
+// \exception std::runtime_error Invalid dispatch detected.
+//
+// The dispatched kernels are expected to be used if and only if the selected SIMD level
+// exceeds the SIMD level selected at compile time.
+*/
+template< typename T >  // Data type of the dispatched kernels test
+void DispatchedKernelsTest<T>::checkDispatch( blaze::SIMDLevel level, bool dispatched ) const
+{
+   if( dispatched != ( level > blaze::compiledSIMDLevel ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid dispatch detected\n"
+          << " Details:\n"
+          << "   SIMD level          = " << level << "\n"
+          << "   Compiled SIMD level = " << blaze::compiledSIMDLevel << "\n"
+          << "   Dispatched          = " << ( dispatched ? "yes" : "no" ) << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Comparison of the result of a dispatched kernel with the expected result.
+//
+// \param level The selected SIMD level.
+// \param result The result of the dispatched kernel.
+// \param expected The result of the compile time kernel.
+// \param terms The number of accumulated terms.
+// \return void
+// \exception std::runtime_error Incorrect result detected.
+//
+// Since the kernels accumulate in a different order, the results are compared with a tolerance
+// proportional to the number of accumulated (non-negative) terms.
+*/
+template< typename T >  // Data type of the dispatched kernels test
+void DispatchedKernelsTest<T>::checkResult( blaze::SIMDLevel level, T result, T expected, size_t terms ) const
+{
+   using std::abs;
+
+   const T tolerance( T( 2*terms+2UL ) * std::numeric_limits<T>::epsilon() *
+                      std::max( abs( expected ), T(1) ) );
+
+   if( !( abs( result - expected ) <= tolerance ) ) {
+      std::ostringstream oss;
+      oss.precision( 12 );
+      oss << " Test: " << test_ << "\n"
+          << " Error: Incorrect result detected\n"
+          << " Details:\n"
+          << "   Element type    = " << ( sizeof( T ) == sizeof( float ) ? "float" : "double" ) << "\n"
+          << "   SIMD level      = " << level << "\n"
+          << "   Result          = " << result << "\n"
+          << "   Expected result = " << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the runtime dispatched dense kernels of a specific floating point data type.
+//
+// \return void
+*/
+template< typename T >  // Data type of the dispatched kernels test
+void runDispatchedKernelsTest()
+{
+   DispatchedKernelsTest<T>();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of a dispatched kernels test case.
+*/
+#define RUN_SIMD_DISPATCHEDKERNELS_TEST( T ) \
+   blazetest::mathtest::simd::runDispatchedKernelsTest<T>()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace simd
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,546 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/slicedellpackmatrix/ClassTest.h
+//  \brief Header file for the SlicedEllpackMatrix class test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZETEST_MATHTEST_SLICEDELLPACKMATRIX_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_SLICEDELLPACKMATRIX_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/constraints/SparseMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/SlicedEllpackMatrix.h>
+#include <blaze/util/Random.h>
+#include <blazetest/system/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace slicedellpackmatrix {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the SlicedEllpackMatrix class template.
+//
+// This class represents a test suite for the blaze::SlicedEllpackMatrix class template. It
+// performs a series of both compile time as well as runtime tests.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testConstructors();
+   void testAssignment  ();
+   void testAt          ();
+   void testLookup      ();
+   void testClear       ();
+   void testSwap        ();
+   void testMultiplication();
+
+   template< typename Type, typename IT >
+   void runConversionTest( size_t m, size_t n, size_t sigma );
+
+   template< typename Type, typename IT >
+   void runMultiplicationTest( size_t m, size_t n, size_t sigma );
+
+   template< typename Type >
+   void checkRows( const Type& matrix, size_t expectedRows ) const;
+
+   template< typename Type >
+   void checkColumns( const Type& matrix, size_t expectedColumns ) const;
+
+   template< typename Type >
+   void checkNonZeros( const Type& matrix, size_t expectedNonZeros ) const;
+
+   template< typename MT1, typename MT2 >
+   void checkMatrix( const MT1& matrix, const MT2& reference ) const;
+
+   template< typename VT1, typename VT2 >
+   void checkVector( const VT1& result, const VT2& reference ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename Type >
+   static blaze::CompressedMatrix<Type,blaze::rowMajor> createMatrix( size_t m, size_t n );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   using MT   = blaze::SlicedEllpackMatrix<double>;                  //!< Type of the sliced ELLPACK matrix.
+   using MT32 = blaze::SlicedEllpackMatrix<double,uint32_t>;         //!< Sliced ELLPACK matrix with 32-bit indices.
+   using RMT  = blaze::CompressedMatrix<double,blaze::rowMajor>;     //!< Row-major reference matrix type.
+   using CMT  = blaze::CompressedMatrix<double,blaze::columnMajor>;  //!< Column-major reference matrix type.
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_SPARSE_MATRIX_TYPE( MT   );
+   BLAZE_CONSTRAINT_MUST_BE_SPARSE_MATRIX_TYPE( MT32 );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the conversion of a randomly initialized sparse matrix.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param sigma The sorting scope of the sliced ELLPACK matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function converts a randomly initialized row-major and column-major compressed matrix
+// and a dense matrix to a sliced ELLPACK matrix and checks the dimensions, the number of
+// non-zero elements, all elements and the order of the elements within each row.
+*/
+template< typename Type  // Data type of the matrix elements
+        , typename IT >  // Index type
+void ClassTest::runConversionTest( size_t m, size_t n, size_t sigma )
+{
+   const blaze::CompressedMatrix<Type,blaze::rowMajor> ref( createMatrix<Type>( m, n ) );
+
+   {
+      const blaze::SlicedEllpackMatrix<Type,IT> sell( ref, sigma );
+      checkMatrix( sell, ref );
+   }
+
+   {
+      const blaze::CompressedMatrix<Type,blaze::columnMajor> tmp( ref );
+      const blaze::SlicedEllpackMatrix<Type,IT> sell( tmp, sigma );
+      checkMatrix( sell, ref );
+   }
+
+   {
+      const blaze::DynamicMatrix<Type,blaze::rowMajor> tmp( ref );
+      const blaze::SlicedEllpackMatrix<Type,IT> sell( tmp, sigma );
+      checkMatrix( sell, ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the vectorized multiplication kernels with a randomly initialized matrix.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param sigma The sorting scope of the sliced ELLPACK matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the sparse matrix/dense vector multiplication and the transpose
+// dense vector/sparse matrix multiplication of a sliced ELLPACK matrix with the according
+// multiplications of a compressed matrix. The plain, addition and subtraction assignments
+// as well as a scaled multiplication are tested. Since all values are small integers, the
+// results are exact independent of the order of the summation.
+*/
+template< typename Type  // Data type of the matrix elements
+        , typename IT >  // Index type
+void ClassTest::runMultiplicationTest( size_t m, size_t n, size_t sigma )
+{
+   const blaze::CompressedMatrix<Type,blaze::rowMajor> ref( createMatrix<Type>( m, n ) );
+   const blaze::SlicedEllpackMatrix<Type,IT> sell( ref, sigma );
+
+   blaze::DynamicVector<Type,blaze::columnVector> x( n );
+   blaze::DynamicVector<Type,blaze::rowVector> z( m );
+   for( Type& element : x ) element = Type( blaze::rand<int>( -4, 4 ) );
+   for( Type& element : z ) element = Type( blaze::rand<int>( -4, 4 ) );
+
+   {
+      blaze::DynamicVector<Type,blaze::columnVector> y;
+      y = sell * x;
+      checkVector( y, eval( ref * x ) );
+
+      y += sell * x;
+      checkVector( y, eval( Type(2) * ( ref * x ) ) );
+
+      y -= sell * x;
+      checkVector( y, eval( ref * x ) );
+
+      y = Type(3) * ( sell * x );
+      checkVector( y, eval( Type(3) * ( ref * x ) ) );
+   }
+
+   {
+      blaze::DynamicVector<Type,blaze::rowVector> y;
+      y = z * sell;
+      checkVector( y, eval( z * ref ) );
+
+      y += z * sell;
+      checkVector( y, eval( Type(2) * ( z * ref ) ) );
+
+      y -= z * sell;
+      checkVector( y, eval( z * ref ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the number of rows of the given matrix.
+//
+// \param matrix The matrix to be checked.
+// \param expectedRows The expected number of rows of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the number of rows of the given matrix. In case the actual number of
+// rows does not correspond to the given expected number of rows, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename Type >  // Type of the matrix
+void ClassTest::checkRows( const Type& matrix, size_t expectedRows ) const
+{
+   if( matrix.rows() != expectedRows ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of rows detected\n"
+          << " Details:\n"
+          << "   Number of rows         : " << matrix.rows() << "\n"
+          << "   Expected number of rows: " << expectedRows << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the number of columns of the given matrix.
+//
+// \param matrix The matrix to be checked.
+// \param expectedColumns The expected number of columns of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the number of columns of the given matrix. In case the actual number of
+// columns does not correspond to the given expected number of columns, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename Type >  // Type of the matrix
+void ClassTest::checkColumns( const Type& matrix, size_t expectedColumns ) const
+{
+   if( matrix.columns() != expectedColumns ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of columns detected\n"
+          << " Details:\n"
+          << "   Number of columns         : " << matrix.columns() << "\n"
+          << "   Expected number of columns: " << expectedColumns << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the number of non-zero elements of the given matrix.
+//
+// \param matrix The matrix to be checked.
+// \param expectedNonZeros The expected number of non-zero elements of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the number of non-zero elements of the given matrix. In case the
+// actual number of non-zero elements does not correspond to the given expected number,
+// a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Type of the matrix
+void ClassTest::checkNonZeros( const Type& matrix, size_t expectedNonZeros ) const
+{
+   if( matrix.nonZeros() != expectedNonZeros ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of non-zero elements\n"
+          << " Details:\n"
+          << "   Number of non-zeros         : " << matrix.nonZeros() << "\n"
+          << "   Expected number of non-zeros: " << expectedNonZeros << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   if( matrix.capacity() < matrix.nonZeros() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid capacity detected\n"
+          << " Details:\n"
+          << "   Number of non-zeros: " << matrix.nonZeros() << "\n"
+          << "   Capacity           : " << matrix.capacity() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Comparison of a sliced ELLPACK matrix with a row-major reference matrix.
+//
+// \param matrix The sliced ELLPACK matrix to be checked.
+// \param reference The row-major compressed reference matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the dimensions, the number of non-zero elements and all elements of
+// the given sliced ELLPACK matrix with the given reference matrix. Additionally it checks
+// that the iterators of each row traverse exactly the non-zero elements of the reference
+// row in ascending order of their column indices. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename MT1    // Type of the sliced ELLPACK matrix
+        , typename MT2 >  // Type of the reference matrix
+void ClassTest::checkMatrix( const MT1& matrix, const MT2& reference ) const
+{
+   checkRows    ( matrix, reference.rows()     );
+   checkColumns ( matrix, reference.columns()  );
+   checkNonZeros( matrix, reference.nonZeros() );
+
+   if( matrix != reference ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Matrix comparison failed\n"
+          << " Details:\n"
+          << "   Matrix type:\n"
+          << "     " << typeid( MT1 ).name() << "\n"
+          << "   Result:\n" << matrix << "\n"
+          << "   Expected result:\n" << reference << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   for( size_t i=0UL; i<reference.rows(); ++i )
+   {
+      if( matrix.nonZeros( i ) != reference.nonZeros( i ) || matrix.capacity( i ) < matrix.nonZeros( i ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of non-zero elements in row " << i << "\n"
+             << " Details:\n"
+             << "   Number of non-zeros         : " << matrix.nonZeros( i ) << "\n"
+             << "   Expected number of non-zeros: " << reference.nonZeros( i ) << "\n"
+             << "   Capacity                    : " << matrix.capacity( i ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      auto element( matrix.begin( i ) );
+      for( auto ref=reference.begin( i ); ref!=reference.end( i ); ++ref, ++element )
+      {
+         if( element == matrix.end( i ) || element->index() != ref->index() || element->value() != ref->value() ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Iteration over row " << i << " failed\n"
+                << " Details:\n"
+                << "   Expected index: " << ref->index() << "\n"
+                << "   Expected value: " << ref->value() << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      if( element != matrix.end( i ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Iteration over row " << i << " failed\n"
+             << " Details:\n"
+             << "   Additional elements detected after the last non-zero element\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Comparison of the result of a multiplication with the expected result.
+//
+// \param result The computed result vector.
+// \param reference The expected result vector.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the given result vector with the given reference vector by means
+// of the equal() function. In case the vectors differ, a \a std::runtime_error exception is
+// thrown.
+*/
+template< typename VT1    // Type of the result vector
+        , typename VT2 >  // Type of the reference vector
+void ClassTest::checkVector( const VT1& result, const VT2& reference ) const
+{
+   if( result.size() != reference.size() || result != reference ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Multiplication failed\n"
+          << " Details:\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << reference << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creation of a randomly initialized row-major compressed matrix.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \return The randomly initialized compressed matrix.
+//
+// This function creates a compressed matrix with rows of strongly varying length. Every
+// seventh row is empty, every eleventh row is (almost) completely filled, and all other
+// rows contain a random number of up to 8 non-zero elements. All values are small integers,
+// which keeps all multiplications exact even in single precision.
+*/
+template< typename Type >  // Data type of the matrix elements
+blaze::CompressedMatrix<Type,blaze::rowMajor> ClassTest::createMatrix( size_t m, size_t n )
+{
+   blaze::CompressedMatrix<Type,blaze::rowMajor> A( m, n );
+
+   if( n == 0UL )
+      return A;
+
+   for( size_t i=0UL; i<m; ++i )
+   {
+      if( i % 7UL == 3UL )
+         continue;
+
+      const size_t nonzeros( ( i % 11UL == 5UL )?( n ):( blaze::rand<size_t>( 1UL, 8UL ) ) );
+
+      for( size_t k=0UL; k<nonzeros; ++k ) {
+         A(i,blaze::rand<size_t>( 0UL, n-1UL )) = Type( blaze::rand<int>( 1, 9 ) );
+      }
+   }
+
+   return A;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the functionality of the SlicedEllpackMatrix class template.
+//
+// \return void
+*/
+void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the SlicedEllpackMatrix class test.
+*/
+#define RUN_SLICEDELLPACKMATRIX_CLASS_TEST \
+   blazetest::mathtest::slicedellpackmatrix::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace slicedellpackmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,547 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/smp/CompressedAssignTest.h
+//  \brief Header file for the SMP compressed matrix assignment test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SMP_COMPRESSEDASSIGNTEST_H_
+#define _BLAZETEST_MATHTEST_SMP_COMPRESSEDASSIGNTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/smp/CompressedAssign.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/Random.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smp {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the tests of the SMP assignment to compressed matrices.
+//
+// This class represents a test suite for the parallel (compound) assignment to compressed
+// matrices (see the compressedAssign() function). It performs assignments, addition and
+// subtraction assignments, Schur product assignments and multiplications to row-major and
+// column-major compressed matrices by means of the active SMP backend and compares the results
+// with the according serial operations. All values are small integers, i.e. the results have
+// to be identical. The test has to be compiled with either the C++11 thread parallelization
+// or the OpenMP parallelization.
+*/
+class CompressedAssignTest
+{
+ private:
+   //**Type definitions****************************************************************************
+   using RMT = blaze::CompressedMatrix<double,blaze::rowMajor>;              //!< Row-major matrix type.
+   using CMT = blaze::CompressedMatrix<double,blaze::columnMajor>;           //!< Column-major matrix type.
+   using SMT = blaze::CompressedMatrix<double,blaze::rowMajor,uint32_t>;     //!< Row-major matrix type with 32-bit indices.
+   using DMT = blaze::DynamicMatrix<double,blaze::rowMajor>;                 //!< Row-major dense matrix type.
+   //**********************************************************************************************
+
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit CompressedAssignTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testChunks  ();
+   void testAssign  ();
+   void testAddSub  ();
+   void testSchur   ();
+   void testMult    ();
+
+   template< typename MT >
+   void runChunkTest( size_t m, size_t n );
+
+   template< typename MT, typename RT >
+   void runAssignTest( const RT& rhs );
+
+   template< typename T1, typename T2 >
+   void checkResult( const T1& result, const T2& expected ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static RMT createMatrix( size_t m, size_t n, size_t nonzeros );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the CompressedAssignTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+inline CompressedAssignTest::CompressedAssignTest()
+{
+#if !BLAZE_CPP_THREADS_PARALLEL_MODE && !BLAZE_OPENMP_PARALLEL_MODE
+   throw std::runtime_error( " Error: No shared memory parallelization active\n" );
+#endif
+
+   blaze::setNumThreads( 4UL );
+
+   testChunks();
+   testAssign();
+   testAddSub();
+   testSchur();
+   testMult();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the compressedAssign() function with various numbers of chunks.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function calls the compressedAssign() function directly with a serial parallel loop
+// that executes the chunks in reverse order. It covers matrices with fewer rows/columns than
+// chunks, sizes that are not divisible by the number of chunks, as well as empty matrices.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+inline void CompressedAssignTest::testChunks()
+{
+   test_ = "compressedAssign() with various numbers of chunks";
+
+   for( size_t m : { 0UL, 1UL, 7UL, 64UL, 65UL, 200UL } ) {
+      for( size_t n : { 0UL, 1UL, 33UL } ) {
+         runChunkTest<RMT>( m, n );
+         runChunkTest<CMT>( m, n );
+         runChunkTest<SMT>( m, n );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the parallel assignment to compressed matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the parallel assignment of compressed matrices, of sparse matrix
+// additions and of dense matrices to row-major and column-major compressed matrices. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+inline void CompressedAssignTest::testAssign()
+{
+   test_ = "Parallel assignment to compressed matrices";
+
+   const RMT A( createMatrix( 1000UL, 800UL, 60UL ) );
+   const RMT B( createMatrix( 1000UL, 800UL, 45UL ) );
+   const CMT C( B );
+   const DMT D( createMatrix( 300UL, 200UL, 100UL ) );
+
+   runAssignTest<RMT>( A );
+   runAssignTest<CMT>( A );
+   runAssignTest<RMT>( C );
+   runAssignTest<RMT>( A + B );
+   runAssignTest<CMT>( A + C );
+   runAssignTest<SMT>( A - C );
+   runAssignTest<RMT>( D );
+   runAssignTest<CMT>( D );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the parallel addition and subtraction assignment to compressed matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the parallel addition and subtraction assignment to row-major and
+// column-major compressed matrices. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+inline void CompressedAssignTest::testAddSub()
+{
+   test_ = "Parallel addition/subtraction assignment to compressed matrices";
+
+   const RMT A( createMatrix( 1000UL, 800UL, 60UL ) );
+   const RMT B( createMatrix( 1000UL, 800UL, 45UL ) );
+   const CMT C( B );
+
+   {
+      RMT result( B );
+      result += A;
+      checkResult( result, blaze::serial( B + A ) );
+   }
+
+   {
+      CMT result( C );
+      result += A;
+      checkResult( result, blaze::serial( C + A ) );
+   }
+
+   {
+      RMT result( B );
+      result -= A;
+      checkResult( result, blaze::serial( B - A ) );
+   }
+
+   {
+      CMT result( C );
+      result -= A + B;
+      checkResult( result, blaze::serial( C - ( A + B ) ) );
+   }
+
+   {
+      SMT result( A );
+      result -= A;
+      checkResult( result, blaze::serial( A - A ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the parallel Schur product assignment to compressed matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the parallel Schur product assignment to row-major and column-major
+// compressed matrices. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+inline void CompressedAssignTest::testSchur()
+{
+   test_ = "Parallel Schur product assignment to compressed matrices";
+
+   const RMT A( createMatrix( 1000UL, 800UL, 60UL ) );
+   const RMT B( createMatrix( 1000UL, 800UL, 200UL ) );
+   const CMT C( B );
+
+   {
+      RMT result( B );
+      result %= A;
+      checkResult( result, blaze::serial( B % A ) );
+   }
+
+   {
+      CMT result( C );
+      result %= A;
+      checkResult( result, blaze::serial( C % A ) );
+   }
+
+   runAssignTest<RMT>( A % C );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the parallel assignment of sparse matrix multiplications.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the parallel assignment and addition assignment of sparse matrix/sparse
+// matrix multiplications to row-major and column-major compressed matrices. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+inline void CompressedAssignTest::testMult()
+{
+   test_ = "Parallel sparse matrix multiplication";
+
+   const RMT A( createMatrix( 600UL, 500UL, 8UL ) );
+   const RMT B( createMatrix( 500UL, 400UL, 6UL ) );
+   const CMT C( B );
+   const RMT D( createMatrix( 500UL, 400UL, 300UL ) );
+
+   runAssignTest<RMT>( A * B );
+   runAssignTest<CMT>( A * B );
+   runAssignTest<RMT>( A * C );
+   runAssignTest<SMT>( A * D );
+
+   {
+      RMT result( createMatrix( 600UL, 400UL, 10UL ) );
+      const RMT expected( result + blaze::serial( A * B ) );
+      result += A * B;
+      checkResult( result, expected );
+   }
+
+   {
+      RMT result( A );
+      result *= D;
+      checkResult( result, blaze::serial( A * D ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the compressedAssign() function for a particular matrix type and size.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename MT >  // Type of the left-hand side compressed matrix
+void CompressedAssignTest::runChunkTest( size_t m, size_t n )
+{
+   const RMT A( createMatrix( m, n, 5UL ) );
+   const RMT B( createMatrix( m, n, 3UL ) );
+
+   const size_t size( blaze::IsRowMajorMatrix_v<MT> ? m : n );
+
+   auto parallelFor = []( size_t chunks, const auto& kernel ) {
+      for( size_t i=chunks; i>0UL; --i ) {
+         kernel( i-1UL );
+      }
+   };
+
+   for( size_t chunks=1UL; chunks<=size+3UL; chunks+=( chunks < 10UL ? 1UL : 17UL ) )
+   {
+      {
+         MT result( A );
+         blaze::compressedAssign( result, B, []( auto& a, const auto& b ){ a = blaze::serial( b ); },
+                                  false, chunks, parallelFor );
+         checkResult( result, B );
+      }
+
+      {
+         MT result( A );
+         blaze::compressedAssign( result, B, []( auto& a, const auto& b ){ a += blaze::serial( b ); },
+                                  true, chunks, parallelFor );
+         checkResult( result, blaze::serial( A + B ) );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the parallel assignment of the given matrix to a compressed matrix.
+//
+// \param rhs The right-hand side matrix to be assigned.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function assigns the given right-hand side matrix to a non-empty compressed matrix of
+// type \a MT (which results in a call to the smpAssign() function) and compares the result with the result of the according serial
+// assignment. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename MT    // Type of the left-hand side compressed matrix
+        , typename RT >  // Type of the right-hand side matrix
+void CompressedAssignTest::runAssignTest( const RT& rhs )
+{
+   if( !rhs.canSMPAssign() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Right-hand side operand is too small for a parallel assignment\n"
+          << " Details:\n"
+          << "   Right-hand side type:\n"
+          << "     " << typeid( RT ).name() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   MT expected( rhs.rows(), rhs.columns() );
+   expected = blaze::serial( rhs );
+
+   MT result( createMatrix( rhs.rows(), rhs.columns(), 7UL ) );
+   result = rhs;
+
+   checkResult( result, expected );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Comparison of a result with the expected result.
+//
+// \param result The computed result.
+// \param expected The expected result.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename T1    // Type of the result
+        , typename T2 >  // Type of the expected result
+void CompressedAssignTest::checkResult( const T1& result, const T2& expected ) const
+{
+   const RMT tmp( expected );
+
+   if( result != tmp || result.nonZeros() != tmp.nonZeros() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Parallel result differs from the serial result\n"
+          << " Details:\n"
+          << "   Result type:\n"
+          << "     " << typeid( T1 ).name() << "\n"
+          << "   Number of rows                = " << result.rows() << "\n"
+          << "   Number of columns             = " << result.columns() << "\n"
+          << "   Number of non-zeros           = " << result.nonZeros() << "\n"
+          << "   Expected number of non-zeros  = " << tmp.nonZeros() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creates a random row-major compressed matrix with small integer values.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param nonzeros The maximum number of non-zero elements per row.
+// \return The random compressed matrix.
+*/
+inline CompressedAssignTest::RMT CompressedAssignTest::createMatrix( size_t m, size_t n, size_t nonzeros )
+{
+   RMT A( m, n );
+
+   if( n == 0UL )
+      return A;
+
+   A.reserve( m*nonzeros );
+
+   for( size_t i=0UL; i<m; ++i ) {
+      for( size_t k=0UL; k<nonzeros; ++k ) {
+         A(i,blaze::rand<size_t>( 0UL, n-1UL )) = blaze::rand<int>( 1, 9 ) * ( blaze::rand<int>( 0, 1 ) ? 1 : -1 );
+      }
+   }
+
+   return A;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the SMP assignment to compressed matrices.
+//
+// \return void
+*/
+void runCompressedAssignTest()
+{
+   CompressedAssignTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the SMP compressed matrix assignment test.
+*/
+#define RUN_SMP_COMPRESSEDASSIGN_TEST \
+   blazetest::mathtest::smp::runCompressedAssignTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace smp
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
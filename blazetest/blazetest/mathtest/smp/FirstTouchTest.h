@@ -0,0 +1,700 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/smp/FirstTouchTest.h
+//  \brief Header file for the NUMA first touch test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SMP_FIRSTTOUCHTEST_H_
+#define _BLAZETEST_MATHTEST_SMP_FIRSTTOUCHTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/smp/FirstTouch.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/typetraits/IsColumnMajorMatrix.h>
+#include <blaze/system/SMP.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/NUMA.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smp {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the tests of the NUMA policies and the first touch initialization.
+//
+// This class represents a test suite for the NUMA policy settings (see \c blaze::setNumaPolicy()
+// and the \c BLAZE_NUMA_POLICY environment variable) and for the parallel first touch
+// initialization of the storage of dense vectors and matrices. The containers are created,
+// resized, and reserved with several numbers of threads and have to hold the same values and
+// zero padding elements as with a single thread. The test has to be compiled with either the
+// C++11 thread parallelization or the OpenMP parallelization.
+*/
+class FirstTouchTest
+{
+ private:
+   //**Type definitions****************************************************************************
+   using VT  = blaze::DynamicVector<double>;                     //!< Dense vector type.
+   using RMT = blaze::DynamicMatrix<double,blaze::rowMajor>;     //!< Row-major dense matrix type.
+   using CMT = blaze::DynamicMatrix<double,blaze::columnMajor>;  //!< Column-major dense matrix type.
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   static constexpr size_t maxThreads = 4UL;  //!< Maximum number of threads of the test.
+   //**********************************************************************************************
+
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit FirstTouchTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   ~FirstTouchTest();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testPolicy    ();
+   void testParsing   ();
+   void testFirstTouch();
+   void testVector    ();
+   void testMatrix    ();
+
+   template< typename MT >
+   void testMatrix( const std::string& label );
+
+   void checkStorage( const double* data, size_t size, double value, const std::string& label ) const;
+   void checkVector ( const VT& v, size_t n, const std::string& label ) const;
+
+   template< typename MT >
+   void checkMatrix( const MT& A, size_t m, size_t n, size_t capacity, const std::string& label ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static double value( size_t i, size_t j = 0UL );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;     //!< Label of the currently performed test.
+   size_t      threads_;  //!< The number of threads of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the FirstTouchTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+inline FirstTouchTest::FirstTouchTest()
+   : test_   ()
+   , threads_( 1UL )
+{
+#if !BLAZE_CPP_THREADS_PARALLEL_MODE && !BLAZE_OPENMP_PARALLEL_MODE
+   throw std::runtime_error( " Error: No shared memory parallelization active\n" );
+#endif
+
+   testPolicy();
+   testParsing();
+   testFirstTouch();
+   testVector();
+   testMatrix();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Destructor for the FirstTouchTest class test.
+//
+// The destructor restores the default NUMA policy.
+*/
+inline FirstTouchTest::~FirstTouchTest()
+{
+   blaze::setNumaPolicy( blaze::numaDefault );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the setNumaPolicy() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+inline void FirstTouchTest::testPolicy()
+{
+   test_ = "setNumaPolicy()";
+
+   const blaze::NumaPolicy policies[] = {
+      blaze::numaFirstTouch, blaze::numaInterleave, blaze::numaBind, blaze::numaDefault };
+
+   for( blaze::NumaPolicy policy : policies )
+   {
+      blaze::setNumaPolicy( policy );
+
+      if( blaze::getNumaPolicy() != policy || blaze::numaSettings().nodes != blaze::getNumaNodeMask() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setting the NUMA policy failed\n"
+             << " Details:\n"
+             << "   Policy         = " << blaze::getNumaPolicy() << " (expected: " << policy << ")\n"
+             << "   Selected nodes = " << blaze::numaSettings().nodes << " (expected: " << blaze::getNumaNodeMask() << ")\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Setting an invalid policy
+   try {
+      blaze::setNumaPolicy( static_cast<blaze::NumaPolicy>( 7 ) );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Setting an invalid NUMA policy succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   // Setting an empty set of nodes
+   try {
+      blaze::setNumaPolicy( blaze::numaInterleave, 0UL );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Setting an empty set of NUMA nodes succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   // Setting a set of unavailable nodes
+   if( ~blaze::getNumaNodeMask() != 0UL )
+   {
+      try {
+         blaze::setNumaPolicy( blaze::numaBind, ~blaze::getNumaNodeMask() );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setting a set of unavailable NUMA nodes succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   if( blaze::getNumaPolicy() != blaze::numaDefault ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Failed setting of the NUMA policy changed the active policy\n"
+          << " Details:\n"
+          << "   Policy = " << blaze::getNumaPolicy() << " (expected: " << blaze::numaDefault << ")\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the parsing of the \c BLAZE_NUMA_POLICY environment variable.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+inline void FirstTouchTest::testParsing()
+{
+   test_ = "BLAZE_NUMA_POLICY parsing";
+
+   // Parsing of lists of nodes
+   {
+      const struct { const char* list; uint64_t nodes; } lists[] = {
+         { "0"         , 0x1UL                }, { "0-3,5"   , 0x2FUL   },
+         { "1,3-4\n"   , 0x1AUL               }, { " 2 , 7-8", 0x184UL  },
+         { "62-70"     , uint64_t(3) << 62    }, { ""        , 0x0UL    },
+         { "3-1"       , 0x0UL                }, { "x"       , 0x0UL    } };
+
+      for( const auto& entry : lists )
+      {
+         const uint64_t nodes( blaze::parseNumaNodes( entry.list ) );
+
+         if( nodes != entry.nodes ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Parsing a list of NUMA nodes failed\n"
+                << " Details:\n"
+                << "   List  = \"" << entry.list << "\"\n"
+                << "   Nodes = " << std::hex << nodes << " (expected: " << entry.nodes << ")\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   // Parsing of policies
+   {
+      const uint64_t all( blaze::getNumaNodeMask() );
+      const uint64_t first( all & ( ~all + 1UL ) );
+
+      size_t node( 0UL );
+      while( ( first >> node ) != 1UL ) ++node;
+
+      const std::string firstNode( std::to_string( node ) );
+
+      const struct { std::string value; blaze::NumaPolicy policy; uint64_t nodes; bool modified; } policies[] = {
+         { "firsttouch"             , blaze::numaFirstTouch, all  , false },
+         { "default"                , blaze::numaDefault   , all  , false },
+         { "interleave:" + firstNode, blaze::numaInterleave, first, true  },
+         { "bind"                   , blaze::numaBind      , first, true  },
+         { "firsttouch:0-63"        , blaze::numaFirstTouch, all  , true  },
+         { "unknown"                , blaze::numaDefault   , all  , true  } };
+
+      blaze::NumaSettings settings{ { blaze::numaDefault }, { all }, { false } };
+
+      for( const auto& entry : policies )
+      {
+         blaze::parseNumaPolicy( entry.value, settings );
+
+         if( settings.policy != entry.policy || settings.nodes != entry.nodes || settings.modified != entry.modified ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Parsing a NUMA policy failed\n"
+                << " Details:\n"
+                << "   Specification  = \"" << entry.value << "\"\n"
+                << "   Policy         = " << settings.policy << " (expected: " << entry.policy << ")\n"
+                << "   Selected nodes = " << std::hex << settings.nodes << " (expected: " << entry.nodes << ")\n"
+                << "   Modified flag  = " << settings.modified << " (expected: " << entry.modified << ")\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the smpFirstTouch() functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// The storage is only initialized in case the first touch policy is active, more than a single
+// thread is available, and no parallel section is active.
+*/
+inline void FirstTouchTest::testFirstTouch()
+{
+   test_ = "smpFirstTouch()";
+
+   const size_t N( blaze::SMP_DVECASSIGN_THRESHOLD + 3UL );
+   const size_t M( 97UL );
+   const size_t K( blaze::SMP_DMATASSIGN_THRESHOLD / M + 5UL );
+
+   double* v( blaze::allocate<double>( N ) );
+   double* A( blaze::allocate<double>( M*K ) );
+
+   for( threads_=1UL; threads_<=maxThreads; ++threads_ )
+   {
+      blaze::setNumThreads( threads_ );
+
+      for( bool firstTouch : { false, true } )
+      {
+         blaze::setNumaPolicy( firstTouch ? blaze::numaFirstTouch : blaze::numaDefault );
+
+         const double expected( ( firstTouch && threads_ > 1UL )?( 0.0 ):( 1.0 ) );
+
+         std::fill( v, v+N, 1.0 );
+         blaze::smpFirstTouch( v, N );
+         checkStorage( v, N, expected, "vector storage" );
+
+         std::fill( A, A+M*K, 1.0 );
+         blaze::smpFirstTouch<blaze::rowMajor>( A, M, K );
+         checkStorage( A, M*K, expected, "row-major matrix storage" );
+
+         std::fill( A, A+M*K, 1.0 );
+         blaze::smpFirstTouch<blaze::columnMajor>( A, K, M );
+         checkStorage( A, M*K, expected, "column-major matrix storage" );
+
+         std::fill( v, v+N, 1.0 );
+         BLAZE_PARALLEL_SECTION {
+            blaze::smpFirstTouch( v, N );
+         }
+         checkStorage( v, N, 1.0, "vector storage within a parallel section" );
+      }
+   }
+
+   blaze::deallocate( v );
+   blaze::deallocate( A );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the first touch initialization of dense vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+inline void FirstTouchTest::testVector()
+{
+   test_ = "DynamicVector first touch";
+
+   const size_t N( blaze::SMP_DVECASSIGN_THRESHOLD + 3UL );
+
+   blaze::setNumaPolicy( blaze::numaFirstTouch );
+
+   for( threads_=1UL; threads_<=maxThreads; ++threads_ )
+   {
+      blaze::setNumThreads( threads_ );
+
+      VT v( N );
+      for( size_t i=0UL; i<N; ++i )
+         v[i] = value( i );
+      checkVector( v, N, "Construction" );
+
+      v.resize( 2UL*N+1UL, true );
+      for( size_t i=N; i<2UL*N+1UL; ++i )
+         v[i] = value( i );
+      checkVector( v, 2UL*N+1UL, "resize()" );
+
+      v.reserve( 3UL*N );
+      checkVector( v, 2UL*N+1UL, "reserve()" );
+
+      VT w( v );
+      checkVector( w, 2UL*N+1UL, "Copy construction" );
+   }
+
+   blaze::setNumaPolicy( blaze::numaDefault );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the first touch initialization of dense matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+inline void FirstTouchTest::testMatrix()
+{
+   test_ = "DynamicMatrix first touch";
+
+   blaze::setNumaPolicy( blaze::numaFirstTouch );
+
+   for( threads_=1UL; threads_<=maxThreads; ++threads_ )
+   {
+      blaze::setNumThreads( threads_ );
+
+      testMatrix<RMT>( "row-major" );
+      testMatrix<CMT>( "column-major" );
+   }
+
+   blaze::setNumaPolicy( blaze::numaDefault );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the first touch initialization of a dense matrix of the given type.
+//
+// \param label The label of the storage order.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename MT >  // Type of the dense matrix
+void FirstTouchTest::testMatrix( const std::string& label )
+{
+   const size_t M( 97UL );
+   const size_t N( blaze::SMP_DMATASSIGN_THRESHOLD / M + 5UL );
+
+   MT A( M, N );
+   for( size_t i=0UL; i<M; ++i )
+      for( size_t j=0UL; j<N; ++j )
+         A(i,j) = value( i, j );
+   checkMatrix( A, M, N, A.capacity(), "Construction (" + label + ")" );
+
+   A.resize( M+3UL, N+7UL, true );
+   for( size_t i=0UL; i<M+3UL; ++i )
+      for( size_t j=( i<M ? N : 0UL ); j<N+7UL; ++j )
+         A(i,j) = value( i, j );
+   checkMatrix( A, M+3UL, N+7UL, A.capacity(), "resize() (" + label + ")" );
+
+   const size_t capacity( 2UL*A.capacity() + 1UL );
+   A.reserve( capacity );
+   checkMatrix( A, M+3UL, N+7UL, capacity, "reserve() (" + label + ")" );
+
+   MT B( A );
+   checkMatrix( B, M+3UL, N+7UL, B.capacity(), "Copy construction (" + label + ")" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the values of the given storage.
+//
+// \param data The first element of the storage.
+// \param size The number of elements of the storage.
+// \param expected The expected value of all elements.
+// \param label The label of the storage.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+inline void FirstTouchTest::checkStorage( const double* data, size_t size, double expected,
+                                          const std::string& label ) const
+{
+   for( size_t i=0UL; i<size; ++i )
+   {
+      if( data[i] != expected ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid initialization of the " << label << "\n"
+             << " Details:\n"
+             << "   NUMA policy       = " << blaze::getNumaPolicy() << "\n"
+             << "   Number of threads = " << threads_ << "\n"
+             << "   Size              = " << size << "\n"
+             << "   Index             = " << i << "\n"
+             << "   Value             = " << data[i] << " (expected: " << expected << ")\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the elements and the padding elements of the given dense vector.
+//
+// \param v The dense vector to be checked.
+// \param n The expected size of the vector.
+// \param label The label of the performed operation.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+inline void FirstTouchTest::checkVector( const VT& v, size_t n, const std::string& label ) const
+{
+   for( size_t i=0UL; i<v.capacity(); ++i )
+   {
+      const double expected( ( i < n )?( value( i ) ):( 0.0 ) );
+
+      if( v.size() != n || v.data()[i] != expected ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: " << label << " failed\n"
+             << " Details:\n"
+             << "   Number of threads = " << threads_ << "\n"
+             << "   Size              = " << v.size() << " (expected: " << n << ")\n"
+             << "   Capacity          = " << v.capacity() << "\n"
+             << "   Index             = " << i << "\n"
+             << "   Value             = " << v.data()[i] << " (expected: " << expected << ")\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the elements and the padding elements of the given dense matrix.
+//
+// \param A The dense matrix to be checked.
+// \param m The expected number of rows of the matrix.
+// \param n The expected number of columns of the matrix.
+// \param capacity The minimum capacity of the matrix.
+// \param label The label of the performed operation.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename MT >  // Type of the dense matrix
+void FirstTouchTest::checkMatrix( const MT& A, size_t m, size_t n, size_t capacity,
+                                  const std::string& label ) const
+{
+   const bool   SO   ( blaze::IsColumnMajorMatrix_v<MT> );
+   const size_t outer( SO ? n : m );
+   const size_t inner( SO ? m : n );
+
+   if( A.rows() != m || A.columns() != n || A.capacity() < capacity || A.spacing()*outer > A.capacity() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: " << label << " failed\n"
+          << " Details:\n"
+          << "   Number of threads = " << threads_ << "\n"
+          << "   Rows              = " << A.rows() << " (expected: " << m << ")\n"
+          << "   Columns           = " << A.columns() << " (expected: " << n << ")\n"
+          << "   Spacing           = " << A.spacing() << "\n"
+          << "   Capacity          = " << A.capacity() << " (expected: " << capacity << ")\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   for( size_t k=0UL; k<A.capacity(); ++k )
+   {
+      const size_t i( k / A.spacing() );
+      const size_t j( k % A.spacing() );
+
+      const double expected( ( i < outer && j < inner )?( SO ? value( j, i ) : value( i, j ) ):( 0.0 ) );
+
+      if( A.data()[k] != expected ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: " << label << " failed\n"
+             << " Details:\n"
+             << "   Number of threads = " << threads_ << "\n"
+             << "   Rows              = " << m << "\n"
+             << "   Columns           = " << n << "\n"
+             << "   Spacing           = " << A.spacing() << "\n"
+             << "   Capacity          = " << A.capacity() << "\n"
+             << "   Storage index     = " << k << "\n"
+             << "   Value             = " << A.data()[k] << " (expected: " << expected << ")\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the unique, non-zero value of the element at the given position.
+//
+// \param i The row index of the element.
+// \param j The column index of the element.
+// \return The value of the element.
+*/
+inline double FirstTouchTest::value( size_t i, size_t j )
+{
+   return double( i * 1000UL + j + 1UL );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the NUMA policies and the first touch initialization.
+//
+// \return void
+*/
+void runFirstTouchTest()
+{
+   FirstTouchTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the NUMA first touch test.
+*/
+#define RUN_SMP_FIRSTTOUCH_TEST \
+   blazetest::mathtest::smp::runFirstTouchTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace smp
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
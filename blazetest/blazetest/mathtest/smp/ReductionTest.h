@@ -0,0 +1,421 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/smp/ReductionTest.h
+//  \brief Header file for the SMP reduction test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SMP_REDUCTIONTEST_H_
+#define _BLAZETEST_MATHTEST_SMP_REDUCTIONTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/system/SMP.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Random.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smp {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the tests of the SMP reductions.
+//
+// This class represents a test suite for the parallel dense reductions (\c sum(), \c prod(),
+// \c min(), \c max()), inner products, and norms of dense vectors and matrices. The results of
+// the active SMP backend are compared with the according serial results for several numbers of
+// threads. In case the reproducible reductions are activated (see the
+// \c BLAZE_USE_REPRODUCIBLE_REDUCTIONS switch), all results have to be bitwise identical to the
+// serial results, otherwise they have to agree within the rounding error. The test has to be
+// compiled with either the C++11 thread parallelization or the OpenMP parallelization.
+*/
+class ReductionTest
+{
+ private:
+   //**Type definitions****************************************************************************
+   using VT  = blaze::DynamicVector<double>;                     //!< Dense vector type.
+   using IVT = blaze::DynamicVector<int>;                        //!< Integral dense vector type.
+   using RMT = blaze::DynamicMatrix<double,blaze::rowMajor>;     //!< Row-major dense matrix type.
+   using CMT = blaze::DynamicMatrix<double,blaze::columnMajor>;  //!< Column-major dense matrix type.
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   static constexpr size_t maxThreads = 6UL;  //!< Maximum number of threads of the test.
+   //**********************************************************************************************
+
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ReductionTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testVector      ();
+   void testIntegral    ();
+   void testMatrix      ();
+   void testCombination ();
+
+   template< typename MT >
+   void testMatrix( const MT& A, const std::string& label );
+
+   template< typename OP >
+   void runTest( const std::string& label, OP op, double tolerance );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the ReductionTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+inline ReductionTest::ReductionTest()
+{
+#if !BLAZE_CPP_THREADS_PARALLEL_MODE && !BLAZE_OPENMP_PARALLEL_MODE
+   throw std::runtime_error( " Error: No shared memory parallelization active\n" );
+#endif
+
+   testVector();
+   testIntegral();
+   testMatrix();
+   testCombination();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the parallel reductions, inner products, and norms of dense vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// The size of the vectors exceeds both the SMP thresholds and the block size of the
+// reproducible reductions and is not a multiple of the SIMD width.
+*/
+inline void ReductionTest::testVector()
+{
+   test_ = "Dense vector reductions";
+
+   const size_t N( std::max( std::max( blaze::SMP_DVECREDUCE_THRESHOLD, blaze::SMP_DVECDVECINNER_THRESHOLD ),
+                             size_t( 4*BLAZE_REPRODUCIBLE_REDUCTION_BLOCK_SIZE ) ) + 1003UL );
+
+   VT a( N ), b( N ), p( N );
+   randomize( a, -1.0, 1.0 );
+   randomize( b, -1.0, 1.0 );
+   randomize( p, 0.9999, 1.0001 );
+
+   runTest( "sum()"     , [&]() { return sum( a );      }, 1E-10 );
+   runTest( "prod()"    , [&]() { return prod( p );     }, 1E-10 );
+   runTest( "min()"     , [&]() { return min( a );      }, 0.0   );
+   runTest( "max()"     , [&]() { return max( a );      }, 0.0   );
+   runTest( "dot()"     , [&]() { return dot( a, b );   }, 1E-10 );
+   runTest( "norm()"    , [&]() { return norm( a );     }, 1E-10 );
+   runTest( "sqrNorm()" , [&]() { return sqrNorm( a );  }, 1E-10 );
+   runTest( "l1Norm()"  , [&]() { return l1Norm( a );   }, 1E-10 );
+   runTest( "linfNorm()", [&]() { return linfNorm( a ); }, 0.0   );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the parallel reductions of integral dense vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// The reductions of integral values have to be exact, independent of the number of threads.
+*/
+inline void ReductionTest::testIntegral()
+{
+   test_ = "Integral dense vector reductions";
+
+   const size_t N( std::max( blaze::SMP_DVECREDUCE_THRESHOLD, size_t( 4*BLAZE_REPRODUCIBLE_REDUCTION_BLOCK_SIZE ) ) + 17UL );
+
+   IVT a( N ), b( N );
+   randomize( a, -100, 100 );
+   randomize( b, -100, 100 );
+
+   runTest( "sum()", [&]() { return double( sum( a ) );    }, 0.0 );
+   runTest( "min()", [&]() { return double( min( a ) );    }, 0.0 );
+   runTest( "max()", [&]() { return double( max( a ) );    }, 0.0 );
+   runTest( "dot()", [&]() { return double( dot( a, b ) ); }, 0.0 );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the parallel total reductions and norms of dense matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+inline void ReductionTest::testMatrix()
+{
+   test_ = "Dense matrix reductions";
+
+   const size_t M( 301UL );
+   const size_t N( blaze::SMP_DMATTOTALREDUCE_THRESHOLD / M + 257UL );
+
+   RMT A( M, N );
+   randomize( A, -1.0, 1.0 );
+
+   testMatrix( A, "row-major" );
+   testMatrix( CMT( A ), "column-major" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the combination of the partial results of a blockwise reduction.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This test is only performed in case the reproducible reductions are activated. The vector
+// consists of three blocks with the exact sums \f$ 2^{53} \f$, \f$ 1 \f$, and \f$ -2^{53} \f$.
+// Combining the partial results in ascending order results in 0, whereas the compensated
+// summation (see the \c BLAZE_USE_COMPENSATED_SUMMATION switch) yields the exact result 1.
+// The product of a vector of the same shape tests the combination of non-additive partial
+// results.
+*/
+inline void ReductionTest::testCombination()
+{
+#if BLAZE_REPRODUCIBLE_REDUCTION_MODE
+   test_ = "Combination of partial results";
+
+   const size_t B( BLAZE_REPRODUCIBLE_REDUCTION_BLOCK_SIZE );
+
+   VT a( 3UL*B ), p( 3UL*B, 1.0 );
+
+   for( size_t i=0UL; i<B; ++i ) {
+      a[i    ] =  std::ldexp( 1.0, 53 ) / double( B );
+      a[i+B  ] =  1.0 / double( B );
+      a[i+2*B] = -std::ldexp( 1.0, 53 ) / double( B );
+   }
+
+   p[0UL] = 0.5;
+   p[B  ] = 3.0;
+   p[2*B] = 0.25;
+
+   const double expected( BLAZE_COMPENSATED_SUMMATION_MODE ? 1.0 : 0.0 );
+
+   for( size_t threads=1UL; threads<=maxThreads; ++threads )
+   {
+      blaze::setNumThreads( threads );
+
+      const double result( sum( a ) );
+
+      if( result != expected || prod( p ) != 0.375 ) {
+         std::ostringstream oss;
+         oss.precision( 20 );
+         oss << " Test: " << test_ << "\n"
+             << " Error: Incorrect combination of partial results\n"
+             << " Details:\n"
+             << "   Number of threads = " << threads << "\n"
+             << "   Sum               = " << result << " (expected: " << expected << ")\n"
+             << "   Product           = " << prod( p ) << " (expected: 0.375)\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the parallel total reductions and norms of a specific dense matrix.
+//
+// \param A The dense matrix to be reduced.
+// \param label The label of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename MT >  // Type of the dense matrix
+void ReductionTest::testMatrix( const MT& A, const std::string& label )
+{
+   runTest( "sum() of " + label + " matrix"    , [&]() { return sum( A );     }, 1E-10 );
+   runTest( "min() of " + label + " matrix"    , [&]() { return min( A );     }, 0.0   );
+   runTest( "max() of " + label + " matrix"    , [&]() { return max( A );     }, 0.0   );
+   runTest( "norm() of " + label + " matrix"   , [&]() { return norm( A );    }, 1E-10 );
+   runTest( "sqrNorm() of " + label + " matrix", [&]() { return sqrNorm( A ); }, 1E-10 );
+   runTest( "l1Norm() of " + label + " matrix" , [&]() { return l1Norm( A );  }, 1E-10 );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Comparison of a parallel reduction with the according serial reduction.
+//
+// \param label The label of the reduction.
+// \param op The reduction to be tested.
+// \param tolerance The relative tolerance in case the reproducible reductions are not active.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// The reduction is evaluated within a serial section and for 1 to \a maxThreads threads. In
+// case the reproducible reductions are active, all results have to be bitwise identical.
+*/
+template< typename OP >  // Type of the reduction
+void ReductionTest::runTest( const std::string& label, OP op, double tolerance )
+{
+   double expected{};
+
+   BLAZE_SERIAL_SECTION
+   {
+      expected = op();
+   }
+
+   for( size_t threads=1UL; threads<=maxThreads; ++threads )
+   {
+      blaze::setNumThreads( threads );
+
+      const double result( op() );
+
+      const bool valid( BLAZE_REPRODUCIBLE_REDUCTION_MODE
+                        ? ( std::memcmp( &result, &expected, sizeof( double ) ) == 0 )
+                        : ( std::abs( result - expected ) <= tolerance * std::max( std::abs( expected ), 1.0 ) ) );
+
+      if( !valid ) {
+         std::ostringstream oss;
+         oss.precision( 20 );
+         oss << " Test: " << test_ << "\n"
+             << " Error: Incorrect result of " << label << " detected\n"
+             << " Details:\n"
+             << "   Reproducible reductions = " << ( BLAZE_REPRODUCIBLE_REDUCTION_MODE ? "on" : "off" ) << "\n"
+             << "   Number of threads       = " << threads << "\n"
+             << "   Result                  = " << result << "\n"
+             << "   Serial result           = " << expected << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the SMP reductions.
+//
+// \return void
+*/
+void runReductionTest()
+{
+   ReductionTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the SMP reduction test.
+*/
+#define RUN_SMP_REDUCTION_TEST \
+   blazetest::mathtest::smp::runReductionTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace smp
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,322 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/smp/ThreadMappingTest.h
+//  \brief Header file for the thread mapping test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SMP_THREADMAPPINGTEST_H_
+#define _BLAZETEST_MATHTEST_SMP_THREADMAPPINGTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/smp/ThreadMapping.h>
+#include <blaze/math/typetraits/IsColumnMajorMatrix.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smp {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the tests of the 2D mapping of threads.
+//
+// This class represents a test suite for the createThreadMapping() and getThreadBlock()
+// functions, which determine the partitioning of the parallel dense matrix assignments. For
+// several numbers of threads, cache domains, matrix sizes and both storage orders the test
+// checks that every thread is mapped to exactly one block and that the threads of each cache
+// domain work on a contiguous band of rows (row-major) or columns (column-major).
+*/
+class ThreadMappingTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ThreadMappingTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename MT >
+   void testMapping( const std::string& label );
+
+   template< typename MT >
+   void testMapping( const MT& A, size_t threads, size_t domains );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the ThreadMappingTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+inline ThreadMappingTest::ThreadMappingTest()
+{
+   testMapping< blaze::DynamicMatrix<int,blaze::rowMajor> >( "Row-major thread mapping" );
+   testMapping< blaze::DynamicMatrix<int,blaze::columnMajor> >( "Column-major thread mapping" );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the 2D mapping of threads for matrices of the given type.
+//
+// \param label The label of the test.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename MT >  // Type of the dense matrix
+void ThreadMappingTest::testMapping( const std::string& label )
+{
+   test_ = label;
+
+   const size_t sizes[][2] = {
+      { 1000UL, 37UL }, { 37UL, 1000UL }, { 500UL, 500UL }, { 64UL, 64UL },
+      { 3UL, 1000UL }, { 1000UL, 3UL }, { 13UL, 17UL } };
+
+   for( const auto& size : sizes )
+   {
+      const MT A( size[0], size[1] );
+
+      for( size_t threads=1UL; threads<=16UL; ++threads ) {
+         for( size_t domains=1UL; domains<=4UL; ++domains ) {
+            testMapping( A, threads, domains );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the 2D mapping of the given number of threads for the given matrix.
+//
+// \param A The matrix the mapping is created for.
+// \param threads The total number of threads.
+// \param domains The number of cache domains spanned by the threads.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename MT >  // Type of the dense matrix
+void ThreadMappingTest::testMapping( const MT& A, size_t threads, size_t domains )
+{
+   constexpr bool SO( blaze::IsColumnMajorMatrix_v<MT> );
+
+   const size_t M( A.rows() );
+   const size_t N( A.columns() );
+
+   const blaze::ThreadMapping mapping( blaze::createThreadMapping( threads, A, domains ) );
+
+   const bool banded( domains > 1UL && threads % domains == 0UL && ( SO ? N : M ) >= threads );
+
+   std::ostringstream details;
+   details << "   Matrix size       = " << M << "x" << N << "\n"
+           << "   Number of threads = " << threads << "\n"
+           << "   Number of domains = " << domains << "\n"
+           << "   Thread mapping    = " << mapping.first << "x" << mapping.second << "\n";
+
+   if( mapping.first * mapping.second != threads ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of mapped threads\n"
+          << " Details:\n"
+          << details.str();
+      throw std::runtime_error( oss.str() );
+   }
+
+   if( !banded && mapping != blaze::createThreadMapping_backend( threads, M, N, SO ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid mapping without cache domains\n"
+          << " Details:\n"
+          << details.str();
+      throw std::runtime_error( oss.str() );
+   }
+
+   const size_t bands( SO ? mapping.second : mapping.first );
+
+   if( banded && bands % domains != 0UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Blocks cannot be grouped into one band per cache domain\n"
+          << " Details:\n"
+          << details.str();
+      throw std::runtime_error( oss.str() );
+   }
+
+   std::vector<bool> mapped( threads, false );
+
+   for( size_t k=0UL; k<threads; ++k )
+   {
+      const std::pair<size_t,size_t> block( blaze::getThreadBlock( mapping, k, SO ) );
+
+      if( block.first >= mapping.first || block.second >= mapping.second ||
+          mapped[block.first*mapping.second+block.second] ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid block of thread " << k << "\n"
+             << " Details:\n"
+             << details.str()
+             << "   Block             = (" << block.first << "," << block.second << ")\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      mapped[block.first*mapping.second+block.second] = true;
+
+      // Consecutive threads have to advance along the storage order
+      const size_t outer( SO ? block.second : block.first  );
+      const size_t inner( SO ? block.first  : block.second );
+      const size_t width( SO ? mapping.first : mapping.second );
+
+      if( outer*width + inner != k ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Blocks are not enumerated along the storage order\n"
+             << " Details:\n"
+             << details.str()
+             << "   Thread            = " << k << "\n"
+             << "   Block             = (" << block.first << "," << block.second << ")\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      // The threads of each cache domain have to work on their own band of rows/columns
+      const size_t domain( k / ( threads / domains ) );
+
+      if( banded && outer / ( bands / domains ) != domain ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Thread is mapped outside the band of its cache domain\n"
+             << " Details:\n"
+             << details.str()
+             << "   Thread            = " << k << "\n"
+             << "   Cache domain      = " << domain << "\n"
+             << "   Block             = (" << block.first << "," << block.second << ")\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the 2D mapping of threads.
+//
+// \return void
+*/
+void runThreadMappingTest()
+{
+   ThreadMappingTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the thread mapping test.
+*/
+#define RUN_SMP_THREADMAPPING_TEST \
+   blazetest::mathtest::smp::runThreadMappingTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace smp
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,477 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/splitcompressedvector/ClassTest.h
+//  \brief Header file for the SplitCompressedVector class test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SPLITCOMPRESSEDVECTOR_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_SPLITCOMPRESSEDVECTOR_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/CompressedVector.h>
+#include <blaze/math/constraints/SparseVector.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/SplitCompressedVector.h>
+#include <blaze/util/Random.h>
+#include <blazetest/system/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace splitcompressedvector {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the SplitCompressedVector class template.
+//
+// This class represents a test suite for the blaze::SplitCompressedVector class template. It
+// performs a series of both compile time as well as runtime tests.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testConstructors();
+   void testAssignment  ();
+   void testAt          ();
+   void testLookup      ();
+   void testClear       ();
+   void testSwap        ();
+   void testInnerProduct();
+
+   template< typename Type, typename IT >
+   void runConversionTest( size_t n, size_t nonzeros );
+
+   template< typename Type, typename IT >
+   void runInnerProductTest( size_t n, size_t nonzeros1, size_t nonzeros2 );
+
+   template< typename Type >
+   void checkSize( const Type& vector, size_t expectedSize ) const;
+
+   template< typename Type >
+   void checkNonZeros( const Type& vector, size_t expectedNonZeros ) const;
+
+   template< typename VT1, typename VT2 >
+   void checkVector( const VT1& vector, const VT2& reference ) const;
+
+   template< typename T1, typename T2 >
+   void checkResult( const T1& result, const T2& reference ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename Type >
+   static blaze::CompressedVector<Type,blaze::columnVector> createVector( size_t n, size_t nonzeros );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   using VT   = blaze::SplitCompressedVector<double,blaze::columnVector>;           //!< Type of the split compressed vector.
+   using VT32 = blaze::SplitCompressedVector<double,blaze::columnVector,uint32_t>;  //!< Split compressed vector with 32-bit indices.
+   using TVT  = blaze::SplitCompressedVector<double,blaze::rowVector>;              //!< Transpose split compressed vector type.
+   using RVT  = blaze::CompressedVector<double,blaze::columnVector>;                //!< Reference vector type.
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_SPARSE_VECTOR_TYPE( VT   );
+   BLAZE_CONSTRAINT_MUST_BE_SPARSE_VECTOR_TYPE( VT32 );
+   BLAZE_CONSTRAINT_MUST_BE_SPARSE_VECTOR_TYPE( TVT  );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the conversion of a randomly initialized vector.
+//
+// \param n The size of the vector.
+// \param nonzeros The number of non-zero elements of the vector.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function converts a randomly initialized compressed vector and a dense vector to a
+// split compressed vector and checks the size, the number of non-zero elements, all elements
+// and the order of the elements.
+*/
+template< typename Type  // Data type of the vector elements
+        , typename IT >  // Index type
+void ClassTest::runConversionTest( size_t n, size_t nonzeros )
+{
+   const blaze::CompressedVector<Type,blaze::columnVector> ref( createVector<Type>( n, nonzeros ) );
+
+   {
+      const blaze::SplitCompressedVector<Type,blaze::columnVector,IT> vec( ref );
+      checkVector( vec, ref );
+   }
+
+   {
+      const blaze::DynamicVector<Type,blaze::columnVector> tmp( ref );
+      const blaze::SplitCompressedVector<Type,blaze::columnVector,IT> vec( tmp );
+      checkVector( vec, ref );
+   }
+
+   {
+      const blaze::SplitCompressedVector<Type,blaze::rowVector,IT> vec( trans( ref ) );
+      checkVector( vec, trans( ref ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the inner product kernels with randomly initialized vectors.
+//
+// \param n The size of the vectors.
+// \param nonzeros1 The number of non-zero elements of the first sparse vector.
+// \param nonzeros2 The number of non-zero elements of the second sparse vector.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the dense vector/sparse vector, sparse vector/dense vector and
+// sparse vector/sparse vector inner products of split compressed vectors with the according
+// inner products of compressed vectors. Both split compressed vectors and mixed split and
+// compressed operands are tested. Since all values are small integers, the results are exact
+// independent of the order of the summation.
+*/
+template< typename Type  // Data type of the vector elements
+        , typename IT >  // Index type
+void ClassTest::runInnerProductTest( size_t n, size_t nonzeros1, size_t nonzeros2 )
+{
+   using blaze::columnVector;
+   using blaze::rowVector;
+
+   const blaze::CompressedVector<Type,columnVector> ref1( createVector<Type>( n, nonzeros1 ) );
+   const blaze::CompressedVector<Type,columnVector> ref2( createVector<Type>( n, nonzeros2 ) );
+
+   const blaze::SplitCompressedVector<Type,columnVector,IT> a( ref1 );
+   const blaze::SplitCompressedVector<Type,columnVector,IT> b( ref2 );
+   const blaze::SplitCompressedVector<Type,rowVector,IT> c( trans( ref1 ) );
+
+   blaze::DynamicVector<Type,columnVector> x( n );
+   for( Type& element : x ) element = Type( blaze::rand<int>( -4, 4 ) );
+
+   const Type dvecsvec( trans( x ) * ref1 );
+   const Type svecsvec( trans( ref1 ) * ref2 );
+
+   checkResult( trans( x ) * a, dvecsvec );
+   checkResult( trans( a ) * x, dvecsvec );
+   checkResult( c * x, dvecsvec );
+   checkResult( trans( a ) * b, svecsvec );
+   checkResult( trans( b ) * a, svecsvec );
+   checkResult( c * b, svecsvec );
+   checkResult( trans( a ) * ref2, svecsvec );
+   checkResult( trans( ref1 ) * b, svecsvec );
+   checkResult( trans( a ) * a, Type( trans( ref1 ) * ref1 ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the size of the given vector.
+//
+// \param vector The vector to be checked.
+// \param expectedSize The expected size of the vector.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the size of the given vector. In case the actual size does not
+// correspond to the given expected size, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Type of the vector
+void ClassTest::checkSize( const Type& vector, size_t expectedSize ) const
+{
+   if( vector.size() != expectedSize ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid size detected\n"
+          << " Details:\n"
+          << "   Size         : " << vector.size() << "\n"
+          << "   Expected size: " << expectedSize << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the number of non-zero elements of the given vector.
+//
+// \param vector The vector to be checked.
+// \param expectedNonZeros The expected number of non-zero elements of the vector.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the number of non-zero elements of the given vector. In case the
+// actual number of non-zero elements does not correspond to the given expected number,
+// a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Type of the vector
+void ClassTest::checkNonZeros( const Type& vector, size_t expectedNonZeros ) const
+{
+   if( vector.nonZeros() != expectedNonZeros ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of non-zero elements\n"
+          << " Details:\n"
+          << "   Number of non-zeros         : " << vector.nonZeros() << "\n"
+          << "   Expected number of non-zeros: " << expectedNonZeros << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   if( vector.capacity() < vector.nonZeros() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid capacity detected\n"
+          << " Details:\n"
+          << "   Number of non-zeros: " << vector.nonZeros() << "\n"
+          << "   Capacity           : " << vector.capacity() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Comparison of a split compressed vector with a reference vector.
+//
+// \param vector The split compressed vector to be checked.
+// \param reference The compressed reference vector.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the size, the number of non-zero elements and all elements of the
+// given split compressed vector with the given reference vector. Additionally it checks that
+// the iterators traverse exactly the non-zero elements of the reference vector in ascending
+// order of their indices. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+template< typename VT1    // Type of the split compressed vector
+        , typename VT2 >  // Type of the reference vector
+void ClassTest::checkVector( const VT1& vector, const VT2& reference ) const
+{
+   checkSize    ( vector, reference.size()     );
+   checkNonZeros( vector, reference.nonZeros() );
+
+   if( vector != reference ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Vector comparison failed\n"
+          << " Details:\n"
+          << "   Vector type:\n"
+          << "     " << typeid( VT1 ).name() << "\n"
+          << "   Result:\n" << vector << "\n"
+          << "   Expected result:\n" << reference << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   auto element( vector.begin() );
+   for( auto ref=reference.begin(); ref!=reference.end(); ++ref, ++element )
+   {
+      if( element == vector.end() || element->index() != ref->index() || element->value() != ref->value() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Iteration over the vector failed\n"
+             << " Details:\n"
+             << "   Expected index: " << ref->index() << "\n"
+             << "   Expected value: " << ref->value() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   if( element != vector.end() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Iteration over the vector failed\n"
+          << " Details:\n"
+          << "   Additional elements detected after the last non-zero element\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Comparison of the result of an inner product with the expected result.
+//
+// \param result The computed inner product.
+// \param reference The expected inner product.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the given result with the given reference. In case the values
+// differ, a \a std::runtime_error exception is thrown.
+*/
+template< typename T1    // Type of the result
+        , typename T2 >  // Type of the reference
+void ClassTest::checkResult( const T1& result, const T2& reference ) const
+{
+   if( result != reference ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Inner product failed\n"
+          << " Details:\n"
+          << "   Result         : " << result << "\n"
+          << "   Expected result: " << reference << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creation of a randomly initialized compressed vector.
+//
+// \param n The size of the vector.
+// \param nonzeros The (maximum) number of non-zero elements of the vector.
+// \return The randomly initialized compressed vector.
+//
+// This function creates a compressed vector with up to \a nonzeros randomly placed non-zero
+// elements. All values are small integers, which keeps all inner products exact even in
+// single precision.
+*/
+template< typename Type >  // Data type of the vector elements
+blaze::CompressedVector<Type,blaze::columnVector> ClassTest::createVector( size_t n, size_t nonzeros )
+{
+   blaze::CompressedVector<Type,blaze::columnVector> v( n );
+
+   if( n == 0UL )
+      return v;
+
+   for( size_t k=0UL; k<nonzeros; ++k ) {
+      v[blaze::rand<size_t>( 0UL, n-1UL )] = Type( blaze::rand<int>( 1, 9 ) );
+   }
+
+   return v;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the functionality of the SplitCompressedVector class template.
+//
+// \return void
+*/
+void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the SplitCompressedVector class test.
+*/
+#define RUN_SPLITCOMPRESSEDVECTOR_CLASS_TEST \
+   blazetest::mathtest::splitcompressedvector::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace splitcompressedvector
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,190 @@
+//=================================================================================================
+/*!
+//  \file blazetest/utiltest/kerneltrace/OperationTest.h
+//  \brief Header file for the kernel trace operation test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_UTILTEST_KERNELTRACE_OPERATIONTEST_H_
+#define _BLAZETEST_UTILTEST_KERNELTRACE_OPERATIONTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <string>
+#include <vector>
+#include <blaze/util/KernelTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blazetest {
+
+namespace utiltest {
+
+namespace kerneltrace {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all kernel trace related tests.
+//
+// This class represents a test suite for the kernel traces (see the BLAZE_KERNEL_TRACE macro).
+// It records events on several threads, parses the JSON output of writeKernelTraces(), and
+// checks the recorded events, the wrap-around of the per-thread ring buffers, the effect of
+// clearKernelTraces(), and the reuse of the trace buffers of exited threads.
+*/
+class OperationTest
+{
+ private:
+   //**Type definitions****************************************************************************
+   /*!\brief A parsed JSON value.
+   */
+   struct JsonValue
+   {
+      char                     type;     //!< The type of the value ('n', 'b', '0', '"', '[', or '{').
+      double                   number;   //!< The value of a number or boolean.
+      std::string              string;   //!< The value of a string.
+      std::vector<JsonValue>   values;   //!< The elements of an array or the values of an object.
+      std::vector<std::string> keys;     //!< The keys of an object.
+   };
+
+   /*!\brief A parsed kernel trace event.
+   */
+   struct Event
+   {
+      std::string name;  //!< The name of the traced operation.
+      std::string ph;    //!< The phase of the event ("X" or "M").
+      size_t      tid;   //!< The index of the thread.
+      std::string cat;   //!< The selected kernel.
+      double      ts;    //!< The begin of the event in microseconds.
+      double      dur;   //!< The duration of the event in microseconds.
+      size_t      m;     //!< The first dimension of the operation.
+      size_t      n;     //!< The second dimension of the operation.
+      size_t      k;     //!< The third dimension of the operation.
+   };
+   //**********************************************************************************************
+
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit OperationTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testThreads   ();
+   void testRecycling ();
+   void testWrapAround();
+   void testClear     ();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   std::vector<Event> readTraces() const;
+   std::vector<Event> filter( const std::vector<Event>& events, const std::string& name ) const;
+   size_t countBuffers() const;
+
+   JsonValue parseJson ( const std::string& text ) const;
+   JsonValue parseValue( const std::string& text, size_t& pos ) const;
+   const JsonValue& member( const JsonValue& object, const std::string& key, char type ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the kernel trace functionality.
+//
+// \return void
+*/
+void runTest()
+{
+   OperationTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the kernel trace operation test.
+*/
+#define RUN_KERNELTRACE_OPERATION_TEST \
+   blazetest::utiltest::kerneltrace::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace kerneltrace
+
+} // namespace utiltest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,171 @@
+//=================================================================================================
+/*!
+//  \file blazetest/utiltest/workstealing/OperationTest.h
+//  \brief Header file for the work stealing operation test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_UTILTEST_WORKSTEALING_OPERATIONTEST_H_
+#define _BLAZETEST_UTILTEST_WORKSTEALING_OPERATIONTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <blaze/util/threadpool/Task.h>
+#include <blaze/util/threadpool/WorkStealingDeque.h>
+#include <blaze/util/WorkStealingPool.h>
+
+
+namespace blazetest {
+
+namespace utiltest {
+
+namespace workstealing {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all work stealing related tests.
+//
+// This class represents a test suite for the lock-free work-stealing deque and the work-stealing
+// thread pool (see the threadpool::WorkStealingDeque and WorkStealingPool class templates). It
+// performs single-threaded tests of the deque operations as well as concurrent tests of the
+// stealing, the load balancing and the exception handling of the thread pool. Additionally, it
+// compares parallel assignments of the C++11 thread backend with the serial results.
+*/
+class OperationTest
+{
+ private:
+   //**Type definitions****************************************************************************
+   using Task  = blaze::threadpool::Task;               //!< Type of a single task.
+   using Deque = blaze::threadpool::WorkStealingDeque;  //!< Type of the work-stealing deque.
+
+   //! Type of the tested work-stealing thread pool.
+   using Pool = blaze::WorkStealingPool< std::thread
+                                       , std::mutex
+                                       , std::unique_lock<std::mutex>
+                                       , std::condition_variable >;
+   //**********************************************************************************************
+
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit OperationTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testPushPop     ();
+   void testGrowth      ();
+   void testStealPop    ();
+   void testStealStress ();
+   void testPool        ();
+   void testStealHalf   ();
+   void testException   ();
+   void testThreadAssign();
+
+   void checkTask( const Task* task, const Task* expected, size_t index ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the work stealing functionality.
+//
+// \return void
+*/
+void runTest()
+{
+   OperationTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the work stealing operation test.
+*/
+#define RUN_WORKSTEALING_OPERATION_TEST \
+   blazetest::utiltest::workstealing::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace workstealing
+
+} // namespace utiltest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,568 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/batchedmatrix/ClassTest.cpp
+//  \brief Source file for the BatchedMatrix class test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blazetest/mathtest/batchedmatrix/ClassTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace batchedmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the BatchedMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testAccess();
+   testGetSet();
+   testResize();
+   testSwap();
+   testGemm();
+   testLU();
+   testInvert();
+   testSolve();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the BatchedMatrix constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the BatchedMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   constexpr size_t S( BMT::SIMDSIZE );
+
+   //=====================================================================================
+   // Default constructor
+   //=====================================================================================
+
+   {
+      test_ = "BatchedMatrix default constructor";
+
+      const BMT A;
+
+      checkSize( A, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Size constructor
+   //=====================================================================================
+
+   {
+      test_ = "BatchedMatrix size constructor";
+
+      const BMT A( S+1UL );
+
+      checkBatch( A, MTs( S+1UL, MT( 0.0 ) ) );
+
+      if( A.rows() != 3UL || A.columns() != 4UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid matrix dimensions detected\n"
+             << " Details:\n"
+             << "   Number of rows   : " << A.rows() << " (expected 3)\n"
+             << "   Number of columns: " << A.columns() << " (expected 4)\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Homogeneous initialization
+   //=====================================================================================
+
+   {
+      test_ = "BatchedMatrix homogeneous initialization constructor";
+
+      const BMT A( 3UL*S+3UL, 2.0 );
+
+      checkBatch( A, MTs( 3UL*S+3UL, MT( 2.0 ) ) );
+   }
+
+
+   //=====================================================================================
+   // Copy constructor
+   //=====================================================================================
+
+   {
+      test_ = "BatchedMatrix copy constructor";
+
+      BMT A( S+1UL );
+      initialize( A );
+
+      const BMT B( A );
+
+      checkBatch( B, extract( A ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the element access functions of the BatchedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the function call operator and the at() function of the
+// BatchedMatrix class template. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void ClassTest::testAccess()
+{
+   constexpr size_t S( BMT::SIMDSIZE );
+
+   //=====================================================================================
+   // Function call operator
+   //=====================================================================================
+
+   {
+      test_ = "BatchedMatrix::operator()";
+
+      BMT A( S+2UL );
+      MTs ref( S+2UL, MT( 0.0 ) );
+
+      for( size_t b=0UL; b<A.size(); ++b ) {
+         A(b,b%3UL,b%4UL) = double( b+1UL );
+         ref[b](b%3UL,b%4UL) = double( b+1UL );
+      }
+
+      A(S,2,3) += 5.0;
+      ref[S](2,3) += 5.0;
+
+      checkBatch( A, ref );
+
+      const BMT& cA( A );
+
+      if( cA(S+1UL,(S+1UL)%3UL,(S+1UL)%4UL) != double( S+2UL ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Access via function call operator failed\n"
+             << " Details:\n"
+             << "   Result: " << cA(S+1UL,(S+1UL)%3UL,(S+1UL)%4UL) << "\n"
+             << "   Expected result: " << double( S+2UL ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // at() function
+   //=====================================================================================
+
+   {
+      test_ = "BatchedMatrix::at()";
+
+      BMT A( S+1UL );
+      A.at(S,2,3) = 4.0;
+
+      const BMT& cA( A );
+
+      if( cA.at(S,2,3) != 4.0 || cA.at(0,2,3) != 0.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Access via at() function failed\n"
+             << " Details:\n"
+             << "   Result:\n" << A.get(S) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      try {
+         cA.at(S+1UL,0,0);
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Out-of-bound batch access succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::out_of_range& ) {}
+
+      try {
+         A.at(0,3,0);
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Out-of-bound row access succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::out_of_range& ) {}
+
+      try {
+         A.at(0,0,4);
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Out-of-bound column access succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::out_of_range& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the get() and set() member functions of the BatchedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the get() and set() member functions of the BatchedMatrix
+// class template, including the setting of row-major and column-major matrices and the handling
+// of invalid indices and sizes. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void ClassTest::testGetSet()
+{
+   test_ = "BatchedMatrix::get() and BatchedMatrix::set()";
+
+   constexpr size_t S( BMT::SIMDSIZE );
+
+   BMT A( 3UL*S+3UL );
+   MTs ref( A.size(), MT( 0.0 ) );
+
+   for( size_t b=0UL; b<A.size(); ++b ) {
+      for( size_t i=0UL; i<3UL; ++i )
+         for( size_t j=0UL; j<4UL; ++j )
+            ref[b](i,j) = value<double>();
+
+      if( b % 2UL == 0UL )
+         A.set( b, ref[b] );
+      else
+         A.set( b, blaze::DynamicMatrix<double,blaze::columnMajor>( ref[b] ) );
+   }
+
+   checkBatch( A, ref );
+
+   try {
+      A.get( A.size() );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Out-of-bound get() succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::out_of_range& ) {}
+
+   try {
+      A.set( A.size(), ref[0] );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Out-of-bound set() succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::out_of_range& ) {}
+
+   try {
+      A.set( 0UL, blaze::DynamicMatrix<double>( 4UL, 3UL, 1.0 ) );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Setting a matrix of invalid size succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   checkBatch( A, ref );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the resize(), reset() and clear() member functions of the BatchedMatrix class.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the resize(), reset() and clear() member functions of the
+// BatchedMatrix class template. In particular it checks that matrices that are removed from a
+// partially filled group do not reappear when the batch is enlarged again. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testResize()
+{
+   constexpr size_t S( BMT::SIMDSIZE );
+
+   {
+      test_ = "BatchedMatrix::resize()";
+
+      BMT A( S+2UL );
+      initialize( A );
+
+      MTs ref( extract( A ) );
+
+      A.resize( 3UL*S+3UL );
+      ref.resize( 3UL*S+3UL, MT( 0.0 ) );
+      checkBatch( A, ref );
+
+      A.resize( 1UL );
+      ref.resize( 1UL );
+      checkBatch( A, ref );
+
+      A.resize( S+2UL );
+      ref.resize( S+2UL, MT( 0.0 ) );
+      checkBatch( A, ref );
+
+      A.resize( 0UL );
+      checkSize( A, 0UL );
+   }
+
+   {
+      test_ = "BatchedMatrix::reset()";
+
+      BMT A( S+1UL );
+      initialize( A );
+      A.reset();
+
+      checkBatch( A, MTs( S+1UL, MT( 0.0 ) ) );
+   }
+
+   {
+      test_ = "BatchedMatrix::clear()";
+
+      BMT A( S+1UL );
+      initialize( A );
+      A.clear();
+
+      checkSize( A, 0UL );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the swap functionality of the BatchedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the swap() member function and the swap() function of the
+// BatchedMatrix class template. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void ClassTest::testSwap()
+{
+   test_ = "BatchedMatrix swap";
+
+   constexpr size_t S( BMT::SIMDSIZE );
+
+   BMT A( S+1UL ), B( 3UL*S+3UL );
+   initialize( A );
+   initialize( B );
+
+   const MTs refA( extract( A ) );
+   const MTs refB( extract( B ) );
+
+   A.swap( B );
+
+   checkBatch( A, refB );
+   checkBatch( B, refA );
+
+   swap( A, B );
+
+   checkBatch( A, refA );
+   checkBatch( B, refB );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the batched matrix multiplication.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the gemm() function for square and non-square matrices of
+// vectorizable element types. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void ClassTest::testGemm()
+{
+   test_ = "BatchedMatrix gemm()";
+
+   runGemmTest<int,3UL,3UL,3UL>();
+   runGemmTest<int,2UL,5UL,4UL>();
+   runGemmTest<float,3UL,3UL,3UL>();
+   runGemmTest<float,5UL,1UL,3UL>();
+   runGemmTest<double,3UL,3UL,3UL>();
+   runGemmTest<double,2UL,5UL,4UL>();
+   runGemmTest<cdouble,3UL,3UL,3UL>();
+   runGemmTest<cdouble,4UL,2UL,3UL>();
+
+   test_ = "BatchedMatrix gemm() with aliasing";
+
+   runGemmAliasingTest<int,3UL>();
+   runGemmAliasingTest<double,1UL>();
+   runGemmAliasingTest<double,4UL>();
+   runGemmAliasingTest<cdouble,3UL>();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the batched LU decomposition.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the getrf() and getrs() functions. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testLU()
+{
+   test_ = "BatchedMatrix getrf() and getrs()";
+
+   runLUTest<double,1UL,1UL>();
+   runLUTest<double,3UL,2UL>();
+   runLUTest<double,5UL,1UL>();
+   runLUTest<cdouble,3UL,2UL>();
+   runLUTest<cdouble,4UL,1UL>();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the batched matrix inversion.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the invert() function. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testInvert()
+{
+   test_ = "BatchedMatrix invert()";
+
+   runInvertTest<double,1UL>();
+   runInvertTest<double,2UL>();
+   runInvertTest<double,3UL>();
+   runInvertTest<double,6UL>();
+   runInvertTest<cdouble,3UL>();
+   runInvertTest<cdouble,4UL>();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the batched solution of systems of linear equations.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the solve() function. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSolve()
+{
+   test_ = "BatchedMatrix solve()";
+
+   runSolveTest<double,1UL,1UL>();
+   runSolveTest<double,3UL,1UL>();
+   runSolveTest<double,4UL,3UL>();
+   runSolveTest<cdouble,3UL,2UL>();
+}
+//*************************************************************************************************
+
+} // namespace batchedmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running BatchedMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_BATCHEDMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during BatchedMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,592 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/binaryserialization/ClassTest.cpp
+//  \brief Source file for the BinarySerialization class test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <blazetest/mathtest/binaryserialization/ClassTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace binaryserialization {
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+const char* const ClassTest::fileA = "blazetest_binaryserialization_a.bin";
+const char* const ClassTest::fileB = "blazetest_binaryserialization_b.bin";
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the BinarySerialization class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testDenseVector();
+   testDenseMatrix();
+   testSparseMatrix();
+   testCopyOnWrite();
+   testFailures();
+
+   removeFiles();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the binary serialization of dense vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs round trip tests with dense column and row vectors of various sizes
+// and element types. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testDenseVector()
+{
+   test_ = "Binary serialization of dense vectors";
+
+   for( size_t n : { 0UL, 1UL, 7UL, 33UL, 100UL } ) {
+      runDenseVectorTest<double ,blaze::columnVector>( n );
+      runDenseVectorTest<double ,blaze::rowVector   >( n );
+      runDenseVectorTest<float  ,blaze::columnVector>( n );
+      runDenseVectorTest<int    ,blaze::rowVector   >( n );
+      runDenseVectorTest<cdouble,blaze::columnVector>( n );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the binary serialization of dense matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs round trip tests with row-major and column-major dense matrices of
+// various sizes and element types. The sizes include rows and columns, which are not a multiple
+// of the padding of the binary file. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testDenseMatrix()
+{
+   test_ = "Binary serialization of dense matrices";
+
+   for( size_t m : { 0UL, 1UL, 7UL, 33UL } ) {
+      for( size_t n : { 1UL, 5UL, 13UL, 40UL } ) {
+         runDenseMatrixTest<double ,blaze::rowMajor   >( m, n );
+         runDenseMatrixTest<double ,blaze::columnMajor>( m, n );
+         runDenseMatrixTest<float  ,blaze::rowMajor   >( m, n );
+         runDenseMatrixTest<int    ,blaze::columnMajor>( m, n );
+         runDenseMatrixTest<cdouble,blaze::rowMajor   >( m, n );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the binary serialization of sparse matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs round trip tests with row-major and column-major compressed matrices
+// of various sizes and element types, and uses the mapped views in multiplications with dense
+// vectors. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSparseMatrix()
+{
+   test_ = "Binary serialization of sparse matrices";
+
+   for( size_t m : { 0UL, 1UL, 7UL, 40UL } ) {
+      for( size_t n : { 1UL, 13UL, 25UL } ) {
+         runSparseMatrixTest<double,blaze::rowMajor   >( m, n );
+         runSparseMatrixTest<double,blaze::columnMajor>( m, n );
+         runSparseMatrixTest<float ,blaze::rowMajor   >( m, n );
+         runSparseMatrixTest<int   ,blaze::columnMajor>( m, n );
+      }
+   }
+
+   {
+      test_ = "Binary serialization of a sparse matrix with 32-bit indices";
+
+      blaze::CompressedMatrix<double,blaze::rowMajor,uint32_t> ref( 9UL, 11UL );
+      ref(0,3) = 1.0;
+      ref(4,0) = 2.0;
+      ref(4,10) = 3.0;
+      ref(8,5) = 4.0;
+
+      blaze::writeBinary( fileA, ref );
+
+      blaze::MemoryMap map;
+      const blaze::CompressedMatrixView<double,blaze::rowMajor> A(
+         blaze::mapSparseMatrix<double,blaze::rowMajor>( fileA, map ) );
+
+      checkResult( A, ref, fileA );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the copy-on-write mapping of dense vectors and matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function modifies mapped dense vectors and matrices and checks that the modifications
+// neither change the content of the binary file nor become visible in other mappings of the
+// same file. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testCopyOnWrite()
+{
+   //=====================================================================================
+   // Dense vectors
+   //=====================================================================================
+
+   {
+      test_ = "Copy-on-write mapping of a dense vector";
+
+      blaze::DynamicVector<double,blaze::columnVector> ref( 37UL );
+      for( double& element : ref ) element = value<double>();
+
+      blaze::writeBinary( fileA, ref );
+      const std::vector<char> bytes( readFile( fileA ) );
+
+      blaze::MemoryMap map1;
+      blaze::CustomVector<double,blaze::aligned,blaze::unpadded,blaze::columnVector> x(
+         blaze::mapDenseVector<double,blaze::columnVector>( fileA, map1 ) );
+
+      x[0] = 100.0;
+      x *= 2.0;
+
+      map1.flush();
+
+      if( readFile( fileA ) != bytes ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Modification of the mapped vector reached the file\n"
+             << " Details:\n"
+             << "   File: " << fileA << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      blaze::MemoryMap map2;
+      const blaze::CustomVector<double,blaze::aligned,blaze::unpadded,blaze::columnVector> y(
+         blaze::mapDenseVector<double,blaze::columnVector>( fileA, map2 ) );
+
+      checkResult( y, ref, fileA );
+
+      if( x[0] != 200.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Modification of the mapped vector failed\n"
+             << " Details:\n"
+             << "   Result: " << x[0] << "\n"
+             << "   Expected result: 200\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Dense matrices
+   //=====================================================================================
+
+   {
+      test_ = "Copy-on-write mapping of a dense matrix";
+
+      blaze::DynamicMatrix<double,blaze::rowMajor> ref( 7UL, 13UL );
+      for( size_t i=0UL; i<ref.rows(); ++i )
+         for( size_t j=0UL; j<ref.columns(); ++j )
+            ref(i,j) = value<double>();
+
+      blaze::writeBinary( fileA, ref );
+      const std::vector<char> bytes( readFile( fileA ) );
+
+      blaze::MemoryMap map1;
+      blaze::CustomMatrix<double,blaze::aligned,blaze::unpadded,blaze::rowMajor> A(
+         blaze::mapDenseMatrix<double,blaze::rowMajor>( fileA, map1 ) );
+
+      A = 0.0;
+      A(6,12) = 1.0;
+
+      map1.flush();
+
+      if( readFile( fileA ) != bytes ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Modification of the mapped matrix reached the file\n"
+             << " Details:\n"
+             << "   File: " << fileA << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      blaze::MemoryMap map2;
+      const blaze::CustomMatrix<double,blaze::aligned,blaze::unpadded,blaze::rowMajor> B(
+         blaze::mapDenseMatrix<double,blaze::rowMajor>( fileA, map2 ) );
+
+      checkResult( B, ref, fileA );
+
+      if( A(6,12) != 1.0 || A(0,0) != 0.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Modification of the mapped matrix failed\n"
+             << " Details:\n"
+             << "   Result:\n" << A << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the validation of binary files.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that missing files, files of a different element type, storage order,
+// transpose flag, kind of data, index type or byte order, and files with a corrupted header,
+// size or offsets are rejected. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testFailures()
+{
+   test_ = "Validation of binary files";
+
+   const auto rowMajorDouble = []( const std::string& file, blaze::MemoryMap& map ) {
+      blaze::mapDenseMatrix<double,blaze::rowMajor>( file, map );
+   };
+   const auto columnMajorDouble = []( const std::string& file, blaze::MemoryMap& map ) {
+      blaze::mapDenseMatrix<double,blaze::columnMajor>( file, map );
+   };
+   const auto rowMajorFloat = []( const std::string& file, blaze::MemoryMap& map ) {
+      blaze::mapDenseMatrix<float,blaze::rowMajor>( file, map );
+   };
+   const auto rowMajorInt64 = []( const std::string& file, blaze::MemoryMap& map ) {
+      blaze::mapDenseMatrix<int64_t,blaze::rowMajor>( file, map );
+   };
+   const auto rowMajorComplex = []( const std::string& file, blaze::MemoryMap& map ) {
+      blaze::mapDenseMatrix<cdouble,blaze::rowMajor>( file, map );
+   };
+   const auto columnVector = []( const std::string& file, blaze::MemoryMap& map ) {
+      blaze::mapDenseVector<double,blaze::columnVector>( file, map );
+   };
+   const auto rowVector = []( const std::string& file, blaze::MemoryMap& map ) {
+      blaze::mapDenseVector<double,blaze::rowVector>( file, map );
+   };
+   const auto rowMajorSparse = []( const std::string& file, blaze::MemoryMap& map ) {
+      blaze::mapSparseMatrix<double,blaze::rowMajor>( file, map );
+   };
+   const auto columnMajorSparse = []( const std::string& file, blaze::MemoryMap& map ) {
+      blaze::mapSparseMatrix<double,blaze::columnMajor>( file, map );
+   };
+   const auto rowMajorSparse32 = []( const std::string& file, blaze::MemoryMap& map ) {
+      blaze::mapSparseMatrix<double,blaze::rowMajor,uint32_t>( file, map );
+   };
+
+
+   //=====================================================================================
+   // Missing file
+   //=====================================================================================
+
+   removeFiles();
+   checkInvalidFile( fileA, rowMajorDouble, "File could not be opened" );
+
+
+   //=====================================================================================
+   // Dense matrix files
+   //=====================================================================================
+
+   {
+      blaze::DynamicMatrix<double,blaze::rowMajor> A( 7UL, 13UL );
+      for( size_t i=0UL; i<A.rows(); ++i )
+         for( size_t j=0UL; j<A.columns(); ++j )
+            A(i,j) = value<double>();
+
+      blaze::writeBinary( fileA, A );
+   }
+
+   const std::vector<char> dense( readFile( fileA ) );
+
+   checkInvalidFile( fileA, rowMajorFloat    , "Incompatible element type"  );
+   checkInvalidFile( fileA, rowMajorInt64    , "Incompatible element type"  );
+   checkInvalidFile( fileA, rowMajorComplex  , "Incompatible element type"  );
+   checkInvalidFile( fileA, columnMajorDouble, "Incompatible storage order" );
+   checkInvalidFile( fileA, columnVector     , "Invalid binary file"        );
+   checkInvalidFile( fileA, rowMajorSparse   , "Invalid binary file"        );
+
+   {
+      std::vector<char> bytes( dense );
+      bytes[0] = 'X';
+      writeFile( fileB, bytes );
+      checkInvalidFile( fileB, rowMajorDouble, "Invalid binary file" );
+   }
+
+   patchFile( fileB, dense, 8UL, 2U );
+   checkInvalidFile( fileB, rowMajorDouble, "Invalid binary file" );
+
+   patchFile( fileB, dense, 16UL, 0x0807060504030201UL );
+   checkInvalidFile( fileB, rowMajorDouble, "Incompatible byte order" );
+
+   patchFile( fileB, dense, 72UL, 14U );
+   checkInvalidFile( fileB, rowMajorDouble, "Invalid binary file" );
+
+   patchFile( fileB, dense, 80UL, 12U );
+   checkInvalidFile( fileB, rowMajorDouble, "Invalid binary file" );
+
+   {
+      std::vector<char> bytes( dense.begin(), dense.end()-sizeof(double) );
+      writeFile( fileB, bytes );
+      checkInvalidFile( fileB, rowMajorDouble, "Invalid binary file" );
+   }
+
+   {
+      std::vector<char> bytes( dense );
+      bytes.resize( bytes.size() + 64UL, 0 );
+      writeFile( fileB, bytes );
+      checkInvalidFile( fileB, rowMajorDouble, "Invalid binary file" );
+   }
+
+   {
+      std::vector<char> bytes( dense.begin(), dense.begin()+100 );
+      writeFile( fileB, bytes );
+      checkInvalidFile( fileB, rowMajorDouble, "Invalid binary file" );
+   }
+
+
+   //=====================================================================================
+   // Dense vector files
+   //=====================================================================================
+
+   {
+      blaze::DynamicVector<double,blaze::columnVector> x( 13UL );
+      for( double& element : x ) element = value<double>();
+
+      blaze::writeBinary( fileA, x );
+   }
+
+   checkInvalidFile( fileA, rowVector     , "Incompatible storage order" );
+   checkInvalidFile( fileA, rowMajorDouble, "Invalid binary file"        );
+
+   {
+      const std::vector<char> bytes( readFile( fileA ) );
+
+      patchFile( fileB, bytes, 16UL, 0x0807060504030201UL );
+      checkInvalidFile( fileB, columnVector, "Incompatible byte order" );
+
+      patchFile( fileB, bytes, 64UL, 14U );
+      checkInvalidFile( fileB, columnVector, "Invalid binary file" );
+   }
+
+
+   //=====================================================================================
+   // Sparse matrix files
+   //=====================================================================================
+
+   {
+      blaze::CompressedMatrix<double,blaze::rowMajor> A( 5UL, 8UL );
+      A(0,1) = 1.0;
+      A(0,7) = 2.0;
+      A(3,2) = 3.0;
+      A(4,4) = 4.0;
+
+      blaze::writeBinary( fileA, A );
+   }
+
+   const std::vector<char> sparse( readFile( fileA ) );
+
+   checkInvalidFile( fileA, columnMajorSparse, "Incompatible storage order" );
+   checkInvalidFile( fileA, rowMajorSparse32 , "Incompatible index type"    );
+   checkInvalidFile( fileA, rowMajorDouble   , "Invalid binary file"        );
+
+   patchFile( fileB, sparse, 16UL, 0x0807060504030201UL );
+   checkInvalidFile( fileB, rowMajorSparse, "Incompatible byte order" );
+
+   patchFile( fileB, sparse, 88UL, 5U );
+   checkInvalidFile( fileB, rowMajorSparse, "Invalid binary file" );
+
+   patchFile( fileB, sparse, 128UL, 1U );
+   checkInvalidFile( fileB, rowMajorSparse, "Invalid binary file" );
+
+   patchFile( fileB, sparse, 136UL, 3U );
+   checkInvalidFile( fileB, rowMajorSparse, "Invalid binary file" );
+
+   {
+      std::vector<char> bytes( sparse.begin(), sparse.end()-1 );
+      writeFile( fileB, bytes );
+      checkInvalidFile( fileB, rowMajorSparse, "Invalid binary file" );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Reading the complete content of the given file.
+//
+// \param file The name of the file.
+// \return The content of the file.
+*/
+std::vector<char> ClassTest::readFile( const std::string& file )
+{
+   std::ifstream in( file, std::ios::binary );
+   return std::vector<char>( std::istreambuf_iterator<char>( in ), std::istreambuf_iterator<char>() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Replacing the content of the given file.
+//
+// \param file The name of the file.
+// \param bytes The new content of the file.
+// \return void
+*/
+void ClassTest::writeFile( const std::string& file, const std::vector<char>& bytes )
+{
+   std::ofstream out( file, std::ios::binary | std::ios::trunc );
+   out.write( bytes.data(), bytes.size() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writing a copy of the given content with a single modified 64-bit value.
+//
+// \param file The name of the file.
+// \param bytes The original content of the file.
+// \param offset The offset of the modified value in bytes.
+// \param value The new value.
+// \return void
+*/
+void ClassTest::patchFile( const std::string& file, const std::vector<char>& bytes,
+                           size_t offset, uint64_t value )
+{
+   std::vector<char> tmp( bytes );
+   std::memcpy( tmp.data()+offset, &value, sizeof( value ) );
+   writeFile( file, tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removing all temporary binary files.
+//
+// \return void
+*/
+void ClassTest::removeFiles()
+{
+   std::remove( fileA );
+   std::remove( fileB );
+}
+//*************************************************************************************************
+
+} // namespace binaryserialization
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running BinarySerialization class test..." << std::endl;
+
+   try
+   {
+      RUN_BINARYSERIALIZATION_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during BinarySerialization class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
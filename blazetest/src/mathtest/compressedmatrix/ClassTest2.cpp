@@ -37,8 +37,12 @@
 // Includes
 //*************************************************************************************************
 
+#include <cstdint>
 #include <cstdlib>
 #include <iostream>
+#include <limits>
+#include <vector>
+#include <blaze/math/DynamicMatrix.h>
 #include <blaze/util/Complex.h>
 #include <blaze/util/Random.h>
 #include <blazetest/mathtest/compressedmatrix/ClassTest.h>
@@ -90,6 +94,7 @@ ClassTest::ClassTest()
    testTranspose();
    testCTranspose();
    testIsDefault();
+   testIndexType();
 }
 //*************************************************************************************************
 
@@ -7161,6 +7166,365 @@ void ClassTest::testIsDefault()
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Test of the CompressedMatrix class template with a custom index type.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of row-major and column-major compressed matrices with the
+// \c uint8_t and \c uint32_t index types. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testIndexType()
+{
+   testIndexType<blaze::rowMajor   ,uint8_t >( "Row-major CompressedMatrix<int,rowMajor,uint8_t>" );
+   testIndexType<blaze::rowMajor   ,uint32_t>( "Row-major CompressedMatrix<int,rowMajor,uint32_t>" );
+   testIndexType<blaze::columnMajor,uint8_t >( "Column-major CompressedMatrix<int,columnMajor,uint8_t>" );
+   testIndexType<blaze::columnMajor,uint32_t>( "Column-major CompressedMatrix<int,columnMajor,uint32_t>" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of a compressed matrix with the given storage order and index type.
+//
+// \param label The label of the test.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the rejection of dimensions that exceed the given index type in the
+// constructors, in the resize() function and in conversions. Additionally, it tests the
+// append(), reserve(), finalize(), find() and lowerBound() functions and the iteration at the
+// largest index that can be represented by the index type. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< bool SO          // Storage order
+        , typename IT >    // Index type
+void ClassTest::testIndexType( const std::string& label )
+{
+   using MatrixType = blaze::CompressedMatrix<int,SO,IT>;
+   using ConstIterator = typename MatrixType::ConstIterator;
+
+   // The largest number of rows (column-major) or columns (row-major) of the matrix
+   const size_t limit( std::numeric_limits<IT>::max() );
+
+   // Returns the number of rows and columns for a matrix with 3 rows/columns and the given
+   // number of indices per row/column
+   const auto rowsOf   ( []( size_t indices ) { return SO ? indices : 3UL; } );
+   const auto columnsOf( []( size_t indices ) { return SO ? 3UL : indices; } );
+
+
+   //=====================================================================================
+   // Construction tests
+   //=====================================================================================
+
+   {
+      test_ = label + " constructors";
+
+      {
+         MatrixType mat( rowsOf( limit ), columnsOf( limit ) );
+
+         checkRows    ( mat, rowsOf( limit ) );
+         checkColumns ( mat, columnsOf( limit ) );
+         checkNonZeros( mat, 0UL );
+      }
+
+      try {
+         MatrixType mat( rowsOf( limit+1UL ), columnsOf( limit+1UL ) );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Constructing a matrix that exceeds the index type succeeded\n"
+             << " Details:\n"
+             << "   Number of rows    = " << mat.rows() << "\n"
+             << "   Number of columns = " << mat.columns() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      try {
+         MatrixType mat( rowsOf( limit+1UL ), columnsOf( limit+1UL ), 5UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Constructing a matrix that exceeds the index type succeeded\n"
+             << " Details:\n"
+             << "   Number of rows    = " << mat.rows() << "\n"
+             << "   Number of columns = " << mat.columns() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      try {
+         MatrixType mat( rowsOf( limit+1UL ), columnsOf( limit+1UL ), std::vector<size_t>( 3UL, 1UL ) );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Constructing a matrix that exceeds the index type succeeded\n"
+             << " Details:\n"
+             << "   Number of rows    = " << mat.rows() << "\n"
+             << "   Number of columns = " << mat.columns() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Resize tests
+   //=====================================================================================
+
+   {
+      test_ = label + "::resize()";
+
+      MatrixType mat( rowsOf( 4UL ), columnsOf( 4UL ) );
+      mat(1,1) = 2;
+
+      mat.resize( rowsOf( limit ), columnsOf( limit ), true );
+
+      checkRows    ( mat, rowsOf( limit ) );
+      checkColumns ( mat, columnsOf( limit ) );
+      checkNonZeros( mat, 1UL );
+
+      try {
+         mat.resize( rowsOf( limit+1UL ), columnsOf( limit+1UL ), true );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Resizing a matrix beyond the index type succeeded\n"
+             << " Details:\n"
+             << "   Number of rows    = " << mat.rows() << "\n"
+             << "   Number of columns = " << mat.columns() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      checkRows    ( mat, rowsOf( limit ) );
+      checkColumns ( mat, columnsOf( limit ) );
+      checkNonZeros( mat, 1UL );
+
+      if( mat(1,1) != 2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed resize operation changed the matrix\n"
+             << " Details:\n"
+             << "   Element (1,1) = " << mat(1,1) << "\n"
+             << "   Expected value = 2\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Conversion tests
+   //=====================================================================================
+
+   {
+      test_ = label + " conversion";
+
+      blaze::CompressedMatrix<int,SO> src( rowsOf( limit+1UL ), columnsOf( limit+1UL ) );
+      src(2,2) = 1;
+
+      try {
+         MatrixType mat( src );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Converting a matrix that exceeds the index type succeeded\n"
+             << " Details:\n"
+             << "   Number of rows    = " << mat.rows() << "\n"
+             << "   Number of columns = " << mat.columns() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      try {
+         MatrixType mat( 2UL, 2UL );
+         mat = src;
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assigning a matrix that exceeds the index type succeeded\n"
+             << " Details:\n"
+             << "   Number of rows    = " << mat.rows() << "\n"
+             << "   Number of columns = " << mat.columns() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      if( limit < 1000UL )
+      {
+         const blaze::DynamicMatrix<int,SO> dense( rowsOf( limit+1UL ), columnsOf( limit+1UL ), 0 );
+
+         try {
+            MatrixType mat( dense );
+
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Converting a dense matrix that exceeds the index type succeeded\n"
+                << " Details:\n"
+                << "   Number of rows    = " << mat.rows() << "\n"
+                << "   Number of columns = " << mat.columns() << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+         catch( std::invalid_argument& ) {}
+      }
+
+      src.resize( rowsOf( limit ), columnsOf( limit ), true );
+
+      const MatrixType mat( src );
+
+      checkRows    ( mat, rowsOf( limit ) );
+      checkColumns ( mat, columnsOf( limit ) );
+      checkNonZeros( mat, 1UL );
+
+      if( mat(2,2) != 1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Conversion failed\n"
+             << " Details:\n"
+             << "   Element (2,2) = " << mat(2,2) << "\n"
+             << "   Expected value = 1\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Append/iteration tests
+   //=====================================================================================
+
+   {
+      test_ = label + "::append()";
+
+      const size_t indices[] = { 0UL, limit/2UL, limit-1UL };
+
+      MatrixType mat( rowsOf( limit ), columnsOf( limit ) );
+      mat.reserve( 6UL );
+
+      for( size_t k=0UL; k<3UL; ++k ) {
+         if( k != 1UL ) {
+            for( size_t index : indices ) {
+               if( SO ) mat.append( index, k, int( k+1UL ) );
+               else     mat.append( k, index, int( k+1UL ) );
+            }
+         }
+         mat.finalize( k );
+      }
+
+      checkRows    ( mat, rowsOf( limit ) );
+      checkColumns ( mat, columnsOf( limit ) );
+      checkCapacity( mat, 6UL );
+      checkNonZeros( mat, 6UL );
+      checkNonZeros( mat, 0UL, 3UL );
+      checkNonZeros( mat, 1UL, 0UL );
+      checkNonZeros( mat, 2UL, 3UL );
+
+      test_ = label + " iteration";
+
+      for( size_t k=0UL; k<3UL; k+=2UL )
+      {
+         ConstIterator it( mat.cbegin( k ) );
+
+         for( size_t index : indices ) {
+            if( it == mat.cend( k ) || it->index() != index || it->value() != int( k+1UL ) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Invalid element detected\n"
+                   << " Details:\n"
+                   << "   Row/column     = " << k << "\n"
+                   << "   Expected index = " << index << "\n"
+                   << "   Expected value = " << ( k+1UL ) << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+            ++it;
+         }
+
+         if( it != mat.cend( k ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid end of row/column " << k << "\n"
+                << " Details:\n"
+                << "   Found index = " << it->index() << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      test_ = label + "::find()";
+
+      {
+         const ConstIterator pos( SO ? mat.find( limit-1UL, 2UL ) : mat.find( 2UL, limit-1UL ) );
+
+         if( pos == mat.end( 2UL ) || pos->index() != limit-1UL || pos->value() != 3 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Element could not be found\n"
+                << " Details:\n"
+                << "   Required index = " << ( limit-1UL ) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      {
+         const ConstIterator pos( SO ? mat.find( limit-2UL, 0UL ) : mat.find( 0UL, limit-2UL ) );
+
+         if( pos != mat.end( 0UL ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Non-existing element could be found\n"
+                << " Details:\n"
+                << "   Required index = " << ( limit-2UL ) << "\n"
+                << "   Found index    = " << pos->index() << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      test_ = label + "::lowerBound()";
+
+      {
+         const ConstIterator pos( SO ? mat.lowerBound( limit/2UL+1UL, 0UL ) : mat.lowerBound( 0UL, limit/2UL+1UL ) );
+
+         if( pos == mat.end( 0UL ) || pos->index() != limit-1UL || pos->value() != 1 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Wrong element found\n"
+                << " Details:\n"
+                << "   Required index = " << ( limit-1UL ) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      {
+         const ConstIterator pos( SO ? mat.lowerBound( limit/2UL, 2UL ) : mat.lowerBound( 2UL, limit/2UL ) );
+
+         if( pos == mat.end( 2UL ) || pos->index() != limit/2UL || pos->value() != 3 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Wrong element found\n"
+                << " Details:\n"
+                << "   Required index = " << ( limit/2UL ) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      {
+         const ConstIterator pos( SO ? mat.lowerBound( limit-1UL, 1UL ) : mat.lowerBound( 1UL, limit-1UL ) );
+
+         if( pos != mat.end( 1UL ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Element found in empty row/column\n"
+                << " Details:\n"
+                << "   Found index = " << pos->index() << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
 } // namespace compressedmatrix
 
 } // namespace mathtest
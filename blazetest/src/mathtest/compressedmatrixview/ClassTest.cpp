@@ -0,0 +1,391 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/compressedmatrixview/ClassTest.cpp
+//  \brief Source file for the CompressedMatrixView class test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blazetest/mathtest/compressedmatrixview/ClassTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace compressedmatrixview {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the CompressedMatrixView class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testAt();
+   testLookup();
+   testSwap();
+   testConversion();
+   testMultiplication();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the CompressedMatrixView constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors and of the copy assignment operator of
+// the CompressedMatrixView class template. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   //=====================================================================================
+   // Default constructor
+   //=====================================================================================
+
+   {
+      test_ = "CompressedMatrixView default constructor";
+
+      const VT view;
+
+      checkRows    ( view, 0UL );
+      checkColumns ( view, 0UL );
+      checkNonZeros( view, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Array constructor
+   //=====================================================================================
+
+   // Row-major view on the 3x4 matrix ( ( 1 0 2 0 ) ( 0 0 0 0 ) ( 0 3 0 4 ) )
+   {
+      test_ = "Row-major CompressedMatrixView array constructor";
+
+      const ET elements[] = { ET( 1.0, 0UL ), ET( 2.0, 2UL ), ET( 3.0, 1UL ), ET( 4.0, 3UL ) };
+      const uint64_t offsets[] = { 0U, 2U, 2U, 4U };
+
+      const VT view( elements, offsets, 3UL, 4UL );
+
+      RMT ref( 3UL, 4UL );
+      ref(0,0) = 1.0;
+      ref(0,2) = 2.0;
+      ref(2,1) = 3.0;
+      ref(2,3) = 4.0;
+
+      checkMatrix( view, ref );
+   }
+
+   // Column-major view on the 3x4 matrix ( ( 1 0 2 0 ) ( 0 0 0 0 ) ( 0 3 0 4 ) )
+   {
+      test_ = "Column-major CompressedMatrixView array constructor";
+
+      const ET elements[] = { ET( 1.0, 0UL ), ET( 3.0, 2UL ), ET( 2.0, 0UL ), ET( 4.0, 2UL ) };
+      const uint64_t offsets[] = { 0U, 1U, 2U, 3U, 4U };
+
+      const TVT view( elements, offsets, 3UL, 4UL );
+
+      CMT ref( 3UL, 4UL );
+      ref(0,0) = 1.0;
+      ref(0,2) = 2.0;
+      ref(2,1) = 3.0;
+      ref(2,3) = 4.0;
+
+      checkMatrix( view, ref );
+   }
+
+   // View on a matrix without non-zero elements
+   {
+      test_ = "CompressedMatrixView array constructor (empty matrix)";
+
+      const uint64_t offsets[] = { 0U, 0U, 0U, 0U, 0U, 0U };
+
+      const VT view( nullptr, offsets, 5UL, 7UL );
+
+      checkMatrix( view, RMT( 5UL, 7UL ) );
+   }
+
+
+   //=====================================================================================
+   // Copy constructor and copy assignment
+   //=====================================================================================
+
+   {
+      test_ = "CompressedMatrixView copy constructor and copy assignment";
+
+      const RMT ref( createMatrix<double,blaze::rowMajor,size_t>( 17UL, 9UL ) );
+
+      std::vector<ET> elements;
+      std::vector<uint64_t> offsets;
+      copyArrays( ref, elements, offsets );
+
+      const VT view1( elements.data(), offsets.data(), 17UL, 9UL );
+      const VT view2( view1 );
+
+      checkMatrix( view2, ref );
+
+      VT view3;
+      view3 = view1;
+
+      checkMatrix( view3, ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c at() member function of the CompressedMatrixView class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the checked element access of the CompressedMatrixView
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAt()
+{
+   test_ = "CompressedMatrixView::at()";
+
+   const ET elements[] = { ET( 1.0, 1UL ), ET( 2.0, 3UL ) };
+   const uint64_t offsets[] = { 0U, 1U, 1U, 2U };
+
+   const VT view( elements, offsets, 3UL, 4UL );
+
+   if( view.at(0,1) != 1.0 || view.at(2,3) != 2.0 || view.at(1,1) != 0.0 || view.at(2,0) != 0.0 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Access via at() function failed\n"
+          << " Details:\n"
+          << "   Result:\n" << view << "\n"
+          << "   Expected result:\n( 0 1 0 0 )\n( 0 0 0 0 )\n( 0 0 0 2 )\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   try {
+      view.at(3,0);
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Out-of-bound row access succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::out_of_range& ) {}
+
+   try {
+      view.at(0,4);
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Out-of-bound column access succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::out_of_range& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the lookup functions of the CompressedMatrixView class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the function call operator and of the find(), lowerBound()
+// and upperBound() member functions of the CompressedMatrixView class template for both
+// storage orders and index types. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testLookup()
+{
+   test_ = "CompressedMatrixView lookup functions";
+
+   runLookupTest<double,blaze::rowMajor   ,size_t>  ( 45UL, 30UL );
+   runLookupTest<double,blaze::columnMajor,size_t>  ( 45UL, 30UL );
+   runLookupTest<double,blaze::rowMajor   ,uint32_t>( 30UL, 45UL );
+   runLookupTest<double,blaze::columnMajor,uint32_t>( 30UL, 45UL );
+   runLookupTest<int   ,blaze::rowMajor   ,uint32_t>( 12UL, 12UL );
+   runLookupTest<int   ,blaze::columnMajor,size_t>  ( 12UL, 12UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c swap() functionality of the CompressedMatrixView class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the swap() member function and of the swap() function of
+// the CompressedMatrixView class template. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSwap()
+{
+   test_ = "CompressedMatrixView swap";
+
+   const RMT ref1( createMatrix<double,blaze::rowMajor,size_t>( 17UL, 9UL ) );
+   const RMT ref2( createMatrix<double,blaze::rowMajor,size_t>( 4UL, 31UL ) );
+
+   std::vector<ET> elements1, elements2;
+   std::vector<uint64_t> offsets1, offsets2;
+   copyArrays( ref1, elements1, offsets1 );
+   copyArrays( ref2, elements2, offsets2 );
+
+   VT view1( elements1.data(), offsets1.data(), 17UL, 9UL );
+   VT view2( elements2.data(), offsets2.data(), 4UL, 31UL );
+
+   swap( view1, view2 );
+
+   checkMatrix( view1, ref2 );
+   checkMatrix( view2, ref1 );
+
+   view1.swap( view2 );
+
+   checkMatrix( view1, ref1 );
+   checkMatrix( view2, ref2 );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the conversion of a CompressedMatrixView into other matrix types.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the construction of and the assignment to compressed and dense matrices
+// with views of both storage orders and index types. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConversion()
+{
+   test_ = "CompressedMatrixView conversion";
+
+   for( size_t m : { 0UL, 1UL, 7UL, 31UL } ) {
+      for( size_t n : { 1UL, 9UL, 40UL } ) {
+         runConversionTest<double,blaze::rowMajor   ,size_t>  ( m, n );
+         runConversionTest<double,blaze::columnMajor,size_t>  ( m, n );
+         runConversionTest<double,blaze::rowMajor   ,uint32_t>( m, n );
+         runConversionTest<double,blaze::columnMajor,uint32_t>( m, n );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the multiplication of a CompressedMatrixView with dense vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the sparse matrix/dense vector and transpose dense vector/sparse matrix
+// multiplications with views of various sizes, element types, storage orders and index types.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMultiplication()
+{
+   test_ = "CompressedMatrixView multiplication";
+
+   for( size_t m : { 0UL, 1UL, 2UL, 7UL, 16UL, 31UL, 100UL } ) {
+      for( size_t n : { 1UL, 9UL, 64UL } ) {
+         runMultiplicationTest<double,blaze::rowMajor   ,size_t>  ( m, n );
+         runMultiplicationTest<double,blaze::columnMajor,size_t>  ( m, n );
+         runMultiplicationTest<double,blaze::rowMajor   ,uint32_t>( m, n );
+         runMultiplicationTest<double,blaze::columnMajor,uint32_t>( m, n );
+         runMultiplicationTest<float ,blaze::rowMajor   ,uint32_t>( m, n );
+         runMultiplicationTest<int   ,blaze::rowMajor   ,size_t>  ( m, n );
+         runMultiplicationTest<int   ,blaze::columnMajor,size_t>  ( m, n );
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace compressedmatrixview
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running CompressedMatrixView class test..." << std::endl;
+
+   try
+   {
+      RUN_COMPRESSEDMATRIXVIEW_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during CompressedMatrixView class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,643 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/compressedstream/ClassTest.cpp
+//  \brief Source file for the compressed stream class test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <blazetest/mathtest/compressedstream/ClassTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace compressedstream {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the compressed stream class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testArchive();
+   testFile();
+   testCompression();
+   testTruncated();
+   testCorrupt();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of compressed archives.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs round trips of vectors and matrices of various sizes and element types
+// through compressed archives, including archives that span several chunks and batches of
+// chunks. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testArchive()
+{
+   test_ = "Compressed archive round trip";
+
+   for( size_t typeSize : { 0UL, 3UL, 8UL } ) {
+      runArchiveTest<double>(  0UL,  0UL, typeSize );
+      runArchiveTest<double>(  1UL,  1UL, typeSize );
+      runArchiveTest<double>( 17UL,  9UL, typeSize );
+      runArchiveTest<double>( 200UL, 150UL, typeSize );
+   }
+
+   runArchiveTest<double>( 1100UL, 600UL, 8UL );
+   runArchiveTest<float> ( 300UL, 200UL, 4UL );
+   runArchiveTest<int>   ( 300UL, 200UL, 4UL );
+   runArchiveTest<blaze::complex<double>>( 100UL, 80UL, 16UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of compressed files.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function writes a matrix into a compressed file, reads it back and compares it with
+// the original matrix. Additionally, it checks that opening a missing file fails. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testFile()
+{
+   test_ = "Compressed file";
+
+   const std::string file( "blazetest_compressedstream.blaze.cz" );
+
+   blaze::DynamicMatrix<double,blaze::columnMajor> A( 123UL, 45UL );
+   blaze::randomize( A );
+
+   {
+      blaze::CompressedOStream stream( file );
+      blaze::Archive<blaze::CompressedOStream> archive( stream );
+      archive << A;
+      stream.close();
+
+      if( !stream ) {
+         std::remove( file.c_str() );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Writing the compressed file failed\n"
+             << " Details:\n"
+             << "   File: " << file << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   blaze::DynamicMatrix<double,blaze::columnMajor> B;
+
+   {
+      blaze::Archive<blaze::CompressedIStream> archive( file );
+      archive >> B;
+   }
+
+   std::remove( file.c_str() );
+
+   checkResult( B, A );
+
+   {
+      blaze::CompressedIStream stream( file );
+
+      if( stream ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Opening a missing file succeeded\n"
+             << " Details:\n"
+             << "   File: " << file << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the size of compressed streams.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the size of compressed streams for highly compressible data, for slowly
+// varying floating point data and for incompressible data. Slowly varying floating point data
+// at full precision is expected to shrink by only about 20 percent, since the low bytes of the
+// mantissas are essentially random. Incompressible data must not grow beyond the chunk headers.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testCompression()
+{
+   const size_t n( 300000UL );
+
+   {
+      test_ = "Compression of integer valued floating point data";
+
+      const std::vector<char> data( integerData( n ) );
+      const std::string stream( compress( data, sizeof(double) ) );
+
+      checkStream( stream, data );
+
+      if( stream.size() > data.size() / 20UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Insufficient compression\n"
+             << " Details:\n"
+             << "   Size            = " << data.size() << "\n"
+             << "   Compressed size = " << stream.size() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Compression of slowly varying floating point data";
+
+      std::vector<char> data( n*sizeof(double) );
+      for( size_t i=0UL; i<n; ++i ) {
+         const double value( std::sin( 0.001*i ) * std::cos( 0.0003*i ) );
+         std::memcpy( data.data()+i*sizeof(double), &value, sizeof(double) );
+      }
+
+      const std::string stream( compress( data, sizeof(double) ) );
+
+      checkStream( stream, data );
+
+      if( stream.size() > data.size() / 1.1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Insufficient compression\n"
+             << " Details:\n"
+             << "   Size            = " << data.size() << "\n"
+             << "   Compressed size = " << stream.size() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Compression of random data";
+
+      std::vector<char> data( n*sizeof(double) );
+      for( char& c : data ) c = static_cast<char>( blaze::rand<int>( 0, 255 ) );
+
+      const std::string stream( compress( data, sizeof(double) ) );
+
+      checkStream( stream, data );
+
+      const size_t chunks( ( data.size() + blaze::COMPRESSION_CHUNK_SIZE - 1UL ) / blaze::COMPRESSION_CHUNK_SIZE );
+      const size_t maxSize( sizeof(blaze::CompressedStreamHeader) + data.size() + 8UL*( chunks + 1UL ) );
+
+      if( stream.size() > maxSize ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Incompressible data grew beyond the chunk headers\n"
+             << " Details:\n"
+             << "   Size            = " << data.size() << "\n"
+             << "   Compressed size = " << stream.size() << "\n"
+             << "   Maximum size    = " << maxSize << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of truncated compressed streams.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function truncates compressed streams within the header, within the chunk headers and
+// within compressed and uncompressed chunks and checks that the original data cannot be read
+// from the truncated stream. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void ClassTest::testTruncated()
+{
+   {
+      test_ = "Truncated compressed stream";
+
+      std::vector<char> data( integerData( 400000UL ) );
+      data.resize( 2UL*data.size() );
+      for( size_t i=data.size()/2UL; i<data.size(); ++i )
+         data[i] = static_cast<char>( blaze::rand<int>( 0, 255 ) );
+
+      const std::string stream( compress( data, sizeof(double) ) );
+      const size_t header( sizeof(blaze::CompressedStreamHeader) );
+
+      checkStream( stream, data );
+
+      for( size_t size : { 0UL, 10UL, header, header+4UL, header+8UL, header+9UL } ) {
+         checkCorrupt( stream.substr( 0UL, size ), data.size() );
+      }
+
+      for( size_t size=header+8UL; size<stream.size()-8UL; size+=stream.size()/37UL ) {
+         checkCorrupt( stream.substr( 0UL, size ), data.size() );
+      }
+
+      checkCorrupt( stream.substr( 0UL, stream.size()-9UL ), data.size() );
+   }
+
+   {
+      test_ = "Truncated compressed archive";
+
+      blaze::DynamicMatrix<double,blaze::rowMajor> A( 200UL, 300UL );
+      blaze::randomize( A );
+
+      std::ostringstream oss;
+
+      {
+         blaze::Archive<blaze::CompressedOStream> archive( oss );
+         archive << A;
+      }
+
+      const std::string stream( oss.str() );
+
+      for( size_t size : { 0UL, stream.size()/3UL, stream.size()-9UL } )
+      {
+         std::istringstream iss( stream.substr( 0UL, size ) );
+         blaze::Archive<blaze::CompressedIStream> archive( iss );
+         blaze::DynamicMatrix<double,blaze::rowMajor> B;
+
+         try {
+            archive >> B;
+         }
+         catch( std::exception& ) {
+            continue;
+         }
+
+         std::ostringstream msg;
+         msg << " Test: " << test_ << "\n"
+             << " Error: Reading a truncated archive succeeded\n"
+             << " Details:\n"
+             << "   Compressed size = " << stream.size() << "\n"
+             << "   Truncated size  = " << size << "\n";
+         throw std::runtime_error( msg.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of corrupt compressed streams.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function modifies the header, the chunk headers and the compressed data of a compressed
+// stream and checks that the original data cannot be read from the modified stream. Since the
+// format contains no checksums, modified literals of the compressed data cannot be detected.
+// Therefore randomly modified streams are only read to check that reading never exceeds the
+// given buffer. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testCorrupt()
+{
+   const std::vector<char> data( integerData( 100000UL ) );
+   const std::string stream( compress( data, sizeof(double) ) );
+
+   const size_t header( sizeof(blaze::CompressedStreamHeader) );
+
+   test_ = "Corrupt compressed stream";
+
+   uint32_t sizes[2];
+   std::memcpy( sizes, stream.data()+header, sizeof(sizes) );
+
+   if( sizes[0] != blaze::COMPRESSION_CHUNK_SIZE || sizes[1] >= sizes[0] ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid first chunk\n"
+          << " Details:\n"
+          << "   Size        = " << sizes[0] << "\n"
+          << "   Stored size = " << sizes[1] << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   {
+      test_ = "Compressed stream with a corrupt header";
+
+      std::string magic( stream );
+      magic[0] = 'X';
+      checkCorrupt( magic, data.size() );
+
+      std::string version( stream );
+      patch( version, 8UL, 2U );
+      checkCorrupt( version, data.size() );
+
+      std::string chunkSize( stream );
+      patch( chunkSize, 16UL, 1024U );
+      checkCorrupt( chunkSize, data.size() );
+   }
+
+   {
+      test_ = "Compressed stream with a corrupt chunk header";
+
+      std::string tooLarge( stream );
+      patch( tooLarge, header, sizes[0]+1U );
+      checkCorrupt( tooLarge, data.size() );
+
+      std::string storedTooLarge( stream );
+      patch( storedTooLarge, header+4UL, sizes[0]+1U );
+      checkCorrupt( storedTooLarge, data.size() );
+
+      std::string sizeTooSmall( stream );
+      patch( sizeTooSmall, header, sizes[0]-1U );
+      checkCorrupt( sizeTooSmall, data.size() );
+
+      std::string storedTooSmall( stream );
+      patch( storedTooSmall, header+4UL, sizes[1]-1U );
+      checkCorrupt( storedTooSmall, data.size() );
+   }
+
+   {
+      test_ = "Compressed stream with an oversized uncompressed chunk";
+
+      const size_t chunk( blaze::COMPRESSION_CHUNK_SIZE );
+
+      std::vector<char> random( ( blaze::COMPRESSION_BATCH_SIZE + 1UL ) * chunk );
+      for( char& c : random ) c = static_cast<char>( blaze::rand<int>( 0, 255 ) );
+
+      // All chunks are stored uncompressed, i.e. the last chunk of the first batch is located
+      // at a fixed offset. Its oversized stored data must not be read into the batch buffer.
+      std::string oversized( compress( random, sizeof(double) ) );
+      const size_t offset( header + ( blaze::COMPRESSION_BATCH_SIZE - 1UL )*( chunk + 8UL ) );
+      patch( oversized, offset    , static_cast<uint32_t>( chunk+1UL ) );
+      patch( oversized, offset+4UL, static_cast<uint32_t>( chunk+1UL ) );
+      checkCorrupt( oversized, random.size() );
+   }
+
+   {
+      test_ = "Compressed stream with corrupt compressed data";
+
+      std::string ones( stream );
+      std::memset( &ones[header+8UL], 0xFF, sizes[1] );
+      checkCorrupt( ones, data.size() );
+
+      std::string zeros( stream );
+      std::memset( &zeros[header+8UL], 0x00, sizes[1] );
+      checkCorrupt( zeros, data.size() );
+   }
+
+   {
+      test_ = "Randomly modified compressed stream";
+
+      for( size_t i=0UL; i<200UL; ++i )
+      {
+         std::string modified( stream );
+         const size_t count( blaze::rand<size_t>( 1UL, 3UL ) );
+         for( size_t k=0UL; k<count; ++k ) {
+            modified[blaze::rand<size_t>( 0UL, modified.size()-1UL )] = static_cast<char>( blaze::rand<int>( 0, 255 ) );
+         }
+
+         std::vector<char> result( data.size() );
+         decompress( modified, result );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking that the given data can be read from the given compressed stream.
+//
+// \param stream The compressed stream.
+// \param data The expected data.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function reads the given compressed stream and compares the result with the given
+// data. Additionally, it checks that the stream ends after the data. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::checkStream( const std::string& stream, const std::vector<char>& data ) const
+{
+   std::istringstream iss( stream );
+   blaze::CompressedIStream cis( iss );
+
+   std::vector<char> result( data.size() );
+   cis.read( result.data(), static_cast<std::streamsize>( result.size() ) );
+
+   const size_t size( cis.gcount() );
+
+   if( size != data.size() || result != data || cis.get() != std::char_traits<char>::eof() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Reading from the compressed stream failed\n"
+          << " Details:\n"
+          << "   Size            = " << data.size() << "\n"
+          << "   Compressed size = " << stream.size() << "\n"
+          << "   Read size       = " << size << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking that the data cannot be read from the given compressed stream.
+//
+// \param stream The truncated or corrupt compressed stream.
+// \param size The size of the original data.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that less than \a size bytes can be read from the given compressed
+// stream. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::checkCorrupt( const std::string& stream, size_t size ) const
+{
+   std::vector<char> result( size );
+
+   const size_t read( decompress( stream, result ) );
+
+   if( read >= size ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Reading from a corrupt compressed stream succeeded\n"
+          << " Details:\n"
+          << "   Size            = " << size << "\n"
+          << "   Compressed size = " << stream.size() << "\n"
+          << "   Read size       = " << read << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Compression of the given data.
+//
+// \param data The data to be compressed.
+// \param typeSize The element size for the byte shuffle filter.
+// \return The compressed stream.
+*/
+std::string ClassTest::compress( const std::vector<char>& data, size_t typeSize )
+{
+   std::ostringstream oss;
+
+   {
+      blaze::CompressedOStream cos( oss, typeSize );
+      cos.write( data.data(), static_cast<std::streamsize>( data.size() ) );
+   }
+
+   return oss.str();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Decompression of the given compressed stream.
+//
+// \param stream The compressed stream.
+// \param data The buffer for the decompressed data.
+// \return The number of successfully read bytes.
+*/
+size_t ClassTest::decompress( const std::string& stream, std::vector<char>& data )
+{
+   std::istringstream iss( stream );
+   blaze::CompressedIStream cis( iss );
+
+   cis.read( data.data(), static_cast<std::streamsize>( data.size() ) );
+
+   return cis.gcount();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Overwriting a 32-bit value of the given compressed stream.
+//
+// \param stream The compressed stream.
+// \param offset The byte offset of the value.
+// \param value The new value.
+// \return void
+*/
+void ClassTest::patch( std::string& stream, size_t offset, uint32_t value )
+{
+   std::memcpy( &stream[offset], &value, sizeof(uint32_t) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creating an array of slowly increasing integer valued double precision values.
+//
+// \param n The number of values.
+// \return The bytes of the values.
+*/
+std::vector<char> ClassTest::integerData( size_t n )
+{
+   std::vector<char> data( n*sizeof(double) );
+   for( size_t i=0UL; i<n; ++i ) {
+      const double value( static_cast<double>( i/100UL ) );
+      std::memcpy( data.data()+i*sizeof(double), &value, sizeof(double) );
+   }
+   return data;
+}
+//*************************************************************************************************
+
+} // namespace compressedstream
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running CompressedStream class test..." << std::endl;
+
+   try
+   {
+      RUN_COMPRESSEDSTREAM_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during CompressedStream class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -37,8 +37,10 @@
 // Includes
 //*************************************************************************************************
 
+#include <cstdint>
 #include <cstdlib>
 #include <iostream>
+#include <limits>
 #include <blaze/math/DynamicVector.h>
 #include <blaze/math/shims/Equal.h>
 #include <blaze/util/Complex.h>
@@ -97,6 +99,7 @@ ClassTest::ClassTest()
    testLowerBound();
    testUpperBound();
    testIsDefault();
+   testIndexType();
 }
 //*************************************************************************************************
 
@@ -3515,6 +3518,332 @@ void ClassTest::testIsDefault()
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Test of the CompressedVector class template with a custom index type.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of compressed vectors with the \c uint8_t and \c uint32_t
+// index types. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIndexType()
+{
+   testIndexType<uint8_t >( "CompressedVector<int,rowVector,uint8_t>" );
+   testIndexType<uint32_t>( "CompressedVector<int,rowVector,uint32_t>" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of a compressed vector with the given index type.
+//
+// \param label The label of the test.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the rejection of sizes that exceed the given index type in the
+// constructors, in the resize() function, in conversions and in assignments. Additionally,
+// it tests the append(), reserve(), find() and lowerBound() functions and the iteration at
+// the largest index that can be represented by the index type. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+template< typename IT >  // Index type
+void ClassTest::testIndexType( const std::string& label )
+{
+   using VectorType = blaze::CompressedVector<int,blaze::rowVector,IT>;
+   using ConstIterator = typename VectorType::ConstIterator;
+
+   // The largest size of the vector
+   const size_t limit( std::numeric_limits<IT>::max() );
+
+
+   //=====================================================================================
+   // Construction tests
+   //=====================================================================================
+
+   {
+      test_ = label + " constructors";
+
+      {
+         VectorType vec( limit );
+
+         checkSize    ( vec, limit );
+         checkNonZeros( vec, 0UL );
+      }
+
+      try {
+         VectorType vec( limit+1UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Constructing a vector that exceeds the index type succeeded\n"
+             << " Details:\n"
+             << "   Size = " << vec.size() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      try {
+         VectorType vec( limit+1UL, 5UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Constructing a vector that exceeds the index type succeeded\n"
+             << " Details:\n"
+             << "   Size = " << vec.size() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Resize tests
+   //=====================================================================================
+
+   {
+      test_ = label + "::resize()";
+
+      VectorType vec( 4UL );
+      vec[1] = 2;
+
+      vec.resize( limit, true );
+
+      checkSize    ( vec, limit );
+      checkNonZeros( vec, 1UL );
+
+      try {
+         vec.resize( limit+1UL, true );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Resizing a vector beyond the index type succeeded\n"
+             << " Details:\n"
+             << "   Size = " << vec.size() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      checkSize    ( vec, limit );
+      checkNonZeros( vec, 1UL );
+
+      if( vec[1] != 2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed resize operation changed the vector\n"
+             << " Details:\n"
+             << "   Element 1 = " << vec[1] << "\n"
+             << "   Expected value = 2\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Conversion tests
+   //=====================================================================================
+
+   {
+      test_ = label + " conversion";
+
+      blaze::CompressedVector<int,blaze::rowVector> src( limit+1UL );
+      src[2] = 1;
+
+      try {
+         VectorType vec( src );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Converting a vector that exceeds the index type succeeded\n"
+             << " Details:\n"
+             << "   Size = " << vec.size() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      try {
+         VectorType vec( 2UL, 4UL );
+         vec = src;
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assigning a vector that exceeds the index type succeeded\n"
+             << " Details:\n"
+             << "   Size = " << vec.size() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      if( limit < 1000UL )
+      {
+         const blaze::DynamicVector<int,blaze::rowVector> dense( limit+1UL, 0 );
+
+         try {
+            VectorType vec( dense );
+
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Converting a dense vector that exceeds the index type succeeded\n"
+                << " Details:\n"
+                << "   Size = " << vec.size() << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+         catch( std::invalid_argument& ) {}
+
+         try {
+            VectorType vec( 2UL );
+            vec = dense;
+
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Assigning a dense vector that exceeds the index type succeeded\n"
+                << " Details:\n"
+                << "   Size = " << vec.size() << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+         catch( std::invalid_argument& ) {}
+      }
+
+      src.resize( limit, true );
+
+      const VectorType vec( src );
+
+      checkSize    ( vec, limit );
+      checkNonZeros( vec, 1UL );
+
+      if( vec[2] != 1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Conversion failed\n"
+             << " Details:\n"
+             << "   Element 2 = " << vec[2] << "\n"
+             << "   Expected value = 1\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Append/iteration tests
+   //=====================================================================================
+
+   {
+      test_ = label + "::append()";
+
+      const size_t indices[] = { 0UL, limit/2UL, limit-1UL };
+
+      VectorType vec( limit );
+      vec.reserve( 3UL );
+
+      for( size_t index : indices ) {
+         vec.append( index, int( index % 7UL + 1UL ) );
+      }
+
+      checkSize    ( vec, limit );
+      checkCapacity( vec, 3UL );
+      checkNonZeros( vec, 3UL );
+
+      test_ = label + " iteration";
+
+      ConstIterator it( vec.cbegin() );
+
+      for( size_t index : indices ) {
+         if( it == vec.cend() || it->index() != index || it->value() != int( index % 7UL + 1UL ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid element detected\n"
+                << " Details:\n"
+                << "   Expected index = " << index << "\n"
+                << "   Expected value = " << ( index % 7UL + 1UL ) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+         ++it;
+      }
+
+      if( it != vec.cend() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid end of the vector\n"
+             << " Details:\n"
+             << "   Found index = " << it->index() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      test_ = label + "::find()";
+
+      {
+         const ConstIterator pos( vec.find( limit-1UL ) );
+
+         if( pos == vec.end() || pos->index() != limit-1UL ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Element could not be found\n"
+                << " Details:\n"
+                << "   Required index = " << ( limit-1UL ) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      {
+         const ConstIterator pos( vec.find( limit-2UL ) );
+
+         if( pos != vec.end() ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Non-existing element could be found\n"
+                << " Details:\n"
+                << "   Required index = " << ( limit-2UL ) << "\n"
+                << "   Found index    = " << pos->index() << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      test_ = label + "::lowerBound()";
+
+      {
+         const ConstIterator pos( vec.lowerBound( limit/2UL+1UL ) );
+
+         if( pos == vec.end() || pos->index() != limit-1UL ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Wrong element found\n"
+                << " Details:\n"
+                << "   Required index = " << ( limit-1UL ) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      {
+         const ConstIterator pos( vec.lowerBound( limit/2UL ) );
+
+         if( pos == vec.end() || pos->index() != limit/2UL ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Wrong element found\n"
+                << " Details:\n"
+                << "   Required index = " << ( limit/2UL ) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      {
+         const ConstIterator pos( vec.lowerBound( limit-1UL ) );
+
+         if( pos == vec.end() || pos->index() != limit-1UL ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Wrong element found\n"
+                << " Details:\n"
+                << "   Required index = " << ( limit-1UL ) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
 } // namespace compressedvector
 
 } // namespace mathtest
@@ -0,0 +1,367 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/fusion/DenseTest.cpp
+//  \brief Source file for the fused dense assignment test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blazetest/mathtest/fusion/DenseTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace fusion {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the fused dense assignment test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+DenseTest::DenseTest()
+{
+   testVectorAssign();
+   testVectorCompoundAssign();
+   testMatrixAssign<blaze::rowMajor>();
+   testMatrixAssign<blaze::columnMajor>();
+   testInvalidSizes();
+   testAliasing();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of a chain of fused assignments to dense vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests a chain of fused assignments to dense vectors, where each statement reads
+// the result of the previous statement. The size of the vectors is chosen such that it is not a
+// multiple of the block size. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void DenseTest::testVectorAssign()
+{
+   using blaze::fuse;
+   using blaze::lazy;
+
+   test_ = "Fused vector assignment";
+
+   VT probe( 1UL );
+   const size_t N( 2UL*blockSize( lazy( probe ) = probe, 3UL ) + 7UL );
+
+   blaze::DynamicMatrix<double,blaze::rowMajor> A( N, 3UL );
+   VT x( 3UL ), b( N ), y( N ), z( N ), w( N );
+
+   initialize( A, 1 );
+   initialize( x, 2 );
+   initialize( b, 3 );
+
+   const VT refY( A * x );
+   const VT refZ( refY + b );
+   const VT refW( refZ * refY );
+
+   fuse( lazy( y ) = A * x,
+         lazy( z ) = y + b,
+         lazy( w ) = z * y );
+
+   checkResult( y, refY, "y" );
+   checkResult( z, refZ, "z" );
+   checkResult( w, refW, "w" );
+
+   VT v( N+5UL, 0.0 );
+
+   fuse( lazy( subvector( v, 5UL, N ) ) = w - A * x );
+
+   checkResult( subvector( v, 5UL, N ), refW - refY, "subvector( v, 5UL, N )" );
+   checkResult( subvector( v, 0UL, 5UL ), VT( 5UL, 0.0 ), "subvector( v, 0UL, 5UL )" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of fused addition and subtraction assignments to dense vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests a chain of fused addition and subtraction assignments to dense vectors,
+// including several statements with the same target. The size of the vectors is chosen such
+// that it is not a multiple of the block size. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void DenseTest::testVectorCompoundAssign()
+{
+   using blaze::fuse;
+   using blaze::lazy;
+
+   test_ = "Fused vector addition/subtraction assignment";
+
+   VT probe( 1UL );
+   const size_t N( 3UL*blockSize( lazy( probe ) = probe, 4UL ) + 1UL );
+
+   VT x( N ), y( N ), z( N );
+
+   initialize( x, 1 );
+   initialize( y, 2 );
+   initialize( z, 3 );
+
+   VT refY( y ), refZ( z );
+
+   refY += x;
+   refZ -= 2.0 * refY;
+   refY -= refZ;
+   refZ += refY * x;
+
+   fuse( lazy( y ) += x,
+         lazy( z ) -= 2.0 * y,
+         lazy( y ) -= z,
+         lazy( z ) += y * x );
+
+   checkResult( y, refY, "y" );
+   checkResult( z, refZ, "z" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of fused evaluations with non-matching sizes.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that fuse() rejects statements whose right-hand side operand does not
+// match the size of the target and statements with targets of different sizes. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void DenseTest::testInvalidSizes()
+{
+   using blaze::fuse;
+   using blaze::lazy;
+
+   {
+      test_ = "Fused vector assignment with non-matching operand size";
+
+      VT x( 5UL, 1.0 ), y( 6UL, 2.0 );
+
+      try {
+         fuse( lazy( y ) = x );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Fused assignment with non-matching sizes succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      checkResult( y, VT( 6UL, 2.0 ), "y" );
+   }
+
+   {
+      test_ = "Fused vector assignment with non-matching target sizes";
+
+      VT x( 5UL, 1.0 ), y( 5UL, 2.0 ), z( 6UL, 3.0 ), u( 6UL, 4.0 );
+
+      try {
+         fuse( lazy( y ) = x, lazy( z ) = u );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Fused assignment with non-matching sizes succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      checkResult( y, VT( 5UL, 2.0 ), "y" );
+      checkResult( z, VT( 6UL, 3.0 ), "z" );
+   }
+
+   {
+      test_ = "Fused matrix assignment with non-matching target sizes";
+
+      blaze::DynamicMatrix<double,blaze::rowMajor> A( 4UL, 5UL, 1.0 ), B( 4UL, 5UL, 2.0 );
+      blaze::DynamicMatrix<double,blaze::columnMajor> C( 5UL, 4UL, 3.0 );
+
+      try {
+         fuse( lazy( B ) += A, lazy( C ) -= trans( A ) );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Fused assignment with non-matching sizes succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      checkResult( B, blaze::DynamicMatrix<double>( 4UL, 5UL, 2.0 ), "B" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of fused evaluations with invalid aliasing.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that fuse() rejects statements with an operand requiring an intermediate
+// evaluation that reads one of the targets, and that it accepts element-wise reads of the
+// targets. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void DenseTest::testAliasing()
+{
+   using blaze::fuse;
+   using blaze::lazy;
+
+   blaze::DynamicMatrix<double,blaze::rowMajor> A( 4UL, 4UL );
+   initialize( A, 1 );
+
+   {
+      test_ = "Fused assignment reading its own target";
+
+      VT x( 4UL );
+      initialize( x, 2 );
+      const VT ref( x );
+
+      try {
+         fuse( lazy( x ) = A * x );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Aliased fused assignment succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      checkResult( x, ref, "x" );
+   }
+
+   {
+      test_ = "Fused assignment reading a later target";
+
+      VT x( 4UL ), y( 4UL, 0.0 );
+      initialize( x, 2 );
+      const VT ref( x );
+
+      try {
+         fuse( lazy( y ) = A * x, lazy( x ) = 2.0 * y );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Aliased fused assignment succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      checkResult( x, ref, "x" );
+      checkResult( y, VT( 4UL, 0.0 ), "y" );
+   }
+
+   {
+      test_ = "Fused assignment with element-wise reads of its target";
+
+      VT x( 4UL ), y( 4UL ), z( 4UL );
+      initialize( x, 2 );
+      initialize( y, 3 );
+      initialize( z, 4 );
+
+      VT refY( y ), refZ( z );
+      refZ = A * x;
+      refY = refY * refY + refZ;
+
+      fuse( lazy( z ) = A * x,
+            lazy( y ) = y * y + z );
+
+      checkResult( y, refY, "y" );
+      checkResult( z, refZ, "z" );
+   }
+}
+//*************************************************************************************************
+
+} // namespace fusion
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running fused dense assignment test..." << std::endl;
+
+   try
+   {
+      RUN_FUSION_DENSE_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during fused dense assignment test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
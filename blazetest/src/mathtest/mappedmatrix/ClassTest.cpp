@@ -0,0 +1,951 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/mappedmatrix/ClassTest.cpp
+//  \brief Source file for the MappedMatrix class test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <utility>
+#include <blaze/math/serialization/TypeValueMapping.h>
+#include <blazetest/mathtest/mappedmatrix/ClassTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace mappedmatrix {
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+const char* const ClassTest::fileA = "blazetest_mappedmatrix_a.bin";
+const char* const ClassTest::fileB = "blazetest_mappedmatrix_b.bin";
+const char* const ClassTest::fileC = "blazetest_mappedmatrix_c.bin";
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the MappedMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testFileFormat();
+   testReopen();
+   testHeaderChecks();
+   testAt();
+   testMove();
+   testAssign();
+   testGemv();
+   testGemm();
+
+   removeFiles();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the MappedMatrix constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the default constructor and of the creation of new matrix
+// files of various sizes and tile sizes. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   constexpr size_t S( MT::SIMDSIZE );
+
+   //=====================================================================================
+   // Default constructor
+   //=====================================================================================
+
+   {
+      test_ = "MappedMatrix default constructor";
+
+      const MT A;
+
+      if( A.rows() != 0UL || A.columns() != 0UL || A.tileSize() != 0UL || A.isWritable() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid default matrix detected\n"
+             << " Details:\n"
+             << "   Size     : " << A.rows() << "x" << A.columns() << "\n"
+             << "   Tile size: " << A.tileSize() << "\n"
+             << "   Writable : " << A.isWritable() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Creation of a new matrix file
+   //=====================================================================================
+
+   {
+      test_ = "MappedMatrix creation of a new matrix file";
+
+      for( size_t T : { 1UL, 5UL, S } ) {
+         for( const auto& size : { std::make_pair( 1UL, 1UL ), std::make_pair( 7UL, 13UL ),
+                                   std::make_pair( 13UL, 7UL ), std::make_pair( 2UL*S+1UL, 3UL ) } )
+         {
+            const size_t m( size.first  );
+            const size_t n( size.second );
+
+            size_t tiles( 0UL ), tileSize( 0UL );
+
+            {
+               const MT A( fileA, m, n, T );
+
+               checkSize( A, m, n, T );
+               checkMatrix( A, DMT( m, n, 0.0 ) );
+
+               if( !A.isWritable() ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: New matrix is not writable\n";
+                  throw std::runtime_error( oss.str() );
+               }
+
+               tiles    = A.tileRows() * A.tileColumns();
+               tileSize = A.tileSize();
+            }
+
+            const size_t bytes( readFile( fileA ).size() );
+
+            if( bytes != MT::HEADERSIZE + tiles*tileSize*tileSize*sizeof(double) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Invalid file size detected\n"
+                   << " Details:\n"
+                   << "   Size          : " << m << "x" << n << "\n"
+                   << "   Tile size     : " << tileSize << "\n"
+                   << "   File size     : " << bytes << "\n"
+                   << "   Expected size : " << MT::HEADERSIZE + tiles*tileSize*tileSize*sizeof(double) << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+
+      try {
+         const MT A( fileA, 3UL, 3UL, 0UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Creating a matrix with tile size 0 succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the file format of the MappedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the header of a newly created matrix file and the position of every
+// matrix element within the file, i.e. the tiles in row-major order and the row-major layout
+// with a spacing of the tile size within every tile. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testFileFormat()
+{
+   test_ = "MappedMatrix file format";
+
+   constexpr size_t S( MT::SIMDSIZE );
+
+   for( size_t T : { 1UL, 5UL, S } )
+   {
+      const size_t m( 7UL ), n( 13UL );
+      const DMT X( createMatrix<double>( m, n ) );
+
+      size_t tileSize( 0UL ), tn( 0UL );
+
+      {
+         MT A( fileA, m, n, T );
+
+         for( size_t i=0UL; i<m; ++i )
+            for( size_t j=0UL; j<n; ++j )
+               A(i,j) = X(i,j);
+
+         A.flush();
+
+         tileSize = A.tileSize();
+         tn       = A.tileColumns();
+      }
+
+      const std::vector<char> bytes( readFile( fileA ) );
+
+      uint64_t header[6];
+      std::memcpy( header, bytes.data()+8UL, sizeof( header ) );
+
+      if( std::memcmp( bytes.data(), "BLAZEMM", 8UL ) != 0 || header[0] != 1U ||
+          header[1] != uint64_t( blaze::TypeValueMapping<double>::value ) ||
+          header[2] != sizeof(double) || header[3] != m || header[4] != n || header[5] != tileSize ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid file header detected\n"
+             << " Details:\n"
+             << "   Version  : " << header[0] << "\n"
+             << "   Type     : " << header[1] << "\n"
+             << "   Size     : " << header[2] << "\n"
+             << "   Rows     : " << header[3] << "\n"
+             << "   Columns  : " << header[4] << "\n"
+             << "   Tile size: " << header[5] << " (expected " << tileSize << ")\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      for( size_t i=0UL; i<m; ++i ) {
+         for( size_t j=0UL; j<n; ++j )
+         {
+            const size_t tile( (i/tileSize)*tn + j/tileSize );
+            const size_t offset( tile*tileSize*tileSize + (i%tileSize)*tileSize + j%tileSize );
+
+            double value;
+            std::memcpy( &value, bytes.data() + MT::HEADERSIZE + offset*sizeof(double), sizeof(double) );
+
+            if( value != X(i,j) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Invalid element position detected\n"
+                   << " Details:\n"
+                   << "   Tile size   : " << tileSize << "\n"
+                   << "   Element     : (" << i << "," << j << ")\n"
+                   << "   File value  : " << value << "\n"
+                   << "   Matrix value: " << X(i,j) << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of reopening existing matrix files.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that a matrix file can be reopened for reading only and for reading and
+// writing and that the modifications of a writable matrix are persistent. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testReopen()
+{
+   test_ = "MappedMatrix reopening of a matrix file";
+
+   constexpr size_t S( MT::SIMDSIZE );
+
+   for( size_t T : { 1UL, 5UL, S } ) {
+      for( const auto& size : { std::make_pair( 1UL, 1UL ), std::make_pair( 7UL, 13UL ),
+                                std::make_pair( 2UL*S+1UL, 3UL ) } )
+      {
+         const size_t m( size.first  );
+         const size_t n( size.second );
+
+         DMT X( createMatrix<double>( m, n ) );
+
+         {
+            MT A( fileA, m, n, T );
+            assign( A, X );
+         }
+
+         {
+            const MT A( fileA );
+
+            checkSize( A, m, n, T );
+            checkMatrix( A, X );
+
+            if( A.isWritable() ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Read-only matrix is writable\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+
+         {
+            MT A( fileA, true );
+
+            checkSize( A, m, n, T );
+            checkMatrix( A, X );
+
+            A(0,0)     = 42.0;
+            A(m-1,n-1) = -7.0;
+            X(0,0)     = 42.0;
+            X(m-1,n-1) = -7.0;
+         }
+
+         {
+            const MT A( fileA );
+            checkMatrix( A, X );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the validation of matrix files.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that missing files, files of a different element type and files with
+// a corrupted header or size are rejected. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testHeaderChecks()
+{
+   test_ = "MappedMatrix validation of matrix files";
+
+   constexpr size_t S( MT::SIMDSIZE );
+
+   removeFiles();
+   checkInvalidFile<double>( fileA, "could not be opened" );
+
+   {
+      MT A( fileA, 7UL, 13UL, 5UL );
+      assign( A, createMatrix<double>( 7UL, 13UL ) );
+   }
+
+   const std::vector<char> valid( readFile( fileA ) );
+
+   checkInvalidFile<float>  ( fileA, "Incompatible element type" );
+   checkInvalidFile<int64_t>( fileA, "Incompatible element type" );
+   checkInvalidFile<blaze::complex<double> >( fileA, "Incompatible element type" );
+
+   const auto patch = [&]( size_t offset, uint64_t value ) {
+      std::vector<char> bytes( valid );
+      std::memcpy( bytes.data()+offset, &value, sizeof( value ) );
+      writeFile( fileB, bytes );
+   };
+
+   {
+      std::vector<char> bytes( valid );
+      bytes[0] = 'X';
+      writeFile( fileB, bytes );
+      checkInvalidFile<double>( fileB, "Invalid matrix file" );
+   }
+
+   patch( 8UL, 2U );
+   checkInvalidFile<double>( fileB, "Invalid matrix file" );
+
+   patch( 48UL, 0U );
+   checkInvalidFile<double>( fileB, "Incompatible tile size" );
+
+   if( S > 1UL ) {
+      patch( 48UL, S+1UL );
+      checkInvalidFile<double>( fileB, "Incompatible tile size" );
+   }
+
+   patch( 32UL, 17U );
+   checkInvalidFile<double>( fileB, "Invalid matrix file" );
+
+   {
+      std::vector<char> bytes( valid.begin(), valid.end()-sizeof(double) );
+      writeFile( fileB, bytes );
+      checkInvalidFile<double>( fileB, "Invalid matrix file" );
+   }
+
+   {
+      std::vector<char> bytes( valid );
+      bytes.resize( bytes.size() + 64UL, 0 );
+      writeFile( fileB, bytes );
+      checkInvalidFile<double>( fileB, "Invalid matrix file" );
+   }
+
+   {
+      std::vector<char> bytes( valid.begin(), valid.begin()+100 );
+      writeFile( fileB, bytes );
+      checkInvalidFile<double>( fileB, "Invalid matrix file" );
+   }
+
+   {
+      const MT A( fileA );
+      checkSize( A, 7UL, 13UL, 5UL );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the at() member function of the MappedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the checked element access of writable and read-only
+// matrices. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAt()
+{
+   test_ = "MappedMatrix::at()";
+
+   {
+      MT A( fileA, 7UL, 13UL, 5UL );
+      A.at(6,12) = 3.0;
+      A.at(0,5)  = 2.0;
+
+      try {
+         A.at(7,0);
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Out-of-bound row access succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::out_of_range& ) {}
+
+      try {
+         A.at(0,13);
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Out-of-bound column access succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::out_of_range& ) {}
+   }
+
+   {
+      MT A( fileA );
+      const MT& cA( A );
+
+      if( cA.at(6,12) != 3.0 || cA.at(0,5) != 2.0 || cA.at(3,3) != 0.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Access via at() function failed\n"
+             << " Details:\n"
+             << "   Result: " << cA.at(6,12) << " " << cA.at(0,5) << " " << cA.at(3,3) << "\n"
+             << "   Expected result: 3 2 0\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      try {
+         A.at(1,1) = 1.0;
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Write access to read-only matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::logic_error& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the move operations of the MappedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the move constructor, the move assignment operator and the
+// swap functions of the MappedMatrix class template. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMove()
+{
+   test_ = "MappedMatrix move operations";
+
+   const DMT X( createMatrix<double>( 7UL, 13UL ) );
+   const DMT Y( createMatrix<double>( 3UL, 2UL ) );
+
+   MT A( fileA, 7UL, 13UL, 5UL );
+   assign( A, X );
+
+   MT B( std::move( A ) );
+   checkMatrix( B, X );
+   checkSize( A, 0UL, 0UL, 0UL );
+
+   MT C( fileB, 3UL, 2UL, 1UL );
+   assign( C, Y );
+
+   C = std::move( B );
+   checkMatrix( C, X );
+
+   MT D( fileC, 3UL, 2UL, 1UL );
+   assign( D, Y );
+
+   swap( C, D );
+   checkMatrix( C, Y );
+   checkMatrix( D, X );
+
+   C.swap( D );
+   checkMatrix( C, X );
+   checkMatrix( D, Y );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the assign() functions for mapped matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the assignment of in-memory dense matrices and expressions
+// and of the element-wise unary and binary operations on mapped matrices, including in-place
+// operations and the handling of non-matching and read-only matrices. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAssign()
+{
+   constexpr size_t S( MT::SIMDSIZE );
+
+   const auto op1 = []( double a ) { return 2.0*a + 1.0; };
+
+   for( size_t T : { 1UL, 5UL, S } ) {
+      for( const auto& size : { std::make_pair( 1UL, 1UL ), std::make_pair( 7UL, 13UL ),
+                                std::make_pair( 13UL, 7UL ), std::make_pair( 2UL*S+1UL, 3UL ) } )
+      {
+         const size_t m( size.first  );
+         const size_t n( size.second );
+
+         const DMT X( createMatrix<double>( m, n ) );
+         const DMT Y( createMatrix<double>( m, n ) );
+
+         MT A( fileA, m, n, T ), B( fileB, m, n, T ), C( fileC, m, n, T );
+
+         test_ = "MappedMatrix assignment of a dense matrix";
+
+         assign( A, X );
+         checkMatrix( A, X );
+
+         assign( B, X + 2.0*Y );
+         checkMatrix( B, DMT( X + 2.0*Y ) );
+
+         test_ = "MappedMatrix assignment of a unary operation";
+
+         assign( C, A, op1 );
+         checkMatrix( C, DMT( map( X, op1 ) ) );
+
+         assign( A, A, op1 );
+         checkMatrix( A, DMT( map( X, op1 ) ) );
+
+         test_ = "MappedMatrix assignment of a binary operation";
+
+         assign( C, A, B, blaze::Add() );
+         checkMatrix( C, DMT( map( X, op1 ) + X + 2.0*Y ) );
+
+         assign( B, B, B, blaze::Mult() );
+         checkMatrix( B, DMT( ( X + 2.0*Y ) % ( X + 2.0*Y ) ) );
+      }
+   }
+
+   test_ = "MappedMatrix assignment of non-matching matrices";
+
+   {
+      MT A( fileA, 7UL, 13UL, 5UL ), B( fileB, 7UL, 13UL, 5UL+S ), C( fileC, 13UL, 7UL, 5UL );
+
+      try {
+         assign( A, DMT( 7UL, 12UL ) );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment of a non-matching dense matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      try {
+         assign( B, A, op1 );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment with non-matching tile sizes succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      try {
+         assign( C, A, op1 );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment of a non-matching matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      try {
+         assign( A, A, B, blaze::Add() );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment with non-matching tile sizes succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   test_ = "MappedMatrix assignment to a read-only matrix";
+
+   {
+      MT A( fileA );
+
+      try {
+         assign( A, DMT( 7UL, 13UL, 1.0 ) );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment to a read-only matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      checkMatrix( A, DMT( 7UL, 13UL, 0.0 ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the mapped matrix/dense vector multiplication.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the gemv() function for mapped matrices, including the
+// scaled multiplication, the multiplication with a target vector that is identical to the
+// right-hand side vector and the handling of non-matching vectors. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testGemv()
+{
+   test_ = "MappedMatrix gemv()";
+
+   constexpr size_t S( MT::SIMDSIZE );
+
+   for( size_t T : { 1UL, 5UL, S } ) {
+      for( const auto& size : { std::make_pair( 1UL, 1UL ), std::make_pair( 7UL, 13UL ),
+                                std::make_pair( 13UL, 7UL ), std::make_pair( 2UL*S+1UL, 2UL*S+1UL ) } )
+      {
+         const size_t m( size.first  );
+         const size_t n( size.second );
+
+         const DMT X( createMatrix<double>( m, n ) );
+         const DVT x( createVector<double>( n ) );
+         const DVT y0( createVector<double>( m ) );
+
+         MT A( fileA, m, n, T );
+         assign( A, X );
+
+         DVT y;
+         gemv( y, A, x );
+
+         if( y != X*x ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Multiplication failed\n"
+                << " Details:\n"
+                << "   Size     : " << m << "x" << n << "\n"
+                << "   Tile size: " << A.tileSize() << "\n"
+                << "   Result:\n" << y << "\n"
+                << "   Expected result:\n" << DVT( X*x ) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         y = y0;
+         gemv( y, A, x, 2.0, -3.0 );
+
+         if( y != 2.0*(X*x) - 3.0*y0 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Scaled multiplication failed\n"
+                << " Details:\n"
+                << "   Size     : " << m << "x" << n << "\n"
+                << "   Tile size: " << A.tileSize() << "\n"
+                << "   Result:\n" << y << "\n"
+                << "   Expected result:\n" << DVT( 2.0*(X*x) - 3.0*y0 ) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         if( m == n ) {
+            DVT z( x );
+            gemv( z, A, z );
+
+            if( z != X*x ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Multiplication with aliasing vectors failed\n"
+                   << " Details:\n"
+                   << "   Size     : " << m << "x" << n << "\n"
+                   << "   Tile size: " << A.tileSize() << "\n"
+                   << "   Result:\n" << z << "\n"
+                   << "   Expected result:\n" << DVT( X*x ) << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+
+         try {
+            DVT z( m );
+            gemv( z, A, DVT( n+1UL ) );
+
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Multiplication with non-matching vector succeeded\n";
+            throw std::runtime_error( oss.str() );
+         }
+         catch( std::invalid_argument& ) {}
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the mapped matrix/mapped matrix multiplication.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the gemm() function for mapped matrices, including the
+// scaled multiplication and the handling of non-matching, aliasing and read-only matrices.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testGemm()
+{
+   test_ = "MappedMatrix gemm()";
+
+   constexpr size_t S( MT::SIMDSIZE );
+
+   const size_t sizes[][3] = { { 1UL, 1UL, 1UL }, { 7UL, 13UL, 5UL }, { 13UL, 7UL, 9UL },
+                               { 2UL*S+1UL, S+3UL, 3UL }, { 4UL, 2UL*S+3UL, 2UL*S+3UL } };
+
+   for( size_t T : { 1UL, 5UL, S } ) {
+      for( const auto& size : sizes )
+      {
+         const size_t m( size[0] ), k( size[1] ), n( size[2] );
+
+         const DMT X( createMatrix<double>( m, k ) );
+         const DMT Y( createMatrix<double>( k, n ) );
+         const DMT Z( createMatrix<double>( m, n ) );
+
+         MT A( fileA, m, k, T ), B( fileB, k, n, T ), C( fileC, m, n, T );
+         assign( A, X );
+         assign( B, Y );
+
+         C.setReadAhead( T % 3UL );
+
+         gemm( C, A, B );
+         checkMatrix( C, DMT( X * Y ) );
+
+         assign( C, Z );
+         gemm( C, A, B, 2.0, -3.0 );
+         checkMatrix( C, DMT( 2.0*(X*Y) - 3.0*Z ) );
+
+         gemm( C, A, B, -1.0 );
+         checkMatrix( C, DMT( -(X*Y) ) );
+      }
+   }
+
+   {
+      MT A( fileA, 7UL, 7UL, 5UL ), B( fileB, 7UL, 7UL, 5UL+S ), C( fileC, 7UL, 6UL, 5UL );
+
+      try {
+         gemm( A, A, A );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication with aliasing target matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      try {
+         gemm( B, A, A );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication with non-matching tile sizes succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      try {
+         gemm( C, A, A );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication with non-matching target matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      {
+         MT B( fileB, 7UL, 7UL, 5UL );
+      }
+
+      const MT A( fileA );
+      MT B( fileB );
+
+      try {
+         gemm( B, A, A );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication into a read-only matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Reading the complete content of the given file.
+//
+// \param file The name of the file.
+// \return The content of the file.
+*/
+std::vector<char> ClassTest::readFile( const std::string& file )
+{
+   std::ifstream in( file, std::ios::binary );
+   return std::vector<char>( std::istreambuf_iterator<char>( in ), std::istreambuf_iterator<char>() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Replacing the content of the given file.
+//
+// \param file The name of the file.
+// \param bytes The new content of the file.
+// \return void
+*/
+void ClassTest::writeFile( const std::string& file, const std::vector<char>& bytes )
+{
+   std::ofstream out( file, std::ios::binary | std::ios::trunc );
+   out.write( bytes.data(), bytes.size() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removing all temporary matrix files.
+//
+// \return void
+*/
+void ClassTest::removeFiles()
+{
+   std::remove( fileA );
+   std::remove( fileB );
+   std::remove( fileC );
+}
+//*************************************************************************************************
+
+} // namespace mappedmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running MappedMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_MAPPEDMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during MappedMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
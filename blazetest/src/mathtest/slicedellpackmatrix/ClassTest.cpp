@@ -0,0 +1,504 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/slicedellpackmatrix/ClassTest.cpp
+//  \brief Source file for the SlicedEllpackMatrix class test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blazetest/mathtest/slicedellpackmatrix/ClassTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace slicedellpackmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the SlicedEllpackMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testAssignment();
+   testAt();
+   testLookup();
+   testClear();
+   testSwap();
+   testMultiplication();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the SlicedEllpackMatrix constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the SlicedEllpackMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   //=====================================================================================
+   // Default constructor
+   //=====================================================================================
+
+   {
+      test_ = "SlicedEllpackMatrix default constructor";
+
+      const MT sell;
+
+      checkRows    ( sell, 0UL );
+      checkColumns ( sell, 0UL );
+      checkNonZeros( sell, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Size constructor
+   //=====================================================================================
+
+   {
+      test_ = "SlicedEllpackMatrix size constructor (0x4)";
+
+      const MT sell( 0UL, 4UL );
+
+      checkRows    ( sell, 0UL );
+      checkColumns ( sell, 4UL );
+      checkNonZeros( sell, 0UL );
+   }
+
+   {
+      test_ = "SlicedEllpackMatrix size constructor (13x7)";
+
+      const MT sell( 13UL, 7UL );
+
+      checkMatrix( sell, RMT( 13UL, 7UL ) );
+   }
+
+
+   //=====================================================================================
+   // Conversion constructor
+   //=====================================================================================
+
+   {
+      test_ = "SlicedEllpackMatrix conversion constructor (empty rows only)";
+
+      checkMatrix( MT( RMT( 5UL, 9UL ) ), RMT( 5UL, 9UL ) );
+      checkMatrix( MT( CMT( 5UL, 9UL ) ), RMT( 5UL, 9UL ) );
+   }
+
+   {
+      test_ = "SlicedEllpackMatrix conversion constructor (single row)";
+
+      RMT ref( 1UL, 100UL );
+      ref(0,3) = 1.0;
+      ref(0,50) = 2.0;
+      ref(0,99) = 3.0;
+
+      checkMatrix( MT( ref ), ref );
+      checkMatrix( MT32( ref ), ref );
+   }
+
+   {
+      test_ = "SlicedEllpackMatrix conversion constructor (single column)";
+
+      RMT ref( 37UL, 1UL );
+      for( size_t i=0UL; i<ref.rows(); i+=3UL ) {
+         ref(i,0) = double( i+1UL );
+      }
+
+      checkMatrix( MT( ref ), ref );
+      checkMatrix( MT32( ref ), ref );
+   }
+
+   {
+      test_ = "SlicedEllpackMatrix conversion constructor (random matrices)";
+
+      for( size_t m : { 1UL, 3UL, 8UL, 17UL, 64UL, 129UL } ) {
+         for( size_t n : { 1UL, 5UL, 33UL } ) {
+            for( size_t sigma : { 1UL, 4UL, 16UL, 1000UL } ) {
+               runConversionTest<double,size_t>  ( m, n, sigma );
+               runConversionTest<double,uint32_t>( m, n, sigma );
+               runConversionTest<float,size_t>   ( m, n, sigma );
+               runConversionTest<float,uint32_t> ( m, n, sigma );
+               runConversionTest<int,size_t>     ( m, n, sigma );
+            }
+         }
+      }
+   }
+
+   {
+      test_ = "SlicedEllpackMatrix conversion constructor (invalid sorting scope)";
+
+      try {
+         const MT sell( RMT( 5UL, 5UL ), 0UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction with a sorting scope of zero succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << sell << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Copy and move constructor
+   //=====================================================================================
+
+   {
+      test_ = "SlicedEllpackMatrix copy constructor";
+
+      const RMT ref( createMatrix<double>( 21UL, 13UL ) );
+      const MT sell1( ref );
+      const MT sell2( sell1 );
+
+      checkMatrix( sell2, ref );
+   }
+
+   {
+      test_ = "SlicedEllpackMatrix move constructor";
+
+      const RMT ref( createMatrix<double>( 21UL, 13UL ) );
+      MT sell1( ref );
+      const MT sell2( std::move( sell1 ) );
+
+      checkMatrix( sell2, ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SlicedEllpackMatrix assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all assignment operators of the SlicedEllpackMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAssignment()
+{
+   {
+      test_ = "SlicedEllpackMatrix copy assignment";
+
+      const RMT ref( createMatrix<double>( 19UL, 11UL ) );
+      const MT sell1( ref );
+      MT sell2( 3UL, 3UL );
+
+      sell2 = sell1;
+
+      checkMatrix( sell2, ref );
+   }
+
+   {
+      test_ = "SlicedEllpackMatrix move assignment";
+
+      const RMT ref( createMatrix<double>( 19UL, 11UL ) );
+      MT sell1( ref );
+      MT sell2( 3UL, 3UL );
+
+      sell2 = std::move( sell1 );
+
+      checkMatrix( sell2, ref );
+   }
+
+   {
+      test_ = "SlicedEllpackMatrix sparse matrix assignment";
+
+      const RMT ref( createMatrix<double>( 25UL, 40UL ) );
+      MT sell( 3UL, 3UL );
+
+      sell = ref;
+      checkMatrix( sell, ref );
+
+      sell = CMT( ref );
+      checkMatrix( sell, ref );
+   }
+
+   {
+      test_ = "SlicedEllpackMatrix dense matrix assignment";
+
+      const RMT ref( createMatrix<double>( 25UL, 40UL ) );
+      MT sell( 3UL, 3UL );
+
+      sell = blaze::DynamicMatrix<double,blaze::columnMajor>( ref );
+      checkMatrix( sell, ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c at() member function of the SlicedEllpackMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the checked element access of the SlicedEllpackMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAt()
+{
+   test_ = "SlicedEllpackMatrix::at()";
+
+   RMT ref( 3UL, 4UL );
+   ref(0,1) = 1.0;
+   ref(2,3) = 2.0;
+
+   const MT sell( ref );
+
+   if( sell.at(0,1) != 1.0 || sell.at(2,3) != 2.0 || sell.at(1,1) != 0.0 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Access via at() function failed\n"
+          << " Details:\n"
+          << "   Result:\n" << sell << "\n"
+          << "   Expected result:\n" << ref << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   try {
+      sell.at(3,0);
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Out-of-bound row access succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::out_of_range& ) {}
+
+   try {
+      sell.at(0,4);
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Out-of-bound column access succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::out_of_range& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the lookup functions of the SlicedEllpackMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the find(), lowerBound() and upperBound() member functions
+// of the SlicedEllpackMatrix class template. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testLookup()
+{
+   test_ = "SlicedEllpackMatrix lookup functions";
+
+   const RMT ref( createMatrix<double>( 45UL, 30UL ) );
+   const MT sell( ref, 8UL );
+
+   for( size_t i=0UL; i<ref.rows(); ++i ) {
+      for( size_t j=0UL; j<ref.columns(); ++j )
+      {
+         const auto found( sell.find( i, j ) );
+         const auto lower( sell.lowerBound( i, j ) );
+         const auto upper( sell.upperBound( i, j ) );
+
+         const bool isFound( ref.find( i, j ) != ref.end( i ) );
+         const auto refLower( ref.lowerBound( i, j ) );
+         const auto refUpper( ref.upperBound( i, j ) );
+
+         if( ( found != sell.end( i ) ) != isFound ||
+             ( isFound && ( found->index() != j || found->value() != ref(i,j) ) ) ||
+             ( lower == sell.end( i ) ) != ( refLower == ref.end( i ) ) ||
+             ( lower != sell.end( i ) && lower->index() != refLower->index() ) ||
+             ( upper == sell.end( i ) ) != ( refUpper == ref.end( i ) ) ||
+             ( upper != sell.end( i ) && upper->index() != refUpper->index() ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Lookup of element (" << i << "," << j << ") failed\n"
+                << " Details:\n"
+                << "   Expected result:\n" << ref << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c clear() member function of the SlicedEllpackMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the clear() member function of the SlicedEllpackMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testClear()
+{
+   test_ = "SlicedEllpackMatrix::clear()";
+
+   MT sell( createMatrix<double>( 17UL, 9UL ) );
+
+   sell.clear();
+
+   checkRows    ( sell, 0UL );
+   checkColumns ( sell, 0UL );
+   checkNonZeros( sell, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c swap() functionality of the SlicedEllpackMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the swap() function of the SlicedEllpackMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSwap()
+{
+   test_ = "SlicedEllpackMatrix swap";
+
+   const RMT ref1( createMatrix<double>( 17UL, 9UL ) );
+   const RMT ref2( createMatrix<double>( 4UL, 31UL ) );
+
+   MT sell1( ref1 );
+   MT sell2( ref2 );
+
+   swap( sell1, sell2 );
+
+   checkMatrix( sell1, ref2 );
+   checkMatrix( sell2, ref1 );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the multiplication kernels of the SlicedEllpackMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the (vectorized) sparse matrix/dense vector and transpose dense
+// vector/sparse matrix multiplications with sliced ELLPACK matrices of various sizes, index
+// types and sorting scopes. The numbers of rows include values that are not a multiple of
+// the slice height. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMultiplication()
+{
+   test_ = "SlicedEllpackMatrix multiplication";
+
+   for( size_t m : { 0UL, 1UL, 2UL, 7UL, 16UL, 31UL, 100UL } ) {
+      for( size_t n : { 1UL, 9UL, 64UL } ) {
+         for( size_t sigma : { 1UL, 5UL, 64UL } ) {
+            runMultiplicationTest<double,size_t>  ( m, n, sigma );
+            runMultiplicationTest<double,uint32_t>( m, n, sigma );
+            runMultiplicationTest<float,size_t>   ( m, n, sigma );
+            runMultiplicationTest<float,uint32_t> ( m, n, sigma );
+            runMultiplicationTest<int,size_t>     ( m, n, sigma );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace slicedellpackmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running SlicedEllpackMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_SLICEDELLPACKMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during SlicedEllpackMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,482 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/splitcompressedvector/ClassTest.cpp
+//  \brief Source file for the SplitCompressedVector class test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blazetest/mathtest/splitcompressedvector/ClassTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace splitcompressedvector {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the SplitCompressedVector class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testAssignment();
+   testAt();
+   testLookup();
+   testClear();
+   testSwap();
+   testInnerProduct();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the SplitCompressedVector constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the SplitCompressedVector class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   //=====================================================================================
+   // Default constructor
+   //=====================================================================================
+
+   {
+      test_ = "SplitCompressedVector default constructor";
+
+      const VT vec;
+
+      checkSize    ( vec, 0UL );
+      checkNonZeros( vec, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Size constructor
+   //=====================================================================================
+
+   {
+      test_ = "SplitCompressedVector size constructor (size 0)";
+
+      const VT vec( 0UL );
+
+      checkSize    ( vec, 0UL );
+      checkNonZeros( vec, 0UL );
+   }
+
+   {
+      test_ = "SplitCompressedVector size constructor (size 13)";
+
+      const VT vec( 13UL );
+
+      checkVector( vec, RVT( 13UL ) );
+   }
+
+   {
+      test_ = "SplitCompressedVector size constructor (invalid size for 32-bit indices)";
+
+      try {
+         const VT32 vec( size_t( 1UL ) << 32 );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction with a size exceeding the index type succeeded\n"
+             << " Details:\n"
+             << "   Size: " << vec.size() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Conversion constructor
+   //=====================================================================================
+
+   {
+      test_ = "SplitCompressedVector conversion constructor (empty vector)";
+
+      checkVector( VT( RVT( 9UL ) ), RVT( 9UL ) );
+      checkVector( VT( blaze::DynamicVector<double,blaze::columnVector>( 9UL, 0.0 ) ), RVT( 9UL ) );
+   }
+
+   {
+      test_ = "SplitCompressedVector conversion constructor (single element)";
+
+      RVT ref( 100UL );
+      ref[99] = 3.0;
+
+      checkVector( VT( ref ), ref );
+      checkVector( VT32( ref ), ref );
+   }
+
+   {
+      test_ = "SplitCompressedVector conversion constructor (random vectors)";
+
+      for( size_t n : { 1UL, 3UL, 8UL, 17UL, 64UL, 129UL } ) {
+         for( size_t nonzeros : { 1UL, 5UL, 33UL } ) {
+            runConversionTest<double,size_t>  ( n, nonzeros );
+            runConversionTest<double,uint32_t>( n, nonzeros );
+            runConversionTest<float,size_t>   ( n, nonzeros );
+            runConversionTest<float,uint32_t> ( n, nonzeros );
+            runConversionTest<int,size_t>     ( n, nonzeros );
+         }
+      }
+   }
+
+   {
+      test_ = "SplitCompressedVector conversion constructor (vector expression)";
+
+      const RVT ref1( createVector<double>( 50UL, 10UL ) );
+      const RVT ref2( createVector<double>( 50UL, 10UL ) );
+
+      checkVector( VT( ref1 + ref2 ), RVT( ref1 + ref2 ) );
+      checkVector( VT( 2.0 * ref1 ), RVT( 2.0 * ref1 ) );
+   }
+
+
+   //=====================================================================================
+   // Copy and move constructor
+   //=====================================================================================
+
+   {
+      test_ = "SplitCompressedVector copy constructor";
+
+      const RVT ref( createVector<double>( 21UL, 13UL ) );
+      const VT vec1( ref );
+      const VT vec2( vec1 );
+
+      checkVector( vec2, ref );
+   }
+
+   {
+      test_ = "SplitCompressedVector move constructor";
+
+      const RVT ref( createVector<double>( 21UL, 13UL ) );
+      VT vec1( ref );
+      const VT vec2( std::move( vec1 ) );
+
+      checkVector( vec2, ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SplitCompressedVector assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all assignment operators of the SplitCompressedVector class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAssignment()
+{
+   {
+      test_ = "SplitCompressedVector copy assignment";
+
+      const RVT ref( createVector<double>( 19UL, 11UL ) );
+      const VT vec1( ref );
+      VT vec2( 3UL );
+
+      vec2 = vec1;
+
+      checkVector( vec2, ref );
+   }
+
+   {
+      test_ = "SplitCompressedVector move assignment";
+
+      const RVT ref( createVector<double>( 19UL, 11UL ) );
+      VT vec1( ref );
+      VT vec2( 3UL );
+
+      vec2 = std::move( vec1 );
+
+      checkVector( vec2, ref );
+   }
+
+   {
+      test_ = "SplitCompressedVector sparse vector assignment";
+
+      const RVT ref( createVector<double>( 40UL, 25UL ) );
+      VT vec( 3UL );
+
+      vec = ref;
+      checkVector( vec, ref );
+
+      vec = ref + ref;
+      checkVector( vec, RVT( ref + ref ) );
+   }
+
+   {
+      test_ = "SplitCompressedVector dense vector assignment";
+
+      const RVT ref( createVector<double>( 40UL, 25UL ) );
+      VT vec( 3UL );
+
+      vec = blaze::DynamicVector<double,blaze::columnVector>( ref );
+      checkVector( vec, ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c at() member function of the SplitCompressedVector class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the checked element access of the SplitCompressedVector
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAt()
+{
+   test_ = "SplitCompressedVector::at()";
+
+   RVT ref( 4UL );
+   ref[1] = 1.0;
+   ref[3] = 2.0;
+
+   const VT vec( ref );
+
+   if( vec.at(1) != 1.0 || vec.at(3) != 2.0 || vec.at(0) != 0.0 || vec.at(2) != 0.0 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Access via at() function failed\n"
+          << " Details:\n"
+          << "   Result:\n" << vec << "\n"
+          << "   Expected result:\n" << ref << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   try {
+      vec.at(4);
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Out-of-bound access succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::out_of_range& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the lookup functions of the SplitCompressedVector class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the find(), lowerBound() and upperBound() member functions
+// of the SplitCompressedVector class template. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testLookup()
+{
+   test_ = "SplitCompressedVector lookup functions";
+
+   const RVT ref( createVector<double>( 60UL, 20UL ) );
+   const VT32 vec( ref );
+
+   for( size_t i=0UL; i<ref.size(); ++i )
+   {
+      const auto found( vec.find( i ) );
+      const auto lower( vec.lowerBound( i ) );
+      const auto upper( vec.upperBound( i ) );
+
+      const bool isFound( ref.find( i ) != ref.end() );
+      const auto refLower( ref.lowerBound( i ) );
+      const auto refUpper( ref.upperBound( i ) );
+
+      if( ( found != vec.end() ) != isFound ||
+          ( isFound && ( found->index() != i || found->value() != ref[i] ) ) ||
+          ( lower == vec.end() ) != ( refLower == ref.end() ) ||
+          ( lower != vec.end() && lower->index() != refLower->index() ) ||
+          ( upper == vec.end() ) != ( refUpper == ref.end() ) ||
+          ( upper != vec.end() && upper->index() != refUpper->index() ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Lookup of element " << i << " failed\n"
+             << " Details:\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c clear() member function of the SplitCompressedVector class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the clear() member function of the SplitCompressedVector
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testClear()
+{
+   test_ = "SplitCompressedVector::clear()";
+
+   VT vec( createVector<double>( 17UL, 9UL ) );
+
+   vec.clear();
+
+   checkSize    ( vec, 0UL );
+   checkNonZeros( vec, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c swap() functionality of the SplitCompressedVector class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the swap() function of the SplitCompressedVector class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSwap()
+{
+   test_ = "SplitCompressedVector swap";
+
+   const RVT ref1( createVector<double>( 17UL, 9UL ) );
+   const RVT ref2( createVector<double>( 31UL, 4UL ) );
+
+   VT vec1( ref1 );
+   VT vec2( ref2 );
+
+   swap( vec1, vec2 );
+
+   checkVector( vec1, ref2 );
+   checkVector( vec2, ref1 );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the inner product kernels of the SplitCompressedVector class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the (vectorized) dense vector/sparse vector, sparse vector/dense vector
+// and sparse vector/sparse vector inner products with split compressed vectors of various
+// sizes and index types. The numbers of non-zero elements include values that are not a
+// multiple of the SIMD width. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void ClassTest::testInnerProduct()
+{
+   test_ = "SplitCompressedVector inner product";
+
+   for( size_t n : { 0UL, 1UL, 2UL, 7UL, 16UL, 31UL, 100UL, 1000UL } ) {
+      for( size_t nonzeros1 : { 0UL, 1UL, 5UL, 17UL, 64UL } ) {
+         for( size_t nonzeros2 : { 0UL, 3UL, 40UL } ) {
+            runInnerProductTest<double,size_t>  ( n, nonzeros1, nonzeros2 );
+            runInnerProductTest<double,uint32_t>( n, nonzeros1, nonzeros2 );
+            runInnerProductTest<float,size_t>   ( n, nonzeros1, nonzeros2 );
+            runInnerProductTest<float,uint32_t> ( n, nonzeros1, nonzeros2 );
+            runInnerProductTest<int,size_t>     ( n, nonzeros1, nonzeros2 );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace splitcompressedvector
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running SplitCompressedVector class test..." << std::endl;
+
+   try
+   {
+      RUN_SPLITCOMPRESSEDVECTOR_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during SplitCompressedVector class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,689 @@
+//=================================================================================================
+/*!
+//  \file src/utiltest/compression/OperationTest.cpp
+//  \brief Source file for the compression operation test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <blaze/util/Compression.h>
+#include <blaze/util/Random.h>
+#include <blazetest/utiltest/compression/OperationTest.h>
+
+
+namespace blazetest {
+
+namespace utiltest {
+
+namespace compression {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the OperationTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+OperationTest::OperationTest()
+{
+   // Byte filters
+   testShuffle();
+   testDelta();
+
+   // LZ codec
+   testRoundTrip();
+   testCapacity();
+   testTruncated();
+   testCorrupt();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the byteShuffle() and byteUnshuffle() functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function shuffles and unshuffles arrays of various sizes and element sizes, including
+// arrays with trailing bytes that do not form a complete element. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testShuffle()
+{
+   {
+      test_ = "Byte shuffle with a compile time element size";
+
+      const char src[9] = { 0, 1, 2, 3, 4, 5, 6, 7, 8 };
+      const char ref[9] = { 0, 4, 1, 5, 2, 6, 3, 7, 8 };
+      char dst[9] = {};
+
+      blaze::byteShuffle( src, dst, 9UL, 4UL );
+
+      if( std::memcmp( dst, ref, 9UL ) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Shuffling failed\n"
+             << " Details:\n"
+             << "   Result:";
+         for( char c : dst ) oss << " " << int( c );
+         oss << "\n   Expected result: 0 4 1 5 2 6 3 7 8\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Byte shuffle with a runtime element size";
+
+      const char src[8] = { 0, 1, 2, 3, 4, 5, 6, 7 };
+      const char ref[8] = { 0, 3, 1, 4, 2, 5, 6, 7 };
+      char dst[8] = {};
+
+      blaze::byteShuffle( src, dst, 8UL, 3UL );
+
+      if( std::memcmp( dst, ref, 8UL ) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Shuffling failed\n"
+             << " Details:\n"
+             << "   Result:";
+         for( char c : dst ) oss << " " << int( c );
+         oss << "\n   Expected result: 0 3 1 4 2 5 6 7\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Byte shuffle round trip";
+
+      for( size_t typeSize : { 0UL, 1UL, 2UL, 3UL, 4UL, 5UL, 8UL, 16UL } ) {
+         for( size_t size : { 0UL, 1UL, 7UL, 8UL, 9UL, 100UL, 1001UL, 4096UL } )
+         {
+            const std::vector<char> src( randomData( size+1UL, 255 ) );
+            std::vector<char> tmp( size+1UL ), dst( size+1UL );
+
+            blaze::byteShuffle  ( src.data(), tmp.data(), size, typeSize );
+            blaze::byteUnshuffle( tmp.data(), dst.data(), size, typeSize );
+
+            if( !std::equal( src.begin(), src.begin()+size, dst.begin() ) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Unshuffling did not restore the original data\n"
+                   << " Details:\n"
+                   << "   Size         = " << size << "\n"
+                   << "   Element size = " << typeSize << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the byteDeltaEncode() and byteDeltaDecode() functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function encodes and decodes arrays of various sizes, including differences that wrap
+// around modulo 256. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testDelta()
+{
+   {
+      test_ = "Byte delta encoding";
+
+      const unsigned char ref[6] = { 1U, 2U, 3U, 4U, 245U, 1U };
+      unsigned char data[6] = { 1U, 3U, 6U, 10U, 255U, 0U };
+
+      blaze::byteDeltaEncode( reinterpret_cast<char*>( data ), 6UL );
+
+      if( std::memcmp( data, ref, 6UL ) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Delta encoding failed\n"
+             << " Details:\n"
+             << "   Result:";
+         for( unsigned char c : data ) oss << " " << int( c );
+         oss << "\n   Expected result: 1 2 3 4 245 1\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Byte delta round trip";
+
+      for( size_t size : { 0UL, 1UL, 2UL, 1000UL } )
+      {
+         const std::vector<char> src( randomData( size, 255 ) );
+         std::vector<char> data( src );
+
+         blaze::byteDeltaEncode( data.data(), size );
+         blaze::byteDeltaDecode( data.data(), size );
+
+         if( data != src ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Delta decoding did not restore the original data\n"
+                << " Details:\n"
+                << "   Size = " << size << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the compression and decompression of various kinds of data.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compresses and decompresses very short, constant, periodic, random and
+// filtered floating point data as well as data with repetitions beyond the 64 KiB window of
+// the codec. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testRoundTrip()
+{
+   test_ = "LZ round trip";
+
+   // Short data without any matches
+   for( size_t size=1UL; size<20UL; ++size ) {
+      checkRoundTrip( randomData( size, 255 ) );
+   }
+
+   // Constant data (overlapping matches with extended match lengths)
+   {
+      const std::vector<char> data( 100000UL, 0 );
+      const std::vector<char> compressed( compress( data ) );
+
+      checkRoundTrip( data );
+
+      if( compressed.size() > 1000UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Insufficient compression of constant data\n"
+             << " Details:\n"
+             << "   Size            = " << data.size() << "\n"
+             << "   Compressed size = " << compressed.size() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Periodic data
+   for( size_t period : { 1UL, 3UL, 4UL, 17UL, 300UL } ) {
+      const std::vector<char> pattern( randomData( period, 255 ) );
+      std::vector<char> data( 20000UL );
+      for( size_t i=0UL; i<data.size(); ++i )
+         data[i] = pattern[i%period];
+      checkRoundTrip( data );
+   }
+
+   // Random data (extended literal lengths)
+   checkRoundTrip( randomData( 70000UL, 255 ) );
+   checkRoundTrip( randomData( 50000UL, 3 ) );
+
+   // Repetitions inside and beyond the 64 KiB window
+   for( size_t distance : { 65000UL, 65535UL, 65536UL, 70000UL } ) {
+      const std::vector<char> block( randomData( 1000UL, 255 ) );
+      std::vector<char> data( randomData( distance+1000UL, 255 ) );
+      std::copy( block.begin(), block.end(), data.begin() );
+      std::copy( block.begin(), block.end(), data.begin()+distance );
+      checkRoundTrip( data );
+   }
+
+   // Filtered floating point data
+   {
+      const std::vector<char> data( smoothData( 20000UL ) );
+      std::vector<char> filtered( data.size() ), restored( data.size() );
+
+      blaze::byteShuffle( data.data(), filtered.data(), data.size(), sizeof(double) );
+      blaze::byteDeltaEncode( filtered.data(), filtered.size() );
+
+      const std::vector<char> compressed( compress( filtered ) );
+      std::vector<char> tmp( filtered.size() );
+
+      const size_t size( blaze::lzDecompress( compressed.data(), compressed.size(), tmp.data(), tmp.size() ) );
+
+      blaze::byteDeltaDecode( tmp.data(), tmp.size() );
+      blaze::byteUnshuffle( tmp.data(), restored.data(), tmp.size(), sizeof(double) );
+
+      if( size != data.size() || restored != data ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Filtered round trip failed\n"
+             << " Details:\n"
+             << "   Size              = " << data.size() << "\n"
+             << "   Decompressed size = " << size << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the capacity limit of the compression.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compresses data into arrays that are too small for the compressed data and
+// checks that the compression fails without writing beyond the given capacity. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testCapacity()
+{
+   test_ = "LZ compression capacity";
+
+   std::vector<char> data( randomData( 3000UL, 255 ) );
+   data.insert( data.end(), data.begin(), data.begin()+2000 );
+
+   const size_t size( compress( data ).size() );
+
+   for( size_t capacity=0UL; capacity<=size; ++capacity )
+   {
+      std::vector<char> dst( size+16UL, char( 0x5A ) );
+
+      const size_t result( blaze::lzCompress( data.data(), data.size(), dst.data(), capacity ) );
+
+      if( result != ( capacity < size ? 0UL : size ) ||
+          std::count( dst.begin()+capacity, dst.end(), char( 0x5A ) ) != std::ptrdiff_t( dst.size()-capacity ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid compression into a limited array\n"
+             << " Details:\n"
+             << "   Capacity        = " << capacity << "\n"
+             << "   Compressed size = " << size << "\n"
+             << "   Result          = " << result << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      const std::vector<char> random( randomData( 10000UL, 255 ) );
+      std::vector<char> dst( random.size() );
+
+      if( blaze::lzCompress( random.data(), random.size(), dst.data(), random.size()-1UL ) != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Compression of incompressible data succeeded\n"
+             << " Details:\n"
+             << "   Size = " << random.size() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the decompression of truncated data.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function decompresses all proper prefixes of compressed data and checks that none of
+// them is decompressed into the original data. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testTruncated()
+{
+   test_ = "LZ decompression of truncated data";
+
+   std::vector<char> data( randomData( 2000UL, 7 ) );
+   data.insert( data.end(), 500UL, 'x' );
+   data.insert( data.end(), data.begin(), data.begin()+1500 );
+
+   const std::vector<char> compressed( compress( data ) );
+
+   for( size_t size=0UL; size<compressed.size(); ++size )
+   {
+      const std::vector<char> src( compressed.begin(), compressed.begin()+size );
+      std::vector<char> dst( data.size()+16UL, char( 0x5A ) );
+
+      const size_t result( blaze::lzDecompress( src.data(), src.size(), dst.data(), data.size() ) );
+
+      if( result >= data.size() ||
+          std::count( dst.begin()+data.size(), dst.end(), char( 0x5A ) ) != 16 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Decompression of truncated data succeeded\n"
+             << " Details:\n"
+             << "   Compressed size = " << compressed.size() << "\n"
+             << "   Truncated size  = " << size << "\n"
+             << "   Result          = " << result << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the decompression of corrupt data.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function decompresses data with invalid offsets, lengths and capacities and checks that
+// the decompression fails without writing beyond the given capacity. Additionally, randomly
+// modified compressed data is decompressed, which must never exceed the given capacity. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testCorrupt()
+{
+   using Bytes = std::vector<unsigned char>;
+
+   {
+      test_ = "LZ decompression of hand-crafted data";
+
+      const Bytes literals{ 0x30, 'a', 'b', 'c' };
+      const Bytes match   { 0x10, 'a', 0x01, 0x00, 0x00 };
+      char dst[8] = {};
+
+      if( blaze::lzDecompress( reinterpret_cast<const char*>( literals.data() ), 4UL, dst, 8UL ) != 3UL ||
+          std::memcmp( dst, "abc", 3UL ) != 0 ||
+          blaze::lzDecompress( reinterpret_cast<const char*>( match.data() ), 5UL, dst, 8UL ) != 5UL ||
+          std::memcmp( dst, "aaaaa", 5UL ) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Decompression of valid data failed\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "LZ decompression of data with an invalid offset";
+
+      checkCorrupt( Bytes{ 0x10, 'a', 0x00, 0x00, 0x00 }, 16UL );  // Zero offset
+      checkCorrupt( Bytes{ 0x10, 'a', 0x02, 0x00, 0x00 }, 16UL );  // Offset beyond the output
+      checkCorrupt( Bytes{ 0x00, 0x01, 0x00, 0x00 }, 16UL );       // Match without preceding output
+      checkCorrupt( Bytes{ 0x10, 'a', 0x01 }, 16UL );              // Truncated offset
+   }
+
+   {
+      test_ = "LZ decompression of data with an invalid length";
+
+      checkCorrupt( Bytes{ 0x40, 'a', 'b', 'c' }, 16UL );              // Literals beyond the input
+      checkCorrupt( Bytes{ 0xF0 }, 16UL );                             // Missing literal length
+      checkCorrupt( Bytes{ 0xF0, 0xFF }, 16UL );                       // Truncated literal length
+      checkCorrupt( Bytes{ 0xF0, 0x05, 'a' }, 16UL );                  // Extended literals beyond the input
+      checkCorrupt( Bytes{ 0x1F, 'a', 0x01, 0x00 }, 64UL );            // Missing match length
+      checkCorrupt( Bytes{ 0x1F, 'a', 0x01, 0x00, 0xFF }, 512UL );     // Truncated match length
+      checkCorrupt( Bytes{ 0x10, 'a', 0x01, 0x00 }, 16UL );            // Missing final literals
+   }
+
+   {
+      test_ = "LZ decompression into an insufficient capacity";
+
+      checkCorrupt( Bytes{ 0x30, 'a', 'b', 'c' }, 2UL );                   // Literals beyond the capacity
+      checkCorrupt( Bytes{ 0x10, 'a', 0x01, 0x00, 0x00 }, 4UL );           // Match beyond the capacity
+      checkCorrupt( Bytes{ 0x1F, 'a', 0x01, 0x00, 0x10, 0x00 }, 30UL );  // Extended match beyond the capacity
+   }
+
+   {
+      test_ = "LZ decompression of randomly modified data";
+
+      std::vector<char> data( randomData( 3000UL, 3 ) );
+      data.insert( data.end(), data.begin(), data.begin()+2000 );
+
+      const std::vector<char> compressed( compress( data ) );
+
+      for( size_t i=0UL; i<2000UL; ++i )
+      {
+         std::vector<char> src( compressed );
+         const size_t count( blaze::rand<size_t>( 1UL, 3UL ) );
+         for( size_t k=0UL; k<count; ++k ) {
+            src[blaze::rand<size_t>( 0UL, src.size()-1UL )] = static_cast<char>( blaze::rand<int>( 0, 255 ) );
+         }
+
+         std::vector<char> dst( data.size()+16UL, char( 0x5A ) );
+
+         const size_t result( blaze::lzDecompress( src.data(), src.size(), dst.data(), data.size() ) );
+
+         if( result > data.size() ||
+             std::count( dst.begin()+data.size(), dst.end(), char( 0x5A ) ) != 16 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Decompression exceeded the capacity\n"
+                << " Details:\n"
+                << "   Capacity = " << data.size() << "\n"
+                << "   Result   = " << result << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the compression and decompression of the given data.
+//
+// \param data The data to be compressed.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compresses the given data, decompresses the compressed data and compares the
+// result with the original data. Additionally, it checks that the decompression into an array
+// that is one byte too small fails. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void OperationTest::checkRoundTrip( const std::vector<char>& data )
+{
+   const std::vector<char> compressed( compress( data ) );
+   std::vector<char> dst( data.size()+16UL, char( 0x5A ) );
+
+   const size_t size( blaze::lzDecompress( compressed.data(), compressed.size(), dst.data(), data.size() ) );
+
+   if( size != data.size() || !std::equal( data.begin(), data.end(), dst.begin() ) ||
+       std::count( dst.begin()+data.size(), dst.end(), char( 0x5A ) ) != 16 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Decompression did not restore the original data\n"
+          << " Details:\n"
+          << "   Size              = " << data.size() << "\n"
+          << "   Compressed size   = " << compressed.size() << "\n"
+          << "   Decompressed size = " << size << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   if( data.size() > 0UL &&
+       blaze::lzDecompress( compressed.data(), compressed.size(), dst.data(), data.size()-1UL ) != 0UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Decompression into an insufficient capacity succeeded\n"
+          << " Details:\n"
+          << "   Size     = " << data.size() << "\n"
+          << "   Capacity = " << data.size()-1UL << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking that the given compressed data is rejected.
+//
+// \param compressed The corrupt compressed data.
+// \param capacity The capacity for the decompressed data.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that the decompression of the given data fails without writing beyond
+// the given capacity. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::checkCorrupt( const std::vector<unsigned char>& compressed, size_t capacity )
+{
+   const std::vector<char> src( compressed.begin(), compressed.end() );
+   std::vector<char> dst( capacity+16UL, char( 0x5A ) );
+
+   const size_t result( blaze::lzDecompress( src.data(), src.size(), dst.data(), capacity ) );
+
+   if( result != 0UL || std::count( dst.begin()+capacity, dst.end(), char( 0x5A ) ) != 16 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Decompression of corrupt data succeeded\n"
+          << " Details:\n"
+          << "   Data:";
+      for( unsigned char c : compressed ) oss << " " << int( c );
+      oss << "\n   Capacity = " << capacity << "\n"
+          << "   Result   = " << result << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Compression of the given data.
+//
+// \param data The data to be compressed.
+// \return The compressed data.
+// \exception std::runtime_error Compression failed.
+*/
+std::vector<char> OperationTest::compress( const std::vector<char>& data )
+{
+   std::vector<char> compressed( data.size() + data.size()/255UL + 16UL );
+
+   const size_t size( blaze::lzCompress( data.data(), data.size(), compressed.data(), compressed.size() ) );
+
+   if( size == 0UL ) {
+      throw std::runtime_error( " Error: Compression failed\n" );
+   }
+
+   compressed.resize( size );
+   return compressed;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creating an array of random bytes.
+//
+// \param size The size of the array.
+// \param range The maximum value of the random bytes.
+// \return The array of random bytes.
+*/
+std::vector<char> OperationTest::randomData( size_t size, int range )
+{
+   std::vector<char> data( size );
+   for( char& c : data ) c = static_cast<char>( blaze::rand<int>( 0, range ) );
+   return data;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creating an array of slowly varying double precision values.
+//
+// \param n The number of values.
+// \return The bytes of the values.
+*/
+std::vector<char> OperationTest::smoothData( size_t n )
+{
+   std::vector<char> data( n*sizeof(double) );
+   for( size_t i=0UL; i<n; ++i ) {
+      const double value( std::sin( 0.001*i ) );
+      std::memcpy( data.data()+i*sizeof(double), &value, sizeof(double) );
+   }
+   return data;
+}
+//*************************************************************************************************
+
+} // namespace compression
+
+} // namespace utiltest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running compression operation test..." << std::endl;
+
+   try
+   {
+      RUN_COMPRESSION_OPERATION_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during compression operation test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,689 @@
+//=================================================================================================
+/*!
+//  \file src/utiltest/kerneltrace/OperationTest.cpp
+//  \brief Source file for the kernel trace operation test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <atomic>
+#include <cctype>
+#include <cstdlib>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <blazetest/utiltest/kerneltrace/OperationTest.h>
+
+
+namespace blazetest {
+
+namespace utiltest {
+
+namespace kerneltrace {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the OperationTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+OperationTest::OperationTest()
+{
+   testThreads();
+   testRecycling();
+   testWrapAround();
+   testClear();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the recording of kernel trace events on several threads.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function records events on several threads that are running at the same time and
+// checks that the exported trace contains all events of every thread in the recorded order,
+// with a separate thread index per thread. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testThreads()
+{
+   test_ = "Kernel traces of several threads";
+
+   const size_t threads( 4UL );
+   const size_t events ( 100UL );
+
+   blaze::clearKernelTraces();
+
+   std::atomic<size_t> started( 0UL );
+   std::vector<std::thread> pool;
+
+   for( size_t t=0UL; t<threads; ++t ) {
+      pool.emplace_back( [&started,t,threads,events]()
+      {
+         for( size_t i=0UL; i<events; ++i ) {
+            BLAZE_KERNEL_TRACE( "threads", "test", t, i, 0UL );
+            if( i == 0UL ) ++started;
+            while( started < threads ) std::this_thread::yield();
+         }
+      } );
+   }
+
+   for( std::thread& thread : pool ) {
+      thread.join();
+   }
+
+   const std::vector<Event> trace( readTraces() );
+   const std::vector<Event> recorded( filter( trace, "threads" ) );
+
+   std::vector<size_t> counts( threads, 0UL );
+   std::vector<size_t> tids( threads, 0UL );
+
+   for( const Event& event : recorded )
+   {
+      if( event.m >= threads || event.n != counts[event.m] || event.cat != "test" || event.k != 0UL ||
+          ( event.n > 0UL && event.tid != tids[event.m] ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid kernel trace event\n"
+             << " Details:\n"
+             << "   Thread             = " << event.m << "\n"
+             << "   Event              = " << event.n << " (expected: " << ( event.m < threads ? counts[event.m] : 0UL ) << ")\n"
+             << "   Thread index       = " << event.tid << "\n"
+             << "   Kernel             = " << event.cat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      tids[event.m] = event.tid;
+      ++counts[event.m];
+   }
+
+   for( size_t t=0UL; t<threads; ++t )
+   {
+      bool named( false );
+      for( const Event& event : trace ) {
+         if( event.ph == "M" && event.tid == tids[t] ) named = true;
+      }
+
+      for( size_t u=0UL; u<t; ++u )
+      {
+         if( tids[u] == tids[t] ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Concurrent threads share a thread index\n"
+                << " Details:\n"
+                << "   Threads      = " << u << ", " << t << "\n"
+                << "   Thread index = " << tids[t] << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      if( counts[t] != events || !named ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Missing kernel trace events\n"
+             << " Details:\n"
+             << "   Thread                = " << t << "\n"
+             << "   Number of events      = " << counts[t] << " (expected: " << events << ")\n"
+             << "   Thread name meta data = " << ( named ? "yes" : "no" ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the reuse of the trace buffers of exited threads.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function repeatedly creates groups of threads that record kernel trace events and checks
+// that the number of trace buffers does not grow beyond the number of threads that are running
+// at the same time. Additionally, it checks that the events of exited threads are exported. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testRecycling()
+{
+   test_ = "Reuse of the kernel trace buffers";
+
+   const size_t threads( 4UL );
+   const size_t rounds ( 20UL );
+
+   blaze::clearKernelTraces();
+
+   size_t buffers( 0UL );
+
+   for( size_t r=0UL; r<rounds; ++r )
+   {
+      std::atomic<size_t> started( 0UL );
+      std::vector<std::thread> pool;
+
+      for( size_t t=0UL; t<threads; ++t ) {
+         pool.emplace_back( [&started,r,t,threads]()
+         {
+            BLAZE_KERNEL_TRACE( "recycling", "test", r, t, 0UL );
+            ++started;
+            while( started < threads ) std::this_thread::yield();
+         } );
+      }
+
+      for( std::thread& thread : pool ) {
+         thread.join();
+      }
+
+      if( r == 0UL ) {
+         buffers = countBuffers();
+      }
+      else if( countBuffers() != buffers ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Trace buffers of exited threads are not reused\n"
+             << " Details:\n"
+             << "   Round             = " << r << "\n"
+             << "   Number of buffers = " << countBuffers() << " (expected: " << buffers << ")\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   const std::vector<Event> recorded( filter( readTraces(), "recycling" ) );
+   std::vector<size_t> counts( rounds, 0UL );
+
+   for( const Event& event : recorded ) {
+      if( event.m < rounds ) ++counts[event.m];
+   }
+
+   for( size_t r=0UL; r<rounds; ++r )
+   {
+      if( counts[r] != threads ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Missing kernel trace events of exited threads\n"
+             << " Details:\n"
+             << "   Round            = " << r << "\n"
+             << "   Number of events = " << counts[r] << " (expected: " << threads << ")\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the wrap-around of the kernel trace ring buffer.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function records more events than fit into the ring buffer of a thread and checks that
+// exactly the latest \a KERNEL_TRACE_BUFFER_SIZE events are exported. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testWrapAround()
+{
+   test_ = "Kernel trace ring buffer wrap-around";
+
+   const size_t size ( blaze::KERNEL_TRACE_BUFFER_SIZE );
+   const size_t extra( 100UL );
+
+   blaze::clearKernelTraces();
+
+   for( size_t i=0UL; i<size+extra; ++i ) {
+      BLAZE_KERNEL_TRACE( "wraparound", "test", 0UL, i, 0UL );
+   }
+
+   const std::vector<Event> recorded( filter( readTraces(), "wraparound" ) );
+
+   if( recorded.size() != size ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of events\n"
+          << " Details:\n"
+          << "   Number of events = " << recorded.size() << " (expected: " << size << ")\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   for( size_t i=0UL; i<size; ++i )
+   {
+      if( recorded[i].n != i+extra || ( i > 0UL && recorded[i].ts < recorded[i-1UL].ts ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid order of events\n"
+             << " Details:\n"
+             << "   Index  = " << i << "\n"
+             << "   Event  = " << recorded[i].n << " (expected: " << i+extra << ")\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the clearKernelTraces() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that clearKernelTraces() discards the events of all threads, including
+// the events of exited threads, and that events recorded afterwards are exported. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testClear()
+{
+   test_ = "clearKernelTraces()";
+
+   for( size_t i=0UL; i<10UL; ++i ) {
+      BLAZE_KERNEL_TRACE( "clear", "test", 0UL, 100UL+i, 0UL );
+   }
+
+   std::thread thread( []() {
+      for( size_t i=0UL; i<10UL; ++i ) {
+         BLAZE_KERNEL_TRACE( "clear", "test", 1UL, 100UL+i, 0UL );
+      }
+   } );
+   thread.join();
+
+   blaze::clearKernelTraces();
+
+   const std::vector<Event> cleared( readTraces() );
+
+   for( const Event& event : cleared )
+   {
+      if( event.ph != "M" ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Event has not been discarded\n"
+             << " Details:\n"
+             << "   Name  = " << event.name << "\n"
+             << "   Event = " << event.n << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   for( size_t i=0UL; i<5UL; ++i ) {
+      BLAZE_KERNEL_TRACE( "clear", "test", 0UL, i, 0UL );
+   }
+
+   const std::vector<Event> recorded( readTraces() );
+   const std::vector<Event> events( filter( recorded, "clear" ) );
+
+   bool valid( events.size() == 5UL && recorded.size() == cleared.size() + 5UL );
+
+   for( size_t i=0UL; valid && i<5UL; ++i ) {
+      valid = ( events[i].n == i );
+   }
+
+   if( !valid ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid events after clearing the kernel traces\n"
+          << " Details:\n"
+          << "   Number of events        = " << events.size() << " (expected: 5)\n"
+          << "   Total number of entries = " << recorded.size() << " (expected: " << cleared.size() + 5UL << ")\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+//*************************************************************************************************
+/*!\brief Writes and parses the kernel traces of all threads.
+//
+// \return The parsed trace events.
+// \exception std::runtime_error Invalid trace output.
+//
+// This function writes the kernel traces via writeKernelTraces(), parses the JSON output, and
+// checks the structure of every event.
+*/
+std::vector<OperationTest::Event> OperationTest::readTraces() const
+{
+   std::ostringstream os;
+   blaze::writeKernelTraces( os );
+
+   const JsonValue root( parseJson( os.str() ) );
+
+   if( root.type != '{' || member( root, "displayTimeUnit", '"' ).string != "ns" ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid kernel trace header\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   std::vector<Event> events;
+
+   for( const JsonValue& value : member( root, "traceEvents", '[' ).values )
+   {
+      if( value.type != '{' ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Kernel trace event is not a JSON object\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      Event event{};
+      event.name = member( value, "name", '"' ).string;
+      event.ph   = member( value, "ph"  , '"' ).string;
+      event.tid  = static_cast<size_t>( member( value, "tid", '0' ).number );
+
+      const JsonValue& args( member( value, "args", '{' ) );
+
+      if( event.ph == "X" ) {
+         event.cat = member( value, "cat", '"' ).string;
+         event.ts  = member( value, "ts" , '0' ).number;
+         event.dur = member( value, "dur", '0' ).number;
+         event.m   = static_cast<size_t>( member( args, "m", '0' ).number );
+         event.n   = static_cast<size_t>( member( args, "n", '0' ).number );
+         event.k   = static_cast<size_t>( member( args, "k", '0' ).number );
+
+         if( member( args, "kernel", '"' ).string != event.cat || event.dur < 0.0 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid kernel trace event\n"
+                << " Details:\n"
+                << "   Name     = " << event.name << "\n"
+                << "   Duration = " << event.dur << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+      else if( event.ph != "M" || event.name != "thread_name" ||
+               member( args, "name", '"' ).string != "Thread " + std::to_string( event.tid ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid kernel trace meta data\n"
+             << " Details:\n"
+             << "   Name  = " << event.name << "\n"
+             << "   Phase = " << event.ph << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      events.push_back( event );
+   }
+
+   return events;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Selects all complete events of the given name.
+//
+// \param events The parsed trace events.
+// \param name The name of the selected events.
+// \return The selected events (in the order of the trace).
+*/
+std::vector<OperationTest::Event>
+   OperationTest::filter( const std::vector<Event>& events, const std::string& name ) const
+{
+   std::vector<Event> selected;
+
+   for( const Event& event : events ) {
+      if( event.ph == "X" && event.name == name )
+         selected.push_back( event );
+   }
+
+   return selected;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of kernel trace buffers.
+//
+// \return The number of trace buffers owned by the kernel trace registry.
+*/
+size_t OperationTest::countBuffers() const
+{
+   blaze::KernelTraceRegistry& registry( blaze::getKernelTraceRegistry() );
+   std::lock_guard<std::mutex> lock( registry.mutex_ );
+   return registry.buffers_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Parses the given JSON text.
+//
+// \param text The JSON text.
+// \return The parsed JSON value.
+// \exception std::runtime_error Invalid JSON.
+*/
+OperationTest::JsonValue OperationTest::parseJson( const std::string& text ) const
+{
+   size_t pos( 0UL );
+   const JsonValue value( parseValue( text, pos ) );
+
+   while( pos < text.size() && std::isspace( static_cast<unsigned char>( text[pos] ) ) ) ++pos;
+
+   if( pos != text.size() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Unexpected characters after the JSON value\n"
+          << " Details:\n"
+          << "   Position = " << pos << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   return value;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Parses a single JSON value.
+//
+// \param text The JSON text.
+// \param pos The position of the value in the text (updated to the end of the value).
+// \return The parsed JSON value.
+// \exception std::runtime_error Invalid JSON.
+*/
+OperationTest::JsonValue OperationTest::parseValue( const std::string& text, size_t& pos ) const
+{
+   const auto skip = [&]() {
+      while( pos < text.size() && std::isspace( static_cast<unsigned char>( text[pos] ) ) ) ++pos;
+   };
+
+   const auto error = [&]( const char* message ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid JSON output of writeKernelTraces(): " << message << "\n"
+          << " Details:\n"
+          << "   Position = " << pos << "\n"
+          << "   Context  = " << text.substr( pos < 40UL ? 0UL : pos-40UL, 80UL ) << "\n";
+      throw std::runtime_error( oss.str() );
+   };
+
+   const auto parseString = [&]() {
+      std::string str;
+      ++pos;
+      while( pos < text.size() && text[pos] != '"' ) {
+         if( static_cast<unsigned char>( text[pos] ) < 0x20 ) error( "control character in string" );
+         if( text[pos] == '\\' ) ++pos;
+         if( pos < text.size() ) str += text[pos++];
+      }
+      if( pos == text.size() ) error( "unterminated string" );
+      ++pos;
+      return str;
+   };
+
+   JsonValue value{};
+
+   skip();
+
+   if( pos == text.size() ) error( "unexpected end of input" );
+
+   if( text[pos] == '{' )
+   {
+      value.type = '{';
+      ++pos;
+      skip();
+      if( pos < text.size() && text[pos] == '}' ) { ++pos; return value; }
+      while( true ) {
+         skip();
+         if( pos == text.size() || text[pos] != '"' ) error( "expected key" );
+         value.keys.push_back( parseString() );
+         skip();
+         if( pos == text.size() || text[pos] != ':' ) error( "expected ':'" );
+         ++pos;
+         value.values.push_back( parseValue( text, pos ) );
+         skip();
+         if( pos < text.size() && text[pos] == ',' ) { ++pos; continue; }
+         if( pos < text.size() && text[pos] == '}' ) { ++pos; break; }
+         error( "expected ',' or '}'" );
+      }
+   }
+   else if( text[pos] == '[' )
+   {
+      value.type = '[';
+      ++pos;
+      skip();
+      if( pos < text.size() && text[pos] == ']' ) { ++pos; return value; }
+      while( true ) {
+         value.values.push_back( parseValue( text, pos ) );
+         skip();
+         if( pos < text.size() && text[pos] == ',' ) { ++pos; continue; }
+         if( pos < text.size() && text[pos] == ']' ) { ++pos; break; }
+         error( "expected ',' or ']'" );
+      }
+   }
+   else if( text[pos] == '"' )
+   {
+      value.type = '"';
+      value.string = parseString();
+   }
+   else if( text.compare( pos, 4UL, "true" ) == 0 || text.compare( pos, 5UL, "false" ) == 0 )
+   {
+      value.type = 'b';
+      value.number = ( text[pos] == 't' ) ? 1.0 : 0.0;
+      pos += ( text[pos] == 't' ) ? 4UL : 5UL;
+   }
+   else if( text.compare( pos, 4UL, "null" ) == 0 )
+   {
+      value.type = 'n';
+      pos += 4UL;
+   }
+   else
+   {
+      const char* begin( text.c_str() + pos );
+      char* end( nullptr );
+      value.type = '0';
+      value.number = std::strtod( begin, &end );
+      if( end == begin ) error( "invalid value" );
+      pos += static_cast<size_t>( end - begin );
+   }
+
+   return value;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the member of the given JSON object.
+//
+// \param object The JSON object.
+// \param key The key of the member.
+// \param type The expected type of the member.
+// \return The member of the given key.
+// \exception std::runtime_error Missing member or invalid type.
+*/
+const OperationTest::JsonValue&
+   OperationTest::member( const JsonValue& object, const std::string& key, char type ) const
+{
+   for( size_t i=0UL; i<object.keys.size(); ++i ) {
+      if( object.keys[i] == key && object.values[i].type == type )
+         return object.values[i];
+   }
+
+   std::ostringstream oss;
+   oss << " Test: " << test_ << "\n"
+       << " Error: Missing or invalid member of a JSON object\n"
+       << " Details:\n"
+       << "   Key           = " << key << "\n"
+       << "   Expected type = " << type << "\n";
+   throw std::runtime_error( oss.str() );
+}
+//*************************************************************************************************
+
+} // namespace kerneltrace
+
+} // namespace utiltest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running kernel trace operation test..." << std::endl;
+
+   try
+   {
+      RUN_KERNELTRACE_OPERATION_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during kernel trace operation test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
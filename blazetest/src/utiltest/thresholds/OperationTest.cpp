@@ -0,0 +1,508 @@
+//=================================================================================================
+/*!
+//  \file src/utiltest/thresholds/OperationTest.cpp
+//  \brief Source file for the runtime threshold operation test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <blazetest/utiltest/thresholds/OperationTest.h>
+
+
+namespace blazetest {
+
+namespace utiltest {
+
+namespace thresholds {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the OperationTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+OperationTest::OperationTest()
+   : test_    ()
+   , filename_( "OperationTest.thresholds" )
+{
+   testDefaults();
+   testAccess();
+   testRoundTrip();
+   testComments();
+   testMalformed();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Destructor for the OperationTest class test.
+//
+// The destructor removes the temporary tuning table and restores the default thresholds.
+*/
+OperationTest::~OperationTest()
+{
+   std::remove( filename_.c_str() );
+   blaze::resetThresholds();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the initial values of the runtime thresholds.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// In case the \c BLAZE_THRESHOLDS environment variable is not set, no tuning table is loaded
+// during static initialization and all thresholds have their compile time defaults. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testDefaults()
+{
+   test_ = "Default thresholds";
+
+   if( std::getenv( "BLAZE_THRESHOLDS" ) != nullptr )
+      return;
+
+   if( blaze::loadThresholdsFromEnvironment() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Tuning table loaded without BLAZE_THRESHOLDS environment variable\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   checkThresholds( getDefaults(), "Initial thresholds" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the getThreshold(), setThreshold(), and resetThresholds() functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the access to single thresholds by name and via the according threshold
+// references. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testAccess()
+{
+   test_ = "Threshold access";
+
+   blaze::setThreshold( "DMATDMATMULT_THRESHOLD", 1234UL );
+   blaze::setThreshold( "SMP_DVECASSIGN_THRESHOLD", 0UL );
+
+   if( blaze::DMATDMATMULT_THRESHOLD != 1234UL || blaze::getThreshold( "DMATDMATMULT_THRESHOLD" ) != 1234UL ||
+       blaze::SMP_DVECASSIGN_THRESHOLD != 0UL || blaze::getThreshold( "SMP_DVECASSIGN_THRESHOLD" ) != 0UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Setting thresholds failed\n"
+          << " Details:\n"
+          << "   DMATDMATMULT_THRESHOLD   = " << blaze::DMATDMATMULT_THRESHOLD << " (expected: 1234)\n"
+          << "   SMP_DVECASSIGN_THRESHOLD = " << blaze::SMP_DVECASSIGN_THRESHOLD << " (expected: 0)\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   try {
+      blaze::setThreshold( "DMATDMATMULT_THRESHOLD", 0UL );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Setting a non-SMP threshold to 0 succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   try {
+      blaze::getThreshold( "UNKNOWN_THRESHOLD" );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Access to an unknown threshold succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   if( blaze::DMATDMATMULT_THRESHOLD != 1234UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Failed setting of a threshold changed its value\n"
+          << " Details:\n"
+          << "   DMATDMATMULT_THRESHOLD = " << blaze::DMATDMATMULT_THRESHOLD << " (expected: 1234)\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   blaze::resetThresholds();
+   checkThresholds( getDefaults(), "resetThresholds()" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the round trip of a tuning table via writeThresholds() and loadThresholds().
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function modifies all thresholds, writes the tuning table to a file, restores the
+// defaults, and reloads the tuning table. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testRoundTrip()
+{
+   test_ = "Tuning table round trip";
+
+   size_t index( 0UL );
+   for( const blaze::RuntimeThreshold& entry : blaze::RuntimeThresholdTable<>::entries ) {
+      blaze::setThreshold( entry.name, entry.defaultValue + ( ++index ) );
+   }
+
+   const std::vector<size_t> expected( getThresholds() );
+
+   blaze::writeThresholds( filename_ );
+
+   std::ostringstream table;
+   blaze::writeThresholds( table );
+
+   std::ifstream file( filename_ );
+   std::ostringstream content;
+   content << file.rdbuf();
+
+   if( content.str() != table.str() || table.str().empty() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid tuning table file\n"
+          << " Details:\n"
+          << "   File content:\n" << content.str() << "\n"
+          << "   Expected content:\n" << table.str() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   blaze::resetThresholds();
+   checkThresholds( getDefaults(), "resetThresholds()" );
+
+   blaze::loadThresholds( filename_ );
+   checkThresholds( expected, "loadThresholds()" );
+
+   const size_t dmatdmatmult( static_cast<size_t>( blaze::RuntimeThresholdID::DMATDMATMULT_THRESHOLD ) );
+   const size_t smpdvecassign( static_cast<size_t>( blaze::RuntimeThresholdID::SMP_DVECASSIGN_THRESHOLD ) );
+
+   if( blaze::DMATDMATMULT_THRESHOLD != expected[dmatdmatmult] ||
+       blaze::SMP_DVECASSIGN_THRESHOLD != expected[smpdvecassign] ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid threshold references after loading the tuning table\n"
+          << " Details:\n"
+          << "   DMATDMATMULT_THRESHOLD   = " << blaze::DMATDMATMULT_THRESHOLD << " (expected: " << expected[dmatdmatmult] << ")\n"
+          << "   SMP_DVECASSIGN_THRESHOLD = " << blaze::SMP_DVECASSIGN_THRESHOLD << " (expected: " << expected[smpdvecassign] << ")\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   blaze::resetThresholds();
+
+   try {
+      blaze::writeThresholds( "/nonexistent-directory/thresholds" );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Writing a tuning table to an invalid path succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& ex ) {
+      if( std::string( ex.what() ).find( " Test: " ) != std::string::npos ) throw;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of tuning tables with comments and empty lines.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function loads a partial tuning table with comments, empty lines, and additional white
+// space. Thresholds that are not listed have to retain their value. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testComments()
+{
+   test_ = "Tuning table with comments";
+
+   blaze::resetThresholds();
+
+   writeFile( "# Tuning table\n"
+              "\n"
+              "   DMATDVECMULT_THRESHOLD   77   # Comment\n"
+              "\tSMP_DVECASSIGN_THRESHOLD 0\n"
+              "#TDMATDVECMULT_THRESHOLD 88\n" );
+
+   blaze::loadThresholds( filename_ );
+
+   std::vector<size_t> expected( getDefaults() );
+   expected[static_cast<size_t>( blaze::RuntimeThresholdID::DMATDVECMULT_THRESHOLD )] = 77UL;
+   expected[static_cast<size_t>( blaze::RuntimeThresholdID::SMP_DVECASSIGN_THRESHOLD )] = 0UL;
+
+   checkThresholds( expected, "loadThresholds()" );
+
+   blaze::resetThresholds();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the rejection of malformed tuning tables.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function loads tuning tables with a single invalid entry between two valid entries and
+// checks that loadThresholds() throws and that all thresholds retain their previous value. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testMalformed()
+{
+   test_ = "Malformed tuning tables";
+
+   const char* const entries[] = {
+      "UNKNOWN_THRESHOLD 5",
+      "DMATDMATMULT_THRESHOLD",
+      "DMATDMATMULT_THRESHOLD abc",
+      "DMATDMATMULT_THRESHOLD 12abc",
+      "DMATDMATMULT_THRESHOLD 5 6",
+      "DMATDMATMULT_THRESHOLD 0",
+      "DMATDMATMULT_THRESHOLD -5",
+      "DMATDMATMULT_THRESHOLD 1e5",
+      "DMATDMATMULT_THRESHOLD 99999999999999999999999" };
+
+   blaze::resetThresholds();
+   blaze::setThreshold( "TDMATDMATMULT_THRESHOLD", 555UL );
+
+   const std::vector<size_t> expected( getThresholds() );
+
+   for( const char* entry : entries )
+   {
+      writeFile( std::string( "DMATDVECMULT_THRESHOLD 4242\n" ) + entry + "\nTDMATDVECMULT_THRESHOLD 4343\n" );
+
+      try {
+         blaze::loadThresholds( filename_ );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Loading a malformed tuning table succeeded\n"
+             << " Details:\n"
+             << "   Invalid entry = \"" << entry << "\"\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      checkThresholds( expected, std::string( "Invalid entry \"" ) + entry + "\"" );
+   }
+
+   std::remove( filename_.c_str() );
+
+   try {
+      blaze::loadThresholds( filename_ );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Loading a missing tuning table succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& ex ) {
+      if( std::string( ex.what() ).find( " Test: " ) != std::string::npos ) throw;
+   }
+
+   checkThresholds( expected, "Missing tuning table" );
+
+   blaze::resetThresholds();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the values of all thresholds.
+//
+// \param expected The expected values of all thresholds.
+// \param context The context of the check.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void OperationTest::checkThresholds( const std::vector<size_t>& expected, const std::string& context ) const
+{
+   const std::vector<size_t> values( getThresholds() );
+
+   for( size_t i=0UL; i<values.size(); ++i )
+   {
+      if( values[i] != expected[i] ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid threshold value\n"
+             << " Details:\n"
+             << "   Context   = " << context << "\n"
+             << "   Threshold = " << blaze::RuntimeThresholdTable<>::entries[i].name << "\n"
+             << "   Value     = " << values[i] << " (expected: " << expected[i] << ")\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Writes the given content to the temporary tuning table file.
+//
+// \param content The content of the tuning table.
+// \return void
+// \exception std::runtime_error File could not be written.
+*/
+void OperationTest::writeFile( const std::string& content ) const
+{
+   std::ofstream file( filename_ );
+
+   if( !( file << content ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Tuning table file could not be written\n"
+          << " Details:\n"
+          << "   File = " << filename_ << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current values of all thresholds (via getThreshold()).
+//
+// \return The current values of all thresholds.
+*/
+std::vector<size_t> OperationTest::getThresholds()
+{
+   std::vector<size_t> values;
+
+   for( const blaze::RuntimeThreshold& entry : blaze::RuntimeThresholdTable<>::entries ) {
+      values.push_back( blaze::getThreshold( entry.name ) );
+   }
+
+   return values;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the compile time defaults of all thresholds.
+//
+// \return The compile time defaults of all thresholds.
+*/
+std::vector<size_t> OperationTest::getDefaults()
+{
+   std::vector<size_t> values;
+
+   for( const blaze::RuntimeThreshold& entry : blaze::RuntimeThresholdTable<>::entries ) {
+      values.push_back( entry.defaultValue );
+   }
+
+   return values;
+}
+//*************************************************************************************************
+
+} // namespace thresholds
+
+} // namespace utiltest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running runtime threshold operation test..." << std::endl;
+
+   try
+   {
+      RUN_THRESHOLDS_OPERATION_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during runtime threshold operation test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
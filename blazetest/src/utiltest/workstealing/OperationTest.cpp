@@ -0,0 +1,721 @@
+//=================================================================================================
+/*!
+//  \file src/utiltest/workstealing/OperationTest.cpp
+//  \brief Source file for the work stealing operation test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/util/Random.h>
+#include <blazetest/utiltest/workstealing/OperationTest.h>
+
+
+namespace blazetest {
+
+namespace utiltest {
+
+namespace workstealing {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the OperationTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+OperationTest::OperationTest()
+{
+   // Work-stealing deque
+   testPushPop();
+   testGrowth();
+   testStealPop();
+   testStealStress();
+
+   // Work-stealing thread pool
+   testPool();
+   testStealHalf();
+   testException();
+   testThreadAssign();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the push(), pop() and steal() functions of the work-stealing deque.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the LIFO order of the owner end and the FIFO order of the steal end of
+// the work-stealing deque within a single thread. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testPushPop()
+{
+   test_ = "WorkStealingDeque push/pop";
+
+   Deque deque;
+   std::vector<Task> tasks( 10UL );
+   bool abort( false );
+
+   if( !deque.isEmpty() || deque.size() != 0UL || deque.pop() != nullptr ||
+       deque.steal( abort ) != nullptr || abort ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid state of a default deque\n"
+          << " Details:\n"
+          << "   Size = " << deque.size() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   for( Task& task : tasks ) {
+      deque.push( &task );
+   }
+
+   if( deque.isEmpty() || deque.size() != 10UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid size\n"
+          << " Details:\n"
+          << "   Size          = " << deque.size() << "\n"
+          << "   Expected size = 10\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   for( size_t i=10UL; i>0UL; --i ) {
+      checkTask( deque.pop(), &tasks[i-1UL], i-1UL );
+   }
+
+   checkTask( deque.pop(), nullptr, 10UL );
+
+   test_ = "WorkStealingDeque push/pop/steal";
+
+   for( size_t i=0UL; i<3UL; ++i ) {
+      deque.push( &tasks[i] );
+   }
+
+   checkTask( deque.steal( abort ), &tasks[0], 0UL );
+   checkTask( deque.pop(), &tasks[2], 2UL );
+   checkTask( deque.steal( abort ), &tasks[1], 1UL );
+   checkTask( deque.steal( abort ), nullptr, 3UL );
+   checkTask( deque.pop(), nullptr, 3UL );
+
+   if( !deque.isEmpty() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Non-empty deque detected\n"
+          << " Details:\n"
+          << "   Size = " << deque.size() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the growth of the work-stealing deque.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function pushes many more tasks than the initial capacity into a work-stealing deque
+// (repeatedly, i.e. with indices that wrap around the circular buffers) and checks that all
+// tasks are retained in order. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void OperationTest::testGrowth()
+{
+   test_ = "WorkStealingDeque growth";
+
+   Deque deque( 4UL );
+   std::vector<Task> tasks( 1000UL );
+   bool abort( false );
+
+   for( size_t round=0UL; round<3UL; ++round )
+   {
+      for( Task& task : tasks ) {
+         deque.push( &task );
+      }
+
+      if( deque.size() != tasks.size() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid size\n"
+             << " Details:\n"
+             << "   Round         = " << round << "\n"
+             << "   Size          = " << deque.size() << "\n"
+             << "   Expected size = " << tasks.size() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      for( size_t i=0UL; i<500UL; ++i ) {
+         checkTask( deque.steal( abort ), &tasks[i], i );
+      }
+
+      for( size_t i=tasks.size(); i>500UL; --i ) {
+         checkTask( deque.pop(), &tasks[i-1UL], i-1UL );
+      }
+
+      checkTask( deque.pop(), nullptr, tasks.size() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of concurrent steal() and pop() calls on the last element of the deque.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function repeatedly pushes a single task into a work-stealing deque and lets the owner
+// pop and a thief steal the task concurrently. In every round exactly one of them has to
+// acquire the task. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testStealPop()
+{
+   test_ = "WorkStealingDeque concurrent steal/pop of the last task";
+
+   const size_t rounds( 20000UL );
+
+   Deque deque;
+   std::vector<Task> tasks( rounds );
+   std::vector<Task*> stolen( rounds, nullptr );
+   std::atomic<size_t> started( 0UL ), finished( 0UL );
+
+   std::thread thief( [&]()
+   {
+      for( size_t round=1UL; round<=rounds; ++round )
+      {
+         while( started.load() < round ) {
+            std::this_thread::yield();
+         }
+
+         bool abort( false );
+         Task* task( nullptr );
+
+         do {
+            task = deque.steal( abort );
+         } while( task == nullptr && abort );
+
+         stolen[round-1UL] = task;
+         finished.store( round );
+      }
+   } );
+
+   size_t pops( 0UL ), failures( 0UL ), failedRound( 0UL );
+
+   for( size_t round=1UL; round<=rounds; ++round )
+   {
+      deque.push( &tasks[round-1UL] );
+      started.store( round );
+
+      Task* const popped( deque.pop() );
+
+      while( finished.load() < round ) {
+         std::this_thread::yield();
+      }
+
+      if( popped != nullptr ) ++pops;
+
+      const bool valid( ( popped == nullptr ) != ( stolen[round-1UL] == nullptr ) &&
+                        ( popped != nullptr ? popped : stolen[round-1UL] ) == &tasks[round-1UL] &&
+                        deque.isEmpty() );
+
+      if( !valid && failures++ == 0UL ) {
+         failedRound = round;
+      }
+   }
+
+   thief.join();
+
+   if( failures > 0UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Task not acquired exactly once\n"
+          << " Details:\n"
+          << "   Number of failed rounds = " << failures << "\n"
+          << "   First failed round      = " << failedRound << "\n"
+          << "   Number of pops          = " << pops << "\n"
+          << "   Number of steals        = " << ( rounds - pops ) << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Stress test of the work-stealing deque with several concurrent thieves.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function lets the owner of a work-stealing deque with a small initial capacity push
+// and pop tasks while several thieves concurrently steal from it, i.e. the deque grows while
+// being accessed by the thieves. Every task has to be acquired exactly once. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testStealStress()
+{
+   test_ = "WorkStealingDeque stress test";
+
+   const size_t N( 100000UL );
+   const size_t thieves( 3UL );
+
+   Deque deque( 2UL );
+   std::vector<Task> tasks( N );
+   std::vector< std::vector<Task*> > acquired( thieves+1UL );
+   std::atomic<bool> done( false );
+   std::vector<std::thread> threads;
+
+   for( size_t t=0UL; t<thieves; ++t ) {
+      threads.emplace_back( [&,t]()
+      {
+         while( true ) {
+            bool abort( false );
+            if( Task* task = deque.steal( abort ) )
+               acquired[t].push_back( task );
+            else if( !abort && done.load() )
+               return;
+            else
+               std::this_thread::yield();
+         }
+      } );
+   }
+
+   std::vector<Task*>& own( acquired[thieves] );
+
+   for( size_t i=0UL; i<N; )
+   {
+      for( size_t j=0UL; j<64UL && i<N; ++j, ++i ) {
+         deque.push( &tasks[i] );
+      }
+      for( size_t j=0UL; j<16UL; ++j ) {
+         if( Task* task = deque.pop() )
+            own.push_back( task );
+      }
+   }
+
+   while( Task* task = deque.pop() ) {
+      own.push_back( task );
+   }
+
+   done.store( true );
+
+   for( std::thread& thread : threads ) {
+      thread.join();
+   }
+
+   std::vector<size_t> counts( N, 0UL );
+   size_t invalid( 0UL );
+
+   for( const std::vector<Task*>& tasklist : acquired ) {
+      for( Task* task : tasklist ) {
+         if( task < tasks.data() || task >= tasks.data()+N ) ++invalid;
+         else ++counts[task - tasks.data()];
+      }
+   }
+
+   for( size_t i=0UL; i<N; ++i ) {
+      if( counts[i] != 1UL || invalid > 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Task not acquired exactly once\n"
+             << " Details:\n"
+             << "   Task index             = " << i << "\n"
+             << "   Number of acquisitions = " << counts[i] << "\n"
+             << "   Invalid task handles   = " << invalid << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the basic functionality of the work-stealing thread pool.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function executes several batches of tasks with different pool sizes and checks that
+// every task is executed exactly once. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void OperationTest::testPool()
+{
+   test_ = "WorkStealingPool task execution";
+
+   Pool pool( 4UL );
+
+   if( pool.size() != 4UL || !pool.isEmpty() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid state of a new thread pool\n"
+          << " Details:\n"
+          << "   Size = " << pool.size() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   for( size_t size : { 4UL, 3UL, 1UL, 5UL } )
+   {
+      pool.resize( size );
+
+      for( size_t tasks : { 0UL, 1UL, 3UL, 1000UL } )
+      {
+         std::vector<size_t> counts( tasks, 0UL );
+
+         for( size_t i=0UL; i<tasks; ++i ) {
+            pool.schedule( [&counts]( size_t index ) { ++counts[index]; }, i );
+         }
+
+         pool.wait();
+
+         for( size_t i=0UL; i<tasks; ++i ) {
+            if( counts[i] != 1UL || !pool.isEmpty() || pool.size() != size ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Task not executed exactly once\n"
+                   << " Details:\n"
+                   << "   Number of threads    = " << pool.size() << "\n"
+                   << "   Number of tasks      = " << tasks << "\n"
+                   << "   Task index           = " << i << "\n"
+                   << "   Number of executions = " << counts[i] << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the stealing of half of the tasks of another worker thread.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function blocks the second worker thread of a pool with two threads in its first task
+// until all other tasks have been completed. Therefore the first worker thread has to steal
+// all remaining tasks of the second worker thread. Since it steals half of the remaining tasks
+// at once and executes the additionally stolen tasks from its own deque (LIFO), the order of
+// execution is fixed. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testStealHalf()
+{
+   test_ = "WorkStealingPool stealing of half of the tasks";
+
+   const size_t N( 16UL );
+   const size_t blocking( N/2UL );
+   const auto timeout( std::chrono::seconds( 30 ) );
+
+   Pool pool( 2UL );
+
+   std::mutex mutex;
+   std::condition_variable condition;
+   std::vector<size_t> order;
+   bool started( false ), timedOut( false );
+
+   for( size_t i=0UL; i<N; ++i ) {
+      pool.schedule( [&]( size_t index )
+      {
+         std::unique_lock<std::mutex> lock( mutex );
+
+         // The first task of the first worker waits until the second worker is blocked
+         if( index == 0UL ) {
+            if( !condition.wait_for( lock, timeout, [&]{ return started; } ) )
+               timedOut = true;
+         }
+
+         // The first task of the second worker blocks until all other tasks have been executed
+         if( index == blocking ) {
+            started = true;
+            condition.notify_all();
+            if( !condition.wait_for( lock, timeout, [&]{ return order.size() == N-1UL; } ) )
+               timedOut = true;
+         }
+
+         order.push_back( index );
+         condition.notify_all();
+      }, i );
+   }
+
+   pool.wait();
+
+   const std::vector<size_t> expected{ 0UL, 1UL, 2UL, 3UL, 4UL, 5UL, 6UL, 7UL,
+                                       15UL, 12UL, 13UL, 14UL, 11UL, 10UL, 9UL, 8UL };
+
+   if( timedOut || order != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid order of execution\n"
+          << " Details:\n"
+          << "   Timeout = " << std::boolalpha << timedOut << "\n"
+          << "   Result:";
+      for( size_t index : order ) oss << " " << index;
+      oss << "\n   Expected result:";
+      for( size_t index : expected ) oss << " " << index;
+      oss << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the propagation of exceptions via the wait() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function schedules tasks that throw exceptions and checks that the first exception is
+// rethrown by the wait() function, that all other tasks of the batch are executed anyway, and
+// that the thread pool can be used afterwards. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testException()
+{
+   test_ = "WorkStealingPool exception propagation";
+
+   Pool pool( 3UL );
+
+   for( size_t throwing : { 1UL, 2UL, 100UL } )
+   {
+      const size_t N( 100UL );
+      std::vector<size_t> counts( N, 0UL );
+      bool caught( false );
+
+      for( size_t i=0UL; i<N; ++i ) {
+         pool.schedule( [&counts,throwing]( size_t index ) {
+            if( index % ( N / throwing ) == 42UL % ( N / throwing ) )
+               throw std::invalid_argument( "Task failure" );
+            ++counts[index];
+         }, i );
+      }
+
+      try {
+         pool.wait();
+      }
+      catch( std::invalid_argument& ex ) {
+         caught = ( std::string( ex.what() ) == "Task failure" );
+      }
+
+      size_t executed( 0UL );
+      for( size_t count : counts ) {
+         executed += count;
+      }
+
+      if( !caught || executed != N - throwing ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Exception not propagated\n"
+             << " Details:\n"
+             << "   Number of throwing tasks          = " << throwing << "\n"
+             << "   Exception caught                  = " << std::boolalpha << caught << "\n"
+             << "   Number of executed tasks          = " << executed << "\n"
+             << "   Expected number of executed tasks = " << ( N - throwing ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      // Executing a batch without exceptions
+      std::fill( counts.begin(), counts.end(), 0UL );
+
+      for( size_t i=0UL; i<N; ++i ) {
+         pool.schedule( [&counts]( size_t index ) { ++counts[index]; }, i );
+      }
+
+      pool.wait();
+
+      if( std::count( counts.begin(), counts.end(), 1UL ) != static_cast<ptrdiff_t>( N ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Thread pool unusable after an exception\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the parallel assignments based on the work-stealing thread pool.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares parallel dense vector and dense matrix assignments of the C++11
+// thread backend with the according serial assignments. The test is compiled with the
+// work-stealing scheduler (see the \c BLAZE_USE_WORK_STEALING command line argument) and uses
+// small integer values, i.e. the results have to be identical. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testThreadAssign()
+{
+   test_ = "Work-stealing thread assignment";
+
+#if !BLAZE_WORK_STEALING_MODE
+   {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Work-stealing mode not active\n";
+      throw std::runtime_error( oss.str() );
+   }
+#endif
+
+   blaze::setNumThreads( 4UL );
+
+   const size_t sizes[] = { 31UL, 257UL, 400UL };
+
+   for( size_t n : sizes )
+   {
+      blaze::DynamicMatrix<double,blaze::rowMajor> A( n, n ), B( n, n );
+      blaze::DynamicMatrix<double,blaze::columnMajor> C( n, n );
+
+      for( size_t i=0UL; i<n; ++i ) {
+         for( size_t j=0UL; j<n; ++j ) {
+            A(i,j) = blaze::rand<int>( -5, 5 );
+            B(i,j) = blaze::rand<int>( -5, 5 );
+            C(i,j) = blaze::rand<int>( -5, 5 );
+         }
+      }
+
+      blaze::DynamicVector<double> a( n*n ), b( n*n );
+      for( size_t i=0UL; i<n*n; ++i ) {
+         a[i] = blaze::rand<int>( -5, 5 );
+         b[i] = blaze::rand<int>( -5, 5 );
+      }
+
+      const blaze::DynamicMatrix<double,blaze::rowMajor> sum( A + C );
+      const blaze::DynamicMatrix<double,blaze::columnMajor> prod( A * B );
+      blaze::DynamicMatrix<double,blaze::rowMajor> compound( A );
+      compound -= B * C;
+      const blaze::DynamicVector<double> vsum( a + b * 2.0 );
+
+      blaze::DynamicMatrix<double,blaze::rowMajor> compoundRef( A );
+      compoundRef -= blaze::serial( B * C );
+
+      if( sum != blaze::serial( A + C ) || prod != blaze::serial( A * B ) ||
+          compound != compoundRef || vsum != blaze::serial( a + b * 2.0 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Parallel assignment differs from the serial assignment\n"
+             << " Details:\n"
+             << "   Size              = " << n << "\n"
+             << "   Number of threads = " << blaze::getNumThreads() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the given task handle.
+//
+// \param task The task handle returned by the deque.
+// \param expected The expected task handle.
+// \param index The index of the expected task.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void OperationTest::checkTask( const Task* task, const Task* expected, size_t index ) const
+{
+   if( task != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid task handle\n"
+          << " Details:\n"
+          << "   Index of the expected task = " << index << "\n"
+          << "   Result                     = " << task << "\n"
+          << "   Expected result            = " << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+} // namespace workstealing
+
+} // namespace utiltest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running work stealing operation test..." << std::endl;
+
+   try
+   {
+      RUN_WORKSTEALING_OPERATION_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during work stealing operation test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************